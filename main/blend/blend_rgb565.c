@@ -0,0 +1,335 @@
+/*
+ * RGB565 blend kernels
+ *
+ * LVGL mixes two RGB565 pixels by spreading each into a 32-bit word with
+ * the green field moved clear of red and blue (0x07E0F81F), so one
+ * multiply scales all three channels:
+ *
+ *   m   = (opa + 4) >> 3                                  0..32
+ *   out = (((fg - bg) * m) >> 5) + bg, masked and folded back to 16 bit
+ *
+ * Its per-pixel function repeats the spread of the constant colour, three
+ * early-outs and the opa rescale for every pixel. The kernels below keep
+ * the same arithmetic (so results are identical, including the early-out
+ * cases, which the formula already produces) but hoist everything
+ * constant out of the loop: fg * m is computed once because
+ * (fg - bg) * m == fg * m - bg * m modulo 2^32. For a constant colour at
+ * constant opacity (the card) the field layout never lets one channel
+ * borrow from another, so the result is a per-channel function of bg and
+ * is read from three small tables built per call. Pixels are loaded and
+ * stored two per 32-bit word, and A8 masks are read four bytes at a time
+ * so fully transparent and fully opaque runs of a glyph cost one compare.
+ */
+
+#include "blend_rgb565.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SPREAD_MASK 0x07E0F81Fu
+#define MASK_SOLID  0xFCFCFCFCu
+
+typedef uint32_t __attribute__((may_alias)) u32_alias_t;
+
+static atomic_bool s_enabled = true;
+
+void blend_rgb565_set_enabled(bool on)
+{
+    atomic_store(&s_enabled, on);
+}
+
+bool blend_rgb565_enabled(void)
+{
+    return atomic_load(&s_enabled);
+}
+
+// ---- Pixel arithmetic ----
+
+static inline uint32_t spread(uint32_t c)
+{
+    return (c | c << 16) & SPREAD_MASK;
+}
+
+static inline uint32_t fold(uint32_t v)
+{
+    v &= SPREAD_MASK;
+    return (v >> 16 | v) & 0xFFFF;
+}
+
+static inline uint32_t mix5(uint32_t opa)
+{
+    return (opa + 4) >> 3;
+}
+
+// `fgm` = spread(fg) * m
+static inline uint32_t mix_pre(uint32_t fgm, uint32_t m, uint32_t bg)
+{
+    uint32_t b = spread(bg);
+    return fold(((fgm - b * m) >> 5) + b);
+}
+
+// lv_color_16_16_mix() of LVGL 9.2, verbatim apart from names
+static inline uint16_t mix_ref(uint16_t c1, uint16_t c2, uint8_t mix)
+{
+    if (mix == 255) return c1;
+    if (mix == 0) return c2;
+    if (c1 == c2) return c1;
+
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)(c2 | ((uint32_t)c2 << 16)) & SPREAD_MASK;
+    uint32_t fg = (uint32_t)(c1 | ((uint32_t)c1 << 16)) & SPREAD_MASK;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & SPREAD_MASK;
+    return (uint16_t)(result >> 16) | result;
+}
+
+#define NEXT_ROW(p, stride) ((void *)((uint8_t *)(p) + (stride)))
+
+// ---- Kernels ----
+
+void blend_rgb565_fill(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color)
+{
+    uint32_t c2 = color | (uint32_t)color << 16;
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride)) {
+        int32_t x = 0;
+        if (((uintptr_t)dest & 2) && w > 0) dest[x++] = color;
+        u32_alias_t *d = (u32_alias_t *)(dest + x);
+        int32_t pairs = (w - x) >> 1;
+        int32_t i = 0;
+        for (; i + 4 <= pairs; i += 4) {
+            d[i] = c2; d[i + 1] = c2; d[i + 2] = c2; d[i + 3] = c2;
+        }
+        for (; i < pairs; i++) d[i] = c2;
+        x += pairs * 2;
+        if (x < w) dest[x] = color;
+    }
+}
+
+void blend_rgb565_fill_opa(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa)
+{
+    uint32_t m = mix5(opa);
+    if (m == 0) return;
+    if (m == 32) {
+        blend_rgb565_fill(dest, w, h, stride, color);
+        return;
+    }
+
+    // With fg and m fixed each output channel depends only on the same
+    // channel of bg, so the whole mix is three lookups
+    uint32_t fgm = spread(color) * m;
+    uint16_t tr[32], tg[64], tb[32];
+    for (uint32_t i = 0; i < 32; i++) {
+        tr[i] = mix_pre(fgm, m, i << 11) & 0xF800;
+        tb[i] = mix_pre(fgm, m, i) & 0x001F;
+    }
+    for (uint32_t i = 0; i < 64; i++)
+        tg[i] = mix_pre(fgm, m, i << 5) & 0x07E0;
+#define LOOKUP(p) (tr[(p) >> 11 & 31] | tg[(p) >> 5 & 63] | tb[(p) & 31])
+
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride)) {
+        int32_t x = 0;
+        if (((uintptr_t)dest & 2) && w > 0) {
+            dest[0] = LOOKUP(dest[0]);
+            x = 1;
+        }
+        for (; x + 2 <= w; x += 2) {
+            u32_alias_t *d = (u32_alias_t *)(dest + x);
+            uint32_t p = *d;
+            *d = LOOKUP(p & 0xFFFF) | (uint32_t)LOOKUP(p >> 16) << 16;
+        }
+        if (x < w) dest[x] = LOOKUP(dest[x]);
+    }
+#undef LOOKUP
+}
+
+void blend_rgb565_fill_mask(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa,
+                            const uint8_t *mask, int32_t mask_stride)
+{
+    uint32_t fg = spread(color);
+    bool scaled = opa < 255;
+    // Mix for a fully covered pixel: the colour itself, or opa alone
+    uint32_t m_full = scaled ? mix5(255 * (uint32_t)opa >> 8) : 32;
+    uint32_t fgm_full = fg * m_full;
+
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), mask += mask_stride) {
+        int32_t x = 0;
+        // Four mask bytes at once: all below 4 leave dest as is (m is 0
+        // even before scaling), all 252 and above are fully covered
+        for (; x + 4 <= w; x += 4) {
+            uint32_t m4;
+            memcpy(&m4, mask + x, 4);
+            if ((m4 & MASK_SOLID) == 0) continue;
+            if (m4 == 0xFFFFFFFFu || (!scaled && (m4 & MASK_SOLID) == MASK_SOLID)) {
+                for (int k = 0; k < 4; k++)
+                    dest[x + k] = scaled ? mix_pre(fgm_full, m_full, dest[x + k]) : color;
+                continue;
+            }
+            for (int k = 0; k < 4; k++) {
+                uint32_t a = scaled ? (uint32_t)mask[x + k] * opa >> 8 : mask[x + k];
+                uint32_t m = mix5(a);
+                dest[x + k] = mix_pre(fg * m, m, dest[x + k]);
+            }
+        }
+        for (; x < w; x++) {
+            uint32_t a = scaled ? (uint32_t)mask[x] * opa >> 8 : mask[x];
+            uint32_t m = mix5(a);
+            dest[x] = mix_pre(fg * m, m, dest[x]);
+        }
+    }
+}
+
+void blend_rgb565_copy(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                       const uint16_t *src, int32_t src_stride)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), src = NEXT_ROW(src, src_stride))
+        memcpy(dest, src, w * 2);
+}
+
+void blend_rgb565_image_opa(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                            const uint16_t *src, int32_t src_stride, uint8_t opa)
+{
+    uint32_t m = mix5(opa);
+    if (m == 0) return;
+    if (m == 32) {
+        blend_rgb565_copy(dest, w, h, stride, src, src_stride);
+        return;
+    }
+
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), src = NEXT_ROW(src, src_stride)) {
+        for (int32_t x = 0; x < w; x++) {
+            uint32_t b = spread(dest[x]);
+            dest[x] = fold((((spread(src[x]) - b) * m) >> 5) + b);
+        }
+    }
+}
+
+// ---- Scalar references (LVGL 9.2 lv_draw_sw_blend_to_rgb565.c) ----
+
+void blend_rgb565_fill_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride))
+        for (int32_t x = 0; x < w; x++) dest[x] = color;
+}
+
+void blend_rgb565_fill_opa_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride))
+        for (int32_t x = 0; x < w; x++) dest[x] = mix_ref(color, dest[x], opa);
+}
+
+void blend_rgb565_fill_mask_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa,
+                                const uint8_t *mask, int32_t mask_stride)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), mask += mask_stride) {
+        for (int32_t x = 0; x < w; x++) {
+            uint8_t a = opa < 255 ? (uint8_t)(((int32_t)mask[x] * opa) >> 8) : mask[x];
+            dest[x] = mix_ref(color, dest[x], a);
+        }
+    }
+}
+
+void blend_rgb565_copy_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                           const uint16_t *src, int32_t src_stride)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), src = NEXT_ROW(src, src_stride))
+        for (int32_t x = 0; x < w; x++) dest[x] = src[x];
+}
+
+void blend_rgb565_image_opa_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                                const uint16_t *src, int32_t src_stride, uint8_t opa)
+{
+    for (int32_t y = 0; y < h; y++, dest = NEXT_ROW(dest, stride), src = NEXT_ROW(src, src_stride))
+        for (int32_t x = 0; x < w; x++) dest[x] = mix_ref(src[x], dest[x], opa);
+}
+
+// ---- Benchmark (console) ----
+
+#define BENCH_W      477    // odd width, started one pixel in: both edge paths
+#define BENCH_H      32
+#define BENCH_STRIDE (480 * 2)
+#define BENCH_RUNS   5
+
+enum { K_FILL, K_FILL_OPA, K_FILL_MASK, K_FILL_MASK_OPA, K_COPY, K_IMAGE_OPA, K_COUNT };
+
+static const char *const s_kernel_names[K_COUNT] = {
+    "fill", "fill_opa", "fill_mask", "fill_mask_opa", "copy", "image_opa",
+};
+
+typedef struct {
+    uint16_t *src;
+    uint8_t  *mask;
+} bench_in_t;
+
+static void run_kernel(int k, bool ref, uint16_t *d, const bench_in_t *in)
+{
+    const uint16_t color = 0x3A8F;
+    const uint8_t  opa = 210;
+    const uint16_t *src = in->src + 1;
+    switch (k) {
+    case K_FILL:          (ref ? blend_rgb565_fill_ref : blend_rgb565_fill)(d, BENCH_W, BENCH_H, BENCH_STRIDE, color); break;
+    case K_FILL_OPA:      (ref ? blend_rgb565_fill_opa_ref : blend_rgb565_fill_opa)(d, BENCH_W, BENCH_H, BENCH_STRIDE, color, opa); break;
+    case K_FILL_MASK:     (ref ? blend_rgb565_fill_mask_ref : blend_rgb565_fill_mask)(d, BENCH_W, BENCH_H, BENCH_STRIDE, color, 255, in->mask, 480); break;
+    case K_FILL_MASK_OPA: (ref ? blend_rgb565_fill_mask_ref : blend_rgb565_fill_mask)(d, BENCH_W, BENCH_H, BENCH_STRIDE, color, opa, in->mask, 480); break;
+    case K_COPY:          (ref ? blend_rgb565_copy_ref : blend_rgb565_copy)(d, BENCH_W, BENCH_H, BENCH_STRIDE, src, BENCH_STRIDE); break;
+    case K_IMAGE_OPA:     (ref ? blend_rgb565_image_opa_ref : blend_rgb565_image_opa)(d, BENCH_W, BENCH_H, BENCH_STRIDE, src, BENCH_STRIDE, opa); break;
+    }
+}
+
+int blend_rgb565_bench(void)
+{
+    size_t px = 480 * BENCH_H;
+    uint16_t *bg   = heap_caps_malloc(px * 2, MALLOC_CAP_SPIRAM);
+    uint16_t *a    = heap_caps_malloc(px * 2, MALLOC_CAP_SPIRAM);
+    uint16_t *b    = heap_caps_malloc(px * 2, MALLOC_CAP_SPIRAM);
+    bench_in_t in  = {
+        .src  = heap_caps_malloc(px * 2, MALLOC_CAP_SPIRAM),
+        .mask = heap_caps_malloc(px, MALLOC_CAP_SPIRAM),
+    };
+    int bad = -1;
+    if (!bg || !a || !b || !in.src || !in.mask) {
+        printf("blend: out of PSRAM\n");
+        goto out;
+    }
+
+    // Background-like noise; mask shaped like glyphs (runs of 0 and 255
+    // with anti-aliased edges)
+    uint32_t r = 0x2545F491;
+    for (size_t i = 0; i < px; i++) {
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        bg[i] = r;
+        in.src[i] = r >> 16;
+        uint32_t phase = (i % 480) % 24;
+        in.mask[i] = phase < 8 ? 0 : phase < 16 ? 255 : (uint8_t)(r >> 8);
+    }
+
+    bad = 0;
+    printf("%-14s %9s %9s %7s  %s\n", "kernel", "ref c/px", "c/px", "speedup", "result");
+    for (int k = 0; k < K_COUNT; k++) {
+        uint32_t best[2] = { UINT32_MAX, UINT32_MAX };
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            for (int ref = 0; ref < 2; ref++) {
+                uint16_t *d = ref ? a : b;
+                memcpy(d, bg, px * 2);
+                uint32_t t0 = esp_cpu_get_cycle_count();
+                run_kernel(k, ref, d + 1, &in);
+                uint32_t dt = esp_cpu_get_cycle_count() - t0;
+                if (dt < best[ref]) best[ref] = dt;
+            }
+        }
+        bool same = memcmp(a, b, px * 2) == 0;
+        if (!same) bad++;
+        uint32_t n = BENCH_W * BENCH_H;
+        printf("%-14s %9.2f %9.2f %6.2fx  %s\n", s_kernel_names[k],
+               (double)best[1] / n, (double)best[0] / n, (double)best[1] / best[0],
+               same ? "exact" : "MISMATCH");
+    }
+
+out:
+    heap_caps_free(bg);
+    heap_caps_free(a);
+    heap_caps_free(b);
+    heap_caps_free(in.src);
+    heap_caps_free(in.mask);
+    return bad;
+}
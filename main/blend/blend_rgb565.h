@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * RGB565 blend kernels for LVGL's software renderer.
+ *
+ * Called through the LV_DRAW_SW_ASM_CUSTOM hooks in lv_blend_panel.h for
+ * the cases this UI spends its frames in: solid fills, the translucent card
+ * over the background image, and A8 glyph masks. Every kernel has a scalar
+ * `_ref` twin that is a transcription of LVGL 9.2's per-pixel code
+ * (lv_color_16_16_mix); the kernels must match it bit for bit.
+ *
+ * Strides are in bytes. `opa` follows LVGL: 0 transparent .. 255 opaque.
+ */
+
+// Off: the hooks decline and LVGL's own scalar code runs (for comparison)
+void blend_rgb565_set_enabled(bool on);
+bool blend_rgb565_enabled(void);
+
+// dest = color
+void blend_rgb565_fill(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color);
+// dest = mix(color, dest, opa)
+void blend_rgb565_fill_opa(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa);
+// dest = mix(color, dest, mask), or mask scaled by opa when opa < 255
+void blend_rgb565_fill_mask(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa,
+                            const uint8_t *mask, int32_t mask_stride);
+// dest = src
+void blend_rgb565_copy(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                       const uint16_t *src, int32_t src_stride);
+// dest = mix(src, dest, opa)
+void blend_rgb565_image_opa(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                            const uint16_t *src, int32_t src_stride, uint8_t opa);
+
+void blend_rgb565_fill_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color);
+void blend_rgb565_fill_opa_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa);
+void blend_rgb565_fill_mask_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride, uint16_t color, uint8_t opa,
+                                const uint8_t *mask, int32_t mask_stride);
+void blend_rgb565_copy_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                           const uint16_t *src, int32_t src_stride);
+void blend_rgb565_image_opa_ref(uint16_t *dest, int32_t w, int32_t h, int32_t stride,
+                                const uint16_t *src, int32_t src_stride, uint8_t opa);
+
+// Run every kernel against its reference on PSRAM buffers shaped like
+// card rows (odd start, odd width) and print cycles per pixel and whether
+// the outputs match. Returns the number of mismatching kernels.
+int blend_rgb565_bench(void);
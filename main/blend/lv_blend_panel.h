@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+ * LVGL blend hooks (CONFIG_LV_DRAW_SW_ASM_CUSTOM_INCLUDE).
+ *
+ * Included by LVGL's lv_draw_sw_blend_to_rgb565.c, after its own headers.
+ * Each hook returns LV_RESULT_OK when a kernel from blend_rgb565.c did the
+ * work and LV_RESULT_INVALID to let LVGL's scalar loop run, which is what
+ * happens for every case not listed here and while the kernels are
+ * switched off ("blend off" on the console).
+ */
+
+#include "blend_rgb565.h"
+
+#define BLEND_PANEL_DEST(dsc) \
+    (uint16_t *)(dsc)->dest_buf, (dsc)->dest_w, (dsc)->dest_h, (dsc)->dest_stride
+
+#define BLEND_PANEL_RUN(call) \
+    (blend_rgb565_enabled() ? ((call), LV_RESULT_OK) : LV_RESULT_INVALID)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_fill(BLEND_PANEL_DEST(dsc), lv_color_to_u16((dsc)->color)))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_fill_opa(BLEND_PANEL_DEST(dsc), lv_color_to_u16((dsc)->color), (dsc)->opa))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_fill_mask(BLEND_PANEL_DEST(dsc), lv_color_to_u16((dsc)->color), 255, \
+                                           (dsc)->mask_buf, (dsc)->mask_stride))
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_fill_mask(BLEND_PANEL_DEST(dsc), lv_color_to_u16((dsc)->color), (dsc)->opa, \
+                                           (dsc)->mask_buf, (dsc)->mask_stride))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_copy(BLEND_PANEL_DEST(dsc), (const uint16_t *)(dsc)->src_buf, (dsc)->src_stride))
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc) \
+    BLEND_PANEL_RUN(blend_rgb565_image_opa(BLEND_PANEL_DEST(dsc), (const uint16_t *)(dsc)->src_buf, \
+                                           (dsc)->src_stride, (dsc)->opa))
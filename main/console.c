@@ -0,0 +1,274 @@
+/*
+ * Serial console
+ *
+ * esp_console REPL on whichever console the sdkconfig selects (UART,
+ * USB CDC or USB-Serial-JTAG). Commands:
+ *   metrics          - dump all registered metrics
+ *   tasks            - per-task CPU share and stack high-water marks
+ *   overlay on|off   - toggle the on-screen performance overlay
+ *   theme dark|light - switch UI palette
+ *   source [rest|template|mqtt|gateway] - show or switch where entity state comes from
+ *   bench redraw|slider|label|icons|images [frames] - render frames back to back, report render time
+ *   bench blend      - blend kernels against their scalar references
+ *   blend on|off     - switch LVGL between the blend kernels and its own loops
+ *   slice on|off     - render large redraws in time slices, or in one go
+ *   heatmap on|off|show|hide|dump|reset - invalidation heat map (debug)
+ *   layout baked|flex - rebuild pages from recorded geometry, or with flex
+ */
+
+#include "console.h"
+#include "metrics.h"
+#include "mqtt_client_app.h"
+#include "sysmon.h"
+#include "blend_rgb565.h"
+#include "render_slice.h"
+#include "heatmap.h"
+#include "theme.h"
+#include "ui.h"
+#include "font_cache.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "console";
+
+static int cmd_metrics(int argc, char **argv)
+{
+    metrics_dump();
+    return 0;
+}
+
+static int cmd_tasks(int argc, char **argv)
+{
+    sysmon_dump_tasks();
+    return 0;
+}
+
+static int cmd_overlay(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0)) {
+        printf("usage: overlay on|off\n");
+        return 1;
+    }
+    if (lvgl_port_lock(1000)) {
+        sysmon_set_overlay(strcmp(argv[1], "on") == 0);
+        lvgl_port_unlock();
+    }
+    return 0;
+}
+
+static int cmd_theme(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "dark") != 0 && strcmp(argv[1], "light") != 0)) {
+        printf("usage: theme dark|light\n");
+        return 1;
+    }
+    if (lvgl_port_lock(1000)) {
+        theme_set(strcmp(argv[1], "light") == 0 ? THEME_LIGHT : THEME_DARK);
+        lvgl_port_unlock();
+    }
+    return 0;
+}
+
+static const char *const s_source_names[] = {
+    [HA_SOURCE_REST]     = "rest",
+    [HA_SOURCE_TEMPLATE] = "template",
+    [HA_SOURCE_MQTT]     = "mqtt",
+    [HA_SOURCE_GATEWAY]  = "gateway",
+};
+
+static int cmd_source(int argc, char **argv)
+{
+    if (argc == 1) {
+        ha_source_t src = ha_get_source();
+        bool push = src == HA_SOURCE_MQTT || src == HA_SOURCE_GATEWAY;
+        printf("source: %s%s\n", s_source_names[src],
+               push && !ha_source_push_active() ? " (link down, polling over REST)" : "");
+        return 0;
+    }
+    int src = -1;
+    for (int i = 0; argc == 2 && i < (int)(sizeof(s_source_names) / sizeof(s_source_names[0])); i++)
+        if (strcmp(argv[1], s_source_names[i]) == 0) src = i;
+    if (src < 0) {
+        printf("usage: source [rest|template|mqtt|gateway]\n");
+        return 1;
+    }
+    esp_err_t err = ha_set_source((ha_source_t)src);
+    if (err != ESP_OK) {
+        printf("source: %s\n", err == ESP_ERR_NOT_SUPPORTED ? "not configured" : esp_err_to_name(err));
+        return 1;
+    }
+    return 0;
+}
+
+static const struct {
+    const char    *name;
+    sysmon_bench_t kind;
+    const char    *missing;     // why nothing may have been rendered
+} s_bench_kinds[] = {
+    { "redraw", SYSMON_BENCH_REDRAW,      "" },
+    { "slider", SYSMON_BENCH_SLIDER,      " (no slider on screen)" },
+    { "label",  SYSMON_BENCH_LABEL,       " (no value label on screen)" },
+    { "icons",  SYSMON_BENCH_ICONS,       " (no icons configured)" },
+    { "images", SYSMON_BENCH_ICON_IMAGES, " (no icons configured)" },
+};
+
+static int cmd_bench(int argc, char **argv)
+{
+    if (argc == 2 && strcmp(argv[1], "blend") == 0)
+        return blend_rgb565_bench() == 0 ? 0 : 1;
+    int k = -1;
+    for (int i = 0; argc >= 2 && i < (int)(sizeof(s_bench_kinds) / sizeof(s_bench_kinds[0])); i++)
+        if (strcmp(argv[1], s_bench_kinds[i].name) == 0) k = i;
+    if (argc > 3 || k < 0) {
+        printf("usage: bench redraw|slider|label|icons|images [frames] | bench blend\n");
+        return 1;
+    }
+    sysmon_bench_t kind = s_bench_kinds[k].kind;
+    int frames = argc == 3 ? atoi(argv[2]) : 30;
+    if (frames < 1 || frames > 1000) frames = 30;
+
+    sysmon_bench_result_t r;
+    render_slice_take_max_us();
+    if (!sysmon_bench(kind, frames, &r)) {
+        printf("bench: nothing rendered%s\n", s_bench_kinds[k].missing);
+        return 1;
+    }
+    printf("%s: %d frames, render min %lu.%lu / avg %lu.%lu / max %lu.%lu ms, %d draw unit(s)\n",
+           argv[1], r.frames,
+           (unsigned long)(r.min_us / 1000), (unsigned long)(r.min_us / 100 % 10),
+           (unsigned long)(r.avg_us / 1000), (unsigned long)(r.avg_us / 100 % 10),
+           (unsigned long)(r.max_us / 1000), (unsigned long)(r.max_us / 100 % 10),
+           LV_DRAW_SW_DRAW_UNIT_CNT);
+    printf("layout avg %lu / max %lu us, %lu px rendered per frame\n",
+           (unsigned long)r.layout_avg_us, (unsigned long)r.layout_max_us, (unsigned long)r.px_avg);
+    uint32_t stretch = render_slice_take_max_us();
+    printf("longest stretch without a yield %lu.%lu ms (slicing %s)\n",
+           (unsigned long)(stretch / 1000), (unsigned long)(stretch / 100 % 10),
+           render_slice_enabled() ? "on" : "off");
+    return 0;
+}
+
+static int cmd_blend(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0)) {
+        printf("blend kernels: %s\n", blend_rgb565_enabled() ? "on" : "off");
+        return argc == 1 ? 0 : 1;
+    }
+    blend_rgb565_set_enabled(strcmp(argv[1], "on") == 0);
+    return 0;
+}
+
+static int cmd_slice(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0)) {
+        printf("render slicing: %s\n", render_slice_enabled() ? "on" : "off");
+        return argc == 1 ? 0 : 1;
+    }
+    render_slice_set_enabled(strcmp(argv[1], "on") == 0);
+    return 0;
+}
+
+static int cmd_heatmap(int argc, char **argv)
+{
+    static const char *const usage = "usage: heatmap on|off|show|hide|dump|reset\n";
+    if (argc != 2) {
+        printf("%s", usage);
+        return 1;
+    }
+    const char *op = argv[1];
+    if (strcmp(op, "on") && strcmp(op, "off") && strcmp(op, "show") && strcmp(op, "hide") &&
+        strcmp(op, "dump") && strcmp(op, "reset")) {
+        printf("%s", usage);
+        return 1;
+    }
+    // The dump prints with the lock held, so rendering pauses until it is out
+    if (!lvgl_port_lock(1000)) return 1;
+    if (strcmp(op, "on") == 0 || strcmp(op, "off") == 0)
+        heatmap_set_recording(strcmp(op, "on") == 0);
+    else if (strcmp(op, "show") == 0 || strcmp(op, "hide") == 0)
+        heatmap_set_overlay(strcmp(op, "show") == 0);
+    else if (strcmp(op, "dump") == 0)
+        heatmap_dump();
+    else
+        heatmap_reset();
+    lvgl_port_unlock();
+    return 0;
+}
+
+static int cmd_layout(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "baked") != 0 && strcmp(argv[1], "flex") != 0)) {
+        printf("page layout: %s\n", ui_baked_layout() ? "baked" : "flex");
+        return argc == 1 ? 0 : 1;
+    }
+    if (!lvgl_port_lock(1000)) return 1;
+    ui_set_baked_layout(strcmp(argv[1], "baked") == 0);
+    lvgl_port_unlock();
+    printf("applies to pages built from now on\n");
+    return 0;
+}
+
+static int cmd_fonts(int argc, char **argv)
+{
+    font_cache_stats_t st;
+    font_cache_get_stats(&st);
+    if (!st.capacity) {
+        printf("glyph cache off\n");
+        return 0;
+    }
+    printf("glyph cache: %lu glyphs, %lu / %lu KB, %lu hits, %lu misses\n",
+           (unsigned long)st.glyphs, (unsigned long)(st.bytes / 1024),
+           (unsigned long)(st.capacity / 1024), (unsigned long)st.hits, (unsigned long)st.misses);
+    return 0;
+}
+
+static void register_cmd(const char *name, const char *help, esp_console_cmd_func_t fn)
+{
+    const esp_console_cmd_t cmd = {
+        .command = name,
+        .help = help,
+        .func = fn,
+    };
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
+
+void console_init(void)
+{
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "panel>";
+
+#if defined(CONFIG_ESP_CONSOLE_UART_DEFAULT) || defined(CONFIG_ESP_CONSOLE_UART_CUSTOM)
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_uart(&hw_config, &repl_config, &repl));
+#elif defined(CONFIG_ESP_CONSOLE_USB_CDC)
+    esp_console_dev_usb_cdc_config_t hw_config = ESP_CONSOLE_DEV_CDC_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_usb_cdc(&hw_config, &repl_config, &repl));
+#elif defined(CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG)
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl));
+#else
+    ESP_LOGW(TAG, "No console device configured");
+    return;
+#endif
+
+    register_cmd("metrics", "Dump all metrics", cmd_metrics);
+    register_cmd("tasks",   "Per-task CPU share and stack high-water marks", cmd_tasks);
+    register_cmd("overlay", "Toggle performance overlay: overlay on|off", cmd_overlay);
+    register_cmd("theme",   "Switch UI theme: theme dark|light", cmd_theme);
+    register_cmd("source",  "Show or switch the HA state source: source [rest|template|mqtt|gateway]", cmd_source);
+    register_cmd("bench",   "Render frames back to back: bench redraw|slider|label|icons|images [frames], or bench blend", cmd_bench);
+    register_cmd("blend",   "Use the RGB565 blend kernels in LVGL: blend [on|off]", cmd_blend);
+    register_cmd("slice",   "Render large redraws in time slices: slice [on|off]", cmd_slice);
+    register_cmd("heatmap", "Invalidation heat map: heatmap on|off|show|hide|dump|reset", cmd_heatmap);
+    register_cmd("layout",  "How room pages are rebuilt: layout [baked|flex]", cmd_layout);
+    register_cmd("fonts",   "Decoded glyph cache use", cmd_fonts);
+
+    ESP_ERROR_CHECK(esp_console_start_repl(repl));
+    ESP_LOGI(TAG, "Console ready");
+}
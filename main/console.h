@@ -0,0 +1,4 @@
+#pragma once
+
+// Start the serial console REPL and register diagnostic commands
+void console_init(void);
@@ -0,0 +1,269 @@
+/*
+ * Zero-copy display glue for the DPI panel
+ *
+ * LVGL renders in direct mode into the frame buffers the DPI driver scans
+ * out (esp_lcd_dpi_panel_get_frame_buffer), one buffer per frame:
+ *
+ * - On the last flush of a frame the buffer goes to esp_lcd_panel_draw_bitmap().
+ *   For one of its own frame buffers the DPI driver copies nothing: it
+ *   writes back the cache for the rows we pass and scans that buffer out
+ *   from the next frame on.
+ * - The flip has taken effect at the following refresh-done interrupt. Only
+ *   then is the buffer that was on screen free to draw into.
+ * - Before LVGL draws into a buffer, the areas that changed since that
+ *   buffer was last drawn are copied into it from the buffer just
+ *   presented. That copy is the only pixel traffic besides rendering
+ *   (ui_fb_sync_bytes).
+ *
+ * With two buffers the LVGL task waits for each flip before it continues,
+ * as esp_lvgl_port's avoid_tearing mode does. With three, a free buffer
+ * exists while a flip is pending, so rendering only waits when it gets a
+ * whole frame ahead of the panel.
+ */
+
+#include "disp_fb.h"
+#include "metrics.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_mipi_dsi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+static const char *TAG = "disp_fb";
+
+#define MAX_FBS         3
+#define MAX_AREAS       24      // per buffer; more and the whole screen is synced
+#define FLIP_TIMEOUT_MS 100     // a refresh takes ~17 ms
+
+// ---- Metrics ----
+
+static const uint32_t s_present_bounds[] = { 10, 16, 20, 25, 33, 50, 100, 250 };
+static const uint32_t s_wait_bounds[]    = { 1, 2, 5, 10, 17, 25, 50 };
+static const uint32_t s_sync_bounds[]    = { 0, 1024, 4096, 16384, 65536, 262144, 768000 };
+
+static metrics_histogram_t m_present_ms = METRICS_HISTOGRAM_INIT("ui_present_ms",
+    "Render start to first scan-out of the frame (ms)", s_present_bounds);
+static metrics_histogram_t m_wait_ms    = METRICS_HISTOGRAM_INIT("ui_flip_wait_ms",
+    "LVGL task blocked waiting for a flip (ms)", s_wait_bounds);
+static metrics_histogram_t m_sync_bytes = METRICS_HISTOGRAM_INIT("ui_fb_sync_bytes",
+    "Bytes copied per frame to bring the next buffer up to date", s_sync_bounds);
+
+// ---- State ----
+
+// Areas a buffer has missed since it was last drawn into; n < 0: all of it
+typedef struct {
+    lv_area_t area[MAX_AREAS];
+    int       n;
+} area_list_t;
+
+static esp_lcd_panel_handle_t s_panel;
+static int32_t                s_hres, s_vres;
+static int                    s_num_fbs;
+static lv_draw_buf_t          s_bufs[MAX_FBS];
+static int                    s_cur;                // buffer LVGL draws into
+static area_list_t            s_stale[MAX_FBS];
+static area_list_t            s_frame;              // flushed areas of this frame
+static int32_t                s_rows_y1, s_rows_y2; // rows written in s_cur
+
+static SemaphoreHandle_t s_flip_done;
+static volatile bool     s_flip_pending;
+static volatile int64_t  s_latched_us;
+static bool              s_flip_unreported;
+static int64_t           s_render_start_us;
+static int64_t           s_flip_start_us;       // render start of the frame being flipped
+
+// ---- Area bookkeeping ----
+
+static void area_list_add(area_list_t *l, const lv_area_t *a)
+{
+    if (l->n < 0) return;
+    if (l->n == MAX_AREAS) {
+        l->n = -1;
+        return;
+    }
+    l->area[l->n++] = *a;
+}
+
+static void area_list_merge(area_list_t *dst, const area_list_t *src)
+{
+    if (src->n < 0) {
+        dst->n = -1;
+        return;
+    }
+    for (int i = 0; i < src->n; i++)
+        area_list_add(dst, &src->area[i]);
+}
+
+static void note_rows(const lv_area_t *a)
+{
+    if (a->y1 < s_rows_y1) s_rows_y1 = a->y1;
+    if (a->y2 > s_rows_y2) s_rows_y2 = a->y2;
+}
+
+static uint32_t copy_area(int dst, int src, const lv_area_t *a)
+{
+    uint32_t stride = s_bufs[dst].header.stride;
+    uint32_t offset = a->y1 * stride + a->x1 * sizeof(uint16_t);
+    uint32_t len    = lv_area_get_width(a) * sizeof(uint16_t);
+    uint8_t *d = s_bufs[dst].data + offset;
+    const uint8_t *s = s_bufs[src].data + offset;
+    for (int32_t y = a->y1; y <= a->y2; y++, d += stride, s += stride)
+        memcpy(d, s, len);
+    note_rows(a);
+    return len * lv_area_get_height(a);
+}
+
+// Bring `dst` up to date from `src`, which holds the frame just presented
+static void sync_buffer(int dst, int src)
+{
+    area_list_t *stale = &s_stale[dst];
+    uint32_t bytes = 0;
+    if (stale->n < 0) {
+        lv_area_t all = { 0, 0, s_hres - 1, s_vres - 1 };
+        bytes = copy_area(dst, src, &all);
+    } else {
+        for (int i = 0; i < stale->n; i++)
+            bytes += copy_area(dst, src, &stale->area[i]);
+    }
+    stale->n = 0;
+    metrics_histogram_observe(&m_sync_bytes, bytes);
+}
+
+// ---- Flips ----
+
+static bool IRAM_ATTR on_refresh_done(esp_lcd_panel_handle_t panel, esp_lcd_dpi_panel_event_data_t *edata,
+                                      void *user_ctx)
+{
+    if (!s_flip_pending) return false;
+    s_latched_us = esp_timer_get_time();
+    s_flip_pending = false;
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(s_flip_done, &woken);
+    return woken == pdTRUE;
+}
+
+// Return once no flip is pending, i.e. only the presented buffer is in use
+static void wait_flip(void)
+{
+    if (s_flip_pending) {
+        int64_t t0 = esp_timer_get_time();
+        if (xSemaphoreTake(s_flip_done, pdMS_TO_TICKS(FLIP_TIMEOUT_MS)) != pdTRUE) {
+            ESP_LOGW(TAG, "No refresh-done interrupt within %d ms", FLIP_TIMEOUT_MS);
+            s_flip_pending = false;
+            s_flip_unreported = false;
+            return;
+        }
+        metrics_histogram_observe(&m_wait_ms, (esp_timer_get_time() - t0) / 1000);
+    }
+    if (s_flip_unreported) {
+        s_flip_unreported = false;
+        metrics_histogram_observe(&m_present_ms, (s_latched_us - s_flip_start_us) / 1000);
+    }
+}
+
+static void present(lv_display_t *disp, uint8_t *px_map)
+{
+    // Three buffers: at most one flip in flight, so the buffer after
+    // s_cur is neither on screen nor queued
+    if (s_num_fbs > 2) wait_flip();
+
+    xSemaphoreTake(s_flip_done, 0);
+    // Only the rows written this frame need a cache write-back
+    esp_lcd_panel_draw_bitmap(s_panel, 0, s_rows_y1, s_hres, s_rows_y2 + 1, px_map);
+    s_flip_start_us = s_render_start_us;
+    s_flip_unreported = true;
+    s_flip_pending = true;
+
+    // Two buffers: the other one is on screen until the flip takes effect
+    if (s_num_fbs == 2) wait_flip();
+
+    for (int i = 0; i < s_num_fbs; i++)
+        if (i != s_cur) area_list_merge(&s_stale[i], &s_frame);
+    s_frame.n = 0;
+
+    int prev = s_cur;
+    s_cur = (s_cur + 1) % s_num_fbs;
+    s_rows_y1 = s_vres;
+    s_rows_y2 = -1;
+    sync_buffer(s_cur, prev);
+    lv_display_set_draw_buffers(disp, &s_bufs[s_cur], NULL);
+}
+
+// ---- LVGL callbacks (LVGL task) ----
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    area_list_add(&s_frame, area);
+    note_rows(area);
+    if (lv_display_flush_is_last(disp))
+        present(disp, px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void render_start_cb(lv_event_t *e)
+{
+    s_render_start_us = esp_timer_get_time();
+}
+
+// ---- Public API ----
+
+lv_display_t *disp_fb_create(esp_lcd_panel_handle_t panel, int32_t hres, int32_t vres, int num_fbs)
+{
+    if (num_fbs < 2 || num_fbs > MAX_FBS) {
+        ESP_LOGE(TAG, "%d frame buffers not supported", num_fbs);
+        return NULL;
+    }
+    void *fb[MAX_FBS] = { 0 };
+    esp_err_t err = num_fbs == 2
+        ? esp_lcd_dpi_panel_get_frame_buffer(panel, 2, &fb[0], &fb[1])
+        : esp_lcd_dpi_panel_get_frame_buffer(panel, 3, &fb[0], &fb[1], &fb[2]);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Cannot get DPI frame buffers: %s", esp_err_to_name(err));
+        return NULL;
+    }
+
+    s_flip_done = xSemaphoreCreateBinary();
+    if (!s_flip_done) return NULL;
+
+    uint32_t stride = hres * sizeof(uint16_t);
+    uint32_t size   = stride * vres;
+    for (int i = 0; i < num_fbs; i++) {
+        lv_draw_buf_init(&s_bufs[i], hres, vres, LV_COLOR_FORMAT_RGB565, stride, fb[i], size);
+        s_stale[i].n = 0;
+    }
+    s_panel   = panel;
+    s_hres    = hres;
+    s_vres    = vres;
+    s_num_fbs = num_fbs;
+    // Buffer 0 is on screen from panel init; start drawing into the next one
+    s_cur     = 1;
+    s_rows_y1 = vres;
+    s_rows_y2 = -1;
+
+    const esp_lcd_dpi_panel_event_callbacks_t cbs = {
+        .on_refresh_done = on_refresh_done,
+    };
+    ESP_ERROR_CHECK(esp_lcd_dpi_panel_register_event_callbacks(panel, &cbs, NULL));
+
+    lv_display_t *disp = lv_display_create(hres, vres);
+    if (!disp) return NULL;
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    // A single draw buffer as far as LVGL knows: the rotation and the
+    // sync of missed areas happen in present(), so LVGL's own
+    // double-buffer sync stays off
+    lv_display_set_draw_buffers(disp, &s_bufs[s_cur], NULL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+
+    metrics_register_histogram(&m_present_ms);
+    metrics_register_histogram(&m_wait_ms);
+    metrics_register_histogram(&m_sync_bytes);
+
+    ESP_LOGI(TAG, "LVGL draws into %d DPI frame buffers (%lu KB each), no separate draw buffers",
+             num_fbs, (unsigned long)(size / 1024));
+    return disp;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+#include "esp_lcd_types.h"
+#include "lvgl.h"
+
+/*
+ * LVGL display drawn straight into the DPI panel's frame buffers.
+ *
+ * Replaces lvgl_port_add_disp_dsi() when CONFIG_PANEL_DISPLAY_ZERO_COPY is
+ * set. `num_fbs` must match esp_lcd_dpi_panel_config_t.num_fbs (2 or 3).
+ * Call after lvgl_port_init() with the LVGL port lock held; attach touch to
+ * the returned display as usual.
+ */
+lv_display_t *disp_fb_create(esp_lcd_panel_handle_t panel, int32_t hres, int32_t vres, int num_fbs);
@@ -0,0 +1,158 @@
+/*
+ * Entity state model
+ *
+ * One entry per unique entity id across all rooms. Room pages read from
+ * here when they are (re)built, so tearing down a page loses nothing.
+ *
+ * Reconciliation of optimistic local state against polled state:
+ *
+ *   user moves slider  -> v.brightness = 200, cmd_seq = 7, pending = 1
+ *   poll (started at seq 6) returns brightness 120  -> discarded (stale)
+ *   command OK         -> pending = 0, confirmed = v
+ *   command failed     -> pending = 0, v = confirmed (rollback)
+ *
+ * Polls started less than ENTITY_MODEL_SETTLE_MS after the last successful
+ * command are discarded as well, since HA may not have published the new
+ * state yet.
+ */
+
+#include "entity_model.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+static const char *TAG = "entity_model";
+
+static entity_state_t s_entities[ENTITY_MODEL_MAX];
+static int            s_count;
+
+static metrics_counter_t m_stale     = METRICS_COUNTER_INIT("entity_polls_stale_total", "Poll results discarded as older than a local command");
+static metrics_counter_t m_rollbacks = METRICS_COUNTER_INIT("entity_rollbacks_total", "Optimistic UI changes rolled back after a failed command");
+
+void entity_model_init(void)
+{
+    static const entity_values_t unknown = {
+        .brightness = -1,
+        .position   = -1,
+    };
+
+    metrics_register_counter(&m_stale);
+    metrics_register_counter(&m_rollbacks);
+
+    s_count = 0;
+    for (int r = 0; r < rooms_count(); r++) {
+        const room_cfg_t *room = rooms_get(r);
+        for (int i = 0; i < room->num_entities; i++) {
+            const entity_cfg_t *cfg = &room->entities[i];
+            if (entity_model_find(cfg->entity_id)) continue;
+            if (s_count >= ENTITY_MODEL_MAX) {
+                ESP_LOGE(TAG, "Too many entities, ignoring %s", cfg->entity_id);
+                continue;
+            }
+            s_entities[s_count++] = (entity_state_t){
+                .entity_id = cfg->entity_id,
+                .kind      = cfg->kind,
+                .v         = unknown,
+                .confirmed = unknown,
+            };
+        }
+    }
+    ESP_LOGI(TAG, "%d entities in %d rooms", s_count, rooms_count());
+}
+
+int entity_model_count(void)
+{
+    return s_count;
+}
+
+entity_state_t *entity_model_get(int index)
+{
+    return (index >= 0 && index < s_count) ? &s_entities[index] : NULL;
+}
+
+entity_state_t *entity_model_find(const char *entity_id)
+{
+    for (int i = 0; i < s_count; i++)
+        if (strcmp(s_entities[i].entity_id, entity_id) == 0) return &s_entities[i];
+    return NULL;
+}
+
+int entity_model_index(const entity_state_t *st)
+{
+    return (int)(st - s_entities);
+}
+
+// ---- Commands ----
+
+uint32_t entity_model_begin_command(entity_state_t *st)
+{
+    st->pending++;
+    return ++st->cmd_seq;
+}
+
+bool entity_model_end_command(entity_state_t *st, uint32_t seq, bool ok)
+{
+    if (st->pending) st->pending--;
+    // Only a delivered command has effects HA may still be settling; after
+    // a failure the resync read must not be discarded as stale
+    if (ok) st->last_cmd_us = esp_timer_get_time();
+
+    // An older command finishing says nothing about what the UI shows now
+    if (seq != st->cmd_seq) return false;
+
+    if (ok) {
+        st->confirmed = st->v;
+        return false;
+    }
+    if (!st->known) return false;  // nothing trustworthy to roll back to
+
+    ESP_LOGW(TAG, "%s: command %lu failed, rolling back", st->entity_id, (unsigned long)seq);
+    st->v = st->confirmed;
+    metrics_counter_inc(&m_rollbacks);
+    return true;
+}
+
+// ---- Polls ----
+
+entity_poll_token_t entity_model_poll_begin(const entity_state_t *st)
+{
+    return (entity_poll_token_t){
+        .cmd_seq    = st->cmd_seq,
+        .started_us = esp_timer_get_time(),
+    };
+}
+
+static void merge(entity_values_t *dst, const entity_values_t *src)
+{
+    dst->on = src->on;
+    if (src->brightness >= 0)  dst->brightness   = src->brightness;
+    if (src->color_temp_k > 0) dst->color_temp_k = src->color_temp_k;
+    if (src->position >= 0)    dst->position     = src->position;
+}
+
+static bool values_equal(const entity_values_t *a, const entity_values_t *b)
+{
+    return a->on == b->on && a->brightness == b->brightness &&
+           a->color_temp_k == b->color_temp_k && a->position == b->position;
+}
+
+bool entity_model_apply_poll(entity_state_t *st, entity_poll_token_t token,
+                             const entity_values_t *polled, bool *changed)
+{
+    bool stale = st->pending > 0 ||
+                 token.cmd_seq != st->cmd_seq ||
+                 token.started_us < st->last_cmd_us + ENTITY_MODEL_SETTLE_MS * 1000LL;
+    if (stale && st->cmd_seq != 0) {
+        ESP_LOGD(TAG, "%s: discarding stale poll", st->entity_id);
+        metrics_counter_inc(&m_stale);
+        return false;
+    }
+
+    entity_values_t before = st->confirmed;
+    merge(&st->confirmed, polled);
+    merge(&st->v, polled);
+    if (changed) *changed = !st->known || !values_equal(&before, &st->confirmed);
+    st->known = true;
+    return true;
+}
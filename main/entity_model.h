@@ -0,0 +1,66 @@
+#pragma once
+
+#include "rooms.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ENTITY_MODEL_MAX 64
+
+// Polls started this soon after a successful command are discarded
+#define ENTITY_MODEL_SETTLE_MS 1500
+
+typedef struct {
+    bool    on;
+    int16_t brightness;     // 0-255, -1 unknown
+    int16_t color_temp_k;   // 0 unknown
+    int8_t  position;       // 0-100, -1 unknown
+} entity_values_t;
+
+// State of one entity, independent of any LVGL objects.
+// Mutated under the LVGL port lock (UI callbacks and poll updates).
+//
+// `v` is what the UI shows: local commands update it optimistically.
+// `confirmed` is the last state HA reported or acknowledged and is what
+// `v` rolls back to when a command fails. Every command bumps `cmd_seq`;
+// a poll whose request started before the latest command (or while one is
+// pending, or within the settle window after it) is discarded as stale.
+typedef struct {
+    const char     *entity_id;
+    entity_kind_t   kind;
+    bool            known;          // at least one poll applied
+    entity_values_t v;
+    entity_values_t confirmed;
+    uint32_t        cmd_seq;
+    uint8_t         pending;        // commands sent but not yet answered
+    int64_t         last_cmd_us;    // esp_timer time of the last command answer
+} entity_state_t;
+
+// Snapshot taken before a poll request is sent
+typedef struct {
+    uint32_t cmd_seq;
+    int64_t  started_us;
+} entity_poll_token_t;
+
+// Collect the unique entities of all configured rooms
+void entity_model_init(void);
+
+int             entity_model_count(void);
+entity_state_t *entity_model_get(int index);
+entity_state_t *entity_model_find(const char *entity_id);
+int             entity_model_index(const entity_state_t *st);
+
+// Register a local command whose optimistic values are already in `v`.
+// Returns the command's sequence number.
+uint32_t entity_model_begin_command(entity_state_t *st);
+
+// Record the command's outcome. Returns true if `v` was rolled back and
+// the UI must be re-synced.
+bool entity_model_end_command(entity_state_t *st, uint32_t seq, bool ok);
+
+entity_poll_token_t entity_model_poll_begin(const entity_state_t *st);
+
+// Merge polled values (negative/zero fields = not reported) unless the
+// poll is stale. Returns true if the values were applied; `changed` (may
+// be NULL) is set if they differ from the confirmed state.
+bool entity_model_apply_poll(entity_state_t *st, entity_poll_token_t token,
+                             const entity_values_t *polled, bool *changed);
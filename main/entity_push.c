@@ -0,0 +1,104 @@
+/*
+ * Applying pushed entity state
+ *
+ * The latest pushed values of every entity are kept with a dirty flag.
+ * entity_push() applies them under the LVGL lock; when that fails (lock
+ * busy, or a command pending/settling) the entity stays dirty and a retry
+ * is requested. An LVGL timer, every third of the settle window, then
+ * applies every dirty entity. It runs on the LVGL task with the lock
+ * already held, so it never waits for the lock and stalls no other
+ * callbacks. A newer push simply overwrites the kept values.
+ */
+
+#include "entity_push.h"
+#include "ui.h"
+#include "metrics.h"
+#include "esp_timer.h"
+#include "esp_lvgl_port.h"
+#include "freertos/FreeRTOS.h"
+#include <stdatomic.h>
+
+#define RETRY_MS (ENTITY_MODEL_SETTLE_MS / 3)
+
+typedef struct {
+    entity_values_t vals;
+    bool            dirty;      // not yet applied
+} latest_t;
+
+static latest_t           s_latest[ENTITY_MODEL_MAX];
+static portMUX_TYPE       s_lock = portMUX_INITIALIZER_UNLOCKED;
+static atomic_bool        s_retry;     // some entity is dirty after a failed apply
+
+static metrics_counter_t m_applied = METRICS_COUNTER_INIT("entity_pushes_applied_total", "Pushed entity states applied to the UI");
+
+// Returns false if the entity must be retried. LVGL lock held.
+static bool apply_locked(int index)
+{
+    latest_t l;
+    taskENTER_CRITICAL(&s_lock);
+    l = s_latest[index];
+    s_latest[index].dirty = false;
+    taskEXIT_CRITICAL(&s_lock);
+
+    bool applied = true;
+    if (l.dirty) {
+        entity_state_t *st = entity_model_get(index);
+        entity_poll_token_t token = { .cmd_seq = st->cmd_seq, .started_us = esp_timer_get_time() };
+        bool changed = false;
+        applied = entity_model_apply_poll(st, token, &l.vals, &changed);
+        if (applied) {
+            metrics_counter_inc(&m_applied);
+            if (changed) ui_refresh_entity(st);
+        }
+    }
+
+    if (!applied) {
+        taskENTER_CRITICAL(&s_lock);
+        s_latest[index].dirty = true;
+        taskEXIT_CRITICAL(&s_lock);
+    }
+    return applied;
+}
+
+// Leaves the entity dirty if the lock is busy
+static bool apply(int index)
+{
+    if (!lvgl_port_lock(100)) return false;
+    bool applied = apply_locked(index);
+    lvgl_port_unlock();
+    return applied;
+}
+
+// LVGL task: one pass re-applies every dirty entity
+static void retry_cb(lv_timer_t *t)
+{
+    if (!atomic_exchange(&s_retry, false)) return;
+    bool again = false;
+    for (int i = 0; i < entity_model_count(); i++) {
+        bool dirty;
+        taskENTER_CRITICAL(&s_lock);
+        dirty = s_latest[i].dirty;
+        taskEXIT_CRITICAL(&s_lock);
+        if (dirty && !apply_locked(i)) again = true;
+    }
+    if (again) atomic_store(&s_retry, true);
+}
+
+void entity_push(int index, const entity_values_t *v)
+{
+    if (index < 0 || index >= entity_model_count()) return;
+    taskENTER_CRITICAL(&s_lock);
+    s_latest[index].vals  = *v;
+    s_latest[index].dirty = true;
+    taskEXIT_CRITICAL(&s_lock);
+    if (!apply(index)) atomic_store(&s_retry, true);
+}
+
+void entity_push_init(void)
+{
+    metrics_register_counter(&m_applied);
+    if (lvgl_port_lock(0)) {
+        lv_timer_create(retry_cb, RETRY_MS, NULL);
+        lvgl_port_unlock();
+    }
+}
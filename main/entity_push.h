@@ -0,0 +1,20 @@
+#pragma once
+
+#include "entity_model.h"
+
+/*
+ * Entity state pushed by HA (MQTT statestream, panel gateway).
+ *
+ * A push carries the entity's current values and is applied like a poll
+ * started now: only a local command that is still pending or settling
+ * makes it stale. A discarded push is kept and re-applied from an LVGL
+ * timer once the settle window is over, so the UI ends up on HA's state
+ * even if no further push follows.
+ */
+
+// After lvgl_port_init(): creates the retry timer on the LVGL task
+void entity_push_init(void);
+
+// Apply `v` to entity `index` and refresh its widgets if it changed.
+// Takes the LVGL lock; any task but the LVGL task.
+void entity_push(int index, const entity_values_t *v);
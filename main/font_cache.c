@@ -0,0 +1,199 @@
+/*
+ * Decoded-glyph cache
+ *
+ * The fonts in fonts/ are stored compressed (tools/fonts/fontpack.py).
+ * LVGL decodes a glyph into the label's scratch draw buffer on every draw:
+ * the RLE bit reader, the row XOR and 4 bpp to 8-bit alpha. A panel
+ * redraws the same few dozen glyphs all the time, so the first decode of
+ * each is kept.
+ *
+ * font_cache_get() returns a copy of the font descriptor whose
+ * get_glyph_bitmap goes through here. On a miss LVGL's own
+ * lv_font_get_bitmap_fmt_txt() decodes into the caller's buffer, and the
+ * result is copied into the arena. On a hit the cached draw buffer is
+ * returned instead of the caller's, so nothing is decoded or copied.
+ *
+ * The arena is one PSRAM block, allocated at boot and filled front to back;
+ * entries are never freed or moved, so a pointer handed to a draw thread
+ * stays valid. The slot table (open addressing, keyed by font and glyph
+ * id) sits at the start of the arena. Readers load slots without a lock;
+ * a writer fills the entry under s_lock and publishes it with a release
+ * store. Two threads missing the same glyph both decode it, and the second
+ * insert is dropped.
+ */
+
+#include "font_cache.h"
+#include "metrics.h"
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <stdatomic.h>
+#include <string.h>
+
+static const char *TAG = "font_cache";
+
+#define MAX_FONTS  4
+#define SLOTS      1024                 // power of two
+#define MAX_GLYPHS (SLOTS * 3 / 4)      // keeps probe runs short
+
+typedef struct {
+    const lv_font_t *font;
+    uint32_t         gid;
+    lv_draw_buf_t    buf;       // A8, data follows the entry
+} glyph_t;
+
+// ---- Metrics ----
+
+static const uint32_t s_decode_bounds[] = { 10, 20, 50, 100, 200, 500, 1000 };
+
+static metrics_counter_t   m_hits   = METRICS_COUNTER_INIT("font_glyph_cache_hits_total",
+    "Glyph bitmaps served from the cache");
+static metrics_counter_t   m_misses = METRICS_COUNTER_INIT("font_glyph_cache_misses_total",
+    "Glyph bitmaps decoded by LVGL");
+static metrics_gauge_t     m_bytes  = METRICS_GAUGE_INIT("font_glyph_cache_bytes",
+    "Glyph cache arena in use (bytes)");
+static metrics_histogram_t m_decode = METRICS_HISTOGRAM_INIT("font_glyph_decode_us",
+    "Time to decode one glyph on a cache miss (us)", s_decode_bounds);
+
+// ---- State ----
+
+static uint8_t           *s_arena;
+static size_t             s_cap;
+static size_t             s_used;           // under s_lock
+static uint32_t           s_count;          // under s_lock
+static _Atomic(glyph_t *) *s_slots;
+static portMUX_TYPE       s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static lv_font_t          s_fonts[MAX_FONTS];
+static const lv_font_t   *s_src[MAX_FONTS];
+static int                s_n_fonts;
+
+static uint32_t hash(const lv_font_t *font, uint32_t gid)
+{
+    uint32_t h = (uint32_t)(uintptr_t)font ^ (gid * 0x9E3779B1u);
+    return h ^ (h >> 15);
+}
+
+static size_t align4(size_t n)
+{
+    return (n + 3) & ~(size_t)3;
+}
+
+// ---- Cache ----
+
+static void insert(const lv_font_glyph_dsc_t *g, const lv_draw_buf_t *src)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(g->box_w, LV_COLOR_FORMAT_A8);
+    size_t size = (size_t)stride * g->box_h;
+    size_t need = align4(sizeof(glyph_t) + size);
+    const lv_font_t *font = g->resolved_font;
+    uint32_t gid = g->gid.index;
+
+    portENTER_CRITICAL(&s_lock);
+    uint32_t i = hash(font, gid);
+    glyph_t *e;
+    while ((e = atomic_load_explicit(&s_slots[i & (SLOTS - 1)], memory_order_relaxed)) &&
+           !(e->font == font && e->gid == gid))
+        i++;
+    if (e || s_count >= MAX_GLYPHS || s_used + need > s_cap) {
+        portEXIT_CRITICAL(&s_lock);
+        return;
+    }
+    e = (glyph_t *)(s_arena + s_used);
+    s_used += need;
+    s_count++;
+    e->font = font;
+    e->gid = gid;
+    e->buf = *src;
+    e->buf.header.w = g->box_w;
+    e->buf.header.h = g->box_h;
+    e->buf.header.stride = stride;
+    e->buf.data = (uint8_t *)(e + 1);
+    e->buf.unaligned_data = e->buf.data;
+    e->buf.data_size = size;
+    memcpy(e->buf.data, src->data, size);
+    atomic_store_explicit(&s_slots[i & (SLOTS - 1)], e, memory_order_release);
+    size_t used = s_used;
+    portEXIT_CRITICAL(&s_lock);
+
+    metrics_gauge_set(&m_bytes, (int32_t)used);
+}
+
+static const void *get_bitmap(lv_font_glyph_dsc_t *g, lv_draw_buf_t *draw_buf)
+{
+    const lv_font_t *font = g->resolved_font;
+    uint32_t gid = g->gid.index;
+    for (uint32_t i = hash(font, gid);; i++) {
+        glyph_t *e = atomic_load_explicit(&s_slots[i & (SLOTS - 1)], memory_order_acquire);
+        if (!e) break;
+        if (e->font == font && e->gid == gid) {
+            metrics_counter_inc(&m_hits);
+            return &e->buf;
+        }
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    const void *out = lv_font_get_bitmap_fmt_txt(g, draw_buf);
+    metrics_histogram_observe(&m_decode, (uint32_t)(esp_timer_get_time() - t0));
+    metrics_counter_inc(&m_misses);
+    if (out == draw_buf && g->box_w && g->box_h) insert(g, draw_buf);
+    return out;
+}
+
+// ---- Public API ----
+
+void font_cache_init(void)
+{
+    metrics_register_counter(&m_hits);
+    metrics_register_counter(&m_misses);
+    metrics_register_gauge(&m_bytes);
+    metrics_register_histogram(&m_decode);
+
+    size_t cap = (size_t)CONFIG_PANEL_FONT_CACHE_KB * 1024;
+    size_t table = SLOTS * sizeof(*s_slots);
+    if (cap <= table) {
+        ESP_LOGI(TAG, "Glyph cache off");
+        return;
+    }
+    s_arena = heap_caps_calloc(1, cap, MALLOC_CAP_SPIRAM);
+    if (!s_arena) {
+        ESP_LOGW(TAG, "No PSRAM for a %d KB glyph cache, decoding every draw",
+                 CONFIG_PANEL_FONT_CACHE_KB);
+        return;
+    }
+    s_slots = (_Atomic(glyph_t *) *)s_arena;
+    s_used = table;
+    s_cap = cap;
+    metrics_gauge_set(&m_bytes, (int32_t)s_used);
+    ESP_LOGI(TAG, "Glyph cache: %d KB PSRAM", CONFIG_PANEL_FONT_CACHE_KB);
+}
+
+const lv_font_t *font_cache_get(const lv_font_t *font)
+{
+    if (!s_arena || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return font;
+    for (int i = 0; i < s_n_fonts; i++) {
+        if (s_src[i] == font) return &s_fonts[i];
+    }
+    if (s_n_fonts == MAX_FONTS) {
+        ESP_LOGW(TAG, "More than %d fonts, not caching the rest", MAX_FONTS);
+        return font;
+    }
+    lv_font_t *f = &s_fonts[s_n_fonts];
+    *f = *font;
+    f->get_glyph_bitmap = get_bitmap;
+    s_src[s_n_fonts++] = font;
+    return f;
+}
+
+void font_cache_get_stats(font_cache_stats_t *out)
+{
+    portENTER_CRITICAL(&s_lock);
+    out->glyphs = s_count;
+    out->bytes = (uint32_t)s_used;
+    portEXIT_CRITICAL(&s_lock);
+    out->capacity = (uint32_t)s_cap;
+    out->hits = atomic_load_explicit(&m_hits.value, memory_order_relaxed);
+    out->misses = atomic_load_explicit(&m_misses.value, memory_order_relaxed);
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdint.h>
+
+/*
+ * PSRAM cache of decoded glyphs for the compressed panel fonts.
+ *
+ * A glyph is decompressed to 8-bit alpha the first time it is drawn and kept
+ * until reboot; later draws use the cached bitmap directly. The cache size is
+ * PANEL_FONT_CACHE_KB. Once it is full, further glyphs are decoded on every
+ * draw, as without the cache. Lookups are lock-free and safe from LVGL's
+ * draw threads.
+ */
+
+typedef struct {
+    uint32_t glyphs;
+    uint32_t bytes;         // arena used, slot table included
+    uint32_t capacity;      // arena size, 0 if the cache is off
+    uint32_t hits;
+    uint32_t misses;
+} font_cache_stats_t;
+
+// Allocate the arena. Before the first font_cache_get().
+void font_cache_init(void);
+
+// `font` with its bitmaps served from the cache; `font` itself if the cache
+// is off. Same result for the same font. Needs the LVGL lock.
+const lv_font_t *font_cache_get(const lv_font_t *font);
+
+void font_cache_get_stats(font_cache_stats_t *out);
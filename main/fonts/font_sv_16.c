@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 16 px
  * Bpp: 4
- * Opts: --no-compress --no-prefilter --bpp 4 --size 16 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_16.c --force-fast-kern-format
+ * Compressed: tools/fonts/fontpack.py (prefilter + RLE)
+ * Opts: --bpp 4 --size 16 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_16.c --force-fast-kern-format
  ******************************************************************************/
 
 #include "lvgl.h"
@@ -21,1744 +22,1453 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xbf, 0xb, 0xf0, 0xaf, 0xa, 0xe0, 0x9e, 0x8,
-    0xd0, 0x8c, 0x7, 0xc0, 0x0, 0x0, 0x10, 0xbf,
-    0x1a, 0xe0,
+    0xbf, 0x0, 0xc2, 0x1, 0x8, 0x18, 0x0, 0x4c,
+    0x0, 0x21, 0xe0, 0x7, 0xc0, 0x0, 0x85, 0xf0,
+    0x8e,
 
     /* U+0022 "\"" */
-    0xf5, 0x1f, 0x3f, 0x51, 0xf3, 0xe4, 0xf, 0x3e,
-    0x40, 0xf2, 0x72, 0x8, 0x10,
+    0xf5, 0x1f, 0x30, 0xe, 0x11, 0x80, 0x3c, 0x32,
+    0xc0, 0xe6,
 
     /* U+0023 "#" */
-    0x0, 0x6, 0xc0, 0x3, 0xe0, 0x0, 0x0, 0x7a,
-    0x0, 0x5c, 0x0, 0x0, 0x9, 0x80, 0x7, 0xa0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x3, 0x3e,
-    0x73, 0x3c, 0x83, 0x30, 0x0, 0xf2, 0x0, 0xc5,
-    0x0, 0x0, 0xf, 0x10, 0xe, 0x30, 0x0, 0x2,
-    0xf0, 0x0, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0x41, 0x38, 0xc3, 0x36, 0xe3, 0x30, 0x0,
-    0x89, 0x0, 0x5c, 0x0, 0x0, 0xa, 0x70, 0x7,
-    0xa0, 0x0,
+    0x0, 0x9b, 0x0, 0x7, 0xc0, 0x1c, 0x2c, 0x0,
+    0x62, 0x0, 0xee, 0x20, 0x1, 0x30, 0x0, 0x7f,
+    0xcc, 0xff, 0xe8, 0x5f, 0xd1, 0xcc, 0xc, 0x66,
+    0xd, 0xf3, 0x80, 0xcc, 0x2a, 0x66, 0xd, 0x33,
+    0x0, 0x63, 0x0, 0x13, 0x0, 0x62, 0x1, 0x0,
+    0x8, 0x80, 0x13, 0xfa, 0x1f, 0xf0, 0x6f, 0xa4,
+    0x63, 0x9e, 0x62, 0x47, 0x30, 0x82, 0x60, 0xa6,
+    0x71, 0x19, 0x80, 0x22, 0xe0, 0x1, 0x30, 0x4,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x79,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xe9, 0x20, 0x6,
-    0xfc, 0xbc, 0x9e, 0x90, 0xe, 0xb0, 0x79, 0x0,
-    0x10, 0xf, 0x80, 0x79, 0x0, 0x0, 0xd, 0xf5,
-    0x79, 0x0, 0x0, 0x3, 0xef, 0xfd, 0x50, 0x0,
-    0x0, 0x6, 0xcf, 0xfe, 0x40, 0x0, 0x0, 0x79,
-    0x5e, 0xf1, 0x0, 0x0, 0x79, 0x5, 0xf3, 0x7,
-    0x0, 0x79, 0x7, 0xf1, 0x2f, 0xe9, 0xbc, 0xaf,
-    0xa0, 0x3, 0xae, 0xff, 0xd7, 0x0, 0x0, 0x0,
-    0x79, 0x0, 0x0, 0x0, 0x0, 0x79, 0x0, 0x0,
+    0x0, 0xcf, 0x20, 0x1f, 0xfc, 0x45, 0xc8, 0x6e,
+    0x92, 0x0, 0x35, 0x2, 0x1b, 0xba, 0xc0, 0x10,
+    0x99, 0x85, 0x9e, 0x80, 0x0, 0x98, 0x7, 0x8,
+    0x0, 0x9d, 0x40, 0x3e, 0xe1, 0xa8, 0x45, 0x0,
+    0xc7, 0xd2, 0x65, 0x5c, 0x80, 0x19, 0xad, 0xa8,
+    0x2c, 0x40, 0x3c, 0xb6, 0x4, 0xe, 0x1, 0xc4,
+    0x4, 0x48, 0xe9, 0xc5, 0xa8, 0x51, 0x2c, 0x47,
+    0x43, 0x78, 0xa0, 0x1, 0xd7, 0x43, 0x6b, 0x80,
+    0x7f, 0xe0,
 
     /* U+0025 "%" */
-    0x3, 0xde, 0x80, 0x0, 0x5, 0xd0, 0x0, 0xe4,
-    0xc, 0x50, 0x1, 0xe3, 0x0, 0x4c, 0x0, 0x5a,
-    0x0, 0xa9, 0x0, 0x6, 0xa0, 0x4, 0xc0, 0x4e,
-    0x0, 0x0, 0x4c, 0x0, 0x5a, 0xd, 0x50, 0x0,
-    0x0, 0xe4, 0x1c, 0x58, 0xa0, 0x0, 0x0, 0x3,
-    0xce, 0x73, 0xe1, 0x3c, 0xe9, 0x0, 0x0, 0x0,
-    0xd6, 0xe, 0x40, 0xa8, 0x0, 0x0, 0x7c, 0x3,
-    0xc0, 0x3, 0xd0, 0x0, 0x2e, 0x20, 0x3c, 0x0,
-    0x3d, 0x0, 0xb, 0x70, 0x0, 0xe2, 0x9, 0x80,
-    0x6, 0xd0, 0x0, 0x4, 0xdd, 0xa0,
+    0x3, 0xde, 0x80, 0xc, 0xba, 0x1, 0x6c, 0xf2,
+    0x28, 0x0, 0x6f, 0x80, 0x8, 0x48, 0x13, 0xe0,
+    0xb, 0x73, 0x0, 0x13, 0x0, 0x5, 0x81, 0x11,
+    0x20, 0x11, 0x30, 0x0, 0x58, 0x26, 0xc0, 0x32,
+    0x12, 0xc, 0xfc, 0x3a, 0x80, 0x76, 0xc7, 0xdb,
+    0x32, 0xcf, 0x3a, 0x40, 0x7, 0x9c, 0xfd, 0x3,
+    0xb1, 0xc7, 0x0, 0x19, 0xc5, 0x8c, 0x90, 0x25,
+    0x40, 0x22, 0x9e, 0x0, 0xff, 0x4c, 0x88, 0xc,
+    0x88, 0x14, 0xa0, 0x6, 0x63, 0x80, 0x55, 0xfa,
+    0x70,
 
     /* U+0026 "&" */
-    0x0, 0x9, 0xef, 0xb1, 0x0, 0x0, 0x9, 0xe4,
-    0x3c, 0xa0, 0x0, 0x0, 0xd9, 0x0, 0x7d, 0x0,
-    0x0, 0xc, 0xc0, 0x1c, 0xa0, 0x0, 0x0, 0x3f,
-    0xae, 0xc1, 0x0, 0x0, 0x1, 0xdf, 0xc0, 0x0,
-    0x0, 0x3, 0xeb, 0x8f, 0x70, 0x18, 0x0, 0xdb,
-    0x0, 0x7f, 0x65, 0xf0, 0x3f, 0x40, 0x0, 0x8f,
-    0xea, 0x3, 0xf7, 0x0, 0x0, 0xcf, 0x70, 0xb,
-    0xf9, 0x66, 0xcf, 0xbf, 0x40, 0x8, 0xdf, 0xea,
-    0x30, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa7, 0xbe, 0xc4, 0x3, 0xa5, 0xeb, 0x1e,
+    0xc0, 0x39, 0x1d, 0xe, 0xdc, 0x3, 0x85, 0x40,
+    0x6d, 0xc0, 0x3b, 0xce, 0xbc, 0x2c, 0x3, 0x88,
+    0x8a, 0x58, 0x20, 0x18, 0xfd, 0x9c, 0xdc, 0x6,
+    0x0, 0x1c, 0xb7, 0x11, 0x32, 0x38, 0x19, 0x78,
+    0x1, 0xdd, 0x36, 0xa0, 0x11, 0x80, 0x50, 0x63,
+    0xa0, 0x69, 0x12, 0xcc, 0xc3, 0x48, 0x40, 0xb7,
+    0x49, 0x86, 0xcb, 0x51, 0x0, 0x46, 0xff, 0x51,
+    0x85, 0x28,
 
     /* U+0027 "'" */
-    0xf5, 0xf5, 0xe4, 0xe4, 0x72,
+    0xf5, 0x0, 0x8, 0x80, 0x12, 0xc0,
 
     /* U+0028 "(" */
-    0x0, 0xda, 0x5, 0xf2, 0xb, 0xc0, 0xf, 0x70,
-    0x3f, 0x40, 0x5f, 0x20, 0x6f, 0x10, 0x7f, 0x0,
-    0x6f, 0x10, 0x5f, 0x20, 0x3f, 0x40, 0xf, 0x70,
-    0xb, 0xc0, 0x5, 0xf2, 0x0, 0xda,
+    0x0, 0x6d, 0x2, 0x94, 0x7, 0x19, 0x2, 0x58,
+    0x18, 0x18, 0x30, 0x30, 0x18, 0x18, 0x8, 0x8,
+    0x8, 0x8, 0x18, 0x18, 0x30, 0x30, 0x18, 0x18,
+    0x1, 0x2c, 0x1, 0xc6, 0x40, 0xa5, 0x0,
 
     /* U+0029 ")" */
-    0x3f, 0x30, 0xc, 0xb0, 0x6, 0xf1, 0x1, 0xf6,
-    0x0, 0xe9, 0x0, 0xbc, 0x0, 0xad, 0x0, 0xae,
-    0x0, 0xad, 0x0, 0xbc, 0x0, 0xe9, 0x1, 0xf6,
-    0x6, 0xf1, 0xc, 0xb0, 0x3f, 0x30,
+    0x3f, 0x30, 0x33, 0x40, 0x2, 0x90, 0x41, 0xc1,
+    0xc0, 0x45, 0xe0, 0x5, 0x50, 0x0, 0x44, 0x1,
+    0x18, 0x4, 0x60, 0x1, 0x10, 0x1, 0x54, 0x2,
+    0x2f, 0x7, 0x7, 0xa, 0x41, 0x33, 0x40, 0x0,
 
     /* U+002A "*" */
-    0x0, 0x4a, 0x0, 0x6, 0x74, 0xa4, 0xa0, 0x2b,
-    0xff, 0xe5, 0x0, 0x7f, 0xfb, 0x20, 0x7b, 0x6b,
-    0x8d, 0x0, 0x4, 0xa0, 0x0, 0x0, 0x13, 0x0,
-    0x0,
+    0x0, 0x25, 0x0, 0x4c, 0xe0, 0x4, 0xa0, 0x4c,
+    0xb5, 0xaf, 0x2, 0xc0, 0x2, 0xb8, 0x3e, 0x4a,
+    0x1f, 0x83, 0xd9, 0xc, 0x68, 0x4, 0xb2, 0x1,
 
     /* U+002B "+" */
-    0x0, 0x5, 0x10, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x1, 0x1f, 0x51, 0x10,
-    0xef, 0xff, 0xff, 0xf3, 0x34, 0x4f, 0x74, 0x40,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0xf, 0x50, 0x0,
+    0x0, 0x94, 0x40, 0x3d, 0x48, 0x1, 0xff, 0x84,
+    0x40, 0x1, 0x10, 0x77, 0x41, 0x5d, 0xc3, 0xdb,
+    0xb0, 0x45, 0xd8, 0xcc, 0x88, 0x2, 0x44, 0x0,
+    0x7f,
 
     /* U+002C "," */
-    0x9, 0x52, 0xfd, 0xb, 0xa0, 0xc5, 0xf, 0x0,
+    0x9, 0x52, 0x68, 0x24, 0x70, 0x7f, 0x3, 0x50,
 
     /* U+002D "-" */
-    0x1, 0x11, 0x10, 0x1f, 0xff, 0xf3, 0x4, 0x44,
-    0x40,
+    0x1, 0x1c, 0x3, 0xdd, 0x8c, 0x6e, 0xf1, 0x80,
 
     /* U+002E "." */
-    0x3, 0x12, 0xfc, 0x1e, 0x90,
+    0x3, 0x12, 0xcd, 0x31, 0x50,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x5, 0xf1, 0x0, 0x0, 0xa, 0xb0,
-    0x0, 0x0, 0xf, 0x60, 0x0, 0x0, 0x5f, 0x10,
-    0x0, 0x0, 0xab, 0x0, 0x0, 0x0, 0xf6, 0x0,
-    0x0, 0x5, 0xf1, 0x0, 0x0, 0xa, 0xb0, 0x0,
-    0x0, 0xf, 0x60, 0x0, 0x0, 0x4f, 0x10, 0x0,
-    0x0, 0xac, 0x0, 0x0, 0x0, 0xf6, 0x0, 0x0,
-    0x4, 0xf1, 0x0, 0x0, 0xa, 0xc0, 0x0, 0x0,
-    0xe, 0x60, 0x0, 0x0, 0x4f, 0x10, 0x0, 0x0,
+    0x0, 0xe5, 0xf1, 0x0, 0xef, 0x41, 0x0, 0xe5,
+    0xd0, 0xe, 0x50, 0x70, 0xe, 0xf4, 0x10, 0xe,
+    0x5d, 0x0, 0xe5, 0x7, 0x0, 0xef, 0x41, 0x0,
+    0xe5, 0xd0, 0xe, 0x40, 0x70, 0xe, 0xe3, 0x10,
+    0xe, 0x5a, 0x0, 0xe4, 0x7, 0x0, 0xee, 0x31,
+    0x0, 0xe4, 0xa0, 0xe, 0x41, 0x70, 0xe,
 
     /* U+0030 "0" */
-    0x0, 0x8, 0xef, 0xc5, 0x0, 0x0, 0xcf, 0xa8,
-    0xcf, 0x70, 0x7, 0xf5, 0x0, 0xa, 0xf2, 0xd,
-    0xc0, 0x0, 0x1, 0xf8, 0x1f, 0x80, 0x0, 0x0,
-    0xdc, 0x3f, 0x60, 0x0, 0x0, 0xbd, 0x3f, 0x60,
-    0x0, 0x0, 0xbd, 0x1f, 0x80, 0x0, 0x0, 0xdc,
-    0xd, 0xc0, 0x0, 0x1, 0xf8, 0x7, 0xf5, 0x0,
-    0xa, 0xf2, 0x0, 0xcf, 0xa8, 0xcf, 0x70, 0x0,
-    0x8, 0xef, 0xc5, 0x0,
+    0x0, 0xa3, 0xbf, 0x14, 0x3, 0x63, 0xa3, 0x85,
+    0x38, 0x1, 0xce, 0xa9, 0x18, 0xb0, 0x41, 0x46,
+    0xa0, 0x15, 0x85, 0x9, 0x20, 0x6, 0x12, 0x42,
+    0xe, 0x0, 0xe6, 0x10, 0xf, 0xf1, 0x7, 0x0,
+    0x73, 0x8, 0x89, 0x0, 0x30, 0x92, 0x5, 0x1a,
+    0x80, 0x56, 0x14, 0xe, 0x75, 0x48, 0xc5, 0x82,
+    0x0, 0x63, 0xa3, 0x85, 0x38, 0x0,
 
     /* U+0031 "1" */
-    0xef, 0xff, 0x36, 0x7a, 0xf3, 0x0, 0x5f, 0x30,
-    0x5, 0xf3, 0x0, 0x5f, 0x30, 0x5, 0xf3, 0x0,
-    0x5f, 0x30, 0x5, 0xf3, 0x0, 0x5f, 0x30, 0x5,
-    0xf3, 0x0, 0x5f, 0x30, 0x5, 0xf3,
+    0xef, 0xf8, 0xe2, 0xa, 0x0, 0x67, 0xf0, 0xf,
+    0xff, 0x18,
 
     /* U+0032 "2" */
-    0x4, 0xbe, 0xfd, 0x70, 0x7, 0xfd, 0x98, 0xcf,
-    0x90, 0x28, 0x0, 0x0, 0xbf, 0x0, 0x0, 0x0,
-    0x7, 0xf2, 0x0, 0x0, 0x0, 0xaf, 0x0, 0x0,
-    0x0, 0x4f, 0x80, 0x0, 0x0, 0x3f, 0xc0, 0x0,
-    0x0, 0x3e, 0xc1, 0x0, 0x0, 0x2e, 0xd1, 0x0,
-    0x0, 0x2e, 0xd1, 0x0, 0x0, 0x2e, 0xf8, 0x77,
-    0x77, 0x46, 0xff, 0xff, 0xff, 0xfa,
+    0x4, 0xbe, 0xfd, 0x70, 0x3, 0xdb, 0x3b, 0x86,
+    0x24, 0x15, 0xf6, 0x63, 0x11, 0x80, 0xa0, 0x3,
+    0x60, 0x10, 0x7, 0xb4, 0x8, 0x3, 0x91, 0x5c,
+    0x3, 0x8e, 0xce, 0x0, 0x31, 0xe9, 0xe8, 0x6,
+    0x2d, 0x3d, 0x10, 0x8, 0xb0, 0xf0, 0x40, 0x22,
+    0xc1, 0x56, 0x77, 0x91, 0x2, 0xf, 0x11, 0xb8,
 
     /* U+0033 "3" */
-    0x6f, 0xff, 0xff, 0xff, 0x2, 0x77, 0x77, 0x9f,
-    0xb0, 0x0, 0x0, 0xc, 0xe1, 0x0, 0x0, 0x9,
-    0xf3, 0x0, 0x0, 0x5, 0xf6, 0x0, 0x0, 0x0,
-    0xdf, 0xe9, 0x10, 0x0, 0x4, 0x59, 0xfd, 0x0,
-    0x0, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0x3f,
-    0x64, 0x40, 0x0, 0x8, 0xf3, 0xbf, 0xc9, 0x8c,
-    0xfb, 0x0, 0x7c, 0xff, 0xd7, 0x0,
+    0x6f, 0xff, 0x81, 0x22, 0x33, 0x2, 0x1, 0x3b,
+    0xe5, 0x1a, 0x0, 0xe9, 0x3d, 0x10, 0xc, 0xad,
+    0x26, 0x1, 0xd0, 0x11, 0x22, 0x1, 0xa6, 0x9d,
+    0xb0, 0x3, 0x22, 0xcc, 0x89, 0x0, 0x3c, 0xa0,
+    0x48, 0x80, 0xd, 0x60, 0xbf, 0x79, 0x31, 0x8e,
+    0x87, 0x70, 0xc, 0xe3, 0x16, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x1, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0xbe, 0x10, 0x0, 0x0, 0x0, 0x6f, 0x50, 0x0,
-    0x0, 0x0, 0x2f, 0x90, 0x0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0x0, 0x0, 0x8, 0xf3, 0x1, 0xd5,
-    0x0, 0x3, 0xf8, 0x0, 0x2f, 0x60, 0x0, 0xed,
-    0x22, 0x23, 0xf7, 0x21, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0x81, 0x55, 0x55, 0x56, 0xf9, 0x52, 0x0,
-    0x0, 0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0,
+    0x0, 0xe1, 0xeb, 0x0, 0xfd, 0x41, 0x40, 0x1f,
+    0x32, 0x58, 0x80, 0x78, 0xa5, 0x94, 0x3, 0xee,
+    0x29, 0x0, 0xfa, 0xf, 0x80, 0x75, 0x40, 0x23,
+    0x77, 0x18, 0x19, 0x18, 0x5, 0xa5, 0x44, 0x41,
+    0x1, 0x21, 0x61, 0x2d, 0xdb, 0x2, 0x36, 0x5e,
+    0xab, 0xa4, 0x1a, 0xa8, 0x2a, 0xbc, 0x81, 0xea,
+    0x40, 0x1f, 0xf0,
 
     /* U+0035 "5" */
-    0x5, 0xff, 0xff, 0xff, 0x0, 0x7f, 0x77, 0x77,
-    0x70, 0x8, 0xe0, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x0, 0xb, 0xc2, 0x10, 0x0, 0x0, 0xdf,
-    0xff, 0xfb, 0x30, 0x4, 0x55, 0x68, 0xff, 0x20,
-    0x0, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x0, 0xf,
-    0x92, 0x50, 0x0, 0x5, 0xf6, 0x8f, 0xd9, 0x8a,
-    0xfd, 0x0, 0x5b, 0xef, 0xe9, 0x10,
+    0x5, 0xff, 0xf0, 0x0, 0x82, 0x23, 0x80, 0x1e,
+    0x2e, 0xfc, 0x0, 0x23, 0x0, 0xf8, 0x44, 0x42,
+    0x1, 0xcc, 0x7b, 0xdf, 0x66, 0x0, 0x9a, 0xa4,
+    0xba, 0x61, 0x2, 0x2a, 0x9a, 0x2c, 0x28, 0x3,
+    0xc8, 0x2, 0x4a, 0x1, 0x94, 0x3e, 0xa9, 0xb3,
+    0x15, 0x42, 0x68, 0xa6, 0x77, 0x23, 0x60, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x5, 0xce, 0xfc, 0x60, 0x0, 0x9f, 0xc8,
-    0x8b, 0x70, 0x5, 0xf8, 0x0, 0x0, 0x0, 0xc,
-    0xd0, 0x0, 0x0, 0x0, 0x1f, 0x80, 0x0, 0x0,
-    0x0, 0x2f, 0x68, 0xef, 0xfa, 0x10, 0x3f, 0xee,
-    0x64, 0x8f, 0xd0, 0x2f, 0xf1, 0x0, 0x6, 0xf4,
-    0xe, 0xc0, 0x0, 0x2, 0xf6, 0x9, 0xf1, 0x0,
-    0x6, 0xf3, 0x1, 0xde, 0x86, 0x9f, 0xb0, 0x0,
-    0x19, 0xef, 0xd8, 0x0,
+    0x0, 0x97, 0x3b, 0xf1, 0x80, 0x29, 0xa0, 0x67,
+    0x70, 0x80, 0x15, 0x9f, 0x22, 0x16, 0xe0, 0x9,
+    0x28, 0x0, 0xf0, 0x9a, 0x80, 0x7c, 0x61, 0xd1,
+    0xdf, 0xea, 0x10, 0x10, 0x86, 0x8b, 0x75, 0xc0,
+    0x10, 0x1f, 0x64, 0x89, 0x24, 0x21, 0x31, 0x0,
+    0x90, 0x8, 0x1c, 0xc4, 0x2, 0x40, 0x50, 0x82,
+    0xf8, 0x69, 0x92, 0x18, 0xe, 0x3b, 0x4a, 0x3d,
+    0x80,
 
     /* U+0037 "7" */
-    0x8f, 0xff, 0xff, 0xff, 0xe8, 0xf7, 0x77, 0x77,
-    0xfc, 0x8f, 0x0, 0x0, 0x4f, 0x55, 0x90, 0x0,
-    0xb, 0xe0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x0,
-    0x0, 0x9f, 0x10, 0x0, 0x0, 0xf, 0xb0, 0x0,
-    0x0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0xdd, 0x0,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0x0, 0xa, 0xf1,
-    0x0, 0x0, 0x1, 0xf9, 0x0, 0x0,
+    0x8f, 0xff, 0xb8, 0x1, 0x11, 0xc0, 0x40, 0x7,
+    0x7c, 0x61, 0x3a, 0xc0, 0x1b, 0xc5, 0x55, 0x20,
+    0x11, 0x23, 0x0, 0x7a, 0xc2, 0x40, 0x3c, 0xc8,
+    0x20, 0x1c, 0xc1, 0xe0, 0x1e, 0xb2, 0x40, 0xe,
+    0x32, 0xa0, 0xf, 0x48, 0x30, 0x7, 0xa, 0xb0,
+    0x80, 0x40,
 
     /* U+0038 "8" */
-    0x0, 0x5c, 0xff, 0xd7, 0x0, 0x6, 0xfc, 0x76,
-    0xaf, 0xa0, 0xc, 0xd0, 0x0, 0x9, 0xf1, 0xd,
-    0xc0, 0x0, 0x7, 0xf2, 0x7, 0xf7, 0x11, 0x5e,
-    0xc0, 0x0, 0xbf, 0xff, 0xfe, 0x10, 0x9, 0xf9,
-    0x54, 0x7e, 0xd0, 0x2f, 0x80, 0x0, 0x4, 0xf6,
-    0x4f, 0x50, 0x0, 0x0, 0xf8, 0x1f, 0xa0, 0x0,
-    0x5, 0xf6, 0x9, 0xfb, 0x76, 0xaf, 0xd0, 0x0,
-    0x6c, 0xff, 0xd8, 0x10,
+    0x0, 0x2e, 0x7f, 0xb5, 0xc0, 0x26, 0xa0, 0x89,
+    0x78, 0xa0, 0x5, 0x16, 0x3b, 0x53, 0x28, 0x80,
+    0x88, 0x3, 0x70, 0x18, 0x51, 0xb8, 0x89, 0x64,
+    0xc8, 0x1d, 0x23, 0xb9, 0x41, 0xa0, 0x9, 0x46,
+    0xab, 0x80, 0xc0, 0x26, 0x79, 0x54, 0x7a, 0x26,
+    0x60, 0x68, 0x6, 0x40, 0xe5, 0xf, 0x0, 0xca,
+    0x1c, 0x2c, 0xb6, 0xed, 0x54, 0x26, 0x9, 0x93,
+    0xc4, 0xbb, 0xb0, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x8e, 0xfd, 0x80, 0x0, 0xc, 0xf8, 0x68,
-    0xfc, 0x0, 0x5f, 0x50, 0x0, 0x3f, 0x70, 0x8f,
-    0x0, 0x0, 0xe, 0xc0, 0x7f, 0x30, 0x0, 0x1f,
-    0xf0, 0x1f, 0xd4, 0x13, 0xcf, 0xf1, 0x4, 0xef,
-    0xff, 0xa9, 0xf0, 0x0, 0x2, 0x31, 0xa, 0xf0,
-    0x0, 0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x0,
-    0x9f, 0x30, 0x9, 0xa7, 0x8d, 0xf7, 0x0, 0x7,
-    0xdf, 0xeb, 0x40, 0x0,
+    0x0, 0x47, 0x7e, 0xc0, 0x6, 0xc7, 0x69, 0x57,
+    0xc0, 0x2, 0x9d, 0x43, 0x46, 0x1b, 0x86, 0x82,
+    0x80, 0x46, 0x36, 0x1e, 0x6, 0x1, 0x8, 0x8c,
+    0x18, 0x39, 0x4, 0xf4, 0x0, 0x22, 0xb3, 0xbe,
+    0xc6, 0x60, 0x8, 0x27, 0x6e, 0x75, 0x18, 0x7,
+    0x11, 0x88, 0x22, 0x80, 0x7d, 0x23, 0x20, 0x9,
+    0xa7, 0x8d, 0x68, 0x30, 0x7, 0x3c, 0x33, 0x2d,
+    0xc0, 0x0,
 
     /* U+003A ":" */
-    0x1e, 0x92, 0xfc, 0x3, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x12, 0xfc, 0x1e, 0x90,
+    0x1e, 0x93, 0x15, 0x2c, 0xd0, 0x31, 0x0, 0xf8,
+    0xc4, 0xb3, 0x4c, 0x54,
 
     /* U+003B ";" */
-    0x1e, 0x92, 0xfc, 0x3, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xe9, 0x1f, 0xd0, 0xa8, 0xe,
-    0x30, 0xa0,
+    0x1e, 0x93, 0x15, 0x2c, 0xd0, 0x31, 0x0, 0xfe,
+    0x1e, 0x90, 0x14, 0x15, 0x50, 0x25, 0x82, 0x18,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x42, 0x0, 0x1, 0x7d, 0xf3,
-    0x3, 0x9f, 0xe8, 0x10, 0xbf, 0xb5, 0x0, 0x0,
-    0xee, 0x81, 0x0, 0x0, 0x6, 0xdf, 0xb4, 0x0,
-    0x0, 0x4, 0xaf, 0xd2, 0x0, 0x0, 0x1, 0x82,
+    0x0, 0xf2, 0x10, 0x4, 0x2f, 0xb6, 0x20, 0x73,
+    0xd2, 0xbc, 0x77, 0x85, 0x5d, 0x2, 0xa, 0x26,
+    0x80, 0x1b, 0xa1, 0x7a, 0xd0, 0x2, 0x6d, 0xb1,
+    0xbd, 0x20, 0x9, 0x2b, 0x94, 0x0,
 
     /* U+003D "=" */
-    0xef, 0xff, 0xff, 0xf3, 0x45, 0x55, 0x55, 0x51,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x10,
-    0xef, 0xff, 0xff, 0xf3, 0x34, 0x44, 0x44, 0x40,
+    0xef, 0xff, 0x1d, 0x57, 0xc4, 0x8a, 0xbe, 0x10,
+    0x11, 0xf0, 0x77, 0x7c, 0x7b, 0x77, 0xe3,
 
     /* U+003E ">" */
-    0x50, 0x0, 0x0, 0x0, 0xef, 0x92, 0x0, 0x0,
-    0x6, 0xcf, 0xb5, 0x0, 0x0, 0x3, 0x9f, 0xe2,
-    0x0, 0x0, 0x6c, 0xf3, 0x2, 0x9e, 0xe9, 0x20,
-    0xbf, 0xc6, 0x0, 0x0, 0x93, 0x0, 0x0, 0x0,
+    0x50, 0xf, 0xaf, 0xe4, 0x80, 0x37, 0x4a, 0xed,
+    0xa8, 0x4, 0xd9, 0x82, 0xae, 0x20, 0x8, 0xfc,
+    0xc4, 0x40, 0x53, 0xd0, 0xba, 0x77, 0xab, 0x1d,
+    0x24, 0x5, 0x98, 0x60, 0xc,
 
     /* U+003F "?" */
-    0x4, 0xbe, 0xfd, 0x70, 0x7, 0xfc, 0x77, 0xbf,
-    0xa0, 0x27, 0x0, 0x0, 0xcf, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x1, 0xea, 0x0, 0x0,
-    0x1, 0xdd, 0x10, 0x0, 0x0, 0xce, 0x10, 0x0,
-    0x0, 0x3f, 0x60, 0x0, 0x0, 0x1, 0x30, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x6, 0xf5,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
+    0x4, 0xbe, 0xfd, 0x70, 0x3, 0xdb, 0xcc, 0x34,
+    0x50, 0x2c, 0x63, 0xba, 0xcd, 0x40, 0x9c, 0x3,
+    0x28, 0x7, 0xc2, 0xea, 0x1, 0xc3, 0x87, 0x60,
+    0x1d, 0xa7, 0x82, 0x1, 0x8c, 0xd0, 0x20, 0x1c,
+    0x58, 0xc0, 0x1e, 0x12, 0x0, 0xf9, 0xb9, 0x40,
+    0x3c, 0x60, 0x20, 0x10,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x17, 0xce, 0xfd, 0xb5, 0x0, 0x0,
-    0x0, 0x5, 0xfb, 0x53, 0x23, 0x7d, 0xc2, 0x0,
-    0x0, 0x6e, 0x40, 0x0, 0x0, 0x0, 0x8e, 0x10,
-    0x2, 0xf4, 0x1, 0xae, 0xfa, 0x3f, 0x49, 0xb0,
-    0xa, 0x90, 0x1e, 0xe6, 0x5b, 0xef, 0x40, 0xe3,
-    0xf, 0x30, 0x8f, 0x10, 0x0, 0xaf, 0x40, 0x98,
-    0x1f, 0x0, 0xd9, 0x0, 0x0, 0x3f, 0x40, 0x6a,
-    0x3f, 0x0, 0xe8, 0x0, 0x0, 0x1f, 0x40, 0x5c,
-    0x1f, 0x0, 0xd9, 0x0, 0x0, 0x3f, 0x40, 0x6a,
-    0xf, 0x30, 0x8f, 0x10, 0x0, 0xaf, 0x40, 0x98,
-    0xa, 0x90, 0x1e, 0xd6, 0x5a, 0xde, 0xa6, 0xf2,
-    0x3, 0xf3, 0x1, 0xaf, 0xfa, 0x16, 0xee, 0x50,
-    0x0, 0x6e, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xfb, 0x53, 0x23, 0x75, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xfd, 0xa3, 0x0, 0x0,
+    0x0, 0xc2, 0xf9, 0xdf, 0xb6, 0xa0, 0x1f, 0x2f,
+    0x64, 0xee, 0xbb, 0x23, 0x8, 0x3, 0x35, 0xdc,
+    0xa6, 0x46, 0xfa, 0x98, 0x20, 0x2, 0x9a, 0x41,
+    0xae, 0xfa, 0x3f, 0xc7, 0xa0, 0x4, 0x32, 0xf,
+    0xa4, 0x50, 0xe8, 0x2, 0x54, 0xc1, 0x68, 0x24,
+    0x7d, 0x96, 0xd0, 0x2, 0x7b, 0x10, 0x30, 0x56,
+    0x10, 0xa, 0x40, 0x2f, 0x22, 0x0, 0x46, 0x20,
+    0x18, 0x80, 0x23, 0x62, 0x0, 0x8c, 0x40, 0x31,
+    0x0, 0x46, 0xc2, 0x6, 0xa, 0xc2, 0x1, 0x48,
+    0x5, 0xe4, 0xb, 0x41, 0x23, 0x8c, 0xb4, 0xe3,
+    0xcc, 0xca, 0x9, 0x63, 0x1f, 0x79, 0xa0, 0xc8,
+    0x48, 0xa2, 0x3, 0x9d, 0x41, 0xaf, 0xf5, 0xb,
+    0x77, 0x14, 0x2, 0x68, 0xbb, 0x29, 0x91, 0xba,
+    0x80, 0x7c, 0xdd, 0x93, 0xba, 0xed, 0x60, 0xc,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x2, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0x9e, 0xb0, 0x0, 0x0, 0x0, 0x6, 0xf2, 0x7f,
-    0x20, 0x0, 0x0, 0x0, 0xdc, 0x1, 0xf8, 0x0,
-    0x0, 0x0, 0x4f, 0x60, 0xb, 0xe0, 0x0, 0x0,
-    0xb, 0xf0, 0x0, 0x4f, 0x60, 0x0, 0x1, 0xfa,
-    0x11, 0x11, 0xed, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0xe, 0xc4, 0x44, 0x44, 0x4f,
-    0xa0, 0x6, 0xf4, 0x0, 0x0, 0x0, 0xaf, 0x10,
-    0xcd, 0x0, 0x0, 0x0, 0x2, 0xf8,
+    0x0, 0xe2, 0xfd, 0x0, 0xff, 0x58, 0x12, 0x0,
+    0x7f, 0x33, 0x7, 0xc0, 0x3f, 0x30, 0x5c, 0xa1,
+    0x0, 0x7d, 0x66, 0x4c, 0x14, 0x1, 0xe4, 0x2a,
+    0x1, 0x46, 0x0, 0xf7, 0x83, 0x0, 0x3c, 0x58,
+    0x3, 0xa, 0x28, 0x8c, 0xa3, 0x60, 0x1a, 0x41,
+    0x7b, 0xb0, 0x91, 0x80, 0x4c, 0x77, 0x7e, 0x9,
+    0x0, 0x30, 0xc2, 0x27, 0x95, 0x42, 0x14, 0x48,
+    0x1, 0xe8, 0x9,
 
     /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xeb, 0x40, 0x5, 0xf8, 0x55,
-    0x57, 0xdf, 0x40, 0x5f, 0x40, 0x0, 0x1, 0xfa,
-    0x5, 0xf4, 0x0, 0x0, 0xf, 0xa0, 0x5f, 0x51,
-    0x11, 0x3a, 0xf4, 0x5, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x5f, 0x74, 0x44, 0x59, 0xfa, 0x5, 0xf4,
-    0x0, 0x0, 0x8, 0xf2, 0x5f, 0x40, 0x0, 0x0,
-    0x5f, 0x45, 0xf4, 0x0, 0x0, 0x9, 0xf2, 0x5f,
-    0x85, 0x55, 0x6a, 0xfb, 0x5, 0xff, 0xff, 0xff,
-    0xd7, 0x0,
+    0x5f, 0xfe, 0xeb, 0x40, 0xc, 0xf5, 0x54, 0xb5,
+    0xa0, 0x5, 0x8a, 0xb3, 0xe0, 0x70, 0x7, 0xe1,
+    0x0, 0xe1, 0x1c, 0x74, 0x1c, 0x1, 0x57, 0x75,
+    0x8a, 0xa4, 0x0, 0xa2, 0xee, 0xa6, 0x5a, 0x0,
+    0x8d, 0x12, 0x59, 0x75, 0x20, 0xf, 0xda, 0xc,
+    0x1, 0xfb, 0x1, 0x80, 0x18, 0xab, 0x35, 0x32,
+    0x10, 0x1, 0xea, 0xa9, 0x78, 0xb0,
 
     /* U+0043 "C" */
-    0x0, 0x2, 0x8d, 0xfe, 0xb4, 0x0, 0x4, 0xff,
-    0xb8, 0x9d, 0xf9, 0x2, 0xfd, 0x20, 0x0, 0x8,
-    0x50, 0xbf, 0x20, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd2, 0x0, 0x0, 0x85, 0x0,
-    0x5f, 0xfb, 0x89, 0xdf, 0x80, 0x0, 0x29, 0xdf,
-    0xeb, 0x40,
+    0x0, 0x8a, 0x37, 0xfa, 0xd0, 0x2, 0x4d, 0x76,
+    0x77, 0x35, 0xc8, 0x15, 0x96, 0xdc, 0x4e, 0xbe,
+    0x4, 0x87, 0x90, 0x6, 0x85, 0x4, 0x52, 0x0,
+    0xf8, 0x83, 0x0, 0x3f, 0xf8, 0xe4, 0x18, 0x1,
+    0xfc, 0x8a, 0x40, 0x1f, 0xa4, 0x3c, 0x80, 0x34,
+    0x28, 0x15, 0x16, 0xdc, 0x4e, 0xbe, 0x80, 0x17,
+    0x59, 0x8e, 0xe6, 0xb8,
 
     /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xea, 0x30, 0x0, 0x5f, 0x97,
-    0x77, 0x9e, 0xf8, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0xaf, 0x60, 0x5f, 0x40, 0x0, 0x0, 0xd, 0xe0,
-    0x5f, 0x40, 0x0, 0x0, 0x6, 0xf4, 0x5f, 0x40,
-    0x0, 0x0, 0x3, 0xf6, 0x5f, 0x40, 0x0, 0x0,
-    0x3, 0xf6, 0x5f, 0x40, 0x0, 0x0, 0x6, 0xf4,
-    0x5f, 0x40, 0x0, 0x0, 0xd, 0xe0, 0x5f, 0x40,
-    0x0, 0x0, 0xaf, 0x60, 0x5f, 0x97, 0x77, 0x9e,
-    0xf8, 0x0, 0x5f, 0xff, 0xff, 0xea, 0x30, 0x0,
+    0x5f, 0xfe, 0xea, 0x30, 0xe, 0x68, 0x89, 0xd3,
+    0x20, 0x3, 0x6b, 0xbd, 0x3c, 0xae, 0xc0, 0x1f,
+    0xd4, 0x50, 0x1, 0xfe, 0xb1, 0x40, 0xf, 0xe5,
+    0x2, 0x0, 0xff, 0xe4, 0xa8, 0x10, 0x7, 0xf5,
+    0x8a, 0x0, 0x7e, 0xa2, 0x80, 0xb, 0x5d, 0xe9,
+    0xe5, 0x76, 0x0, 0x9a, 0x22, 0x74, 0xc8, 0x0,
 
     /* U+0045 "E" */
-    0x5f, 0xff, 0xff, 0xff, 0x95, 0xf9, 0x77, 0x77,
-    0x74, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x5f, 0x51, 0x11, 0x11, 0x5, 0xff,
-    0xff, 0xff, 0xe0, 0x5f, 0x74, 0x44, 0x44, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x97, 0x77,
-    0x77, 0x65, 0xff, 0xff, 0xff, 0xfd,
+    0x5f, 0xff, 0xa4, 0x0, 0xd1, 0x1d, 0xa0, 0xd,
+    0x77, 0xe4, 0x0, 0xff, 0x84, 0x7c, 0x1, 0x57,
+    0x76, 0xf0, 0xa, 0x2e, 0xf5, 0x0, 0x46, 0x89,
+    0xc0, 0x1f, 0xfc, 0x9d, 0x77, 0xe6, 0x0, 0x34,
+    0x47, 0x58,
 
     /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0x95, 0xf9, 0x77, 0x77,
-    0x74, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf5,
-    0x22, 0x22, 0x10, 0x5f, 0xff, 0xff, 0xfe, 0x5,
-    0xf8, 0x55, 0x55, 0x40, 0x5f, 0x40, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xa4, 0x0, 0xd1, 0x1d, 0xa0, 0xd,
+    0x77, 0xe4, 0x0, 0xff, 0xe4, 0x9, 0x16, 0x10,
+    0xa, 0xb7, 0x77, 0x80, 0x4f, 0x55, 0xc0, 0x16,
+    0x2a, 0xe4, 0x0, 0xff, 0xe8, 0x0,
 
     /* U+0047 "G" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x4f,
-    0xfb, 0x89, 0xdf, 0xb0, 0x2, 0xfd, 0x20, 0x0,
-    0x6, 0x60, 0xb, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0x60, 0x0, 0x0,
-    0x9, 0xf0, 0xf, 0xa0, 0x0, 0x0, 0x9, 0xf0,
-    0xb, 0xf2, 0x0, 0x0, 0x9, 0xf0, 0x2, 0xfd,
-    0x20, 0x0, 0xa, 0xf0, 0x0, 0x4f, 0xfb, 0x89,
-    0xdf, 0xc0, 0x0, 0x2, 0x8d, 0xfe, 0xc6, 0x0,
+    0x0, 0x86, 0x37, 0xfa, 0xd4, 0x3, 0x27, 0x3b,
+    0x3b, 0x9a, 0xac, 0x0, 0x56, 0x5b, 0x71, 0x3b,
+    0x3a, 0x0, 0x90, 0xf2, 0x0, 0xcc, 0xc0, 0x2,
+    0x29, 0x0, 0x7e, 0x20, 0xc0, 0xf, 0xfe, 0x34,
+    0xf8, 0x10, 0x60, 0x7, 0xf9, 0x14, 0x80, 0x3f,
+    0xa4, 0x3c, 0x80, 0x31, 0x80, 0x45, 0x65, 0xb7,
+    0x13, 0xaa, 0x60, 0x12, 0x6b, 0xb3, 0xb8, 0x67,
+    0x0,
 
     /* U+0048 "H" */
-    0x5f, 0x40, 0x0, 0x0, 0x4f, 0x55, 0xf4, 0x0,
-    0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0, 0x4f,
-    0x55, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0x52,
-    0x22, 0x22, 0x5f, 0x55, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x5f, 0x85, 0x55, 0x55, 0x8f, 0x55, 0xf4,
-    0x0, 0x0, 0x4, 0xf5, 0x5f, 0x40, 0x0, 0x0,
-    0x4f, 0x55, 0xf4, 0x0, 0x0, 0x4, 0xf5, 0x5f,
-    0x40, 0x0, 0x0, 0x4f, 0x55, 0xf4, 0x0, 0x0,
-    0x4, 0xf5,
+    0x5f, 0x40, 0xe, 0x4f, 0x50, 0xf, 0xfe, 0xb8,
+    0x91, 0x70, 0x80, 0x6a, 0xdd, 0xea, 0x0, 0xcf,
+    0x55, 0xce, 0x1, 0xb1, 0x57, 0xb0, 0x3, 0xff,
+    0xc4,
 
     /* U+0049 "I" */
-    0x5f, 0x45, 0xf4, 0x5f, 0x45, 0xf4, 0x5f, 0x45,
-    0xf4, 0x5f, 0x45, 0xf4, 0x5f, 0x45, 0xf4, 0x5f,
-    0x45, 0xf4,
+    0x5f, 0x40, 0xf, 0xfe, 0xa8,
 
     /* U+004A "J" */
-    0x0, 0xff, 0xff, 0xfa, 0x0, 0x77, 0x77, 0xfa,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0xfa, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0xf9, 0x7, 0x20, 0x3, 0xf6,
-    0xd, 0xe9, 0x8e, 0xf1, 0x1, 0xae, 0xfb, 0x30,
+    0x0, 0x7f, 0xf5, 0x0, 0x22, 0x30, 0x6, 0x77,
+    0xc0, 0x1f, 0xfe, 0x53, 0x7, 0x20, 0x1, 0x87,
+    0x85, 0x64, 0xc6, 0x83, 0x86, 0x23, 0xb9, 0x70,
+    0x40,
 
     /* U+004B "K" */
-    0x5f, 0x40, 0x0, 0x2, 0xeb, 0x5, 0xf4, 0x0,
-    0x1, 0xec, 0x0, 0x5f, 0x40, 0x1, 0xde, 0x10,
-    0x5, 0xf4, 0x0, 0xce, 0x20, 0x0, 0x5f, 0x40,
-    0xbf, 0x30, 0x0, 0x5, 0xf4, 0x9f, 0x90, 0x0,
-    0x0, 0x5f, 0xcf, 0xef, 0x40, 0x0, 0x5, 0xff,
-    0x91, 0xee, 0x10, 0x0, 0x5f, 0xa0, 0x3, 0xfc,
-    0x0, 0x5, 0xf4, 0x0, 0x6, 0xf8, 0x0, 0x5f,
-    0x40, 0x0, 0x9, 0xf5, 0x5, 0xf4, 0x0, 0x0,
-    0xc, 0xf2,
+    0x5f, 0x40, 0xc, 0x5d, 0x60, 0x1f, 0xe, 0x15,
+    0x80, 0x78, 0x70, 0x34, 0x3, 0xed, 0x3c, 0x10,
+    0xf, 0x59, 0xe9, 0x0, 0x7a, 0x51, 0x8c, 0x3,
+    0xd0, 0xc2, 0xc8, 0x1, 0xe3, 0x6f, 0x1a, 0x10,
+    0xe, 0x59, 0x1d, 0x1d, 0x0, 0xee, 0x0, 0x1c,
+    0x9c, 0x0, 0x7e, 0x66, 0x3a, 0x80, 0x7e, 0x93,
+    0xa2,
 
     /* U+004C "L" */
-    0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0, 0x0,
-    0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x97, 0x77,
-    0x77, 0x25, 0xff, 0xff, 0xff, 0xf5,
+    0x5f, 0x40, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xb,
+    0x5d, 0xf8, 0x80, 0xd, 0x11, 0xce,
 
     /* U+004D "M" */
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x1e, 0x95, 0xfc,
-    0x0, 0x0, 0x0, 0x8, 0xf9, 0x5f, 0xf5, 0x0,
-    0x0, 0x2, 0xff, 0x95, 0xfd, 0xe0, 0x0, 0x0,
-    0xae, 0xf9, 0x5f, 0x5f, 0x70, 0x0, 0x3f, 0x5f,
-    0x95, 0xf3, 0x8f, 0x10, 0xb, 0xc0, 0xf9, 0x5f,
-    0x31, 0xe9, 0x4, 0xf3, 0xf, 0x95, 0xf3, 0x7,
-    0xf2, 0xdb, 0x0, 0xf9, 0x5f, 0x30, 0xd, 0xef,
-    0x20, 0xf, 0x95, 0xf3, 0x0, 0x5f, 0x90, 0x0,
-    0xf9, 0x5f, 0x30, 0x0, 0x71, 0x0, 0xf, 0x95,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xf9,
+    0x5f, 0x40, 0xf, 0x87, 0xa4, 0x1, 0x0, 0x1f,
+    0x48, 0x80, 0x46, 0xa0, 0x1c, 0x4e, 0x1, 0x8a,
+    0xc0, 0x3a, 0x4, 0x3, 0x40, 0xb8, 0x4, 0x6b,
+    0x60, 0x19, 0x9e, 0x4, 0x1, 0x6, 0xa0, 0x1d,
+    0x23, 0x0, 0x88, 0xf0, 0xf, 0xc, 0xb1, 0x4a,
+    0x18, 0x7, 0xce, 0x58, 0x52, 0x1, 0xfd, 0x2,
+    0xc4, 0x1, 0xfc, 0xb1, 0x0, 0xf, 0xf9, 0xc4,
+    0x3, 0x80,
 
     /* U+004E "N" */
-    0x5f, 0x50, 0x0, 0x0, 0x4f, 0x55, 0xff, 0x20,
-    0x0, 0x4, 0xf5, 0x5f, 0xfd, 0x0, 0x0, 0x4f,
-    0x55, 0xfa, 0xf9, 0x0, 0x4, 0xf5, 0x5f, 0x4a,
-    0xf5, 0x0, 0x4f, 0x55, 0xf4, 0xd, 0xf2, 0x4,
-    0xf5, 0x5f, 0x40, 0x2f, 0xd0, 0x4f, 0x55, 0xf4,
-    0x0, 0x6f, 0x94, 0xf5, 0x5f, 0x40, 0x0, 0xaf,
-    0xaf, 0x55, 0xf4, 0x0, 0x0, 0xdf, 0xf5, 0x5f,
-    0x40, 0x0, 0x2, 0xff, 0x55, 0xf4, 0x0, 0x0,
-    0x6, 0xf5,
+    0x5f, 0x50, 0xe, 0x4f, 0x50, 0x5, 0x10, 0x7,
+    0xfb, 0xc0, 0x3f, 0x94, 0xa4, 0x3, 0xf7, 0x2b,
+    0x28, 0x7, 0xea, 0x2a, 0x20, 0xf, 0xde, 0x1e,
+    0x1, 0xf8, 0xa4, 0xa4, 0x3, 0xf3, 0x2b, 0x70,
+    0x7, 0xea, 0x25, 0x0, 0xfe, 0xf0, 0xf, 0xf1,
+    0x48, 0x0,
 
     /* U+004F "O" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x4,
-    0xff, 0xb8, 0x9e, 0xfa, 0x0, 0x2, 0xfd, 0x20,
-    0x0, 0x8, 0xf9, 0x0, 0xbf, 0x20, 0x0, 0x0,
-    0xa, 0xf2, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f,
-    0x72, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf9, 0x2f,
-    0x60, 0x0, 0x0, 0x0, 0xf, 0x90, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0xaf, 0x20, 0x2f, 0xd2, 0x0, 0x0, 0x8f,
-    0x90, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0, 0x0,
-    0x0, 0x28, 0xdf, 0xeb, 0x50, 0x0,
+    0x0, 0x86, 0x37, 0xfa, 0xd4, 0x3, 0x93, 0x9d,
+    0x9d, 0xcb, 0x54, 0x0, 0x8a, 0xcb, 0x6e, 0x27,
+    0x9d, 0x64, 0x1, 0x21, 0xe4, 0x1, 0xa1, 0x58,
+    0x81, 0x14, 0x80, 0x3d, 0x20, 0xa4, 0x18, 0x1,
+    0xf1, 0x87, 0x0, 0x7f, 0xf0, 0x48, 0x30, 0x3,
+    0xe3, 0xe, 0x4, 0x52, 0x0, 0xf4, 0x82, 0x84,
+    0x87, 0x90, 0x6, 0x85, 0x62, 0x2, 0xb2, 0xdb,
+    0x89, 0xe7, 0x59, 0x0, 0x93, 0x5d, 0x9d, 0xcb,
+    0x54, 0x0,
 
     /* U+0050 "P" */
-    0x5f, 0xff, 0xff, 0xd7, 0x0, 0x5f, 0x97, 0x78,
-    0xbf, 0xc0, 0x5f, 0x40, 0x0, 0x7, 0xf6, 0x5f,
-    0x40, 0x0, 0x0, 0xfa, 0x5f, 0x40, 0x0, 0x0,
-    0xfa, 0x5f, 0x40, 0x0, 0x3, 0xf8, 0x5f, 0x62,
-    0x23, 0x6e, 0xf1, 0x5f, 0xff, 0xff, 0xfd, 0x30,
-    0x5f, 0x85, 0x54, 0x20, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x0, 0x5f,
-    0x40, 0x0, 0x0, 0x0,
+    0x5f, 0xfe, 0xd7, 0x0, 0xcd, 0x10, 0x76, 0x8c,
+    0x0, 0xb5, 0xdd, 0x17, 0x6, 0xc0, 0x1f, 0x38,
+    0x60, 0x7, 0xff, 0x14, 0xc0, 0x80, 0x4, 0x51,
+    0xb6, 0x84, 0x80, 0x27, 0x75, 0x92, 0x78, 0x20,
+    0x7, 0xaa, 0x5e, 0xe8, 0xc0, 0x2c, 0x55, 0x21,
+    0x0, 0x7f, 0xf2, 0xc0,
 
     /* U+0051 "Q" */
-    0x0, 0x1, 0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x0,
-    0x4e, 0xfb, 0x89, 0xef, 0xa0, 0x0, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0xa, 0xf2, 0x0,
-    0x0, 0x0, 0xaf, 0x20, 0xf, 0xa0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x2f, 0x60, 0x0, 0x0, 0x0,
-    0xf, 0x90, 0x2f, 0x60, 0x0, 0x0, 0x0, 0xf,
-    0x90, 0x1f, 0x90, 0x0, 0x0, 0x0, 0x2f, 0x70,
-    0xb, 0xf1, 0x0, 0x0, 0x0, 0xaf, 0x20, 0x3,
-    0xfc, 0x10, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x6f,
-    0xfa, 0x78, 0xdf, 0xb0, 0x0, 0x0, 0x3, 0xae,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xd4, 0x15, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x1, 0x31,
-    0x0,
+    0x0, 0x86, 0x37, 0xfa, 0xd4, 0x3, 0xc9, 0xee,
+    0xce, 0xe5, 0xaa, 0x0, 0x62, 0xb3, 0xdb, 0x89,
+    0xe7, 0x59, 0x0, 0xa0, 0x3c, 0x80, 0x34, 0x2b,
+    0x10, 0x1, 0x54, 0x40, 0x1e, 0x90, 0x50, 0x20,
+    0xc0, 0xf, 0x8c, 0x38, 0x3, 0xff, 0x86, 0x61,
+    0xe0, 0x1f, 0x10, 0x70, 0xa, 0x30, 0x80, 0x7a,
+    0x1, 0x40, 0x10, 0x1a, 0x20, 0x19, 0xd5, 0x88,
+    0x0, 0x72, 0x7d, 0x4f, 0x1b, 0x9, 0x20, 0x19,
+    0xb1, 0x52, 0x1c, 0x6a, 0xc0, 0x3c, 0x75, 0xd8,
+    0x23, 0x96, 0xc0, 0x3e, 0x3c, 0x6b, 0xea, 0x30,
+    0xf, 0xc5, 0x7d, 0x9d, 0x0,
 
     /* U+0052 "R" */
-    0x5f, 0xff, 0xff, 0xd7, 0x0, 0x5f, 0x97, 0x78,
-    0xbf, 0xc0, 0x5f, 0x40, 0x0, 0x7, 0xf6, 0x5f,
-    0x40, 0x0, 0x0, 0xfa, 0x5f, 0x40, 0x0, 0x0,
-    0xfa, 0x5f, 0x40, 0x0, 0x3, 0xf8, 0x5f, 0x52,
-    0x23, 0x6e, 0xe1, 0x5f, 0xff, 0xff, 0xfc, 0x30,
-    0x5f, 0x85, 0x55, 0xf9, 0x0, 0x5f, 0x40, 0x0,
-    0x7f, 0x40, 0x5f, 0x40, 0x0, 0xc, 0xe0, 0x5f,
-    0x40, 0x0, 0x2, 0xf9,
+    0x5f, 0xfe, 0xd7, 0x0, 0xcd, 0x10, 0x76, 0x8c,
+    0x0, 0xb5, 0xdd, 0x17, 0x6, 0xc0, 0x1f, 0x38,
+    0x60, 0x7, 0xff, 0x14, 0xc0, 0x80, 0x2, 0x44,
+    0x36, 0xd1, 0x90, 0x5, 0x6e, 0xb2, 0x4b, 0x44,
+    0x0, 0xf5, 0x50, 0x29, 0x80, 0x58, 0xab, 0x43,
+    0x20, 0x7, 0xce, 0x74, 0x1, 0xfb, 0x86, 0x40,
 
     /* U+0053 "S" */
-    0x0, 0x5c, 0xef, 0xd9, 0x20, 0x7, 0xfc, 0x87,
-    0xaf, 0x90, 0xe, 0xc0, 0x0, 0x1, 0x10, 0xf,
-    0x80, 0x0, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xea, 0x50, 0x0, 0x0, 0x5,
-    0xae, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x4e, 0xf1,
-    0x0, 0x0, 0x0, 0x5, 0xf3, 0x8, 0x0, 0x0,
-    0x8, 0xf2, 0x2f, 0xfa, 0x77, 0xbf, 0xa0, 0x2,
-    0x9d, 0xff, 0xc7, 0x0,
+    0x0, 0x2e, 0x77, 0xec, 0x90, 0x1, 0xe8, 0x1a,
+    0x1d, 0xac, 0x1, 0x27, 0x90, 0xf5, 0xd0, 0x0,
+    0x14, 0x0, 0xc2, 0x20, 0x1, 0x3a, 0x80, 0x7d,
+    0xc3, 0x5d, 0x4a, 0x1, 0x8f, 0xa9, 0x11, 0x5c,
+    0x80, 0x19, 0x6b, 0xac, 0x2c, 0x40, 0x3c, 0x96,
+    0x4, 0x10, 0x1, 0xda, 0x2, 0x4f, 0xf4, 0xee,
+    0xb7, 0x52, 0x26, 0xb3, 0xc4, 0x1e, 0x28, 0x0,
 
     /* U+0054 "T" */
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x67, 0x78, 0xfb,
-    0x77, 0x72, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1,
-    0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7,
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0,
+    0xff, 0xfe, 0x59, 0x88, 0x38, 0x24, 0x44, 0xec,
+    0xee, 0x90, 0xc7, 0x78, 0x80, 0x3f, 0xff, 0xe0,
+    0x1f, 0xfc, 0x30,
 
     /* U+0055 "U" */
-    0x6f, 0x30, 0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0,
-    0x0, 0x8, 0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f,
-    0x16, 0xf3, 0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30,
-    0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8,
-    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f, 0x5, 0xf4,
-    0x0, 0x0, 0x9, 0xf0, 0x3f, 0x70, 0x0, 0x0,
-    0xcd, 0x0, 0xde, 0x20, 0x0, 0x5f, 0x80, 0x4,
-    0xff, 0xa8, 0xbf, 0xd0, 0x0, 0x3, 0xbe, 0xfd,
-    0x81, 0x0,
+    0x6f, 0x30, 0xe, 0x8f, 0x10, 0xf, 0xff, 0xa8,
+    0x98, 0x38, 0x7, 0x8, 0x1, 0x80, 0xc0, 0x39,
+    0x48, 0xc, 0xa4, 0x80, 0x25, 0x35, 0x0, 0x48,
+    0xed, 0x45, 0xd1, 0x40, 0x1, 0x31, 0x10, 0xec,
+    0xf8, 0x0,
 
     /* U+0056 "V" */
-    0xc, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0x30, 0x6f,
-    0x50, 0x0, 0x0, 0xc, 0xc0, 0x0, 0xfb, 0x0,
-    0x0, 0x3, 0xf6, 0x0, 0x9, 0xf2, 0x0, 0x0,
-    0xae, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x1f, 0x90,
-    0x0, 0x0, 0xce, 0x0, 0x7, 0xf2, 0x0, 0x0,
-    0x5, 0xf6, 0x0, 0xdb, 0x0, 0x0, 0x0, 0xe,
-    0xc0, 0x4f, 0x50, 0x0, 0x0, 0x0, 0x8f, 0x3b,
-    0xe0, 0x0, 0x0, 0x0, 0x2, 0xfb, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xb0, 0x0, 0x0,
+    0xc, 0xe0, 0xf, 0x9b, 0xcc, 0x28, 0x54, 0x3,
+    0xd4, 0x66, 0x6, 0xe, 0x0, 0xe3, 0x35, 0x0,
+    0x4c, 0x84, 0x1, 0xa4, 0x58, 0x2, 0xb0, 0xa0,
+    0x8, 0x55, 0xc0, 0x31, 0x1b, 0x0, 0x4c, 0x16,
+    0x1, 0xd2, 0x2c, 0x0, 0xa4, 0x20, 0xe, 0x51,
+    0xa0, 0x42, 0xe0, 0xf, 0x98, 0xcd, 0xe2, 0xa0,
+    0x1f, 0x50, 0x42, 0x30, 0x7, 0xe2, 0x44, 0x4,
+    0x80, 0x7f, 0x78, 0x20, 0x80, 0x60,
 
     /* U+0057 "W" */
-    0x5f, 0x40, 0x0, 0x0, 0xdf, 0x0, 0x0, 0x2,
-    0xf5, 0xf, 0x90, 0x0, 0x2, 0xff, 0x40, 0x0,
-    0x7, 0xf0, 0xb, 0xe0, 0x0, 0x7, 0xfe, 0x90,
-    0x0, 0xc, 0xb0, 0x6, 0xf3, 0x0, 0xc, 0xaa,
-    0xe0, 0x0, 0x1f, 0x60, 0x1, 0xf8, 0x0, 0x1f,
-    0x54, 0xf3, 0x0, 0x6f, 0x10, 0x0, 0xcd, 0x0,
-    0x7f, 0x10, 0xf8, 0x0, 0xcc, 0x0, 0x0, 0x7f,
-    0x20, 0xcb, 0x0, 0xad, 0x1, 0xf7, 0x0, 0x0,
-    0x2f, 0x71, 0xf6, 0x0, 0x5f, 0x26, 0xf2, 0x0,
-    0x0, 0xd, 0xc6, 0xf1, 0x0, 0xf, 0x7b, 0xd0,
-    0x0, 0x0, 0x8, 0xfd, 0xc0, 0x0, 0xb, 0xdf,
-    0x80, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0x6,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0,
-    0x1, 0xfe, 0x0, 0x0,
+    0x5f, 0x40, 0xe, 0xdf, 0x0, 0xe2, 0xf5, 0x50,
+    0x68, 0x6, 0x22, 0x2, 0x0, 0x65, 0x5, 0x4,
+    0x70, 0xc, 0xa0, 0x3a, 0x1, 0xad, 0x0, 0x1a,
+    0x26, 0x1, 0x5a, 0xa3, 0x80, 0x42, 0x7a, 0x0,
+    0x70, 0xb0, 0x0, 0x9f, 0xf0, 0x98, 0x1, 0xc1,
+    0xc0, 0x2, 0x6a, 0x0, 0x60, 0x44, 0x5, 0x80,
+    0x28, 0xc4, 0x2, 0xb2, 0x20, 0x5a, 0x8, 0x2a,
+    0x80, 0x4e, 0xc0, 0x32, 0x82, 0x89, 0xe8, 0x3,
+    0xc8, 0x8e, 0xa, 0x1, 0x88, 0x96, 0xe0, 0xe0,
+    0x5, 0x5, 0xd2, 0x20, 0x7, 0x29, 0xd9, 0x88,
+    0x4, 0x94, 0x8a, 0x1, 0xeb, 0x2, 0xb0, 0xd,
+    0xa4, 0x16, 0x1, 0xe3, 0x10, 0x50, 0xc, 0xe0,
+    0x26, 0x1,
 
     /* U+0058 "X" */
-    0x3f, 0x90, 0x0, 0x0, 0xcd, 0x0, 0x8f, 0x40,
-    0x0, 0x7f, 0x40, 0x0, 0xde, 0x10, 0x2f, 0x80,
-    0x0, 0x2, 0xfa, 0xc, 0xd0, 0x0, 0x0, 0x7,
-    0xfb, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0xbf, 0x7f, 0x70, 0x0, 0x0, 0x6f, 0x60, 0xaf,
-    0x20, 0x0, 0x2f, 0xb0, 0x1, 0xed, 0x0, 0xc,
-    0xf1, 0x0, 0x4, 0xf8, 0x7, 0xf6, 0x0, 0x0,
-    0x9, 0xf3,
+    0x3f, 0x90, 0xe, 0xcd, 0x3, 0x76, 0x40, 0x9,
+    0xce, 0x40, 0x10, 0x54, 0x20, 0x50, 0xe8, 0x1,
+    0x78, 0xd8, 0x71, 0x40, 0x6, 0x28, 0x5b, 0x3e,
+    0x0, 0xf3, 0x9a, 0x39, 0x80, 0x78, 0x48, 0x10,
+    0x3, 0xea, 0x18, 0x37, 0x0, 0xe6, 0x49, 0x75,
+    0x82, 0x0, 0x8a, 0x51, 0x82, 0xc7, 0xc0, 0x2e,
+    0xa, 0x0, 0xd, 0x14, 0x3, 0x9c, 0x88, 0x4,
+    0x8c, 0xe6,
 
     /* U+0059 "Y" */
-    0xc, 0xe0, 0x0, 0x0, 0x7, 0xf2, 0x3, 0xf7,
-    0x0, 0x0, 0x1f, 0x90, 0x0, 0xaf, 0x10, 0x0,
-    0x9e, 0x10, 0x0, 0x1f, 0xa0, 0x2, 0xf6, 0x0,
-    0x0, 0x8, 0xf3, 0xb, 0xd0, 0x0, 0x0, 0x0,
-    0xec, 0x4f, 0x40, 0x0, 0x0, 0x0, 0x5f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
+    0xc, 0xe0, 0xf, 0x3f, 0x90, 0x78, 0xb8, 0x6,
+    0x18, 0x62, 0x3, 0x58, 0x10, 0xa, 0x6, 0x0,
+    0x2b, 0xb, 0x0, 0x13, 0x40, 0x80, 0x42, 0xea,
+    0x61, 0x24, 0xc0, 0x1d, 0x3, 0xe8, 0x89, 0x0,
+    0xfa, 0xce, 0xd1, 0x0, 0x1f, 0x29, 0x84, 0x80,
+    0x7f, 0x28, 0x10, 0x7, 0xff, 0x70,
 
     /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0xfd, 0x1, 0x77, 0x77,
-    0x77, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x1e, 0xc0,
-    0x0, 0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0,
-    0x8, 0xf5, 0x0, 0x0, 0x0, 0x4, 0xf9, 0x0,
-    0x0, 0x0, 0x1, 0xec, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0x20, 0x0, 0x0, 0x0, 0x8f, 0x50, 0x0,
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0, 0x1e,
-    0xf8, 0x77, 0x77, 0x77, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xf0,
+    0x3f, 0xff, 0xda, 0x5, 0x11, 0xe4, 0x4, 0x1,
+    0x77, 0xe6, 0x53, 0x90, 0xf, 0xb4, 0x78, 0x3,
+    0xe8, 0x3a, 0x20, 0xf, 0x23, 0xb2, 0x80, 0x78,
+    0x68, 0xe4, 0x3, 0xed, 0x1e, 0x0, 0xfa, 0xe,
+    0x88, 0x3, 0xc8, 0xec, 0xa0, 0x1e, 0x1a, 0x1,
+    0x77, 0xf0, 0x20, 0x83, 0xc4, 0x78, 0x0,
 
     /* U+005B "[" */
-    0x5f, 0xff, 0x5, 0xf7, 0x50, 0x5f, 0x30, 0x5,
-    0xf3, 0x0, 0x5f, 0x30, 0x5, 0xf3, 0x0, 0x5f,
-    0x30, 0x5, 0xf3, 0x0, 0x5f, 0x30, 0x5, 0xf3,
-    0x0, 0x5f, 0x30, 0x5, 0xf3, 0x0, 0x5f, 0x30,
-    0x5, 0xf7, 0x50, 0x5f, 0xff, 0x0,
+    0x5f, 0xf8, 0x2, 0x8a, 0x0, 0x91, 0x40, 0x3f,
+    0xfd, 0x28, 0xa0, 0x14, 0x50, 0x0,
 
     /* U+005C "\\" */
-    0x7e, 0x0, 0x0, 0x0, 0x1f, 0x40, 0x0, 0x0,
-    0xc, 0x90, 0x0, 0x0, 0x7, 0xe0, 0x0, 0x0,
-    0x2, 0xf4, 0x0, 0x0, 0x0, 0xc9, 0x0, 0x0,
-    0x0, 0x7e, 0x0, 0x0, 0x0, 0x2f, 0x40, 0x0,
-    0x0, 0xc, 0x90, 0x0, 0x0, 0x7, 0xe0, 0x0,
-    0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0xd9, 0x0,
-    0x0, 0x0, 0x7e, 0x0, 0x0, 0x0, 0x2f, 0x30,
-    0x0, 0x0, 0xd, 0x90, 0x0, 0x0, 0x7, 0xe0,
+    0x7e, 0x0, 0xf3, 0xa, 0x0, 0x70, 0x9e, 0x80,
+    0x7a, 0xdc, 0x3, 0xca, 0x28, 0x1, 0xc4, 0x7a,
+    0x1, 0xeb, 0x70, 0xf, 0x28, 0xa0, 0x7, 0x11,
+    0xe8, 0x7, 0xad, 0xc0, 0x3c, 0xa2, 0x60, 0x1c,
+    0x44, 0xa0, 0xf, 0x53, 0x80, 0x79, 0x44, 0xc0,
+    0x38, 0x89, 0x40, 0x1e, 0xa7, 0x0,
 
     /* U+005D "]" */
-    0xbf, 0xfa, 0x35, 0xea, 0x0, 0xea, 0x0, 0xea,
-    0x0, 0xea, 0x0, 0xea, 0x0, 0xea, 0x0, 0xea,
-    0x0, 0xea, 0x0, 0xea, 0x0, 0xea, 0x0, 0xea,
-    0x0, 0xea, 0x35, 0xea, 0xbf, 0xfa,
+    0xbf, 0xf5, 0x45, 0x8, 0x1a, 0x80, 0x7f, 0xf7,
+    0x8d, 0x40, 0x11, 0x42, 0x0,
 
     /* U+005E "^" */
-    0x0, 0x2f, 0x80, 0x0, 0x0, 0x9d, 0xe0, 0x0,
-    0x0, 0xf3, 0xd5, 0x0, 0x6, 0xd0, 0x7b, 0x0,
-    0xc, 0x60, 0x1f, 0x20, 0x3f, 0x10, 0xb, 0x80,
-    0x9a, 0x0, 0x4, 0xe0,
+    0x0, 0x17, 0xc0, 0x7, 0x59, 0x30, 0x7, 0x37,
+    0x1a, 0x80, 0x4c, 0x47, 0x5c, 0x1, 0x55, 0x83,
+    0x21, 0x1, 0x99, 0xc0, 0x52, 0x82, 0x94, 0x40,
+    0x1e, 0xc0,
 
     /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0x11, 0x11, 0x11, 0x11,
+    0xff, 0xfd, 0xdd, 0xf8,
 
     /* U+0060 "`" */
-    0x7, 0xf6, 0x0, 0x3, 0xe7,
+    0x7, 0xf6, 0x0, 0x3e, 0x43, 0x80,
 
     /* U+0061 "a" */
-    0x1, 0x9e, 0xfd, 0x80, 0x0, 0xce, 0x87, 0xaf,
-    0x90, 0x2, 0x0, 0x0, 0xaf, 0x0, 0x0, 0x0,
-    0x6, 0xf2, 0x2, 0xbe, 0xff, 0xff, 0x20, 0xec,
-    0x42, 0x27, 0xf2, 0x2f, 0x50, 0x0, 0x7f, 0x20,
-    0xec, 0x42, 0x7f, 0xf2, 0x2, 0xbf, 0xfb, 0x6f,
-    0x20,
+    0x1, 0x9e, 0xfd, 0x80, 0xb, 0x5d, 0xa1, 0xdd,
+    0x20, 0xe, 0xe4, 0x3d, 0x2b, 0x0, 0x8, 0x3,
+    0x60, 0x10, 0x15, 0xf7, 0xfa, 0x40, 0x2c, 0x7a,
+    0xdd, 0x40, 0x0, 0x86, 0x50, 0x88, 0x1, 0x10,
+    0xca, 0x13, 0xc0, 0x5, 0x8f, 0x7b, 0x92, 0x0,
 
     /* U+0062 "b" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x2b, 0xfe, 0xb3, 0x0, 0x8f, 0xec, 0x78, 0xef,
-    0x30, 0x8f, 0xa0, 0x0, 0x1e, 0xc0, 0x8f, 0x20,
-    0x0, 0x7, 0xf1, 0x8f, 0x0, 0x0, 0x5, 0xf3,
-    0x8f, 0x20, 0x0, 0x7, 0xf1, 0x8f, 0xa0, 0x0,
-    0x1e, 0xd0, 0x8f, 0xec, 0x78, 0xef, 0x30, 0x8e,
-    0x2b, 0xfe, 0xb3, 0x0,
+    0x8f, 0x0, 0xff, 0xe9, 0x15, 0xff, 0x59, 0x80,
+    0x6c, 0x78, 0x65, 0xc3, 0x0, 0x93, 0x1e, 0x3c,
+    0x7c, 0x2, 0x80, 0x8, 0x64, 0xc4, 0x0, 0x40,
+    0x18, 0x80, 0x80, 0x4, 0x1, 0x88, 0x8, 0x1,
+    0x0, 0x10, 0xc9, 0x8, 0x1, 0x31, 0xe3, 0xc7,
+    0x80, 0x3, 0x8f, 0xc, 0xb8, 0x60,
 
     /* U+0063 "c" */
-    0x0, 0x3a, 0xef, 0xc4, 0x0, 0x4f, 0xd8, 0x7c,
-    0xf4, 0xd, 0xd0, 0x0, 0x7, 0x13, 0xf6, 0x0,
-    0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x6, 0x10,
-    0x4f, 0xd7, 0x7c, 0xf4, 0x0, 0x3a, 0xef, 0xc4,
-    0x0,
+    0x0, 0x1d, 0x77, 0xe2, 0x0, 0x13, 0x1d, 0xa0,
+    0x2d, 0x2, 0x4b, 0x61, 0xf2, 0x14, 0xca, 0xc0,
+    0x33, 0x8b, 0x82, 0x80, 0x79, 0xc1, 0x40, 0x3c,
+    0x65, 0x60, 0x19, 0x84, 0x24, 0xb5, 0xdd, 0x92,
+    0xa0, 0x98, 0xf3, 0x1, 0x68,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x1, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x3b, 0xff, 0xa3, 0xf7, 0x4, 0xfd, 0x87, 0xce,
-    0xf7, 0xe, 0xd0, 0x0, 0xb, 0xf7, 0x3f, 0x60,
-    0x0, 0x3, 0xf7, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x50, 0x0, 0x3, 0xf7, 0xe, 0xc0, 0x0,
-    0xa, 0xf7, 0x4, 0xfc, 0x65, 0xbe, 0xf7, 0x0,
-    0x3b, 0xff, 0xb2, 0xf7,
+    0x0, 0xf8, 0x7d, 0xc0, 0x3f, 0xf9, 0x47, 0x7f,
+    0xea, 0x20, 0x9, 0x31, 0x9e, 0x1b, 0x40, 0x2a,
+    0x2d, 0x87, 0xc5, 0x0, 0x18, 0xd8, 0x6, 0x80,
+    0x3, 0x82, 0x80, 0x62, 0x0, 0x38, 0x30, 0x6,
+    0x20, 0x1, 0x8c, 0x80, 0x69, 0x0, 0xa8, 0xf1,
+    0x96, 0xd0, 0x2, 0x4c, 0x79, 0xa0, 0xc0, 0x0,
 
     /* U+0065 "e" */
-    0x0, 0x3b, 0xfe, 0xa2, 0x0, 0x4, 0xfc, 0x67,
-    0xee, 0x20, 0xe, 0xc0, 0x0, 0x1e, 0xa0, 0x3f,
-    0x50, 0x0, 0x7, 0xf0, 0x4f, 0xff, 0xff, 0xff,
-    0xf1, 0x3f, 0x72, 0x22, 0x22, 0x20, 0xe, 0xc0,
-    0x0, 0x2, 0x0, 0x4, 0xfd, 0x87, 0xaf, 0x50,
-    0x0, 0x3a, 0xef, 0xd6, 0x0,
+    0x0, 0x1d, 0xff, 0x51, 0x0, 0x49, 0x8f, 0x32,
+    0x4c, 0x20, 0x5, 0x1e, 0x33, 0xf8, 0x40, 0x18,
+    0xc8, 0x4, 0x32, 0xa0, 0xe1, 0x5f, 0xfa, 0x0,
+    0x5c, 0x23, 0x77, 0xc2, 0x63, 0x64, 0x58, 0x8,
+    0x1, 0x47, 0xb0, 0xf5, 0xaa, 0x0, 0x4c, 0x76,
+    0x87, 0x95, 0x0,
 
     /* U+0066 "f" */
-    0x0, 0x5d, 0xfc, 0x0, 0x2f, 0xb5, 0x70, 0x4,
-    0xf3, 0x0, 0xc, 0xff, 0xff, 0xa0, 0x48, 0xf7,
-    0x53, 0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0,
-    0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0, 0x0, 0x5f,
-    0x30, 0x0,
+    0x0, 0x2e, 0xfe, 0x0, 0xa, 0x9a, 0xac, 0x0,
+    0xc1, 0xa, 0xe1, 0x96, 0x19, 0xf4, 0x10, 0xe1,
+    0x15, 0x20, 0x9a, 0x8, 0xa6, 0x1, 0xff, 0xdf,
 
     /* U+0067 "g" */
-    0x0, 0x3b, 0xff, 0xb2, 0xe9, 0x4, 0xfe, 0x87,
-    0xcf, 0xf9, 0xe, 0xd1, 0x0, 0xa, 0xf9, 0x3f,
-    0x60, 0x0, 0x1, 0xf9, 0x4f, 0x40, 0x0, 0x0,
-    0xf9, 0x3f, 0x60, 0x0, 0x1, 0xf9, 0xe, 0xd0,
-    0x0, 0x9, 0xf9, 0x4, 0xfd, 0x87, 0xcf, 0xf8,
-    0x0, 0x3b, 0xff, 0xb3, 0xf7, 0x0, 0x0, 0x0,
-    0x5, 0xf4, 0x9, 0xe9, 0x77, 0xaf, 0xb0, 0x1,
-    0x7c, 0xff, 0xd8, 0x0,
+    0x0, 0x1d, 0xff, 0xac, 0xba, 0x41, 0x31, 0x5e,
+    0x1f, 0x44, 0x1, 0x45, 0xf0, 0xf8, 0xa0, 0x3,
+    0x1b, 0x10, 0xa, 0xc0, 0xe, 0x4, 0x1, 0x84,
+    0x0, 0xe0, 0x40, 0x18, 0x40, 0x6, 0x36, 0x1,
+    0xa0, 0x2, 0xa2, 0xd8, 0x7c, 0x60, 0x10, 0x4c,
+    0x67, 0x87, 0xc0, 0xf0, 0x1, 0xdf, 0xfa, 0xd8,
+    0xc, 0x27, 0xa5, 0xdd, 0x54, 0x44, 0x4, 0x4a,
+    0xc4, 0x1d, 0xd6, 0x0,
 
     /* U+0068 "h" */
-    0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf2, 0xbf,
-    0xea, 0x10, 0x8f, 0xfb, 0x89, 0xfd, 0x8, 0xf8,
-    0x0, 0x6, 0xf4, 0x8f, 0x10, 0x0, 0x1f, 0x78,
-    0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf,
-    0x88, 0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0,
-    0xf, 0x88, 0xf0, 0x0, 0x0, 0xf8,
+    0x8f, 0x0, 0xff, 0xe7, 0x95, 0xff, 0x50, 0x80,
+    0x5a, 0xe, 0xe5, 0xc0, 0x9, 0xee, 0x26, 0x44,
+    0x80, 0x9, 0x0, 0x9c, 0xc, 0x0, 0x20, 0x10,
+    0x87, 0x80, 0x7f, 0xf6, 0x0,
 
     /* U+0069 "i" */
-    0x9e, 0x1a, 0xf2, 0x0, 0x8, 0xf0, 0x8f, 0x8,
-    0xf0, 0x8f, 0x8, 0xf0, 0x8f, 0x8, 0xf0, 0x8f,
-    0x8, 0xf0,
+    0x9e, 0x13, 0x13, 0xaf, 0x28, 0xf0, 0xf, 0xfe,
+    0x68,
 
     /* U+006A "j" */
-    0x0, 0x7, 0xe2, 0x0, 0x9, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0,
-    0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1,
-    0x0, 0x7, 0xf1, 0x0, 0x7, 0xf1, 0x0, 0x7,
-    0xf1, 0x0, 0x7, 0xf1, 0x0, 0x8, 0xf0, 0x18,
-    0x6e, 0xc0, 0x3e, 0xfc, 0x20,
+    0x0, 0x9f, 0x88, 0x2, 0xe1, 0x10, 0x5, 0x3e,
+    0x60, 0x13, 0xf8, 0x80, 0x7f, 0xf9, 0xfc, 0x4,
+    0x50, 0xcc, 0x30, 0x26, 0x92, 0xe0,
 
     /* U+006B "k" */
-    0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
-    0x1d, 0xe1, 0x8f, 0x0, 0x1d, 0xe2, 0x8, 0xf0,
-    0x1d, 0xe2, 0x0, 0x8f, 0x2d, 0xf3, 0x0, 0x8,
-    0xfe, 0xff, 0x70, 0x0, 0x8f, 0xe2, 0xbf, 0x30,
-    0x8, 0xf2, 0x1, 0xee, 0x10, 0x8f, 0x0, 0x3,
-    0xfb, 0x8, 0xf0, 0x0, 0x7, 0xf7,
+    0x8f, 0x0, 0xff, 0xe9, 0xe, 0xf0, 0x80, 0x61,
+    0xc3, 0xc1, 0x0, 0x87, 0xf, 0x8, 0x2, 0x2c,
+    0x2d, 0x20, 0xd, 0x84, 0x8, 0x1, 0xed, 0x48,
+    0x30, 0xd, 0x85, 0x43, 0xa2, 0x1, 0x10, 0xe,
+    0x8d, 0x0, 0x78, 0xe1, 0x1c,
 
     /* U+006C "l" */
-    0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-    0x8f, 0x8f, 0x8f, 0x8f,
+    0x8f, 0x0, 0xff, 0xe5, 0x0,
 
     /* U+006D "m" */
-    0x8e, 0x3c, 0xfe, 0x91, 0x3b, 0xfe, 0xa2, 0x8,
-    0xff, 0x96, 0x9f, 0xcf, 0xc6, 0x8f, 0xd0, 0x8f,
-    0x70, 0x0, 0x9f, 0xc0, 0x0, 0x5f, 0x58, 0xf1,
-    0x0, 0x5, 0xf6, 0x0, 0x1, 0xf7, 0x8f, 0x0,
-    0x0, 0x4f, 0x40, 0x0, 0xf, 0x88, 0xf0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0,
-    0x4f, 0x40, 0x0, 0xf, 0x88, 0xf0, 0x0, 0x4,
-    0xf4, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0x4f,
-    0x40, 0x0, 0xf, 0x80,
+    0x8e, 0x3c, 0xfe, 0x91, 0x3b, 0xfe, 0xa2, 0x0,
+    0xe, 0x2c, 0xbb, 0x6e, 0x3c, 0xb2, 0xf8, 0x5,
+    0x12, 0xd2, 0xc6, 0x6c, 0x68, 0xa2, 0x50, 0x3,
+    0x0, 0x58, 0x14, 0x1, 0x20, 0x10, 0x0, 0x40,
+    0x21, 0x2, 0x0, 0x84, 0x3c, 0x3, 0xff, 0xe0,
 
     /* U+006E "n" */
-    0x8e, 0x3b, 0xfe, 0xa1, 0x8, 0xff, 0xa6, 0x8f,
-    0xd0, 0x8f, 0x80, 0x0, 0x6f, 0x48, 0xf1, 0x0,
-    0x1, 0xf7, 0x8f, 0x0, 0x0, 0xf, 0x88, 0xf0,
-    0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf, 0x88,
-    0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf,
-    0x80,
+    0x8e, 0x3b, 0xfe, 0xa1, 0x0, 0xe, 0xc, 0xb2,
+    0xe0, 0x4, 0xf4, 0xd1, 0x24, 0x80, 0x9, 0x0,
+    0x9c, 0xc, 0x0, 0x20, 0x10, 0x87, 0x80, 0x7f,
+    0xf6, 0x0,
 
     /* U+006F "o" */
-    0x0, 0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87,
-    0xcf, 0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f,
-    0x60, 0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1,
-    0xf7, 0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0,
-    0x0, 0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60,
-    0x0, 0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0x1d, 0xf7, 0xe2, 0x0, 0x49, 0x8c, 0xc8,
+    0xb, 0x60, 0x5, 0x16, 0xc3, 0xe2, 0x48, 0x98,
+    0xd8, 0x6, 0x80, 0x47, 0x5, 0x0, 0xc4, 0x4,
+    0xe0, 0xa0, 0x18, 0x80, 0x8c, 0x6c, 0x3, 0x40,
+    0x20, 0x51, 0x6b, 0xbb, 0x12, 0x44, 0x13, 0x1a,
+    0x60, 0x2d, 0x80,
 
     /* U+0070 "p" */
-    0x8e, 0x3b, 0xfe, 0xb3, 0x0, 0x8f, 0xfb, 0x57,
-    0xdf, 0x30, 0x8f, 0x90, 0x0, 0xd, 0xc0, 0x8f,
-    0x10, 0x0, 0x7, 0xf1, 0x8f, 0x0, 0x0, 0x5,
-    0xf3, 0x8f, 0x20, 0x0, 0x7, 0xf1, 0x8f, 0xa0,
-    0x0, 0x1e, 0xd0, 0x8f, 0xec, 0x78, 0xef, 0x30,
-    0x8f, 0x2b, 0xfe, 0xb3, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x0, 0x0,
+    0x8e, 0x3b, 0xfe, 0xb3, 0x0, 0x87, 0x2, 0xa5,
+    0xb0, 0xc0, 0x26, 0xb5, 0x7d, 0x2f, 0x0, 0xa0,
+    0x3, 0x51, 0x88, 0x0, 0x40, 0x31, 0x1, 0x0,
+    0x8, 0x3, 0x10, 0x10, 0x2, 0x0, 0x21, 0x92,
+    0x10, 0x2, 0x63, 0xc7, 0x8f, 0x0, 0x58, 0xf0,
+    0xcb, 0x86, 0x1, 0x15, 0xff, 0x59, 0x80, 0x7f,
+    0xf2, 0x80,
 
     /* U+0071 "q" */
-    0x0, 0x3b, 0xff, 0xa2, 0xf7, 0x4, 0xfd, 0x87,
-    0xde, 0xf7, 0xe, 0xd0, 0x0, 0xb, 0xf7, 0x3f,
-    0x60, 0x0, 0x3, 0xf7, 0x4f, 0x30, 0x0, 0x1,
-    0xf7, 0x3f, 0x60, 0x0, 0x3, 0xf7, 0xe, 0xd0,
-    0x0, 0xb, 0xf7, 0x4, 0xfd, 0x77, 0xce, 0xf7,
-    0x0, 0x3b, 0xff, 0xa3, 0xf7, 0x0, 0x0, 0x0,
-    0x1, 0xf7, 0x0, 0x0, 0x0, 0x1, 0xf7, 0x0,
-    0x0, 0x0, 0x1, 0xf7,
+    0x0, 0x1d, 0xff, 0xa8, 0xbd, 0xc1, 0x31, 0x9e,
+    0x1f, 0x0, 0x2a, 0x2d, 0x87, 0xd5, 0x0, 0x18,
+    0xd8, 0x6, 0x80, 0x3, 0x82, 0x80, 0x62, 0x0,
+    0x38, 0x28, 0x6, 0x20, 0x1, 0x8d, 0x80, 0x68,
+    0x0, 0xa8, 0xb5, 0xdd, 0x8a, 0x1, 0x26, 0x34,
+    0x41, 0xb4, 0x3, 0x1d, 0xff, 0xa8, 0x80, 0x3f,
+    0xf9, 0x40,
 
     /* U+0072 "r" */
-    0x8e, 0x2b, 0xf0, 0x8f, 0xed, 0x90, 0x8f, 0xa0,
-    0x0, 0x8f, 0x20, 0x0, 0x8f, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x8f, 0x0, 0x0,
+    0x8e, 0x2b, 0xf0, 0x0, 0xe3, 0x30, 0x2, 0x4d,
+    0x90, 0xa, 0x0, 0x38, 0x80, 0x3f, 0xf9, 0xe0,
 
     /* U+0073 "s" */
-    0x2, 0xae, 0xfd, 0x91, 0x1e, 0xd7, 0x69, 0xd0,
-    0x4f, 0x30, 0x0, 0x0, 0x2f, 0xb4, 0x10, 0x0,
-    0x6, 0xef, 0xfd, 0x60, 0x0, 0x1, 0x5b, 0xf5,
-    0x1, 0x0, 0x0, 0xf7, 0x5f, 0xa7, 0x6b, 0xf3,
-    0x19, 0xdf, 0xec, 0x40,
+    0x2, 0xae, 0xfd, 0x91, 0x16, 0x3c, 0xc9, 0x10,
+    0x2a, 0x3c, 0xed, 0x3a, 0xc, 0x10, 0x82, 0x1,
+    0x14, 0xad, 0xf6, 0xb0, 0x1, 0xbb, 0x94, 0xd2,
+    0xa0, 0x20, 0x2b, 0x60, 0x4b, 0xd4, 0xed, 0x60,
+    0x88, 0x67, 0x88, 0x3d, 0x98,
 
     /* U+0074 "t" */
-    0x5, 0xf3, 0x0, 0x0, 0x5f, 0x30, 0x0, 0xcf,
-    0xff, 0xfa, 0x4, 0x8f, 0x75, 0x30, 0x5, 0xf3,
-    0x0, 0x0, 0x5f, 0x30, 0x0, 0x5, 0xf3, 0x0,
-    0x0, 0x5f, 0x30, 0x0, 0x4, 0xf4, 0x0, 0x0,
-    0x1f, 0xc6, 0x80, 0x0, 0x5d, 0xfc, 0x10,
+    0x5, 0xf3, 0x0, 0xff, 0x65, 0x6, 0x7d, 0x4,
+    0x38, 0x45, 0x48, 0x26, 0x82, 0x29, 0x80, 0x7f,
+    0xf2, 0xc4, 0x1c, 0x3, 0x28, 0x43, 0x40, 0x0,
+    0x68, 0x65, 0x4,
 
     /* U+0075 "u" */
-    0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0, 0x0, 0x2,
-    0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0, 0x0,
-    0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x59, 0xf0,
-    0x0, 0x4, 0xf5, 0x6f, 0x30, 0x0, 0xaf, 0x50,
-    0xee, 0x76, 0xbf, 0xf5, 0x2, 0xbe, 0xfb, 0x3f,
-    0x50,
+    0xae, 0x0, 0xc5, 0xea, 0x1, 0xff, 0xd8, 0x31,
+    0x0, 0xcc, 0x0, 0xf0, 0x30, 0xb, 0x80, 0xc,
+    0x3a, 0xed, 0x6a, 0x1, 0x62, 0xcc, 0x83, 0x0,
+    0x0,
 
     /* U+0076 "v" */
-    0xd, 0xc0, 0x0, 0x0, 0xcb, 0x6, 0xf2, 0x0,
-    0x2, 0xf5, 0x0, 0xf9, 0x0, 0x9, 0xe0, 0x0,
-    0x9e, 0x0, 0xf, 0x80, 0x0, 0x2f, 0x60, 0x6f,
-    0x10, 0x0, 0xc, 0xc0, 0xcb, 0x0, 0x0, 0x5,
-    0xf6, 0xf4, 0x0, 0x0, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0,
+    0xd, 0xc0, 0xe, 0xcb, 0xb, 0x32, 0x0, 0x88,
+    0xf8, 0x18, 0x2c, 0x2, 0xb1, 0x50, 0x3, 0x38,
+    0x4, 0xcc, 0x0, 0xac, 0x58, 0x18, 0x24, 0x2,
+    0x23, 0xa0, 0xa4, 0x10, 0xd, 0x26, 0xc7, 0xe0,
+    0x1c, 0xa3, 0x24, 0x80, 0x1e, 0x60, 0xa0, 0x8,
 
     /* U+0077 "w" */
-    0xbb, 0x0, 0x0, 0x9f, 0x10, 0x0, 0x4f, 0x16,
-    0xf1, 0x0, 0xe, 0xf6, 0x0, 0x9, 0xc0, 0xf,
-    0x60, 0x5, 0xfc, 0xb0, 0x0, 0xf6, 0x0, 0xac,
-    0x0, 0xab, 0x5f, 0x10, 0x5f, 0x10, 0x5, 0xf1,
-    0xf, 0x50, 0xe7, 0xa, 0xb0, 0x0, 0xf, 0x76,
-    0xf0, 0x9, 0xc0, 0xf5, 0x0, 0x0, 0xac, 0xba,
-    0x0, 0x4f, 0x8f, 0x0, 0x0, 0x4, 0xff, 0x40,
-    0x0, 0xef, 0xa0, 0x0, 0x0, 0xe, 0xe0, 0x0,
-    0x8, 0xf4, 0x0, 0x0,
+    0xbb, 0x0, 0x69, 0xf1, 0x0, 0x93, 0xc7, 0x50,
+    0x40, 0x27, 0x7, 0x0, 0xb4, 0xc5, 0x81, 0xc0,
+    0xa, 0x27, 0xa0, 0x13, 0x50, 0x1, 0x68, 0x1,
+    0xe9, 0x28, 0x20, 0xa0, 0xe0, 0xf, 0x31, 0x5,
+    0xe5, 0x16, 0xf, 0x41, 0x0, 0x28, 0x33, 0x1,
+    0x41, 0xec, 0x17, 0x80, 0x32, 0xde, 0xa8, 0x3,
+    0x4e, 0x1, 0x40, 0x37, 0x1a, 0x70, 0x1, 0x5,
+    0xd4, 0x3, 0x90, 0x44, 0x80, 0x13, 0x7, 0x0,
+    0x40,
 
     /* U+0078 "x" */
-    0x4f, 0x70, 0x0, 0x9f, 0x20, 0x8f, 0x30, 0x5f,
-    0x50, 0x0, 0xcd, 0x2e, 0x90, 0x0, 0x2, 0xff,
-    0xd0, 0x0, 0x0, 0xa, 0xf6, 0x0, 0x0, 0x4,
-    0xfd, 0xe1, 0x0, 0x1, 0xeb, 0xd, 0xc0, 0x0,
-    0xbe, 0x10, 0x3f, 0x80, 0x6f, 0x40, 0x0, 0x7f,
-    0x40,
+    0x4f, 0x70, 0xa, 0x7c, 0x91, 0xe0, 0xc1, 0x5a,
+    0x88, 0x20, 0xf8, 0xad, 0x94, 0x2, 0xe2, 0xd3,
+    0x90, 0xc, 0x4a, 0x16, 0x1, 0xc8, 0xa5, 0x2,
+    0x1, 0xd, 0x26, 0x9e, 0x80, 0x54, 0x14, 0x1c,
+    0x70, 0xc, 0x94, 0x20, 0x70, 0xe8,
 
     /* U+0079 "y" */
-    0xd, 0xc0, 0x0, 0x0, 0xcb, 0x6, 0xf3, 0x0,
-    0x2, 0xf4, 0x0, 0xea, 0x0, 0x9, 0xd0, 0x0,
-    0x8f, 0x10, 0xf, 0x70, 0x0, 0x1f, 0x70, 0x7f,
-    0x10, 0x0, 0xa, 0xe0, 0xd9, 0x0, 0x0, 0x3,
-    0xf9, 0xf2, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0,
-    0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0xad,
-    0x0, 0x0, 0x1c, 0x79, 0xf5, 0x0, 0x0, 0x1a,
-    0xee, 0x70, 0x0, 0x0,
+    0xd, 0xc0, 0xe, 0xcb, 0xb, 0x33, 0x0, 0x44,
+    0x7e, 0xc, 0x32, 0x1, 0x59, 0x20, 0x1, 0x94,
+    0x40, 0xd, 0x40, 0x14, 0x83, 0x3, 0x83, 0x0,
+    0x42, 0xb2, 0x14, 0xc2, 0x1, 0xa4, 0x64, 0xac,
+    0x3, 0x8c, 0xcc, 0x84, 0x1, 0xea, 0xf, 0x0,
+    0xfb, 0x9, 0x0, 0x21, 0xc7, 0x95, 0x80, 0xe,
+    0x69, 0x78, 0x50, 0xc,
 
     /* U+007A "z" */
-    0x4f, 0xff, 0xff, 0xf9, 0x15, 0x55, 0x5b, 0xf4,
-    0x0, 0x0, 0x4f, 0x80, 0x0, 0x1, 0xec, 0x0,
-    0x0, 0xb, 0xe1, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x4, 0xf7, 0x0, 0x0, 0x1e, 0xe5, 0x55, 0x53,
-    0x5f, 0xff, 0xff, 0xfc,
+    0x4f, 0xff, 0x4a, 0xd5, 0x64, 0xd, 0x15, 0x58,
+    0x51, 0xd0, 0x2, 0x1a, 0x38, 0x0, 0xd4, 0x1a,
+    0x1, 0xa1, 0x28, 0x40, 0x24, 0x78, 0x40, 0x8,
+    0x68, 0x49, 0x56, 0x34, 0x11, 0x55, 0x6f,
 
     /* U+007B "{" */
-    0x0, 0x2c, 0xf5, 0x0, 0xaf, 0x61, 0x0, 0xcc,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb, 0x0, 0x0,
-    0xdb, 0x0, 0x2, 0xea, 0x0, 0x1f, 0xf4, 0x0,
-    0x5, 0xfa, 0x0, 0x0, 0xdb, 0x0, 0x0, 0xdb,
-    0x0, 0x0, 0xdb, 0x0, 0x0, 0xcc, 0x0, 0x0,
-    0xaf, 0x61, 0x0, 0x2c, 0xf5,
+    0x0, 0x16, 0x7a, 0x80, 0x20, 0xe5, 0x0, 0xc,
+    0x6c, 0x20, 0x1, 0x70, 0xf, 0xfe, 0x19, 0x18,
+    0x80, 0x7, 0x47, 0x80, 0x3, 0x41, 0xc0, 0x12,
+    0x90, 0x80, 0x7f, 0xf1, 0x5, 0xc0, 0x33, 0x1b,
+    0x8, 0x2, 0xe, 0x50,
 
     /* U+007C "|" */
-    0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15,
-    0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f,
-    0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x10,
+    0x5f, 0x10, 0xf, 0xfe, 0xf0,
 
     /* U+007D "}" */
-    0xbe, 0x80, 0x3, 0xaf, 0x40, 0x1, 0xf6, 0x0,
-    0x1f, 0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70, 0x0,
-    0xf9, 0x0, 0xa, 0xfb, 0x0, 0xfb, 0x20, 0x1f,
-    0x70, 0x1, 0xf7, 0x0, 0x1f, 0x70, 0x1, 0xf6,
-    0x3, 0xaf, 0x40, 0xbe, 0x90, 0x0,
+    0xbe, 0x80, 0x4, 0x23, 0xa0, 0x1d, 0x81, 0x0,
+    0x61, 0x0, 0xff, 0xc2, 0x1c, 0x1, 0x2b, 0x58,
+    0x1, 0x52, 0x40, 0x43, 0x8, 0x3, 0xff, 0x82,
+    0x20, 0x76, 0x4, 0x10, 0x8c, 0x80,
 
     /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xe4, 0x0,
-    0xb5, 0xc, 0x86, 0xf5, 0x1e, 0x20, 0xf0, 0x3,
-    0xef, 0x90, 0x2, 0x0, 0x0, 0x10, 0x0,
+    0x0, 0xff, 0x1e, 0xf2, 0x0, 0x2d, 0x43, 0xd6,
+    0x2d, 0x45, 0x5c, 0xe, 0x1b, 0x2f, 0x9c, 0x83,
+    0x40, 0x7, 0xdc, 0x90,
 
     /* U+00A0 " " */
 
     /* U+00A1 "¡" */
-    0xad, 0xb, 0xf1, 0x1, 0x0, 0x0, 0x7c, 0x8,
-    0xc0, 0x8d, 0x9, 0xe0, 0xae, 0xa, 0xf0, 0xbf,
-    0x9, 0xc0,
+    0xad, 0x1, 0x21, 0xbe, 0x10, 0x10, 0x7c, 0xf,
+    0x0, 0x84, 0x4, 0xc0, 0xc0, 0x21, 0x1, 0x0,
+    0x11, 0x80,
 
     /* U+00A2 "¢" */
-    0x0, 0x0, 0x78, 0x0, 0x0, 0x0, 0x7, 0x80,
-    0x0, 0x0, 0x3b, 0xff, 0xc4, 0x0, 0x4f, 0xec,
-    0xcc, 0xf5, 0xd, 0xd1, 0x78, 0x7, 0x3, 0xf6,
-    0x7, 0x80, 0x0, 0x4f, 0x40, 0x78, 0x0, 0x3,
-    0xf5, 0x7, 0x80, 0x0, 0xe, 0xc0, 0x78, 0x6,
-    0x0, 0x4f, 0xdb, 0xbb, 0xf5, 0x0, 0x4c, 0xff,
-    0xd5, 0x0, 0x0, 0x7, 0x80, 0x0, 0x0, 0x0,
-    0x78, 0x0, 0x0,
+    0x0, 0xcf, 0x0, 0x1f, 0xfc, 0x23, 0xb8, 0x7c,
+    0x40, 0x2, 0x62, 0x99, 0x82, 0xd4, 0x24, 0xbe,
+    0xd3, 0x21, 0x4c, 0xac, 0x40, 0x27, 0x7, 0x2,
+    0x0, 0xf3, 0x80, 0x80, 0x78, 0xc6, 0x40, 0x33,
+    0x0, 0x28, 0xf7, 0xe, 0xe5, 0x41, 0x2c, 0x51,
+    0xd, 0x4a, 0x0, 0x4c, 0x87, 0xd5, 0x0, 0xff,
 
     /* U+00A3 "£" */
-    0x0, 0x0, 0x6c, 0xfe, 0xc6, 0x0, 0x0, 0xaf,
-    0xc8, 0x9c, 0xd0, 0x0, 0x4f, 0x80, 0x0, 0x2,
-    0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xbd,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xd0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x1, 0x2c,
-    0xd2, 0x22, 0x20, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xd0, 0x0, 0x0, 0x0, 0x37,
-    0xee, 0x77, 0x77, 0x76, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xd0,
+    0x0, 0xcd, 0x9f, 0xd8, 0xc0, 0x1a, 0xa4, 0x1d,
+    0xc1, 0x60, 0x12, 0x2b, 0xe4, 0x4e, 0x78, 0x5,
+    0xa1, 0x0, 0x18, 0x80, 0x22, 0x20, 0x7, 0xf3,
+    0x80, 0x7e, 0x7f, 0x32, 0xff, 0xc0, 0x13, 0x69,
+    0x96, 0xee, 0x0, 0x84, 0x80, 0x4, 0x58, 0x3,
+    0xff, 0x84, 0x6e, 0x46, 0xef, 0xcc, 0x17, 0x2,
+    0x28, 0x8e, 0xb0,
 
     /* U+00A4 "¤" */
-    0x1a, 0x0, 0x0, 0x0, 0x9, 0x32, 0xeb, 0x7d,
-    0xfe, 0x89, 0xf4, 0x3, 0xff, 0x84, 0x6e, 0xf5,
-    0x0, 0x3f, 0x40, 0x0, 0x1e, 0x70, 0x9, 0xb0,
-    0x0, 0x0, 0x7c, 0x0, 0xb8, 0x0, 0x0, 0x5,
-    0xe0, 0x9, 0xa0, 0x0, 0x0, 0x6d, 0x0, 0x4f,
-    0x20, 0x0, 0xd, 0x80, 0x1, 0xfe, 0x51, 0x4c,
-    0xf3, 0x0, 0xce, 0xaf, 0xff, 0xbc, 0xe2, 0x3e,
-    0x20, 0x13, 0x10, 0x1c, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x1a, 0x0, 0xfa, 0x4c, 0xc9, 0x6f, 0xbf, 0xd1,
+    0x2c, 0xe5, 0xa9, 0xb, 0x70, 0xcc, 0xa4, 0x0,
+    0xae, 0x11, 0xbc, 0x48, 0x1, 0x48, 0x80, 0x8,
+    0x66, 0xc0, 0x4, 0x60, 0x1c, 0x44, 0x0, 0x11,
+    0x0, 0x38, 0xcc, 0x0, 0xd5, 0x20, 0xd, 0x6a,
+    0x0, 0x50, 0xc5, 0x14, 0xc2, 0xb0, 0x6, 0x8a,
+    0x57, 0x5b, 0x9e, 0x91, 0x96, 0x57, 0x67, 0x5e,
+    0x92, 0x1f, 0x10, 0x9, 0x88, 0xe, 0x30,
 
     /* U+00A5 "¥" */
-    0xb, 0xe0, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x2f,
-    0x90, 0x0, 0x0, 0x3f, 0x60, 0x0, 0x7f, 0x30,
-    0x0, 0xd, 0xc0, 0x0, 0x0, 0xdd, 0x0, 0x7,
-    0xf2, 0x0, 0x0, 0x3, 0xf7, 0x2, 0xf8, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0xbd, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xef, 0x40, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0xf7,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0x70, 0x0, 0x0,
+    0xb, 0xe0, 0xf, 0xa7, 0xc4, 0x24, 0x64, 0x3,
+    0x8d, 0xa4, 0x40, 0xa1, 0x8c, 0x3, 0x71, 0xb0,
+    0x4, 0xe5, 0xc0, 0x13, 0x97, 0x0, 0x77, 0x13,
+    0x81, 0x43, 0x90, 0x7, 0x1b, 0x41, 0x49, 0x40,
+    0x7, 0xd2, 0x38, 0x92, 0x1, 0xe7, 0xff, 0x8,
+    0x82, 0xff, 0x0, 0x33, 0xff, 0xb4, 0x23, 0xfd,
+    0x80, 0x19, 0xff, 0xda, 0x11, 0xfe, 0xc0, 0xc,
+    0xff, 0xed, 0x8, 0xff, 0x60, 0x7, 0xff, 0xc,
 
     /* U+00A6 "¦" */
-    0x5f, 0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x14,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xe1, 0x5f,
-    0x15, 0xf1, 0x5f, 0x15, 0xf1, 0x5f, 0x10,
+    0x5f, 0x10, 0xf, 0xfc, 0x22, 0x4, 0xe1, 0x0,
+    0xf2, 0x70, 0x8c, 0x1, 0xff, 0xc1,
 
     /* U+00A7 "§" */
-    0x0, 0x8d, 0xfd, 0xa2, 0xb, 0xe6, 0x56, 0xc4,
-    0xf, 0x50, 0x0, 0x0, 0xd, 0xc2, 0x0, 0x0,
-    0x7, 0xff, 0xe9, 0x20, 0x2f, 0x62, 0x6d, 0xe1,
-    0x6f, 0x0, 0x0, 0xf6, 0x3f, 0x92, 0x2, 0xf4,
-    0x4, 0xcf, 0xef, 0x90, 0x0, 0x1, 0x6e, 0xc0,
-    0x0, 0x0, 0x5, 0xf0, 0x4b, 0x31, 0x2b, 0xe0,
-    0x3c, 0xff, 0xfd, 0x30, 0x0, 0x13, 0x20, 0x0,
+    0x0, 0x46, 0xfe, 0xd1, 0x5, 0xb5, 0xd5, 0xb3,
+    0x1, 0x2d, 0x95, 0xb1, 0x0, 0xa4, 0x80, 0x3a,
+    0x8f, 0x7a, 0x48, 0xa, 0x27, 0x61, 0x30, 0x50,
+    0x18, 0x9b, 0x45, 0xd4, 0x24, 0x80, 0x80, 0x8e,
+    0xd7, 0x7b, 0x59, 0x1, 0x33, 0xa0, 0x54, 0x3,
+    0xb, 0x59, 0x82, 0x59, 0x89, 0x70, 0x83, 0xbb,
+    0x3b, 0x5b, 0x40, 0xf3, 0xb3, 0x74, 0x60,
 
     /* U+00A8 "¨" */
-    0x29, 0x3, 0x90, 0x5d, 0x5, 0xd0,
+    0x29, 0x3, 0x90, 0x74, 0x6, 0x40,
 
     /* U+00A9 "©" */
-    0x0, 0x1, 0x7b, 0xcb, 0x70, 0x0, 0x0, 0x4,
-    0xc5, 0x0, 0x5, 0xc2, 0x0, 0x2, 0xb0, 0x4c,
-    0xec, 0x41, 0xc1, 0x0, 0xa2, 0x3f, 0x73, 0x7d,
-    0x4, 0x80, 0xb, 0xa, 0xa0, 0x0, 0x0, 0xc,
-    0x2, 0x90, 0xc7, 0x0, 0x0, 0x0, 0xb0, 0x29,
-    0xa, 0x90, 0x0, 0x0, 0xb, 0x0, 0xb0, 0x4f,
-    0x40, 0x4a, 0x0, 0xc0, 0xa, 0x20, 0x6f, 0xff,
-    0x70, 0x57, 0x0, 0x2b, 0x0, 0x2, 0x0, 0x1c,
-    0x0, 0x0, 0x4c, 0x40, 0x0, 0x6c, 0x20, 0x0,
-    0x0, 0x18, 0xbc, 0xb6, 0x0, 0x0,
+    0x0, 0x85, 0xef, 0x2d, 0xc0, 0x3c, 0x9a, 0x57,
+    0x96, 0x58, 0x40, 0x11, 0x7e, 0xe, 0x76, 0xe,
+    0xf0, 0x80, 0x22, 0x4e, 0xed, 0xb7, 0x23, 0x12,
+    0x0, 0x12, 0x95, 0x73, 0x7d, 0x4, 0x40, 0x11,
+    0x1, 0xb4, 0x3, 0xce, 0x1, 0x9b, 0x80, 0x3f,
+    0x11, 0x3, 0x99, 0x1, 0x28, 0x0, 0xe0, 0x1,
+    0x24, 0x9b, 0xfb, 0xd0, 0x5b, 0x0, 0x44, 0x83,
+    0x7e, 0xfb, 0x8c, 0xb8, 0x0, 0xbf, 0x10, 0x8,
+    0x1b, 0x78, 0x3, 0x26, 0xe5, 0xe5, 0x86, 0x10,
+    0x0,
 
     /* U+00AA "ª" */
-    0x1a, 0xdd, 0xa0, 0x3, 0x0, 0xd5, 0x9, 0xbb,
-    0xe6, 0x5b, 0x0, 0xc6, 0xa, 0xba, 0xa5,
+    0x1a, 0xdd, 0x50, 0xc, 0xee, 0x9d, 0x42, 0xae,
+    0xc6, 0x65, 0x2b, 0xb1, 0x2, 0x8d, 0xd3, 0x18,
 
     /* U+00AB "«" */
-    0x0, 0x6, 0x20, 0x62, 0x0, 0xac, 0x8, 0xd0,
-    0x5, 0xf2, 0x4f, 0x30, 0x1e, 0x60, 0xe7, 0x0,
-    0xb, 0xa0, 0xab, 0x0, 0x1, 0xe6, 0x1e, 0x70,
-    0x0, 0x5f, 0x24, 0xf3,
+    0x0, 0x98, 0x81, 0x88, 0x1, 0x54, 0x28, 0xb2,
+    0x5, 0x57, 0x23, 0xf0, 0xd, 0xc9, 0x54, 0x18,
+    0xa, 0xe0, 0x26, 0x0, 0x54, 0x8d, 0x6a, 0xe0,
+    0x1, 0xb9, 0x3a, 0x83,
 
     /* U+00AC "¬" */
-    0x11, 0x11, 0x11, 0x10, 0xef, 0xff, 0xff, 0xf3,
-    0x34, 0x44, 0x45, 0xf3, 0x0, 0x0, 0x2, 0xf3,
-    0x0, 0x0, 0x2, 0xf3, 0x0, 0x0, 0x0, 0x40,
+    0x11, 0xf8, 0x3f, 0xbb, 0xc7, 0xb7, 0x7a, 0x80,
+    0x6, 0x89, 0x9c, 0x3, 0xff, 0x86, 0x56, 0x60,
 
     /* U+00AD "­" */
-    0x1, 0x11, 0x10, 0x1f, 0xff, 0xf3, 0x4, 0x44,
-    0x40,
+    0x1, 0x1c, 0x3, 0xdd, 0x8c, 0x6e, 0xf1, 0x80,
 
     /* U+00AE "®" */
-    0x0, 0x1, 0x7b, 0xcb, 0x70, 0x0, 0x0, 0x4,
-    0xc5, 0x0, 0x5, 0xc2, 0x0, 0x2, 0xb0, 0x0,
-    0x0, 0x1, 0xc1, 0x0, 0xa2, 0xd, 0xff, 0xd6,
-    0x4, 0x80, 0xb, 0x0, 0xd3, 0x2, 0xe2, 0xc,
-    0x2, 0x90, 0xd, 0x30, 0x2e, 0x20, 0xb0, 0x29,
-    0x0, 0xdf, 0xff, 0x70, 0xb, 0x0, 0xb0, 0xd,
-    0x30, 0xb6, 0x0, 0xc0, 0xa, 0x20, 0xd3, 0x2,
-    0xe0, 0x57, 0x0, 0x2b, 0x3, 0x0, 0x2, 0x3c,
-    0x0, 0x0, 0x4c, 0x40, 0x0, 0x6c, 0x20, 0x0,
-    0x0, 0x18, 0xbc, 0xb6, 0x0, 0x0,
+    0x0, 0x85, 0xef, 0x2d, 0xc0, 0x3c, 0x9a, 0x57,
+    0x96, 0x58, 0x40, 0x11, 0x7e, 0x28, 0x4, 0xbb,
+    0xc2, 0x0, 0x89, 0xd, 0xff, 0x6b, 0xc, 0x48,
+    0x0, 0x48, 0x1, 0x9f, 0xe8, 0x24, 0x40, 0x11,
+    0x0, 0x3f, 0x9c, 0x3, 0xd9, 0xfb, 0x24, 0x1,
+    0x11, 0x0, 0x2c, 0xf4, 0x10, 0x3, 0x80, 0x4,
+    0x80, 0x34, 0xc0, 0x2d, 0x80, 0x22, 0x43, 0x8c,
+    0xb, 0xe, 0x5c, 0x0, 0x5f, 0x8e, 0x1, 0x27,
+    0xf0, 0x6, 0x4d, 0xcb, 0xcb, 0xc, 0x20, 0x0,
 
     /* U+00AF "¯" */
-    0xbe, 0xee, 0xe5, 0x11, 0x11, 0x10,
+    0xbe, 0xec, 0xb5, 0xff, 0x94,
 
     /* U+00B0 "°" */
-    0x2, 0xce, 0x90, 0xd, 0x40, 0x89, 0x3b, 0x0,
-    0xe, 0x3b, 0x0, 0xe, 0xd, 0x40, 0x89, 0x2,
-    0xce, 0x90,
+    0x2, 0xce, 0x90, 0x7, 0xc7, 0xc, 0x9b, 0x20,
+    0x43, 0x80, 0x78, 0xd9, 0x2, 0x1c, 0x3e, 0x38,
+    0x64,
 
     /* U+00B1 "±" */
-    0x0, 0x3, 0x0, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0xf, 0x50, 0x0, 0x1, 0x1f, 0x51, 0x10,
-    0xef, 0xff, 0xff, 0xf3, 0x34, 0x4f, 0x74, 0x40,
-    0x0, 0xf, 0x50, 0x0, 0x0, 0xf, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x45, 0x55, 0x55, 0x51,
-    0xef, 0xff, 0xff, 0xf3,
+    0x0, 0x8c, 0x3, 0xec, 0x50, 0xf, 0xfc, 0x22,
+    0x0, 0x8, 0x83, 0xba, 0xa, 0xee, 0x1e, 0xdd,
+    0x82, 0x2e, 0xc6, 0x64, 0x40, 0x12, 0x20, 0x3,
+    0xff, 0x7a, 0x80, 0x48, 0xab, 0xe1, 0xaa, 0xf8,
+    0x80,
 
     /* U+00B2 "²" */
-    0x1a, 0xff, 0xb1, 0x2, 0x71, 0x9, 0xa0, 0x0,
-    0x0, 0x8a, 0x0, 0x0, 0x4e, 0x20, 0x0, 0x5e,
-    0x30, 0x0, 0x6e, 0x20, 0x0, 0x3f, 0xfe, 0xee,
-    0x10,
+    0x1a, 0xff, 0x58, 0x81, 0xef, 0x79, 0x58, 0x13,
+    0x88, 0x8, 0x7, 0x23, 0x40, 0x4, 0xb5, 0xa4,
+    0x0, 0x6b, 0xc3, 0x0, 0x1c, 0x8e, 0x77, 0x4,
 
     /* U+00B3 "³" */
-    0x5f, 0xff, 0xfb, 0x0, 0x0, 0x3e, 0x20, 0x0,
-    0x2e, 0x40, 0x0, 0x5, 0xce, 0x60, 0x0, 0x0,
-    0x2f, 0x3, 0x50, 0x5, 0xe0, 0x3b, 0xef, 0xc3,
-    0x0,
+    0x5f, 0xfd, 0x60, 0xbf, 0xec, 0x19, 0x0, 0x8b,
+    0x68, 0x80, 0x27, 0x2a, 0x60, 0x9, 0x73, 0x12,
+    0x6, 0xa0, 0x7, 0x10, 0x7, 0x73, 0xe7, 0x40,
 
     /* U+00B4 "´" */
-    0x0, 0xbd, 0x31, 0xca, 0x0,
+    0x0, 0x5e, 0x98, 0xe0, 0xe9, 0x80,
 
     /* U+00B5 "µ" */
-    0x8f, 0x0, 0x0, 0x1f, 0x78, 0xf0, 0x0, 0x1,
-    0xf7, 0x8f, 0x0, 0x0, 0x1f, 0x78, 0xf0, 0x0,
-    0x1, 0xf7, 0x8f, 0x0, 0x0, 0x1f, 0x78, 0xf0,
-    0x0, 0x3, 0xf7, 0x8f, 0x50, 0x0, 0x9f, 0x78,
-    0xff, 0x86, 0xaf, 0xf7, 0x8f, 0x7d, 0xfc, 0x3f,
-    0x78, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x8, 0xf0, 0x0, 0x0, 0x0,
+    0x8f, 0x0, 0xc3, 0xee, 0x1, 0xff, 0xde, 0x20,
+    0xc, 0xa0, 0x15, 0x0, 0x6a, 0x86, 0xa6, 0x0,
+    0xd0, 0xb2, 0xd8, 0x1, 0x9f, 0x7f, 0xf, 0xdc,
+    0x3, 0xff, 0x8c,
 
     /* U+00B6 "¶" */
-    0x4, 0xcf, 0xff, 0xff, 0xb3, 0xff, 0xfe, 0x44,
-    0xbb, 0x9f, 0xff, 0xe0, 0x9, 0xb9, 0xff, 0xfe,
-    0x0, 0x9b, 0x4f, 0xff, 0xe0, 0x9, 0xb0, 0x6d,
-    0xfe, 0x0, 0x9b, 0x0, 0x6, 0xe0, 0x9, 0xb0,
-    0x0, 0x6e, 0x0, 0x9b, 0x0, 0x6, 0xe0, 0x9,
-    0xb0, 0x0, 0x6e, 0x0, 0x9b, 0x0, 0x6, 0xe0,
-    0x9, 0xb0, 0x0, 0x6e, 0x0, 0x9b, 0x0, 0x6,
-    0xe0, 0x9, 0xb0, 0x0, 0x6e, 0x0, 0x9b, 0x0,
-    0x1, 0x30, 0x2, 0x20,
+    0x4, 0xcf, 0xfe, 0xb3, 0xb3, 0x1, 0xbb, 0x20,
+    0x50, 0x6, 0x44, 0x10, 0x7, 0xfb, 0x40, 0x3f,
+    0x24, 0x90, 0x7, 0xcd, 0xb2, 0x1, 0xff, 0xfb,
+    0x7d, 0x0, 0x5c, 0x80,
 
     /* U+00B7 "·" */
-    0x12, 0xd, 0xf1, 0xad, 0x0,
+    0x12, 0xc, 0xd1, 0x72, 0x10,
 
     /* U+00B8 "¸" */
-    0x0, 0xc1, 0x0, 0xa, 0xd1, 0x1, 0xd, 0x50,
-    0xbe, 0xa0,
+    0x0, 0x60, 0x80, 0x4d, 0x82, 0x3, 0x40, 0x81,
+    0x5c, 0xea,
 
     /* U+00B9 "¹" */
-    0x8f, 0xf4, 0x0, 0xd, 0x40, 0x0, 0xd4, 0x0,
-    0xd, 0x40, 0x0, 0xd4, 0x0, 0xd, 0x40, 0xae,
-    0xff, 0xd0,
+    0x8f, 0xf2, 0x4, 0x79, 0x0, 0x7f, 0xf2, 0xab,
+    0x8a, 0xf4,
 
     /* U+00BA "º" */
-    0x6, 0xde, 0xc3, 0x3, 0xe2, 0x5, 0xe0, 0x7a,
-    0x0, 0xf, 0x23, 0xe2, 0x6, 0xe0, 0x6, 0xde,
-    0xc2, 0x0,
+    0x6, 0xde, 0xc3, 0x3, 0x8f, 0xe9, 0xd0, 0x44,
+    0x10, 0x28, 0x92, 0x20, 0x81, 0x84, 0x8e, 0x3f,
+    0xab, 0x0,
 
     /* U+00BB "»" */
-    0x26, 0x1, 0x71, 0x0, 0xc, 0x90, 0xbb, 0x0,
-    0x2, 0xf5, 0x1e, 0x60, 0x0, 0x7e, 0x15, 0xf2,
-    0x0, 0xbb, 0x9, 0xc0, 0x6, 0xe1, 0x5f, 0x20,
-    0x2f, 0x51, 0xe6, 0x0,
+    0x26, 0x1, 0x71, 0x0, 0x15, 0x48, 0xe5, 0x0,
+    0x5c, 0xcb, 0x4a, 0xc0, 0x2, 0x8b, 0xb, 0x92,
+    0x0, 0x62, 0x8e, 0x19, 0x3, 0x2d, 0x2b, 0x70,
+    0x14, 0xd8, 0x5c, 0x90, 0x0,
 
     /* U+00BC "¼" */
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x0, 0x8, 0xb0, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x0, 0x3e, 0x10, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x0, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0xd4, 0x0, 0x8, 0xb0, 0x0, 0x21, 0x0,
-    0x0, 0xd4, 0x0, 0x3e, 0x10, 0x4, 0xe1, 0x0,
-    0xaf, 0xff, 0xe0, 0xd6, 0x0, 0x1e, 0x30, 0x0,
-    0x0, 0x0, 0x8, 0xb0, 0x0, 0xb7, 0x3, 0x0,
-    0x0, 0x0, 0x3e, 0x10, 0x7, 0xb0, 0x3d, 0x0,
-    0x0, 0x0, 0xd6, 0x0, 0xf, 0xff, 0xff, 0xf1,
-    0x0, 0x8, 0xb0, 0x0, 0x0, 0x0, 0x4d, 0x0,
-    0x0, 0x7, 0x10, 0x0, 0x0, 0x0, 0x26, 0x0,
+    0x8f, 0xf2, 0x0, 0x7b, 0x14, 0x3, 0x47, 0x90,
+    0x7, 0xa1, 0xd4, 0x3, 0xff, 0x1b, 0x50, 0x7,
+    0xff, 0x7, 0xa0, 0x40, 0x3f, 0xf4, 0x33, 0x0,
+    0x4, 0x20, 0x1f, 0x8d, 0xa8, 0x0, 0x98, 0x1,
+    0x57, 0x95, 0xf0, 0x74, 0x8, 0xd, 0x68, 0x80,
+    0x2b, 0xfe, 0xe8, 0x66, 0x0, 0x2a, 0x4c, 0xc0,
+    0x1e, 0x36, 0xa0, 0x3, 0x83, 0x9f, 0x0, 0x7b,
+    0xa0, 0x40, 0x10, 0x9f, 0x85, 0xe2, 0x1, 0x43,
+    0x30, 0x2, 0xff, 0xac, 0xbc, 0x40, 0x2f, 0xa0,
+    0xf, 0x9a, 0xc0, 0x0,
 
     /* U+00BD "½" */
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0xc6, 0x0, 0x0,
-    0xd, 0x40, 0x0, 0x0, 0x7b, 0x0, 0x0, 0x0,
-    0xd4, 0x0, 0x0, 0x2e, 0x20, 0x0, 0x0, 0xd,
-    0x40, 0x0, 0xb, 0x70, 0x0, 0x0, 0x0, 0xd4,
-    0x0, 0x6, 0xd0, 0x0, 0x0, 0x0, 0xd, 0x40,
-    0x1, 0xe3, 0x3b, 0xdd, 0x70, 0xaf, 0xff, 0xe0,
-    0xa8, 0x3, 0x30, 0x2e, 0x40, 0x0, 0x0, 0x4e,
-    0x0, 0x0, 0x0, 0xd5, 0x0, 0x0, 0xe, 0x40,
-    0x0, 0x0, 0x9c, 0x0, 0x0, 0x9, 0xa0, 0x0,
-    0x0, 0xab, 0x0, 0x0, 0x3, 0xe1, 0x0, 0x0,
-    0xba, 0x0, 0x0, 0x0, 0xc5, 0x0, 0x0, 0x8f,
-    0xff, 0xfb,
+    0x8f, 0xf2, 0x0, 0x7b, 0x18, 0x2, 0x8f, 0x20,
+    0xf, 0x3b, 0x98, 0x3, 0xfe, 0x29, 0x90, 0x7,
+    0xfe, 0x99, 0x10, 0x7, 0xfc, 0xcc, 0x70, 0xf,
+    0xf8, 0x63, 0x8e, 0xf7, 0x4e, 0x15, 0xe5, 0x7c,
+    0x16, 0xc6, 0x11, 0xbf, 0x29, 0x5f, 0xf7, 0x22,
+    0x20, 0xc, 0xc0, 0x46, 0x20, 0x1d, 0x54, 0x0,
+    0xe9, 0x15, 0x0, 0xd2, 0x88, 0x0, 0xd4, 0x58,
+    0x1, 0x8d, 0xec, 0x3, 0x58, 0x58, 0x7, 0x7d,
+    0x88, 0x5, 0x8, 0xbf, 0xeb,
 
     /* U+00BE "¾" */
-    0x5f, 0xff, 0xfb, 0x0, 0x0, 0xc, 0x50, 0x0,
-    0x0, 0x0, 0x3e, 0x30, 0x0, 0x8, 0xb0, 0x0,
-    0x0, 0x0, 0x1e, 0x40, 0x0, 0x3, 0xe1, 0x0,
-    0x0, 0x0, 0x6, 0xde, 0x60, 0x0, 0xd6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x0, 0x8b, 0x0,
-    0x2, 0x10, 0x2, 0x50, 0x4, 0xf0, 0x3e, 0x10,
-    0x4, 0xe1, 0x0, 0x3c, 0xff, 0xe4, 0xd, 0x60,
-    0x1, 0xe4, 0x0, 0x0, 0x0, 0x0, 0x8, 0xb0,
-    0x0, 0xb8, 0x3, 0x0, 0x0, 0x0, 0x3, 0xe1,
-    0x0, 0x7b, 0x3, 0xd0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x8b,
-    0x0, 0x0, 0x0, 0x4, 0xd0, 0x0, 0x0, 0x7,
-    0x10, 0x0, 0x0, 0x0, 0x26, 0x0,
+    0x5f, 0xfd, 0x60, 0x1d, 0x8a, 0x1, 0x97, 0xfd,
+    0x83, 0x0, 0x1a, 0x1d, 0x40, 0x3c, 0x3b, 0x46,
+    0x1, 0x1b, 0x50, 0x7, 0xce, 0x74, 0xc0, 0x17,
+    0x40, 0x80, 0x7c, 0xdb, 0xa9, 0x0, 0x43, 0x30,
+    0x0, 0x42, 0x0, 0x25, 0x0, 0x38, 0x0, 0xda,
+    0x80, 0x9, 0x80, 0x10, 0xcf, 0xfa, 0xac, 0x3a,
+    0x4, 0x6, 0xa8, 0x20, 0x3, 0xcf, 0xf7, 0x24,
+    0x33, 0x0, 0x14, 0xc8, 0x60, 0x1f, 0x1b, 0x50,
+    0x1, 0xc2, 0xf, 0x80, 0x3e, 0xe8, 0x10, 0x4,
+    0x27, 0xe1, 0x78, 0x80, 0x68, 0x66, 0x0, 0x5f,
+    0xf5, 0x97, 0x88, 0x6, 0xfa, 0x0, 0xf9, 0xac,
+    0x0,
 
     /* U+00BF "¿" */
-    0x0, 0x2e, 0x80, 0x0, 0x0, 0x3, 0xf9, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x42,
-    0x0, 0x0, 0x0, 0x4f, 0x50, 0x0, 0x0, 0x2e,
-    0xc0, 0x0, 0x0, 0x2e, 0xc0, 0x0, 0x0, 0xa,
-    0xe0, 0x0, 0x0, 0x0, 0xdc, 0x0, 0x0, 0x10,
-    0xa, 0xf8, 0x22, 0x6e, 0xb0, 0x1b, 0xff, 0xff,
-    0xb1, 0x0, 0x1, 0x33, 0x10, 0x0,
+    0x0, 0x17, 0x40, 0x7, 0x84, 0x60, 0xf, 0x1f,
+    0x48, 0x7, 0xca, 0x40, 0x1e, 0x4b, 0x70, 0xe,
+    0x2a, 0x35, 0x0, 0xc5, 0x85, 0x80, 0x1d, 0x1,
+    0x80, 0x1e, 0x72, 0x0, 0xc2, 0x0, 0x73, 0x82,
+    0x23, 0x7d, 0x85, 0xa3, 0xee, 0xa5, 0x68, 0x6,
+    0xfb, 0x31, 0xd6, 0x20,
 
     /* U+00C0 "À" */
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x56, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x1f, 0x80, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x1f, 0xa1, 0x11, 0x1e, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xec,
-    0x44, 0x44, 0x44, 0xfa, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xa, 0xf1, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
+    0x0, 0xd1, 0xea, 0x1, 0xfe, 0x88, 0x51, 0x80,
+    0x7f, 0x9e, 0x94, 0x3, 0xfc, 0x55, 0x60, 0x1f,
+    0xeb, 0x2, 0x40, 0xf, 0xe6, 0x60, 0xf8, 0x7,
+    0xe6, 0xb, 0x94, 0x20, 0xf, 0xac, 0xc9, 0x82,
+    0x80, 0x3c, 0x85, 0x40, 0x28, 0xc0, 0x1e, 0xf0,
+    0x60, 0x7, 0x8b, 0x0, 0x61, 0x45, 0x11, 0x94,
+    0x6c, 0x3, 0x48, 0x2f, 0x76, 0x12, 0x30, 0x9,
+    0x8e, 0xef, 0xc1, 0x20, 0x6, 0x18, 0x44, 0xf2,
+    0xa8, 0x42, 0x89, 0x0, 0x3d, 0x1, 0x20,
 
     /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x9, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x1f, 0x80, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x1f, 0xa1, 0x11, 0x1e, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xec,
-    0x44, 0x44, 0x44, 0xfa, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xa, 0xf1, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
+    0x0, 0xfa, 0x7d, 0x0, 0x3f, 0x9d, 0xd8, 0x80,
+    0x1f, 0x84, 0x30, 0xc0, 0x3f, 0x8e, 0x3c, 0x3,
+    0xfd, 0x60, 0x48, 0x1, 0xfc, 0xcc, 0x1f, 0x0,
+    0xfc, 0xc1, 0x72, 0x84, 0x1, 0xf5, 0x99, 0x30,
+    0x50, 0x7, 0x90, 0xa8, 0x5, 0x18, 0x3, 0xde,
+    0xc, 0x0, 0xf1, 0x60, 0xc, 0x28, 0xa2, 0x32,
+    0x8d, 0x80, 0x69, 0x5, 0xee, 0xc2, 0x46, 0x1,
+    0x31, 0xdd, 0xf8, 0x24, 0x0, 0xc3, 0x8, 0x9e,
+    0x55, 0x8, 0x51, 0x20, 0x7, 0xa0, 0x24,
 
     /* U+00C2 "Â" */
-    0x0, 0x0, 0x5, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xf6, 0xad, 0x0, 0x0, 0x0, 0x0, 0x65,
-    0x0, 0x74, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x1f, 0x80, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x1f, 0xa1, 0x11, 0x1e, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xec,
-    0x44, 0x44, 0x44, 0xfa, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xa, 0xf1, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
+    0x0, 0xe5, 0xfe, 0x10, 0xf, 0xc7, 0x52, 0x98,
+    0x1, 0xf9, 0x69, 0xaa, 0x88, 0x1, 0xf3, 0x3f,
+    0xeb, 0xa0, 0x7, 0xeb, 0x2, 0x40, 0xf, 0xe6,
+    0x60, 0xf8, 0x7, 0xe6, 0xb, 0x94, 0x20, 0xf,
+    0xac, 0xc9, 0x82, 0x80, 0x3c, 0x85, 0x40, 0x28,
+    0xc0, 0x1e, 0xf0, 0x60, 0x7, 0x8b, 0x0, 0x61,
+    0x45, 0x11, 0x94, 0x6c, 0x3, 0x48, 0x2f, 0x76,
+    0x12, 0x30, 0x9, 0x8e, 0xef, 0xc1, 0x20, 0x6,
+    0x18, 0x44, 0xf2, 0xa8, 0x42, 0x89, 0x0, 0x3d,
+    0x1, 0x20,
 
     /* U+00C3 "Ã" */
-    0x0, 0x0, 0x4d, 0xa1, 0x76, 0x0, 0x0, 0x0,
-    0xb, 0x45, 0xdc, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x1f, 0x80, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x1f, 0xa1, 0x11, 0x1e, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xec,
-    0x44, 0x44, 0x44, 0xfa, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xa, 0xf1, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
+    0x0, 0xc9, 0xb4, 0x2e, 0xc0, 0x1f, 0x7c, 0xfe,
+    0x5b, 0x80, 0x7d, 0x68, 0xbb, 0x82, 0x1, 0xf8,
+    0xbf, 0x40, 0x3f, 0xd6, 0x4, 0x80, 0x1f, 0xcc,
+    0xc1, 0xf0, 0xf, 0xcc, 0x17, 0x28, 0x40, 0x1f,
+    0x59, 0x93, 0x5, 0x0, 0x79, 0xa, 0x80, 0x51,
+    0x80, 0x3d, 0xe0, 0xc0, 0xf, 0x16, 0x0, 0xc2,
+    0x8a, 0x23, 0x28, 0xd8, 0x6, 0x90, 0x5e, 0xec,
+    0x24, 0x60, 0x13, 0x1d, 0xdf, 0x82, 0x40, 0xc,
+    0x30, 0x89, 0xe5, 0x50, 0x85, 0x12, 0x0, 0x7a,
+    0x2, 0x40,
 
     /* U+00C4 "Ä" */
-    0x0, 0x0, 0x29, 0x2, 0x90, 0x0, 0x0, 0x0,
-    0x4, 0xe1, 0x4e, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xf9, 0xeb, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0x27, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x1f, 0x80, 0x0, 0x0, 0x4, 0xf6, 0x0,
-    0xbe, 0x0, 0x0, 0x0, 0xbf, 0x0, 0x4, 0xf6,
-    0x0, 0x0, 0x1f, 0xa1, 0x11, 0x1e, 0xd0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0xec,
-    0x44, 0x44, 0x44, 0xfa, 0x0, 0x6f, 0x40, 0x0,
-    0x0, 0xa, 0xf1, 0xc, 0xd0, 0x0, 0x0, 0x0,
-    0x2f, 0x80,
+    0x0, 0xc5, 0x20, 0x52, 0x1, 0xf9, 0x9c, 0x59,
+    0xc0, 0x3f, 0x27, 0xa, 0x70, 0x7, 0xf1, 0x7e,
+    0x80, 0x7f, 0xac, 0x9, 0x0, 0x3f, 0x99, 0x83,
+    0xe0, 0x1f, 0x98, 0x2e, 0x50, 0x80, 0x3e, 0xb3,
+    0x26, 0xa, 0x0, 0xf2, 0x15, 0x0, 0xa3, 0x0,
+    0x7b, 0xc1, 0x80, 0x1e, 0x2c, 0x1, 0x85, 0x14,
+    0x46, 0x51, 0xb0, 0xd, 0x20, 0xbd, 0xd8, 0x48,
+    0xc0, 0x26, 0x3b, 0xbf, 0x4, 0x80, 0x18, 0x61,
+    0x13, 0xca, 0xa1, 0xa, 0x24, 0x0, 0xf4, 0x4,
+    0x80,
 
     /* U+00C5 "Å" */
-    0x0, 0x0, 0x3, 0xba, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb0, 0x47, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0x4, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xa1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xeb, 0x0, 0x0, 0x0, 0x0, 0x6f, 0x27,
-    0xf2, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x1f, 0x80,
-    0x0, 0x0, 0x4, 0xf6, 0x0, 0xbe, 0x0, 0x0,
-    0x0, 0xbf, 0x0, 0x4, 0xf6, 0x0, 0x0, 0x1f,
-    0xa1, 0x11, 0x1e, 0xd0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0xec, 0x44, 0x44, 0x44,
-    0xfa, 0x0, 0x6f, 0x40, 0x0, 0x0, 0xa, 0xf1,
-    0xc, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0x80,
+    0x0, 0xe3, 0xba, 0x0, 0xff, 0x45, 0xf3, 0x80,
+    0x7f, 0xef, 0x0, 0xfe, 0x8b, 0xe9, 0x0, 0xfe,
+    0x3b, 0xa1, 0x0, 0xfe, 0x2f, 0xd0, 0xf, 0xf5,
+    0x81, 0x20, 0x7, 0xf3, 0x30, 0x7c, 0x3, 0xf3,
+    0x5, 0xca, 0x10, 0x7, 0xd6, 0x64, 0xc1, 0x40,
+    0x1e, 0x42, 0xa0, 0x14, 0x60, 0xf, 0x78, 0x30,
+    0x3, 0xc5, 0x80, 0x30, 0xa2, 0x88, 0xca, 0x36,
+    0x1, 0xa4, 0x17, 0xbb, 0x9, 0x18, 0x4, 0xc7,
+    0x77, 0xe0, 0x90, 0x3, 0xc, 0x22, 0x79, 0x54,
+    0x21, 0x44, 0x80, 0x1e, 0x80, 0x90,
 
     /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x2, 0xfb, 0xf9, 0x77, 0x77,
-    0x74, 0x0, 0x0, 0x0, 0xbd, 0x4f, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0x54, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xc0, 0x4f, 0x61,
-    0x11, 0x11, 0x0, 0x0, 0x6, 0xf4, 0x4, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0xec, 0x0, 0x4f,
-    0x84, 0x44, 0x44, 0x0, 0x0, 0x8f, 0x51, 0x15,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xa, 0xf5, 0x44,
-    0x47, 0xf5, 0x0, 0x0, 0x0, 0x3, 0xf8, 0x0,
-    0x0, 0x4f, 0xa7, 0x77, 0x77, 0x60, 0xbe, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfd,
+    0x0, 0xfa, 0xbf, 0xff, 0x50, 0x7, 0x89, 0x50,
+    0x1a, 0x23, 0xb8, 0x3, 0xd2, 0x5e, 0x18, 0xef,
+    0xc8, 0x1, 0xc8, 0x88, 0x0, 0xff, 0xe1, 0x49,
+    0xa8, 0x0, 0xc4, 0x78, 0x3, 0x98, 0xa0, 0x2,
+    0x9e, 0xed, 0xe0, 0x1d, 0x6, 0x80, 0x13, 0xdd,
+    0xea, 0x0, 0xd0, 0x32, 0x23, 0x6, 0xa2, 0x70,
+    0x4, 0x2e, 0x15, 0xdc, 0xa0, 0xf, 0xf5, 0x85,
+    0x5d, 0xd0, 0x1, 0xfc, 0x6a, 0xea, 0x89, 0x18,
+    0x7b, 0xbf, 0x30, 0x40, 0xc0, 0x7, 0x96, 0x23,
+    0xac,
 
     /* U+00C7 "Ç" */
-    0x0, 0x2, 0x8d, 0xfe, 0xb4, 0x0, 0x4, 0xff,
-    0xb8, 0x9d, 0xf9, 0x2, 0xfd, 0x20, 0x0, 0x8,
-    0x50, 0xbf, 0x20, 0x0, 0x0, 0x0, 0xf, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0x60, 0x0, 0x0, 0x0, 0x0, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xd2, 0x0, 0x0, 0x85, 0x0,
-    0x5f, 0xfb, 0x89, 0xdf, 0x80, 0x0, 0x29, 0xdf,
-    0xeb, 0x40, 0x0, 0x0, 0x3, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0xe0, 0x0, 0x0, 0x0, 0x3e,
-    0xe8, 0x0, 0x0,
+    0x0, 0x8a, 0x37, 0xfa, 0xd0, 0x2, 0x4d, 0x76,
+    0x77, 0x35, 0xc8, 0x15, 0x96, 0xdc, 0x4e, 0xbe,
+    0x4, 0x87, 0x90, 0x6, 0x85, 0x4, 0x52, 0x0,
+    0xf8, 0x83, 0x0, 0x3f, 0xf8, 0xe4, 0x18, 0x1,
+    0xfc, 0x8a, 0x40, 0x1f, 0xa4, 0x3c, 0x80, 0x34,
+    0x28, 0x15, 0x16, 0xdc, 0x4e, 0xbe, 0x80, 0x17,
+    0x59, 0x8e, 0xe6, 0xb8, 0x0, 0x8a, 0x78, 0xb2,
+    0xd0, 0x3, 0xc5, 0x18, 0x1, 0xf1, 0xfd, 0xb0,
+    0x4,
 
     /* U+00C8 "È" */
-    0x0, 0xbe, 0x20, 0x0, 0x0, 0x0, 0xae, 0x10,
-    0x0, 0x0, 0x0, 0x65, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf9, 0x5f, 0x97, 0x77, 0x77, 0x45, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
-    0xf5, 0x11, 0x11, 0x10, 0x5f, 0xff, 0xff, 0xfe,
-    0x5, 0xf7, 0x44, 0x44, 0x40, 0x5f, 0x40, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x5, 0xf9, 0x77, 0x77, 0x76, 0x5f,
-    0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x5f, 0x10, 0x7, 0xad, 0x30, 0x40, 0x3d,
+    0x50, 0x80, 0x12, 0xff, 0xd3, 0x5f, 0xe9, 0x0,
+    0x34, 0x47, 0x68, 0x3, 0x5d, 0xf9, 0x0, 0x3f,
+    0xe1, 0x1f, 0x0, 0x55, 0xdd, 0xbc, 0x2, 0x8b,
+    0xbd, 0x40, 0x11, 0xa2, 0x70, 0x7, 0xff, 0x27,
+    0x5d, 0xf9, 0x80, 0xd, 0x11, 0xd6,
 
     /* U+00C9 "É" */
-    0x0, 0x0, 0xc, 0xe2, 0x0, 0x0, 0xa, 0xd1,
-    0x0, 0x0, 0x2, 0x71, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf9, 0x5f, 0x97, 0x77, 0x77, 0x45, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
-    0xf5, 0x11, 0x11, 0x10, 0x5f, 0xff, 0xff, 0xfe,
-    0x5, 0xf7, 0x44, 0x44, 0x40, 0x5f, 0x40, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x5, 0xf9, 0x77, 0x77, 0x76, 0x5f,
-    0xff, 0xff, 0xff, 0xd0,
+    0x0, 0xec, 0xe2, 0x0, 0xea, 0x1f, 0x20, 0xc,
+    0x5b, 0x82, 0x0, 0x5f, 0xf6, 0xc7, 0x7f, 0xa4,
+    0x0, 0xd1, 0x1d, 0xa0, 0xd, 0x77, 0xe4, 0x0,
+    0xff, 0x84, 0x7c, 0x1, 0x57, 0x76, 0xf0, 0xa,
+    0x2e, 0xf5, 0x0, 0x46, 0x89, 0xc0, 0x1f, 0xfc,
+    0x9d, 0x77, 0xe6, 0x0, 0x34, 0x47, 0x58,
 
     /* U+00CA "Ê" */
-    0x0, 0x8, 0xfc, 0x0, 0x0, 0x5, 0xf4, 0xca,
-    0x0, 0x0, 0x73, 0x1, 0x72, 0x5, 0xff, 0xff,
-    0xff, 0xf9, 0x5f, 0x97, 0x77, 0x77, 0x45, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
-    0xf5, 0x11, 0x11, 0x10, 0x5f, 0xff, 0xff, 0xfe,
-    0x5, 0xf7, 0x44, 0x44, 0x40, 0x5f, 0x40, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x5, 0xf9, 0x77, 0x77, 0x76, 0x5f,
-    0xff, 0xff, 0xff, 0xd0,
+    0x0, 0xa3, 0xf0, 0x3, 0x95, 0xec, 0x28, 0x3,
+    0x16, 0x26, 0xe8, 0x81, 0x7e, 0x33, 0xfa, 0x36,
+    0x40, 0xd, 0x11, 0xda, 0x0, 0xd7, 0x7e, 0x40,
+    0xf, 0xf8, 0x47, 0xc0, 0x15, 0x77, 0x6f, 0x0,
+    0xa2, 0xef, 0x50, 0x4, 0x68, 0x9c, 0x1, 0xff,
+    0xc9, 0xd7, 0x7e, 0x60, 0x3, 0x44, 0x75, 0x80,
 
     /* U+00CB "Ë" */
-    0x0, 0x48, 0x4, 0x70, 0x0, 0x7, 0xc0, 0x7b,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf9, 0x5f, 0x97, 0x77, 0x77, 0x45, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x0, 0x5,
-    0xf5, 0x11, 0x11, 0x10, 0x5f, 0xff, 0xff, 0xfe,
-    0x5, 0xf7, 0x44, 0x44, 0x40, 0x5f, 0x40, 0x0,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x0, 0x5, 0xf9, 0x77, 0x77, 0x76, 0x5f,
-    0xff, 0xff, 0xff, 0xd0,
+    0x0, 0x24, 0x2, 0x38, 0x6, 0x34, 0x3, 0xc0,
+    0xc, 0xf8, 0xf, 0x60, 0x5, 0xff, 0xfa, 0x40,
+    0xd, 0x11, 0xda, 0x0, 0xd7, 0x7e, 0x40, 0xf,
+    0xf8, 0x47, 0xc0, 0x15, 0x77, 0x6f, 0x0, 0xa2,
+    0xef, 0x50, 0x4, 0x68, 0x9c, 0x1, 0xff, 0xc9,
+    0xd7, 0x7e, 0x60, 0x3, 0x44, 0x75, 0x80,
 
     /* U+00CC "Ì" */
-    0x1d, 0xd1, 0x0, 0x1c, 0xc0, 0x0, 0x7, 0x30,
-    0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0,
-    0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5,
-    0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f,
-    0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40,
+    0x1d, 0xd0, 0x80, 0xe0, 0xe8, 0x0, 0x72, 0xcc,
+    0x0, 0xb0, 0xe0, 0x1f, 0xfe, 0xb0,
 
     /* U+00CD "Í" */
-    0x1, 0xec, 0x10, 0xcb, 0x0, 0x47, 0x0, 0x5,
-    0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f,
-    0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4,
-    0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40,
-    0x5, 0xf4, 0x0, 0x5f, 0x40, 0x0,
+    0x1, 0xec, 0x10, 0xd5, 0xc1, 0x4b, 0xb0, 0x0,
+    0x61, 0x0, 0x3f, 0xfd, 0xa0,
 
     /* U+00CE "Î" */
-    0x0, 0xaf, 0xa0, 0x0, 0x8e, 0x4e, 0x70, 0x17,
-    0x20, 0x27, 0x10, 0x5, 0xf4, 0x0, 0x0, 0x5f,
-    0x40, 0x0, 0x5, 0xf4, 0x0, 0x0, 0x5f, 0x40,
-    0x0, 0x5, 0xf4, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x5, 0xf4, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x5,
-    0xf4, 0x0, 0x0, 0x5f, 0x40, 0x0, 0x5, 0xf4,
-    0x0, 0x0, 0x5f, 0x40, 0x0,
+    0x0, 0x57, 0xd0, 0x5, 0x9, 0x68, 0xe0, 0x3f,
+    0x89, 0x80, 0x22, 0x77, 0x7b, 0x38, 0x80, 0x7f,
+    0xff, 0xc0, 0x0,
 
     /* U+00CF "Ï" */
-    0x66, 0x6, 0x5a, 0x90, 0xa9, 0x0, 0x0, 0x0,
-    0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5,
-    0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0, 0x5f,
-    0x40, 0x5, 0xf4, 0x0, 0x5f, 0x40, 0x5, 0xf4,
-    0x0, 0x5f, 0x40, 0x5, 0xf4, 0x0,
+    0x66, 0x3, 0x2e, 0x78, 0x66, 0x2a, 0x42, 0xa4,
+    0x17, 0xd0, 0x3, 0xff, 0xd8,
 
     /* U+00D0 "Ð" */
-    0x3, 0xff, 0xff, 0xfe, 0xb4, 0x0, 0x0, 0x3f,
-    0xa7, 0x77, 0x9e, 0xfa, 0x0, 0x3, 0xf6, 0x0,
-    0x0, 0x8, 0xf8, 0x0, 0x3f, 0x60, 0x0, 0x0,
-    0xb, 0xf1, 0x4, 0xf7, 0x11, 0x0, 0x0, 0x4f,
-    0x6d, 0xff, 0xff, 0xf9, 0x0, 0x1, 0xf8, 0x37,
-    0xfa, 0x44, 0x20, 0x0, 0x1f, 0x80, 0x3f, 0x60,
-    0x0, 0x0, 0x4, 0xf6, 0x3, 0xf6, 0x0, 0x0,
-    0x0, 0xbf, 0x10, 0x3f, 0x60, 0x0, 0x0, 0x8f,
-    0x80, 0x3, 0xfa, 0x77, 0x79, 0xef, 0xa0, 0x0,
-    0x3f, 0xff, 0xff, 0xeb, 0x40, 0x0,
+    0x3, 0xff, 0xee, 0xb4, 0x0, 0xf2, 0xc4, 0x4e,
+    0xb7, 0x40, 0x1d, 0x8e, 0xf4, 0xf3, 0xac, 0x0,
+    0x7f, 0xa1, 0x1c, 0x41, 0xc0, 0x46, 0x0, 0xde,
+    0xf, 0xb6, 0x11, 0xdc, 0x90, 0x9, 0x43, 0xb9,
+    0x0, 0xb7, 0x70, 0x7, 0x8d, 0x3, 0x11, 0x4,
+    0x1, 0x28, 0x70, 0x7, 0xfb, 0xc1, 0xc0, 0x3f,
+    0xa1, 0x1c, 0x40, 0x2c, 0x77, 0xa7, 0x9d, 0x60,
+    0x3, 0x2c, 0x44, 0xeb, 0x74, 0x0,
 
     /* U+00D1 "Ñ" */
-    0x0, 0x8, 0xd7, 0xc, 0x10, 0x0, 0x1, 0xc2,
-    0x8e, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x4, 0xf5, 0x5f, 0xf2,
-    0x0, 0x0, 0x4f, 0x55, 0xff, 0xd0, 0x0, 0x4,
-    0xf5, 0x5f, 0xaf, 0x90, 0x0, 0x4f, 0x55, 0xf4,
-    0xaf, 0x50, 0x4, 0xf5, 0x5f, 0x40, 0xdf, 0x20,
-    0x4f, 0x55, 0xf4, 0x2, 0xfd, 0x4, 0xf5, 0x5f,
-    0x40, 0x6, 0xf9, 0x4f, 0x55, 0xf4, 0x0, 0xa,
-    0xfa, 0xf5, 0x5f, 0x40, 0x0, 0xd, 0xff, 0x55,
-    0xf4, 0x0, 0x0, 0x2f, 0xf5, 0x5f, 0x40, 0x0,
-    0x0, 0x6f, 0x50,
+    0x0, 0xa3, 0x5c, 0x30, 0x40, 0x30, 0xa7, 0xfb,
+    0x90, 0x40, 0x30, 0xe1, 0x47, 0x40, 0x4, 0xbe,
+    0xa0, 0x1c, 0x9e, 0xa0, 0xa, 0x20, 0xf, 0xf7,
+    0x80, 0x7f, 0x29, 0x48, 0x7, 0xee, 0x56, 0x50,
+    0xf, 0xd4, 0x54, 0x40, 0x1f, 0xbc, 0x3c, 0x3,
+    0xf1, 0x49, 0x48, 0x7, 0xe6, 0x56, 0xe0, 0xf,
+    0xd4, 0x4a, 0x1, 0xfd, 0xe0, 0x1f, 0xe2, 0x90,
+    0x0,
 
     /* U+00D2 "Ò" */
-    0x0, 0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4e, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
-    0x50, 0x0, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0,
-    0x0, 0x2f, 0xd2, 0x0, 0x0, 0x8f, 0x90, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0x20, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xbf, 0x20, 0x0, 0x0, 0xa, 0xf2, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0x4, 0xff, 0xb8,
-    0x9e, 0xfa, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xb5,
-    0x0, 0x0,
+    0x0, 0xd1, 0xea, 0x1, 0xfe, 0x8b, 0xb3, 0x0,
+    0x7f, 0x93, 0x98, 0x3, 0xf0, 0xc6, 0xff, 0x5a,
+    0x80, 0x72, 0x73, 0xb3, 0xb9, 0x6a, 0x80, 0x11,
+    0x59, 0x6d, 0xc4, 0xf3, 0xac, 0x80, 0x24, 0x3c,
+    0x80, 0x34, 0x2b, 0x10, 0x22, 0x90, 0x7, 0xa4,
+    0x14, 0x83, 0x0, 0x3e, 0x30, 0xe0, 0xf, 0xfe,
+    0x9, 0x6, 0x0, 0x7c, 0x61, 0xc0, 0x8a, 0x40,
+    0x1e, 0x90, 0x50, 0x90, 0xf2, 0x0, 0xd0, 0xac,
+    0x40, 0x56, 0x5b, 0x71, 0x3c, 0xeb, 0x20, 0x12,
+    0x6b, 0xb3, 0xb9, 0x6a, 0x80, 0x0,
 
     /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x1c, 0xd2, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
-    0x50, 0x0, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0,
-    0x0, 0x2f, 0xd2, 0x0, 0x0, 0x8f, 0x90, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0x20, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xbf, 0x20, 0x0, 0x0, 0xa, 0xf2, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0x4, 0xff, 0xb8,
-    0x9e, 0xfa, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xb5,
-    0x0, 0x0,
+    0x0, 0xf0, 0xe6, 0x90, 0x7, 0xe1, 0xc5, 0xd2,
+    0x0, 0xfc, 0x3b, 0x20, 0x1f, 0x86, 0x37, 0xfa,
+    0xd4, 0x3, 0x93, 0x9d, 0x9d, 0xcb, 0x54, 0x0,
+    0x8a, 0xcb, 0x6e, 0x27, 0x9d, 0x64, 0x1, 0x21,
+    0xe4, 0x1, 0xa1, 0x58, 0x81, 0x14, 0x80, 0x3d,
+    0x20, 0xa4, 0x18, 0x1, 0xf1, 0x87, 0x0, 0x7f,
+    0xf0, 0x48, 0x30, 0x3, 0xe3, 0xe, 0x4, 0x52,
+    0x0, 0xf4, 0x82, 0x84, 0x87, 0x90, 0x6, 0x85,
+    0x62, 0x2, 0xb2, 0xdb, 0x89, 0xe7, 0x59, 0x0,
+    0x93, 0x5d, 0x9d, 0xcb, 0x54, 0x0,
 
     /* U+00D4 "Ô" */
-    0x0, 0x0, 0x8, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xc1, 0x6e, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
-    0x50, 0x0, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0,
-    0x0, 0x2f, 0xd2, 0x0, 0x0, 0x8f, 0x90, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0x20, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xbf, 0x20, 0x0, 0x0, 0xa, 0xf2, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0x4, 0xff, 0xb8,
-    0x9e, 0xfa, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xb5,
-    0x0, 0x0,
+    0x0, 0xe8, 0xfd, 0x20, 0xf, 0xd2, 0x9d, 0x78,
+    0x40, 0x1f, 0x4e, 0xb, 0x71, 0x0, 0x78, 0x63,
+    0x7f, 0xad, 0x40, 0x39, 0x39, 0xd9, 0xdc, 0xb5,
+    0x40, 0x8, 0xac, 0xb6, 0xe2, 0x79, 0xd6, 0x40,
+    0x12, 0x1e, 0x40, 0x1a, 0x15, 0x88, 0x11, 0x48,
+    0x3, 0xd2, 0xa, 0x41, 0x80, 0x1f, 0x18, 0x70,
+    0x7, 0xff, 0x4, 0x83, 0x0, 0x3e, 0x30, 0xe0,
+    0x45, 0x20, 0xf, 0x48, 0x28, 0x48, 0x79, 0x0,
+    0x68, 0x56, 0x20, 0x2b, 0x2d, 0xb8, 0x9e, 0x75,
+    0x90, 0x9, 0x35, 0xd9, 0xdc, 0xb5, 0x40, 0x0,
 
     /* U+00D5 "Õ" */
-    0x0, 0x0, 0x5d, 0x91, 0x94, 0x0, 0x0, 0x0,
-    0xd, 0x36, 0xdb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
-    0x50, 0x0, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0,
-    0x0, 0x2f, 0xd2, 0x0, 0x0, 0x8f, 0x90, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0x20, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xbf, 0x20, 0x0, 0x0, 0xa, 0xf2, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0x4, 0xff, 0xb8,
-    0x9e, 0xfa, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xb5,
-    0x0, 0x0,
+    0x0, 0xcb, 0xb2, 0x32, 0x80, 0x1f, 0x47, 0x7e,
+    0x12, 0x0, 0x7d, 0xa6, 0xdb, 0x60, 0x1f, 0xc,
+    0x6f, 0xf5, 0xa8, 0x7, 0x27, 0x3b, 0x3b, 0x96,
+    0xa8, 0x1, 0x15, 0x96, 0xdc, 0x4f, 0x3a, 0xc8,
+    0x2, 0x43, 0xc8, 0x3, 0x42, 0xb1, 0x2, 0x29,
+    0x0, 0x7a, 0x41, 0x48, 0x30, 0x3, 0xe3, 0xe,
+    0x0, 0xff, 0xe0, 0x90, 0x60, 0x7, 0xc6, 0x1c,
+    0x8, 0xa4, 0x1, 0xe9, 0x5, 0x9, 0xf, 0x20,
+    0xd, 0xa, 0xc4, 0x5, 0x65, 0xb7, 0x13, 0xce,
+    0xb2, 0x1, 0x26, 0xbb, 0x3b, 0x96, 0xa8, 0x0,
 
     /* U+00D6 "Ö" */
-    0x0, 0x0, 0x5d, 0x6, 0xd0, 0x0, 0x0, 0x0,
-    0x3, 0x90, 0x48, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0xdf, 0xeb,
-    0x50, 0x0, 0x0, 0x4f, 0xfb, 0x89, 0xef, 0xa0,
-    0x0, 0x2f, 0xd2, 0x0, 0x0, 0x8f, 0x90, 0xb,
-    0xf2, 0x0, 0x0, 0x0, 0xaf, 0x20, 0xfa, 0x0,
-    0x0, 0x0, 0x3, 0xf7, 0x2f, 0x60, 0x0, 0x0,
-    0x0, 0xf, 0x92, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xf9, 0xf, 0xa0, 0x0, 0x0, 0x0, 0x3f, 0x70,
-    0xbf, 0x20, 0x0, 0x0, 0xa, 0xf2, 0x2, 0xfd,
-    0x20, 0x0, 0x8, 0xf9, 0x0, 0x4, 0xff, 0xb8,
-    0x9e, 0xfa, 0x0, 0x0, 0x2, 0x8d, 0xfe, 0xb5,
-    0x0, 0x0,
+    0x0, 0xcb, 0xa0, 0xda, 0x1, 0xf9, 0x90, 0x9,
+    0x40, 0x3f, 0x1c, 0x82, 0x40, 0x7, 0xc3, 0x1b,
+    0xfd, 0x6a, 0x1, 0xc9, 0xce, 0xce, 0xe5, 0xaa,
+    0x0, 0x45, 0x65, 0xb7, 0x13, 0xce, 0xb2, 0x0,
+    0x90, 0xf2, 0x0, 0xd0, 0xac, 0x40, 0x8a, 0x40,
+    0x1e, 0x90, 0x52, 0xc, 0x0, 0xf8, 0xc3, 0x80,
+    0x3f, 0xf8, 0x24, 0x18, 0x1, 0xf1, 0x87, 0x2,
+    0x29, 0x0, 0x7a, 0x41, 0x42, 0x43, 0xc8, 0x3,
+    0x42, 0xb1, 0x1, 0x59, 0x6d, 0xc4, 0xf3, 0xac,
+    0x80, 0x49, 0xae, 0xce, 0xe5, 0xaa, 0x0, 0x0,
 
     /* U+00D7 "×" */
-    0x0, 0x0, 0x0, 0x1, 0xc2, 0x0, 0xb4, 0xb,
-    0xe2, 0xbe, 0x20, 0xc, 0xfe, 0x20, 0x0, 0x9f,
-    0xd1, 0x0, 0x8f, 0x5d, 0xc0, 0x1e, 0x50, 0x1e,
-    0x50, 0x10, 0x0, 0x10,
+    0x0, 0xf8, 0x70, 0x80, 0x16, 0x82, 0xf8, 0x56,
+    0xac, 0x16, 0x5a, 0xb8, 0x40, 0x5, 0x3, 0x30,
+    0x2, 0x1a, 0x83, 0x40, 0x5a, 0x97, 0x9, 0x47,
+    0xd4, 0x7, 0xd4,
 
     /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x0, 0x0,
-    0x18, 0xdf, 0xeb, 0x7e, 0x20, 0x0, 0x4f, 0xfb,
-    0x89, 0xef, 0xf0, 0x0, 0x2f, 0xd2, 0x0, 0x8,
-    0xff, 0x90, 0xb, 0xf2, 0x0, 0x3, 0xe2, 0xaf,
-    0x20, 0xfa, 0x0, 0x0, 0xd6, 0x3, 0xf7, 0x2f,
-    0x60, 0x0, 0x8b, 0x0, 0xf, 0x92, 0xf6, 0x0,
-    0x3e, 0x10, 0x0, 0xf9, 0xf, 0xa0, 0xd, 0x50,
-    0x0, 0x3f, 0x70, 0xbf, 0x29, 0xa0, 0x0, 0xa,
-    0xf2, 0x2, 0xff, 0xf1, 0x0, 0x8, 0xf9, 0x0,
-    0x6, 0xff, 0xb8, 0x9e, 0xfa, 0x0, 0x0, 0xab,
-    0x8d, 0xfe, 0xb5, 0x0, 0x0, 0x5d, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0x36, 0x0, 0x61, 0x8d, 0xfe, 0xb7,
+    0x8e, 0x0, 0x93, 0x9d, 0x9d, 0xcb, 0x2, 0x40,
+    0x2, 0xb2, 0xdb, 0x89, 0x60, 0x4, 0x80, 0x24,
+    0x3c, 0x80, 0x6, 0xda, 0xac, 0x40, 0x8a, 0x40,
+    0x17, 0x41, 0x48, 0x29, 0x6, 0x0, 0x50, 0xcc,
+    0x3, 0xe, 0x0, 0xe3, 0x6a, 0x0, 0xe2, 0xc,
+    0x0, 0x75, 0x88, 0x0, 0xc3, 0x81, 0x14, 0xa5,
+    0xd4, 0x2, 0x90, 0x50, 0x90, 0xd6, 0xb0, 0xa,
+    0x15, 0x88, 0xa, 0x40, 0x15, 0x13, 0xce, 0xb2,
+    0x1, 0x62, 0x3b, 0x3b, 0x96, 0xa8, 0x1, 0x2b,
+    0xdc, 0x6f, 0xf5, 0xa8, 0x4,
 
     /* U+00D9 "Ù" */
-    0x0, 0x2c, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30,
-    0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8,
-    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f, 0x16, 0xf3,
-    0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30, 0x0, 0x0,
-    0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8, 0xf0, 0x5f,
-    0x40, 0x0, 0x0, 0x9f, 0x3, 0xf7, 0x0, 0x0,
-    0xc, 0xd0, 0xd, 0xe2, 0x0, 0x5, 0xf8, 0x0,
-    0x4f, 0xfa, 0x8b, 0xfd, 0x0, 0x0, 0x3b, 0xef,
-    0xd8, 0x10, 0x0,
+    0x0, 0x16, 0x60, 0x40, 0x3e, 0x2c, 0x4c, 0x20,
+    0xf, 0xd1, 0xa4, 0x1, 0x9b, 0xcc, 0x3, 0xa3,
+    0xc4, 0x3, 0xff, 0xea, 0x26, 0xe, 0x1, 0xc2,
+    0x0, 0x60, 0x30, 0xe, 0x52, 0x3, 0x29, 0x20,
+    0x9, 0x4d, 0x40, 0x12, 0x3b, 0x51, 0x74, 0x50,
+    0x0, 0x4c, 0x44, 0x3b, 0x3e, 0x0, 0x0,
 
     /* U+00DA "Ú" */
-    0x0, 0x0, 0x4, 0xf9, 0x0, 0x0, 0x0, 0x5,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30,
-    0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8,
-    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f, 0x16, 0xf3,
-    0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30, 0x0, 0x0,
-    0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8, 0xf0, 0x5f,
-    0x40, 0x0, 0x0, 0x9f, 0x3, 0xf7, 0x0, 0x0,
-    0xc, 0xd0, 0xd, 0xe2, 0x0, 0x5, 0xf8, 0x0,
-    0x4f, 0xfa, 0x8b, 0xfd, 0x0, 0x0, 0x3b, 0xef,
-    0xd8, 0x10, 0x0,
+    0x0, 0xe4, 0xf9, 0x0, 0xf9, 0x6a, 0x92, 0x1,
+    0xf2, 0xf2, 0x80, 0x66, 0xf3, 0x0, 0xe8, 0xf1,
+    0x0, 0xff, 0xfa, 0x89, 0x83, 0x80, 0x70, 0x80,
+    0x18, 0xc, 0x3, 0x94, 0x80, 0xca, 0x48, 0x2,
+    0x53, 0x50, 0x4, 0x8e, 0xd4, 0x5d, 0x14, 0x0,
+    0x13, 0x11, 0xe, 0xcf, 0x80, 0x0,
 
     /* U+00DB "Û" */
-    0x0, 0x1, 0xdf, 0x90, 0x0, 0x0, 0x2, 0xd7,
-    0x1b, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30,
-    0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8,
-    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f, 0x16, 0xf3,
-    0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30, 0x0, 0x0,
-    0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8, 0xf0, 0x5f,
-    0x40, 0x0, 0x0, 0x9f, 0x3, 0xf7, 0x0, 0x0,
-    0xc, 0xd0, 0xd, 0xe2, 0x0, 0x5, 0xf8, 0x0,
-    0x4f, 0xfa, 0x8b, 0xfd, 0x0, 0x0, 0x3b, 0xef,
-    0xd8, 0x10, 0x0,
+    0x0, 0x87, 0x7e, 0x40, 0x3c, 0x59, 0x5c, 0x54,
+    0x1, 0xc5, 0xae, 0x37, 0x40, 0x13, 0x79, 0x80,
+    0x74, 0x78, 0x80, 0x7f, 0xfd, 0x44, 0xc1, 0xc0,
+    0x38, 0x40, 0xc, 0x6, 0x1, 0xca, 0x40, 0x65,
+    0x24, 0x1, 0x29, 0xa8, 0x2, 0x47, 0x6a, 0x2e,
+    0x8a, 0x0, 0x9, 0x88, 0x87, 0x67, 0xc0, 0x0,
 
     /* U+00DC "Ü" */
-    0x0, 0xc, 0x70, 0xc6, 0x0, 0x0, 0x0, 0x84,
-    0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xf3, 0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30,
-    0x0, 0x0, 0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8,
-    0xf1, 0x6f, 0x30, 0x0, 0x0, 0x8f, 0x16, 0xf3,
-    0x0, 0x0, 0x8, 0xf1, 0x6f, 0x30, 0x0, 0x0,
-    0x8f, 0x16, 0xf3, 0x0, 0x0, 0x8, 0xf0, 0x5f,
-    0x40, 0x0, 0x0, 0x9f, 0x3, 0xf7, 0x0, 0x0,
-    0xc, 0xd0, 0xd, 0xe2, 0x0, 0x5, 0xf8, 0x0,
-    0x4f, 0xfa, 0x8b, 0xfd, 0x0, 0x0, 0x3b, 0xef,
-    0xd8, 0x10, 0x0,
+    0x0, 0xb1, 0xc3, 0x18, 0x3, 0xc8, 0x60, 0x84,
+    0x1, 0xe8, 0x40, 0x84, 0x0, 0x9b, 0xcc, 0x3,
+    0xa3, 0xc4, 0x3, 0xff, 0xea, 0x26, 0xe, 0x1,
+    0xc2, 0x0, 0x60, 0x30, 0xe, 0x52, 0x3, 0x29,
+    0x20, 0x9, 0x4d, 0x40, 0x12, 0x3b, 0x51, 0x74,
+    0x50, 0x0, 0x4c, 0x44, 0x3b, 0x3e, 0x0, 0x0,
 
     /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x0,
-    0x3, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x6, 0x50,
-    0x0, 0x0, 0xc, 0xe0, 0x0, 0x0, 0x7, 0xf2,
-    0x3, 0xf7, 0x0, 0x0, 0x1f, 0x90, 0x0, 0xaf,
-    0x10, 0x0, 0x9e, 0x10, 0x0, 0x1f, 0xa0, 0x2,
-    0xf6, 0x0, 0x0, 0x8, 0xf3, 0xb, 0xd0, 0x0,
-    0x0, 0x0, 0xec, 0x4f, 0x40, 0x0, 0x0, 0x0,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0,
+    0x0, 0xf2, 0x7c, 0x80, 0x7e, 0x3b, 0x79, 0x0,
+    0xfc, 0xb5, 0x0, 0x1d, 0x9c, 0x0, 0x65, 0x0,
+    0x3f, 0x90, 0x78, 0xb8, 0x6, 0x18, 0x62, 0x3,
+    0x58, 0x10, 0xa, 0x6, 0x0, 0x2b, 0xb, 0x0,
+    0x13, 0x40, 0x80, 0x42, 0xea, 0x61, 0x24, 0xc0,
+    0x1d, 0x3, 0xe8, 0x89, 0x0, 0xfa, 0xce, 0xd1,
+    0x0, 0x1f, 0x29, 0x84, 0x80, 0x7f, 0x28, 0x10,
+    0x7, 0xff, 0x70,
 
     /* U+00DE "Þ" */
-    0x5f, 0x40, 0x0, 0x0, 0x0, 0x5f, 0x62, 0x21,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf9, 0x10, 0x5f,
-    0x85, 0x56, 0x9f, 0xd0, 0x5f, 0x40, 0x0, 0x5,
-    0xf6, 0x5f, 0x40, 0x0, 0x0, 0xfa, 0x5f, 0x40,
-    0x0, 0x0, 0xfa, 0x5f, 0x40, 0x0, 0x4, 0xf8,
-    0x5f, 0x52, 0x23, 0x6e, 0xe1, 0x5f, 0xff, 0xff,
-    0xfc, 0x30, 0x5f, 0x85, 0x54, 0x20, 0x0, 0x5f,
-    0x40, 0x0, 0x0, 0x0,
+    0x5f, 0x40, 0xf, 0xe2, 0x28, 0x40, 0x3d, 0x3b,
+    0xae, 0xf9, 0x10, 0x9, 0xea, 0x92, 0xcc, 0xc0,
+    0xb, 0x15, 0x4d, 0x34, 0x4c, 0x1, 0xf2, 0x86,
+    0x0, 0x7f, 0xf1, 0x50, 0x8, 0x0, 0x24, 0x43,
+    0x6a, 0x19, 0x0, 0x56, 0xeb, 0x24, 0xb4, 0x40,
+    0xf, 0x54, 0xbd, 0xc3, 0x0, 0xb1, 0x54, 0x84,
+    0x1,
 
     /* U+00DF "ß" */
-    0x0, 0x8e, 0xfe, 0x80, 0x0, 0xc, 0xf9, 0x79,
-    0xfb, 0x0, 0x4f, 0x60, 0x0, 0x7f, 0x10, 0x7f,
-    0x0, 0x0, 0x6f, 0x10, 0x8f, 0x0, 0x15, 0xe9,
-    0x0, 0x8f, 0x0, 0xef, 0xf5, 0x0, 0x8f, 0x0,
-    0x35, 0xaf, 0x70, 0x8f, 0x0, 0x0, 0xa, 0xf0,
-    0x8f, 0x0, 0x0, 0x7, 0xf1, 0x8f, 0x0, 0x0,
-    0xb, 0xf0, 0x8f, 0x3, 0x77, 0xbf, 0x70, 0x8f,
-    0x6, 0xff, 0xd6, 0x0,
+    0x0, 0x47, 0x7f, 0x40, 0x6, 0xc7, 0x74, 0x3b,
+    0xac, 0x0, 0x87, 0x32, 0x79, 0x84, 0x10, 0x30,
+    0x60, 0x8, 0x40, 0x2f, 0x0, 0x85, 0x61, 0x84,
+    0x3, 0xbe, 0x87, 0x0, 0x3d, 0xb4, 0xb4, 0xe0,
+    0x1c, 0x6b, 0x4b, 0x0, 0x1f, 0xb4, 0x4, 0x3,
+    0xec, 0x1, 0x0, 0x8d, 0xdd, 0x69, 0x0, 0x19,
+    0x62, 0xd, 0x2e, 0x0,
 
     /* U+00E0 "à" */
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x4d, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0, 0x20,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22, 0x7f,
-    0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4, 0x27,
-    0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0x47, 0xa0, 0x7, 0xa2, 0xe5, 0x40, 0x3c,
+    0x9a, 0xa0, 0x18, 0x67, 0xbf, 0x60, 0x2, 0xd7,
+    0x68, 0x77, 0x48, 0x3, 0xb9, 0xf, 0x4a, 0xc0,
+    0x2, 0x0, 0xd8, 0x4, 0x5, 0x7d, 0xfe, 0x90,
+    0xb, 0x1e, 0xb7, 0x50, 0x0, 0x21, 0x94, 0x22,
+    0x0, 0x44, 0x32, 0x84, 0xf0, 0x1, 0x63, 0xde,
+    0xe4, 0x80, 0x0,
 
     /* U+00E1 "á" */
-    0x0, 0x0, 0x1d, 0xc1, 0x0, 0x0, 0x2d, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0, 0x20,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22, 0x7f,
-    0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4, 0x27,
-    0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0xc3, 0xb8, 0x20, 0x18, 0xb1, 0x70, 0x40,
+    0x31, 0x6c, 0x0, 0x61, 0x9e, 0xfd, 0x80, 0xb,
+    0x5d, 0xa1, 0xdd, 0x20, 0xe, 0xe4, 0x3d, 0x2b,
+    0x0, 0x8, 0x3, 0x60, 0x10, 0x15, 0xf7, 0xfa,
+    0x40, 0x2c, 0x7a, 0xdd, 0x40, 0x0, 0x86, 0x50,
+    0x88, 0x1, 0x10, 0xca, 0x13, 0xc0, 0x5, 0x8f,
+    0x7b, 0x92, 0x0,
 
     /* U+00E2 "â" */
-    0x0, 0x9, 0xfd, 0x10, 0x0, 0xa, 0xa1, 0x7c,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0, 0x20,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22, 0x7f,
-    0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4, 0x27,
-    0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0xa7, 0xf4, 0x40, 0x35, 0x1f, 0x56, 0x88,
+    0x5, 0x54, 0x17, 0xc1, 0x0, 0xc, 0xf7, 0xec,
+    0x0, 0x5a, 0xed, 0xe, 0xe9, 0x0, 0x77, 0x21,
+    0xe9, 0x58, 0x0, 0x40, 0x1b, 0x0, 0x80, 0xaf,
+    0xbf, 0xd2, 0x1, 0x63, 0xd6, 0xea, 0x0, 0x4,
+    0x32, 0x84, 0x40, 0x8, 0x86, 0x50, 0x9e, 0x0,
+    0x2c, 0x7b, 0xdc, 0x90, 0x0,
 
     /* U+00E3 "ã" */
-    0x0, 0x7f, 0xa0, 0xb4, 0x0, 0xd, 0x16, 0xda,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0, 0x20,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22, 0x7f,
-    0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4, 0x27,
-    0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0x3f, 0xd0, 0x5a, 0x0, 0x55, 0xd9, 0xa2,
+    0x80, 0x16, 0x8b, 0x6d, 0x0, 0x43, 0x3d, 0xfb,
+    0x0, 0x16, 0xbb, 0x43, 0xba, 0x40, 0x1d, 0xc8,
+    0x7a, 0x56, 0x0, 0x10, 0x6, 0xc0, 0x20, 0x2b,
+    0xef, 0xf4, 0x80, 0x58, 0xf5, 0xba, 0x80, 0x1,
+    0xc, 0xa1, 0x10, 0x2, 0x21, 0x94, 0x27, 0x80,
+    0xb, 0x1e, 0xf7, 0x24, 0x0,
 
     /* U+00E4 "ä" */
-    0x0, 0x7c, 0x7, 0xb0, 0x0, 0x4, 0x80, 0x47,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xef,
-    0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0, 0x20,
-    0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f, 0x20,
-    0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22, 0x7f,
-    0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4, 0x27,
-    0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0x3e, 0x3, 0xd8, 0x6, 0x34, 0x3, 0xc0,
+    0xc, 0x90, 0x8, 0xe0, 0x10, 0xcf, 0x7e, 0xc0,
+    0x5, 0xae, 0xd0, 0xee, 0x90, 0x7, 0x72, 0x1e,
+    0x95, 0x80, 0x4, 0x1, 0xb0, 0x8, 0xa, 0xfb,
+    0xfd, 0x20, 0x16, 0x3d, 0x6e, 0xa0, 0x0, 0x43,
+    0x28, 0x44, 0x0, 0x88, 0x65, 0x9, 0xe0, 0x2,
+    0xc7, 0xbd, 0xc9, 0x0,
 
     /* U+00E5 "å" */
-    0x0, 0x5, 0xb8, 0x0, 0x0, 0x0, 0xb0, 0x74,
-    0x0, 0x0, 0xb, 0x7, 0x50, 0x0, 0x0, 0x5b,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
-    0xef, 0xd8, 0x0, 0xc, 0xe8, 0x7a, 0xf9, 0x0,
-    0x20, 0x0, 0xa, 0xf0, 0x0, 0x0, 0x0, 0x6f,
-    0x20, 0x2b, 0xef, 0xff, 0xf2, 0xe, 0xc4, 0x22,
-    0x7f, 0x22, 0xf5, 0x0, 0x7, 0xf2, 0xe, 0xc4,
-    0x27, 0xff, 0x20, 0x2b, 0xff, 0xb6, 0xf2,
+    0x0, 0x96, 0xe0, 0x3, 0xdd, 0x7e, 0x80, 0x1f,
+    0x84, 0x3, 0xba, 0xf9, 0x40, 0x39, 0x6e, 0x40,
+    0x30, 0xcf, 0x7e, 0xc0, 0x5, 0xae, 0xd0, 0xee,
+    0x90, 0x7, 0x72, 0x1e, 0x95, 0x80, 0x4, 0x1,
+    0xb0, 0x8, 0xa, 0xfb, 0xfd, 0x20, 0x16, 0x3d,
+    0x6e, 0xa0, 0x0, 0x43, 0x28, 0x44, 0x0, 0x88,
+    0x65, 0x9, 0xe0, 0x2, 0xc7, 0xbd, 0xc9, 0x0,
 
     /* U+00E6 "æ" */
     0x1, 0x9e, 0xfe, 0x80, 0x3b, 0xfe, 0xa2, 0x0,
-    0xb, 0xe8, 0x7a, 0xfb, 0xfd, 0x78, 0xee, 0x20,
-    0x2, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x1e, 0xb0,
-    0x0, 0x0, 0x0, 0x6f, 0x50, 0x0, 0x8, 0xf0,
-    0x3, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xe, 0xb4, 0x22, 0x7f, 0x62, 0x22, 0x22, 0x20,
-    0x2f, 0x60, 0x0, 0x9f, 0xc0, 0x0, 0x2, 0x0,
-    0xe, 0xe8, 0x7a, 0xf8, 0xfd, 0x87, 0xaf, 0x50,
-    0x2, 0xbe, 0xfc, 0x40, 0x3b, 0xef, 0xd6, 0x0,
+    0xa9, 0xda, 0x11, 0xef, 0x1a, 0x19, 0x30, 0x80,
+    0x13, 0xd0, 0xf4, 0xa8, 0x7a, 0xf1, 0xe1, 0x20,
+    0x2, 0x0, 0xd8, 0x12, 0x1, 0xb, 0x20, 0x0,
+    0xef, 0xbf, 0xd2, 0x15, 0xff, 0x9c, 0x8, 0x34,
+    0x2b, 0x75, 0x1, 0x3b, 0xbe, 0x22, 0xe, 0xa1,
+    0x13, 0x82, 0x88, 0xb0, 0x10, 0x10, 0xc4, 0x1e,
+    0x99, 0xcf, 0x61, 0xeb, 0x54, 0x1, 0x8a, 0xd0,
+    0xd7, 0x18, 0xcc, 0x87, 0x95, 0x0,
 
     /* U+00E7 "ç" */
-    0x0, 0x3a, 0xef, 0xc4, 0x0, 0x4f, 0xd8, 0x7c,
-    0xf4, 0xd, 0xd0, 0x0, 0x7, 0x13, 0xf6, 0x0,
-    0x0, 0x0, 0x4f, 0x30, 0x0, 0x0, 0x3, 0xf6,
-    0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x6, 0x10,
-    0x4f, 0xd7, 0x7c, 0xf4, 0x0, 0x3a, 0xff, 0xc4,
-    0x0, 0x0, 0xd, 0x50, 0x0, 0x0, 0x0, 0x2d,
-    0x40, 0x0, 0x0, 0xce, 0xc1, 0x0,
+    0x0, 0x1d, 0x77, 0xe2, 0x0, 0x13, 0x1d, 0xa0,
+    0x2d, 0x2, 0x4b, 0x61, 0xf2, 0x14, 0xca, 0xc0,
+    0x33, 0x8b, 0x82, 0x80, 0x79, 0xc1, 0x40, 0x3c,
+    0x65, 0x60, 0x19, 0x84, 0x24, 0xb5, 0xdd, 0x92,
+    0xa0, 0x98, 0xf1, 0x0, 0xb4, 0x0, 0x1d, 0x15,
+    0x62, 0x0, 0x77, 0xc2, 0x0, 0x76, 0x60, 0x54,
+    0x0,
 
     /* U+00E8 "è" */
-    0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x2, 0xc8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0xa2, 0x0, 0x4, 0xfc, 0x67, 0xee,
-    0x20, 0xe, 0xc0, 0x0, 0x1e, 0xa0, 0x3f, 0x50,
-    0x0, 0x7, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xf1,
-    0x3f, 0x72, 0x22, 0x22, 0x20, 0xe, 0xc0, 0x0,
-    0x2, 0x0, 0x4, 0xfd, 0x87, 0xaf, 0x50, 0x0,
-    0x3a, 0xef, 0xd6, 0x0,
+    0x0, 0x2f, 0xb8, 0x7, 0xcb, 0xb7, 0x0, 0x1f,
+    0x16, 0x40, 0x7, 0x8e, 0xff, 0xa8, 0x80, 0x24,
+    0xc7, 0x99, 0x26, 0x10, 0x2, 0x8f, 0x19, 0xfc,
+    0x20, 0xc, 0x64, 0x2, 0x19, 0x50, 0x70, 0xaf,
+    0xfd, 0x0, 0x2e, 0x11, 0xbb, 0xe1, 0x31, 0xb2,
+    0x2c, 0x4, 0x0, 0xa3, 0xd8, 0x7a, 0xd5, 0x0,
+    0x26, 0x3b, 0x43, 0xca, 0x80,
 
     /* U+00E9 "é" */
-    0x0, 0x0, 0xa, 0xe4, 0x0, 0x0, 0x0, 0xaa,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0xa2, 0x0, 0x4, 0xfc, 0x67, 0xee,
-    0x20, 0xe, 0xc0, 0x0, 0x1e, 0xa0, 0x3f, 0x50,
-    0x0, 0x7, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xf1,
-    0x3f, 0x72, 0x22, 0x22, 0x20, 0xe, 0xc0, 0x0,
-    0x2, 0x0, 0x4, 0xfd, 0x87, 0xaf, 0x50, 0x0,
-    0x3a, 0xef, 0xd6, 0x0,
+    0x0, 0xea, 0xe4, 0x0, 0xf5, 0x7, 0xa0, 0x7,
+    0xaa, 0x82, 0x1, 0xc7, 0x7f, 0xd4, 0x40, 0x12,
+    0x63, 0xcc, 0x93, 0x8, 0x1, 0x47, 0x8c, 0xfe,
+    0x10, 0x6, 0x32, 0x1, 0xc, 0xa8, 0x38, 0x57,
+    0xfe, 0x80, 0x17, 0x8, 0xdd, 0xf0, 0x98, 0xd9,
+    0x16, 0x2, 0x0, 0x51, 0xec, 0x3d, 0x6a, 0x80,
+    0x13, 0x1d, 0xa1, 0xe5, 0x40,
 
     /* U+00EA "ê" */
-    0x0, 0x6, 0xfe, 0x30, 0x0, 0x0, 0x6d, 0x24,
-    0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0xa2, 0x0, 0x4, 0xfc, 0x67, 0xee,
-    0x20, 0xe, 0xc0, 0x0, 0x1e, 0xa0, 0x3f, 0x50,
-    0x0, 0x7, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xf1,
-    0x3f, 0x72, 0x22, 0x22, 0x20, 0xe, 0xc0, 0x0,
-    0x2, 0x0, 0x4, 0xfd, 0x87, 0xaf, 0x50, 0x0,
-    0x3a, 0xef, 0xd6, 0x0,
+    0x0, 0x9b, 0xf8, 0xc0, 0x39, 0xaf, 0x6b, 0x90,
+    0x3, 0x36, 0x92, 0x6a, 0x0, 0x63, 0xbf, 0xea,
+    0x20, 0x9, 0x31, 0xe6, 0x49, 0x84, 0x0, 0xa3,
+    0xc6, 0x7f, 0x8, 0x3, 0x19, 0x0, 0x86, 0x54,
+    0x1c, 0x2b, 0xff, 0x40, 0xb, 0x84, 0x6e, 0xf8,
+    0x4c, 0x6c, 0x8b, 0x1, 0x0, 0x28, 0xf6, 0x1e,
+    0xb5, 0x40, 0x9, 0x8e, 0xd0, 0xf2, 0xa0,
 
     /* U+00EB "ë" */
-    0x0, 0x3e, 0x13, 0xe1, 0x0, 0x0, 0x29, 0x2,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xfe, 0xa2, 0x0, 0x4, 0xfc, 0x67, 0xee,
-    0x20, 0xe, 0xc0, 0x0, 0x1e, 0xa0, 0x3f, 0x50,
-    0x0, 0x7, 0xf0, 0x4f, 0xff, 0xff, 0xff, 0xf1,
-    0x3f, 0x72, 0x22, 0x22, 0x20, 0xe, 0xc0, 0x0,
-    0x2, 0x0, 0x4, 0xfd, 0x87, 0xaf, 0x50, 0x0,
-    0x3a, 0xef, 0xd6, 0x0,
+    0x0, 0x1f, 0x9, 0xf0, 0x80, 0x61, 0x71, 0x13,
+    0x88, 0x6, 0x29, 0x2, 0x90, 0xe, 0x3b, 0xfe,
+    0xa2, 0x0, 0x93, 0x1e, 0x64, 0x98, 0x40, 0xa,
+    0x3c, 0x67, 0xf0, 0x80, 0x31, 0x90, 0x8, 0x65,
+    0x41, 0xc2, 0xbf, 0xf4, 0x0, 0xb8, 0x46, 0xef,
+    0x84, 0xc6, 0xc8, 0xb0, 0x10, 0x2, 0x8f, 0x61,
+    0xeb, 0x54, 0x0, 0x98, 0xed, 0xf, 0x2a, 0x0,
 
     /* U+00EC "ì" */
-    0x2d, 0xc1, 0x0, 0x8, 0xb1, 0x0, 0x0, 0x0,
-    0x8, 0xf0, 0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0,
-    0x8f, 0x0, 0x8, 0xf0, 0x0, 0x8f, 0x0, 0x8,
-    0xf0, 0x0, 0x8f, 0x0, 0x8, 0xf0,
+    0x2d, 0xc1, 0x2, 0xd4, 0xa1, 0x0, 0x45, 0x88,
+    0x2, 0x3c, 0x3, 0xff, 0xba,
 
     /* U+00ED "í" */
-    0x6, 0xf7, 0x6, 0xc3, 0x0, 0x0, 0x0, 0x8,
-    0xf0, 0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0, 0x8f,
-    0x0, 0x8, 0xf0, 0x0, 0x8f, 0x0, 0x8, 0xf0,
-    0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0,
+    0x6, 0xf7, 0x6, 0xac, 0x70, 0x6c, 0x30, 0x4,
+    0x78, 0x7, 0xff, 0x7c,
 
     /* U+00EE "î" */
-    0x1, 0xdf, 0x60, 0xb, 0x72, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x8f, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x8f, 0x0, 0x0, 0x8f,
-    0x0, 0x0, 0x8f, 0x0,
+    0x1, 0xdf, 0x60, 0x5, 0x53, 0x6d, 0x2, 0xdc,
+    0xb5, 0x0, 0x11, 0xe0, 0x1f, 0xfe, 0x60,
 
     /* U+00EF "ï" */
-    0x8a, 0x4e, 0x5, 0x62, 0x90, 0x0, 0x0, 0x0,
-    0x8f, 0x0, 0x8, 0xf0, 0x0, 0x8f, 0x0, 0x8,
-    0xf0, 0x0, 0x8f, 0x0, 0x8, 0xf0, 0x0, 0x8f,
-    0x0, 0x8, 0xf0, 0x0, 0x8f, 0x0,
+    0x8a, 0x4e, 0xd, 0xc6, 0x70, 0x56, 0x29, 0x0,
+    0x47, 0x80, 0x7f, 0xf7, 0x80,
 
     /* U+00F0 "ð" */
-    0x5, 0xdf, 0xec, 0x64, 0x70, 0x4, 0x86, 0x7e,
-    0xff, 0xa0, 0x0, 0x18, 0xee, 0x8f, 0xa0, 0x0,
-    0xcc, 0x50, 0x7, 0xf2, 0x0, 0x0, 0x0, 0x2,
-    0xf6, 0x0, 0x8e, 0xff, 0xa2, 0xf8, 0xa, 0xf9,
-    0x55, 0xbd, 0xf8, 0x2f, 0x80, 0x0, 0xb, 0xf7,
-    0x4f, 0x40, 0x0, 0x7, 0xf3, 0x2f, 0x80, 0x0,
-    0xc, 0xd0, 0x9, 0xfa, 0x67, 0xdf, 0x30, 0x0,
-    0x7d, 0xfe, 0xa2, 0x0,
+    0x5, 0xdf, 0xec, 0x64, 0x70, 0x0, 0xac, 0xc8,
+    0xa6, 0xf4, 0x0, 0x93, 0xd2, 0xe, 0x1, 0xda,
+    0x97, 0xd1, 0x5, 0x20, 0x6, 0x61, 0x40, 0xa,
+    0x8, 0x0, 0x8e, 0xff, 0x50, 0x3, 0x82, 0x9d,
+    0xd5, 0x41, 0xf0, 0x1, 0x2b, 0xca, 0xaa, 0xd8,
+    0x3d, 0x83, 0x0, 0x36, 0x2, 0x30, 0x60, 0x6,
+    0xb2, 0x32, 0x67, 0xa6, 0x7d, 0x3e, 0x0, 0x4c,
+    0x3c, 0xc9, 0xf4, 0xc0,
 
     /* U+00F1 "ñ" */
-    0x0, 0x9f, 0x80, 0xd1, 0x0, 0x1c, 0x18, 0xe8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xe3, 0xbf,
-    0xea, 0x10, 0x8f, 0xfa, 0x68, 0xfd, 0x8, 0xf8,
-    0x0, 0x6, 0xf4, 0x8f, 0x10, 0x0, 0x1f, 0x78,
-    0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0, 0xf,
-    0x88, 0xf0, 0x0, 0x0, 0xf8, 0x8f, 0x0, 0x0,
-    0xf, 0x88, 0xf0, 0x0, 0x0, 0xf8,
+    0x0, 0x4f, 0xc0, 0x68, 0x80, 0x5, 0x78, 0x39,
+    0x44, 0x0, 0x38, 0x31, 0xd0, 0x0, 0x8e, 0x3b,
+    0xfe, 0xa1, 0x0, 0xe, 0xc, 0xb2, 0xe0, 0x4,
+    0xf4, 0xd1, 0x24, 0x80, 0x9, 0x0, 0x9c, 0xc,
+    0x0, 0x20, 0x10, 0x87, 0x80, 0x7f, 0xf6, 0x0,
 
     /* U+00F2 "ò" */
-    0x0, 0x4e, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87, 0xcf,
-    0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f, 0x60,
-    0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0, 0x0,
-    0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60, 0x0,
-    0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0x27, 0x50, 0x7, 0xc9, 0xe3, 0x40, 0x1f,
+    0xd, 0xd0, 0x7, 0x8e, 0xfb, 0xf1, 0x0, 0x24,
+    0xc6, 0x64, 0x5, 0xb0, 0x2, 0x8b, 0x61, 0xf1,
+    0x24, 0x4c, 0x6c, 0x3, 0x40, 0x23, 0x82, 0x80,
+    0x62, 0x2, 0x70, 0x50, 0xc, 0x40, 0x46, 0x36,
+    0x1, 0xa0, 0x10, 0x28, 0xb5, 0xdd, 0x89, 0x22,
+    0x9, 0x8d, 0x30, 0x16, 0xc0,
 
     /* U+00F3 "ó" */
-    0x0, 0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0x8c,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87, 0xcf,
-    0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f, 0x60,
-    0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0, 0x0,
-    0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60, 0x0,
-    0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0xe8, 0xf5, 0x0, 0xf4, 0x26, 0xa8, 0x7,
+    0xa3, 0x8, 0x3, 0x8e, 0xfb, 0xf1, 0x0, 0x24,
+    0xc6, 0x64, 0x5, 0xb0, 0x2, 0x8b, 0x61, 0xf1,
+    0x24, 0x4c, 0x6c, 0x3, 0x40, 0x23, 0x82, 0x80,
+    0x62, 0x2, 0x70, 0x50, 0xc, 0x40, 0x46, 0x36,
+    0x1, 0xa0, 0x10, 0x28, 0xb5, 0xdd, 0x89, 0x22,
+    0x9, 0x8d, 0x30, 0x16, 0xc0,
 
     /* U+00F4 "ô" */
-    0x0, 0x4, 0xef, 0x60, 0x0, 0x0, 0x4d, 0x42,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87, 0xcf,
-    0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f, 0x60,
-    0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0, 0x0,
-    0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60, 0x0,
-    0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0x93, 0xbd, 0x80, 0x39, 0x26, 0xb6, 0xd8,
+    0x3, 0x26, 0xa1, 0x6b, 0x0, 0x63, 0xbe, 0xfc,
+    0x40, 0x9, 0x31, 0x99, 0x1, 0x6c, 0x0, 0xa2,
+    0xd8, 0x7c, 0x49, 0x13, 0x1b, 0x0, 0xd0, 0x8,
+    0xe0, 0xa0, 0x18, 0x80, 0x9c, 0x14, 0x3, 0x10,
+    0x11, 0x8d, 0x80, 0x68, 0x4, 0xa, 0x2d, 0x77,
+    0x62, 0x48, 0x82, 0x63, 0x4c, 0x5, 0xb0, 0x0,
 
     /* U+00F5 "õ" */
-    0x0, 0x2d, 0xd3, 0x4a, 0x0, 0x0, 0x86, 0x3c,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87, 0xcf,
-    0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f, 0x60,
-    0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0, 0x0,
-    0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60, 0x0,
-    0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0x16, 0xe8, 0xd2, 0x80, 0x35, 0x5f, 0x7c,
+    0xc8, 0x3, 0x43, 0x1e, 0x69, 0x80, 0x63, 0xbe,
+    0xfc, 0x40, 0x9, 0x31, 0x99, 0x1, 0x6c, 0x0,
+    0xa2, 0xd8, 0x7c, 0x49, 0x13, 0x1b, 0x0, 0xd0,
+    0x8, 0xe0, 0xa0, 0x18, 0x80, 0x9c, 0x14, 0x3,
+    0x10, 0x11, 0x8d, 0x80, 0x68, 0x4, 0xa, 0x2d,
+    0x77, 0x62, 0x48, 0x82, 0x63, 0x4c, 0x5, 0xb0,
+    0x0,
 
     /* U+00F6 "ö" */
-    0x0, 0x1e, 0x31, 0xe3, 0x0, 0x0, 0x9, 0x20,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xef, 0xc4, 0x0, 0x4, 0xfd, 0x87, 0xcf,
-    0x60, 0xe, 0xd0, 0x0, 0xb, 0xf1, 0x3f, 0x60,
-    0x0, 0x3, 0xf5, 0x4f, 0x30, 0x0, 0x1, 0xf7,
-    0x3f, 0x60, 0x0, 0x3, 0xf5, 0xe, 0xd0, 0x0,
-    0xb, 0xf1, 0x4, 0xfd, 0x77, 0xcf, 0x60, 0x0,
-    0x3b, 0xef, 0xc4, 0x0,
+    0x0, 0xf, 0x18, 0xf1, 0x80, 0x61, 0x71, 0x13,
+    0x90, 0x7, 0x49, 0x4, 0x88, 0x6, 0x3b, 0xef,
+    0xc4, 0x0, 0x93, 0x19, 0x90, 0x16, 0xc0, 0xa,
+    0x2d, 0x87, 0xc4, 0x91, 0x31, 0xb0, 0xd, 0x0,
+    0x8e, 0xa, 0x1, 0x88, 0x9, 0xc1, 0x40, 0x31,
+    0x1, 0x18, 0xd8, 0x6, 0x80, 0x40, 0xa2, 0xd7,
+    0x76, 0x24, 0x88, 0x26, 0x34, 0xc0, 0x5b, 0x0,
 
     /* U+00F7 "÷" */
-    0x0, 0x1e, 0x60, 0x0, 0x0, 0x1e, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x10,
-    0xef, 0xff, 0xff, 0xf3, 0x34, 0x44, 0x44, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0x60, 0x0,
-    0x0, 0x1e, 0x60, 0x0,
+    0x0, 0xf, 0x30, 0x7, 0xff, 0x4, 0x79, 0x80,
+    0x30, 0x8f, 0x83, 0xbb, 0xe3, 0xdb, 0xbf, 0x19,
+    0x91, 0x3c, 0x1, 0xf, 0xb0, 0x7, 0x84, 0x3,
 
     /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x3, 0xb0, 0x0, 0x3b, 0xef,
-    0xcf, 0x20, 0x4, 0xfd, 0x87, 0xff, 0x60, 0xe,
-    0xd0, 0x2, 0xcb, 0xf1, 0x3f, 0x60, 0xb, 0x33,
-    0xf5, 0x4f, 0x30, 0x68, 0x1, 0xf7, 0x3f, 0x61,
-    0xc0, 0x3, 0xf5, 0xe, 0xdb, 0x40, 0xb, 0xf1,
-    0x4, 0xff, 0x77, 0xcf, 0x60, 0x0, 0xfc, 0xef,
-    0xc4, 0x0, 0x9, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0xec, 0x2, 0x3b, 0xef, 0xcc, 0x48,
+    0x1, 0x31, 0x99, 0x6, 0x8, 0x0, 0xa2, 0xd8,
+    0x53, 0x49, 0x13, 0x1b, 0x0, 0x4f, 0xc0, 0x23,
+    0x82, 0x83, 0x19, 0x88, 0x9, 0xc1, 0x46, 0xa0,
+    0x8, 0x8, 0xc6, 0xea, 0x0, 0x10, 0x8, 0x14,
+    0x48, 0x6f, 0x89, 0x22, 0x8, 0x7, 0x30, 0x16,
+    0xc0, 0x9, 0xac, 0xef, 0xc4, 0x0,
 
     /* U+00F9 "ù" */
-    0x1, 0xbd, 0x20, 0x0, 0x0, 0x0, 0x7c, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0,
-    0x0, 0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a,
-    0xe0, 0x0, 0x2, 0xf5, 0x9f, 0x0, 0x0, 0x4f,
-    0x56, 0xf3, 0x0, 0xa, 0xf5, 0xe, 0xe7, 0x6b,
-    0xff, 0x50, 0x2b, 0xef, 0xb3, 0xf5,
+    0x1, 0xbd, 0x20, 0xe, 0x1b, 0xae, 0x20, 0xf,
+    0x3e, 0x10, 0x5, 0x5c, 0x1, 0x8b, 0xd4, 0x3,
+    0xff, 0xb0, 0x62, 0x1, 0x98, 0x1, 0xe0, 0x60,
+    0x17, 0x0, 0x18, 0x75, 0xda, 0xd4, 0x2, 0xc5,
+    0x99, 0x6, 0x0, 0x0,
 
     /* U+00FA "ú" */
-    0x0, 0x0, 0x4f, 0x90, 0x0, 0x0, 0x4d, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0,
-    0x0, 0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a,
-    0xe0, 0x0, 0x2, 0xf5, 0x9f, 0x0, 0x0, 0x4f,
-    0x56, 0xf3, 0x0, 0xa, 0xf5, 0xe, 0xe7, 0x6b,
-    0xff, 0x50, 0x2b, 0xef, 0xb3, 0xf5,
+    0x0, 0xc9, 0xf2, 0x1, 0xc9, 0x37, 0x20, 0x1c,
+    0x9a, 0x80, 0x15, 0x70, 0x6, 0x2f, 0x50, 0xf,
+    0xfe, 0xc1, 0x88, 0x6, 0x60, 0x7, 0x81, 0x80,
+    0x5c, 0x0, 0x61, 0xd7, 0x6b, 0x50, 0xb, 0x16,
+    0x64, 0x18, 0x0,
 
     /* U+00FB "û" */
-    0x0, 0x1d, 0xea, 0x0, 0x0, 0x1c, 0x70, 0x9a,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0,
-    0x0, 0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a,
-    0xe0, 0x0, 0x2, 0xf5, 0x9f, 0x0, 0x0, 0x4f,
-    0x56, 0xf3, 0x0, 0xa, 0xf5, 0xe, 0xe7, 0x6b,
-    0xff, 0x50, 0x2b, 0xef, 0xb3, 0xf5,
+    0x0, 0xe, 0xf5, 0x0, 0x61, 0xda, 0xe3, 0xa0,
+    0x8, 0x71, 0xc2, 0x68, 0x1, 0x5c, 0x1, 0x8b,
+    0xd4, 0x3, 0xff, 0xb0, 0x62, 0x1, 0x98, 0x1,
+    0xe0, 0x60, 0x17, 0x0, 0x18, 0x75, 0xda, 0xd4,
+    0x2, 0xc5, 0x99, 0x6, 0x0, 0x0,
 
     /* U+00FC "ü" */
-    0x0, 0xb7, 0xb, 0x70, 0x0, 0x7, 0x40, 0x74,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a, 0xe0,
-    0x0, 0x2, 0xf5, 0xae, 0x0, 0x0, 0x2f, 0x5a,
-    0xe0, 0x0, 0x2, 0xf5, 0x9f, 0x0, 0x0, 0x4f,
-    0x56, 0xf3, 0x0, 0xa, 0xf5, 0xe, 0xe7, 0x6b,
-    0xff, 0x50, 0x2b, 0xef, 0xb3, 0xf5,
+    0x0, 0x5b, 0x85, 0xb8, 0x6, 0xc3, 0xc, 0x30,
+    0xc, 0xe8, 0xe, 0x80, 0xa, 0xe0, 0xc, 0x5e,
+    0xa0, 0x1f, 0xfd, 0x83, 0x10, 0xc, 0xc0, 0xf,
+    0x3, 0x0, 0xb8, 0x0, 0xc3, 0xae, 0xd6, 0xa0,
+    0x16, 0x2c, 0xc8, 0x30, 0x0,
 
     /* U+00FD "ý" */
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x6c,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0x0, 0xcb, 0x6, 0xf3, 0x0, 0x2,
-    0xf4, 0x0, 0xea, 0x0, 0x9, 0xd0, 0x0, 0x8f,
-    0x10, 0xf, 0x70, 0x0, 0x1f, 0x70, 0x7f, 0x10,
-    0x0, 0xa, 0xe0, 0xd9, 0x0, 0x0, 0x3, 0xf9,
-    0xf2, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x1c, 0x79, 0xf5, 0x0, 0x0, 0x1a, 0xee,
-    0x70, 0x0, 0x0,
+    0x0, 0xe5, 0xf7, 0x0, 0xf3, 0x4e, 0x38, 0x7,
+    0x9b, 0xc, 0x3, 0x6e, 0x0, 0x76, 0x58, 0x59,
+    0x98, 0x2, 0x23, 0xf0, 0x61, 0x90, 0xa, 0xc9,
+    0x0, 0xc, 0xa2, 0x0, 0x6a, 0x0, 0xa4, 0x18,
+    0x1c, 0x18, 0x2, 0x15, 0x90, 0xa6, 0x10, 0xd,
+    0x23, 0x25, 0x60, 0x1c, 0x66, 0x64, 0x20, 0xf,
+    0x50, 0x78, 0x7, 0xd8, 0x48, 0x1, 0xe, 0x3c,
+    0xac, 0x0, 0x73, 0x4b, 0xc2, 0x80, 0x60,
 
     /* U+00FE "þ" */
-    0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x2b, 0xfe, 0xb3, 0x0, 0x8f, 0xec, 0x78, 0xef,
-    0x30, 0x8f, 0xa0, 0x0, 0x1e, 0xc0, 0x8f, 0x20,
-    0x0, 0x7, 0xf1, 0x8f, 0x0, 0x0, 0x5, 0xf3,
-    0x8f, 0x20, 0x0, 0x7, 0xf1, 0x8f, 0xa0, 0x0,
-    0x1e, 0xd0, 0x8f, 0xec, 0x78, 0xef, 0x30, 0x8f,
-    0x2b, 0xfe, 0xb3, 0x0, 0x8f, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0,
+    0x8f, 0x0, 0xff, 0xe9, 0x15, 0xff, 0x59, 0x80,
+    0x6c, 0x78, 0x65, 0xc3, 0x0, 0x93, 0x1e, 0x3c,
+    0x7c, 0x2, 0x80, 0x8, 0x64, 0xc4, 0x0, 0x40,
+    0x18, 0x80, 0x80, 0x4, 0x1, 0x88, 0x8, 0x1,
+    0x0, 0x10, 0xc9, 0x8, 0x1, 0x31, 0xe3, 0xc7,
+    0x80, 0x2c, 0x78, 0x65, 0xc3, 0x0, 0x8a, 0xff,
+    0xac, 0xc0, 0x3f, 0xf9, 0x40,
 
     /* U+00FF "ÿ" */
-    0x0, 0xd, 0x60, 0xd5, 0x0, 0x0, 0x8, 0x30,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xc0, 0x0, 0x0, 0xcb, 0x6, 0xf3, 0x0, 0x2,
-    0xf4, 0x0, 0xea, 0x0, 0x9, 0xd0, 0x0, 0x8f,
-    0x10, 0xf, 0x70, 0x0, 0x1f, 0x70, 0x7f, 0x10,
-    0x0, 0xa, 0xe0, 0xd9, 0x0, 0x0, 0x3, 0xf9,
-    0xf2, 0x0, 0x0, 0x0, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x6f, 0x40, 0x0, 0x0, 0x0, 0xad, 0x0,
-    0x0, 0x1c, 0x79, 0xf5, 0x0, 0x0, 0x1a, 0xee,
-    0x70, 0x0, 0x0,
+    0x0, 0xb5, 0x83, 0x54, 0x3, 0x95, 0x40, 0x8c,
+    0x1, 0xd0, 0x61, 0x26, 0x1, 0x6e, 0x0, 0x76,
+    0x58, 0x59, 0x98, 0x2, 0x23, 0xf0, 0x61, 0x90,
+    0xa, 0xc9, 0x0, 0xc, 0xa2, 0x0, 0x6a, 0x0,
+    0xa4, 0x18, 0x1c, 0x18, 0x2, 0x15, 0x90, 0xa6,
+    0x10, 0xd, 0x23, 0x25, 0x60, 0x1c, 0x66, 0x64,
+    0x20, 0xf, 0x50, 0x78, 0x7, 0xd8, 0x48, 0x1,
+    0xe, 0x3c, 0xac, 0x0, 0x73, 0x4b, 0xc2, 0x80,
+    0x60,
 
     /* U+2022 "•" */
-    0x0, 0x8, 0xf8, 0xef, 0xe7, 0xf7
+    0x0, 0xa3, 0xe1, 0x81, 0xa4, 0x24,
+
+    /* padding */
+    0x0
 };
 
 
@@ -1770,196 +1480,196 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 69, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 69, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18, .adv_w = 100, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 31, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 97, .adv_w = 159, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 177, .adv_w = 216, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 255, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 327, .adv_w = 54, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 332, .adv_w = 86, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 362, .adv_w = 87, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 392, .adv_w = 102, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 417, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 449, .adv_w = 58, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 457, .adv_w = 98, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 466, .adv_w = 58, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 471, .adv_w = 90, .box_w = 8, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 535, .adv_w = 171, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 595, .adv_w = 95, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 625, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 679, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 733, .adv_w = 171, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 799, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 853, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 913, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 967, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1027, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1087, .adv_w = 58, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1101, .adv_w = 58, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1119, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1151, .adv_w = 149, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1175, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1207, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1261, .adv_w = 265, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1381, .adv_w = 187, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1459, .adv_w = 194, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1525, .adv_w = 185, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1591, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1663, .adv_w = 172, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1717, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1771, .adv_w = 198, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1843, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1909, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1927, .adv_w = 131, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1975, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2041, .adv_w = 152, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2095, .adv_w = 244, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2173, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2239, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2317, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2377, .adv_w = 215, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 2482, .adv_w = 186, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2542, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2602, .adv_w = 150, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2662, .adv_w = 202, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2728, .adv_w = 182, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2806, .adv_w = 288, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2914, .adv_w = 172, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2980, .adv_w = 166, .box_w = 12, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3052, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3118, .adv_w = 85, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3156, .adv_w = 90, .box_w = 8, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3220, .adv_w = 85, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3250, .adv_w = 149, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 3278, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 3286, .adv_w = 154, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 3291, .adv_w = 153, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3332, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3392, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3433, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3493, .adv_w = 157, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3538, .adv_w = 90, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3580, .adv_w = 177, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3640, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3694, .adv_w = 71, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3712, .adv_w = 73, .box_w = 6, .box_h = 15, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 3757, .adv_w = 158, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3811, .adv_w = 71, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3823, .adv_w = 271, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3891, .adv_w = 174, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3932, .adv_w = 163, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3977, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4037, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4097, .adv_w = 105, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4124, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4160, .adv_w = 106, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4199, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4240, .adv_w = 143, .box_w = 10, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4285, .adv_w = 230, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4353, .adv_w = 141, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4394, .adv_w = 143, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 4454, .adv_w = 133, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4490, .adv_w = 90, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4535, .adv_w = 77, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4558, .adv_w = 90, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 4596, .adv_w = 149, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 4619, .adv_w = 69, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4619, .adv_w = 69, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4637, .adv_w = 146, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4696, .adv_w = 165, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4762, .adv_w = 179, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 4828, .adv_w = 181, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4906, .adv_w = 77, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 4929, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4985, .adv_w = 154, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 4991, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5069, .adv_w = 103, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 5084, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 5112, .adv_w = 149, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 5136, .adv_w = 98, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
-    {.bitmap_index = 5145, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5223, .adv_w = 154, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
-    {.bitmap_index = 5229, .adv_w = 107, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 5247, .adv_w = 149, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5291, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 5316, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 5341, .adv_w = 154, .box_w = 5, .box_h = 2, .ofs_x = 3, .ofs_y = 10},
-    {.bitmap_index = 5346, .adv_w = 175, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5400, .adv_w = 166, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 5468, .adv_w = 68, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 5473, .adv_w = 154, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 5483, .adv_w = 110, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 5501, .adv_w = 107, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 5519, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 5547, .adv_w = 265, .box_w = 16, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5643, .adv_w = 265, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5733, .adv_w = 265, .box_w = 17, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5835, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5889, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5987, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6085, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6183, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6281, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6379, .adv_w = 187, .box_w = 13, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6490, .adv_w = 268, .box_w = 17, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6592, .adv_w = 185, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6675, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6743, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6811, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6879, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6947, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6985, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7023, .adv_w = 79, .box_w = 7, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7076, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7114, .adv_w = 214, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7192, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7275, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7373, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7471, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7569, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7667, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7765, .adv_w = 149, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 7793, .adv_w = 215, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7884, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7967, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8050, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8133, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8216, .adv_w = 166, .box_w = 12, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8306, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8366, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8426, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8480, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8534, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8588, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8642, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8696, .adv_w = 153, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8759, .adv_w = 253, .box_w = 16, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8831, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 8885, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8945, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9005, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9065, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9125, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9155, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9185, .adv_w = 71, .box_w = 6, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 9221, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9251, .adv_w = 164, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9311, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9365, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9425, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9485, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9545, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9605, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9665, .adv_w = 149, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 9701, .adv_w = 163, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9756, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9810, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9864, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9918, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9972, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 10047, .adv_w = 175, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 10122, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 10197, .adv_w = 80, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 3}
+    {.bitmap_index = 17, .adv_w = 100, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 27, .adv_w = 180, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 91, .adv_w = 159, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 157, .adv_w = 216, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 230, .adv_w = 176, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 296, .adv_w = 54, .box_w = 2, .box_h = 5, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 302, .adv_w = 86, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 333, .adv_w = 87, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 365, .adv_w = 102, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 389, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 414, .adv_w = 58, .box_w = 3, .box_h = 5, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 422, .adv_w = 98, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 430, .adv_w = 58, .box_w = 3, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 435, .adv_w = 90, .box_w = 8, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 482, .adv_w = 171, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 536, .adv_w = 95, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 546, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 594, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 640, .adv_w = 171, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 691, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 739, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 796, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 838, .adv_w = 165, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 898, .adv_w = 158, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 956, .adv_w = 58, .box_w = 3, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 968, .adv_w = 58, .box_w = 3, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 984, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1014, .adv_w = 149, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1029, .adv_w = 149, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1058, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1102, .adv_w = 265, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1214, .adv_w = 187, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1273, .adv_w = 194, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1327, .adv_w = 185, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1379, .adv_w = 211, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1427, .adv_w = 172, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1461, .adv_w = 163, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1491, .adv_w = 198, .box_w = 12, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1548, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1573, .adv_w = 79, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1578, .adv_w = 131, .box_w = 8, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1603, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1652, .adv_w = 152, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1666, .adv_w = 244, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1724, .adv_w = 208, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1766, .adv_w = 215, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1832, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1876, .adv_w = 215, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1961, .adv_w = 186, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2009, .adv_w = 159, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2065, .adv_w = 150, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2084, .adv_w = 202, .box_w = 11, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2118, .adv_w = 182, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2180, .adv_w = 288, .box_w = 18, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2278, .adv_w = 172, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2336, .adv_w = 166, .box_w = 12, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2382, .adv_w = 168, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2429, .adv_w = 85, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2443, .adv_w = 90, .box_w = 8, .box_h = 16, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 2489, .adv_w = 85, .box_w = 4, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2502, .adv_w = 149, .box_w = 8, .box_h = 7, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2528, .adv_w = 128, .box_w = 8, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2532, .adv_w = 154, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 10},
+    {.bitmap_index = 2538, .adv_w = 153, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2578, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2624, .adv_w = 146, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2661, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2709, .adv_w = 157, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2752, .adv_w = 90, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2776, .adv_w = 177, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2836, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2865, .adv_w = 71, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2874, .adv_w = 73, .box_w = 6, .box_h = 15, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 2896, .adv_w = 158, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2933, .adv_w = 71, .box_w = 2, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2938, .adv_w = 271, .box_w = 15, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2978, .adv_w = 174, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3004, .adv_w = 163, .box_w = 10, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3047, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3097, .adv_w = 175, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3147, .adv_w = 105, .box_w = 6, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3163, .adv_w = 128, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3200, .adv_w = 106, .box_w = 7, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3227, .adv_w = 173, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3252, .adv_w = 143, .box_w = 10, .box_h = 9, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3292, .adv_w = 230, .box_w = 15, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3357, .adv_w = 141, .box_w = 9, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3395, .adv_w = 143, .box_w = 10, .box_h = 12, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 3447, .adv_w = 133, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3478, .adv_w = 90, .box_w = 6, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3514, .adv_w = 77, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3519, .adv_w = 90, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3549, .adv_w = 149, .box_w = 9, .box_h = 5, .ofs_x = 0, .ofs_y = 4},
+    {.bitmap_index = 3569, .adv_w = 69, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3569, .adv_w = 69, .box_w = 3, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3587, .adv_w = 146, .box_w = 9, .box_h = 13, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3635, .adv_w = 165, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3686, .adv_w = 179, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 3749, .adv_w = 181, .box_w = 13, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3813, .adv_w = 77, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 3827, .adv_w = 128, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 3882, .adv_w = 154, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 3888, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3961, .adv_w = 103, .box_w = 6, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 3977, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4005, .adv_w = 149, .box_w = 8, .box_h = 6, .ofs_x = 1, .ofs_y = 1},
+    {.bitmap_index = 4021, .adv_w = 98, .box_w = 6, .box_h = 3, .ofs_x = 0, .ofs_y = 3},
+    {.bitmap_index = 4029, .adv_w = 205, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4101, .adv_w = 154, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 10},
+    {.bitmap_index = 4106, .adv_w = 107, .box_w = 6, .box_h = 6, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4123, .adv_w = 149, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4156, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 4180, .adv_w = 110, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 5},
+    {.bitmap_index = 4204, .adv_w = 154, .box_w = 5, .box_h = 2, .ofs_x = 3, .ofs_y = 10},
+    {.bitmap_index = 4210, .adv_w = 175, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4237, .adv_w = 166, .box_w = 9, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4265, .adv_w = 68, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 4270, .adv_w = 154, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = -4},
+    {.bitmap_index = 4280, .adv_w = 110, .box_w = 5, .box_h = 7, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 4290, .adv_w = 107, .box_w = 7, .box_h = 5, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 4308, .adv_w = 129, .box_w = 8, .box_h = 7, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4337, .adv_w = 265, .box_w = 16, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4413, .adv_w = 265, .box_w = 15, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4482, .adv_w = 265, .box_w = 17, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4571, .adv_w = 147, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4615, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4686, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4757, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4831, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4905, .adv_w = 187, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4978, .adv_w = 187, .box_w = 13, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5056, .adv_w = 268, .box_w = 17, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5129, .adv_w = 185, .box_w = 11, .box_h = 15, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 5194, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5240, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5287, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5335, .adv_w = 172, .box_w = 9, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5382, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5396, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5409, .adv_w = 79, .box_w = 7, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5428, .adv_w = 79, .box_w = 5, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5441, .adv_w = 214, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5503, .adv_w = 208, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5560, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5638, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5716, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5796, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5876, .adv_w = 215, .box_w = 13, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5956, .adv_w = 149, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 5983, .adv_w = 215, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 6068, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6115, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6161, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6209, .adv_w = 202, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6257, .adv_w = 166, .box_w = 12, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6316, .adv_w = 185, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6365, .adv_w = 173, .box_w = 10, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6417, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6468, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6519, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6572, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6625, .adv_w = 153, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6677, .adv_w = 153, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6733, .adv_w = 253, .box_w = 16, .box_h = 9, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6803, .adv_w = 146, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 6852, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6905, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6958, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7013, .adv_w = 157, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7069, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7082, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7094, .adv_w = 71, .box_w = 6, .box_h = 12, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7109, .adv_w = 71, .box_w = 5, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7122, .adv_w = 164, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7182, .adv_w = 174, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7222, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7275, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7328, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7384, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7441, .adv_w = 163, .box_w = 10, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7497, .adv_w = 149, .box_w = 8, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 7521, .adv_w = 163, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7575, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7611, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7646, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7684, .adv_w = 173, .box_w = 9, .box_h = 12, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7721, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7784, .adv_w = 175, .box_w = 10, .box_h = 15, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 7837, .adv_w = 143, .box_w = 10, .box_h = 15, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 7902, .adv_w = 80, .box_w = 3, .box_h = 4, .ofs_x = 1, .ofs_y = 3}
 };
 
 /*---------------------
@@ -2621,7 +2331,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
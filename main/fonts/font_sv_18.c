@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 18 px
  * Bpp: 4
- * Opts: --no-compress --no-prefilter --bpp 4 --size 18 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_18.c --force-fast-kern-format
+ * Compressed: tools/fonts/fontpack.py (prefilter + RLE)
+ * Opts: --bpp 4 --size 18 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_18.c --force-fast-kern-format
  ******************************************************************************/
 
 #include "lvgl.h"
@@ -21,2061 +22,1643 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0x9f, 0x68, 0xf6, 0x8f, 0x57, 0xf4, 0x6f, 0x46,
-    0xf3, 0x5f, 0x35, 0xf2, 0x4f, 0x10, 0x0, 0x15,
-    0xa, 0xf7, 0x7f, 0x40,
+    0x9f, 0x61, 0x0, 0xc7, 0xe0, 0x22, 0x0, 0xce,
+    0x60, 0x18, 0x44, 0x6, 0x9e, 0x22, 0x50, 0xba,
+    0x7d, 0x3,
 
     /* U+0022 "\"" */
-    0xda, 0x9, 0xed, 0x90, 0x9d, 0xd9, 0x8, 0xdc,
-    0x80, 0x8d, 0xc8, 0x8, 0xc0, 0x0, 0x0,
+    0xda, 0x9, 0xe0, 0x30, 0x1, 0x80, 0x42, 0x2,
+    0x20, 0xf, 0x87, 0x20, 0x23, 0x0,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0xe5, 0x0, 0x4f, 0x0, 0x0, 0x0,
-    0xf, 0x30, 0x6, 0xe0, 0x0, 0x0, 0x2, 0xf1,
-    0x0, 0x8c, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x5, 0x5a, 0xe5, 0x55, 0xda, 0x55,
-    0x0, 0x0, 0x9b, 0x0, 0xe, 0x60, 0x0, 0x0,
-    0xb, 0x90, 0x0, 0xf4, 0x0, 0x0, 0x11, 0xd8,
-    0x11, 0x3f, 0x31, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x2, 0x45, 0xf6, 0x44, 0x8e, 0x44,
-    0x20, 0x0, 0x2f, 0x10, 0x7, 0xc0, 0x0, 0x0,
-    0x4, 0xf0, 0x0, 0x9a, 0x0, 0x0, 0x0, 0x5e,
-    0x0, 0xb, 0x90, 0x0, 0x0,
+    0x0, 0xdc, 0xa0, 0x4, 0xf0, 0xf, 0x85, 0x80,
+    0x4, 0x20, 0x1e, 0x20, 0x20, 0x7, 0x10, 0x6,
+    0xff, 0x68, 0x77, 0xf9, 0xcf, 0xfc, 0x41, 0x54,
+    0x51, 0xaa, 0x89, 0x6a, 0x84, 0xa, 0xa3, 0x55,
+    0xc7, 0x8a, 0xa0, 0xc, 0x44, 0x0, 0x84, 0x80,
+    0x30, 0x89, 0x84, 0x63, 0x7, 0x10, 0x4, 0x77,
+    0x9, 0xfb, 0x98, 0x19, 0xd2, 0x15, 0x74, 0x13,
+    0x76, 0x71, 0xbb, 0x80, 0x91, 0xc1, 0xd1, 0x1e,
+    0x48, 0x82, 0x0, 0x98, 0x4, 0x1, 0xcc, 0x1,
+    0xe1, 0x10, 0x4, 0x46, 0x1, 0x80,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0xe, 0x40, 0x0,
-    0x0, 0x2, 0xad, 0xff, 0xd9, 0x20, 0x3, 0xff,
-    0xbf, 0xcd, 0xfc, 0x0, 0xbf, 0x40, 0xe4, 0x3,
-    0x30, 0xe, 0xd0, 0xe, 0x40, 0x0, 0x0, 0xdf,
-    0x30, 0xe4, 0x0, 0x0, 0x5, 0xff, 0xaf, 0x50,
-    0x0, 0x0, 0x4, 0xbf, 0xff, 0xd7, 0x0, 0x0,
-    0x0, 0x1e, 0xbe, 0xfb, 0x0, 0x0, 0x0, 0xe4,
-    0xb, 0xf4, 0x0, 0x0, 0xe, 0x40, 0x6f, 0x60,
-    0xb4, 0x0, 0xe4, 0xb, 0xf3, 0x1e, 0xfd, 0xaf,
-    0xbe, 0xfa, 0x0, 0x17, 0xcf, 0xff, 0xc6, 0x0,
-    0x0, 0x0, 0xe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xe4, 0x0, 0x0,
+    0x0, 0xe7, 0x20, 0xf, 0xe9, 0x60, 0xf, 0xfe,
+    0x29, 0x56, 0x8d, 0xec, 0x90, 0x0, 0xf5, 0x58,
+    0xc, 0x1b, 0x80, 0x10, 0x17, 0x61, 0x8d, 0xcf,
+    0x0, 0x29, 0x20, 0x6, 0x33, 0x0, 0xc, 0x8c,
+    0x3, 0xf4, 0x6, 0x50, 0x88, 0x3, 0x96, 0xd1,
+    0x42, 0xb5, 0xc0, 0x32, 0x5f, 0xa, 0x1c, 0x58,
+    0x7, 0x8, 0x7f, 0x22, 0x40, 0x1f, 0xb4, 0x8,
+    0x2d, 0x0, 0x3b, 0x41, 0x45, 0x6f, 0x68, 0x7f,
+    0x91, 0x4c, 0x7e, 0x5, 0x41, 0xa, 0x68, 0x0,
+    0x2f, 0x9e, 0x37, 0x8c, 0x1, 0xff, 0xc1,
 
     /* U+0025 "%" */
-    0x1, 0xbf, 0xc3, 0x0, 0x0, 0x2f, 0x40, 0x0,
-    0xc9, 0x16, 0xe0, 0x0, 0xc, 0x90, 0x0, 0x2f,
-    0x0, 0xc, 0x50, 0x7, 0xe0, 0x0, 0x4, 0xd0,
-    0x0, 0xa7, 0x2, 0xf4, 0x0, 0x0, 0x3f, 0x0,
-    0xc, 0x60, 0xc9, 0x0, 0x0, 0x0, 0xd7, 0x4,
-    0xf1, 0x7e, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xe4,
-    0x2f, 0x41, 0xae, 0xb2, 0x0, 0x0, 0x10, 0xc,
-    0x90, 0xc9, 0x28, 0xe0, 0x0, 0x0, 0x6, 0xe1,
-    0x3f, 0x0, 0xd, 0x50, 0x0, 0x2, 0xf4, 0x4,
-    0xd0, 0x0, 0xa7, 0x0, 0x0, 0xba, 0x0, 0x3e,
-    0x0, 0xc, 0x50, 0x0, 0x6e, 0x10, 0x0, 0xd7,
-    0x5, 0xe1, 0x0, 0x1f, 0x50, 0x0, 0x2, 0xbf,
-    0xc3, 0x0,
+    0x1, 0xbf, 0xc3, 0x0, 0xc5, 0xe8, 0x1, 0x69,
+    0x75, 0x68, 0x6, 0xe6, 0x40, 0x1, 0x1c, 0x8b,
+    0x12, 0x80, 0x1c, 0xa4, 0x2, 0x62, 0x0, 0x98,
+    0x80, 0xa2, 0x80, 0x33, 0x90, 0x4, 0xc2, 0x1c,
+    0xc8, 0x1, 0x8c, 0x9c, 0x10, 0xdd, 0xc5, 0x20,
+    0x1e, 0xea, 0xfa, 0xb3, 0x8a, 0x1a, 0xeb, 0x20,
+    0x1, 0xef, 0x71, 0x39, 0x93, 0x4f, 0xf, 0x0,
+    0x30, 0x83, 0x14, 0x19, 0xa4, 0xa0, 0xd4, 0x3,
+    0x14, 0xd0, 0xb9, 0x0, 0x4e, 0x40, 0x1a, 0x55,
+    0x1, 0xcc, 0x2, 0x62, 0x0, 0x99, 0x6c, 0x0,
+    0x66, 0x70, 0x52, 0x40, 0x0, 0xcd, 0x88, 0x5,
+    0xf9, 0xf3, 0xa2,
 
     /* U+0026 "&" */
-    0x0, 0x4, 0xcf, 0xe9, 0x0, 0x0, 0x0, 0x3,
-    0xfb, 0x57, 0xf9, 0x0, 0x0, 0x0, 0x9f, 0x0,
-    0xa, 0xd0, 0x0, 0x0, 0x8, 0xf1, 0x0, 0xdb,
-    0x0, 0x0, 0x0, 0x2f, 0xb3, 0xce, 0x20, 0x0,
-    0x0, 0x0, 0x6f, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x4e, 0xef, 0xb0, 0x0, 0x10, 0x0, 0x5f, 0xa0,
-    0x6f, 0xb0, 0x1f, 0x50, 0xe, 0xc0, 0x0, 0x6f,
-    0xb7, 0xf2, 0x2, 0xf8, 0x0, 0x0, 0x6f, 0xfb,
-    0x0, 0xf, 0xd0, 0x0, 0x1, 0xdf, 0xb0, 0x0,
-    0x8f, 0xe9, 0x8a, 0xfe, 0x8f, 0xb0, 0x0, 0x5c,
-    0xff, 0xd9, 0x10, 0x68, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0x93, 0x3f, 0xa4, 0x3, 0xe3, 0xb7, 0xa9,
+    0x69, 0x0, 0xf5, 0x5, 0xab, 0xaa, 0x0, 0x78,
+    0x40, 0x40, 0xe, 0xc0, 0x1e, 0xa0, 0xa3, 0xc3,
+    0x90, 0xf, 0x14, 0xa6, 0x6, 0x10, 0x7, 0x92,
+    0x4, 0x1c, 0x80, 0x2, 0x1, 0x2d, 0xa7, 0x4a,
+    0x58, 0xf, 0x28, 0x2, 0xce, 0x81, 0xa5, 0x2d,
+    0x81, 0xc0, 0x85, 0x0, 0x26, 0x94, 0x84, 0x20,
+    0x20, 0x50, 0xc, 0xe4, 0x1, 0xce, 0x5d, 0x31,
+    0x5c, 0x6e, 0x96, 0x0, 0x8a, 0x26, 0x77, 0x37,
+    0xc4, 0x98, 0x4, 0xb9, 0xfe, 0xd9, 0x10, 0x68,
+    0x0,
 
     /* U+0027 "'" */
-    0xda, 0xd9, 0xd9, 0xc8, 0xc8, 0x0,
+    0xda, 0x3, 0x0, 0x8, 0x80, 0x19, 0x0,
 
     /* U+0028 "(" */
-    0x0, 0x6f, 0x40, 0xd, 0xc0, 0x4, 0xf6, 0x0,
-    0x9f, 0x20, 0xd, 0xd0, 0x0, 0xfb, 0x0, 0x2f,
-    0x80, 0x3, 0xf7, 0x0, 0x4f, 0x60, 0x4, 0xf6,
-    0x0, 0x3f, 0x70, 0x2, 0xf8, 0x0, 0xf, 0xb0,
-    0x0, 0xdd, 0x0, 0x8, 0xf1, 0x0, 0x3f, 0x60,
-    0x0, 0xdc, 0x0, 0x6, 0xf4,
+    0x0, 0x37, 0xa0, 0x2, 0xcd, 0x1, 0xa, 0x80,
+    0x1a, 0x8, 0x0, 0x42, 0x20, 0x0, 0x98, 0x0,
+    0x40, 0x60, 0x1, 0xf, 0x0, 0x38, 0x8, 0x7,
+    0xce, 0x2, 0x0, 0x10, 0xf0, 0x1, 0x1, 0x80,
+    0x44, 0xc0, 0x12, 0x90, 0x80, 0x2c, 0x1c, 0x0,
+    0x65, 0x40, 0x15, 0x9a, 0x0,
 
     /* U+0029 ")" */
-    0x3f, 0x70, 0x0, 0xbe, 0x0, 0x5, 0xf5, 0x0,
-    0x1f, 0xa0, 0x0, 0xce, 0x0, 0x9, 0xf1, 0x0,
-    0x7f, 0x30, 0x6, 0xf4, 0x0, 0x5f, 0x50, 0x5,
-    0xf5, 0x0, 0x6f, 0x40, 0x7, 0xf3, 0x0, 0x9f,
-    0x10, 0xc, 0xe0, 0x1, 0xfa, 0x0, 0x5f, 0x50,
-    0xb, 0xe0, 0x3, 0xf7, 0x0,
+    0x3f, 0x70, 0x1, 0xa4, 0x80, 0x5c, 0x2a, 0x0,
+    0x40, 0xf0, 0x0, 0x9a, 0x0, 0x4a, 0x22, 0x0,
+    0x70, 0x10, 0x0, 0x41, 0xc0, 0x6, 0x2, 0x1,
+    0xf1, 0x80, 0x80, 0x4, 0x1c, 0x1, 0xc0, 0x40,
+    0x5, 0x11, 0x0, 0x9a, 0x0, 0x10, 0x3c, 0x1,
+    0xc2, 0xa0, 0x69, 0x20, 0x0,
 
     /* U+002A "*" */
-    0x0, 0xf, 0x20, 0x3, 0x60, 0xe2, 0x56, 0x4d,
-    0xdf, 0xce, 0x60, 0x1d, 0xff, 0x30, 0x4e, 0xcf,
-    0xbf, 0x63, 0x60, 0xe2, 0x45, 0x0, 0xe, 0x20,
-    0x0,
+    0x0, 0xbc, 0x80, 0x6, 0xc0, 0x20, 0xac, 0xf7,
+    0xa3, 0xd6, 0x9, 0x80, 0x3, 0xd6, 0x4f, 0x10,
+    0x4c, 0x67, 0x8c, 0x19, 0xb3, 0x33, 0x0, 0x48,
+    0xa0,
 
     /* U+002B "+" */
-    0x0, 0x1, 0x30, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x8, 0xf0, 0x0, 0x1, 0x22, 0x9f,
-    0x22, 0x20, 0xcf, 0xff, 0xff, 0xff, 0x44, 0x55,
-    0xaf, 0x55, 0x51, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0,
-    0x0,
+    0x0, 0x84, 0xc0, 0x3e, 0x9c, 0x0, 0xff, 0xe0,
+    0x89, 0x10, 0x40, 0x8a, 0xd, 0xd9, 0x83, 0x76,
+    0x48, 0xaa, 0x28, 0x55, 0x4a, 0x8a, 0xa2, 0x5,
+    0x58, 0x40, 0x3f, 0xf8, 0xc0,
 
     /* U+002C "," */
-    0x1, 0x10, 0xe, 0xf1, 0xf, 0xf2, 0x7, 0xe0,
-    0xb, 0x90, 0xe, 0x40,
+    0x1, 0x10, 0x3, 0xf8, 0x40, 0x40, 0xc2, 0x4,
+    0x83, 0x1c, 0x0, 0xba, 0x0,
 
     /* U+002D "-" */
-    0x88, 0x88, 0x7f, 0xff, 0xfe,
+    0x88, 0xce, 0xfd, 0x20,
 
     /* U+002E "." */
-    0x5, 0x60, 0x1f, 0xf2, 0xc, 0xd0,
+    0x5, 0x60, 0x1a, 0x92, 0x13, 0x22,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x57, 0x0, 0x0, 0x0, 0xea,
-    0x0, 0x0, 0x3, 0xf5, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x0, 0x9f, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x9, 0xe0, 0x0,
-    0x0, 0xe, 0x90, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0xf, 0x90, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
+    0x0, 0xf2, 0xb8, 0x7, 0xaf, 0x40, 0x38, 0xc7,
+    0xc0, 0x3a, 0x81, 0x40, 0x39, 0xd4, 0x3, 0x90,
+    0x78, 0x3, 0xb4, 0x10, 0x3, 0x9d, 0x80, 0x39,
+    0x7, 0x40, 0x3b, 0x45, 0x0, 0x39, 0xdc, 0x1,
+    0xc8, 0x3a, 0x1, 0xdc, 0x28, 0x1, 0xca, 0xe0,
+    0x1c, 0xa1, 0x40, 0x1d, 0xe2, 0x60, 0x1c, 0xae,
+    0x1, 0xca, 0x14, 0x1, 0xc0,
 
     /* U+0030 "0" */
-    0x0, 0x4, 0xbe, 0xeb, 0x40, 0x0, 0x0, 0x6f,
-    0xfb, 0xbf, 0xf6, 0x0, 0x2, 0xfd, 0x10, 0x1,
-    0xdf, 0x20, 0xa, 0xf3, 0x0, 0x0, 0x3f, 0x90,
-    0xe, 0xe0, 0x0, 0x0, 0xe, 0xe0, 0xf, 0xb0,
-    0x0, 0x0, 0xb, 0xf0, 0x1f, 0xa0, 0x0, 0x0,
-    0xa, 0xf1, 0xf, 0xb0, 0x0, 0x0, 0xb, 0xf0,
-    0xe, 0xe0, 0x0, 0x0, 0xe, 0xe0, 0x9, 0xf3,
-    0x0, 0x0, 0x3f, 0x90, 0x2, 0xfd, 0x10, 0x1,
-    0xdf, 0x20, 0x0, 0x6f, 0xfb, 0xbf, 0xf6, 0x0,
-    0x0, 0x4, 0xbe, 0xeb, 0x40, 0x0,
+    0x0, 0x92, 0xfb, 0x96, 0x80, 0x1c, 0xd6, 0x8a,
+    0xa4, 0xb6, 0x0, 0x8a, 0x4b, 0xae, 0xdc, 0x52,
+    0x40, 0x8, 0xe, 0x10, 0x0, 0xf0, 0x58, 0x1,
+    0x4, 0xc0, 0x31, 0x8b, 0x80, 0x5, 0x40, 0x3c,
+    0xa2, 0x2, 0x2, 0x1, 0xe1, 0x1, 0x10, 0x8,
+    0x7, 0x84, 0x4, 0x5, 0x40, 0x3c, 0xa2, 0x0,
+    0x71, 0x30, 0xc, 0x62, 0xe0, 0xb, 0xe, 0x10,
+    0x0, 0xf0, 0x58, 0x0, 0xa4, 0xba, 0xed, 0xc5,
+    0x24, 0x1, 0x35, 0xa2, 0xa9, 0x2d, 0x80, 0x0,
 
     /* U+0031 "1" */
-    0xdf, 0xff, 0xc8, 0xaa, 0xfc, 0x0, 0xf, 0xc0,
-    0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0,
-    0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf, 0xc0, 0x0,
-    0xfc, 0x0, 0xf, 0xc0, 0x0, 0xfc, 0x0, 0xf,
-    0xc0,
+    0xdf, 0xfb, 0x15, 0x60, 0x4, 0x55, 0x0, 0x3f,
+    0xfd, 0x0,
 
     /* U+0032 "2" */
-    0x1, 0x8d, 0xfe, 0xc5, 0x0, 0x4f, 0xfd, 0xac,
-    0xff, 0x70, 0x3c, 0x30, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x3f, 0xb0, 0x0, 0x0,
-    0x2, 0xee, 0x20, 0x0, 0x0, 0x2e, 0xf3, 0x0,
-    0x0, 0x2, 0xef, 0x30, 0x0, 0x0, 0x2e, 0xf3,
-    0x0, 0x0, 0x2, 0xef, 0x30, 0x0, 0x0, 0x2e,
-    0xfc, 0xaa, 0xaa, 0xa7, 0x5f, 0xff, 0xff, 0xff,
-    0xfb,
+    0x1, 0x8d, 0xfe, 0xc5, 0x0, 0x27, 0x38, 0x29,
+    0x1d, 0x38, 0x39, 0xe6, 0xd6, 0x68, 0x40, 0x1e,
+    0x18, 0x4, 0x48, 0x4, 0x1, 0xf3, 0x81, 0x80,
+    0x78, 0xcc, 0x82, 0x1, 0xc5, 0xa3, 0x20, 0x1c,
+    0x58, 0x3a, 0x40, 0x18, 0xb0, 0x70, 0xc0, 0x31,
+    0x60, 0xe1, 0x80, 0x62, 0xc1, 0xc3, 0x0, 0xc5,
+    0x82, 0x73, 0x55, 0x9d, 0xc2, 0x6, 0xab, 0xd8,
 
     /* U+0033 "3" */
-    0x5f, 0xff, 0xff, 0xff, 0xf0, 0x3a, 0xaa, 0xaa,
-    0xcf, 0xc0, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0,
-    0x0, 0xc, 0xf3, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x0, 0x0, 0x4, 0xfe, 0x61, 0x0, 0x0, 0x5,
-    0xdf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3e, 0xf2,
-    0x0, 0x0, 0x0, 0x7, 0xf6, 0x0, 0x0, 0x0,
-    0x6, 0xf6, 0x69, 0x10, 0x0, 0x1d, 0xf2, 0x9f,
-    0xfc, 0xbc, 0xff, 0x80, 0x4, 0xae, 0xfe, 0xb5,
-    0x0,
+    0x5f, 0xff, 0xc0, 0xca, 0xbc, 0x60, 0x60, 0x75,
+    0x5a, 0xc8, 0x74, 0x3, 0xda, 0x3a, 0x20, 0x1d,
+    0x27, 0x26, 0x1, 0xc8, 0xc2, 0x2, 0x1, 0xc2,
+    0x43, 0x3c, 0xa0, 0x19, 0x77, 0xf0, 0x68, 0x80,
+    0x3c, 0x72, 0x8, 0x1, 0xf0, 0x80, 0x1a, 0x44,
+    0x2, 0x1b, 0x4, 0xf6, 0xec, 0xbc, 0xe2, 0x72,
+    0x9b, 0x52, 0x42, 0x4a, 0x80,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xed, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0, 0x0,
-    0x0, 0x5, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xc0, 0x3, 0xc5, 0x0, 0x0, 0xde, 0x10, 0x4,
-    0xf7, 0x0, 0xb, 0xf4, 0x0, 0x4, 0xf7, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x39, 0x99,
-    0x99, 0x9b, 0xfc, 0x98, 0x0, 0x0, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xf7, 0x0,
+    0x0, 0xf2, 0x7d, 0x0, 0x7e, 0x1a, 0x2a, 0x0,
+    0xfd, 0xa3, 0xe0, 0x1f, 0xa4, 0xe8, 0x80, 0x3e,
+    0x56, 0x62, 0x80, 0x7c, 0x54, 0x72, 0x7, 0x8a,
+    0x1, 0xbc, 0x74, 0x0, 0xe6, 0x40, 0x15, 0x95,
+    0x8, 0x7, 0xc8, 0x80, 0xbf, 0xfa, 0xc2, 0x3f,
+    0x5d, 0x9b, 0xc8, 0x6, 0xca, 0x73, 0x3e, 0xe0,
+    0xb9, 0x80, 0xf, 0xfe, 0x60,
 
     /* U+0035 "5" */
-    0x2, 0xff, 0xff, 0xff, 0xf0, 0x4, 0xfc, 0xaa,
-    0xaa, 0xa0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x7,
-    0xf3, 0x0, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xc7, 0x0, 0x7, 0xaa,
-    0xab, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb, 0xf6,
-    0x0, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x0, 0x0,
-    0x3, 0xfa, 0x2c, 0x20, 0x0, 0xb, 0xf6, 0x6f,
-    0xfd, 0xbb, 0xef, 0xb0, 0x3, 0x9d, 0xff, 0xc7,
-    0x0,
+    0x2, 0xff, 0xf8, 0x0, 0xc0, 0x6a, 0xbc, 0x0,
+    0x10, 0x9a, 0xae, 0x0, 0x10, 0x30, 0x7, 0xdc,
+    0x4, 0x1, 0xf1, 0x87, 0x7f, 0xb1, 0xc0, 0x2d,
+    0x55, 0x90, 0xe3, 0x0, 0xf, 0x55, 0x5f, 0xa1,
+    0xb0, 0x7, 0xd0, 0x18, 0x1, 0xfe, 0x2c, 0x20,
+    0xd, 0x1, 0x88, 0x7b, 0xab, 0xb7, 0x22, 0x19,
+    0x98, 0xc0, 0x88, 0x28, 0xb0,
 
     /* U+0036 "6" */
-    0x0, 0x1, 0x8d, 0xfe, 0xc6, 0x0, 0x4, 0xef,
-    0xca, 0xad, 0x90, 0x1, 0xee, 0x40, 0x0, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xfb, 0x2a, 0xef, 0xd7,
-    0x0, 0x1f, 0xdf, 0xd9, 0x9d, 0xfb, 0x1, 0xff,
-    0xa0, 0x0, 0xa, 0xf5, 0xf, 0xf2, 0x0, 0x0,
-    0x3f, 0x90, 0xbf, 0x20, 0x0, 0x3, 0xf8, 0x4,
-    0xfa, 0x0, 0x0, 0xaf, 0x40, 0x9, 0xfd, 0x99,
-    0xdf, 0xa0, 0x0, 0x5, 0xcf, 0xfc, 0x60, 0x0,
+    0x0, 0x86, 0x37, 0xfb, 0x18, 0x2, 0x4f, 0x71,
+    0x54, 0x1f, 0x0, 0xd, 0x5, 0xe5, 0x53, 0x64,
+    0x1, 0x23, 0x48, 0x1, 0xf3, 0xa, 0x0, 0x7e,
+    0x15, 0x2a, 0xef, 0xd7, 0x0, 0x8, 0x36, 0xbb,
+    0x98, 0x22, 0xc0, 0x22, 0x5d, 0x99, 0x6a, 0xa2,
+    0x88, 0x2, 0x0, 0x34, 0x86, 0x2, 0x0, 0x7e,
+    0x10, 0xf0, 0x80, 0xd, 0x21, 0x80, 0x8c, 0xbb,
+    0x32, 0xd5, 0x52, 0x0, 0x26, 0x85, 0x98, 0x33,
+    0x40,
 
     /* U+0037 "7" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0x7, 0xfb, 0xaa,
-    0xaa, 0xaf, 0xe0, 0x7f, 0x40, 0x0, 0x5, 0xf8,
-    0x6, 0xf4, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0,
-    0x0, 0x3f, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0x50, 0x0, 0x0, 0x0, 0xe, 0xe0,
-    0x0, 0x0, 0x0, 0x6, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x10, 0x0, 0x0, 0x0, 0x4f, 0x90,
-    0x0, 0x0, 0x0, 0xb, 0xf2, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xe0, 0x9, 0x15, 0x78, 0x4, 0x2,
+    0xfa, 0xad, 0xe0, 0xc0, 0x20, 0x1e, 0x90, 0x90,
+    0x6f, 0x40, 0x8, 0xcc, 0xa2, 0x1, 0xf4, 0x84,
+    0x80, 0x7c, 0x2a, 0x66, 0x0, 0xfa, 0x42, 0x40,
+    0x3f, 0x30, 0xa8, 0x7, 0xcc, 0x32, 0x1, 0xfa,
+    0xc1, 0x80, 0x3e, 0x42, 0x61, 0x0, 0xfb, 0xc2,
+    0xc0, 0x38,
 
     /* U+0038 "8" */
-    0x0, 0x2a, 0xef, 0xfc, 0x70, 0x0, 0x3f, 0xfb,
-    0x89, 0xdf, 0xb0, 0xa, 0xf5, 0x0, 0x0, 0xbf,
-    0x30, 0xbf, 0x10, 0x0, 0x8, 0xf4, 0x4, 0xfc,
-    0x42, 0x26, 0xfd, 0x0, 0x6, 0xff, 0xff, 0xfe,
-    0x10, 0x5, 0xfe, 0x85, 0x6a, 0xfd, 0x10, 0xee,
-    0x10, 0x0, 0x7, 0xf8, 0x2f, 0xa0, 0x0, 0x0,
-    0x1f, 0xb2, 0xfb, 0x0, 0x0, 0x2, 0xfb, 0xd,
-    0xf4, 0x0, 0x0, 0xaf, 0x70, 0x3f, 0xfb, 0x89,
-    0xdf, 0xc0, 0x0, 0x29, 0xdf, 0xfc, 0x60, 0x0,
+    0x0, 0x15, 0x77, 0xfb, 0x1c, 0x2, 0x3d, 0x55,
+    0x3b, 0xc, 0x58, 0x2, 0x42, 0xae, 0x27, 0x51,
+    0x6, 0x2, 0x8, 0x1, 0x8c, 0x1c, 0x3c, 0x35,
+    0x8, 0x8c, 0xe4, 0x80, 0x92, 0x77, 0xba, 0x91,
+    0xc0, 0x2, 0xc8, 0xbd, 0x4a, 0x8e, 0x8, 0x58,
+    0xfc, 0x2b, 0x54, 0x14, 0x90, 0xa0, 0x80, 0x66,
+    0x3, 0x0, 0x8, 0x7, 0x18, 0x0, 0x88, 0x88,
+    0x0, 0xd0, 0x18, 0x1c, 0x17, 0x68, 0x9d, 0x53,
+    0x70, 0x3d, 0x66, 0x3b, 0xc, 0xe0, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x6c, 0xff, 0xc6, 0x0, 0x0, 0xaf, 0xd9,
-    0x8c, 0xfa, 0x0, 0x3f, 0xb0, 0x0, 0x7, 0xf6,
-    0x7, 0xf5, 0x0, 0x0, 0xf, 0xd0, 0x6f, 0x60,
-    0x0, 0x2, 0xff, 0x11, 0xff, 0x51, 0x4, 0xdf,
-    0xf2, 0x4, 0xef, 0xff, 0xfb, 0x9f, 0x30, 0x0,
-    0x57, 0x73, 0xa, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xa0, 0x0,
-    0x0, 0x0, 0x3e, 0xf2, 0x0, 0x8e, 0xba, 0xcf,
-    0xf5, 0x0, 0x5, 0xbe, 0xfd, 0x92, 0x0, 0x0,
+    0x0, 0x36, 0x7f, 0xb1, 0x80, 0x35, 0x48, 0xb3,
+    0x84, 0xd0, 0x0, 0xd5, 0x36, 0x63, 0x21, 0x58,
+    0x10, 0x38, 0x3, 0x38, 0x58, 0x8, 0x18, 0x6,
+    0x20, 0x21, 0x70, 0x95, 0x10, 0x4f, 0x0, 0x18,
+    0xd8, 0xd7, 0x7d, 0xb3, 0x0, 0x41, 0x3a, 0xa2,
+    0x19, 0x66, 0x4, 0x1, 0x2b, 0xb8, 0xc1, 0xc0,
+    0x40, 0x3e, 0x42, 0x50, 0xf, 0x8e, 0x82, 0x0,
+    0x11, 0xd7, 0x59, 0x81, 0xa2, 0x0, 0x6a, 0xac,
+    0x2d, 0xaa, 0x0,
 
     /* U+003A ":" */
-    0xc, 0xd0, 0x1f, 0xf2, 0x5, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x60,
-    0x1f, 0xf2, 0xc, 0xd0,
+    0xc, 0xd0, 0x13, 0x22, 0xd, 0x49, 0x2, 0xb0,
+    0x7, 0xff, 0x9, 0x58, 0x6, 0xa4, 0x84, 0xc8,
+    0x80,
 
     /* U+003B ";" */
-    0xc, 0xd0, 0x1f, 0xf2, 0x5, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10,
-    0xe, 0xf1, 0xf, 0xf2, 0x7, 0xe0, 0xb, 0x90,
-    0xe, 0x40,
+    0xc, 0xd0, 0x13, 0x22, 0xd, 0x49, 0x2, 0xb0,
+    0x7, 0xff, 0x8, 0x44, 0x0, 0xfe, 0x10, 0x10,
+    0x30, 0x81, 0x20, 0xc7, 0x0, 0x2e, 0x80,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x5, 0x20, 0x0, 0x1, 0x8e,
-    0xf4, 0x0, 0x4b, 0xff, 0x93, 0x6, 0xdf, 0xc6,
-    0x0, 0x0, 0xcf, 0x80, 0x0, 0x0, 0x5, 0xcf,
-    0xe7, 0x10, 0x0, 0x0, 0x39, 0xff, 0xb4, 0x0,
-    0x0, 0x1, 0x6d, 0xf4, 0x0, 0x0, 0x0, 0x4,
-    0x20,
+    0x0, 0xf9, 0x48, 0x3, 0xc, 0x75, 0x30, 0x1,
+    0x2f, 0x9d, 0xd8, 0x8d, 0xb6, 0xf3, 0xf2, 0x61,
+    0x44, 0xf8, 0xc0, 0x1a, 0x4d, 0xf9, 0xc4, 0x2,
+    0x5c, 0xc3, 0xc7, 0x5a, 0x0, 0x47, 0x3d, 0x2d,
+    0x68, 0x1, 0x85, 0xb6, 0xd8,
 
     /* U+003D "=" */
-    0xcf, 0xff, 0xff, 0xff, 0x46, 0x77, 0x77, 0x77,
-    0x72, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x12, 0x22, 0x22, 0x22, 0xc, 0xff,
-    0xff, 0xff, 0xf4, 0x45, 0x55, 0x55, 0x55, 0x10,
+    0xcf, 0xff, 0x92, 0xa2, 0x3e, 0x66, 0x3b, 0xfc,
+    0x40, 0x1f, 0xc2, 0x45, 0xf0, 0x6e, 0xfe, 0x48,
+    0xaa, 0xf9, 0x40,
 
     /* U+003E ">" */
-    0x62, 0x0, 0x0, 0x0, 0xc, 0xfb, 0x40, 0x0,
-    0x0, 0x6, 0xcf, 0xe7, 0x10, 0x0, 0x0, 0x39,
-    0xff, 0xa1, 0x0, 0x0, 0x2, 0xdf, 0x40, 0x0,
-    0x4b, 0xff, 0x91, 0x18, 0xef, 0xc6, 0x0, 0xc,
-    0xfa, 0x30, 0x0, 0x0, 0x51, 0x0, 0x0, 0x0,
-    0x0,
+    0x62, 0x0, 0xfa, 0xb6, 0xd0, 0x3, 0xb2, 0x5e,
+    0xf9, 0xc4, 0x2, 0x6c, 0xc3, 0xc7, 0x50, 0x80,
+    0x47, 0x3a, 0x4a, 0xa0, 0x9, 0x2f, 0x49, 0x94,
+    0x63, 0xad, 0xe7, 0xe4, 0x75, 0xd3, 0x30, 0xc0,
+    0x14, 0xf5, 0x18, 0x7,
 
     /* U+003F "?" */
-    0x2, 0x9d, 0xfe, 0xc5, 0x0, 0x4f, 0xfb, 0x9b,
-    0xff, 0x80, 0x4c, 0x20, 0x0, 0x2f, 0xf0, 0x0,
-    0x0, 0x0, 0xc, 0xf0, 0x0, 0x0, 0x0, 0x1f,
-    0xc0, 0x0, 0x0, 0x1, 0xcf, 0x30, 0x0, 0x0,
-    0x1d, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0x50, 0x0,
-    0x0, 0x0, 0xac, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x33, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0x10, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0,
+    0x2, 0x9d, 0xfe, 0xc5, 0x0, 0x26, 0xb3, 0x4a,
+    0x75, 0x0, 0x3, 0xdb, 0x9b, 0xd0, 0x70, 0x4c,
+    0x20, 0x8, 0x8c, 0x3, 0xf0, 0x99, 0x80, 0x3c,
+    0x3a, 0x1e, 0x1, 0xc3, 0x87, 0x66, 0x1, 0xd0,
+    0x54, 0x80, 0x1e, 0x33, 0x28, 0x7, 0xd5, 0x80,
+    0x1f, 0x8c, 0xc0, 0x1f, 0xe, 0x60, 0x40, 0x3c,
+    0x26, 0x42, 0x1,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x2, 0x9d, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xc7, 0x54, 0x58, 0xdf,
-    0x60, 0x0, 0x0, 0xc, 0xe4, 0x0, 0x0, 0x0,
-    0x6, 0xf9, 0x0, 0x0, 0xae, 0x10, 0x3b, 0xef,
-    0xb2, 0xbd, 0x3f, 0x60, 0x4, 0xf4, 0x4, 0xfe,
-    0x97, 0xcf, 0xed, 0x6, 0xe0, 0xa, 0xc0, 0xe,
-    0xe1, 0x0, 0x8, 0xfd, 0x0, 0xe5, 0xe, 0x60,
-    0x4f, 0x60, 0x0, 0x0, 0xfd, 0x0, 0xa9, 0x1f,
-    0x40, 0x6f, 0x30, 0x0, 0x0, 0xcd, 0x0, 0x8b,
-    0x2f, 0x30, 0x6f, 0x30, 0x0, 0x0, 0xcd, 0x0,
-    0x8b, 0x1f, 0x40, 0x3f, 0x60, 0x0, 0x0, 0xfd,
-    0x0, 0x99, 0xe, 0x60, 0xe, 0xe1, 0x0, 0x8,
-    0xfe, 0x0, 0xe5, 0xa, 0xc0, 0x4, 0xfe, 0x87,
-    0xbf, 0xaf, 0x9b, 0xe0, 0x4, 0xf4, 0x0, 0x3b,
-    0xff, 0xb3, 0x1b, 0xfc, 0x30, 0x0, 0x9e, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xe4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xc7, 0x54, 0x6a, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x9d, 0xff, 0xdb, 0x50, 0x0,
-    0x0,
+    0x0, 0xe2, 0x9d, 0xff, 0x76, 0x38, 0x80, 0x7e,
+    0x9d, 0x5a, 0xa5, 0xd9, 0x2b, 0x98, 0x3, 0xd8,
+    0xf7, 0x8e, 0xa8, 0xb1, 0xb3, 0x30, 0x6, 0xa2,
+    0xf4, 0x3b, 0xef, 0xb2, 0xbb, 0x63, 0x30, 0x0,
+    0x8b, 0x42, 0x98, 0xaf, 0xf, 0xaa, 0x7, 0x30,
+    0x0, 0xe3, 0x40, 0xa1, 0xf9, 0x7c, 0x71, 0x0,
+    0x30, 0x28, 0x25, 0x2, 0xc, 0x8, 0x5, 0x0,
+    0x19, 0x30, 0x44, 0x40, 0x40, 0xa0, 0x1c, 0x60,
+    0x11, 0x10, 0xc1, 0xc0, 0x3f, 0xf8, 0x66, 0xe,
+    0xa, 0xa, 0x1, 0xc6, 0x1, 0x9, 0x8, 0x88,
+    0xc, 0x60, 0x40, 0x28, 0x3, 0x0, 0x3e, 0x2,
+    0x50, 0x2, 0x87, 0xe1, 0xed, 0xd4, 0x66, 0xc1,
+    0x43, 0x8d, 0x1, 0x31, 0x5e, 0x3, 0x2d, 0x19,
+    0xf4, 0x0, 0x8d, 0x42, 0x7, 0x7f, 0xeb, 0x31,
+    0xbf, 0xc3, 0x0, 0xa4, 0xbd, 0x0, 0x3f, 0xf8,
+    0x78, 0xf7, 0x8e, 0xa8, 0xd5, 0xc0, 0x1f, 0xd3,
+    0x8b, 0x54, 0xbb, 0xd, 0x80, 0x70,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdd, 0xb, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0x60, 0x4f, 0x70, 0x0, 0x0, 0x0, 0xb,
-    0xe0, 0x0, 0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8,
-    0x0, 0x6, 0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10,
-    0x0, 0xe, 0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x7, 0xf8, 0x88, 0x88,
-    0x88, 0xfa, 0x0, 0x0, 0xed, 0x0, 0x0, 0x0,
-    0xb, 0xf1, 0x0, 0x5f, 0x60, 0x0, 0x0, 0x0,
-    0x4f, 0x80, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xee, 0x0,
+    0x0, 0xf4, 0x7d, 0x0, 0x7f, 0xe6, 0x5, 0x20,
+    0xf, 0xf3, 0xc, 0x85, 0x80, 0x7f, 0xac, 0x99,
+    0x18, 0x3, 0xf9, 0xa, 0xc3, 0xc1, 0xc0, 0x3f,
+    0x78, 0xb0, 0x21, 0x50, 0x7, 0xc4, 0x8c, 0x1,
+    0x59, 0x28, 0x7, 0xac, 0x24, 0x2, 0x61, 0x90,
+    0xe, 0x16, 0xe, 0xff, 0xc2, 0x66, 0x0, 0xcc,
+    0xe, 0xff, 0x4, 0x80, 0x69, 0x28, 0x8f, 0x91,
+    0x44, 0x0, 0xa3, 0x60, 0x1f, 0x78, 0x48, 0x2,
+    0x41, 0xc0, 0x3e, 0x41, 0x60,
 
     /* U+0042 "B" */
-    0x1f, 0xff, 0xff, 0xfe, 0xb4, 0x0, 0x1f, 0xd8,
-    0x88, 0x8a, 0xff, 0x70, 0x1f, 0xb0, 0x0, 0x0,
-    0x2f, 0xf0, 0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0,
-    0x1f, 0xb0, 0x0, 0x0, 0x2f, 0xc0, 0x1f, 0xd8,
-    0x88, 0x8a, 0xfe, 0x30, 0x1f, 0xff, 0xff, 0xff,
-    0xfd, 0x40, 0x1f, 0xb0, 0x0, 0x1, 0x4d, 0xf3,
-    0x1f, 0xb0, 0x0, 0x0, 0x4, 0xf9, 0x1f, 0xb0,
-    0x0, 0x0, 0x2, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
-    0x8, 0xf8, 0x1f, 0xd8, 0x88, 0x89, 0xcf, 0xe1,
-    0x1f, 0xff, 0xff, 0xff, 0xd9, 0x10,
+    0x1f, 0xff, 0x75, 0xa0, 0x6, 0x27, 0x7c, 0x88,
+    0xb7, 0x0, 0x9a, 0x23, 0x56, 0x84, 0x0, 0x7f,
+    0x11, 0x80, 0x7f, 0x88, 0xcc, 0x1, 0x34, 0x46,
+    0xad, 0x1f, 0x0, 0x89, 0xdf, 0x28, 0x1b, 0x80,
+    0x49, 0xff, 0xba, 0xc2, 0xcc, 0x3, 0xe1, 0x49,
+    0xa, 0x0, 0xfe, 0x60, 0x20, 0xf, 0xea, 0x3,
+    0x0, 0x34, 0x46, 0x9c, 0x71, 0x90, 0x1, 0x3b,
+    0xe6, 0x16, 0xf1,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x1,
-    0xbf, 0xfc, 0xac, 0xff, 0xb0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0x9c, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xac, 0x10,
-    0x1, 0xbf, 0xfc, 0xbc, 0xff, 0xb0, 0x0, 0x0,
-    0x4b, 0xef, 0xeb, 0x50, 0x0,
+    0x0, 0xc9, 0x5d, 0xfd, 0x6a, 0x1, 0x86, 0xec,
+    0xa4, 0xa4, 0x95, 0x60, 0x15, 0x22, 0x37, 0x2b,
+    0x39, 0x9c, 0x0, 0xc8, 0x8b, 0x20, 0x8, 0x67,
+    0x0, 0x16, 0x14, 0x1, 0xfe, 0x23, 0x10, 0xf,
+    0xe1, 0x6, 0x0, 0xff, 0x8, 0x30, 0x7, 0xfc,
+    0x46, 0x20, 0x1f, 0xeb, 0xa, 0x0, 0xff, 0x32,
+    0x22, 0xc8, 0x2, 0x1a, 0xc1, 0x0, 0x52, 0x23,
+    0x72, 0xf3, 0x95, 0xc4, 0x0, 0x37, 0x64, 0x24,
+    0x24, 0xab, 0x0,
 
     /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xfd, 0xa4, 0x0, 0x1, 0xfe,
-    0xaa, 0xaa, 0xcf, 0xfa, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x2b, 0xfa, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0xc, 0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x3f,
-    0xb1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xee, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xee, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x3f, 0xb1, 0xfb, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x1f, 0xb0, 0x0, 0x0, 0x2b, 0xfa, 0x1,
-    0xfe, 0xaa, 0xaa, 0xcf, 0xfa, 0x0, 0x1f, 0xff,
-    0xff, 0xfd, 0xa4, 0x0, 0x0,
+    0x1f, 0xff, 0x6d, 0x20, 0x7, 0xa, 0xae, 0x15,
+    0xba, 0x0, 0xcb, 0x55, 0xb3, 0x51, 0x68, 0x3,
+    0xf8, 0xac, 0xd5, 0x0, 0x3f, 0xde, 0x1e, 0x1,
+    0xfe, 0x31, 0x50, 0xf, 0xf8, 0xc4, 0x3, 0xfe,
+    0x31, 0x0, 0xff, 0x18, 0xa8, 0x7, 0xfb, 0xc3,
+    0xc0, 0x3f, 0x15, 0x9a, 0xa0, 0x1, 0x6a, 0xb6,
+    0x6a, 0x2d, 0x0, 0x42, 0xab, 0x85, 0x6e, 0x80,
+    0x0,
 
     /* U+0045 "E" */
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1, 0xfe, 0xaa,
-    0xaa, 0xaa, 0x70, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x99, 0x99, 0x99,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xfe, 0xaa, 0xaa,
-    0xaa, 0xa0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x1f, 0xff, 0xd8, 0x1, 0xa, 0xaf, 0xac, 0x2,
+    0x5a, 0xaf, 0x38, 0x7, 0xff, 0x35, 0xa6, 0x7c,
+    0x1, 0x89, 0x9b, 0xc0, 0x19, 0x3f, 0xfc, 0x1,
+    0xff, 0xd9, 0x5a, 0xaf, 0x80, 0x21, 0x55, 0xf8,
+    0x0,
 
     /* U+0046 "F" */
-    0x1f, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xea, 0xaa,
-    0xaa, 0xa7, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf0, 0x1f, 0xe9, 0x99, 0x99, 0x90,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0,
+    0x1f, 0xff, 0xd8, 0x0, 0x15, 0x5f, 0x58, 0x1,
+    0x6a, 0xbc, 0xe0, 0x1f, 0xfd, 0x44, 0xff, 0xf0,
+    0x4, 0x2c, 0xde, 0x0, 0x96, 0x67, 0xc0, 0x1f,
+    0xfd, 0xd0,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x60, 0x0, 0x1,
-    0xbf, 0xfc, 0xbb, 0xff, 0xc1, 0x0, 0xbf, 0xb2,
-    0x0, 0x0, 0x7d, 0x10, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x39, 0x30, 0xfc, 0x0,
-    0x0, 0x0, 0x6, 0xf5, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x6f, 0x50, 0x6f, 0xb0, 0x0, 0x0, 0x6,
-    0xf5, 0x0, 0xbf, 0xb2, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0xaf, 0xfd, 0xbc, 0xff, 0xd2, 0x0, 0x0,
-    0x4a, 0xef, 0xeb, 0x60, 0x0,
+    0x0, 0xc9, 0x5b, 0xfd, 0x6c, 0x1, 0x86, 0xec,
+    0xa2, 0x8a, 0x93, 0x82, 0x0, 0xa4, 0x46, 0xe5,
+    0xdb, 0xe0, 0x40, 0xc, 0x88, 0xb2, 0x0, 0xcf,
+    0xa2, 0x16, 0x14, 0x1, 0xfe, 0x23, 0x10, 0xf,
+    0xe1, 0x6, 0x0, 0xf8, 0xe4, 0xc4, 0x18, 0x3,
+    0xe5, 0x66, 0x1, 0x98, 0x40, 0x3f, 0xd4, 0x14,
+    0x1, 0xfe, 0x64, 0x45, 0x90, 0x6, 0xf0, 0xd,
+    0x6a, 0x9b, 0xab, 0xcf, 0x62, 0x70, 0xa, 0xad,
+    0x4d, 0x9, 0x27, 0x48,
 
     /* U+0048 "H" */
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xea,
-    0xaa, 0xaa, 0xaa, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
-    0x1, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb,
+    0x1f, 0xb0, 0xf, 0xf, 0xd8, 0x7, 0xff, 0x99,
+    0x6a, 0xbd, 0x60, 0x18, 0x55, 0x7e, 0x0, 0xc9,
+    0xff, 0xee, 0x0, 0xff, 0xf9, 0x0,
 
     /* U+0049 "I" */
-    0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1,
-    0xfb, 0x1f, 0xb1, 0xfb, 0x1f, 0xb1, 0xfb, 0x1f,
-    0xb1, 0xfb, 0x1f, 0xb0,
+    0x1f, 0xb0, 0xf, 0xfe, 0xc0,
 
     /* U+004A "J" */
-    0x0, 0xef, 0xff, 0xff, 0x70, 0x8, 0xaa, 0xab,
-    0xf7, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0, 0x0,
-    0x5, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0x70, 0x0,
-    0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x5f, 0x70,
-    0x0, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x6, 0xf6, 0xa, 0x70, 0x0,
-    0xcf, 0x30, 0xcf, 0xda, 0xdf, 0xc0, 0x0, 0x8d,
-    0xfe, 0x90, 0x0,
+    0x0, 0x77, 0xff, 0x38, 0x1, 0x95, 0x64, 0x0,
+    0xd1, 0x55, 0x70, 0x7, 0xff, 0xc8, 0xc0, 0x42,
+    0x9c, 0x2, 0xa0, 0x50, 0x68, 0xda, 0xd3, 0x38,
+    0x31, 0xc1, 0x4d, 0xb0, 0x0,
 
     /* U+004B "K" */
-    0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xe2, 0x1f, 0xb0,
-    0x0, 0x1, 0xdf, 0x30, 0x1f, 0xb0, 0x0, 0xc,
-    0xf4, 0x0, 0x1f, 0xb0, 0x0, 0xbf, 0x50, 0x0,
-    0x1f, 0xb0, 0xb, 0xf7, 0x0, 0x0, 0x1f, 0xb0,
-    0xaf, 0x80, 0x0, 0x0, 0x1f, 0xb9, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xff, 0xbb, 0xf8, 0x0, 0x0,
-    0x1f, 0xfb, 0x1, 0xdf, 0x50, 0x0, 0x1f, 0xd0,
-    0x0, 0x2f, 0xf2, 0x0, 0x1f, 0xb0, 0x0, 0x4,
-    0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0, 0x7f, 0xb0,
-    0x1f, 0xb0, 0x0, 0x0, 0x9, 0xf8,
+    0x1f, 0xb0, 0xe, 0x1d, 0xe2, 0x0, 0xf8, 0x70,
+    0xb4, 0x80, 0x3e, 0xd2, 0xb3, 0x0, 0xfa, 0xce,
+    0x90, 0x3, 0xeb, 0x48, 0x50, 0xf, 0xa9, 0x1d,
+    0xc0, 0x1f, 0x4a, 0x81, 0x80, 0x7c, 0x8c, 0x89,
+    0x40, 0x7, 0xc9, 0x74, 0x4e, 0xa0, 0x1c, 0x56,
+    0x3, 0xe1, 0x44, 0x1, 0x98, 0x2, 0x2b, 0xf,
+    0x10, 0xf, 0xc9, 0x5, 0x40, 0x1f, 0xce, 0xc9,
+    0x0,
 
     /* U+004C "L" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xea, 0xaa, 0xaa, 0xa5, 0x1f, 0xff, 0xff, 0xff,
-    0xf8,
+    0x1f, 0xb0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x59,
+    0x6a, 0xbc, 0xa0, 0x1, 0x55, 0xf6, 0x80,
 
     /* U+004D "M" */
-    0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x41,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xf4, 0x1f,
-    0xfc, 0x0, 0x0, 0x0, 0x9, 0xff, 0x41, 0xff,
-    0xf5, 0x0, 0x0, 0x2, 0xfe, 0xf4, 0x1f, 0xad,
-    0xe0, 0x0, 0x0, 0xbe, 0x8f, 0x41, 0xfa, 0x4f,
-    0x80, 0x0, 0x4f, 0x67, 0xf4, 0x1f, 0xa0, 0xaf,
-    0x20, 0xd, 0xd0, 0x7f, 0x41, 0xfa, 0x2, 0xfa,
-    0x7, 0xf4, 0x7, 0xf4, 0x1f, 0xa0, 0x8, 0xf5,
-    0xea, 0x0, 0x7f, 0x41, 0xfa, 0x0, 0xe, 0xff,
-    0x20, 0x6, 0xf4, 0x1f, 0xa0, 0x0, 0x5f, 0x80,
-    0x0, 0x6f, 0x41, 0xfa, 0x0, 0x0, 0x60, 0x0,
-    0x6, 0xf4, 0x1f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x40,
+    0x1f, 0xa0, 0xf, 0xe7, 0xf4, 0x0, 0x29, 0x80,
+    0x7c, 0x30, 0x1, 0xde, 0x1, 0xf4, 0x0, 0x78,
+    0xd4, 0x3, 0x89, 0x84, 0x3, 0x29, 0x58, 0x7,
+    0x48, 0xb0, 0x7, 0x48, 0xc0, 0x4, 0x88, 0x8f,
+    0x0, 0xe4, 0x57, 0x20, 0x4, 0x93, 0x0, 0x7d,
+    0x1, 0x0, 0xe5, 0x20, 0x1f, 0x89, 0xd5, 0x52,
+    0xa8, 0x1, 0xfd, 0x3, 0x43, 0x0, 0x1, 0x0,
+    0xfd, 0x60, 0xe4, 0x1, 0xff, 0x2c, 0xc0, 0x7,
+    0xff, 0x5, 0x80, 0x3e,
 
     /* U+004E "N" */
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xf8,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0x50, 0x0,
-    0x1, 0xfb, 0x1f, 0xdf, 0xf2, 0x0, 0x1, 0xfb,
-    0x1f, 0xb6, 0xfd, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
-    0x9f, 0xa0, 0x1, 0xfb, 0x1f, 0xb0, 0xc, 0xf6,
-    0x1, 0xfb, 0x1f, 0xb0, 0x1, 0xef, 0x31, 0xfb,
-    0x1f, 0xb0, 0x0, 0x4f, 0xe2, 0xfb, 0x1f, 0xb0,
-    0x0, 0x7, 0xfd, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
-    0xbf, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x2, 0xfb,
+    0x1f, 0xb0, 0xf, 0xf, 0xd8, 0x1, 0x20, 0x3,
+    0xfe, 0x75, 0x0, 0xfe, 0x20, 0xa2, 0x0, 0xfc,
+    0xd2, 0x1e, 0x1, 0xfc, 0xcc, 0x2a, 0x0, 0xfe,
+    0x93, 0x56, 0x0, 0xfe, 0xd1, 0x93, 0x0, 0xfc,
+    0x34, 0x1a, 0x60, 0x1f, 0x92, 0x7, 0xc0, 0x3f,
+    0x9d, 0x8, 0x3, 0xfd, 0x44, 0x1, 0xfe, 0x1f,
+    0x0,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0,
-    0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1,
-    0xaf, 0xd0, 0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50,
-    0x0, 0x0,
+    0x0, 0xc9, 0x5b, 0xfd, 0x6a, 0x1, 0xf5, 0x5a,
+    0x8a, 0x12, 0x56, 0x8, 0x6, 0xb5, 0x4d, 0xcb,
+    0xce, 0x53, 0xc0, 0x9, 0x91, 0x16, 0x40, 0x10,
+    0xd3, 0x14, 0x0, 0x28, 0x28, 0x3, 0xe9, 0x6,
+    0x0, 0x19, 0x84, 0x3, 0xf2, 0x89, 0x8, 0x30,
+    0x7, 0xf1, 0x80, 0x88, 0x18, 0x3, 0xf8, 0xc0,
+    0x40, 0xcc, 0x20, 0x1f, 0x94, 0x48, 0x28, 0x28,
+    0x3, 0xe9, 0x6, 0x0, 0x32, 0x22, 0xc8, 0x2,
+    0x1a, 0x62, 0x80, 0xa, 0xd5, 0x37, 0x2f, 0x39,
+    0x4f, 0x0, 0x3a, 0xad, 0x49, 0x9, 0x2b, 0x4,
+    0x0,
 
     /* U+0050 "P" */
-    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xea,
-    0xaa, 0xbe, 0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0,
-    0x9f, 0x90, 0x1f, 0xb0, 0x0, 0x0, 0xe, 0xf0,
-    0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0, 0x1f, 0xb0,
-    0x0, 0x0, 0xe, 0xf0, 0x1f, 0xb0, 0x0, 0x0,
-    0x9f, 0x90, 0x1f, 0xea, 0xaa, 0xbe, 0xfd, 0x10,
-    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x63, 0x80, 0x70, 0xaa, 0xc8, 0x51,
+    0xa2, 0x1, 0x2d, 0x55, 0x7c, 0xc5, 0x0, 0x1f,
+    0xd2, 0x2c, 0x1, 0xfe, 0x20, 0xf, 0xf8, 0x80,
+    0x3f, 0xd2, 0x2c, 0x1, 0x2d, 0x55, 0x7c, 0xc5,
+    0x0, 0x10, 0xaa, 0xc8, 0x51, 0xa2, 0x1, 0x27,
+    0xfe, 0xc7, 0x0, 0xff, 0xed, 0x80,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0,
-    0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xf1, 0x1f, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xf2, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x8f, 0x80, 0x0, 0xcf, 0xa1, 0x0, 0x0,
-    0x9f, 0xd0, 0x0, 0x1, 0xcf, 0xfb, 0xab, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x6c, 0xef, 0xfd, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xe6, 0x34,
-    0xa7, 0x0, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0x43, 0x0,
+    0x0, 0xc9, 0x5b, 0xfd, 0x6a, 0x1, 0xf5, 0x5a,
+    0x8a, 0x12, 0x56, 0x8, 0x6, 0xb5, 0x4d, 0xcb,
+    0xce, 0x53, 0xc0, 0x9, 0x91, 0x16, 0x40, 0x10,
+    0xd3, 0x14, 0x0, 0x28, 0x28, 0x3, 0xe9, 0x6,
+    0x0, 0x19, 0x84, 0x3, 0xf2, 0x88, 0xc0, 0xc0,
+    0x1f, 0xc6, 0x4, 0x20, 0xc0, 0x1f, 0xc6, 0x2,
+    0x4, 0x62, 0x1, 0xf9, 0x44, 0x82, 0x82, 0xc0,
+    0x3e, 0x80, 0x60, 0x3, 0x9a, 0xd0, 0x80, 0x69,
+    0x72, 0x80, 0xb, 0x4d, 0x7a, 0xea, 0xfd, 0x8b,
+    0x0, 0x30, 0xe4, 0x9a, 0xa9, 0xa, 0x74, 0x40,
+    0x3c, 0xd9, 0xd4, 0x6, 0x6, 0x94, 0xe0, 0x1f,
+    0x2e, 0x14, 0xe5, 0xa1, 0x80, 0x7e, 0x3c, 0xdb,
+    0xce, 0x40,
 
     /* U+0052 "R" */
-    0x1f, 0xff, 0xff, 0xfc, 0x70, 0x0, 0x1f, 0xea,
-    0xaa, 0xbe, 0xfd, 0x10, 0x1f, 0xb0, 0x0, 0x0,
-    0x9f, 0x90, 0x1f, 0xb0, 0x0, 0x0, 0xe, 0xf0,
-    0x1f, 0xb0, 0x0, 0x0, 0xc, 0xf0, 0x1f, 0xb0,
-    0x0, 0x0, 0xe, 0xe0, 0x1f, 0xb0, 0x0, 0x0,
-    0x9f, 0x90, 0x1f, 0xd9, 0x99, 0xae, 0xfd, 0x10,
-    0x1f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x1f, 0xb0,
-    0x0, 0x1f, 0xd0, 0x0, 0x1f, 0xb0, 0x0, 0x6,
-    0xf9, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0xbf, 0x40,
-    0x1f, 0xb0, 0x0, 0x0, 0x1e, 0xe0,
+    0x1f, 0xff, 0x63, 0x80, 0x70, 0xaa, 0xc8, 0x51,
+    0xa2, 0x1, 0x2d, 0x55, 0x7c, 0xc5, 0x0, 0x1f,
+    0xd2, 0x2c, 0x1, 0xfe, 0x20, 0xf, 0xf8, 0x84,
+    0x3, 0xfa, 0x45, 0xc0, 0x26, 0x99, 0xab, 0x98,
+    0xa0, 0x2, 0x26, 0x69, 0x45, 0x74, 0x40, 0x24,
+    0xff, 0xb8, 0x1c, 0x3, 0xf8, 0x64, 0xa4, 0x3,
+    0xf9, 0x91, 0x90, 0x3, 0xfa, 0x86, 0x80,
 
     /* U+0053 "S" */
-    0x0, 0x29, 0xdf, 0xfd, 0x81, 0x0, 0x3f, 0xfc,
-    0x9a, 0xdf, 0xc0, 0xb, 0xf4, 0x0, 0x0, 0x23,
-    0x0, 0xed, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xfa, 0x61, 0x0,
-    0x0, 0x0, 0x3b, 0xff, 0xfd, 0x70, 0x0, 0x0,
-    0x0, 0x48, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x0, 0x6, 0xf6, 0xb,
-    0x50, 0x0, 0x0, 0xcf, 0x31, 0xdf, 0xeb, 0x9a,
-    0xef, 0x90, 0x0, 0x6b, 0xef, 0xeb, 0x50, 0x0,
+    0x0, 0x14, 0xef, 0xfb, 0x60, 0x40, 0x7, 0xac,
+    0x2c, 0xa0, 0xfa, 0x0, 0x80, 0xbc, 0x9a, 0xdd,
+    0x78, 0x1, 0x49, 0x0, 0x31, 0x18, 0x0, 0x88,
+    0x60, 0x1f, 0xa4, 0x32, 0x98, 0x40, 0x39, 0x71,
+    0x16, 0x7b, 0x5c, 0x3, 0x1d, 0xfd, 0xb9, 0xc5,
+    0x80, 0x79, 0x23, 0x91, 0x20, 0xf, 0xda, 0x4,
+    0x16, 0xa0, 0x1d, 0x40, 0xa2, 0xd5, 0xd7, 0x35,
+    0xc6, 0xc6, 0x3b, 0x2a, 0xa6, 0x45, 0xa9, 0x0,
 
     /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x89, 0xaa, 0xad,
-    0xfb, 0xaa, 0xa5, 0x0, 0x0, 0x9f, 0x20, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0, 0x0,
-    0x9, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x20,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x20, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0x0,
+    0xef, 0xff, 0xe8, 0x75, 0x58, 0x81, 0x15, 0x6d,
+    0x9a, 0xa9, 0x2, 0x6a, 0xa5, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf5, 0xc0,
 
     /* U+0055 "U" */
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x3f, 0x90, 0xf, 0x2f, 0xb8, 0x7, 0xff, 0xfc,
+    0x3, 0xf0, 0x88, 0x8, 0x3, 0xc4, 0x6, 0x42,
+    0x80, 0x1e, 0xc0, 0x70, 0x60, 0xa0, 0xc, 0xe8,
+    0x82, 0x8, 0x35, 0xfb, 0xb7, 0x40, 0xc8, 0x5,
+    0x90, 0x68, 0x83, 0x7f, 0x20,
 
     /* U+0056 "V" */
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x2, 0xf9, 0x6,
-    0xf8, 0x0, 0x0, 0x0, 0x9, 0xf3, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x1f, 0xc0, 0x0, 0x8f, 0x60,
-    0x0, 0x0, 0x7f, 0x50, 0x0, 0x1f, 0xd0, 0x0,
-    0x0, 0xee, 0x0, 0x0, 0xa, 0xf4, 0x0, 0x5,
-    0xf7, 0x0, 0x0, 0x3, 0xfb, 0x0, 0xc, 0xf1,
-    0x0, 0x0, 0x0, 0xdf, 0x20, 0x2f, 0xa0, 0x0,
-    0x0, 0x0, 0x6f, 0x80, 0x9f, 0x30, 0x0, 0x0,
-    0x0, 0xe, 0xe1, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x80, 0x0, 0x0,
+    0xc, 0xf2, 0x0, 0xf8, 0xbe, 0x42, 0x82, 0x80,
+    0x3e, 0xb0, 0xa0, 0x61, 0x70, 0xf, 0xb, 0x19,
+    0x80, 0xc, 0xc, 0x1, 0xcc, 0x12, 0x1, 0x48,
+    0x58, 0x7, 0x48, 0xa8, 0x4, 0x2a, 0x48, 0x1,
+    0x28, 0xc8, 0x7, 0x48, 0x78, 0x5, 0x20, 0xc0,
+    0x1c, 0x64, 0x84, 0x4, 0x6a, 0x20, 0x1e, 0xb0,
+    0xa0, 0xb0, 0x90, 0xf, 0x98, 0x58, 0x58, 0xcc,
+    0x1, 0xf9, 0x87, 0x42, 0x40, 0x3f, 0xa4, 0xc,
+    0x54, 0x3, 0xf8, 0x54, 0x18, 0x3, 0x80,
 
     /* U+0057 "W" */
-    0x4f, 0x90, 0x0, 0x0, 0xc, 0xf3, 0x0, 0x0,
-    0x2, 0xf8, 0xe, 0xe0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x8, 0xf3, 0x9, 0xf3, 0x0, 0x0,
-    0x7f, 0xfd, 0x0, 0x0, 0xd, 0xe0, 0x4, 0xf8,
-    0x0, 0x0, 0xcd, 0x8f, 0x20, 0x0, 0x2f, 0x80,
-    0x0, 0xfe, 0x0, 0x2, 0xf8, 0x3f, 0x80, 0x0,
-    0x7f, 0x30, 0x0, 0xaf, 0x30, 0x7, 0xf3, 0xe,
-    0xd0, 0x0, 0xde, 0x0, 0x0, 0x5f, 0x80, 0xc,
-    0xd0, 0x8, 0xf2, 0x2, 0xf9, 0x0, 0x0, 0xf,
-    0xd0, 0x2f, 0x80, 0x3, 0xf7, 0x7, 0xf4, 0x0,
-    0x0, 0xa, 0xf2, 0x7f, 0x30, 0x0, 0xed, 0xc,
-    0xe0, 0x0, 0x0, 0x5, 0xf7, 0xde, 0x0, 0x0,
-    0x9f, 0x4f, 0x90, 0x0, 0x0, 0x0, 0xfe, 0xf8,
-    0x0, 0x0, 0x3f, 0xdf, 0x40, 0x0, 0x0, 0x0,
-    0xbf, 0xf3, 0x0, 0x0, 0xe, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x9, 0xfa,
-    0x0, 0x0,
+    0x4f, 0x90, 0xf, 0x67, 0x98, 0x7, 0x17, 0xc2,
+    0xb, 0x80, 0x71, 0x18, 0x58, 0x7, 0x50, 0x58,
+    0x38, 0x98, 0x6, 0x50, 0x2, 0x80, 0x72, 0x89,
+    0x86, 0x85, 0x80, 0x6b, 0x27, 0x22, 0x0, 0x44,
+    0x46, 0x0, 0x20, 0x30, 0x4, 0x46, 0xb6, 0x14,
+    0x1, 0x28, 0x58, 0x4, 0xa2, 0x60, 0x5, 0xb,
+    0x31, 0x50, 0xa, 0x84, 0xc0, 0x2f, 0xb, 0x0,
+    0x59, 0x18, 0x31, 0x10, 0x8, 0x8e, 0x1, 0x94,
+    0x14, 0x8, 0xd4, 0x1, 0x60, 0xa0, 0xa1, 0xa0,
+    0x1c, 0xa4, 0x45, 0xb, 0x0, 0x18, 0xd0, 0x58,
+    0xa0, 0x7, 0x78, 0x2d, 0x9, 0x80, 0x4e, 0x48,
+    0x6e, 0x1, 0xe5, 0x9, 0x26, 0x0, 0xd4, 0x12,
+    0x1a, 0x1, 0xf2, 0x8, 0x58, 0x6, 0x31, 0x20,
+    0x40, 0xf, 0xb4, 0x4, 0xc0, 0x39, 0xc1, 0x40,
+    0x30,
 
     /* U+0058 "X" */
-    0x2f, 0xd0, 0x0, 0x0, 0xb, 0xf3, 0x6, 0xfa,
-    0x0, 0x0, 0x7f, 0x70, 0x0, 0xbf, 0x50, 0x2,
-    0xfc, 0x0, 0x0, 0x1e, 0xe1, 0xd, 0xf2, 0x0,
-    0x0, 0x5, 0xfb, 0x8f, 0x50, 0x0, 0x0, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe, 0x10, 0x0,
-    0x0, 0x9, 0xf6, 0x5f, 0xa0, 0x0, 0x0, 0x4f,
-    0xb0, 0xa, 0xf6, 0x0, 0x1, 0xee, 0x10, 0x1,
-    0xef, 0x20, 0xb, 0xf5, 0x0, 0x0, 0x4f, 0xc0,
-    0x6f, 0xa0, 0x0, 0x0, 0x8, 0xf8,
+    0x2f, 0xd0, 0xf, 0x5f, 0x99, 0x49, 0x50, 0x6,
+    0x74, 0x83, 0x6, 0x45, 0x50, 0x0, 0xa0, 0xdc,
+    0x2, 0xa1, 0xb1, 0xf, 0xe, 0x0, 0xc3, 0x63,
+    0x50, 0x54, 0x40, 0x1c, 0xac, 0x8e, 0xaa, 0x0,
+    0xfa, 0x80, 0x1e, 0x1, 0xfb, 0x80, 0x16, 0x20,
+    0x1e, 0x92, 0x9a, 0x1b, 0x0, 0xe4, 0x64, 0x65,
+    0x59, 0x80, 0x21, 0xa1, 0xa0, 0x5, 0x8c, 0x90,
+    0x2, 0x86, 0xc4, 0x0, 0x34, 0x1c, 0xc, 0x8a,
+    0xa0, 0xc, 0x8e, 0x70,
 
     /* U+0059 "Y" */
-    0xc, 0xf2, 0x0, 0x0, 0x0, 0x5f, 0x60, 0x3f,
-    0xb0, 0x0, 0x0, 0xe, 0xd0, 0x0, 0x9f, 0x50,
-    0x0, 0x8, 0xf3, 0x0, 0x1, 0xee, 0x0, 0x2,
-    0xfa, 0x0, 0x0, 0x6, 0xf8, 0x0, 0xbf, 0x10,
-    0x0, 0x0, 0xc, 0xf1, 0x4f, 0x70, 0x0, 0x0,
-    0x0, 0x3f, 0xbd, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x2, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0,
+    0xc, 0xf2, 0x0, 0xf2, 0xfb, 0x7, 0x84, 0x80,
+    0x7a, 0xc9, 0x80, 0xd9, 0x14, 0x3, 0x40, 0xf0,
+    0x5, 0x3, 0x60, 0x11, 0x3a, 0x98, 0x4, 0x30,
+    0x30, 0x0, 0x90, 0xb0, 0xe, 0x63, 0x71, 0x44,
+    0x40, 0x80, 0x7b, 0xc2, 0xa4, 0x9c, 0x3, 0xe3,
+    0x54, 0x29, 0x0, 0xfe, 0x80, 0x34, 0x0, 0xfe,
+    0x30, 0x70, 0xf, 0xff, 0x0,
 
     /* U+005A "Z" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xa, 0xaa,
-    0xaa, 0xaa, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0x20, 0x0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x5, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xa0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfb, 0xaa, 0xaa, 0xaa, 0xa2,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x1f, 0xff, 0xf0, 0x89, 0x57, 0xe3, 0x2, 0x10,
+    0xaa, 0xf5, 0x90, 0x78, 0x7, 0xed, 0x1a, 0x20,
+    0xf, 0xa4, 0xdd, 0x40, 0x3e, 0x56, 0x48, 0x0,
+    0xf8, 0xa8, 0x68, 0x3, 0xf7, 0x86, 0x88, 0x7,
+    0xd4, 0x52, 0x60, 0x1f, 0x3a, 0xa9, 0x80, 0x3e,
+    0x48, 0x2a, 0x0, 0xf8, 0x68, 0x1a, 0xab, 0xe2,
+    0x20, 0x82, 0x2a, 0xfc, 0xc0,
 
     /* U+005B "[" */
-    0x1f, 0xff, 0xa1, 0xfc, 0x74, 0x1f, 0xa0, 0x1,
-    0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0, 0x1f,
-    0xa0, 0x1, 0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa,
-    0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0, 0x1f, 0xa0,
-    0x1, 0xfa, 0x0, 0x1f, 0xa0, 0x1, 0xfa, 0x0,
-    0x1f, 0xc7, 0x41, 0xff, 0xfa,
+    0x1f, 0xfa, 0x80, 0x7, 0x1c, 0x0, 0x67, 0x40,
+    0xf, 0xff, 0xbb, 0x3a, 0x0, 0xe, 0x38,
 
     /* U+005C "\\" */
-    0x47, 0x0, 0x0, 0x0, 0x5f, 0x30, 0x0, 0x0,
-    0xf, 0x80, 0x0, 0x0, 0xa, 0xe0, 0x0, 0x0,
-    0x5, 0xf3, 0x0, 0x0, 0x0, 0xf9, 0x0, 0x0,
-    0x0, 0xae, 0x0, 0x0, 0x0, 0x5f, 0x40, 0x0,
-    0x0, 0xf, 0x90, 0x0, 0x0, 0xa, 0xe0, 0x0,
-    0x0, 0x4, 0xf4, 0x0, 0x0, 0x0, 0xe9, 0x0,
-    0x0, 0x0, 0x9e, 0x0, 0x0, 0x0, 0x4f, 0x40,
-    0x0, 0x0, 0xe, 0xa0, 0x0, 0x0, 0x9, 0xf0,
-    0x0, 0x0, 0x4, 0xf5, 0x0, 0x0, 0x0, 0xea,
+    0x47, 0x0, 0xf0, 0xc1, 0x80, 0x72, 0x85, 0x80,
+    0x79, 0x58, 0x3, 0xde, 0x26, 0x1, 0xca, 0x14,
+    0x1, 0xe5, 0x70, 0xf, 0x78, 0xa0, 0x7, 0x28,
+    0x68, 0x7, 0x95, 0xc0, 0x3d, 0xc2, 0x80, 0x1c,
+    0x83, 0xa0, 0x1e, 0x77, 0x0, 0x7b, 0x45, 0x0,
+    0x39, 0x7, 0x80, 0x3c, 0xea, 0x1, 0xed, 0x5,
+    0x0, 0xe4, 0x1f,
 
     /* U+005D "]" */
-    0xaf, 0xff, 0x14, 0x7c, 0xf1, 0x0, 0xaf, 0x10,
-    0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1, 0x0,
-    0xaf, 0x10, 0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa,
-    0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1, 0x0, 0xaf,
-    0x10, 0xa, 0xf1, 0x0, 0xaf, 0x10, 0xa, 0xf1,
-    0x47, 0xcf, 0x1a, 0xff, 0xf1,
+    0xaf, 0xf8, 0x7a, 0xc, 0x0, 0x8e, 0xc0, 0x1f,
+    0xff, 0x74, 0x76, 0x0, 0x74, 0x18, 0x0,
 
     /* U+005E "^" */
-    0x0, 0xa, 0xf2, 0x0, 0x0, 0x1, 0xfe, 0x80,
-    0x0, 0x0, 0x7d, 0x5e, 0x0, 0x0, 0xd, 0x70,
-    0xf5, 0x0, 0x4, 0xf1, 0x9, 0xc0, 0x0, 0xab,
-    0x0, 0x3f, 0x20, 0x1f, 0x50, 0x0, 0xd8, 0x7,
-    0xe0, 0x0, 0x6, 0xe0,
+    0x0, 0xab, 0xc8, 0x3, 0x85, 0x46, 0x80, 0x39,
+    0x8a, 0xd8, 0x3, 0xaa, 0x8a, 0x2a, 0x1, 0x21,
+    0x30, 0x34, 0x80, 0x5c, 0x82, 0x14, 0x64, 0x2,
+    0xbc, 0x0, 0x32, 0xa0, 0x61, 0x50, 0xa, 0xd8,
+    0x0,
 
     /* U+005F "_" */
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x22, 0x22, 0x22,
-    0x22,
+    0xff, 0xfe, 0xdd, 0xfe,
 
     /* U+0060 "`" */
-    0x48, 0x40, 0x0, 0xaf, 0x40, 0x0, 0x7f, 0x40,
+    0x48, 0x40, 0x2, 0x15, 0xa0, 0x2, 0xa2, 0xd0,
 
     /* U+0061 "a" */
-    0x1, 0x7c, 0xff, 0xd6, 0x0, 0x9, 0xfc, 0x99,
-    0xef, 0x80, 0x1, 0x30, 0x0, 0xd, 0xf0, 0x0,
-    0x0, 0x0, 0x9, 0xf2, 0x1, 0x9e, 0xff, 0xff,
-    0xf3, 0xa, 0xf8, 0x43, 0x3a, 0xf3, 0xf, 0xb0,
-    0x0, 0x8, 0xf3, 0xf, 0xb0, 0x0, 0xe, 0xf3,
-    0x9, 0xf9, 0x46, 0xdf, 0xf3, 0x0, 0x8d, 0xfe,
-    0x87, 0xf3,
+    0x1, 0x7c, 0xff, 0x6b, 0x0, 0x51, 0x0, 0x66,
+    0x1c, 0xc0, 0x2, 0x33, 0x13, 0x2e, 0x27, 0x0,
+    0x9, 0x80, 0x64, 0x2, 0x1, 0x9e, 0xff, 0x98,
+    0x4, 0x2d, 0x99, 0x79, 0x85, 0x0, 0x95, 0x21,
+    0xc, 0xc4, 0x1, 0xfc, 0xc0, 0x13, 0x24, 0xa3,
+    0x68, 0x80, 0x52, 0xe9, 0x70, 0xb0, 0x0,
 
     /* U+0062 "b" */
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x56,
-    0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfc, 0x9b, 0xff,
-    0x30, 0x5f, 0xf5, 0x0, 0x4, 0xfe, 0x5, 0xfa,
-    0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60, 0x0, 0x0,
-    0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4, 0xf7, 0x5f,
-    0xa0, 0x0, 0x0, 0x8f, 0x45, 0xff, 0x50, 0x0,
-    0x4f, 0xe0, 0x5f, 0xcf, 0xc9, 0xbf, 0xf3, 0x5,
-    0xf4, 0x6d, 0xfe, 0xa2, 0x0,
+    0x5f, 0x50, 0xf, 0xff, 0x3, 0x6f, 0xf5, 0x10,
+    0x6, 0x89, 0x16, 0x55, 0x69, 0x80, 0x45, 0x59,
+    0x37, 0x60, 0xd0, 0x9, 0x54, 0x1, 0x23, 0x8a,
+    0x0, 0x30, 0x3, 0xb0, 0xc, 0x3, 0xff, 0x83,
+    0x80, 0x1d, 0x80, 0x60, 0x5, 0x50, 0x4, 0x8e,
+    0x28, 0x0, 0x3a, 0xc9, 0xbb, 0x6, 0x80, 0x51,
+    0x22, 0xca, 0xad, 0x30,
 
     /* U+0063 "c" */
-    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0xcf, 0xd9,
-    0xaf, 0xf4, 0x9, 0xf7, 0x0, 0x2, 0xc3, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x2, 0xc3,
-    0x0, 0xcf, 0xd9, 0xaf, 0xf3, 0x0, 0x7, 0xdf,
-    0xeb, 0x30,
+    0x0, 0x9f, 0x7f, 0xac, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x20, 0x49, 0xc6, 0xcd, 0x69, 0xb8, 0x31,
+    0x38, 0x4, 0x58, 0x66, 0x5, 0x0, 0xff, 0xe2,
+    0x98, 0x20, 0x7, 0xe6, 0x37, 0x0, 0x8b, 0xc,
+    0x24, 0xe3, 0x66, 0xb4, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x18,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x1, 0xfa, 0x0, 0x8,
-    0xdf, 0xe8, 0x2f, 0xa0, 0x1d, 0xfd, 0x9b, 0xfd,
-    0xfa, 0xa, 0xf8, 0x0, 0x2, 0xef, 0xa0, 0xfd,
-    0x0, 0x0, 0x6, 0xfa, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2, 0xfa, 0xf,
-    0xc0, 0x0, 0x0, 0x5f, 0xa0, 0xaf, 0x60, 0x0,
-    0x1e, 0xfa, 0x1, 0xdf, 0xb7, 0x9e, 0xdf, 0xa0,
-    0x0, 0x8d, 0xfe, 0x91, 0xfa,
+    0x0, 0xfc, 0x3f, 0x40, 0x1f, 0xfd, 0x88, 0xdf,
+    0xe8, 0x30, 0x8, 0x75, 0xc1, 0x95, 0xfc, 0x2,
+    0xb2, 0x7d, 0x9b, 0xd3, 0x0, 0x94, 0xa0, 0x2,
+    0x28, 0x0, 0x18, 0x28, 0x7, 0x20, 0x7, 0xff,
+    0x4, 0xc1, 0x0, 0x39, 0xc0, 0x25, 0x36, 0x0,
+    0x86, 0xc0, 0x2b, 0x29, 0xb7, 0x9f, 0x30, 0x8,
+    0x75, 0xda, 0x1d, 0xd8, 0x0,
 
     /* U+0065 "e" */
-    0x0, 0x8, 0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb,
-    0x8a, 0xfe, 0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb,
-    0x0, 0xfa, 0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0x33, 0xfa, 0x33, 0x33, 0x33,
-    0x30, 0xf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0x90, 0x0, 0x9, 0x10, 0x0, 0xdf, 0xda, 0xae,
-    0xf6, 0x0, 0x0, 0x7d, 0xff, 0xc5, 0x0,
+    0x0, 0xa3, 0x7f, 0xa4, 0x40, 0x21, 0xd7, 0x67,
+    0x46, 0xf2, 0x0, 0x59, 0x65, 0xc5, 0x60, 0xc8,
+    0x1, 0x54, 0x60, 0x11, 0xb2, 0x9, 0x82, 0xff,
+    0xf3, 0x1, 0x0, 0x17, 0x33, 0xe3, 0x30, 0x39,
+    0x9f, 0xc0, 0x6, 0x29, 0x0, 0xd2, 0x20, 0x9,
+    0x26, 0xda, 0xa7, 0x33, 0x80, 0x5b, 0x0, 0xaa,
+    0x2a, 0x60,
 
     /* U+0066 "f" */
-    0x0, 0x1a, 0xee, 0x90, 0xa, 0xf9, 0x88, 0x0,
-    0xfb, 0x0, 0x0, 0x1f, 0x90, 0x0, 0xbf, 0xff,
-    0xff, 0x55, 0x8f, 0xc7, 0x72, 0x1, 0xfa, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0, 0x1f, 0xa0,
-    0x0,
+    0x0, 0xd, 0x77, 0x24, 0x1, 0x6a, 0xec, 0x20,
+    0x5, 0x49, 0x88, 0x0, 0x81, 0x0, 0x57, 0xc0,
+    0xdf, 0xe5, 0xe7, 0x3, 0x88, 0x3a, 0xc8, 0x33,
+    0xb8, 0x80, 0x3f, 0xfc, 0xa0,
 
     /* U+0067 "g" */
-    0x0, 0x8, 0xdf, 0xe9, 0x1e, 0xc0, 0x1d, 0xfd,
-    0x9b, 0xfe, 0xec, 0xa, 0xf8, 0x0, 0x1, 0xdf,
-    0xc0, 0xfd, 0x0, 0x0, 0x4, 0xfc, 0x3f, 0x90,
-    0x0, 0x0, 0xf, 0xc3, 0xf8, 0x0, 0x0, 0x0,
-    0xfc, 0xf, 0xd0, 0x0, 0x0, 0x4f, 0xc0, 0xaf,
-    0x80, 0x0, 0x1d, 0xfc, 0x1, 0xdf, 0xd9, 0xaf,
-    0xdf, 0xc0, 0x0, 0x8d, 0xfe, 0x91, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0x90, 0x27, 0x0, 0x0,
-    0xb, 0xf4, 0x7, 0xff, 0xb9, 0xae, 0xfa, 0x0,
-    0x4, 0xae, 0xff, 0xc6, 0x0,
+    0x0, 0xa3, 0x7f, 0xa4, 0x7b, 0x0, 0x75, 0xc1,
+    0x95, 0xbc, 0x2, 0xb2, 0x7d, 0x9b, 0xe3, 0x10,
+    0x2, 0x94, 0x0, 0x43, 0x20, 0x3, 0x4, 0x0,
+    0xe4, 0x0, 0xc2, 0x1, 0xf8, 0xc1, 0x40, 0x39,
+    0x0, 0x25, 0x28, 0x0, 0x86, 0x40, 0x2b, 0x27,
+    0xd9, 0xae, 0x0, 0xc3, 0xae, 0xc, 0x8d, 0x80,
+    0xe0, 0x14, 0x6f, 0xf4, 0x98, 0x10, 0x13, 0x80,
+    0x74, 0x86, 0x82, 0xc7, 0xdc, 0xd7, 0x22, 0xa0,
+    0x3d, 0xaa, 0x99, 0x4a, 0x68, 0x0,
 
     /* U+0068 "h" */
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x5f, 0x56, 0xdf, 0xea,
-    0x10, 0x5f, 0xef, 0xca, 0xdf, 0xd0, 0x5f, 0xf4,
-    0x0, 0xa, 0xf6, 0x5f, 0x90, 0x0, 0x2, 0xf9,
-    0x5f, 0x60, 0x0, 0x0, 0xfa, 0x5f, 0x50, 0x0,
-    0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f,
-    0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0,
-    0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
+    0x5f, 0x50, 0xf, 0xfe, 0xe3, 0x6f, 0xf5, 0x8,
+    0x5, 0x72, 0x2a, 0x6b, 0x80, 0x10, 0xde, 0x56,
+    0xa9, 0x30, 0x1, 0x90, 0x2, 0x80, 0xf0, 0x7,
+    0x80, 0x62, 0x3, 0x0, 0x18, 0x7, 0x84, 0x3,
+    0xff, 0xb8,
 
     /* U+0069 "i" */
-    0x6f, 0x69, 0xf9, 0x4, 0x0, 0x0, 0x5f, 0x55,
-    0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
-    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+    0x6f, 0x6f, 0xf, 0x9b, 0x90, 0x40, 0x5f, 0x50,
+    0xf, 0xfe, 0x78,
 
     /* U+006A "j" */
-    0x0, 0x4, 0xf7, 0x0, 0x7, 0xfa, 0x0, 0x0,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf7, 0x0,
-    0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7,
-    0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4,
-    0xf7, 0x0, 0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0,
-    0x4, 0xf7, 0x0, 0x4, 0xf7, 0x0, 0x6, 0xf5,
-    0x4b, 0x9f, 0xe1, 0x5e, 0xfc, 0x30,
+    0x0, 0x93, 0xdc, 0x2, 0x30, 0xd0, 0x9, 0xee,
+    0x80, 0x32, 0x0, 0x64, 0xf7, 0x0, 0xff, 0xf9,
+    0x90, 0x12, 0x5c, 0xc8, 0x50, 0x55, 0x8f, 0x44,
 
     /* U+006B "k" */
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x50,
-    0x0, 0x1d, 0xf3, 0x5, 0xf5, 0x0, 0x2d, 0xf3,
-    0x0, 0x5f, 0x50, 0x2e, 0xf4, 0x0, 0x5, 0xf5,
-    0x2e, 0xf4, 0x0, 0x0, 0x5f, 0x9e, 0xfe, 0x0,
-    0x0, 0x5, 0xff, 0xfa, 0xfa, 0x0, 0x0, 0x5f,
-    0xe3, 0xc, 0xf6, 0x0, 0x5, 0xf6, 0x0, 0x1e,
-    0xf3, 0x0, 0x5f, 0x50, 0x0, 0x3f, 0xd0, 0x5,
-    0xf5, 0x0, 0x0, 0x7f, 0xa0,
+    0x5f, 0x50, 0xf, 0xff, 0x18, 0xef, 0x98, 0x7,
+    0x8b, 0xb, 0xc, 0x3, 0x8b, 0xa, 0xcc, 0x3,
+    0x8b, 0x6, 0xd0, 0x3, 0xb3, 0x2, 0x24, 0x0,
+    0xf3, 0xa, 0x8d, 0x0, 0x78, 0x72, 0x8d, 0x58,
+    0x3, 0xa0, 0xc3, 0x46, 0x4c, 0x3, 0x18, 0x0,
+    0x74, 0x38, 0x3, 0xf1, 0xc1, 0x50, 0x0,
 
     /* U+006C "l" */
-    0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55,
-    0xf5, 0x5f, 0x55, 0xf5, 0x5f, 0x55, 0xf5, 0x5f,
-    0x55, 0xf5, 0x5f, 0x55, 0xf5,
+    0x5f, 0x50, 0xf, 0xfe, 0xd8,
 
     /* U+006D "m" */
-    0x5f, 0x58, 0xdf, 0xe8, 0x0, 0x8d, 0xfe, 0x80,
-    0x5, 0xfe, 0xfa, 0x9d, 0xfb, 0xdf, 0xa9, 0xdf,
-    0xb0, 0x5f, 0xf2, 0x0, 0xd, 0xff, 0x30, 0x0,
-    0xcf, 0x35, 0xf9, 0x0, 0x0, 0x7f, 0xa0, 0x0,
-    0x6, 0xf6, 0x5f, 0x60, 0x0, 0x5, 0xf7, 0x0,
-    0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f, 0x60,
-    0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5, 0xf6,
-    0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0, 0x5f,
-    0x60, 0x0, 0x4, 0xf7, 0x5f, 0x50, 0x0, 0x5,
-    0xf6, 0x0, 0x0, 0x4f, 0x75, 0xf5, 0x0, 0x0,
-    0x5f, 0x60, 0x0, 0x4, 0xf7,
+    0x5f, 0x58, 0xdf, 0xe8, 0x0, 0x46, 0xff, 0x40,
+    0x6, 0xb7, 0x73, 0x1b, 0xde, 0xbb, 0x98, 0xde,
+    0xc0, 0x21, 0xda, 0x9d, 0x24, 0x2c, 0xa9, 0xd3,
+    0x43, 0x0, 0x31, 0x0, 0x54, 0xa, 0x60, 0x15,
+    0x2, 0x80, 0x3c, 0x3, 0x10, 0x68, 0x6, 0x20,
+    0x10, 0x1, 0x80, 0x78, 0x40, 0x3f, 0xff, 0xe0,
 
     /* U+006E "n" */
-    0x5f, 0x57, 0xdf, 0xea, 0x10, 0x5f, 0xef, 0xa8,
-    0xcf, 0xd0, 0x5f, 0xf3, 0x0, 0x9, 0xf6, 0x5f,
-    0x90, 0x0, 0x2, 0xf9, 0x5f, 0x60, 0x0, 0x0,
-    0xfa, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50,
-    0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
-    0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0,
-    0x0, 0xfb,
+    0x5f, 0x57, 0xdf, 0xea, 0x10, 0xa, 0xe1, 0xdc,
+    0x4b, 0x80, 0x10, 0xe5, 0x46, 0x31, 0x30, 0x1,
+    0x8c, 0x2, 0xb0, 0xf0, 0x7, 0x80, 0x62, 0x3,
+    0x0, 0x18, 0x7, 0x84, 0x3, 0xff, 0xb8,
 
     /* U+006F "o" */
-    0x0, 0x7, 0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd,
-    0x9a, 0xff, 0x50, 0x9, 0xf7, 0x0, 0x2, 0xef,
-    0x10, 0xfd, 0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80,
-    0x0, 0x0, 0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2,
-    0xf9, 0xf, 0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f,
-    0x80, 0x0, 0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf,
-    0xf4, 0x0, 0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0x9f, 0x7f, 0xa8, 0xc0, 0x36, 0xc0, 0x32,
+    0x2e, 0x28, 0x2, 0x4a, 0x36, 0x6b, 0x46, 0x84,
+    0x18, 0x9c, 0x2, 0x28, 0x6, 0x30, 0x50, 0xe,
+    0x40, 0xe0, 0xf, 0xf8, 0xc1, 0x40, 0x39, 0x3,
+    0xc1, 0x8a, 0x0, 0x22, 0x80, 0x70, 0x93, 0x7d,
+    0x9a, 0xd1, 0xb1, 0x0, 0x64, 0x3, 0x22, 0xe2,
+    0x0,
 
     /* U+0070 "p" */
-    0x5f, 0x46, 0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfa,
-    0x8a, 0xff, 0x30, 0x5f, 0xf4, 0x0, 0x3, 0xfe,
-    0x5, 0xfa, 0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60,
-    0x0, 0x0, 0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4,
-    0xf7, 0x5f, 0xa0, 0x0, 0x0, 0x9f, 0x45, 0xff,
-    0x50, 0x0, 0x4f, 0xe0, 0x5f, 0xdf, 0xc9, 0xbf,
-    0xf3, 0x5, 0xf5, 0x6d, 0xfe, 0xa2, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0x46, 0xdf, 0xea, 0x20, 0xd, 0x32, 0x77,
+    0x22, 0xe9, 0x80, 0x45, 0x75, 0x15, 0x81, 0xa0,
+    0x12, 0xa0, 0x4, 0x6e, 0x28, 0x0, 0xc0, 0xe,
+    0xc0, 0x30, 0xf, 0xfe, 0xe, 0x0, 0x76, 0x81,
+    0x80, 0x15, 0x40, 0x12, 0x30, 0xa0, 0x0, 0xab,
+    0x26, 0xec, 0x1a, 0x1, 0x44, 0x8b, 0x2a, 0xb4,
+    0xc0, 0x33, 0x6f, 0xf5, 0x10, 0x7, 0xff, 0x5c,
 
     /* U+0071 "q" */
-    0x0, 0x8, 0xdf, 0xe8, 0x1f, 0xa0, 0x1d, 0xfd,
-    0x9b, 0xfc, 0xfa, 0xa, 0xf7, 0x0, 0x2, 0xef,
-    0xa0, 0xfd, 0x0, 0x0, 0x6, 0xfa, 0x3f, 0x80,
-    0x0, 0x0, 0x2f, 0xa3, 0xf8, 0x0, 0x0, 0x2,
-    0xfa, 0xf, 0xd0, 0x0, 0x0, 0x6f, 0xa0, 0xaf,
-    0x80, 0x0, 0x2e, 0xfa, 0x1, 0xdf, 0xd9, 0xaf,
-    0xdf, 0xa0, 0x0, 0x8d, 0xfe, 0x82, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x1, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xa0,
-    0x0, 0x0, 0x0, 0x1, 0xfa,
+    0x0, 0xa3, 0x7f, 0xa0, 0x7e, 0x80, 0x75, 0xc1,
+    0x95, 0xf4, 0x2, 0xb2, 0x8d, 0x9b, 0xd2, 0x0,
+    0x94, 0x9c, 0x2, 0x28, 0x0, 0x18, 0x28, 0x7,
+    0x20, 0x7, 0xff, 0x4, 0xc1, 0x40, 0x39, 0x0,
+    0x25, 0x28, 0x0, 0x8a, 0x0, 0x2b, 0x27, 0xd9,
+    0xad, 0x30, 0x8, 0x75, 0xc1, 0x91, 0xfc, 0x3,
+    0xa3, 0x7f, 0xa0, 0xc0, 0x3f, 0xfa, 0xe0,
 
     /* U+0072 "r" */
-    0x5f, 0x46, 0xdb, 0x5f, 0xcf, 0xd9, 0x5f, 0xf5,
-    0x0, 0x5f, 0xa0, 0x0, 0x5f, 0x70, 0x0, 0x5f,
-    0x50, 0x0, 0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0,
-    0x5f, 0x50, 0x0, 0x5f, 0x50, 0x0,
+    0x5f, 0x46, 0xdb, 0x0, 0x44, 0x81, 0x0, 0xe,
+    0xb6, 0x40, 0xa, 0xa0, 0xd, 0xa0, 0x1c, 0x40,
+    0x1f, 0xfc, 0xf0,
 
     /* U+0073 "s" */
-    0x1, 0x8d, 0xfe, 0xc7, 0x0, 0xcf, 0xb8, 0xad,
-    0xd0, 0x3f, 0x90, 0x0, 0x1, 0x2, 0xfb, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb8, 0x40, 0x0, 0x5,
-    0x9c, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0x60,
-    0x50, 0x0, 0x5, 0xf7, 0x5f, 0xea, 0x9a, 0xfe,
-    0x10, 0x6c, 0xef, 0xd9, 0x20,
+    0x1, 0x8d, 0xfe, 0xc7, 0x0, 0x6b, 0xb3, 0xa0,
+    0xd0, 0x19, 0x9a, 0xe2, 0xb7, 0x0, 0x40, 0x80,
+    0x30, 0x81, 0x22, 0x3e, 0xe1, 0x0, 0x2b, 0xa6,
+    0x77, 0x5e, 0x0, 0x4b, 0x39, 0xec, 0x6c, 0xa,
+    0x1, 0xb0, 0x5, 0x6b, 0xaa, 0x6a, 0x82, 0xcb,
+    0x24, 0x8c, 0xed, 0x82,
 
     /* U+0074 "t" */
-    0x1, 0xfa, 0x0, 0x0, 0x1f, 0xa0, 0x0, 0xbf,
-    0xff, 0xff, 0x55, 0x8f, 0xc7, 0x72, 0x1, 0xfa,
-    0x0, 0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0,
-    0x0, 0x1f, 0xa0, 0x0, 0x1, 0xfa, 0x0, 0x0,
-    0xf, 0xc0, 0x0, 0x0, 0xbf, 0xa9, 0x90, 0x1,
-    0xbe, 0xe9,
+    0x1, 0xfa, 0x0, 0xff, 0x5f, 0x2, 0xff, 0x97,
+    0x9c, 0xe, 0x20, 0xeb, 0x20, 0xce, 0xe2, 0x0,
+    0xff, 0xe8, 0x88, 0x30, 0x7, 0x21, 0xd4, 0xc8,
+    0x1, 0x48, 0x87, 0x0,
 
     /* U+0075 "u" */
-    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
-    0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f,
-    0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3,
-    0xf8, 0x7f, 0x40, 0x0, 0x4, 0xf8, 0x6f, 0x60,
-    0x0, 0x6, 0xf8, 0x2f, 0xc0, 0x0, 0x1e, 0xf8,
-    0xa, 0xfd, 0x89, 0xee, 0xf8, 0x0, 0x8d, 0xfe,
-    0x92, 0xf8,
+    0x7f, 0x40, 0xc, 0x7f, 0x0, 0x1f, 0xfe, 0x37,
+    0x0, 0x8, 0x10, 0x6, 0x20, 0x2, 0x5, 0x0,
+    0x43, 0x0, 0x2, 0x53, 0xd8, 0x9f, 0x0, 0xd4,
+    0xe0, 0xef, 0x60, 0x0,
 
     /* U+0076 "v" */
-    0xd, 0xe0, 0x0, 0x0, 0xd, 0xd0, 0x6, 0xf6,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
-    0xaf, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xf9, 0x0,
-    0x0, 0x2f, 0x90, 0x7, 0xf3, 0x0, 0x0, 0xb,
-    0xf0, 0xe, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0xed, 0xbe, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf1, 0x0, 0x0,
+    0xd, 0xe0, 0xf, 0x6e, 0x80, 0x16, 0x2c, 0x1,
+    0x8c, 0xa8, 0x0, 0xc1, 0x40, 0x1a, 0x41, 0x80,
+    0x26, 0x33, 0x0, 0x5, 0x58, 0x40, 0x2b, 0xa,
+    0x0, 0x30, 0x50, 0x6, 0x24, 0x60, 0x4, 0x99,
+    0x80, 0x3b, 0x81, 0x94, 0x64, 0x3, 0xca, 0x37,
+    0xc2, 0xa0, 0x1f, 0x49, 0x23, 0x0, 0x7e, 0x60,
+    0x4, 0x80, 0x60,
 
     /* U+0077 "w" */
-    0xbe, 0x0, 0x0, 0xc, 0xf1, 0x0, 0x0, 0xae,
-    0x5, 0xf4, 0x0, 0x2, 0xff, 0x60, 0x0, 0xf,
-    0x80, 0xf, 0x90, 0x0, 0x8f, 0xeb, 0x0, 0x5,
-    0xf2, 0x0, 0xae, 0x0, 0xd, 0xb8, 0xf1, 0x0,
-    0xbd, 0x0, 0x4, 0xf4, 0x3, 0xf5, 0x2f, 0x70,
-    0x1f, 0x70, 0x0, 0xe, 0xa0, 0x9e, 0x0, 0xcc,
-    0x6, 0xf1, 0x0, 0x0, 0x9f, 0x1e, 0x90, 0x6,
-    0xf2, 0xcc, 0x0, 0x0, 0x3, 0xfa, 0xf3, 0x0,
-    0x1f, 0xaf, 0x60, 0x0, 0x0, 0xd, 0xfd, 0x0,
-    0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0x70,
-    0x0, 0x5, 0xfb, 0x0, 0x0,
+    0xbe, 0x0, 0xec, 0xf1, 0x0, 0xd5, 0xc1, 0xc2,
+    0x80, 0x11, 0x18, 0x38, 0x6, 0x56, 0x5, 0xd,
+    0x0, 0xa8, 0x7, 0x40, 0x25, 0xa, 0x0, 0x2b,
+    0x80, 0x4a, 0x8c, 0x82, 0x0, 0xe2, 0x20, 0x3,
+    0x85, 0x0, 0xcb, 0xa8, 0x18, 0x5, 0x28, 0x2,
+    0x41, 0xe0, 0xa1, 0x52, 0x3b, 0x7, 0x6, 0x0,
+    0xce, 0xa2, 0xee, 0x0, 0x51, 0x95, 0x18, 0x80,
+    0x6a, 0xb, 0x1a, 0x0, 0x38, 0x41, 0xd0, 0x7,
+    0x19, 0x29, 0x18, 0x0, 0x51, 0x41, 0xc0, 0x3c,
+    0xa1, 0x40, 0x1b, 0x81, 0x4, 0x2,
 
     /* U+0078 "x" */
-    0x3f, 0xb0, 0x0, 0xc, 0xf2, 0x7, 0xf7, 0x0,
-    0x7f, 0x60, 0x0, 0xbf, 0x33, 0xfa, 0x0, 0x0,
-    0x1e, 0xde, 0xd0, 0x0, 0x0, 0x4, 0xff, 0x30,
-    0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0, 0x3f,
-    0xbc, 0xf2, 0x0, 0x0, 0xde, 0x12, 0xfc, 0x0,
-    0xa, 0xf4, 0x0, 0x5f, 0x90, 0x6f, 0x80, 0x0,
-    0xa, 0xf5,
+    0x3f, 0xb0, 0xd, 0x9e, 0x47, 0x8, 0xe0, 0x7,
+    0x39, 0x20, 0x74, 0x83, 0x34, 0x2b, 0x0, 0x54,
+    0x3d, 0xa5, 0x40, 0x18, 0x68, 0x87, 0x80, 0x3c,
+    0x40, 0x6, 0x0, 0xe3, 0x94, 0x3a, 0x20, 0xd,
+    0xc3, 0x5c, 0x1c, 0x1, 0x51, 0x50, 0x95, 0x1c,
+    0x83, 0x2b, 0xa0, 0x1, 0x54, 0xca,
 
     /* U+0079 "y" */
-    0xd, 0xe0, 0x0, 0x0, 0xd, 0xd0, 0x6, 0xf6,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xfa, 0x0,
-    0x0, 0x2f, 0x90, 0x6, 0xf3, 0x0, 0x0, 0xc,
-    0xf0, 0xd, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0xed, 0xae, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x1, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0x1f, 0xaa, 0xfb, 0x0, 0x0, 0x0, 0x19, 0xee,
-    0xa1, 0x0, 0x0, 0x0,
+    0xd, 0xe0, 0xf, 0x6e, 0x80, 0x16, 0x2c, 0x1,
+    0x8c, 0xa8, 0x0, 0xc1, 0x40, 0x1a, 0x81, 0x80,
+    0x26, 0x33, 0x0, 0x5, 0x94, 0x40, 0x2b, 0xa,
+    0x0, 0x38, 0x48, 0x6, 0x23, 0x60, 0x5, 0x99,
+    0x80, 0x3a, 0x41, 0x8c, 0xa8, 0x3, 0xca, 0x37,
+    0x22, 0xc0, 0x1f, 0x31, 0x2b, 0x0, 0x7e, 0x90,
+    0x5, 0x0, 0x7e, 0x10, 0x42, 0x0, 0xe1, 0x0,
+    0x38, 0x78, 0x7, 0xf, 0x55, 0x21, 0x10, 0x1,
+    0xe6, 0x44, 0x2d, 0x0, 0x78,
 
     /* U+007A "z" */
-    0x2f, 0xff, 0xff, 0xff, 0x91, 0x77, 0x77, 0x7e,
-    0xf4, 0x0, 0x0, 0x6, 0xf8, 0x0, 0x0, 0x3,
-    0xfc, 0x0, 0x0, 0x1, 0xee, 0x10, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x0, 0x8f, 0x70, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x0, 0x1e, 0xf8, 0x77, 0x77,
-    0x54, 0xff, 0xff, 0xff, 0xfb,
+    0x2f, 0xff, 0xa4, 0xe2, 0x38, 0x43, 0x45, 0xdf,
+    0x8, 0x9d, 0x0, 0x31, 0xc9, 0xc0, 0x6, 0x1d,
+    0x1d, 0x0, 0xea, 0x1a, 0x10, 0xd, 0x9, 0x8,
+    0x1, 0x91, 0xd1, 0xc0, 0x30, 0xd0, 0x1b, 0xbe,
+    0x55, 0x8, 0x3c, 0x46, 0xe0,
 
     /* U+007B "{" */
-    0x0, 0x7e, 0xf0, 0x3f, 0xd7, 0x7, 0xf4, 0x0,
-    0x8f, 0x30, 0x8, 0xf3, 0x0, 0x8f, 0x30, 0x8,
-    0xf3, 0x0, 0x9f, 0x20, 0x8e, 0xe0, 0xf, 0xfa,
-    0x0, 0xb, 0xf2, 0x0, 0x8f, 0x30, 0x8, 0xf3,
-    0x0, 0x8f, 0x30, 0x8, 0xf3, 0x0, 0x7f, 0x40,
-    0x4, 0xfd, 0x70, 0x8, 0xef,
+    0x0, 0x3f, 0x78, 0x1c, 0x1c, 0x2, 0x4, 0xb8,
+    0x78, 0x38, 0x7, 0xff, 0x14, 0x40, 0x42, 0x1c,
+    0x48, 0x1c, 0x50, 0x1, 0xe8, 0xa4, 0x0, 0x30,
+    0x10, 0xf, 0xfe, 0x2f, 0x83, 0x80, 0xc, 0x25,
+    0xc1, 0x1c, 0xe0,
 
     /* U+007C "|" */
-    0x1f, 0x71, 0xf7, 0x1f, 0x71, 0xf7, 0x1f, 0x71,
-    0xf7, 0x1f, 0x71, 0xf7, 0x1f, 0x71, 0xf7, 0x1f,
-    0x71, 0xf7, 0x1f, 0x71, 0xf7, 0x1f, 0x71, 0xf7,
-    0x1f, 0x71, 0xf7,
+    0x1f, 0x70, 0xf, 0xff, 0x38,
 
     /* U+007D "}" */
-    0xaf, 0xa1, 0x0, 0x4b, 0xf9, 0x0, 0x0, 0xed,
-    0x0, 0x0, 0xde, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0xde, 0x0, 0x0, 0xde, 0x0,
-    0x0, 0xaf, 0x92, 0x0, 0x5f, 0xf4, 0x0, 0xcf,
-    0x10, 0x0, 0xde, 0x0, 0x0, 0xde, 0x0, 0x0,
-    0xde, 0x0, 0x0, 0xde, 0x0, 0x0, 0xed, 0x0,
-    0x4a, 0xf9, 0x0, 0xaf, 0xb1, 0x0,
+    0xaf, 0xa1, 0x0, 0x72, 0x2c, 0x0, 0x12, 0xc5,
+    0x0, 0x31, 0x98, 0x3, 0xff, 0xa0, 0xe3, 0x24,
+    0x0, 0xf0, 0x66, 0x0, 0x24, 0x39, 0x0, 0x2,
+    0x30, 0x7, 0xff, 0x24, 0xcc, 0x0, 0x4a, 0x14,
+    0x0, 0x72, 0xa4, 0x0, 0x0,
 
     /* U+007E "~" */
-    0x0, 0x0, 0x0, 0x1, 0x1, 0xdf, 0xc1, 0x0,
-    0xc5, 0xac, 0x5c, 0xe3, 0x4f, 0x2d, 0x40, 0x9,
-    0xff, 0x90, 0x30, 0x0, 0x2, 0x10, 0x0,
+    0x0, 0xf8, 0x40, 0x77, 0xf0, 0x40, 0x1a, 0xb6,
+    0x34, 0x1e, 0x68, 0x6e, 0xe8, 0x5c, 0x7c, 0xb6,
+    0x2e, 0x40, 0x4, 0xef, 0x48, 0x0,
 
     /* U+00A0 " " */
 
     /* U+00A1 "¡" */
-    0x7f, 0x4a, 0xf7, 0x15, 0x0, 0x0, 0x2a, 0x15,
-    0xf2, 0x5f, 0x26, 0xf3, 0x6f, 0x47, 0xf4, 0x8f,
-    0x58, 0xf6, 0x9f, 0x60,
+    0x7f, 0x4d, 0x3, 0xba, 0x71, 0x50, 0x2a, 0x17,
+    0x53, 0x0, 0x8c, 0x4, 0x0, 0xe2, 0x0, 0xf0,
+    0x10, 0x1, 0x88, 0x0,
 
     /* U+00A2 "¢" */
-    0x0, 0x0, 0x5, 0x10, 0x0, 0x0, 0x0, 0xe,
-    0x30, 0x0, 0x0, 0x0, 0x1f, 0x50, 0x0, 0x0,
-    0x2b, 0xff, 0xfe, 0x60, 0x2, 0xef, 0x9f, 0x9d,
-    0xf6, 0xb, 0xf4, 0xe, 0x30, 0x81, 0x1f, 0xb0,
-    0xe, 0x30, 0x0, 0x3f, 0x80, 0xe, 0x30, 0x0,
-    0x2f, 0x90, 0xe, 0x30, 0x0, 0xe, 0xe0, 0xe,
-    0x30, 0x0, 0x8, 0xfa, 0xe, 0x33, 0xe4, 0x0,
-    0xbf, 0xff, 0xdf, 0xe2, 0x0, 0x5, 0xbf, 0xd8,
-    0x10, 0x0, 0x0, 0xe, 0x30, 0x0, 0x0, 0x0,
-    0xe, 0x30, 0x0,
+    0x0, 0xe5, 0x10, 0xf, 0xd6, 0x40, 0x1f, 0x8,
+    0x98, 0x3, 0x8a, 0xf8, 0x2b, 0x98, 0x0, 0x58,
+    0x8c, 0xc, 0x72, 0xc1, 0x23, 0x72, 0x35, 0xae,
+    0xe1, 0x44, 0x80, 0x34, 0x9, 0x1, 0x80, 0x7c,
+    0x20, 0x20, 0x1f, 0x10, 0xb8, 0x7, 0xe6, 0x1a,
+    0x0, 0x8f, 0x90, 0x21, 0x17, 0xc7, 0xb0, 0x18,
+    0x1, 0x74, 0x80, 0x7, 0xf2, 0x0, 0x96, 0xc7,
+    0xa0, 0x40, 0x3f, 0xe0,
 
     /* U+00A3 "£" */
-    0x0, 0x0, 0x29, 0xdf, 0xec, 0x80, 0x0, 0x4,
-    0xff, 0xdb, 0xce, 0xf2, 0x0, 0xe, 0xf4, 0x0,
-    0x0, 0x40, 0x0, 0x5f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x13, 0x9f, 0x63, 0x33, 0x30, 0x0,
-    0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xba, 0xaa, 0xaa, 0xa0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0xc5, 0x3b, 0xfd, 0x90, 0x1, 0x93, 0x58,
+    0x10, 0x88, 0xe4, 0x1, 0x50, 0x5e, 0xde, 0x75,
+    0x90, 0x1, 0x45, 0xd0, 0x3, 0x20, 0x4, 0x41,
+    0xa0, 0x1f, 0xde, 0x2, 0x1, 0xf3, 0xfb, 0x85,
+    0xff, 0xe1, 0x0, 0x36, 0x30, 0x4e, 0x66, 0x10,
+    0x0, 0x98, 0x81, 0x19, 0xe0, 0xf, 0xfe, 0x7a,
+    0x52, 0x87, 0xd5, 0x78, 0xd, 0x48, 0x11, 0x57,
+    0xc2,
 
     /* U+00A4 "¤" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xd3,
-    0x0, 0x1, 0x0, 0x9, 0x90, 0x1d, 0xe5, 0xbf,
-    0xff, 0x89, 0xf8, 0x0, 0x1d, 0xfd, 0x75, 0x8f,
-    0xf8, 0x0, 0x0, 0xeb, 0x0, 0x0, 0x2e, 0x90,
-    0x0, 0x6f, 0x10, 0x0, 0x0, 0x6f, 0x0, 0x8,
-    0xe0, 0x0, 0x0, 0x3, 0xf2, 0x0, 0x6f, 0x0,
-    0x0, 0x0, 0x5f, 0x10, 0x1, 0xf8, 0x0, 0x0,
-    0xd, 0xb0, 0x0, 0xc, 0xfa, 0x42, 0x5d, 0xf6,
-    0x0, 0xa, 0xf9, 0xef, 0xff, 0xbc, 0xf4, 0x3,
-    0xf6, 0x0, 0x34, 0x20, 0xc, 0xc0, 0x2, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0,
+    0x0, 0xff, 0xe0, 0x8e, 0x98, 0x4, 0x20, 0x14,
+    0xc8, 0x2, 0xd5, 0xbf, 0xef, 0x89, 0x61, 0x1,
+    0xc3, 0xa6, 0x8a, 0x77, 0x33, 0xc0, 0x0, 0x4d,
+    0x35, 0xd6, 0x34, 0x44, 0x1, 0x30, 0xd0, 0x6,
+    0x28, 0x60, 0xb, 0x84, 0x40, 0x1c, 0xa0, 0x40,
+    0xe, 0x10, 0xf, 0x30, 0x18, 0x1, 0xc2, 0x0,
+    0x3a, 0x10, 0x40, 0x2, 0x6f, 0x48, 0x4b, 0xa5,
+    0xa0, 0x15, 0x1b, 0x25, 0xed, 0x31, 0xca, 0x1,
+    0xac, 0xcb, 0xb2, 0xf6, 0xf0, 0xe0, 0xf, 0x58,
+    0x0, 0x68, 0x40, 0xd, 0xd0, 0x0,
 
     /* U+00A5 "¥" */
-    0xb, 0xf3, 0x0, 0x0, 0x0, 0x6, 0xf7, 0x1,
-    0xed, 0x0, 0x0, 0x0, 0x2f, 0xb0, 0x0, 0x4f,
-    0x90, 0x0, 0x0, 0xce, 0x10, 0x0, 0x9, 0xf5,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x0, 0xde, 0x10,
-    0x3f, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xb1, 0xed,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xfd, 0xf3, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0x22, 0x9f, 0x52, 0x22, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x40, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x2, 0x22,
-    0x9f, 0x52, 0x22, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0x40, 0x0, 0x0,
+    0xb, 0xf3, 0x0, 0xf9, 0xbd, 0xc2, 0x87, 0x80,
+    0x3c, 0x52, 0x8e, 0x3, 0x45, 0x20, 0x1d, 0xc3,
+    0x40, 0x12, 0x33, 0x14, 0x2, 0x83, 0xb1, 0x0,
+    0xd2, 0x56, 0x20, 0x6e, 0xca, 0x1, 0xee, 0x1a,
+    0x1d, 0x29, 0x0, 0xf8, 0xe1, 0x30, 0x78, 0x3,
+    0xc9, 0xfe, 0x80, 0x20, 0xcf, 0xf0, 0x6, 0x4d,
+    0xd9, 0x82, 0xb7, 0x60, 0xe, 0x22, 0x84, 0x4,
+    0x8a, 0x0, 0xc9, 0xff, 0x38, 0x5f, 0xfc, 0x1,
+    0x93, 0x76, 0x60, 0xad, 0xd8, 0x3, 0x88, 0xa1,
+    0x1, 0x22, 0x80, 0x0,
 
     /* U+00A6 "¦" */
-    0x1f, 0x71, 0xf7, 0x1f, 0x71, 0xf7, 0x1f, 0x71,
-    0xf7, 0x8, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x84, 0x1f, 0x71, 0xf7, 0x1f, 0x71, 0xf7,
-    0x1f, 0x71, 0xf7,
+    0x1f, 0x70, 0xf, 0xfe, 0x18, 0xb9, 0x84, 0x20,
+    0x7, 0xfa, 0x10, 0x5c, 0xc0, 0x3f, 0xf8, 0x60,
 
     /* U+00A7 "§" */
-    0x0, 0x5c, 0xef, 0xd9, 0x10, 0x7f, 0xb7, 0x8a,
-    0xf4, 0xe, 0xc0, 0x0, 0x1, 0x0, 0xdb, 0x0,
-    0x0, 0x0, 0x7, 0xfc, 0x62, 0x0, 0x0, 0x6f,
-    0xef, 0xfc, 0x30, 0x2f, 0x80, 0x16, 0xef, 0x15,
-    0xf3, 0x0, 0x3, 0xf5, 0x2f, 0xa1, 0x0, 0x5f,
-    0x40, 0x7f, 0xfb, 0x9f, 0xb0, 0x0, 0x16, 0xbf,
-    0xf5, 0x0, 0x0, 0x0, 0x1d, 0xd0, 0x0, 0x0,
-    0x0, 0x9e, 0x4, 0xe7, 0x32, 0x6f, 0xa0, 0x2b,
-    0xff, 0xff, 0xb1, 0x0, 0x1, 0x44, 0x20, 0x0,
+    0x0, 0x2e, 0x77, 0xec, 0x88, 0x3d, 0x3c, 0xbb,
+    0x99, 0x42, 0x4e, 0xde, 0x2b, 0x90, 0xd, 0xc0,
+    0x30, 0x80, 0x29, 0x31, 0x88, 0x3, 0x8, 0x14,
+    0xee, 0x18, 0x14, 0xbf, 0x72, 0x4b, 0x5, 0xc2,
+    0xc0, 0x5b, 0x41, 0x1c, 0x24, 0x40, 0xc, 0x2,
+    0x50, 0xbd, 0x73, 0x48, 0x80, 0x7e, 0x90, 0x60,
+    0xe0, 0x8, 0x5a, 0xf8, 0xa0, 0x3, 0xc2, 0x86,
+    0x9, 0xce, 0x64, 0xcc, 0x40, 0x65, 0x8c, 0xd9,
+    0x4b, 0x2, 0xbe, 0xbb, 0x6d, 0x88, 0x0,
 
     /* U+00A8 "¨" */
-    0xd, 0x60, 0x9b, 0x1e, 0x70, 0xac,
+    0xd, 0x60, 0x9b, 0x13, 0x10, 0x37,
 
     /* U+00A9 "©" */
-    0x0, 0x0, 0x4a, 0xcc, 0xb7, 0x10, 0x0, 0x0,
-    0xa, 0xa3, 0x0, 0x16, 0xd4, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x1c, 0x30, 0x6, 0x90, 0x9,
-    0xef, 0xd5, 0x2, 0xd0, 0xc, 0x10, 0xbe, 0x64,
-    0x8e, 0x10, 0xa4, 0xd, 0x3, 0xf4, 0x0, 0x0,
-    0x0, 0x67, 0x1b, 0x6, 0xf0, 0x0, 0x0, 0x0,
-    0x58, 0xd, 0x4, 0xf2, 0x0, 0x0, 0x0, 0x67,
-    0xc, 0x10, 0xdd, 0x31, 0x5c, 0x10, 0xb3, 0x6,
-    0x90, 0x2c, 0xff, 0xf8, 0x3, 0xc0, 0x0, 0xb6,
-    0x0, 0x13, 0x10, 0x1d, 0x20, 0x0, 0xa, 0xa3,
-    0x0, 0x17, 0xd3, 0x0, 0x0, 0x0, 0x4a, 0xdd,
-    0xc7, 0x10, 0x0,
+    0x0, 0xc9, 0x59, 0x8b, 0x71, 0x0, 0xf5, 0x74,
+    0xe6, 0x28, 0x71, 0x0, 0x35, 0xe5, 0x18, 0x0,
+    0x5b, 0x20, 0xc0, 0xc, 0x4c, 0x13, 0xdf, 0xaa,
+    0x3d, 0xc0, 0x5, 0x40, 0x5b, 0xc5, 0xad, 0x89,
+    0x3a, 0x0, 0x88, 0xd2, 0x99, 0x23, 0x84, 0x30,
+    0xc5, 0x81, 0x41, 0x0, 0x3c, 0x7e, 0x2c, 0x4,
+    0x4, 0x1, 0xe3, 0xf0, 0x11, 0x21, 0x79, 0x8a,
+    0xe0, 0x86, 0xa0, 0x54, 0x7, 0x8e, 0x75, 0x20,
+    0x9b, 0x98, 0x31, 0x31, 0x67, 0x67, 0x40, 0xf7,
+    0x0, 0x2b, 0xca, 0x31, 0x30, 0x7c, 0xe2, 0x0,
+    0xd5, 0xd3, 0xbb, 0x6, 0x18, 0x0,
 
     /* U+00AA "ª" */
-    0x8, 0xdf, 0xd4, 0x0, 0x41, 0x6, 0xe0, 0x7,
-    0xcc, 0xcf, 0x13, 0xf1, 0x2, 0xf1, 0x3f, 0x10,
-    0x8f, 0x10, 0x7c, 0xb8, 0xe1,
+    0x8, 0xdf, 0xd4, 0x0, 0x66, 0x3e, 0xe8, 0x0,
+    0x7b, 0x94, 0x22, 0x38, 0xdc, 0xe0, 0xf, 0x50,
+    0x0, 0xe3, 0x6c, 0x4, 0x0,
 
     /* U+00AB "«" */
-    0x0, 0x1, 0x20, 0x2, 0x0, 0x1, 0xe8, 0x9,
-    0xe1, 0x0, 0xcc, 0x5, 0xf4, 0x0, 0x7f, 0x21,
-    0xe9, 0x0, 0xf, 0xa0, 0x8f, 0x10, 0x0, 0x6f,
-    0x31, 0xea, 0x0, 0x0, 0xad, 0x3, 0xf6, 0x0,
-    0x1, 0xea, 0x7, 0xf2,
+    0x0, 0x84, 0x80, 0x4, 0x1, 0xf, 0xd0, 0x4e,
+    0x8, 0x3, 0x4a, 0x15, 0xa8, 0x41, 0xcf, 0x86,
+    0xd9, 0x0, 0x10, 0xa5, 0x23, 0x0, 0x14, 0xa9,
+    0xc8, 0xd8, 0x4, 0xcb, 0xc3, 0xaa, 0xc0, 0x15,
+    0x9d, 0x1c, 0x49, 0x0,
 
     /* U+00AC "¬" */
-    0x12, 0x22, 0x22, 0x22, 0xc, 0xff, 0xff, 0xff,
-    0xf4, 0x45, 0x55, 0x55, 0x8f, 0x40, 0x0, 0x0,
-    0x4, 0xf4, 0x0, 0x0, 0x0, 0x4f, 0x40, 0x0,
-    0x0, 0x3, 0xd3,
+    0x12, 0x2f, 0x83, 0x77, 0xf2, 0x45, 0x57, 0x38,
+    0x1, 0x15, 0x7b, 0x0, 0x3f, 0xf8, 0xae, 0x4e,
 
     /* U+00AD "­" */
-    0x88, 0x88, 0x7f, 0xff, 0xfe,
+    0x88, 0xce, 0xfd, 0x20,
 
     /* U+00AE "®" */
-    0x0, 0x0, 0x4a, 0xcc, 0xb7, 0x10, 0x0, 0x0,
-    0xa, 0xa3, 0x0, 0x16, 0xd4, 0x0, 0x0, 0xb6,
-    0x0, 0x0, 0x0, 0x1c, 0x30, 0x6, 0x90, 0x5f,
-    0xfe, 0xc5, 0x2, 0xd0, 0xc, 0x10, 0x5e, 0x22,
-    0x6f, 0x20, 0xa4, 0xd, 0x0, 0x5e, 0x0, 0xc,
-    0x60, 0x67, 0x1b, 0x0, 0x5e, 0x0, 0x3f, 0x40,
-    0x58, 0xd, 0x0, 0x5f, 0xef, 0xf8, 0x0, 0x67,
-    0xc, 0x10, 0x5e, 0x12, 0xd6, 0x0, 0xb3, 0x6,
-    0x90, 0x5e, 0x0, 0x3e, 0x13, 0xc0, 0x0, 0xb6,
-    0x13, 0x0, 0x2, 0x3d, 0x20, 0x0, 0xa, 0xa3,
-    0x0, 0x17, 0xd3, 0x0, 0x0, 0x0, 0x4a, 0xdd,
-    0xc7, 0x10, 0x0,
+    0x0, 0xc9, 0x59, 0x8b, 0x71, 0x0, 0xf5, 0x74,
+    0xe6, 0x28, 0x71, 0x0, 0x35, 0xe5, 0x18, 0x0,
+    0x5b, 0x20, 0xc0, 0xc, 0x4c, 0xbf, 0xee, 0xc5,
+    0x1e, 0xe0, 0x2, 0xa0, 0x0, 0x3b, 0x95, 0x42,
+    0x23, 0xa0, 0x8, 0x80, 0x22, 0x23, 0x1a, 0x6,
+    0x18, 0xb0, 0x7, 0x8c, 0xc4, 0x7, 0xe2, 0xc0,
+    0x10, 0xf7, 0xe3, 0xa0, 0x1f, 0x80, 0x88, 0x0,
+    0x3f, 0xa5, 0xc0, 0xd, 0x40, 0xa8, 0x0, 0x84,
+    0xba, 0x4, 0xdc, 0xc1, 0x89, 0x93, 0x40, 0x7,
+    0x85, 0xdc, 0x0, 0xaf, 0x2c, 0x2, 0x15, 0xee,
+    0x10, 0x6, 0xae, 0x9d, 0xd8, 0x30, 0xc0, 0x0,
 
     /* U+00AF "¯" */
-    0x8f, 0xff, 0xff, 0x51, 0x22, 0x22, 0x20,
+    0x8f, 0xfe, 0x59, 0xdd, 0xe5,
 
     /* U+00B0 "°" */
-    0x1, 0xaf, 0xd5, 0x0, 0xb8, 0x3, 0xe4, 0x1e,
-    0x0, 0x6, 0xa2, 0xe0, 0x0, 0x6a, 0xc, 0x70,
-    0x1d, 0x50, 0x2c, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0,
+    0x1, 0xaf, 0xd5, 0x0, 0x51, 0x7f, 0x5a, 0xa,
+    0xc0, 0x1c, 0x71, 0x80, 0x78, 0x88, 0xe0, 0x37,
+    0xe1, 0xd7, 0xfd, 0x4a, 0x5, 0x9f, 0xe7, 0x0,
 
     /* U+00B1 "±" */
-    0x0, 0x8, 0xf0, 0x0, 0x0, 0x0, 0x8f, 0x0,
-    0x0, 0x12, 0x29, 0xf2, 0x22, 0xc, 0xff, 0xff,
-    0xff, 0xf4, 0x45, 0x5a, 0xf5, 0x55, 0x10, 0x0,
-    0x8f, 0x0, 0x0, 0x0, 0x8, 0xf0, 0x0, 0x0,
-    0x0, 0x8f, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x77, 0x77, 0x77, 0x72, 0xcf, 0xff, 0xff,
-    0xff, 0x40,
+    0x0, 0xa3, 0xc0, 0x3f, 0xf8, 0x22, 0x44, 0x10,
+    0x22, 0x83, 0x76, 0x60, 0xdd, 0x92, 0x2a, 0x8a,
+    0x15, 0x52, 0xa2, 0xa8, 0x81, 0x56, 0x10, 0xf,
+    0xfe, 0x4c, 0x78, 0x6, 0x67, 0x7f, 0x8a, 0xa2,
+    0x3e, 0x60,
 
     /* U+00B2 "²" */
-    0x8, 0xef, 0xe8, 0x2, 0xa4, 0x14, 0xf6, 0x0,
-    0x0, 0xe, 0x50, 0x0, 0x1b, 0xa0, 0x0, 0x2d,
-    0x80, 0x0, 0x5e, 0x60, 0x0, 0x2f, 0xff, 0xff,
-    0xd0,
+    0x8, 0xef, 0xe8, 0x2, 0x25, 0x75, 0x3b, 0x15,
+    0x20, 0xa0, 0x98, 0x4, 0x36, 0x8a, 0x0, 0x2c,
+    0x3a, 0x0, 0x2e, 0x5c, 0x0, 0xa, 0x86, 0x7f,
+    0xda,
 
     /* U+00B3 "³" */
-    0x4f, 0xff, 0xff, 0x70, 0x0, 0xa, 0xb0, 0x0,
-    0xa, 0xc0, 0x0, 0x1, 0xbd, 0xd3, 0x0, 0x0,
-    0x8, 0xc3, 0x83, 0x13, 0xca, 0x2a, 0xdf, 0xe9,
-    0x10,
+    0x4f, 0xfe, 0x74, 0xff, 0x95, 0x1c, 0x2, 0xa6,
+    0xb0, 0x8, 0x46, 0xd3, 0x0, 0xd, 0xea, 0xf9,
+    0xc1, 0x89, 0xa3, 0x9, 0x77, 0x35, 0x6c,
 
     /* U+00B4 "´" */
-    0x0, 0x58, 0x30, 0x7f, 0x70, 0x7f, 0x50, 0x0,
+    0x0, 0x2c, 0x18, 0x3d, 0x79, 0xbc, 0x53, 0x80,
 
     /* U+00B5 "µ" */
-    0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0,
-    0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1, 0xfa, 0x5f,
-    0x50, 0x0, 0x1, 0xfa, 0x5f, 0x50, 0x0, 0x1,
-    0xfa, 0x5f, 0x50, 0x0, 0x2, 0xfa, 0x5f, 0x70,
-    0x0, 0x5, 0xfa, 0x5f, 0xd0, 0x0, 0xd, 0xfa,
-    0x5f, 0xfe, 0x99, 0xee, 0xfa, 0x5f, 0x8b, 0xff,
-    0xa2, 0xfa, 0x5f, 0x50, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0,
-    0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
+    0x5f, 0x50, 0xc, 0x3f, 0x40, 0x1f, 0xfe, 0x33,
+    0x0, 0xc4, 0x1, 0x9c, 0x3, 0x50, 0x6, 0x80,
+    0xc, 0x5d, 0x32, 0xe3, 0x0, 0xce, 0xac, 0xc4,
+    0xc0, 0xd, 0xb7, 0xfe, 0xa2, 0xfa, 0x0, 0xff,
+    0xe9, 0x0,
 
     /* U+00B6 "¶" */
-    0x2, 0xae, 0xff, 0xff, 0xfc, 0x2e, 0xff, 0xfb,
-    0x66, 0xcc, 0x8f, 0xff, 0xf8, 0x0, 0xac, 0xaf,
-    0xff, 0xf8, 0x0, 0xac, 0x7f, 0xff, 0xf8, 0x0,
-    0xac, 0x1d, 0xff, 0xf8, 0x0, 0xac, 0x0, 0x7a,
-    0xf8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac,
-    0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8,
-    0x0, 0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0,
-    0x0, 0xe8, 0x0, 0xac, 0x0, 0x0, 0xe8, 0x0,
-    0xac, 0x0, 0x0, 0xe8, 0x0, 0xac, 0x0, 0x0,
-    0xe8, 0x0, 0xac, 0x0, 0x0, 0xd7, 0x0, 0x9b,
+    0x2, 0xae, 0xff, 0xec, 0x2c, 0x51, 0x4, 0x99,
+    0x18, 0x50, 0x80, 0x46, 0xcd, 0x1, 0x0, 0x7f,
+    0x68, 0x7, 0xf3, 0x10, 0x7, 0xe1, 0xd8, 0x50,
+    0xf, 0xcf, 0x42, 0x1, 0xff, 0xff, 0x0, 0xc7,
+    0xe0, 0x3, 0x70,
 
     /* U+00B7 "·" */
-    0x28, 0x1c, 0xf8, 0x7f, 0x40,
+    0x28, 0x1e, 0x79, 0xb0, 0xc0,
 
     /* U+00B8 "¸" */
-    0x3, 0xc0, 0x0, 0x5e, 0x90, 0x0, 0x3f, 0x27,
-    0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x3, 0xc0, 0x9, 0x8a, 0x40, 0xb, 0xac, 0x4f,
+    0xf8, 0xa4, 0xff, 0xea, 0x0,
 
     /* U+00B9 "¹" */
-    0x6f, 0xfd, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x7d,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0x7d, 0x0, 0x0,
-    0x7d, 0x0, 0x8f, 0xff, 0xfa,
+    0x6f, 0xf6, 0x80, 0x1b, 0xe0, 0x3, 0xff, 0x9f,
+    0x1f, 0x5, 0xf4,
 
     /* U+00BA "º" */
-    0x2, 0xcf, 0xe8, 0x1, 0xe8, 0x13, 0xd8, 0x5e,
-    0x0, 0x5, 0xe5, 0xd0, 0x0, 0x5e, 0x1f, 0x60,
-    0x1c, 0x90, 0x4d, 0xff, 0x90, 0x0, 0x1, 0x0,
-    0x0,
+    0x2, 0xcf, 0xe8, 0x1, 0xc4, 0xed, 0x58, 0x40,
+    0x81, 0x38, 0x60, 0x30, 0xe, 0x42, 0x60, 0x19,
+    0x71, 0xbb, 0x7f, 0x2c, 0x82, 0x6f, 0x7c, 0x80,
 
     /* U+00BB "»" */
-    0x2, 0x0, 0x21, 0x0, 0x0, 0xda, 0x7, 0xf2,
-    0x0, 0x3, 0xf6, 0xc, 0xd0, 0x0, 0x8, 0xf2,
-    0x1e, 0x90, 0x0, 0xf, 0x90, 0x9f, 0x10, 0x9,
-    0xe1, 0x2f, 0x70, 0x5, 0xf4, 0xd, 0xb0, 0x1,
-    0xe9, 0x9, 0xe1, 0x0,
+    0x2, 0x0, 0x10, 0x80, 0x6f, 0xa0, 0x5e, 0x20,
+    0xb, 0x95, 0x9c, 0xfc, 0x2, 0x37, 0x92, 0xd3,
+    0x90, 0xa, 0x2, 0xc5, 0xd8, 0x40, 0x12, 0x30,
+    0x4d, 0x2, 0xa, 0xd4, 0x3e, 0x8e, 0x3, 0x6c,
+    0x92, 0x74, 0x0,
 
     /* U+00BC "¼" */
-    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xd1, 0x0,
-    0x0, 0x2, 0x8d, 0x0, 0x0, 0x0, 0x1e, 0x50,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0xba,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x5,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0, 0x0,
-    0x1e, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7d, 0x0,
-    0x0, 0xab, 0x0, 0x1, 0x60, 0x0, 0x0, 0x7d,
-    0x0, 0x5, 0xf1, 0x0, 0xc, 0x90, 0x0, 0x8f,
-    0xff, 0xfa, 0x1e, 0x60, 0x0, 0x9c, 0x0, 0x0,
-    0x12, 0x22, 0x21, 0xab, 0x0, 0x5, 0xe1, 0x12,
-    0x0, 0x0, 0x0, 0x4, 0xf2, 0x0, 0x2f, 0x30,
-    0x7a, 0x0, 0x0, 0x0, 0xe, 0x60, 0x0, 0xbf,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9c, 0x0, 0x0,
-    0x12, 0x22, 0xab, 0x20, 0x0, 0x4, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x9a, 0x0, 0x0, 0x1, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x0,
+    0x5f, 0xf6, 0x0, 0x7c, 0xba, 0x20, 0x19, 0x75,
+    0xc4, 0x3, 0xc3, 0x70, 0x20, 0x1c, 0x5e, 0x1,
+    0xf5, 0x22, 0x80, 0x7f, 0xf0, 0x95, 0x56, 0x1,
+    0xff, 0xc2, 0x1b, 0xb0, 0x80, 0x7f, 0xf0, 0xad,
+    0x54, 0x0, 0x16, 0x0, 0xff, 0x2a, 0xa8, 0x2,
+    0xdf, 0x0, 0xa3, 0xe0, 0xbe, 0x86, 0xe4, 0x40,
+    0x12, 0x12, 0x1, 0x4e, 0xee, 0xbb, 0x2b, 0x0,
+    0x15, 0xf4, 0x48, 0x0, 0x24, 0x59, 0x55, 0x20,
+    0x2, 0xad, 0x16, 0x80, 0xf, 0xaa, 0x48, 0x1,
+    0x21, 0x9f, 0xb, 0xe2, 0x1, 0xa4, 0x98, 0x2,
+    0xad, 0xd9, 0x53, 0x44, 0x2, 0x46, 0xe0, 0xc,
+    0x24, 0x51, 0x89, 0x0, 0x65, 0xe2, 0x0, 0xfd,
+    0x16, 0x0,
 
     /* U+00BD "½" */
-    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xd1, 0x0,
-    0x0, 0x28, 0xd0, 0x0, 0x0, 0x1, 0xe5, 0x0,
-    0x0, 0x0, 0x7d, 0x0, 0x0, 0x0, 0xba, 0x0,
-    0x0, 0x0, 0x7, 0xd0, 0x0, 0x0, 0x5e, 0x10,
-    0x0, 0x0, 0x0, 0x7d, 0x0, 0x0, 0x1e, 0x50,
-    0x0, 0x0, 0x0, 0x7, 0xd0, 0x0, 0xa, 0xb0,
-    0x7d, 0xec, 0x50, 0x0, 0x7d, 0x0, 0x5, 0xf1,
-    0x6e, 0x53, 0x7f, 0x28, 0xff, 0xff, 0xa1, 0xe6,
-    0x0, 0x30, 0x0, 0xf5, 0x12, 0x22, 0x21, 0xab,
-    0x0, 0x0, 0x0, 0x6f, 0x10, 0x0, 0x0, 0x4f,
-    0x10, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x1e,
-    0x60, 0x0, 0x0, 0x6f, 0x40, 0x0, 0x0, 0x9,
-    0xc0, 0x0, 0x0, 0x7f, 0x30, 0x0, 0x0, 0x4,
-    0xf2, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0,
-    0x11, 0x0, 0x0, 0x0, 0x22, 0x22, 0x21,
+    0x5f, 0xf6, 0x0, 0x7c, 0xba, 0x20, 0x12, 0xeb,
+    0x88, 0x7, 0x86, 0xe0, 0x40, 0x31, 0x78, 0x7,
+    0xd4, 0x8a, 0x1, 0xff, 0xc1, 0x55, 0x58, 0x7,
+    0xff, 0x4, 0x6e, 0xc2, 0x1, 0xff, 0xc1, 0xb5,
+    0x53, 0xef, 0x62, 0x80, 0x7e, 0x55, 0x53, 0x4c,
+    0x6d, 0xd1, 0x47, 0xc1, 0x7d, 0xd, 0xc8, 0xb6,
+    0xa9, 0xb8, 0x3c, 0xee, 0xeb, 0xb2, 0xb0, 0x0,
+    0xc0, 0xc, 0x8, 0x24, 0x59, 0x55, 0x40, 0x1c,
+    0xd3, 0x62, 0x1, 0x86, 0xa4, 0x40, 0x33, 0x4d,
+    0xa0, 0x7, 0x41, 0x30, 0x6, 0x79, 0xc4, 0x0,
+    0xe4, 0x6e, 0x0, 0xc9, 0x1, 0x9f, 0xea, 0x0,
+    0x97, 0x88, 0x3, 0x26, 0xef, 0x58,
 
     /* U+00BE "¾" */
-    0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x5d, 0x10,
-    0x0, 0x0, 0x22, 0x29, 0xe1, 0x0, 0x0, 0x1e,
-    0x50, 0x0, 0x0, 0x0, 0x5, 0xe2, 0x0, 0x0,
-    0xb, 0xa0, 0x0, 0x0, 0x0, 0x1, 0xfc, 0x50,
-    0x0, 0x5, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0x8f, 0x70, 0x1, 0xe5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0x0, 0xab, 0x0, 0x1, 0x60,
-    0x0, 0x28, 0x20, 0x1b, 0xa0, 0x5f, 0x10, 0x0,
-    0xc9, 0x0, 0x2, 0xcf, 0xff, 0xb1, 0x1e, 0x60,
-    0x0, 0x9c, 0x0, 0x0, 0x0, 0x2, 0x0, 0xa,
-    0xb0, 0x0, 0x6e, 0x11, 0x20, 0x0, 0x0, 0x0,
-    0x4, 0xf2, 0x0, 0x3f, 0x30, 0x7a, 0x0, 0x0,
-    0x0, 0x0, 0xe6, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x9c, 0x0, 0x0, 0x12, 0x22,
-    0xab, 0x20, 0x0, 0x0, 0x4f, 0x20, 0x0, 0x0,
-    0x0, 0x9, 0xa0, 0x0, 0x0, 0x1, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x0,
+    0x4f, 0xfe, 0x70, 0xe, 0x5d, 0x10, 0xc, 0x9b,
+    0xb3, 0xb, 0x0, 0x61, 0xb8, 0x10, 0xe, 0x22,
+    0x3b, 0xb0, 0x40, 0x35, 0x22, 0x80, 0x7c, 0x34,
+    0x4e, 0x1, 0x95, 0x56, 0x1, 0xf8, 0x65, 0x29,
+    0xc0, 0x3, 0x76, 0x10, 0xf, 0xe6, 0x88, 0x58,
+    0x2, 0xd5, 0x40, 0x1, 0x60, 0x8, 0xa0, 0x80,
+    0x71, 0x81, 0x55, 0x40, 0x16, 0xf8, 0x6, 0x4d,
+    0xfe, 0xb, 0x1b, 0x91, 0x0, 0x48, 0x48, 0x4,
+    0x59, 0xfb, 0xf6, 0x36, 0xac, 0x0, 0x67, 0xd1,
+    0x20, 0xe, 0x20, 0x2, 0x2c, 0x80, 0xe, 0x74,
+    0x5a, 0x0, 0x3f, 0x54, 0x90, 0x2, 0x3, 0x3e,
+    0x17, 0xc4, 0x3, 0xa4, 0x98, 0x2, 0xad, 0xd9,
+    0x53, 0x44, 0x3, 0x23, 0x70, 0x6, 0x12, 0x28,
+    0xc4, 0x80, 0x39, 0x78, 0x80, 0x3f, 0x45, 0x80,
+    0x0,
 
     /* U+00BF "¿" */
-    0x0, 0x8, 0xe3, 0x0, 0x0, 0x0, 0xc, 0xf6,
-    0x0, 0x0, 0x0, 0x1, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xc1, 0x0,
-    0x0, 0x0, 0x1e, 0xe0, 0x0, 0x0, 0x1, 0xdf,
-    0x40, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0, 0x0,
-    0x7f, 0x60, 0x0, 0x0, 0x0, 0xbf, 0x10, 0x0,
-    0x0, 0x0, 0xaf, 0x70, 0x0, 0x1b, 0x90, 0x3f,
-    0xfc, 0x9b, 0xff, 0x80, 0x2, 0xae, 0xfe, 0xb4,
-    0x0,
+    0x0, 0xa3, 0x8c, 0x3, 0xe4, 0x15, 0x0, 0xfb,
+    0x69, 0x80, 0x3e, 0x15, 0x0, 0xfd, 0x18, 0x20,
+    0x1e, 0x16, 0x21, 0x0, 0xe1, 0xc1, 0xa0, 0xf,
+    0x61, 0x5a, 0x0, 0x73, 0x94, 0xa0, 0x7, 0xb0,
+    0x1c, 0x3, 0xe1, 0x6, 0x0, 0x86, 0xe4, 0x24,
+    0x23, 0x26, 0xf9, 0x4, 0xf, 0x54, 0x99, 0x52,
+    0xe0, 0x0,
 
     /* U+00C0 "À" */
-    0x0, 0x0, 0x38, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x7, 0xf8, 0x88, 0x88, 0x88, 0xfa,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
+    0x0, 0xc7, 0xa, 0x1, 0xff, 0x8c, 0x29, 0xc0,
+    0x3f, 0xf4, 0x54, 0x38, 0x7, 0xfe, 0x5f, 0x70,
+    0xf, 0xfd, 0x1f, 0x40, 0x1f, 0xf9, 0x81, 0x48,
+    0x3, 0xfc, 0xc3, 0x21, 0x60, 0x1f, 0xeb, 0x26,
+    0x46, 0x0, 0xfe, 0x42, 0xb0, 0xf0, 0x70, 0xf,
+    0xde, 0x2c, 0x8, 0x54, 0x1, 0xf1, 0x23, 0x0,
+    0x56, 0x4a, 0x1, 0xeb, 0x9, 0x0, 0x98, 0x64,
+    0x3, 0x85, 0x83, 0xbf, 0xf0, 0x99, 0x80, 0x33,
+    0x3, 0xbf, 0xc1, 0x20, 0x1a, 0x4a, 0x23, 0xe4,
+    0x51, 0x0, 0x28, 0xd8, 0x7, 0xde, 0x12, 0x0,
+    0x90, 0x70, 0xf, 0x90, 0x58, 0x0,
 
     /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x7, 0xf8, 0x88, 0x88, 0x88, 0xfa,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
+    0x0, 0xfc, 0x90, 0x80, 0x1f, 0xf2, 0xd9, 0x20,
+    0x7, 0xf9, 0x2a, 0x28, 0x3, 0xfe, 0x4f, 0x70,
+    0xf, 0xfd, 0x1f, 0x40, 0x1f, 0xf9, 0x81, 0x48,
+    0x3, 0xfc, 0xc3, 0x21, 0x60, 0x1f, 0xeb, 0x26,
+    0x46, 0x0, 0xfe, 0x42, 0xb0, 0xf0, 0x70, 0xf,
+    0xde, 0x2c, 0x8, 0x54, 0x1, 0xf1, 0x23, 0x0,
+    0x56, 0x4a, 0x1, 0xeb, 0x9, 0x0, 0x98, 0x64,
+    0x3, 0x85, 0x83, 0xbf, 0xf0, 0x99, 0x80, 0x33,
+    0x3, 0xbf, 0xc1, 0x20, 0x1a, 0x4a, 0x23, 0xe4,
+    0x51, 0x0, 0x28, 0xd8, 0x7, 0xde, 0x12, 0x0,
+    0x90, 0x70, 0xf, 0x90, 0x58, 0x0,
 
     /* U+00C2 "Â" */
-    0x0, 0x0, 0x0, 0x38, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xbf, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0x70, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x7, 0xf8, 0x88, 0x88, 0x88, 0xfa,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
+    0x0, 0xf1, 0xc2, 0x80, 0x7f, 0xc7, 0x87, 0x4c,
+    0x1, 0xfc, 0x79, 0x17, 0x52, 0xa0, 0x1f, 0x8f,
+    0xdc, 0x17, 0xd4, 0x3, 0xfd, 0x1f, 0x40, 0x1f,
+    0xf9, 0x81, 0x48, 0x3, 0xfc, 0xc3, 0x21, 0x60,
+    0x1f, 0xeb, 0x26, 0x46, 0x0, 0xfe, 0x42, 0xb0,
+    0xf0, 0x70, 0xf, 0xde, 0x2c, 0x8, 0x54, 0x1,
+    0xf1, 0x23, 0x0, 0x56, 0x4a, 0x1, 0xeb, 0x9,
+    0x0, 0x98, 0x64, 0x3, 0x85, 0x83, 0xbf, 0xf0,
+    0x99, 0x80, 0x33, 0x3, 0xbf, 0xc1, 0x20, 0x1a,
+    0x4a, 0x23, 0xe4, 0x51, 0x0, 0x28, 0xd8, 0x7,
+    0xde, 0x12, 0x0, 0x90, 0x70, 0xf, 0x90, 0x58,
+    0x0,
 
     /* U+00C3 "Ã" */
-    0x0, 0x0, 0x9, 0xe4, 0x6, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xe4, 0xd3, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x69, 0x3, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xf6, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
-    0xb, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0x60,
-    0x4f, 0x70, 0x0, 0x0, 0x0, 0xb, 0xe0, 0x0,
-    0xdd, 0x0, 0x0, 0x0, 0x2, 0xf8, 0x0, 0x6,
-    0xf5, 0x0, 0x0, 0x0, 0x9f, 0x10, 0x0, 0xe,
-    0xc0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x7, 0xf8, 0x88, 0x88, 0x88, 0xfa,
-    0x0, 0x0, 0xed, 0x0, 0x0, 0x0, 0xb, 0xf1,
-    0x0, 0x5f, 0x60, 0x0, 0x0, 0x0, 0x4f, 0x80,
-    0xc, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xee, 0x0,
+    0x0, 0xe9, 0xe4, 0x6, 0x80, 0xf, 0xc4, 0xf5,
+    0x27, 0xba, 0x0, 0xfc, 0x8e, 0x9d, 0xa0, 0xa0,
+    0x1f, 0x9a, 0x40, 0xfa, 0xc0, 0x3f, 0xe8, 0xfa,
+    0x0, 0xff, 0xcc, 0xa, 0x40, 0x1f, 0xe6, 0x19,
+    0xb, 0x0, 0xff, 0x59, 0x32, 0x30, 0x7, 0xf2,
+    0x15, 0x87, 0x83, 0x80, 0x7e, 0xf1, 0x60, 0x42,
+    0xa0, 0xf, 0x89, 0x18, 0x2, 0xb2, 0x50, 0xf,
+    0x58, 0x48, 0x4, 0xc3, 0x20, 0x1c, 0x2c, 0x1d,
+    0xff, 0x84, 0xcc, 0x1, 0x98, 0x1d, 0xfe, 0x9,
+    0x0, 0xd2, 0x51, 0x1f, 0x22, 0x88, 0x1, 0x46,
+    0xc0, 0x3e, 0xf0, 0x90, 0x4, 0x83, 0x80, 0x7c,
+    0x82, 0xc0,
 
     /* U+00C4 "Ä" */
-    0x0, 0x0, 0xc, 0x90, 0x7e, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xb9, 0x6, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xd0, 0xbf, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6,
-    0x4, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0,
-    0xd, 0xd0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0,
-    0x6f, 0x50, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0,
-    0xec, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x7f, 0x88, 0x88, 0x88, 0x8f,
-    0xa0, 0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0xbf,
-    0x10, 0x5, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf8,
-    0x0, 0xcf, 0x10, 0x0, 0x0, 0x0, 0xe, 0xe0,
+    0x0, 0xec, 0x90, 0x7e, 0x10, 0xf, 0xe7, 0x0,
+    0x9, 0x80, 0x7f, 0xae, 0x41, 0xb4, 0x40, 0x3f,
+    0xd1, 0xf4, 0x1, 0xff, 0x98, 0x14, 0x80, 0x3f,
+    0xcc, 0x32, 0x16, 0x1, 0xfe, 0xb2, 0x64, 0x60,
+    0xf, 0xe4, 0x2b, 0xf, 0x7, 0x0, 0xfd, 0xe2,
+    0xc0, 0x85, 0x40, 0x1f, 0x12, 0x30, 0x5, 0x64,
+    0xa0, 0x1e, 0xb0, 0x90, 0x9, 0x86, 0x40, 0x38,
+    0x58, 0x3b, 0xff, 0x9, 0x98, 0x3, 0x30, 0x3b,
+    0xfc, 0x12, 0x1, 0xa4, 0xa2, 0x3e, 0x45, 0x10,
+    0x2, 0x8d, 0x80, 0x7d, 0xe1, 0x20, 0x9, 0x7,
+    0x0, 0xf9, 0x5, 0x80,
 
     /* U+00C5 "Å" */
-    0x0, 0x0, 0x0, 0x8c, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x49, 0x7, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x90, 0x67, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xca, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0x6f, 0x90, 0x0, 0x0, 0x0, 0x0, 0xd, 0xd0,
-    0xbf, 0x0, 0x0, 0x0, 0x0, 0x4, 0xf6, 0x4,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0xbe, 0x0, 0xd,
-    0xd0, 0x0, 0x0, 0x0, 0x2f, 0x80, 0x0, 0x6f,
-    0x50, 0x0, 0x0, 0x9, 0xf1, 0x0, 0x0, 0xec,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x7f, 0x88, 0x88, 0x88, 0x8f, 0xa0,
-    0x0, 0xe, 0xd0, 0x0, 0x0, 0x0, 0xbf, 0x10,
-    0x5, 0xf6, 0x0, 0x0, 0x0, 0x4, 0xf8, 0x0,
-    0xcf, 0x10, 0x0, 0x0, 0x0, 0xe, 0xe0,
+    0x0, 0xf4, 0x64, 0x80, 0x7f, 0xc8, 0x39, 0xce,
+    0x1, 0xff, 0xc1, 0x10, 0xf, 0xf9, 0x7, 0x30,
+    0xe0, 0x1f, 0xf4, 0x65, 0x0, 0x7f, 0xe8, 0xfa,
+    0x0, 0xff, 0xcc, 0xa, 0x40, 0x1f, 0xe6, 0x19,
+    0xb, 0x0, 0xff, 0x59, 0x32, 0x30, 0x7, 0xf2,
+    0x15, 0x87, 0x83, 0x80, 0x7e, 0xf1, 0x60, 0x42,
+    0xa0, 0xf, 0x89, 0x18, 0x2, 0xb2, 0x50, 0xf,
+    0x58, 0x48, 0x4, 0xc3, 0x20, 0x1c, 0x2c, 0x1d,
+    0xff, 0x84, 0xcc, 0x1, 0x98, 0x1d, 0xfe, 0x9,
+    0x0, 0xd2, 0x51, 0x1f, 0x22, 0x88, 0x1, 0x46,
+    0xc0, 0x3e, 0xf0, 0x90, 0x4, 0x83, 0x80, 0x7c,
+    0x82, 0xc0,
 
     /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x6f, 0xdf, 0xca,
-    0xaa, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0xe, 0xc5,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xf3, 0x5f, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xf9, 0x5, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbe, 0x10, 0x5f, 0xc9, 0x99, 0x99,
-    0x70, 0x0, 0x0, 0x4f, 0x60, 0x5, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x5f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x1, 0xec,
-    0x88, 0x88, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x20, 0x0, 0x5, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xa0, 0x0, 0x0, 0x5f, 0xca, 0xaa,
-    0xaa, 0xa8, 0xb, 0xf2, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xd0,
+    0x0, 0xfd, 0x9f, 0xff, 0xd2, 0x1, 0xf3, 0x19,
+    0x1, 0xaa, 0xfb, 0x0, 0x3e, 0x83, 0x80, 0xba,
+    0xaf, 0x28, 0x7, 0xa0, 0x7c, 0x3, 0xff, 0x86,
+    0x4e, 0xc6, 0x1, 0xff, 0xc3, 0x91, 0x80, 0xa,
+    0xe6, 0x79, 0xc0, 0x39, 0x11, 0x2, 0x1, 0x1b,
+    0x37, 0x58, 0x7, 0x49, 0x30, 0x6, 0x8f, 0xfe,
+    0xc0, 0xc, 0xc4, 0x4f, 0xfa, 0x80, 0x3f, 0xe1,
+    0x83, 0x77, 0xca, 0x1, 0xff, 0x40, 0xf4, 0x46,
+    0xf0, 0xf, 0xf1, 0x32, 0x90, 0x7, 0xae, 0xab,
+    0xd0, 0x12, 0x10, 0x1, 0xf1, 0xaa, 0xfc,
 
     /* U+00C7 "Ç" */
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x1,
-    0xbf, 0xfc, 0xac, 0xff, 0xb0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0x9c, 0x0, 0x6f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xac, 0x10,
-    0x1, 0xbf, 0xfc, 0xbc, 0xff, 0xb0, 0x0, 0x0,
-    0x4b, 0xff, 0xeb, 0x50, 0x0, 0x0, 0x0, 0x7,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x20, 0x5f, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xfe, 0x60, 0x0, 0x0,
+    0x0, 0xc9, 0x5d, 0xfd, 0x6a, 0x1, 0x86, 0xec,
+    0xa4, 0xa4, 0x95, 0x60, 0x15, 0x22, 0x37, 0x2b,
+    0x39, 0x9c, 0x0, 0xc8, 0x8b, 0x20, 0x8, 0x67,
+    0x0, 0x16, 0x14, 0x1, 0xfe, 0x23, 0x10, 0xf,
+    0xe1, 0x6, 0x0, 0xff, 0x8, 0x30, 0x7, 0xfc,
+    0x46, 0x20, 0x1f, 0xeb, 0xa, 0x0, 0xff, 0x32,
+    0x22, 0xc8, 0x2, 0x1a, 0xc1, 0x0, 0x52, 0x23,
+    0x72, 0xf3, 0x95, 0xc4, 0x0, 0x37, 0x64, 0x34,
+    0x24, 0xab, 0x0, 0xe4, 0xb8, 0x6e, 0xb5, 0x0,
+    0xfc, 0x4b, 0x60, 0x1f, 0xc4, 0xb2, 0x80, 0x1f,
+    0xd5, 0xf7, 0x20, 0x18,
 
     /* U+00C8 "È" */
-    0x0, 0x58, 0x30, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfc, 0x1, 0xfe, 0xaa, 0xaa, 0xaa,
-    0x70, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x99, 0x99, 0x99, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xaa, 0xaa, 0xaa, 0xa0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x2c, 0x18, 0x7, 0xe5, 0x2c, 0x40, 0xf,
+    0xd4, 0xf6, 0x80, 0x1f, 0xa3, 0xd0, 0x3, 0xf,
+    0xff, 0xec, 0x0, 0x85, 0x57, 0xd6, 0x1, 0x2d,
+    0x57, 0x9c, 0x3, 0xff, 0x9a, 0xd3, 0x3e, 0x0,
+    0xc4, 0xcd, 0xe0, 0xc, 0x9f, 0xfe, 0x0, 0xff,
+    0xec, 0xad, 0x57, 0xc0, 0x10, 0xaa, 0xfc, 0x0,
 
     /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x68, 0x20, 0x0, 0x0, 0x0,
-    0x8f, 0x70, 0x0, 0x0, 0x0, 0x8f, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfc, 0x1, 0xfe, 0xaa, 0xaa, 0xaa,
-    0x70, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x99, 0x99, 0x99, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xaa, 0xaa, 0xaa, 0xa0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0xf3, 0x41, 0x0, 0x7d, 0x13, 0xe4, 0x1,
+    0xe8, 0x7b, 0x70, 0xf, 0xa3, 0xd0, 0x3, 0xf,
+    0xff, 0xec, 0x0, 0x85, 0x57, 0xd6, 0x1, 0x2d,
+    0x57, 0x9c, 0x3, 0xff, 0x9a, 0xd3, 0x3e, 0x0,
+    0xc4, 0xcd, 0xe0, 0xc, 0x9f, 0xfe, 0x0, 0xff,
+    0xec, 0xad, 0x57, 0xc0, 0x10, 0xaa, 0xfc, 0x0,
 
     /* U+00CA "Ê" */
-    0x0, 0x0, 0x58, 0x30, 0x0, 0x0, 0x0, 0x6f,
-    0xcf, 0x30, 0x0, 0x0, 0x6f, 0x40, 0x8e, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xfc, 0x1, 0xfe, 0xaa, 0xaa, 0xaa,
-    0x70, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x99, 0x99, 0x99, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x0, 0x1, 0xfe, 0xaa, 0xaa, 0xaa, 0xa0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0xcb, 0x6, 0x1, 0xf3, 0x52, 0x61, 0x80,
+    0x73, 0x4d, 0xe3, 0xe9, 0x0, 0x66, 0xf4, 0x8,
+    0xe2, 0x0, 0xf, 0xff, 0xec, 0x0, 0x85, 0x57,
+    0xd6, 0x1, 0x2d, 0x57, 0x9c, 0x3, 0xff, 0x9a,
+    0xd3, 0x3e, 0x0, 0xc4, 0xcd, 0xe0, 0xc, 0x9f,
+    0xfe, 0x0, 0xff, 0xec, 0xad, 0x57, 0xc0, 0x10,
+    0xaa, 0xfc, 0x0,
 
     /* U+00CB "Ë" */
-    0x0, 0x1e, 0x60, 0xab, 0x0, 0x0, 0x1, 0xd5,
-    0xa, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xea,
-    0xaa, 0xaa, 0xa7, 0x1, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xd9, 0x99, 0x99,
-    0x90, 0x1, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x1,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xea, 0xaa,
-    0xaa, 0xaa, 0x1, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x0, 0xf, 0x30, 0x55, 0x80, 0x78, 0xcc, 0x1,
+    0xf8, 0x75, 0x42, 0xac, 0x2, 0x1f, 0xff, 0xd8,
+    0x1, 0xa, 0xaf, 0xac, 0x2, 0x5a, 0xaf, 0x38,
+    0x7, 0xff, 0x35, 0xa6, 0x7c, 0x1, 0x89, 0x9b,
+    0xc0, 0x19, 0x3f, 0xfc, 0x1, 0xff, 0xd9, 0x5a,
+    0xaf, 0x80, 0x21, 0x55, 0xf8, 0x0,
 
     /* U+00CC "Ì" */
-    0x17, 0x70, 0x0, 0x5, 0xfa, 0x0, 0x0, 0x3e,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0,
-    0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f,
-    0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0,
-    0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0,
-    0x0, 0x1f, 0xb0,
+    0x17, 0x70, 0x4, 0x25, 0x14, 0x1, 0x2e, 0x25,
+    0x0, 0x47, 0xd4, 0x1, 0xf, 0xd8, 0x7, 0xff,
+    0xf4,
 
     /* U+00CD "Í" */
-    0x0, 0x28, 0x60, 0x2, 0xec, 0x10, 0x2e, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x1f,
-    0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0,
-    0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0,
-    0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f,
-    0xb0, 0x0, 0x1f, 0xb0, 0x0, 0x1f, 0xb0, 0x0,
-    0x1f, 0xb0, 0x0,
+    0x0, 0x14, 0x30, 0x0, 0xb1, 0x1c, 0xb, 0x13,
+    0x4, 0xb, 0xa8, 0x2, 0x1f, 0xb0, 0xf, 0xff,
+    0xf8,
 
     /* U+00CE "Î" */
-    0x0, 0x28, 0x60, 0x0, 0x1, 0xec, 0xf9, 0x0,
-    0x1d, 0xa0, 0x3e, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0,
+    0x0, 0x14, 0x30, 0x6, 0x1c, 0x49, 0x90, 0x0,
+    0x71, 0x33, 0xf, 0x0, 0x3b, 0x40, 0x7d, 0x0,
+    0x10, 0xfd, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0x80,
 
     /* U+00CF "Ï" */
-    0x9d, 0x4, 0xe3, 0x8c, 0x4, 0xe3, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x1, 0xfb, 0x0, 0x1,
-    0xfb, 0x0, 0x1, 0xfb, 0x0, 0x1, 0xfb, 0x0,
-    0x1, 0xfb, 0x0, 0x1, 0xfb, 0x0, 0x1, 0xfb,
-    0x0, 0x1, 0xfb, 0x0, 0x1, 0xfb, 0x0, 0x1,
-    0xfb, 0x0, 0x1, 0xfb, 0x0, 0x1, 0xfb, 0x0,
+    0x9d, 0x4, 0xe3, 0x11, 0x0, 0x68, 0xc0, 0x4e,
+    0x30, 0x1f, 0xb0, 0xf, 0xff, 0xf0,
 
     /* U+00D0 "Ð" */
-    0x0, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0, 0x0,
-    0xf, 0xea, 0xaa, 0xac, 0xff, 0xb1, 0x0, 0x0,
-    0xfd, 0x0, 0x0, 0x1, 0xaf, 0xc0, 0x0, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0xfd,
-    0x0, 0x0, 0x0, 0x1, 0xfd, 0x1, 0x2f, 0xf2,
-    0x22, 0x0, 0x0, 0xc, 0xf0, 0xcf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xaf, 0x14, 0x5f, 0xf5, 0x55,
-    0x20, 0x0, 0xc, 0xf0, 0x0, 0xfd, 0x0, 0x0,
-    0x0, 0x1, 0xfd, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0x0, 0xaf, 0x60, 0x0, 0xfd, 0x0, 0x0, 0x1,
-    0xaf, 0xc0, 0x0, 0xf, 0xea, 0xaa, 0xac, 0xff,
-    0xb1, 0x0, 0x0, 0xff, 0xff, 0xff, 0xeb, 0x50,
-    0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x69, 0x40, 0x3e, 0x15, 0x5c,
+    0x2b, 0x56, 0x20, 0x1c, 0x75, 0x5b, 0x39, 0x53,
+    0x40, 0x3f, 0xe1, 0xa5, 0x36, 0x0, 0xff, 0xd6,
+    0x16, 0x2, 0x40, 0x45, 0x80, 0x30, 0x99, 0x6,
+    0xe8, 0x1, 0xbb, 0x30, 0x6, 0x60, 0x18, 0xa0,
+    0x5, 0x54, 0x80, 0x19, 0x80, 0x51, 0x40, 0x95,
+    0x62, 0x0, 0x84, 0xc8, 0x3, 0xff, 0x58, 0x58,
+    0x7, 0xf8, 0x69, 0x4d, 0x80, 0x31, 0xd5, 0x6c,
+    0xe5, 0x4d, 0x0, 0xe1, 0x55, 0xc4, 0x95, 0x62,
+    0x0,
 
     /* U+00D1 "Ñ" */
-    0x0, 0x1, 0xcc, 0x10, 0xa3, 0x0, 0x0, 0x7,
-    0xa6, 0xc2, 0xe1, 0x0, 0x0, 0xa, 0x40, 0x6f,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x1, 0xfb, 0x1f, 0xf8,
-    0x0, 0x0, 0x1, 0xfb, 0x1f, 0xff, 0x50, 0x0,
-    0x1, 0xfb, 0x1f, 0xdf, 0xf2, 0x0, 0x1, 0xfb,
-    0x1f, 0xb6, 0xfd, 0x0, 0x1, 0xfb, 0x1f, 0xb0,
-    0x9f, 0xa0, 0x1, 0xfb, 0x1f, 0xb0, 0xc, 0xf6,
-    0x1, 0xfb, 0x1f, 0xb0, 0x1, 0xef, 0x31, 0xfb,
-    0x1f, 0xb0, 0x0, 0x4f, 0xe2, 0xfb, 0x1f, 0xb0,
-    0x0, 0x7, 0xfd, 0xfb, 0x1f, 0xb0, 0x0, 0x0,
-    0xbf, 0xfb, 0x1f, 0xb0, 0x0, 0x0, 0x1d, 0xfb,
-    0x1f, 0xb0, 0x0, 0x0, 0x2, 0xfb,
+    0x0, 0x87, 0x30, 0x21, 0x46, 0x1, 0xcc, 0xca,
+    0xd2, 0x42, 0x0, 0xed, 0xe6, 0xad, 0x91, 0x0,
+    0xea, 0x40, 0x6f, 0x70, 0x8, 0x7e, 0xc0, 0x3c,
+    0x3f, 0x60, 0x4, 0x80, 0xf, 0xf9, 0xd4, 0x3,
+    0xf8, 0x82, 0x88, 0x3, 0xf3, 0x48, 0x78, 0x7,
+    0xf3, 0x30, 0xa8, 0x3, 0xfa, 0x4d, 0x58, 0x3,
+    0xfb, 0x46, 0x4c, 0x3, 0xf0, 0xd0, 0x69, 0x80,
+    0x7e, 0x48, 0x1f, 0x0, 0xfe, 0x74, 0x20, 0xf,
+    0xf5, 0x10, 0x7, 0xf8, 0x7c, 0x0,
 
     /* U+00D2 "Ò" */
-    0x0, 0x0, 0x3e, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xd1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0,
-    0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xc7, 0xda, 0x20, 0x1f, 0xf1, 0xf8, 0xe0,
+    0x80, 0x7f, 0xc3, 0x94, 0x80, 0x1f, 0xfc, 0x17,
+    0x50, 0xf, 0xf2, 0x56, 0xff, 0x5a, 0x80, 0x7d,
+    0x56, 0xa2, 0x84, 0x95, 0x82, 0x1, 0xad, 0x53,
+    0x72, 0xf3, 0x94, 0xf0, 0x2, 0x64, 0x45, 0x90,
+    0x4, 0x34, 0xc5, 0x0, 0xa, 0xa, 0x0, 0xfa,
+    0x41, 0x80, 0x6, 0x61, 0x0, 0xfc, 0xa2, 0x42,
+    0xc, 0x1, 0xfc, 0x60, 0x22, 0x6, 0x0, 0xfe,
+    0x30, 0x10, 0x33, 0x8, 0x7, 0xe5, 0x12, 0xa,
+    0xa, 0x0, 0xfa, 0x41, 0x80, 0xc, 0x88, 0xb2,
+    0x0, 0x86, 0x98, 0xa0, 0x2, 0xb5, 0x4d, 0xcb,
+    0xce, 0x53, 0xc0, 0xe, 0xab, 0x52, 0x42, 0x4a,
+    0xc1, 0x0,
 
     /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xce, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x47, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0,
-    0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xfd, 0x9e, 0xa0, 0x1f, 0xf6, 0x16, 0xa8,
+    0x7, 0xf9, 0x2f, 0xc8, 0x3, 0xfe, 0x47, 0x10,
+    0xf, 0xf2, 0x56, 0xff, 0x5a, 0x80, 0x7d, 0x56,
+    0xa2, 0x84, 0x95, 0x82, 0x1, 0xad, 0x53, 0x72,
+    0xf3, 0x94, 0xf0, 0x2, 0x64, 0x45, 0x90, 0x4,
+    0x34, 0xc5, 0x0, 0xa, 0xa, 0x0, 0xfa, 0x41,
+    0x80, 0x6, 0x61, 0x0, 0xfc, 0xa2, 0x42, 0xc,
+    0x1, 0xfc, 0x60, 0x22, 0x6, 0x0, 0xfe, 0x30,
+    0x10, 0x33, 0x8, 0x7, 0xe5, 0x12, 0xa, 0xa,
+    0x0, 0xfa, 0x41, 0x80, 0xc, 0x88, 0xb2, 0x0,
+    0x86, 0x98, 0xa0, 0x2, 0xb5, 0x4d, 0xcb, 0xce,
+    0x53, 0xc0, 0xe, 0xab, 0x52, 0x42, 0x4a, 0xc1,
+    0x0,
 
     /* U+00D4 "Ô" */
-    0x0, 0x0, 0x0, 0xbf, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xae, 0x3c, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x37, 0x10, 0x7, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0,
-    0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xf5, 0xfe, 0x88, 0x7, 0xfa, 0x97, 0x7,
+    0x40, 0x3f, 0x8f, 0x7c, 0xf2, 0xd0, 0x3, 0xf1,
+    0xb8, 0x80, 0x1d, 0x0, 0x3f, 0x25, 0x6f, 0xf5,
+    0xa8, 0x7, 0xd5, 0x6a, 0x28, 0x49, 0x58, 0x20,
+    0x1a, 0xd5, 0x37, 0x2f, 0x39, 0x4f, 0x0, 0x26,
+    0x44, 0x59, 0x0, 0x43, 0x4c, 0x50, 0x0, 0xa0,
+    0xa0, 0xf, 0xa4, 0x18, 0x0, 0x66, 0x10, 0xf,
+    0xca, 0x24, 0x20, 0xc0, 0x1f, 0xc6, 0x2, 0x20,
+    0x60, 0xf, 0xe3, 0x1, 0x3, 0x30, 0x80, 0x7e,
+    0x51, 0x20, 0xa0, 0xa0, 0xf, 0xa4, 0x18, 0x0,
+    0xc8, 0x8b, 0x20, 0x8, 0x69, 0x8a, 0x0, 0x2b,
+    0x54, 0xdc, 0xbc, 0xe5, 0x3c, 0x0, 0xea, 0xb5,
+    0x24, 0x24, 0xac, 0x10, 0x0,
 
     /* U+00D5 "Õ" */
-    0x0, 0x0, 0x9, 0xe3, 0x6, 0x80, 0x0, 0x0,
-    0x0, 0x2, 0xe4, 0xd2, 0xb5, 0x0, 0x0, 0x0,
-    0x0, 0x69, 0x3, 0xeb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0,
-    0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xe9, 0xe3, 0x6, 0x80, 0xf, 0xc4, 0xf5,
+    0xc5, 0xba, 0x0, 0xfc, 0x8e, 0x9d, 0x80, 0xa0,
+    0x1f, 0x9a, 0x40, 0xfa, 0xc0, 0x3f, 0x92, 0xb7,
+    0xfa, 0xd4, 0x3, 0xea, 0xb5, 0x14, 0x24, 0xac,
+    0x10, 0xd, 0x6a, 0x9b, 0x97, 0x9c, 0xa7, 0x80,
+    0x13, 0x22, 0x2c, 0x80, 0x21, 0xa6, 0x28, 0x0,
+    0x50, 0x50, 0x7, 0xd2, 0xc, 0x0, 0x33, 0x8,
+    0x7, 0xe5, 0x12, 0x10, 0x60, 0xf, 0xe3, 0x1,
+    0x10, 0x30, 0x7, 0xf1, 0x80, 0x81, 0x98, 0x40,
+    0x3f, 0x28, 0x90, 0x50, 0x50, 0x7, 0xd2, 0xc,
+    0x0, 0x64, 0x45, 0x90, 0x4, 0x34, 0xc5, 0x0,
+    0x15, 0xaa, 0x6e, 0x5e, 0x72, 0x9e, 0x0, 0x75,
+    0x5a, 0x92, 0x12, 0x56, 0x8, 0x0,
 
     /* U+00D6 "Ö" */
-    0x0, 0x0, 0xb, 0x90, 0x6d, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xda, 0x7, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xdf, 0xeb, 0x50, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0xbc, 0xff, 0xc1, 0x0, 0x0, 0xbf, 0xb2,
-    0x0, 0x1, 0xaf, 0xd0, 0x0, 0x6f, 0xb0, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0xc, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x30, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xf2, 0xc, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xfe, 0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0x9f,
-    0x80, 0x0, 0xbf, 0xb2, 0x0, 0x1, 0xaf, 0xd0,
-    0x0, 0x0, 0xaf, 0xfc, 0xbc, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x4a, 0xef, 0xeb, 0x50, 0x0, 0x0,
+    0x0, 0xeb, 0x90, 0x6d, 0x0, 0xff, 0x31, 0x80,
+    0x98, 0x80, 0x7f, 0x6d, 0x3, 0xf0, 0x80, 0x7f,
+    0xf2, 0xd2, 0xb7, 0xfa, 0xd4, 0x3, 0xea, 0xb5,
+    0x14, 0x24, 0xac, 0x10, 0xd, 0x6a, 0x9b, 0x97,
+    0x9c, 0xa7, 0x80, 0x13, 0x22, 0x2c, 0x80, 0x21,
+    0xa6, 0x28, 0x0, 0x50, 0x50, 0x7, 0xd2, 0xc,
+    0x0, 0x33, 0x8, 0x7, 0xe5, 0x12, 0x10, 0x60,
+    0xf, 0xe3, 0x1, 0x10, 0x30, 0x7, 0xf1, 0x80,
+    0x81, 0x98, 0x40, 0x3f, 0x28, 0x90, 0x50, 0x50,
+    0x7, 0xd2, 0xc, 0x0, 0x64, 0x45, 0x90, 0x4,
+    0x34, 0xc5, 0x0, 0x15, 0xaa, 0x6e, 0x5e, 0x72,
+    0x9e, 0x0, 0x75, 0x5a, 0x92, 0x12, 0x56, 0x8,
+    0x0,
 
     /* U+00D7 "×" */
-    0x0, 0x0, 0x0, 0x0, 0x9, 0x60, 0x1, 0xc2,
-    0x9, 0xf5, 0x1d, 0xe2, 0x0, 0xaf, 0xdf, 0x30,
-    0x0, 0xe, 0xf7, 0x0, 0x0, 0xbf, 0xcf, 0x40,
-    0xa, 0xf4, 0xc, 0xf3, 0x8, 0x50, 0x0, 0xb1,
+    0x0, 0xfe, 0x96, 0x0, 0xe, 0x10, 0x2, 0x54,
+    0x70, 0x80, 0x12, 0xb5, 0x85, 0xa4, 0x0, 0xa1,
+    0x28, 0x30, 0xa, 0xc4, 0xe1, 0x0, 0x14, 0x97,
+    0x87, 0x66, 0x5, 0x48, 0x18, 0x84,
 
     /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6e, 0x10, 0x0,
-    0x0, 0x4a, 0xdf, 0xeb, 0x7f, 0x40, 0x0, 0x0,
-    0xaf, 0xfc, 0xbc, 0xff, 0xf1, 0x0, 0x0, 0xbf,
-    0xb2, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x6f, 0xb0,
-    0x0, 0x3, 0xf3, 0x9f, 0x80, 0xc, 0xf1, 0x0,
-    0x0, 0xd8, 0x0, 0xfe, 0x0, 0xfc, 0x0, 0x0,
-    0x9c, 0x0, 0xa, 0xf2, 0x1f, 0xa0, 0x0, 0x4f,
-    0x20, 0x0, 0x9f, 0x30, 0xfc, 0x0, 0x1e, 0x60,
-    0x0, 0xa, 0xf2, 0xc, 0xf1, 0xb, 0xb0, 0x0,
-    0x0, 0xfe, 0x0, 0x6f, 0xb6, 0xe1, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0xbf, 0xf7, 0x0, 0x1, 0xaf,
-    0xd0, 0x0, 0x1, 0xff, 0xfc, 0xbc, 0xff, 0xc1,
-    0x0, 0x0, 0x7d, 0x5a, 0xef, 0xeb, 0x50, 0x0,
-    0x0, 0x3f, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xcc, 0x80, 0x1f, 0xf9, 0xa1, 0x40,
+    0x39, 0x2b, 0x7f, 0xad, 0xe6, 0x84, 0x3, 0x55,
+    0xa8, 0xa1, 0x24, 0x2, 0x80, 0x6b, 0x54, 0xdc,
+    0xbc, 0x60, 0x6, 0x0, 0x4c, 0x88, 0xb2, 0x0,
+    0x1b, 0x63, 0x14, 0x0, 0x28, 0x28, 0x3, 0x73,
+    0x9c, 0x83, 0x0, 0xc, 0xc2, 0x1, 0x48, 0xc0,
+    0x1, 0x44, 0x84, 0x18, 0x2, 0x46, 0xe0, 0x8,
+    0xc0, 0x44, 0xc, 0x0, 0x1a, 0x92, 0x0, 0x8c,
+    0x4, 0xc, 0xc2, 0x14, 0xac, 0x1, 0x94, 0x48,
+    0x28, 0x29, 0x96, 0x80, 0x34, 0x83, 0x0, 0x19,
+    0x11, 0x32, 0x10, 0x0, 0xd3, 0x14, 0x0, 0x54,
+    0x0, 0x8c, 0xbc, 0xe5, 0x3c, 0x0, 0xcc, 0x54,
+    0xa4, 0x84, 0x95, 0x82, 0x1, 0x1c, 0x72, 0xd7,
+    0x7f, 0x5a, 0x80, 0x60,
 
     /* U+00D9 "Ù" */
-    0x0, 0x8, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0x80, 0x0, 0x0, 0x0, 0x0, 0x3, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x0, 0xa3, 0xe0, 0x3, 0xfa, 0x25, 0xe0, 0x3,
+    0xf9, 0xb3, 0xc4, 0x3, 0xf8, 0xdc, 0x40, 0x31,
+    0xfc, 0x80, 0x79, 0x7d, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0x84, 0x40, 0x40, 0x1e, 0x20, 0x32, 0x14,
+    0x0, 0xf6, 0x3, 0x83, 0x5, 0x0, 0x67, 0x44,
+    0x10, 0x41, 0xaf, 0xdd, 0xba, 0x6, 0x40, 0x2c,
+    0x83, 0x44, 0x1b, 0xf9, 0x0,
 
     /* U+00DA "Ú" */
-    0x0, 0x0, 0x0, 0x4f, 0xb1, 0x0, 0x0, 0x0,
-    0x4, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x7, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x0, 0xf2, 0x7d, 0x88, 0x7, 0xc9, 0x6d, 0x62,
+    0x1, 0xf1, 0xd4, 0x80, 0x7f, 0x3a, 0x80, 0x71,
+    0xfc, 0x80, 0x79, 0x7d, 0xc0, 0x3f, 0xff, 0xe0,
+    0x1f, 0x84, 0x40, 0x40, 0x1e, 0x20, 0x32, 0x14,
+    0x0, 0xf6, 0x3, 0x83, 0x5, 0x0, 0x67, 0x44,
+    0x10, 0x41, 0xaf, 0xdd, 0xba, 0x6, 0x40, 0x2c,
+    0x83, 0x44, 0x1b, 0xf9, 0x0,
 
     /* U+00DB "Û" */
-    0x0, 0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0, 0x3,
-    0xf9, 0x5f, 0x60, 0x0, 0x0, 0x6, 0x50, 0x3,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x0, 0xc7, 0xfe, 0x60, 0xf, 0x8f, 0x1a, 0xa5,
+    0x80, 0x3c, 0xb5, 0x2b, 0x82, 0x1, 0xe6, 0x50,
+    0x1, 0xb8, 0x4, 0x7f, 0x20, 0x1e, 0x5f, 0x70,
+    0xf, 0xff, 0xf8, 0x7, 0xe1, 0x10, 0x10, 0x7,
+    0x88, 0xc, 0x85, 0x0, 0x3d, 0x80, 0xe0, 0xc1,
+    0x40, 0x19, 0xd1, 0x4, 0x10, 0x6b, 0xf7, 0x6e,
+    0x81, 0x90, 0xb, 0x20, 0xd1, 0x6, 0xfe, 0x40,
 
     /* U+00DC "Ü" */
-    0x0, 0x4, 0xd2, 0xc, 0x70, 0x0, 0x0, 0x4,
-    0xf3, 0xe, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7,
-    0x3f, 0x90, 0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90,
-    0x0, 0x0, 0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0,
-    0x5, 0xf7, 0x3f, 0x90, 0x0, 0x0, 0x5, 0xf6,
-    0x2f, 0xb0, 0x0, 0x0, 0x7, 0xf5, 0xe, 0xf0,
-    0x0, 0x0, 0xb, 0xf2, 0x8, 0xfa, 0x0, 0x0,
-    0x7f, 0xb0, 0x0, 0xcf, 0xfb, 0xbe, 0xfe, 0x20,
-    0x0, 0x7, 0xcf, 0xfd, 0x81, 0x0,
+    0x0, 0x93, 0x48, 0x31, 0xc0, 0x3e, 0x21, 0x2,
+    0xf0, 0xf, 0x27, 0x98, 0x74, 0x0, 0x7f, 0xf0,
+    0xcf, 0xe4, 0x3, 0xcb, 0xee, 0x1, 0xff, 0xff,
+    0x0, 0xfc, 0x22, 0x2, 0x0, 0xf1, 0x1, 0x90,
+    0xa0, 0x7, 0xb0, 0x1c, 0x18, 0x28, 0x3, 0x3a,
+    0x20, 0x82, 0xd, 0x7e, 0xed, 0xd0, 0x32, 0x1,
+    0x64, 0x1a, 0x20, 0xdf, 0xc8, 0x0,
 
     /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x2, 0x86, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xec, 0x10, 0x0, 0x0, 0x0, 0x2,
-    0xea, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf2, 0x0, 0x0, 0x0, 0x5f,
-    0x60, 0x3f, 0xb0, 0x0, 0x0, 0xe, 0xd0, 0x0,
-    0x9f, 0x50, 0x0, 0x8, 0xf3, 0x0, 0x1, 0xee,
-    0x0, 0x2, 0xfa, 0x0, 0x0, 0x6, 0xf8, 0x0,
-    0xbf, 0x10, 0x0, 0x0, 0xc, 0xf1, 0x4f, 0x70,
-    0x0, 0x0, 0x0, 0x3f, 0xbd, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0xa1, 0x80, 0x3f, 0x8b, 0x11, 0xc0,
+    0x3f, 0x16, 0x26, 0x8, 0x7, 0xe2, 0xea, 0x0,
+    0xf6, 0x79, 0x0, 0x79, 0x7d, 0x83, 0xc2, 0x40,
+    0x3d, 0x64, 0xc0, 0x6c, 0x8a, 0x1, 0xa0, 0x78,
+    0x2, 0x81, 0xb0, 0x8, 0x9d, 0x4c, 0x2, 0x18,
+    0x18, 0x0, 0x48, 0x58, 0x7, 0x31, 0xb8, 0xa2,
+    0x20, 0x40, 0x3d, 0xe1, 0x52, 0x4e, 0x1, 0xf1,
+    0xaa, 0x14, 0x80, 0x7f, 0x40, 0x1a, 0x0, 0x7f,
+    0x18, 0x38, 0x7, 0xff, 0x80,
 
     /* U+00DE "Þ" */
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xea,
-    0xa9, 0x96, 0x10, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x1f, 0xb0, 0x0, 0x15, 0xdf, 0x50,
-    0x1f, 0xb0, 0x0, 0x0, 0x2f, 0xd0, 0x1f, 0xb0,
-    0x0, 0x0, 0xd, 0xf0, 0x1f, 0xb0, 0x0, 0x0,
-    0xd, 0xf0, 0x1f, 0xb0, 0x0, 0x0, 0x2f, 0xd0,
-    0x1f, 0xb0, 0x0, 0x15, 0xdf, 0x60, 0x1f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x1f, 0xe9, 0x99, 0x96,
-    0x10, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xb0, 0xf, 0xf9, 0x6a, 0x93, 0x26, 0x10,
+    0xe, 0x15, 0x53, 0x32, 0x79, 0xc0, 0x32, 0x7f,
+    0xdd, 0x45, 0xa, 0x1, 0xf0, 0xaf, 0x84, 0x0,
+    0x7f, 0x11, 0x40, 0x1f, 0xfc, 0x92, 0x28, 0x3,
+    0xe1, 0x5f, 0xb, 0x0, 0x93, 0xfe, 0xea, 0x28,
+    0x60, 0x8, 0x59, 0xb4, 0xf3, 0x80, 0x65, 0x99,
+    0xcc, 0x20, 0x1f, 0xfc, 0x30,
 
     /* U+00DF "ß" */
-    0x0, 0x3b, 0xef, 0xd6, 0x0, 0x0, 0x4f, 0xfa,
-    0x9d, 0xf9, 0x0, 0xe, 0xe2, 0x0, 0xb, 0xf2,
-    0x3, 0xf8, 0x0, 0x0, 0x6f, 0x40, 0x5f, 0x60,
-    0x0, 0x8, 0xf2, 0x5, 0xf5, 0x0, 0x17, 0xfa,
-    0x0, 0x5f, 0x50, 0x3f, 0xff, 0x30, 0x5, 0xf5,
-    0x1, 0x89, 0xef, 0x60, 0x5f, 0x50, 0x0, 0x0,
-    0xdf, 0x15, 0xf5, 0x0, 0x0, 0x6, 0xf5, 0x5f,
-    0x50, 0x0, 0x0, 0x6f, 0x55, 0xf5, 0x0, 0x0,
-    0xd, 0xf1, 0x5f, 0x50, 0x99, 0xae, 0xf8, 0x5,
-    0xf5, 0xc, 0xff, 0xc5, 0x0,
+    0x0, 0x1d, 0xf7, 0xeb, 0x0, 0x64, 0xc4, 0x43,
+    0x4, 0xc8, 0x2, 0xa1, 0xda, 0x9d, 0x46, 0x20,
+    0x31, 0x62, 0x0, 0xb4, 0x18, 0x18, 0x38, 0x3,
+    0x70, 0x30, 0x4, 0x60, 0x1, 0x77, 0x29, 0x0,
+    0x71, 0xf4, 0x4, 0x80, 0x78, 0x9d, 0x87, 0x18,
+    0x3, 0x86, 0x27, 0x8a, 0x44, 0x3, 0xf5, 0x82,
+    0x0, 0x7f, 0xf1, 0xec, 0x10, 0x3, 0x4c, 0xab,
+    0x89, 0xc4, 0x3, 0x2b, 0x29, 0x54, 0x0,
 
     /* U+00E0 "à" */
-    0x0, 0x7f, 0x90, 0x0, 0x0, 0x0, 0x5, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xd6,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x80, 0x1, 0x30,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x1, 0x9e, 0xff, 0xff, 0xf3, 0xa, 0xf8, 0x43,
-    0x3a, 0xf3, 0xf, 0xb0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0xe, 0xf3, 0x9, 0xf9, 0x46, 0xdf,
-    0xf3, 0x0, 0x8d, 0xfe, 0x87, 0xf3,
+    0x0, 0x3f, 0xc8, 0x7, 0xcf, 0x4d, 0x20, 0x1f,
+    0x2e, 0x1, 0x0, 0x7c, 0x72, 0x40, 0x18, 0x5f,
+    0x3f, 0xda, 0xc0, 0x14, 0x40, 0x19, 0x87, 0x30,
+    0x0, 0x8c, 0xc4, 0xcb, 0x89, 0xc0, 0x2, 0x60,
+    0x19, 0x0, 0x80, 0x67, 0xbf, 0xe6, 0x1, 0xb,
+    0x66, 0x5e, 0x61, 0x40, 0x25, 0x48, 0x43, 0x31,
+    0x0, 0x7f, 0x30, 0x4, 0xc9, 0x28, 0xda, 0x20,
+    0x14, 0xba, 0x5c, 0x2c, 0x0, 0x0,
 
     /* U+00E1 "á" */
-    0x0, 0x0, 0x3, 0xfd, 0x10, 0x0, 0x0, 0x2e,
-    0xb0, 0x0, 0x0, 0x0, 0x77, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xd6,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x80, 0x1, 0x30,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x1, 0x9e, 0xff, 0xff, 0xf3, 0xa, 0xf8, 0x43,
-    0x3a, 0xf3, 0xf, 0xb0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0xe, 0xf3, 0x9, 0xf9, 0x46, 0xdf,
-    0xf3, 0x0, 0x8d, 0xfe, 0x87, 0xf3,
+    0x0, 0xe3, 0xfd, 0x10, 0xe, 0x2d, 0x4d, 0x10,
+    0xe, 0x59, 0xb0, 0xf, 0x9d, 0xc0, 0x1c, 0x2f,
+    0x9f, 0xed, 0x60, 0xa, 0x20, 0xc, 0xc3, 0x98,
+    0x0, 0x46, 0x62, 0x65, 0xc4, 0xe0, 0x1, 0x30,
+    0xc, 0x80, 0x40, 0x33, 0xdf, 0xf3, 0x0, 0x85,
+    0xb3, 0x2f, 0x30, 0xa0, 0x12, 0xa4, 0x21, 0x98,
+    0x80, 0x3f, 0x98, 0x2, 0x64, 0x94, 0x6d, 0x10,
+    0xa, 0x5d, 0x2e, 0x16, 0x0, 0x0,
 
     /* U+00E2 "â" */
-    0x0, 0x2, 0xef, 0x80, 0x0, 0x0, 0x1e, 0xb5,
-    0xf7, 0x0, 0x0, 0x67, 0x0, 0x39, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xd6,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x80, 0x1, 0x30,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x1, 0x9e, 0xff, 0xff, 0xf3, 0xa, 0xf8, 0x43,
-    0x3a, 0xf3, 0xf, 0xb0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0xe, 0xf3, 0x9, 0xf9, 0x46, 0xdf,
-    0xf3, 0x0, 0x8d, 0xfe, 0x87, 0xf3,
+    0x0, 0x8b, 0xbe, 0x0, 0x38, 0x71, 0x69, 0xdc,
+    0x1, 0x9e, 0x6d, 0x73, 0x84, 0x2, 0x67, 0x0,
+    0x1c, 0x88, 0x0, 0x5f, 0x3f, 0xda, 0xc0, 0x14,
+    0x40, 0x19, 0x87, 0x30, 0x0, 0x8c, 0xc4, 0xcb,
+    0x89, 0xc0, 0x2, 0x60, 0x19, 0x0, 0x80, 0x67,
+    0xbf, 0xe6, 0x1, 0xb, 0x66, 0x5e, 0x61, 0x40,
+    0x25, 0x48, 0x43, 0x31, 0x0, 0x7f, 0x30, 0x4,
+    0xc9, 0x28, 0xda, 0x20, 0x14, 0xba, 0x5c, 0x2c,
+    0x0, 0x0,
 
     /* U+00E3 "ã" */
-    0x0, 0x3e, 0xd5, 0xd, 0x20, 0x0, 0xa8, 0x4c,
-    0xfa, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xd6,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x80, 0x1, 0x30,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x1, 0x9e, 0xff, 0xff, 0xf3, 0xa, 0xf8, 0x43,
-    0x3a, 0xf3, 0xf, 0xb0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0xe, 0xf3, 0x9, 0xf9, 0x46, 0xdf,
-    0xf3, 0x0, 0x8d, 0xfe, 0x87, 0xf3,
+    0x0, 0x1f, 0x6a, 0x86, 0x90, 0x5, 0x2d, 0x32,
+    0xf7, 0x20, 0xa, 0xe1, 0x33, 0xe8, 0x3, 0x8,
+    0x7, 0xe1, 0x7c, 0xff, 0x6b, 0x0, 0x51, 0x0,
+    0x66, 0x1c, 0xc0, 0x2, 0x33, 0x13, 0x2e, 0x27,
+    0x0, 0x9, 0x80, 0x64, 0x2, 0x1, 0x9e, 0xff,
+    0x98, 0x4, 0x2d, 0x99, 0x79, 0x85, 0x0, 0x95,
+    0x21, 0xc, 0xc4, 0x1, 0xfc, 0xc0, 0x13, 0x24,
+    0xa3, 0x68, 0x80, 0x52, 0xe9, 0x70, 0xb0, 0x0,
 
     /* U+00E4 "ä" */
-    0x0, 0x3e, 0x40, 0xc9, 0x0, 0x0, 0x2d, 0x40,
-    0xb9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xd6,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x80, 0x1, 0x30,
-    0x0, 0xd, 0xf0, 0x0, 0x0, 0x0, 0x9, 0xf2,
-    0x1, 0x9e, 0xff, 0xff, 0xf3, 0xa, 0xf8, 0x43,
-    0x3a, 0xf3, 0xf, 0xb0, 0x0, 0x8, 0xf3, 0xf,
-    0xb0, 0x0, 0xe, 0xf3, 0x9, 0xf9, 0x46, 0xdf,
-    0xf3, 0x0, 0x8d, 0xfe, 0x87, 0xf3,
+    0x0, 0x1f, 0x20, 0x64, 0x80, 0x61, 0x30, 0x3,
+    0x80, 0x71, 0x6a, 0x5, 0xc8, 0x7, 0xff, 0x4,
+    0x5f, 0x3f, 0xda, 0xc0, 0x14, 0x40, 0x19, 0x87,
+    0x30, 0x0, 0x8c, 0xc4, 0xcb, 0x89, 0xc0, 0x2,
+    0x60, 0x19, 0x0, 0x80, 0x67, 0xbf, 0xe6, 0x1,
+    0xb, 0x66, 0x5e, 0x61, 0x40, 0x25, 0x48, 0x43,
+    0x31, 0x0, 0x7f, 0x30, 0x4, 0xc9, 0x28, 0xda,
+    0x20, 0x14, 0xba, 0x5c, 0x2c, 0x0, 0x0,
 
     /* U+00E5 "å" */
-    0x0, 0x1, 0xbc, 0x60, 0x0, 0x0, 0xa, 0x30,
-    0xc1, 0x0, 0x0, 0xa, 0x30, 0xc1, 0x0, 0x0,
-    0x1, 0xbc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x7c, 0xff, 0xd6, 0x0, 0x9, 0xfc,
-    0x99, 0xef, 0x80, 0x1, 0x30, 0x0, 0xd, 0xf0,
-    0x0, 0x0, 0x0, 0x9, 0xf2, 0x1, 0x9e, 0xff,
-    0xff, 0xf3, 0xa, 0xf8, 0x43, 0x3a, 0xf3, 0xf,
-    0xb0, 0x0, 0x8, 0xf3, 0xf, 0xb0, 0x0, 0xe,
-    0xf3, 0x9, 0xf9, 0x46, 0xdf, 0xf3, 0x0, 0x8d,
-    0xfe, 0x87, 0xf3,
+    0x0, 0x86, 0xf1, 0x80, 0x3d, 0x71, 0x94, 0x20,
+    0x1f, 0xfc, 0x3b, 0x8c, 0xa1, 0x0, 0xe1, 0xbc,
+    0x60, 0xc, 0x2f, 0x9f, 0xed, 0x60, 0xa, 0x20,
+    0xc, 0xc3, 0x98, 0x0, 0x46, 0x62, 0x65, 0xc4,
+    0xe0, 0x1, 0x30, 0xc, 0x80, 0x40, 0x33, 0xdf,
+    0xf3, 0x0, 0x85, 0xb3, 0x2f, 0x30, 0xa0, 0x12,
+    0xa4, 0x21, 0x98, 0x80, 0x3f, 0x98, 0x2, 0x64,
+    0x94, 0x6d, 0x10, 0xa, 0x5d, 0x2e, 0x16, 0x0,
+    0x0,
 
     /* U+00E6 "æ" */
-    0x1, 0x7c, 0xff, 0xd6, 0x2, 0xae, 0xfd, 0x70,
-    0x0, 0x9, 0xfc, 0x99, 0xef, 0x9f, 0xfa, 0x9c,
-    0xfc, 0x0, 0x1, 0x20, 0x0, 0xd, 0xfd, 0x10,
-    0x0, 0x6f, 0x80, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0xd, 0xe0, 0x1, 0x9e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0xb, 0xf7, 0x43,
-    0x3a, 0xf7, 0x33, 0x33, 0x33, 0x30, 0xf, 0xa0,
-    0x0, 0xa, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xd0, 0x0, 0x2f, 0xff, 0x50, 0x0, 0x29, 0x0,
-    0x9, 0xfd, 0x9a, 0xfe, 0x4e, 0xfc, 0x9a, 0xff,
-    0x20, 0x0, 0x7d, 0xfe, 0xa1, 0x1, 0x9e, 0xfe,
-    0xa2, 0x0,
+    0x1, 0x7c, 0xff, 0x6b, 0x1, 0x57, 0x7e, 0xb8,
+    0x6, 0x88, 0x3, 0x30, 0xe6, 0x5a, 0xa8, 0xc3,
+    0x18, 0x1, 0x46, 0xe4, 0xcb, 0x89, 0x8b, 0xaa,
+    0x72, 0x4e, 0x0, 0x2, 0x40, 0x19, 0x2, 0xc4,
+    0x2, 0x62, 0x60, 0x0, 0xcf, 0x7f, 0xcc, 0x13,
+    0xff, 0xc4, 0x20, 0xa, 0x69, 0xbc, 0xc2, 0x84,
+    0x66, 0x7c, 0x0, 0x45, 0x74, 0x33, 0x0, 0x38,
+    0xcf, 0xe0, 0x9, 0xc0, 0x22, 0x50, 0x65, 0x0,
+    0x8a, 0x40, 0x26, 0x2d, 0x9a, 0xd1, 0xb1, 0xac,
+    0x9a, 0xd6, 0x20, 0x4, 0xc0, 0x32, 0x2f, 0xa7,
+    0xb1, 0x32, 0x2e, 0x90, 0x0,
 
     /* U+00E7 "ç" */
-    0x0, 0x7, 0xdf, 0xeb, 0x30, 0x0, 0xcf, 0xd9,
-    0xaf, 0xf4, 0x9, 0xf7, 0x0, 0x2, 0xc3, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0x80, 0x0, 0x0,
-    0x0, 0x3f, 0x80, 0x0, 0x0, 0x0, 0xf, 0xc0,
-    0x0, 0x0, 0x0, 0x9, 0xf7, 0x0, 0x2, 0xc3,
-    0x0, 0xcf, 0xd9, 0xaf, 0xf3, 0x0, 0x7, 0xdf,
-    0xeb, 0x30, 0x0, 0x0, 0x4c, 0x0, 0x0, 0x0,
-    0x0, 0x4b, 0xd0, 0x0, 0x0, 0x1, 0x14, 0xf2,
-    0x0, 0x0, 0x6, 0xfe, 0x80, 0x0,
+    0x0, 0x9f, 0x7f, 0xac, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x20, 0x49, 0xc6, 0xcd, 0x69, 0xb8, 0x31,
+    0x38, 0x4, 0x58, 0x66, 0x5, 0x0, 0xff, 0xe2,
+    0x98, 0x20, 0x7, 0xe6, 0x37, 0x0, 0x8b, 0xc,
+    0x24, 0xe3, 0x66, 0xb4, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x18, 0x4, 0xf2, 0x7d, 0x66, 0x1, 0xe7,
+    0xd0, 0xf, 0xa, 0xf9, 0x10, 0x3, 0x9f, 0xa9,
+    0xc8, 0x0,
 
     /* U+00E8 "è" */
-    0x0, 0x4e, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb, 0x8a, 0xfe,
-    0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb, 0x0, 0xfa,
-    0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0xfa, 0x33, 0x33, 0x33, 0x30, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x9, 0x10, 0x0, 0xdf, 0xda, 0xae, 0xf6, 0x0,
-    0x0, 0x7d, 0xff, 0xc5, 0x0,
+    0x0, 0x27, 0x68, 0x80, 0x7c, 0x98, 0x1a, 0x1,
+    0xf8, 0xb1, 0x14, 0x3, 0xf0, 0xc2, 0x80, 0x7d,
+    0x1b, 0xfd, 0x22, 0x1, 0xe, 0xbb, 0x3a, 0x37,
+    0x90, 0x2, 0xcb, 0x2e, 0x2b, 0x6, 0x40, 0xa,
+    0xa3, 0x0, 0x8d, 0x90, 0x4c, 0x17, 0xff, 0x98,
+    0x8, 0x0, 0xb9, 0x9f, 0x19, 0x81, 0xcc, 0xfe,
+    0x0, 0x31, 0x48, 0x6, 0x91, 0x0, 0x49, 0x36,
+    0xd5, 0x39, 0x9c, 0x2, 0xd8, 0x5, 0x51, 0x53,
+    0x0,
 
     /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0xce, 0x20, 0x0, 0x0, 0x0, 0x58, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb, 0x8a, 0xfe,
-    0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb, 0x0, 0xfa,
-    0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0xfa, 0x33, 0x33, 0x33, 0x30, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x9, 0x10, 0x0, 0xdf, 0xda, 0xae, 0xf6, 0x0,
-    0x0, 0x7d, 0xff, 0xc5, 0x0,
+    0x0, 0xf6, 0x7a, 0x0, 0x7d, 0x85, 0xa8, 0x1,
+    0xe5, 0x4f, 0x20, 0xf, 0x96, 0x4, 0x3, 0xe8,
+    0xdf, 0xe9, 0x10, 0x8, 0x75, 0xd9, 0xd1, 0xbc,
+    0x80, 0x16, 0x59, 0x71, 0x58, 0x32, 0x0, 0x55,
+    0x18, 0x4, 0x6c, 0x82, 0x60, 0xbf, 0xfc, 0xc0,
+    0x40, 0x5, 0xcc, 0xf8, 0xcc, 0xe, 0x67, 0xf0,
+    0x1, 0x8a, 0x40, 0x34, 0x88, 0x2, 0x49, 0xb6,
+    0xa9, 0xcc, 0xe0, 0x16, 0xc0, 0x2a, 0x8a, 0x98,
+    0x0,
 
     /* U+00EA "ê" */
-    0x0, 0x0, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0xae,
-    0x4d, 0xb0, 0x0, 0x0, 0x49, 0x10, 0x18, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb, 0x8a, 0xfe,
-    0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb, 0x0, 0xfa,
-    0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0xfa, 0x33, 0x33, 0x33, 0x30, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x9, 0x10, 0x0, 0xdf, 0xda, 0xae, 0xf6, 0x0,
-    0x0, 0x7d, 0xff, 0xc5, 0x0,
+    0x0, 0xd7, 0xf8, 0x1, 0xf5, 0x2d, 0x8d, 0x80,
+    0x72, 0x1f, 0xa6, 0x1a, 0x0, 0x64, 0x91, 0x1,
+    0x84, 0x0, 0xe8, 0xdf, 0xe9, 0x10, 0x8, 0x75,
+    0xd9, 0xd1, 0xbc, 0x80, 0x16, 0x59, 0x71, 0x58,
+    0x32, 0x0, 0x55, 0x18, 0x4, 0x6c, 0x82, 0x60,
+    0xbf, 0xfc, 0xc0, 0x40, 0x5, 0xcc, 0xf8, 0xcc,
+    0xe, 0x67, 0xf0, 0x1, 0x8a, 0x40, 0x34, 0x88,
+    0x2, 0x49, 0xb6, 0xa9, 0xcc, 0xe0, 0x16, 0xc0,
+    0x2a, 0x8a, 0x98, 0x0,
 
     /* U+00EB "ë" */
-    0x0, 0xd, 0x90, 0x8d, 0x0, 0x0, 0x0, 0xc8,
-    0x7, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xdf, 0xe9, 0x10, 0x0, 0x1d, 0xfb, 0x8a, 0xfe,
-    0x20, 0xa, 0xf3, 0x0, 0x3, 0xfb, 0x0, 0xfa,
-    0x0, 0x0, 0x9, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x33, 0xfa, 0x33, 0x33, 0x33, 0x30, 0xf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x90, 0x0,
-    0x9, 0x10, 0x0, 0xdf, 0xda, 0xae, 0xf6, 0x0,
-    0x0, 0x7d, 0xff, 0xc5, 0x0,
+    0x0, 0xb6, 0x42, 0x34, 0x3, 0xc2, 0x20, 0xf1,
+    0x0, 0xf6, 0x40, 0x3e, 0x0, 0x7f, 0xf1, 0x63,
+    0x7f, 0xa4, 0x40, 0x21, 0xd7, 0x67, 0x46, 0xf2,
+    0x0, 0x59, 0x65, 0xc5, 0x60, 0xc8, 0x1, 0x54,
+    0x60, 0x11, 0xb2, 0x9, 0x82, 0xff, 0xf3, 0x1,
+    0x0, 0x17, 0x33, 0xe3, 0x30, 0x39, 0x9f, 0xc0,
+    0x6, 0x29, 0x0, 0xd2, 0x20, 0x9, 0x26, 0xda,
+    0xa7, 0x33, 0x80, 0x5b, 0x0, 0xaa, 0x2a, 0x60,
 
     /* U+00EC "ì" */
-    0x4e, 0xd1, 0x0, 0x2d, 0xc1, 0x0, 0x17, 0x50,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0,
-    0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5,
-    0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f,
-    0x50, 0x5, 0xf5,
+    0x4e, 0xd1, 0x4, 0xc0, 0xd1, 0x2, 0xcb, 0x40,
+    0x0, 0xba, 0x80, 0x17, 0xd4, 0x3, 0xff, 0xc2,
 
     /* U+00ED "í" */
-    0x1, 0xde, 0x40, 0xcd, 0x20, 0x47, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f,
-    0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5,
-    0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50,
-    0x5, 0xf5, 0x0,
+    0x1, 0xde, 0x40, 0xd0, 0xc4, 0x45, 0xe1, 0x2,
+    0x38, 0x80, 0x17, 0xd4, 0x3, 0xff, 0xc6,
 
     /* U+00EE "î" */
-    0x0, 0xbf, 0xb0, 0x0, 0x7f, 0x5f, 0x70, 0x8,
-    0x30, 0x38, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x50, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x5f, 0x50,
-    0x0, 0x5, 0xf5, 0x0, 0x0, 0x5f, 0x50, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x5,
-    0xf5, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x5, 0xf5,
-    0x0,
+    0x0, 0x5f, 0xd8, 0x4, 0xe9, 0x48, 0xe0, 0xf,
+    0xc5, 0xcf, 0x0, 0x41, 0x81, 0xc0, 0x4, 0xbe,
+    0xa0, 0x1f, 0xff, 0x50,
 
     /* U+00EF "ï" */
-    0x7d, 0xd, 0x76, 0xc0, 0xc6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5,
-    0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5, 0x0, 0x5f,
-    0x50, 0x5, 0xf5, 0x0, 0x5f, 0x50, 0x5, 0xf5,
-    0x0, 0x5f, 0x50,
+    0x7d, 0xd, 0x71, 0x10, 0x8, 0x9b, 0x3, 0x18,
+    0x3, 0xcb, 0xea, 0x1, 0xff, 0xe2,
 
     /* U+00F0 "ð" */
-    0x3, 0xce, 0xfe, 0xb4, 0x27, 0x0, 0x2c, 0x98,
-    0xaf, 0xff, 0xc0, 0x0, 0x1, 0x7e, 0xfc, 0xf8,
-    0x0, 0x6, 0xfe, 0x81, 0xc, 0xf1, 0x0, 0x36,
-    0x0, 0x0, 0x5f, 0x60, 0x0, 0x26, 0x75, 0x1,
-    0xf9, 0x0, 0xaf, 0xff, 0xfe, 0x3f, 0xb0, 0x9f,
-    0xa2, 0x2, 0xae, 0xfb, 0x1f, 0xc0, 0x0, 0x0,
-    0xcf, 0xa3, 0xf8, 0x0, 0x0, 0x8, 0xf8, 0x2f,
-    0xa0, 0x0, 0x0, 0xaf, 0x30, 0xdf, 0x30, 0x0,
-    0x3f, 0xb0, 0x4, 0xff, 0xa8, 0xbf, 0xd2, 0x0,
-    0x2, 0xae, 0xfd, 0x81, 0x0,
+    0x3, 0xce, 0xfe, 0xb4, 0x27, 0x0, 0x8, 0x3b,
+    0x91, 0x17, 0xb6, 0x0, 0x2c, 0x8f, 0x40, 0x30,
+    0x40, 0x9, 0xba, 0x5b, 0xb0, 0xdc, 0x40, 0xb,
+    0x3d, 0x2, 0x12, 0xe, 0x0, 0x34, 0x67, 0x50,
+    0x40, 0xf0, 0x5, 0x6c, 0xc5, 0x71, 0x1, 0x4,
+    0xaa, 0xb7, 0xf5, 0x34, 0x0, 0x2c, 0x74, 0x40,
+    0x54, 0x40, 0x24, 0x8, 0x1, 0xc8, 0x4, 0x20,
+    0x40, 0x1c, 0x41, 0x64, 0x45, 0x30, 0x8, 0xd5,
+    0xc, 0x24, 0x32, 0xa2, 0xf0, 0xa4, 0x0, 0x9a,
+    0xa8, 0xec, 0xf8, 0x40,
 
     /* U+00F1 "ñ" */
-    0x0, 0x3e, 0xd4, 0xe, 0x10, 0x0, 0xb7, 0x4d,
-    0xf9, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0x57, 0xdf, 0xea,
-    0x10, 0x5f, 0xef, 0xa8, 0xcf, 0xd0, 0x5f, 0xf3,
-    0x0, 0x9, 0xf6, 0x5f, 0x90, 0x0, 0x2, 0xf9,
-    0x5f, 0x60, 0x0, 0x0, 0xfa, 0x5f, 0x50, 0x0,
-    0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb, 0x5f,
-    0x50, 0x0, 0x0, 0xfb, 0x5f, 0x50, 0x0, 0x0,
-    0xfb, 0x5f, 0x50, 0x0, 0x0, 0xfb,
+    0x0, 0x1f, 0x6a, 0x7, 0x8, 0x5, 0x13, 0x37,
+    0xb8, 0x80, 0x54, 0xe9, 0xbf, 0x20, 0x18, 0x40,
+    0x3e, 0x5f, 0x57, 0xdf, 0xea, 0x10, 0xa, 0xe1,
+    0xdc, 0x4b, 0x80, 0x10, 0xe5, 0x46, 0x31, 0x30,
+    0x1, 0x8c, 0x2, 0xb0, 0xf0, 0x7, 0x80, 0x62,
+    0x3, 0x0, 0x18, 0x7, 0x84, 0x3, 0xff, 0xb8,
 
     /* U+00F2 "ò" */
-    0x0, 0x2d, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x1c,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x7, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd, 0x9a, 0xff,
-    0x50, 0x9, 0xf7, 0x0, 0x2, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f, 0x80, 0x0,
-    0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf, 0xf4, 0x0,
-    0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0x16, 0xf1, 0x0, 0x7c, 0x58, 0x58, 0x40,
+    0x1f, 0xe, 0x4a, 0x80, 0x7f, 0x3b, 0x80, 0x3e,
+    0x7d, 0xfe, 0xa3, 0x0, 0xdb, 0x0, 0xc8, 0xb8,
+    0xa0, 0x9, 0x28, 0xd9, 0xad, 0x1a, 0x10, 0x62,
+    0x70, 0x8, 0xa0, 0x18, 0xc1, 0x40, 0x39, 0x3,
+    0x80, 0x3f, 0xe3, 0x5, 0x0, 0xe4, 0xf, 0x6,
+    0x28, 0x0, 0x8a, 0x1, 0xc2, 0x4d, 0xf6, 0x6b,
+    0x46, 0xc4, 0x1, 0x90, 0xc, 0x8b, 0x88, 0x0,
 
     /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0xaf, 0x60, 0x0, 0x0, 0x0,
-    0x9f, 0x40, 0x0, 0x0, 0x0, 0x39, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd, 0x9a, 0xff,
-    0x50, 0x9, 0xf7, 0x0, 0x2, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f, 0x80, 0x0,
-    0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf, 0xf4, 0x0,
-    0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0xf5, 0x7b, 0x0, 0x7d, 0x2b, 0x6c, 0x1,
+    0xe3, 0xd, 0x40, 0xf, 0x8e, 0x48, 0x3, 0xe7,
+    0xdf, 0xea, 0x30, 0xd, 0xb0, 0xc, 0x8b, 0x8a,
+    0x0, 0x92, 0x8d, 0x9a, 0xd1, 0xa1, 0x6, 0x27,
+    0x0, 0x8a, 0x1, 0x8c, 0x14, 0x3, 0x90, 0x38,
+    0x3, 0xfe, 0x30, 0x50, 0xe, 0x40, 0xf0, 0x62,
+    0x80, 0x8, 0xa0, 0x1c, 0x24, 0xdf, 0x66, 0xb4,
+    0x6c, 0x40, 0x19, 0x0, 0xc8, 0xb8, 0x80,
 
     /* U+00F4 "ô" */
-    0x0, 0x0, 0x9f, 0xe1, 0x0, 0x0, 0x0, 0x8f,
-    0x5c, 0xd1, 0x0, 0x0, 0x29, 0x30, 0x8, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd, 0x9a, 0xff,
-    0x50, 0x9, 0xf7, 0x0, 0x2, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f, 0x80, 0x0,
-    0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf, 0xf4, 0x0,
-    0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0xd3, 0xfc, 0x20, 0x1e, 0x86, 0xa2, 0xc1,
+    0x0, 0xc4, 0x38, 0xb8, 0xae, 0x1, 0x8a, 0x4c,
+    0x1, 0xc, 0x1, 0xcf, 0xbf, 0xd4, 0x60, 0x1b,
+    0x60, 0x19, 0x17, 0x14, 0x1, 0x25, 0x1b, 0x35,
+    0xa3, 0x42, 0xc, 0x4e, 0x1, 0x14, 0x3, 0x18,
+    0x28, 0x7, 0x20, 0x70, 0x7, 0xfc, 0x60, 0xa0,
+    0x1c, 0x81, 0xe0, 0xc5, 0x0, 0x11, 0x40, 0x38,
+    0x49, 0xbe, 0xcd, 0x68, 0xd8, 0x80, 0x32, 0x1,
+    0x91, 0x71, 0x0,
 
     /* U+00F5 "õ" */
-    0x0, 0xa, 0xfa, 0x16, 0xa0, 0x0, 0x3, 0xe3,
-    0x8f, 0xe3, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd, 0x9a, 0xff,
-    0x50, 0x9, 0xf7, 0x0, 0x2, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f, 0x80, 0x0,
-    0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf, 0xf4, 0x0,
-    0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0xab, 0xe8, 0x5a, 0x80, 0x31, 0xa6, 0x17,
+    0x44, 0x80, 0x63, 0xf3, 0x8f, 0xe3, 0x0, 0xe1,
+    0x0, 0xff, 0x3e, 0xff, 0x51, 0x80, 0x6d, 0x80,
+    0x64, 0x5c, 0x50, 0x4, 0x94, 0x6c, 0xd6, 0x8d,
+    0x8, 0x31, 0x38, 0x4, 0x50, 0xc, 0x60, 0xa0,
+    0x1c, 0x81, 0xc0, 0x1f, 0xf1, 0x82, 0x80, 0x72,
+    0x7, 0x83, 0x14, 0x0, 0x45, 0x0, 0xe1, 0x26,
+    0xfb, 0x35, 0xa3, 0x62, 0x0, 0xc8, 0x6, 0x45,
+    0xc4, 0x0,
 
     /* U+00F6 "ö" */
-    0x0, 0xa, 0xb0, 0x5e, 0x20, 0x0, 0x0, 0x9a,
-    0x4, 0xd2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xea, 0x30, 0x0, 0xd, 0xfd, 0x9a, 0xff,
-    0x50, 0x9, 0xf7, 0x0, 0x2, 0xef, 0x10, 0xfd,
-    0x0, 0x0, 0x6, 0xf7, 0x3f, 0x80, 0x0, 0x0,
-    0x2f, 0x93, 0xf8, 0x0, 0x0, 0x2, 0xf9, 0xf,
-    0xd0, 0x0, 0x0, 0x6f, 0x60, 0x9f, 0x80, 0x0,
-    0x2e, 0xf1, 0x0, 0xcf, 0xd9, 0xaf, 0xf4, 0x0,
-    0x0, 0x7d, 0xfe, 0xa3, 0x0,
+    0x0, 0xaa, 0xc1, 0x78, 0x80, 0x38, 0xc4, 0x4,
+    0xc0, 0x3d, 0x34, 0x9, 0xa4, 0x1, 0xff, 0xc4,
+    0x7d, 0xfe, 0xa3, 0x0, 0xdb, 0x0, 0xc8, 0xb8,
+    0xa0, 0x9, 0x28, 0xd9, 0xad, 0x1a, 0x10, 0x62,
+    0x70, 0x8, 0xa0, 0x18, 0xc1, 0x40, 0x39, 0x3,
+    0x80, 0x3f, 0xe3, 0x5, 0x0, 0xe4, 0xf, 0x6,
+    0x28, 0x0, 0x8a, 0x1, 0xc2, 0x4d, 0xf6, 0x6b,
+    0x46, 0xc4, 0x1, 0x90, 0xc, 0x8b, 0x88, 0x0,
 
     /* U+00F7 "÷" */
-    0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0xaf, 0x20,
-    0x0, 0x0, 0x8, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x12, 0x22, 0x22, 0x22, 0xc, 0xff,
-    0xff, 0xff, 0xf4, 0x45, 0x55, 0x55, 0x55, 0x10,
-    0x0, 0x2, 0x0, 0x0, 0x0, 0xa, 0xf2, 0x0,
-    0x0, 0x0, 0x8e, 0x10, 0x0,
+    0x0, 0xc4, 0x1, 0xf5, 0x69, 0x0, 0x78, 0x84,
+    0xc0, 0x3d, 0x1c, 0x20, 0x10, 0x91, 0x7c, 0x1b,
+    0xbf, 0x92, 0x2a, 0xbe, 0x54, 0x55, 0x9d, 0x56,
+    0x10, 0xa, 0xb4, 0x80, 0x3c, 0x42, 0x60, 0x10,
 
     /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0x90, 0x0, 0x7, 0xdf, 0xed, 0xf0,
-    0x0, 0xd, 0xfd, 0x9b, 0xff, 0x50, 0x9, 0xf7,
-    0x0, 0x6d, 0xef, 0x10, 0xfd, 0x0, 0x1d, 0x16,
-    0xf7, 0x3f, 0x80, 0xa, 0x60, 0x2f, 0x93, 0xf8,
-    0x4, 0xc0, 0x2, 0xf9, 0xf, 0xd0, 0xd2, 0x0,
-    0x6f, 0x60, 0x9f, 0xf7, 0x0, 0x2e, 0xf1, 0x0,
-    0xff, 0xd9, 0xaf, 0xf4, 0x0, 0xd, 0xbd, 0xfe,
-    0xa3, 0x0, 0x7, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x70, 0xf, 0xe7, 0xe0, 0xc, 0xfb,
+    0xfd, 0xb1, 0x20, 0x16, 0xc0, 0x32, 0x90, 0x28,
+    0x2, 0x4a, 0x36, 0x74, 0x86, 0x84, 0x18, 0x9c,
+    0x6, 0xf2, 0x1, 0x8c, 0x14, 0x1, 0x76, 0x14,
+    0xe, 0x0, 0xc8, 0xcc, 0x0, 0xc6, 0xa, 0x13,
+    0xc0, 0x4, 0xf, 0x6, 0x2f, 0xa2, 0x2, 0x80,
+    0x70, 0x90, 0x5, 0x4d, 0x68, 0xd8, 0x80, 0x9,
+    0x1, 0x91, 0x71, 0x0, 0xe, 0x97, 0xbf, 0xd4,
+    0x60, 0x0,
 
     /* U+00F9 "ù" */
-    0x0, 0x9f, 0x70, 0x0, 0x0, 0x0, 0x7, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x48, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x3,
-    0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
-    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8,
-    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
-    0x4, 0xf8, 0x6f, 0x60, 0x0, 0x6, 0xf8, 0x2f,
-    0xc0, 0x0, 0x1e, 0xf8, 0xa, 0xfd, 0x89, 0xee,
-    0xf8, 0x0, 0x8d, 0xfe, 0x92, 0xf8,
+    0x0, 0x4f, 0xb8, 0x7, 0xd3, 0x10, 0x60, 0xf,
+    0x9e, 0xf8, 0x40, 0x3e, 0x48, 0x10, 0x9, 0xfd,
+    0x0, 0x31, 0xfc, 0x0, 0x7f, 0xf8, 0xdc, 0x0,
+    0x20, 0x40, 0x18, 0x80, 0x8, 0x14, 0x1, 0xc,
+    0x0, 0x9, 0x4f, 0x62, 0x7c, 0x3, 0x53, 0x83,
+    0xbd, 0x80, 0x0,
 
     /* U+00FA "ú" */
-    0x0, 0x0, 0x5, 0xfb, 0x0, 0x0, 0x0, 0x5f,
-    0x80, 0x0, 0x0, 0x0, 0x75, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x3,
-    0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
-    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8,
-    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
-    0x4, 0xf8, 0x6f, 0x60, 0x0, 0x6, 0xf8, 0x2f,
-    0xc0, 0x0, 0x1e, 0xf8, 0xa, 0xfd, 0x89, 0xee,
-    0xf8, 0x0, 0x8d, 0xfe, 0x92, 0xf8,
+    0x0, 0xe5, 0xfb, 0x0, 0xf2, 0xd3, 0xd8, 0x7,
+    0x8a, 0xa0, 0x3, 0xe7, 0x50, 0xc, 0xfe, 0x80,
+    0x18, 0xfe, 0x0, 0x3f, 0xfc, 0x6e, 0x0, 0x10,
+    0x20, 0xc, 0x40, 0x4, 0xa, 0x0, 0x86, 0x0,
+    0x4, 0xa7, 0xb1, 0x3e, 0x1, 0xa9, 0xc1, 0xde,
+    0xc0, 0x0,
 
     /* U+00FB "û" */
-    0x0, 0x4, 0xff, 0x50, 0x0, 0x0, 0x3f, 0x87,
-    0xf5, 0x0, 0x0, 0x75, 0x0, 0x47, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x3,
-    0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
-    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8,
-    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
-    0x4, 0xf8, 0x6f, 0x60, 0x0, 0x6, 0xf8, 0x2f,
-    0xc0, 0x0, 0x1e, 0xf8, 0xa, 0xfd, 0x89, 0xee,
-    0xf8, 0x0, 0x8d, 0xfe, 0x92, 0xf8,
+    0x0, 0x93, 0xfc, 0xa0, 0x1c, 0x76, 0xf1, 0x4a,
+    0x1, 0x92, 0xa1, 0xec, 0x80, 0x33, 0xa8, 0x1,
+    0x1c, 0x0, 0xfe, 0x80, 0x18, 0xfe, 0x0, 0x3f,
+    0xfc, 0x6e, 0x0, 0x10, 0x20, 0xc, 0x40, 0x4,
+    0xa, 0x0, 0x86, 0x0, 0x4, 0xa7, 0xb1, 0x3e,
+    0x1, 0xa9, 0xc1, 0xde, 0xc0, 0x0,
 
     /* U+00FC "ü" */
-    0x0, 0x5e, 0x21, 0xe7, 0x0, 0x0, 0x5d, 0x21,
-    0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0x40, 0x0, 0x3,
-    0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40,
-    0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0, 0x3, 0xf8,
-    0x7f, 0x40, 0x0, 0x3, 0xf8, 0x7f, 0x40, 0x0,
-    0x4, 0xf8, 0x6f, 0x60, 0x0, 0x6, 0xf8, 0x2f,
-    0xc0, 0x0, 0x1e, 0xf8, 0xa, 0xfd, 0x89, 0xee,
-    0xf8, 0x0, 0x8d, 0xfe, 0x92, 0xf8,
+    0x0, 0x2f, 0x10, 0xf3, 0x80, 0x71, 0x80, 0xc,
+    0x40, 0x32, 0xe9, 0xe, 0xb0, 0x7, 0xfe, 0x7f,
+    0x40, 0xc, 0x7f, 0x0, 0x1f, 0xfe, 0x37, 0x0,
+    0x8, 0x10, 0x6, 0x20, 0x2, 0x5, 0x0, 0x43,
+    0x0, 0x2, 0x53, 0xd8, 0x9f, 0x0, 0xd4, 0xe0,
+    0xef, 0x60, 0x0,
 
     /* U+00FD "ý" */
-    0x0, 0x0, 0x0, 0x9f, 0x70, 0x0, 0x0, 0x0,
-    0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x28, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0xd, 0xd0, 0x6, 0xf6,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xfa, 0x0,
-    0x0, 0x2f, 0x90, 0x6, 0xf3, 0x0, 0x0, 0xc,
-    0xf0, 0xd, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0xed, 0xae, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x1, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0x1f, 0xaa, 0xfb, 0x0, 0x0, 0x0, 0x19, 0xee,
-    0xa1, 0x0, 0x0, 0x0,
+    0x0, 0xf4, 0xfb, 0x80, 0x7e, 0x96, 0xa7, 0x0,
+    0xf8, 0x87, 0x14, 0x3, 0xf1, 0x41, 0x80, 0x7b,
+    0x78, 0x3, 0xdb, 0xa0, 0x5, 0x8b, 0x0, 0x63,
+    0x2a, 0x0, 0x30, 0x50, 0x6, 0xa0, 0x60, 0x9,
+    0x8c, 0xc0, 0x1, 0x65, 0x10, 0xa, 0xc2, 0x80,
+    0xe, 0x12, 0x1, 0x88, 0xd8, 0x1, 0x66, 0x60,
+    0xe, 0x90, 0x63, 0x2a, 0x0, 0xf2, 0x8d, 0xc8,
+    0xb0, 0x7, 0xcc, 0x4a, 0xc0, 0x1f, 0xa4, 0x1,
+    0x40, 0x1f, 0x84, 0x10, 0x80, 0x38, 0x40, 0xe,
+    0x1e, 0x1, 0xc3, 0xd5, 0x48, 0x44, 0x0, 0x79,
+    0x91, 0xb, 0x40, 0x1e,
 
     /* U+00FE "þ" */
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0x50, 0x0, 0x0, 0x0,
-    0x5, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0x56,
-    0xdf, 0xea, 0x20, 0x5, 0xfd, 0xfc, 0x9b, 0xff,
-    0x30, 0x5f, 0xf5, 0x0, 0x4, 0xfe, 0x5, 0xfa,
-    0x0, 0x0, 0x8, 0xf4, 0x5f, 0x60, 0x0, 0x0,
-    0x4f, 0x75, 0xf6, 0x0, 0x0, 0x4, 0xf7, 0x5f,
-    0xa0, 0x0, 0x0, 0x8f, 0x45, 0xff, 0x50, 0x0,
-    0x4f, 0xe0, 0x5f, 0xdf, 0xc9, 0xbf, 0xf3, 0x5,
-    0xf5, 0x6d, 0xfe, 0xa2, 0x0, 0x5f, 0x50, 0x0,
-    0x0, 0x0, 0x5, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0x50, 0x0, 0x0, 0x0, 0x5, 0xf5, 0x0,
-    0x0, 0x0, 0x0,
+    0x5f, 0x50, 0xf, 0xff, 0x3, 0x6f, 0xf5, 0x10,
+    0x6, 0x89, 0x16, 0x55, 0x69, 0x80, 0x45, 0x59,
+    0x37, 0x60, 0xd0, 0x9, 0x54, 0x1, 0x23, 0x8a,
+    0x0, 0x30, 0x3, 0xb0, 0xc, 0x3, 0xff, 0x83,
+    0x80, 0x1d, 0x80, 0x60, 0x5, 0x50, 0x4, 0x8e,
+    0x28, 0x0, 0x2a, 0xc9, 0xbb, 0x6, 0x80, 0x51,
+    0x22, 0xca, 0xad, 0x30, 0xc, 0xdb, 0xfd, 0x44,
+    0x1, 0xff, 0xd7,
 
     /* U+00FF "ÿ" */
-    0x0, 0x9, 0xd0, 0x4f, 0x30, 0x0, 0x0, 0x8,
-    0xb0, 0x3d, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xe0, 0x0, 0x0, 0xd, 0xd0, 0x6, 0xf6,
-    0x0, 0x0, 0x3f, 0x70, 0x0, 0xfc, 0x0, 0x0,
-    0x9f, 0x10, 0x0, 0x9f, 0x30, 0x1, 0xfa, 0x0,
-    0x0, 0x2f, 0x90, 0x6, 0xf3, 0x0, 0x0, 0xc,
-    0xf0, 0xd, 0xc0, 0x0, 0x0, 0x5, 0xf6, 0x3f,
-    0x60, 0x0, 0x0, 0x0, 0xed, 0xae, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf, 0xb0,
-    0x0, 0x0, 0x1, 0x0, 0x7f, 0x40, 0x0, 0x0,
-    0x1f, 0xaa, 0xfb, 0x0, 0x0, 0x0, 0x19, 0xee,
-    0xa1, 0x0, 0x0, 0x0,
+    0x0, 0xa7, 0x41, 0x3c, 0xc0, 0x3c, 0x2c, 0xe,
+    0x42, 0x1, 0xe8, 0xb0, 0x3d, 0x20, 0xf, 0xfe,
+    0x26, 0xf0, 0x7, 0xb7, 0x40, 0xb, 0x16, 0x0,
+    0xc6, 0x54, 0x0, 0x60, 0xa0, 0xd, 0x40, 0xc0,
+    0x13, 0x19, 0x80, 0x2, 0xca, 0x20, 0x15, 0x85,
+    0x0, 0x1c, 0x24, 0x3, 0x11, 0xb0, 0x2, 0xcc,
+    0xc0, 0x1d, 0x20, 0xc6, 0x54, 0x1, 0xe5, 0x1b,
+    0x91, 0x60, 0xf, 0x98, 0x95, 0x80, 0x3f, 0x48,
+    0x2, 0x80, 0x3f, 0x8, 0x21, 0x0, 0x70, 0x80,
+    0x1c, 0x3c, 0x3, 0x87, 0xaa, 0x90, 0x88, 0x0,
+    0xf3, 0x22, 0x16, 0x80, 0x3c,
 
     /* U+2022 "•" */
-    0x5, 0x30, 0x9f, 0xf3, 0xcf, 0xf6, 0x4e, 0xc1
+    0x5, 0x30, 0x9a, 0xc3, 0x50, 0x2, 0xc0, 0x9b,
+    0x80,
+
+    /* padding */
+    0x0
 };
 
 
@@ -2087,196 +1670,196 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20, .adv_w = 113, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 35, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 120, .adv_w = 179, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 219, .adv_w = 243, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 317, .adv_w = 198, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 408, .adv_w = 60, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 414, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 459, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 504, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 529, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 570, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 582, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 587, .adv_w = 65, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 593, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 665, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 743, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 776, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 841, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 906, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 984, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1049, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1121, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1193, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1265, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1337, .adv_w = 65, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1357, .adv_w = 65, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 1383, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1424, .adv_w = 168, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 1456, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 1497, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1562, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1715, .adv_w = 211, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 1813, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1891, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1976, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2061, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2133, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2198, .adv_w = 222, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2283, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2361, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2381, .adv_w = 148, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 2440, .adv_w = 207, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2518, .adv_w = 171, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2583, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2681, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2759, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2857, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2935, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 3055, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3133, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3205, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3277, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3355, .adv_w = 205, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3446, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3576, .adv_w = 194, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3654, .adv_w = 186, .box_w = 13, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 3739, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3817, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3862, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
-    {.bitmap_index = 3934, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3979, .adv_w = 168, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 4015, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4024, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 4032, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4082, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4159, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4209, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4286, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4341, .adv_w = 102, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4390, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4467, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4537, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4558, .adv_w = 82, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 4612, .adv_w = 177, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4689, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4710, .adv_w = 304, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4795, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4845, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4900, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4977, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5054, .adv_w = 118, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5084, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5129, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5171, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5221, .adv_w = 161, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5281, .adv_w = 259, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5366, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5416, .adv_w = 161, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 5500, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5545, .adv_w = 101, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5590, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5617, .adv_w = 101, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5671, .adv_w = 168, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 5694, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5694, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 5714, .adv_w = 164, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 5789, .adv_w = 186, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5867, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 5952, .adv_w = 204, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6043, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6070, .adv_w = 144, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 6142, .adv_w = 173, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 6148, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6239, .adv_w = 116, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 6260, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 6296, .adv_w = 168, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 6323, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 6328, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6419, .adv_w = 173, .box_w = 7, .box_h = 2, .ofs_x = 2, .ofs_y = 11},
-    {.bitmap_index = 6426, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6451, .adv_w = 168, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6501, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6526, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6551, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 4, .ofs_y = 11},
-    {.bitmap_index = 6559, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6629, .adv_w = 187, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 6709, .adv_w = 77, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 6714, .adv_w = 173, .box_w = 5, .box_h = 5, .ofs_x = 3, .ofs_y = -5},
-    {.bitmap_index = 6727, .adv_w = 124, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 6748, .adv_w = 120, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
-    {.bitmap_index = 6773, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 6809, .adv_w = 298, .box_w = 18, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 6935, .adv_w = 298, .box_w = 17, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 7054, .adv_w = 298, .box_w = 19, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 7187, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7252, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7380, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7508, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7636, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7764, .adv_w = 211, .box_w = 15, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7884, .adv_w = 211, .box_w = 15, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8019, .adv_w = 302, .box_w = 19, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8143, .adv_w = 208, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 8254, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8348, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8442, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8536, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8624, .adv_w = 89, .box_w = 6, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8675, .adv_w = 89, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8726, .adv_w = 89, .box_w = 8, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8794, .adv_w = 89, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8842, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8940, .adv_w = 234, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9042, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9170, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9298, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9426, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9554, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9682, .adv_w = 168, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 9714, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 9834, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9936, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10038, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10140, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10242, .adv_w = 186, .box_w = 13, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 10353, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10431, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10508, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10578, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10648, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10718, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10788, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10858, .adv_w = 172, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 10933, .adv_w = 285, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11023, .adv_w = 164, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 11093, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11170, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11247, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11324, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11401, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 11436, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11471, .adv_w = 80, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 11520, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11555, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11632, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11702, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11779, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11856, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11933, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12010, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12087, .adv_w = 168, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 12132, .adv_w = 183, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 12204, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12274, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12344, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12414, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12484, .adv_w = 161, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 12592, .adv_w = 196, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 12691, .adv_w = 161, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
-    {.bitmap_index = 12799, .adv_w = 90, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 3}
+    {.bitmap_index = 18, .adv_w = 113, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 32, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 110, .adv_w = 179, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 189, .adv_w = 243, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 280, .adv_w = 198, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 361, .adv_w = 60, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 368, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 413, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 458, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 483, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 512, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 525, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 529, .adv_w = 65, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 535, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 588, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 660, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 670, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 726, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 779, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 832, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 885, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 950, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1000, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1071, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1138, .adv_w = 65, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1155, .adv_w = 65, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1178, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1215, .adv_w = 168, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1234, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1270, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1321, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1455, .adv_w = 211, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1524, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1583, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1650, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1707, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1740, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1766, .adv_w = 222, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1834, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1856, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1861, .adv_w = 148, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1890, .adv_w = 207, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1947, .adv_w = 171, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1962, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2030, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2079, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2160, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2206, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2304, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2359, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2423, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2443, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2480, .adv_w = 205, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2551, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2664, .adv_w = 194, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2732, .adv_w = 186, .box_w = 13, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2785, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2838, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2853, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 2904, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 2919, .adv_w = 168, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2952, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2956, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 2964, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3011, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3063, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3105, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3158, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3208, .adv_w = 102, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3237, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3307, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3341, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3352, .adv_w = 82, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 3376, .adv_w = 177, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3423, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3428, .adv_w = 304, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3476, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3507, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3556, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3612, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3667, .adv_w = 118, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3686, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3730, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3758, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3786, .adv_w = 161, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3837, .adv_w = 259, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3915, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3961, .adv_w = 161, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4030, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4067, .adv_w = 101, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4102, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4107, .adv_w = 101, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4144, .adv_w = 168, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4166, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4166, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 4186, .adv_w = 164, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4246, .adv_w = 186, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4303, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 4381, .adv_w = 204, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4457, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4473, .adv_w = 144, .box_w = 9, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 4544, .adv_w = 173, .box_w = 6, .box_h = 2, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 4550, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4636, .adv_w = 116, .box_w = 7, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 4657, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 4693, .adv_w = 168, .box_w = 9, .box_h = 6, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 4709, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4713, .adv_w = 231, .box_w = 14, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4801, .adv_w = 173, .box_w = 7, .box_h = 2, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 4806, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4830, .adv_w = 168, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4864, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4889, .adv_w = 124, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 4912, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 4, .ofs_y = 11},
+    {.bitmap_index = 4920, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4954, .adv_w = 187, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 4989, .adv_w = 77, .box_w = 3, .box_h = 3, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4994, .adv_w = 173, .box_w = 5, .box_h = 5, .ofs_x = 3, .ofs_y = -5},
+    {.bitmap_index = 5007, .adv_w = 124, .box_w = 6, .box_h = 7, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 5018, .adv_w = 120, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6},
+    {.bitmap_index = 5042, .adv_w = 145, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 5077, .adv_w = 298, .box_w = 18, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5175, .adv_w = 298, .box_w = 17, .box_h = 14, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 5269, .adv_w = 298, .box_w = 19, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 5382, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 5432, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5518, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5604, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5693, .adv_w = 211, .box_w = 15, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5783, .adv_w = 211, .box_w = 15, .box_h = 16, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5867, .adv_w = 211, .box_w = 15, .box_h = 18, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5957, .adv_w = 302, .box_w = 19, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6036, .adv_w = 208, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 6120, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6168, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6216, .adv_w = 193, .box_w = 11, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6267, .adv_w = 193, .box_w = 11, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6313, .adv_w = 89, .box_w = 6, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6330, .adv_w = 89, .box_w = 6, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6347, .adv_w = 89, .box_w = 8, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6372, .adv_w = 89, .box_w = 6, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6386, .adv_w = 240, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6459, .adv_w = 234, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6529, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6627, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6724, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6825, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6927, .adv_w = 242, .box_w = 15, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7024, .adv_w = 168, .box_w = 8, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 7054, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 7162, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7215, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7268, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7324, .adv_w = 228, .box_w = 12, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7378, .adv_w = 186, .box_w = 13, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7447, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7500, .adv_w = 195, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7563, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7625, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7687, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7753, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7817, .adv_w = 172, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7880, .adv_w = 172, .box_w = 10, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7945, .adv_w = 285, .box_w = 18, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8030, .adv_w = 164, .box_w = 10, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 8088, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8153, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8218, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8286, .adv_w = 176, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8350, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8366, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8381, .adv_w = 80, .box_w = 7, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8401, .adv_w = 80, .box_w = 5, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8415, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8491, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8539, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8603, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8666, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8733, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8799, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8863, .adv_w = 168, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 8895, .adv_w = 183, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 8961, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9004, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9046, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9092, .adv_w = 195, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9135, .adv_w = 161, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 9219, .adv_w = 196, .box_w = 11, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 9278, .adv_w = 161, .box_w = 12, .box_h = 18, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 9363, .adv_w = 90, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 3}
 };
 
 /*---------------------
@@ -2938,7 +2521,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 28 px
  * Bpp: 4
- * Opts: --no-compress --no-prefilter --bpp 4 --size 28 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_28.c --force-fast-kern-format
+ * Compressed: tools/fonts/fontpack.py (prefilter + RLE)
+ * Opts: --bpp 4 --size 28 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_28.c --force-fast-kern-format
  ******************************************************************************/
 
 #include "lvgl.h"
@@ -21,4005 +22,2716 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0xc, 0xff, 0x50, 0xcf, 0xf4, 0xb, 0xff, 0x30,
-    0xaf, 0xf3, 0xa, 0xff, 0x20, 0x9f, 0xf2, 0x9,
-    0xff, 0x10, 0x8f, 0xf0, 0x7, 0xff, 0x0, 0x7f,
-    0xf0, 0x6, 0xfe, 0x0, 0x6f, 0xe0, 0x5, 0xfd,
-    0x0, 0x27, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x86, 0x0, 0xdf, 0xf6, 0xf, 0xff, 0x80,
-    0x6f, 0xc1,
+    0xc, 0xff, 0x28, 0x6, 0x10, 0x70, 0x3, 0x80,
+    0x80, 0x7c, 0x20, 0x60, 0x1f, 0x18, 0x8, 0x0,
+    0x43, 0xc0, 0x3f, 0x84, 0x4, 0x3, 0xe3, 0x3,
+    0x0, 0x3c, 0x40, 0x0, 0x4e, 0xa0, 0x1f, 0x14,
+    0x30, 0x3, 0xde, 0x58, 0x8, 0x1, 0xc1, 0x20,
+    0x72,
 
     /* U+0022 "\"" */
-    0x3f, 0xf1, 0x2, 0xff, 0x23, 0xff, 0x10, 0x2f,
-    0xf2, 0x2f, 0xf0, 0x1, 0xff, 0x12, 0xff, 0x0,
-    0x1f, 0xf1, 0x2f, 0xf0, 0x1, 0xff, 0x11, 0xff,
-    0x0, 0xf, 0xf0, 0x1f, 0xf0, 0x0, 0xff, 0x0,
-    0x98, 0x0, 0x9, 0x90,
+    0x3f, 0xf0, 0x81, 0x7f, 0x88, 0x3, 0xf8, 0x40,
+    0x2, 0x6, 0x0, 0x30, 0xf, 0xfe, 0x31, 0x80,
+    0x61, 0x0, 0x8, 0x7, 0xf0, 0xb3, 0x80, 0x4c,
+    0xc0,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xaf, 0x50, 0x0, 0x6, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xf3, 0x0, 0x0,
-    0x7f, 0x70, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x10,
-    0x0, 0x9, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf0, 0x0, 0x0, 0xbf, 0x30, 0x0, 0x0, 0x0,
-    0x1, 0xfd, 0x0, 0x0, 0xd, 0xf1, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x8f, 0x80, 0x0,
-    0x4, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9, 0xf6,
-    0x0, 0x0, 0x5f, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0x40, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xf2, 0x0, 0x0, 0x9f, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x0, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0xcf, 0x30, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0x60, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0x6f,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x20, 0x0,
-    0x8, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
-    0x0, 0x0, 0xaf, 0x50, 0x0, 0x0,
+    0x0, 0xf5, 0x7a, 0x80, 0x66, 0xf9, 0x0, 0xfe,
+    0x10, 0x60, 0xc, 0x21, 0xc0, 0x1f, 0xcc, 0x4,
+    0x1, 0xb8, 0x8, 0x3, 0xf8, 0x80, 0x40, 0x31,
+    0x3, 0x0, 0x7e, 0x10, 0x20, 0xe, 0x60, 0x20,
+    0xc, 0xbf, 0xf7, 0x1, 0x7f, 0xf1, 0x7, 0x7f,
+    0xb8, 0x3, 0xff, 0x90, 0xbf, 0xf3, 0x83, 0xff,
+    0xeb, 0x3, 0xff, 0xb8, 0x3, 0x84, 0x38, 0x3,
+    0x8, 0x30, 0x7, 0xf1, 0x1, 0x0, 0x62, 0x2,
+    0x0, 0xfe, 0x60, 0x60, 0xd, 0xc1, 0xc0, 0x1f,
+    0xc4, 0x4, 0x1, 0x8c, 0x8, 0x3, 0xf0, 0x80,
+    0x80, 0x73, 0x3, 0x80, 0x64, 0xff, 0xb8, 0x7,
+    0xff, 0x8c, 0x33, 0xfe, 0x0, 0xff, 0xe4, 0x27,
+    0xfd, 0x0, 0xff, 0xfb, 0x40, 0xbf, 0xf0, 0x7,
+    0x70, 0x70, 0x6, 0x60, 0x60, 0xf, 0xe2, 0x2,
+    0x0, 0xc4, 0x4, 0x1, 0xfc, 0xc0, 0xc0, 0x1b,
+    0x83, 0x80, 0x3f, 0x88, 0x8, 0x3, 0x10, 0x10,
+    0x7,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8c, 0xef, 0xff, 0xd9, 0x40, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20,
-    0x5, 0xff, 0xfc, 0x8f, 0xd7, 0xae, 0xff, 0x10,
-    0xe, 0xff, 0x50, 0xf, 0xc0, 0x0, 0x59, 0x0,
-    0x4f, 0xf9, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x4f, 0xfa, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x80, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xbf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xfe, 0x94, 0x0, 0x0,
-    0x0, 0x1, 0x6b, 0xff, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xed, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x3c, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0xdf, 0xf1,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x8f, 0xf3,
-    0x4, 0x0, 0x0, 0xf, 0xc0, 0x0, 0xbf, 0xf1,
-    0x5f, 0xa2, 0x0, 0xf, 0xc0, 0x5, 0xff, 0xc0,
-    0xaf, 0xff, 0xc8, 0x7f, 0xd8, 0xcf, 0xff, 0x30,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x17, 0xbe, 0xff, 0xff, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0xfb, 0xf0, 0x3, 0xff, 0xbc, 0x31, 0x9c,
+    0x7, 0xfb, 0x28, 0x1, 0xcd, 0xce, 0x62, 0x1,
+    0x13, 0x5e, 0x90, 0x1, 0x64, 0x0, 0x6e, 0x5,
+    0xa, 0x20, 0x46, 0x0, 0xb0, 0x5, 0x64, 0x0,
+    0xbd, 0x75, 0x30, 0x82, 0x8, 0x32, 0x80, 0x7c,
+    0xb2, 0x0, 0x10, 0x7, 0x80, 0x7f, 0xe1, 0x0,
+    0x60, 0x7, 0xfe, 0x41, 0x5, 0x80, 0xf, 0xfd,
+    0x0, 0x7, 0xfb, 0x0, 0xff, 0x35, 0x8, 0x1,
+    0x0, 0xfa, 0x50, 0x3, 0xcb, 0xf2, 0x80, 0x10,
+    0xb5, 0xe1, 0x80, 0x70, 0xb5, 0xf0, 0x9, 0x0,
+    0xf, 0xc, 0x3, 0xe1, 0x2, 0xdc, 0x30, 0x7,
+    0x80, 0x7f, 0xc7, 0x84, 0x6, 0x20, 0x1f, 0xf9,
+    0x40, 0x4, 0x8, 0x1, 0xfe, 0x30, 0x1, 0x2d,
+    0xd1, 0x0, 0x7c, 0xa8, 0x6, 0x3e, 0xb, 0xb9,
+    0xe, 0x3, 0x19, 0x40, 0xf, 0xa, 0x60, 0x1,
+    0xbc, 0x1, 0x39, 0x80, 0xd9, 0x80, 0x27, 0xa1,
+    0x4, 0x3, 0x1c, 0x72, 0x0, 0x61, 0x7b, 0xef,
+    0x3, 0xfc, 0x70, 0xf, 0xfe, 0xc0,
 
     /* U+0025 "%" */
-    0x0, 0x7d, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0xa, 0xfd, 0x9c, 0xfc, 0x0,
-    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x4f, 0xb0,
-    0x0, 0x8f, 0x70, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0xbf, 0x30, 0x0, 0xf, 0xd0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x0, 0xef, 0x0, 0x0, 0xc,
-    0xf1, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0xfe,
-    0x0, 0x0, 0xa, 0xf1, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0xef, 0x0, 0x0, 0xc, 0xf1, 0x0,
-    0xef, 0x30, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0,
-    0xf, 0xd0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xb0, 0x0, 0x8f, 0x70, 0x4f, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xfd, 0x9c, 0xfc, 0x0,
-    0xef, 0x30, 0x5, 0x88, 0x50, 0x0, 0x0, 0x7d,
-    0xfe, 0x80, 0x9, 0xf8, 0x1, 0xcf, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0xb,
-    0xf9, 0x11, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x30, 0x2f, 0xc0, 0x0, 0xc, 0xf3, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x6f, 0x60, 0x0,
-    0x6, 0xf7, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x8f, 0x40, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x7f, 0x50, 0x0, 0x5, 0xf8,
-    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x4f, 0x80,
-    0x0, 0x8, 0xf5, 0x0, 0x0, 0x4f, 0xd0, 0x0,
-    0x0, 0xe, 0xe1, 0x0, 0x1e, 0xe0, 0x0, 0x1,
-    0xef, 0x30, 0x0, 0x0, 0x4, 0xfe, 0x87, 0xef,
-    0x40, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3b, 0xff, 0xb3, 0x0,
+    0x0, 0x3e, 0xff, 0x40, 0x7, 0xf6, 0xf9, 0x80,
+    0x6a, 0x80, 0x62, 0x7c, 0x0, 0xfa, 0x49, 0x8c,
+    0x2, 0x45, 0x4d, 0x9c, 0x73, 0x70, 0xe, 0x46,
+    0x29, 0x0, 0xde, 0x10, 0x1, 0x40, 0x50, 0x7,
+    0x48, 0x70, 0x7, 0x28, 0x18, 0x6, 0x32, 0x10,
+    0xa, 0x49, 0x8c, 0x3, 0x84, 0x40, 0x1c, 0xc0,
+    0x19, 0x18, 0xa4, 0x3, 0xc2, 0x20, 0xe, 0x60,
+    0xd, 0x41, 0xc0, 0x1f, 0x28, 0x18, 0x6, 0x32,
+    0x10, 0x91, 0x73, 0x0, 0xfb, 0xc2, 0x0, 0x28,
+    0xa, 0x4, 0x62, 0x80, 0xf, 0xc8, 0xa9, 0xb3,
+    0x8e, 0x6e, 0x14, 0x1c, 0x0, 0x58, 0x82, 0x80,
+    0x6a, 0x80, 0x62, 0x7c, 0x9, 0x17, 0x31, 0xca,
+    0x77, 0x56, 0x8, 0x4, 0xfb, 0xfd, 0x0, 0x8c,
+    0x50, 0x14, 0x6d, 0xdc, 0x73, 0xa0, 0xf, 0xea,
+    0xe, 0x2, 0x43, 0x91, 0x14, 0x1a, 0x18, 0x7,
+    0xd2, 0x2e, 0x60, 0x81, 0x40, 0x1a, 0x81, 0x0,
+    0x3c, 0x8c, 0x50, 0x0, 0xe0, 0x20, 0xc, 0x41,
+    0xe0, 0x1c, 0x34, 0x1c, 0x1, 0x78, 0x8, 0x6,
+    0x10, 0xf, 0xac, 0x5c, 0xc0, 0x23, 0xd, 0x0,
+    0xda, 0x1a, 0x1, 0x91, 0x4a, 0x0, 0x32, 0xb,
+    0x8, 0x0, 0x58, 0x54, 0x2, 0x1a, 0xe, 0x0,
+    0xf5, 0xf, 0xc3, 0xf8, 0xd0, 0x6, 0xb1, 0x73,
+    0x0, 0xf2, 0x62, 0xbc, 0x2e, 0x20, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x19, 0xdf, 0xfd, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0x40, 0x5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0, 0x0,
-    0x9f, 0xc0, 0x0, 0x0, 0x0, 0x4f, 0xf3, 0x0,
-    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x2f, 0xf7,
-    0x0, 0x1, 0xef, 0x80, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x20, 0x2d, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xd8, 0xff, 0xe3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcf, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfe, 0x8f, 0xfd, 0x10,
-    0x0, 0x24, 0x0, 0x6, 0xff, 0xa1, 0x5, 0xff,
-    0xd1, 0x0, 0x9f, 0xb0, 0x2f, 0xfb, 0x0, 0x0,
-    0x5f, 0xfd, 0x10, 0xdf, 0x70, 0x8f, 0xf2, 0x0,
-    0x0, 0x5, 0xff, 0xd6, 0xff, 0x30, 0xbf, 0xe0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0xaf,
-    0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0,
-    0x6f, 0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfd,
-    0x10, 0xd, 0xff, 0xe7, 0x54, 0x59, 0xef, 0xfb,
-    0xff, 0xd1, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfe,
-    0x60, 0x5f, 0xf8, 0x0, 0x4, 0x9d, 0xff, 0xeb,
-    0x60, 0x0, 0x5, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc3, 0x3b, 0xfe, 0xd8, 0x0, 0xff, 0x1f,
+    0x31, 0x0, 0x9, 0xf4, 0x3, 0xfb, 0x80, 0x6f,
+    0xfd, 0x40, 0x50, 0x1, 0xf1, 0x90, 0x5a, 0x0,
+    0x15, 0x81, 0x0, 0x3e, 0x70, 0x3, 0x0, 0x61,
+    0x0, 0xfe, 0x60, 0x2, 0x0, 0x42, 0xc0, 0x80,
+    0x1f, 0x11, 0x84, 0x10, 0x16, 0x8, 0xa4, 0x3,
+    0xf7, 0x80, 0x3e, 0x34, 0x87, 0x44, 0x3, 0xf1,
+    0xd0, 0x13, 0x82, 0x79, 0x80, 0x7f, 0x1c, 0x80,
+    0x43, 0x42, 0x1, 0xfc, 0xd8, 0x62, 0xe0, 0x38,
+    0x20, 0x11, 0x20, 0x4, 0xd2, 0xb, 0xf1, 0x40,
+    0x58, 0x20, 0xb, 0xb8, 0xa, 0x41, 0x28, 0x41,
+    0x68, 0xb, 0x4, 0x10, 0x30, 0x28, 0x1, 0x20,
+    0x19, 0x68, 0xb, 0x18, 0x81, 0x0, 0xc0, 0x48,
+    0x3, 0x96, 0x80, 0xa4, 0x10, 0xc0, 0x40, 0x44,
+    0x1, 0xe5, 0xa0, 0xb, 0x80, 0x18, 0x0, 0xb0,
+    0xf, 0xb0, 0x2, 0x81, 0x6, 0x20, 0x5e, 0x75,
+    0x45, 0x9e, 0x60, 0x40, 0x2c, 0x10, 0xc4, 0x1,
+    0x8a, 0xba, 0x61, 0x14, 0xdd, 0x1, 0x48, 0xd,
+    0xd9, 0x88, 0x0, 0x29, 0x3c, 0xc0, 0xb4, 0x90,
+    0x1, 0x24, 0xef, 0xfb, 0xad, 0x80, 0x32, 0xd8,
+    0x0,
 
     /* U+0027 "'" */
-    0x3f, 0xf1, 0x3f, 0xf1, 0x2f, 0xf0, 0x2f, 0xf0,
-    0x2f, 0xf0, 0x1f, 0xf0, 0x1f, 0xf0, 0x9, 0x80,
+    0x3f, 0xf0, 0x80, 0x61, 0x0, 0x8, 0x7, 0xe3,
+    0x0, 0xf8, 0x59, 0xc0,
 
     /* U+0028 "(" */
-    0x0, 0x4, 0xff, 0x40, 0x0, 0xcf, 0xc0, 0x0,
-    0x4f, 0xf5, 0x0, 0xb, 0xfe, 0x0, 0x0, 0xff,
-    0x90, 0x0, 0x5f, 0xf4, 0x0, 0x9, 0xff, 0x0,
-    0x0, 0xcf, 0xd0, 0x0, 0xf, 0xfa, 0x0, 0x2,
-    0xff, 0x70, 0x0, 0x3f, 0xf6, 0x0, 0x4, 0xff,
-    0x60, 0x0, 0x5f, 0xf5, 0x0, 0x5, 0xff, 0x50,
-    0x0, 0x4f, 0xf6, 0x0, 0x3, 0xff, 0x60, 0x0,
-    0x2f, 0xf7, 0x0, 0x0, 0xff, 0xa0, 0x0, 0xc,
-    0xfd, 0x0, 0x0, 0x9f, 0xf0, 0x0, 0x5, 0xff,
-    0x40, 0x0, 0xf, 0xf9, 0x0, 0x0, 0xaf, 0xe0,
-    0x0, 0x4, 0xff, 0x50, 0x0, 0xc, 0xfc, 0x0,
-    0x0, 0x4f, 0xf4,
+    0x0, 0x93, 0xfc, 0x80, 0x14, 0x1, 0xa0, 0x1,
+    0xc, 0x24, 0x2, 0xf0, 0x15, 0x0, 0x90, 0x1c,
+    0x2, 0x50, 0x6, 0x80, 0x58, 0x0, 0x40, 0x9,
+    0x40, 0x80, 0x31, 0x83, 0x80, 0x44, 0x0, 0xd0,
+    0x8, 0x40, 0x2, 0x1, 0x38, 0x7, 0x84, 0x0,
+    0x60, 0x1f, 0xe1, 0x0, 0x18, 0x4, 0xe0, 0x1e,
+    0x10, 0x0, 0x80, 0x44, 0x0, 0xd0, 0xc, 0x60,
+    0xe0, 0x19, 0x40, 0x80, 0x36, 0x0, 0x10, 0x2,
+    0x50, 0x6, 0x80, 0x65, 0x7, 0x0, 0xdc, 0x2,
+    0xa0, 0x12, 0x18, 0x48, 0x6, 0x80, 0x34,
 
     /* U+0029 ")" */
-    0xd, 0xfb, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
-    0xdf, 0xb0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x2f,
-    0xf7, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x8, 0xff,
-    0x0, 0x0, 0x6f, 0xf3, 0x0, 0x3, 0xff, 0x60,
-    0x0, 0xf, 0xf9, 0x0, 0x0, 0xff, 0xa0, 0x0,
-    0xe, 0xfb, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0xd,
-    0xfc, 0x0, 0x0, 0xef, 0xb0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0xff, 0x90, 0x0, 0x3f, 0xf6, 0x0,
-    0x6, 0xff, 0x30, 0x0, 0x8f, 0xf0, 0x0, 0xd,
-    0xfc, 0x0, 0x2, 0xff, 0x70, 0x0, 0x7f, 0xf2,
-    0x0, 0xd, 0xfb, 0x0, 0x6, 0xff, 0x30, 0x0,
-    0xdf, 0xb0, 0x0,
+    0xd, 0xfb, 0x0, 0xd6, 0x8, 0x60, 0x13, 0x10,
+    0x40, 0x6, 0xa0, 0x42, 0x0, 0x94, 0x0, 0xa0,
+    0x11, 0x10, 0x2c, 0x3, 0x28, 0x18, 0x6, 0xe0,
+    0x1, 0x80, 0x4a, 0x0, 0x50, 0x8, 0xc0, 0x1e,
+    0x1, 0xe3, 0x0, 0xc2, 0x2, 0x1, 0x8c, 0x1c,
+    0x3, 0xfe, 0x30, 0x70, 0xc, 0x20, 0x20, 0x1e,
+    0x30, 0x8, 0xc0, 0x1e, 0x1, 0x28, 0x1, 0x40,
+    0x2e, 0x0, 0x18, 0x4, 0xa0, 0x60, 0x11, 0x10,
+    0x2c, 0x2, 0x50, 0x2, 0x80, 0x54, 0x8, 0x40,
+    0x6, 0x20, 0x80, 0xa, 0xc1, 0xc, 0x0,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x3f, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xf6, 0x0, 0x0, 0x1e, 0x80, 0x3f, 0x60, 0x7e,
-    0x33, 0xdf, 0xe9, 0xfa, 0xdf, 0xf5, 0x0, 0x7e,
-    0xff, 0xff, 0x91, 0x0, 0x1, 0xaf, 0xff, 0xc2,
-    0x0, 0x7, 0xef, 0xef, 0xef, 0xf9, 0x13, 0xfe,
-    0x63, 0xf6, 0x4d, 0xf6, 0x6, 0x10, 0x3f, 0x60,
-    0x6, 0x0, 0x0, 0x3, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0x30, 0x0, 0x0,
+    0x0, 0xc7, 0xec, 0x1, 0xff, 0xc3, 0x1e, 0x80,
+    0xe, 0x7e, 0x32, 0x37, 0xea, 0xc, 0xd8, 0x16,
+    0x3d, 0x80, 0x60, 0x52, 0x6e, 0x50, 0x3, 0x20,
+    0x4, 0x76, 0x20, 0x7, 0xf5, 0x10, 0x13, 0xd9,
+    0x13, 0x80, 0x9d, 0x8, 0xb2, 0x67, 0x39, 0xf6,
+    0x0, 0x93, 0x65, 0x81, 0x84, 0x3, 0xcc, 0x1,
+    0xc5, 0xa, 0x1, 0x80,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x44, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0, 0x3, 0x33, 0x33, 0xff, 0x73,
-    0x33, 0x31, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x50, 0x0, 0x0,
+    0x0, 0xf2, 0x20, 0x40, 0x3f, 0xeb, 0xb2, 0x0,
+    0x7f, 0xf9, 0xc, 0xf8, 0x0, 0x46, 0x78, 0x4b,
+    0x33, 0x80, 0x11, 0x99, 0x9c, 0x3, 0xff, 0x84,
+    0x5f, 0xfc, 0x0, 0xaf, 0xfc, 0xc0, 0x1f, 0xfe,
+    0xc0,
 
     /* U+002C "," */
-    0x1a, 0xb4, 0x8, 0xff, 0xe0, 0x9f, 0xff, 0x2,
-    0xdf, 0xc0, 0xa, 0xf6, 0x0, 0xef, 0x10, 0x2f,
-    0xc0, 0x6, 0xf6, 0x0,
+    0x1a, 0xb4, 0x9, 0x54, 0xa0, 0x10, 0x0, 0x85,
+    0x90, 0x18, 0x13, 0x85, 0x0, 0x10, 0x1c, 0x8,
+    0x4c, 0x41, 0x2, 0x80, 0x0,
 
     /* U+002D "-" */
-    0x25, 0x55, 0x55, 0x55, 0x6, 0xff, 0xff, 0xff,
-    0xf2, 0x6f, 0xff, 0xff, 0xff, 0x20,
+    0x25, 0x5f, 0x81, 0x2a, 0xbe, 0x20, 0xf, 0xe0,
 
     /* U+002E "." */
-    0x1a, 0xc4, 0x9, 0xff, 0xe0, 0xaf, 0xff, 0x2,
-    0xde, 0x60,
+    0x1a, 0xc4, 0x8, 0x53, 0xa0, 0x30, 0x0, 0x84,
+    0x10, 0xc8, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x86, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xfe, 0x58, 0x60, 0xf, 0xeb, 0x7e, 0x0,
+    0xfc, 0x62, 0x16, 0x1, 0xfa, 0x80, 0x8c, 0x3,
+    0xf3, 0x85, 0x0, 0x7e, 0x41, 0x5, 0x0, 0xfd,
+    0xc0, 0x64, 0x1, 0xf9, 0x42, 0xc0, 0x3f, 0x28,
+    0x1, 0x80, 0x3f, 0x78, 0x18, 0x80, 0x7e, 0x50,
+    0xa0, 0xf, 0xcc, 0x0, 0x70, 0xf, 0xda, 0x8,
+    0x20, 0x1f, 0xa, 0x7, 0x0, 0x7e, 0x70, 0x2,
+    0x80, 0x7e, 0xa0, 0x50, 0xf, 0xc4, 0x61, 0xe0,
+    0x1f, 0x94, 0x5, 0x40, 0x3f, 0x50, 0x38, 0x7,
+    0xe2, 0x20, 0x68, 0x7, 0xea, 0x1, 0x40, 0xf,
+    0xca, 0xe, 0x1, 0xf8, 0xc8, 0x28, 0x3, 0xf5,
+    0x1, 0x18, 0x7, 0xe7, 0x5, 0x0, 0xfc, 0x82,
+    0x14, 0x1, 0xfb, 0x40, 0x88, 0x1, 0xf8,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xb5, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xfb, 0x10,
-    0x0, 0x0, 0x4f, 0xff, 0xd9, 0x8a, 0xff, 0xfd,
-    0x10, 0x0, 0x1e, 0xff, 0x70, 0x0, 0x1, 0xbf,
-    0xfa, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xdf, 0xf3, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x90, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfe, 0x7, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x9f, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x3a, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0xaf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x49, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x13, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0xe,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0x30,
-    0x1, 0xef, 0xf7, 0x0, 0x0, 0x1b, 0xff, 0xa0,
-    0x0, 0x4, 0xff, 0xfd, 0x98, 0xaf, 0xff, 0xd1,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xeb, 0x50,
-    0x0, 0x0,
+    0x0, 0xe7, 0xcf, 0xf7, 0x5a, 0x80, 0x7e, 0x4e,
+    0x83, 0x0, 0xa, 0x55, 0x88, 0x7, 0x25, 0x88,
+    0x13, 0x3a, 0x80, 0x13, 0x4, 0x2, 0x1a, 0x0,
+    0x46, 0xcc, 0x57, 0x20, 0x15, 0x80, 0x52, 0x20,
+    0xee, 0x0, 0xc3, 0x64, 0xa, 0x60, 0x6, 0x1,
+    0x80, 0xf, 0xa4, 0x1, 0x40, 0x62, 0xe, 0x1,
+    0xf9, 0x4, 0x1c, 0x10, 0x1, 0x80, 0x1f, 0xca,
+    0x2, 0x2e, 0x0, 0x30, 0x7, 0xf1, 0x80, 0x8,
+    0xc0, 0x2, 0x1, 0xfd, 0xe0, 0x7, 0x0, 0xff,
+    0xe2, 0x98, 0x0, 0x40, 0x3f, 0xbc, 0x0, 0xfc,
+    0x0, 0x60, 0xf, 0xe3, 0x0, 0x12, 0x0, 0x30,
+    0x3, 0xf9, 0x40, 0x44, 0x62, 0xe, 0x1, 0xf9,
+    0x4, 0x1c, 0x0, 0xc0, 0x30, 0x1, 0xf4, 0x80,
+    0x28, 0x1, 0x22, 0xe, 0xe0, 0xc, 0x36, 0x40,
+    0xa6, 0x0, 0x1a, 0x0, 0x46, 0xcc, 0x57, 0x20,
+    0x15, 0x80, 0x64, 0xb1, 0x2, 0x67, 0x50, 0x1,
+    0xe0, 0x80, 0x72, 0x74, 0x18, 0x0, 0x52, 0xb0,
+    0x40, 0x20,
 
     /* U+0031 "1" */
-    0xcf, 0xff, 0xff, 0xf6, 0xcf, 0xff, 0xff, 0xf6,
-    0x57, 0x77, 0xaf, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0xcf, 0xff, 0x30, 0x7, 0xe9, 0x88, 0x94, 0x2,
+    0x57, 0x7b, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfe,
+    0xc0,
 
     /* U+0032 "2" */
-    0x0, 0x3, 0x8c, 0xef, 0xfc, 0x82, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x2e, 0xff, 0xfb, 0x98, 0xae, 0xff, 0xf5, 0x0,
-    0x2d, 0xf9, 0x10, 0x0, 0x0, 0x8f, 0xfe, 0x0,
-    0x1, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfa, 0x77, 0x77, 0x77, 0x77, 0x70,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0x8e, 0x33, 0xbf, 0xd9, 0x4, 0x1, 0xc5,
+    0x78, 0xe6, 0x20, 0x3, 0x7d, 0x60, 0x8, 0xb1,
+    0x0, 0x8, 0xce, 0xa2, 0x0, 0x95, 0x0, 0x8c,
+    0x1b, 0xae, 0x62, 0xb9, 0xc0, 0x16, 0x0, 0x2c,
+    0x99, 0x8, 0x7, 0x41, 0x80, 0x90, 0x0, 0x58,
+    0x3, 0xf2, 0x0, 0x18, 0x3, 0xff, 0x8, 0x1,
+    0x80, 0x3f, 0xf3, 0x80, 0x90, 0x7, 0xfc, 0xe2,
+    0xe, 0x1, 0xff, 0x24, 0x0, 0xc0, 0x7, 0xf8,
+    0xec, 0x1, 0x42, 0x1, 0xfc, 0x78, 0x0, 0xb4,
+    0x0, 0xfe, 0x4c, 0x0, 0x5a, 0x0, 0x7f, 0x25,
+    0x80, 0x2d, 0x0, 0x3f, 0x92, 0xc0, 0x16, 0x80,
+    0x1f, 0xcb, 0x60, 0xc, 0x40, 0xf, 0xe5, 0xa0,
+    0x6, 0x18, 0x7, 0xf2, 0xd0, 0x1, 0x51, 0xdf,
+    0xf0, 0x2, 0x80, 0x25, 0x88, 0xfe, 0x20, 0xf,
+    0xfe, 0x20,
 
     /* U+0033 "3" */
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6,
-    0x77, 0x77, 0x77, 0x77, 0xdf, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf9, 0x61, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3, 0x88, 0xad,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8,
-    0x3f, 0xc4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x2a,
-    0xff, 0xfe, 0xa8, 0x89, 0xdf, 0xff, 0x70, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x1,
-    0x6a, 0xdf, 0xfe, 0xc7, 0x20, 0x0,
+    0xf, 0xff, 0xfe, 0x8, 0x7, 0xff, 0x16, 0x62,
+    0x3f, 0x10, 0x2, 0x0, 0xc, 0xef, 0xf0, 0x90,
+    0x2b, 0x80, 0x7f, 0x1c, 0x81, 0x50, 0x7, 0xf0,
+    0xe8, 0x3, 0xc0, 0x3f, 0xda, 0x21, 0x64, 0x1,
+    0xfd, 0x26, 0x10, 0x80, 0x1f, 0xca, 0xc0, 0xe,
+    0x61, 0x0, 0xfc, 0x40, 0x13, 0x4f, 0x38, 0x7,
+    0xc8, 0xee, 0x52, 0x0, 0x44, 0x80, 0x78, 0xe2,
+    0x15, 0xb6, 0x0, 0x63, 0x0, 0xff, 0x24, 0x80,
+    0x2c, 0x3, 0xfe, 0x70, 0x1, 0x80, 0x7f, 0xf0,
+    0x84, 0x14, 0x3, 0xf9, 0xc0, 0x4, 0x75, 0x88,
+    0x1, 0xe5, 0x90, 0x5, 0x48, 0x1d, 0xf5, 0x44,
+    0x27, 0x68, 0x1, 0x5, 0x4c, 0x0, 0x15, 0x77,
+    0x31, 0x0, 0x21, 0xc0, 0x13, 0xd2, 0xa4, 0x0,
+    0x13, 0x8d, 0x70, 0x0,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xa0, 0x0, 0xa, 0xb7, 0x0,
-    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x1, 0xef, 0xf2, 0x0, 0x0, 0xf,
-    0xfa, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0xf, 0xfa, 0x0, 0x0, 0x8f, 0xfd, 0x66, 0x66,
-    0x66, 0x6f, 0xfc, 0x66, 0x62, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfa, 0x0, 0x0,
+    0x0, 0xfe, 0x4f, 0xf5, 0x80, 0x7f, 0xf0, 0x4a,
+    0x80, 0x68, 0x3, 0xff, 0x83, 0xc2, 0x1a, 0x20,
+    0x1f, 0xfa, 0x4c, 0x20, 0xc0, 0x3f, 0xf2, 0xb0,
+    0x2b, 0x80, 0x7f, 0xe2, 0xa0, 0x2a, 0x0, 0xff,
+    0xe0, 0xf8, 0x3, 0x80, 0x3f, 0xf8, 0x34, 0x41,
+    0x26, 0x1, 0xff, 0x9d, 0x41, 0x58, 0x2, 0xab,
+    0x70, 0xf, 0x1c, 0x1, 0x50, 0x6, 0x54, 0xd0,
+    0xe, 0x1d, 0x0, 0x78, 0x7, 0xff, 0x6, 0x84,
+    0x28, 0x80, 0x3f, 0xf4, 0x20, 0x11, 0xb3, 0x78,
+    0x0, 0xcd, 0x89, 0x80, 0x5, 0x33, 0xf0, 0x0,
+    0xe6, 0x64, 0x10, 0xf, 0xfe, 0x2f, 0xff, 0xfc,
+    0x0, 0x5f, 0xf9, 0x80, 0x3f, 0xff, 0x80,
 
     /* U+0035 "5" */
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x4f, 0xf9, 0x77, 0x77, 0x77, 0x77, 0x0,
-    0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x77, 0x77, 0x77, 0x9c, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0x3, 0x10, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xd, 0xe6, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x70,
-    0x5f, 0xff, 0xfb, 0x98, 0x9b, 0xff, 0xfd, 0x0,
-    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x4, 0x9c, 0xef, 0xed, 0x94, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xfc, 0x1, 0x88, 0x3, 0xff,
+    0x86, 0xe0, 0x6, 0x88, 0xfc, 0x1, 0x88, 0x1,
+    0x4e, 0xff, 0x80, 0x37, 0x0, 0x8, 0x3, 0xff,
+    0x8, 0x0, 0x40, 0x3f, 0xf1, 0x0, 0x80, 0x7f,
+    0xf0, 0x5c, 0xc, 0x3, 0xff, 0x82, 0x40, 0x5f,
+    0xf7, 0x64, 0xa0, 0x7, 0x84, 0x3, 0x84, 0xda,
+    0xf0, 0x80, 0x34, 0x47, 0x98, 0xc0, 0x7, 0x82,
+    0x1, 0x3b, 0xfa, 0x73, 0x4c, 0x6, 0x0, 0x3f,
+    0xe2, 0xd0, 0x3, 0x80, 0x7f, 0xe1, 0x30, 0x10,
+    0xf, 0xfe, 0x31, 0x88, 0x7, 0xe1, 0x30, 0x20,
+    0x7, 0x7b, 0x0, 0x78, 0xb4, 0x1, 0x40, 0xa4,
+    0x33, 0xf7, 0x31, 0x37, 0xa6, 0x4, 0xe0, 0xb4,
+    0x40, 0x4, 0x67, 0x64, 0x0, 0x26, 0x0, 0x4b,
+    0xb6, 0xc6, 0x20, 0x24, 0xd7, 0x61, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0,
-    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x1d, 0xff, 0xfb, 0x86, 0x89, 0xed, 0x0,
-    0x0, 0xcf, 0xfb, 0x20, 0x0, 0x0, 0x2, 0x0,
-    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf3, 0x5, 0xae, 0xfe, 0xd8, 0x20, 0x0,
-    0xaf, 0xf3, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xaf, 0xfd, 0xff, 0x95, 0x46, 0xaf, 0xff, 0x60,
-    0x9f, 0xff, 0xd1, 0x0, 0x0, 0x4, 0xff, 0xe0,
-    0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x4f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
-    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
-    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf4,
-    0x2, 0xff, 0xd1, 0x0, 0x0, 0x4, 0xff, 0xd0,
-    0x0, 0x7f, 0xff, 0x95, 0x45, 0xaf, 0xff, 0x40,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x0, 0x17, 0xce, 0xfe, 0xc7, 0x10, 0x0,
+    0x0, 0xe2, 0x8c, 0xef, 0xf6, 0xd2, 0x0, 0x70,
+    0xd6, 0xb9, 0x88, 0x0, 0x96, 0xd0, 0x2, 0x1c,
+    0x50, 0x2, 0x3c, 0xbb, 0x9, 0x20, 0x5, 0xa4,
+    0x9, 0xb7, 0xd, 0x13, 0xde, 0x1, 0x31, 0x82,
+    0x59, 0x0, 0x78, 0x80, 0x2b, 0x0, 0x50, 0x7,
+    0xfc, 0x44, 0x5, 0x10, 0xf, 0xf9, 0x0, 0x18,
+    0x1, 0xff, 0xb8, 0x0, 0xa0, 0xb5, 0xdf, 0xdb,
+    0x4, 0x1, 0x10, 0x5, 0x74, 0xa2, 0x2, 0x4f,
+    0xae, 0x1, 0xdc, 0x80, 0xd5, 0x72, 0xa0, 0x8,
+    0x60, 0x30, 0x1, 0x13, 0xa5, 0x51, 0xaa, 0xc0,
+    0x10, 0x1c, 0x1, 0x70, 0x80, 0x72, 0x38, 0xa,
+    0x98, 0x0, 0x4c, 0x3, 0xec, 0x0, 0x12, 0x80,
+    0x7f, 0xf0, 0x84, 0x4a, 0x2, 0x60, 0x1f, 0x60,
+    0x0, 0x82, 0x0, 0x1c, 0x20, 0x1c, 0x8e, 0x4,
+    0x80, 0x50, 0x5, 0xd2, 0xa8, 0xb5, 0x60, 0x9,
+    0x0, 0x9e, 0x40, 0xd, 0x57, 0x4a, 0x3, 0x48,
+    0x1, 0x9b, 0xa0, 0xc4, 0x4, 0xe3, 0xd4, 0x0,
 
     /* U+0037 "7" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x2f, 0xfb, 0x77, 0x77, 0x77, 0x77, 0xcf, 0xf5,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff, 0x70,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0xfe, 0x15, 0x0, 0x7f, 0xf0, 0xcc,
+    0x2, 0x48, 0x8f, 0xc6, 0x0, 0xc0, 0x8, 0xdd,
+    0xff, 0x10, 0xa, 0x80, 0x7f, 0xcc, 0x21, 0x20,
+    0x1f, 0xfa, 0xc0, 0xc, 0x5, 0xfe, 0x80, 0xf,
+    0x21, 0x3, 0x8, 0x7, 0xfd, 0x0, 0xb, 0x0,
+    0xff, 0x8c, 0xc0, 0x84, 0x1, 0xff, 0x48, 0x3,
+    0xc0, 0x3f, 0xe1, 0x50, 0x24, 0x0, 0xff, 0xa4,
+    0x1, 0x60, 0x1f, 0xf9, 0x80, 0xc, 0x1, 0xff,
+    0x30, 0x83, 0x80, 0x7f, 0xeb, 0x0, 0x48, 0x7,
+    0xfc, 0x84, 0xa, 0x20, 0x1f, 0xf7, 0x80, 0x24,
+    0x3, 0xfe, 0x24, 0x3, 0x30, 0x7, 0xfd, 0x60,
+    0x9, 0x0, 0xff, 0x85, 0x80, 0x54, 0x3, 0xe0,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x5a, 0xdf, 0xfd, 0xa6, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x2, 0xef, 0xfd, 0x75, 0x57, 0xdf, 0xff, 0x20,
-    0xa, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xa0,
-    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0,
-    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
-    0xa, 0xff, 0x50, 0x0, 0x0, 0x5, 0xff, 0xa0,
-    0x1, 0xef, 0xfa, 0x42, 0x25, 0xaf, 0xfe, 0x10,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0xb, 0xff, 0xc5, 0x20, 0x2, 0x6d, 0xff, 0xb0,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
-    0x4f, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xdf, 0xf5,
-    0xa, 0xff, 0xfa, 0x64, 0x56, 0xaf, 0xff, 0xb0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x2, 0x7c, 0xef, 0xfe, 0xc7, 0x20, 0x0,
+    0x0, 0xcb, 0x5b, 0xfe, 0xda, 0x60, 0xf, 0x1e,
+    0xd2, 0x90, 0x0, 0x96, 0x74, 0xc0, 0x22, 0xd2,
+    0x2, 0x8a, 0xa4, 0x10, 0x16, 0x10, 0x2, 0x4,
+    0x1f, 0x5d, 0x54, 0xfa, 0xe0, 0x8, 0x0, 0x20,
+    0xc, 0x0, 0x7a, 0x8, 0x14, 0x0, 0x20, 0xa0,
+    0x1f, 0x9c, 0x3, 0x8, 0x30, 0x7, 0xe6, 0x0,
+    0xc8, 0x4, 0xa0, 0x1e, 0x53, 0x5, 0x0, 0x58,
+    0x85, 0x51, 0x8, 0x8b, 0x54, 0x1, 0xb0, 0x0,
+    0xe1, 0x82, 0xde, 0xea, 0x94, 0xf, 0x4, 0x2,
+    0xa3, 0x0, 0xfc, 0x74, 0x1, 0x5b, 0x81, 0xd6,
+    0xff, 0xb6, 0x48, 0x1e, 0xc1, 0x50, 0x13, 0x14,
+    0x80, 0x4, 0xda, 0xa0, 0x8b, 0xe0, 0x9, 0x0,
+    0xfd, 0x0, 0xf, 0x10, 0x1, 0x0, 0x7e, 0x20,
+    0x3, 0x10, 0x1, 0x0, 0x3f, 0x20, 0x1, 0xb4,
+    0x1, 0x24, 0x1, 0xe2, 0x90, 0x7, 0xa2, 0x81,
+    0x6d, 0x32, 0x2b, 0x56, 0x90, 0x22, 0x85, 0x30,
+    0x1, 0x66, 0xea, 0x54, 0x0, 0xd6, 0x1, 0x4e,
+    0xc1, 0x88, 0x0, 0x4e, 0x36, 0x40, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x5b, 0xef, 0xed, 0x93, 0x0, 0x0,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x1, 0xdf, 0xfc, 0x64, 0x58, 0xdf, 0xfa, 0x0,
-    0x9, 0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0x60,
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
-    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
-    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xa, 0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0xfd,
-    0x2, 0xff, 0xfd, 0x75, 0x58, 0xdf, 0xee, 0xfe,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xfe, 0x3e, 0xfe,
-    0x0, 0x0, 0x7c, 0xef, 0xeb, 0x60, 0xf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
-    0x0, 0x11, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x10,
-    0x0, 0x8f, 0xa8, 0x67, 0xae, 0xff, 0xf3, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x39, 0xcf, 0xff, 0xd9, 0x40, 0x0, 0x0,
+    0x0, 0xcb, 0x7d, 0xfd, 0xb2, 0x60, 0x1e, 0x2c,
+    0xa4, 0x10, 0x12, 0x6c, 0x90, 0xc, 0x3e, 0x60,
+    0x73, 0x74, 0xe4, 0xd, 0x40, 0x14, 0x10, 0x3e,
+    0x32, 0x2c, 0x6a, 0x82, 0xb0, 0x1, 0x80, 0xa0,
+    0x3, 0xd4, 0x21, 0x0, 0x40, 0x5, 0x0, 0xfc,
+    0xe0, 0x2a, 0x1, 0xff, 0xc3, 0xc2, 0x0, 0x28,
+    0x7, 0xe7, 0x0, 0x28, 0x28, 0x14, 0x0, 0x7a,
+    0x84, 0x0, 0x21, 0x0, 0x7, 0xd7, 0x55, 0x46,
+    0xa8, 0x88, 0xc, 0xb, 0x4, 0xa, 0x2a, 0x8e,
+    0x43, 0xa0, 0x1c, 0x7d, 0x6, 0x20, 0x29, 0x3c,
+    0x62, 0x6, 0x1, 0x9f, 0x3b, 0xfa, 0xd8, 0x8,
+    0x0, 0xe0, 0x1f, 0xf9, 0x0, 0x1a, 0x1, 0xff,
+    0xa8, 0x0, 0xc0, 0x1f, 0xf3, 0x98, 0x28, 0x80,
+    0x4, 0x40, 0x1e, 0x88, 0x0, 0xd8, 0x5, 0x3d,
+    0x50, 0xcf, 0x5c, 0xe0, 0xd, 0x10, 0x9, 0xc1,
+    0x5e, 0x61, 0x44, 0xf, 0x4c, 0x3, 0x63, 0x18,
+    0x4, 0x4d, 0x78, 0x40, 0x10,
 
     /* U+003A ":" */
-    0x2d, 0xe6, 0xa, 0xff, 0xf0, 0x9f, 0xfe, 0x1,
-    0xac, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xac, 0x40, 0x9f, 0xfe,
-    0xa, 0xff, 0xf0, 0x2d, 0xe6, 0x0,
+    0x2d, 0xe6, 0x8, 0x21, 0x90, 0x30, 0x0, 0x84,
+    0x29, 0xd0, 0xd, 0x62, 0x0, 0x7f, 0xf4, 0xc6,
+    0xb1, 0x2, 0x14, 0xe8, 0xc, 0x0, 0x21, 0x4,
+    0x32, 0x0,
 
     /* U+003B ";" */
-    0x2d, 0xe6, 0xa, 0xff, 0xf0, 0x9f, 0xfe, 0x1,
-    0xac, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xab, 0x40, 0x8f, 0xfe,
-    0x9, 0xff, 0xf0, 0x2d, 0xfc, 0x0, 0xaf, 0x60,
-    0xe, 0xf1, 0x2, 0xfc, 0x0, 0x6f, 0x60, 0x0,
+    0x2d, 0xe6, 0x8, 0x21, 0x90, 0x30, 0x0, 0x84,
+    0x29, 0xd0, 0xd, 0x62, 0x0, 0x7f, 0xf4, 0xc6,
+    0xad, 0x2, 0x55, 0x28, 0x4, 0x0, 0x21, 0x64,
+    0x6, 0x4, 0xe1, 0x40, 0x4, 0x7, 0x2, 0x13,
+    0x10, 0x40, 0xa0, 0x0,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x96, 0x0,
-    0x0, 0x0, 0x0, 0x16, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x3a, 0xff, 0xff, 0xb2, 0x0, 0x1, 0x7d,
-    0xff, 0xfd, 0x71, 0x0, 0x4, 0xaf, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x2f, 0xff, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x16, 0xdf, 0xff, 0xd7, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0x9f, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x39, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1,
+    0x0, 0xff, 0x8e, 0x58, 0x3, 0xf0, 0xb6, 0xe3,
+    0x0, 0x7c, 0x75, 0xd2, 0x40, 0x88, 0x0, 0x85,
+    0xf7, 0x14, 0xa, 0x3a, 0xc8, 0x12, 0xba, 0x8,
+    0x17, 0x35, 0xc4, 0x0, 0x56, 0xa0, 0x73, 0xf4,
+    0x60, 0x1f, 0x86, 0x9c, 0x3, 0xf1, 0x28, 0xc,
+    0xf5, 0x20, 0x7, 0xd5, 0xd2, 0x40, 0xb7, 0xae,
+    0x20, 0x1c, 0x2d, 0xb8, 0xc0, 0x51, 0xd6, 0xa0,
+    0x1e, 0x39, 0xf9, 0x30, 0x4a, 0x60, 0xf, 0xcd,
+    0x98, 0x60, 0xf, 0xfc, 0x73, 0xee,
 
     /* U+003D "=" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x31, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x2f, 0xff, 0xfc, 0xc0, 0x1f, 0xfc, 0x22, 0xcc,
+    0xff, 0xce, 0x6, 0x7f, 0xf8, 0x40, 0x3f, 0xfa,
+    0x26, 0x7f, 0xf8, 0x4b, 0x33, 0xff, 0x38, 0x7,
+    0xff, 0x8,
 
     /* U+003E ">" */
-    0x1b, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x9, 0xef,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
-    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x2, 0x8e,
-    0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
-    0xf6, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xc3,
-    0x0, 0x0, 0x5c, 0xff, 0xfe, 0x82, 0x0, 0x3,
-    0x9f, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x1f, 0xff,
-    0xe8, 0x20, 0x0, 0x0, 0x0, 0x2f, 0xb5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x1b, 0x50, 0xf, 0xf8, 0xd2, 0xba, 0x8, 0x3,
+    0xf1, 0x30, 0x89, 0xf7, 0x14, 0x3, 0xe9, 0xea,
+    0x40, 0x3a, 0xe9, 0x20, 0xf, 0x2d, 0xeb, 0x88,
+    0x9b, 0x71, 0x80, 0x3c, 0x51, 0xd6, 0xa0, 0x72,
+    0xc0, 0x1f, 0x93, 0x90, 0x3, 0xf8, 0xa3, 0xad,
+    0x0, 0xd4, 0x3, 0x2e, 0x6b, 0x88, 0x9f, 0x70,
+    0xc0, 0xe7, 0xe8, 0xc1, 0x2b, 0xa0, 0x80, 0x3,
+    0x8c, 0x2, 0xfb, 0x6a, 0x1, 0xc6, 0x9, 0x5d,
+    0x4, 0x1, 0xf1, 0x75, 0xa8, 0x7, 0xf8,
 
     /* U+003F "?" */
-    0x0, 0x4, 0x9d, 0xef, 0xfc, 0x92, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3e,
-    0xff, 0xe9, 0x76, 0x8d, 0xff, 0xf6, 0x4, 0xef,
-    0x70, 0x0, 0x0, 0x7, 0xff, 0xe0, 0x1, 0x50,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xaa, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xed, 0x10, 0x0, 0x0,
+    0x0, 0x92, 0x77, 0xbf, 0xd9, 0x24, 0x1, 0x8a,
+    0xec, 0xc4, 0x20, 0x3, 0x6d, 0x80, 0x1, 0xe2,
+    0x0, 0xb4, 0x4b, 0x90, 0x1, 0xd8, 0x1c, 0x1,
+    0x1d, 0x2e, 0xd1, 0xb0, 0x0, 0x80, 0x4f, 0xa7,
+    0x0, 0xf3, 0x90, 0x8, 0x80, 0x54, 0x3, 0xf3,
+    0x0, 0x7f, 0xf0, 0x94, 0x4, 0x40, 0x1f, 0xe8,
+    0x10, 0x60, 0xf, 0xf4, 0x38, 0x1c, 0x0, 0x7f,
+    0x4b, 0x81, 0xe0, 0x7, 0xf4, 0x30, 0x26, 0x0,
+    0x7f, 0x13, 0x81, 0x58, 0x7, 0xf9, 0x40, 0x16,
+    0x1, 0xff, 0x12, 0xa9, 0x0, 0x3f, 0xe5, 0xaa,
+    0x10, 0x7, 0xff, 0x38, 0x61, 0x80, 0x3f, 0xf6,
+    0x3c, 0xb0, 0x7, 0xfc, 0x40, 0xe, 0x0, 0xff,
+    0xa4, 0x4a, 0x40, 0x38,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbd, 0xff, 0xfe,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xc5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xd7,
-    0x20, 0x0, 0x0, 0x26, 0xcf, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x1d, 0xfe, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4d, 0xfd, 0x10, 0x0, 0x0, 0x1d,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xfd, 0x10, 0x0, 0xa, 0xfc, 0x0, 0x0,
-    0x18, 0xdf, 0xfd, 0x81, 0xf, 0xf8, 0xb, 0xfa,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xe4, 0xff, 0x80, 0x1e, 0xf3, 0x0, 0xbf,
-    0x80, 0x0, 0x4f, 0xff, 0x83, 0x35, 0xbf, 0xff,
-    0xf8, 0x0, 0x6f, 0xb0, 0x1f, 0xf1, 0x0, 0xe,
-    0xfe, 0x20, 0x0, 0x0, 0x6f, 0xff, 0x80, 0x0,
-    0xef, 0x15, 0xfc, 0x0, 0x5, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xaf, 0xf8, 0x0, 0xa, 0xf4, 0x8f,
-    0x80, 0x0, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x80, 0x0, 0x7f, 0x79, 0xf7, 0x0, 0xd,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf8, 0x0,
-    0x5, 0xf8, 0xaf, 0x60, 0x0, 0xef, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x80, 0x0, 0x4f, 0x99,
-    0xf7, 0x0, 0xd, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf8, 0x0, 0x5, 0xf8, 0x7f, 0x90, 0x0,
-    0xaf, 0xd0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x80,
-    0x0, 0x7f, 0x75, 0xfc, 0x0, 0x5, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xaf, 0xf8, 0x0, 0xa, 0xf4,
-    0x1f, 0xf1, 0x0, 0xe, 0xfe, 0x20, 0x0, 0x0,
-    0x6f, 0xff, 0x90, 0x1, 0xff, 0x0, 0xbf, 0x80,
-    0x0, 0x4f, 0xff, 0x83, 0x24, 0xaf, 0xfc, 0xff,
-    0x53, 0xcf, 0x80, 0x3, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xe4, 0x4f, 0xff, 0xff, 0xc0,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0x18, 0xcf, 0xfd,
-    0x81, 0x0, 0x5d, 0xfe, 0x80, 0x0, 0x0, 0xd,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xfe, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xd7, 0x30, 0x0,
-    0x0, 0x37, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xcf, 0xff, 0xfe, 0xee, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x37, 0xbe, 0xff, 0xfd, 0xa6, 0x10, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xfc, 0x4f, 0x7b, 0xff, 0x75, 0xc1, 0x80,
+    0x7f, 0xf0, 0x93, 0x36, 0x10, 0x84, 0x84, 0x48,
+    0xf9, 0x85, 0x0, 0xff, 0xaa, 0xcc, 0xa3, 0x7f,
+    0xb7, 0xbf, 0x64, 0xcd, 0x56, 0x20, 0x1f, 0xe,
+    0xa8, 0xd6, 0xb9, 0x0, 0x71, 0x36, 0x59, 0x26,
+    0x8, 0x7, 0xe, 0x11, 0xfa, 0x80, 0x7f, 0xc9,
+    0xaa, 0x58, 0x20, 0x1a, 0xc8, 0xf0, 0x40, 0x3,
+    0x1b, 0xfe, 0xd8, 0x10, 0xff, 0x45, 0x21, 0x58,
+    0x4, 0x6a, 0x1c, 0x1, 0x27, 0x39, 0x0, 0x9,
+    0xfd, 0x0, 0x35, 0xa, 0x98, 0x2, 0x1, 0xc8,
+    0x0, 0x96, 0x0, 0x7c, 0xc5, 0x20, 0xd8, 0x6,
+    0x18, 0x8, 0x1, 0x40, 0x90, 0xa, 0x80, 0x76,
+    0xc, 0xcb, 0x72, 0x1, 0xe6, 0x14, 0x14, 0x3,
+    0x10, 0x2, 0x88, 0x51, 0x0, 0x73, 0x28, 0x7,
+    0x90, 0x17, 0x41, 0x0, 0x2f, 0x2, 0x40, 0xf,
+    0xa4, 0x3, 0xda, 0x6, 0x21, 0xe0, 0x13, 0x83,
+    0x80, 0x7e, 0x30, 0xf, 0x10, 0x79, 0x80, 0x80,
+    0x46, 0x6, 0x1, 0xfc, 0x20, 0x1c, 0x20, 0x26,
+    0x2, 0x1, 0x18, 0x18, 0x7, 0xf0, 0x80, 0x70,
+    0x80, 0xf0, 0x70, 0x4, 0xe0, 0xe0, 0x1f, 0x8c,
+    0x3, 0xc4, 0x1e, 0x40, 0xa0, 0x17, 0x81, 0x20,
+    0x7, 0xd2, 0x1, 0xed, 0x3, 0x40, 0x31, 0x0,
+    0x28, 0x85, 0x10, 0x7, 0x32, 0x80, 0x4, 0x0,
+    0x2a, 0x8, 0x28, 0x12, 0x1, 0x50, 0xe, 0xc1,
+    0x92, 0x54, 0x81, 0x83, 0x29, 0xe8, 0x38, 0x2,
+    0x1, 0xc8, 0x0, 0x96, 0x0, 0x7c, 0xdb, 0x51,
+    0xb8, 0x0, 0x56, 0x19, 0xa0, 0x0, 0x6a, 0x1c,
+    0x1, 0x27, 0x39, 0x80, 0x9, 0xfd, 0x11, 0x44,
+    0x2, 0xf8, 0x1, 0xa8, 0x8f, 0x4, 0x0, 0x31,
+    0x9f, 0xed, 0x81, 0x0, 0x2e, 0xff, 0x40, 0x7,
+    0xb0, 0x8f, 0xd4, 0x3, 0xff, 0x94, 0x38, 0xa3,
+    0x5a, 0xe6, 0x1, 0xc6, 0xf8, 0x1, 0xff, 0x86,
+    0xac, 0xca, 0x33, 0xfb, 0xaf, 0xc8, 0x34, 0x0,
+    0xff, 0xe0, 0xa6, 0x62, 0x10, 0x47, 0x12, 0xcf,
+    0x20, 0x7, 0xc0,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
-    0x33, 0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xd0, 0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf4,
+    0x0, 0xfe, 0x6f, 0xf6, 0x80, 0x7f, 0xf1, 0xac,
+    0x0, 0x48, 0x1, 0xff, 0xc4, 0x42, 0x0, 0xbc,
+    0x3, 0xff, 0x89, 0xe0, 0x2c, 0x8, 0x40, 0x1f,
+    0xfc, 0x22, 0x40, 0x68, 0x0, 0x40, 0x7, 0xff,
+    0xa, 0xc0, 0x12, 0x2a, 0xa, 0x20, 0x1f, 0xf8,
+    0x58, 0x14, 0x42, 0x40, 0x12, 0x1, 0xff, 0x98,
+    0x1, 0x20, 0x3, 0x30, 0x30, 0x7, 0xfe, 0x90,
+    0x23, 0x0, 0xa8, 0x5, 0x80, 0x3f, 0xcc, 0x21,
+    0x60, 0x19, 0x84, 0x2c, 0x3, 0xfd, 0x60, 0x2c,
+    0x1, 0xcc, 0x4, 0x80, 0x1f, 0x90, 0x81, 0x80,
+    0x3d, 0x20, 0xf, 0x0, 0xfd, 0xe0, 0xd, 0x33,
+    0xf1, 0x18, 0x21, 0x80, 0x78, 0x90, 0x1, 0x59,
+    0x9f, 0x18, 0x2, 0x40, 0x3d, 0x60, 0x1f, 0xfc,
+    0x25, 0x10, 0xc, 0x2c, 0x7, 0xff, 0xfe, 0xa0,
+    0x4, 0x80, 0x66, 0x0, 0x48, 0x7, 0xf9, 0x44,
+    0x18, 0x3, 0x48, 0xa, 0x80, 0x7f, 0xcc, 0x2,
+    0xc0, 0x5, 0x10, 0x60, 0xf, 0xfd, 0x20, 0xb,
+    0x0, 0x48, 0x2, 0x40, 0x3f, 0xf0, 0xa8, 0x12,
+    0x0,
 
     /* U+0042 "B" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x1f, 0xfc, 0x44, 0x44, 0x44, 0x69,
-    0xff, 0xfd, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0x60, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xa0, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x14, 0xbf, 0xfb,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0x0, 0x1f, 0xfc, 0x44, 0x44, 0x44,
-    0x45, 0x8e, 0xff, 0xa0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xf4, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf7, 0x1f, 0xfc, 0x44, 0x44, 0x44, 0x45, 0x8e,
-    0xff, 0xe1, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x20, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xda, 0x50, 0x0,
+    0x1f, 0xff, 0xf6, 0xd2, 0x80, 0x7f, 0xf0, 0xc9,
+    0x6b, 0x48, 0x3, 0x8e, 0xef, 0xd2, 0xc0, 0x2,
+    0xf0, 0xe, 0x74, 0x4f, 0x34, 0xf1, 0x81, 0x30,
+    0x7, 0xff, 0x4, 0x7c, 0x1, 0x80, 0x1f, 0xfc,
+    0x22, 0x0, 0x8, 0x7, 0xff, 0x8, 0xc0, 0x4,
+    0x1, 0xff, 0xc2, 0xb0, 0x6, 0x80, 0x7f, 0xc2,
+    0x96, 0xc0, 0x88, 0x0, 0xc9, 0xff, 0xee, 0xb4,
+    0x5, 0xb0, 0xf, 0xfe, 0x22, 0x38, 0x7, 0x1d,
+    0xdf, 0xd4, 0xe2, 0x28, 0xa0, 0xc, 0xe8, 0x9f,
+    0x2c, 0x71, 0x82, 0xa0, 0x7, 0xff, 0xb, 0xc0,
+    0x1a, 0x1, 0xff, 0xc2, 0x30, 0x2, 0x80, 0x7f,
+    0xf0, 0x8c, 0x0, 0xe0, 0x1f, 0xfc, 0x28, 0x0,
+    0x60, 0x4, 0xe8, 0x9f, 0x2c, 0x72, 0x0, 0xb0,
+    0x4, 0x77, 0x7f, 0x53, 0x88, 0x16, 0x8, 0x7,
+    0xfe, 0x25, 0xad, 0x20,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
-    0x89, 0xbf, 0xff, 0xf8, 0x0, 0x5, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x6, 0xef, 0xb0, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0x90, 0x0,
-    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x29, 0x0,
-    0x0, 0x5f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6e,
-    0xfb, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0xa8, 0x8a,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xed, 0xa5, 0x0, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xf6, 0xd2, 0x80, 0x7e,
+    0x2b, 0xc7, 0x31, 0x1, 0x25, 0xae, 0x50, 0xe,
+    0x5d, 0x40, 0x1, 0x2b, 0xb2, 0x0, 0x6, 0xa0,
+    0x2, 0x5a, 0x0, 0x26, 0x6d, 0x44, 0xdf, 0xc8,
+    0x81, 0x80, 0x6, 0x80, 0xf, 0x66, 0x1, 0xe6,
+    0xc6, 0xb0, 0x5, 0x80, 0x16, 0x0, 0x3f, 0x8a,
+    0x40, 0x2, 0xa0, 0xa, 0x0, 0xff, 0xe1, 0x20,
+    0x1, 0x80, 0x3f, 0xf8, 0x7a, 0x0, 0xc0, 0xf,
+    0xfe, 0x19, 0x0, 0x18, 0x3, 0xff, 0xac, 0x40,
+    0x6, 0x0, 0xff, 0xe1, 0xe8, 0x3, 0x0, 0x3f,
+    0xf8, 0x68, 0x0, 0x60, 0xf, 0xfe, 0x18, 0xa8,
+    0x2, 0x80, 0x3f, 0xf8, 0x76, 0x0, 0x58, 0x0,
+    0xfe, 0x29, 0x0, 0x86, 0x80, 0xf, 0x66, 0x1,
+    0xe6, 0xc6, 0xb0, 0x9, 0x68, 0x0, 0x99, 0xb5,
+    0x10, 0xaf, 0x91, 0x3, 0x0, 0xcb, 0xa6, 0x0,
+    0x25, 0x77, 0x28, 0x0, 0x6a, 0x0, 0x38, 0xb3,
+    0xe, 0x62, 0x2, 0x4b, 0x5c, 0xa0, 0x0,
 
     /* U+0044 "D" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x1f, 0xfd, 0x77, 0x77,
-    0x77, 0x9c, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xf8, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x40, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xc0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf7, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf3, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xc0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
-    0xf8, 0x0, 0x1f, 0xfd, 0x77, 0x77, 0x77, 0x9c,
-    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xee, 0xc9, 0x40, 0xf, 0xfe, 0x20,
+    0x9b, 0x5e, 0xa0, 0x7, 0xc5, 0x11, 0xe6, 0x30,
+    0x1, 0x5c, 0x0, 0x79, 0x9d, 0xfd, 0x39, 0xac,
+    0x0, 0x78, 0x0, 0xff, 0xe1, 0x14, 0xd0, 0x1,
+    0xd0, 0x3, 0xff, 0x86, 0xb2, 0x0, 0x80, 0xf,
+    0xfe, 0x23, 0x10, 0x19, 0x80, 0x3f, 0xf8, 0x96,
+    0x0, 0x40, 0xf, 0xfe, 0x22, 0x80, 0x34, 0x3,
+    0xff, 0x88, 0x40, 0x6, 0x0, 0xff, 0xe3, 0xb8,
+    0x7, 0xff, 0x10, 0x80, 0x2, 0x1, 0xff, 0xc4,
+    0x50, 0x6, 0x80, 0x7f, 0xf1, 0x2c, 0x0, 0x80,
+    0x1f, 0xfc, 0x36, 0x20, 0x33, 0x0, 0x7f, 0xf0,
+    0x92, 0x40, 0x10, 0x1, 0xff, 0xc1, 0x19, 0xb0,
+    0x3, 0xa0, 0x6, 0x67, 0x7f, 0x4e, 0x73, 0x0,
+    0x1e, 0x0, 0x38, 0xa2, 0x3c, 0xc6, 0x0, 0x2b,
+    0x80, 0xf, 0xfe, 0x8, 0x9b, 0x5e, 0xa0, 0x6,
 
     /* U+0045 "E" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x1f, 0xff, 0xfe, 0xe, 0x0, 0x7f, 0xf2, 0xa,
+    0x23, 0xfd, 0x20, 0x19, 0x9d, 0xff, 0xca, 0x1,
+    0xff, 0xff, 0x0, 0xfe, 0x4f, 0xff, 0xe9, 0x0,
+    0xff, 0xe4, 0x94, 0xcf, 0xf5, 0x0, 0x73, 0x37,
+    0xf8, 0xc0, 0x3f, 0xff, 0x2c, 0xef, 0xff, 0x8,
+    0x4, 0x51, 0x1f, 0xf1, 0x80, 0x7f, 0xf1, 0x0,
 
     /* U+0046 "F" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
-    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x51, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd6, 0x66, 0x66,
-    0x66, 0x66, 0x30, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xfe, 0xe, 0x0, 0x7f, 0xf1, 0x8a,
+    0x23, 0xfd, 0x20, 0x13, 0x3b, 0xff, 0x94, 0x3,
+    0xff, 0xfe, 0x1, 0x33, 0x7f, 0x8c, 0x3, 0x14,
+    0xcf, 0xf5, 0x0, 0x7f, 0xf1, 0xd3, 0xff, 0xfa,
+    0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x30,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x61,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
-    0x88, 0xae, 0xff, 0xfb, 0x0, 0x4, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x4, 0xdf, 0xd1, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x0,
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0xaf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x38, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x31, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x4f, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0x30, 0x0, 0x5f, 0xff, 0xfd, 0xa8, 0x89,
-    0xdf, 0xff, 0xe1, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xef, 0xfd, 0xa6, 0x10, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xfb, 0x69, 0x84, 0x3,
+    0xe2, 0xbc, 0x73, 0x10, 0x1, 0x2c, 0xf3, 0x80,
+    0x72, 0xea, 0x0, 0x9, 0x5d, 0xca, 0x20, 0x8,
+    0xb0, 0x9, 0x28, 0x0, 0x79, 0xb5, 0x10, 0xae,
+    0xb2, 0x6, 0x10, 0x1b, 0x0, 0x3e, 0x18, 0x7,
+    0x93, 0x5f, 0x4, 0x20, 0x0, 0xb0, 0x1, 0xfe,
+    0x81, 0x1, 0x60, 0x5, 0x0, 0x7f, 0xf0, 0x90,
+    0x0, 0xc0, 0x1f, 0xfc, 0x3d, 0x0, 0x60, 0x7,
+    0xff, 0xc, 0x80, 0xc, 0x1, 0xff, 0x84, 0x40,
+    0x1f, 0xfc, 0x47, 0xee, 0x19, 0x0, 0x18, 0x3,
+    0xff, 0x87, 0xa0, 0xc, 0x0, 0xff, 0xe1, 0xa0,
+    0x1, 0x80, 0x3f, 0xf8, 0x62, 0xc0, 0xa, 0x0,
+    0xff, 0xe1, 0xc0, 0x1, 0x60, 0x3, 0xff, 0x84,
+    0x36, 0x0, 0x7c, 0x30, 0xf, 0x1d, 0x80, 0x72,
+    0x50, 0x0, 0xf3, 0x6a, 0x21, 0x3b, 0x86, 0x2,
+    0x40, 0x12, 0xea, 0x0, 0x9, 0x5d, 0xcc, 0x40,
+    0x6, 0xf1, 0x0, 0xc5, 0x78, 0xe6, 0x20, 0x2,
+    0x59, 0xe9, 0x10,
 
     /* U+0048 "H" */
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x1f, 0xfd, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x7f, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xfc,
+    0x1f, 0xf5, 0x80, 0x7f, 0xdf, 0xec, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0x13, 0xff, 0xfe, 0x0,
+    0xff, 0xe6, 0x14, 0x47, 0xfc, 0x1, 0xe6, 0x77,
+    0xff, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0xa0,
 
     /* U+0049 "I" */
-    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
-    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
-    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
-    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
-    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+    0x1f, 0xf5, 0x80, 0x7f, 0xff, 0xc0,
 
     /* U+004A "J" */
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x17, 0x77,
-    0x77, 0x78, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x80, 0x6, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0xa, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0x11, 0xdf,
-    0xfd, 0x86, 0x8e, 0xff, 0xa0, 0x2, 0xcf, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x5b, 0xef, 0xeb,
-    0x60, 0x0,
+    0x0, 0x27, 0xff, 0xf4, 0x80, 0x7f, 0xf0, 0xd6,
+    0x23, 0xce, 0x1, 0xc2, 0xef, 0xeb, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xfd, 0xdc, 0x0, 0x20, 0x6,
+    0x0, 0xf6, 0x0, 0x38, 0x2a, 0x60, 0x3, 0xb,
+    0x80, 0x1c, 0x5c, 0x1f, 0x61, 0xa3, 0xc0, 0xa,
+    0x22, 0xf3, 0x2, 0x79, 0x71, 0x3, 0xa0, 0x1,
+    0x65, 0x20, 0x80, 0xa4, 0xe0, 0x0,
 
     /* U+004B "K" */
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xe2, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2,
-    0xef, 0xf3, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xf4, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x1, 0xdf, 0xf5, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x1, 0xdf, 0xf6, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0xcf, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0xbf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0xbf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x20, 0x8f, 0xfe,
-    0x10, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x20, 0x0,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x20,
-    0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xe2, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xd0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0,
+    0x1f, 0xf5, 0x80, 0x7f, 0x17, 0x7f, 0x10, 0x7,
+    0xff, 0x4, 0xb0, 0x43, 0x48, 0x3, 0xff, 0xe,
+    0x8, 0x59, 0x80, 0x7f, 0xe1, 0xc1, 0xa, 0x40,
+    0xf, 0xfc, 0x38, 0x41, 0x2a, 0x1, 0xff, 0xc1,
+    0xd2, 0x8, 0x60, 0xf, 0xfe, 0xe, 0x18, 0x3b,
+    0x80, 0x3f, 0xf8, 0x36, 0x60, 0xd0, 0x1, 0xff,
+    0xc1, 0xb4, 0x5, 0x90, 0xf, 0xfe, 0xd, 0x20,
+    0x0, 0xc0, 0x3f, 0xf8, 0x32, 0xa0, 0x13, 0x30,
+    0x3, 0xfe, 0x46, 0x1, 0x70, 0x4, 0x98, 0x7,
+    0xfe, 0x1c, 0x87, 0x0, 0x68, 0x80, 0x7f, 0x87,
+    0x8, 0x21, 0x0, 0x74, 0x3, 0xf8, 0x70, 0x80,
+    0x2b, 0x30, 0x3a, 0x0, 0xfc, 0xa4, 0x1, 0xda,
+    0x20, 0xae, 0x1, 0xff, 0xc2, 0x1d, 0x0, 0x42,
+    0x0, 0x7f, 0xf0, 0x8e, 0xc0, 0x14, 0x40, 0x1f,
+    0xfc, 0x24, 0x80, 0x1f, 0x0, 0xff, 0xe1, 0xbb,
+    0x1, 0x58, 0x0,
 
     /* U+004C "L" */
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xd7, 0x77, 0x77, 0x77, 0x77, 0x72, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x1f, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x8b, 0x3b,
+    0xff, 0x88, 0x2, 0x28, 0x8f, 0xf3, 0x80, 0x7f,
+    0xf0, 0xc0,
 
     /* U+004D "M" */
-    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xfc, 0x1f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x1f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfc, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xfc, 0x1f, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0x1f,
-    0xfe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfc, 0x1f, 0xfa, 0xcf, 0xe1, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x7e, 0xfc, 0x1f, 0xfa, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xe, 0xfc,
-    0x1f, 0xfa, 0x9, 0xff, 0x20, 0x0, 0x0, 0x6f,
-    0xf4, 0xe, 0xfc, 0x1f, 0xfa, 0x1, 0xff, 0xc0,
-    0x0, 0x0, 0xef, 0xb0, 0xe, 0xfc, 0x1f, 0xfa,
-    0x0, 0x7f, 0xf5, 0x0, 0x8, 0xff, 0x20, 0xe,
-    0xfc, 0x1f, 0xfa, 0x0, 0xd, 0xfe, 0x0, 0x2f,
-    0xf8, 0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x4,
-    0xff, 0x70, 0xbf, 0xe0, 0x0, 0xe, 0xfc, 0x1f,
-    0xfa, 0x0, 0x0, 0xaf, 0xf6, 0xff, 0x60, 0x0,
-    0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x2f, 0xff,
-    0xfc, 0x0, 0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0,
-    0x0, 0x8, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xfc,
-    0x1f, 0xfa, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0,
-    0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x0,
-    0x49, 0x10, 0x0, 0x0, 0xe, 0xfc, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfc,
+    0x1f, 0xf4, 0x0, 0x7f, 0xf0, 0xf3, 0xf0, 0x2,
+    0x72, 0x0, 0xff, 0xe0, 0xb1, 0x80, 0x7a, 0x0,
+    0x3f, 0xf8, 0x30, 0x1, 0xf2, 0xa0, 0x7, 0xfd,
+    0x2, 0x1, 0xfa, 0x40, 0x3f, 0xc4, 0xe0, 0x1f,
+    0x8, 0x13, 0x0, 0x7f, 0x40, 0x7, 0xe4, 0x30,
+    0x81, 0x0, 0xf9, 0x14, 0x20, 0x40, 0x3d, 0xe0,
+    0x30, 0x1, 0xf4, 0x81, 0x38, 0x7, 0xc6, 0xc0,
+    0xc4, 0x1, 0xcc, 0x41, 0x20, 0x1f, 0xd0, 0x0,
+    0xe0, 0xe, 0x80, 0x44, 0x0, 0x7f, 0xc, 0x1,
+    0xa8, 0x5, 0x2, 0x12, 0x1, 0xff, 0x39, 0x5,
+    0x80, 0x9, 0xc1, 0xc8, 0x3, 0xff, 0x48, 0xb,
+    0x84, 0x80, 0xc0, 0x7, 0xff, 0x5, 0x14, 0x21,
+    0x90, 0x20, 0x3, 0xff, 0x87, 0x0, 0x9, 0x3,
+    0x60, 0xf, 0xfe, 0x19, 0x38, 0x5, 0xe0, 0x1f,
+    0xfc, 0x58, 0x10, 0x53, 0x0, 0xff, 0xe3, 0x53,
+    0x58, 0x7, 0xff, 0x1d, 0x24, 0x40, 0x3f, 0xfa,
+    0x60,
 
     /* U+004E "N" */
-    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x1f, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0xf, 0xfc, 0x1f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfc, 0xdf,
-    0xf9, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
-    0x2f, 0xff, 0x50, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfb, 0x5, 0xff, 0xf2, 0x0, 0x0, 0xf, 0xfc,
-    0x1f, 0xfb, 0x0, 0x9f, 0xfd, 0x10, 0x0, 0xf,
-    0xfc, 0x1f, 0xfb, 0x0, 0xc, 0xff, 0xb0, 0x0,
-    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x1, 0xef, 0xf8,
-    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
-    0x6, 0xff, 0xf2, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0xf, 0xfc, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xaf, 0xfc, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xfc,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfc,
+    0x1f, 0xf5, 0x0, 0x7f, 0xdf, 0xec, 0x0, 0x95,
+    0x80, 0x3f, 0xf8, 0xb2, 0x60, 0x1f, 0xfc, 0x5d,
+    0x10, 0xf, 0xfe, 0x20, 0xe8, 0x7, 0xff, 0x8,
+    0xc8, 0xe, 0x40, 0x3f, 0xf8, 0x2f, 0xe0, 0x6,
+    0x50, 0xf, 0xfe, 0x9, 0x50, 0x2, 0x88, 0x3,
+    0xff, 0x82, 0xac, 0x0, 0xf1, 0x0, 0xff, 0xe0,
+    0xc9, 0x81, 0x50, 0x7, 0xff, 0xb, 0x44, 0x12,
+    0x0, 0x3f, 0xf8, 0x23, 0xa0, 0x7, 0x40, 0xf,
+    0xfe, 0x9, 0xc8, 0x2, 0xc8, 0x3, 0xff, 0x82,
+    0xca, 0x0, 0xf0, 0xf, 0xfe, 0x15, 0x18, 0x15,
+    0x0, 0x7f, 0xf0, 0xb8, 0x41, 0x40, 0x3f, 0xf8,
+    0x45, 0x40, 0x1f, 0xfc, 0x54, 0x80, 0xf, 0xfe,
+    0x2b, 0xa8, 0x7, 0xff, 0x16, 0x88, 0x0,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10,
-    0x0, 0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
-    0x89, 0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda,
-    0x60, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xfb, 0x69, 0x80, 0x3f,
+    0xe2, 0xbc, 0x73, 0x10, 0x1, 0x2c, 0xf3, 0x80,
+    0x7e, 0x5d, 0x40, 0x1, 0x2b, 0xb2, 0x0, 0x6,
+    0x2c, 0x40, 0x39, 0x28, 0x0, 0x99, 0xb5, 0x13,
+    0x7f, 0x20, 0x4, 0xd0, 0xc, 0x34, 0x0, 0x7b,
+    0x30, 0xf, 0x36, 0x90, 0x1c, 0x80, 0x50, 0x20,
+    0xb0, 0x1, 0xfc, 0x5e, 0x0, 0x62, 0x1, 0x60,
+    0x5, 0x0, 0x7f, 0xc5, 0x0, 0xb, 0x4, 0x0,
+    0x30, 0x7, 0xff, 0x5, 0x80, 0x8, 0x1a, 0x0,
+    0xc0, 0xf, 0xfe, 0x8, 0x90, 0x10, 0x10, 0x1,
+    0x80, 0x3f, 0xf8, 0x4c, 0x0, 0x20, 0xf, 0xfe,
+    0x51, 0x0, 0x18, 0x3, 0xff, 0x84, 0xc0, 0x2,
+    0xd0, 0x6, 0x0, 0x7f, 0xf0, 0x44, 0x80, 0x81,
+    0x0, 0xc, 0x1, 0xff, 0xc1, 0x60, 0x2, 0x0,
+    0xb0, 0x2, 0x80, 0x3f, 0xe2, 0x80, 0x5, 0x80,
+    0x20, 0x41, 0x60, 0x3, 0xf8, 0xbc, 0x0, 0xc4,
+    0x0, 0x1a, 0x0, 0x3d, 0x98, 0x7, 0x9b, 0x48,
+    0xe, 0x40, 0x32, 0x50, 0x1, 0x33, 0x6a, 0x26,
+    0xfe, 0x40, 0x7, 0xa0, 0x1e, 0x5d, 0x40, 0x1,
+    0x2b, 0xb2, 0x0, 0x51, 0x82, 0x1, 0xf1, 0x5e,
+    0x39, 0x88, 0x0, 0x96, 0x7d, 0xc0, 0x38,
 
     /* U+0050 "P" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x1f, 0xfd, 0x77, 0x77, 0x78, 0xaf, 0xff,
-    0xf3, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xd0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x51, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf9, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb1, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xfb, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x91, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf5, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfd, 0x1, 0xff, 0xd7,
-    0x77, 0x77, 0x7a, 0xff, 0xff, 0x30, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x1f, 0xff, 0xed, 0xa5, 0x0, 0xff, 0xe1, 0x12,
+    0xd6, 0x98, 0x7, 0x14, 0x47, 0x3a, 0x80, 0xb,
+    0xc, 0x3, 0x33, 0xbf, 0x45, 0x7a, 0x80, 0x38,
+    0x3, 0xff, 0x83, 0x48, 0x4, 0xa0, 0x1f, 0xfc,
+    0x1f, 0x0, 0x60, 0x7, 0xff, 0x5, 0x40, 0x4,
+    0x1, 0xff, 0xd2, 0x50, 0x1, 0x0, 0x7f, 0xf0,
+    0x7c, 0x1, 0x80, 0x1f, 0xfa, 0x50, 0x9, 0x40,
+    0x26, 0x77, 0xf5, 0x7b, 0x0, 0x38, 0x3, 0x14,
+    0x47, 0x94, 0x0, 0x58, 0x60, 0x1f, 0xf1, 0x2d,
+    0x69, 0x80, 0x72, 0x7f, 0xfb, 0x69, 0x40, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfc, 0x20,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x28, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf8,
-    0x0, 0x0, 0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf2, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80,
-    0x5, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfd, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x9,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x20, 0xaf, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x8, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xd0, 0x1, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x0, 0x2f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x90, 0x0,
-    0x0, 0x5f, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x5e,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xfc,
-    0x87, 0x79, 0xef, 0xff, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0x0,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xa5, 0x46, 0xdf, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xce, 0xfd, 0x81, 0x0,
+    0x0, 0xf1, 0x46, 0x77, 0xfb, 0x69, 0x80, 0x3f,
+    0xf1, 0x5e, 0xb9, 0x88, 0x0, 0x96, 0x79, 0xc0,
+    0x3f, 0x93, 0x50, 0x0, 0x4a, 0xec, 0x80, 0x1,
+    0x8b, 0x10, 0xf, 0x25, 0x80, 0xf, 0x36, 0xa2,
+    0x6f, 0xe0, 0x0, 0x9a, 0x1, 0xc3, 0x40, 0x7,
+    0xc3, 0x0, 0xf3, 0xe9, 0x1, 0xc0, 0x6, 0x81,
+    0x5, 0x80, 0xf, 0xe2, 0xf0, 0x3, 0x90, 0x4,
+    0xc0, 0xa, 0x0, 0xff, 0x89, 0xc0, 0x14, 0x0,
+    0x50, 0x3, 0x0, 0x7f, 0xf0, 0x64, 0x0, 0xa0,
+    0xd, 0x0, 0x60, 0x7, 0xff, 0x4, 0x48, 0x8,
+    0x0, 0x20, 0x6, 0x0, 0xff, 0xe1, 0x30, 0x0,
+    0x80, 0xc0, 0x3f, 0xf8, 0xa2, 0x0, 0x30, 0x20,
+    0x3, 0x0, 0x7f, 0xf0, 0x98, 0x0, 0x21, 0xa0,
+    0xd, 0x0, 0xff, 0xe0, 0x89, 0x81, 0x0, 0x10,
+    0x0, 0xc0, 0x1f, 0xfc, 0x16, 0x0, 0x28, 0x0,
+    0x54, 0x6, 0x40, 0x3f, 0xe2, 0x80, 0x5, 0x0,
+    0x50, 0x0, 0x67, 0x0, 0xfe, 0x1f, 0x0, 0x31,
+    0x0, 0x45, 0x40, 0x8, 0xa2, 0x0, 0xf2, 0xf9,
+    0x1, 0xc8, 0x7, 0x2c, 0x80, 0x17, 0x72, 0x1d,
+    0xd3, 0xd4, 0x20, 0x7a, 0x1, 0xf3, 0x61, 0x0,
+    0xd, 0xe2, 0xc, 0x20, 0x8, 0xc1, 0x0, 0xfc,
+    0x7b, 0x4a, 0x40, 0x18, 0xa7, 0x9c, 0x3, 0xff,
+    0x2d, 0x6f, 0xc0, 0x0, 0x88, 0x20, 0x1a, 0x4c,
+    0x3, 0xfe, 0x79, 0x0, 0x5d, 0x2a, 0x36, 0xb7,
+    0x0, 0x7f, 0xe6, 0xb1, 0x5, 0xab, 0x92, 0x9,
+    0x0, 0xff, 0xe0, 0xa7, 0x49, 0x88, 0x13, 0xf2,
+    0x0,
 
     /* U+0052 "R" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x1f, 0xfd, 0x77, 0x77, 0x78, 0xaf,
-    0xff, 0xf3, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x50, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x90, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0x50, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x0, 0x1f, 0xfd, 0x66, 0x66, 0x67,
-    0x9e, 0xff, 0xf3, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x30, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xa0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf5, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xfe, 0x10, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xb0,
+    0x1f, 0xff, 0xed, 0xa5, 0x0, 0xff, 0xe1, 0x92,
+    0xd6, 0x98, 0x7, 0x8a, 0x23, 0x9d, 0x40, 0x5,
+    0x86, 0x1, 0xcc, 0xef, 0xd1, 0x5e, 0xa0, 0xe,
+    0x0, 0xff, 0xe1, 0x52, 0x1, 0x28, 0x7, 0xff,
+    0xb, 0xc0, 0x18, 0x1, 0xff, 0xc2, 0x50, 0x1,
+    0x0, 0x7f, 0xf5, 0x14, 0x0, 0x40, 0x1f, 0xfc,
+    0x2f, 0x0, 0x60, 0x7, 0xff, 0x6, 0x50, 0x5,
+    0x40, 0x33, 0x37, 0x9e, 0x79, 0x80, 0x1a, 0x1,
+    0xc5, 0x33, 0xd0, 0xc2, 0x5, 0x86, 0x1, 0xff,
+    0xc2, 0x4d, 0x30, 0xf, 0x27, 0xff, 0x8c, 0x10,
+    0xc0, 0x3f, 0xf8, 0x5c, 0x0, 0xd0, 0xf, 0xfe,
+    0x11, 0x48, 0xd, 0x0, 0x7f, 0xf0, 0x99, 0x1,
+    0x54, 0x1, 0xff, 0xc2, 0xa1, 0xb, 0x10, 0xf,
+    0xfe, 0x8, 0xd0, 0xd, 0x0,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x6b, 0xdf, 0xfe, 0xc8, 0x30, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x4, 0xff, 0xfc, 0x86, 0x67, 0xbf, 0xff, 0x10,
-    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x69, 0x0,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xa6, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x5e, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
-    0x0, 0x0, 0x6b, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x8c, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1,
-    0x5f, 0xb4, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
-    0xaf, 0xff, 0xe9, 0x76, 0x68, 0xdf, 0xff, 0x30,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x5, 0x9d, 0xef, 0xed, 0xa5, 0x0, 0x0,
+    0x0, 0xcd, 0x7b, 0xfe, 0xec, 0x83, 0x0, 0xe5,
+    0xe9, 0x42, 0x0, 0x9, 0xbe, 0x60, 0x80, 0x9,
+    0x42, 0x6, 0xf3, 0x28, 0x40, 0x1, 0x98, 0x1,
+    0x20, 0xa, 0xc8, 0x66, 0x3d, 0xfc, 0xb0, 0x81,
+    0x90, 0x32, 0x80, 0x7c, 0xd2, 0x0, 0x60, 0x7,
+    0x80, 0x7f, 0xe6, 0x0, 0x60, 0x7, 0xfe, 0x31,
+    0x5, 0x80, 0xf, 0xfd, 0x0, 0x7, 0xfa, 0x62,
+    0x0, 0xfc, 0xd4, 0x20, 0x5, 0x9d, 0xd4, 0xa0,
+    0x7, 0x97, 0xa5, 0x0, 0x22, 0x6b, 0xd3, 0x0,
+    0xf3, 0x5f, 0xdb, 0x98, 0x0, 0xb0, 0xc0, 0x3f,
+    0x24, 0x66, 0xa0, 0x3, 0x80, 0x3f, 0xe2, 0xb3,
+    0x2, 0x10, 0xf, 0xfc, 0x80, 0x2, 0x5, 0x0,
+    0xff, 0x10, 0x0, 0x96, 0xad, 0x0, 0x3e, 0x65,
+    0x4, 0x1f, 0x4, 0xbe, 0x97, 0x66, 0x46, 0xc8,
+    0x2, 0x2, 0xa0, 0x40, 0x5a, 0x26, 0x4e, 0x40,
+    0x58, 0x60, 0x7, 0xea, 0x62, 0x10, 0x12, 0x5a,
+    0xd3, 0x0,
 
     /* U+0054 "T" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x67, 0x77, 0x77, 0x8f, 0xfc, 0x77, 0x77,
-    0x77, 0x20, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0,
+    0xef, 0xff, 0xfe, 0x1a, 0x80, 0x7f, 0xf1, 0x62,
+    0x3c, 0xe0, 0x3, 0x88, 0xf3, 0xb3, 0xbf, 0x50,
+    0x1, 0x5d, 0xfc, 0x40, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xc6,
 
     /* U+0055 "U" */
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x2f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf4, 0xf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0xc, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x7,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x90,
-    0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x20, 0x0, 0x4f, 0xff, 0xea, 0x88, 0xae, 0xff,
-    0xf5, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff,
-    0xeb, 0x60, 0x0, 0x0,
+    0x3f, 0xf4, 0x80, 0x7f, 0x9b, 0xfc, 0xa0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x90,
+    0x40, 0x6, 0x1, 0xfe, 0x10, 0x0, 0x90, 0x1,
+    0xc0, 0x3f, 0xda, 0x0, 0x60, 0x30, 0x22, 0x0,
+    0x7f, 0x20, 0x9, 0x5, 0x80, 0x20, 0x3, 0xf3,
+    0x88, 0x38, 0x1, 0xc4, 0x16, 0x40, 0x3c, 0xf0,
+    0x0, 0xb0, 0xa, 0x80, 0xd, 0xd5, 0x10, 0xae,
+    0x80, 0x5, 0x10, 0x4, 0x98, 0x20, 0x2a, 0xee,
+    0x51, 0x1, 0xb5, 0x0, 0xe3, 0xe9, 0x51, 0x0,
+    0xa, 0x4f, 0x20, 0x4,
 
     /* U+0056 "V" */
-    0xd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xc0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0xef, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
-    0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x70, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0xaf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0x20, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xfa,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf1, 0x0, 0x0, 0xe, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x6,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
-    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf5, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0xa, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x32, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xfa, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0,
-    0x0, 0x0,
+    0xd, 0xff, 0x18, 0x7, 0xfe, 0x1f, 0xf6, 0x5,
+    0x80, 0x24, 0x3, 0xff, 0x30, 0x2, 0x41, 0x84,
+    0x14, 0x40, 0x3f, 0xe9, 0x1, 0x50, 0x3, 0x0,
+    0x24, 0x3, 0xfc, 0xa2, 0x12, 0x1, 0x48, 0x1,
+    0x80, 0x3f, 0xd2, 0x0, 0x60, 0x8, 0x54, 0x5,
+    0x40, 0x3f, 0x19, 0x81, 0x84, 0x3, 0x48, 0x2,
+    0x40, 0x3f, 0x48, 0x2, 0xc0, 0x38, 0xcc, 0x6,
+    0x60, 0xf, 0xa, 0x82, 0x10, 0x7, 0xa4, 0x1,
+    0x20, 0x1e, 0x90, 0x7, 0x0, 0x7c, 0xa2, 0xa,
+    0x20, 0x1c, 0xc0, 0x4a, 0x1, 0xf9, 0x80, 0x12,
+    0x1, 0x98, 0x42, 0x80, 0x3f, 0xa4, 0x0, 0xc0,
+    0x1a, 0xc0, 0xc, 0x1, 0xfc, 0x2a, 0x2, 0xa0,
+    0x4, 0x20, 0x61, 0x0, 0xff, 0x48, 0x2, 0x40,
+    0x1c, 0x0, 0xb0, 0xf, 0xf8, 0xcc, 0x6, 0x62,
+    0x50, 0x42, 0x0, 0xff, 0xd2, 0x0, 0x9a, 0x0,
+    0x78, 0x7, 0xff, 0x5, 0x44, 0x15, 0xc0, 0x90,
+    0x3, 0xff, 0x85, 0x20, 0x1a, 0x80, 0x3f, 0xf8,
+    0x6c, 0x1, 0x98, 0x3, 0xff, 0x86, 0x2c, 0x0,
+    0x61, 0x0, 0xf8,
 
     /* U+0057 "W" */
-    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x4,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0xf,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0xaf,
-    0xf3, 0x0, 0x0, 0x0, 0xe, 0xfb, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x4, 0xff,
-    0x90, 0x0, 0x0, 0x4, 0xff, 0x4b, 0xff, 0x0,
-    0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x9f, 0xf0, 0x6f, 0xf5, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0xe, 0xfa, 0x1, 0xff, 0xa0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x5, 0xff, 0x80,
-    0x0, 0x4, 0xff, 0x40, 0xb, 0xff, 0x0, 0x0,
-    0xd, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0xaf, 0xe0, 0x0, 0x6f, 0xf4, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0,
-    0xf, 0xfa, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x8f,
-    0xf2, 0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x4,
-    0xff, 0x40, 0x0, 0xb, 0xff, 0x0, 0xd, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0, 0xaf,
-    0xe0, 0x0, 0x0, 0x5f, 0xf4, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0xf, 0xf9,
-    0x0, 0x0, 0x0, 0xff, 0x90, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x85, 0xff, 0x40,
-    0x0, 0x0, 0xb, 0xfe, 0xd, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xfd, 0xaf, 0xe0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0xe, 0xfe, 0x0, 0xff, 0x4f, 0xf9, 0x40, 0x3f,
+    0x8f, 0xfc, 0xe0, 0xe0, 0x28, 0x1, 0xfc, 0xe0,
+    0xf, 0x0, 0xfe, 0xb0, 0x2, 0x86, 0x80, 0x34,
+    0x3, 0xf2, 0x8, 0x1, 0x40, 0x3f, 0x94, 0xc,
+    0x81, 0x0, 0xe, 0x1, 0xfb, 0x40, 0x32, 0x80,
+    0x7c, 0x64, 0x16, 0x1, 0x28, 0x9, 0x80, 0x7c,
+    0xe0, 0x80, 0xf, 0x0, 0xfa, 0xc0, 0xa, 0x1,
+    0x70, 0x2, 0x80, 0x3c, 0x82, 0x1e, 0x80, 0xa0,
+    0x1f, 0x28, 0x11, 0x0, 0x24, 0x0, 0x38, 0x7,
+    0xb4, 0x0, 0x9a, 0x0, 0x50, 0xe, 0x22, 0x5,
+    0x0, 0x72, 0x80, 0x98, 0x7, 0x38, 0x28, 0x38,
+    0x3, 0xc0, 0x3a, 0x80, 0xa, 0x1, 0xde, 0x0,
+    0xb0, 0xc, 0x82, 0x1c, 0x2, 0x80, 0xa0, 0x1c,
+    0xa0, 0x44, 0x0, 0xe5, 0x0, 0x30, 0x6, 0xe0,
+    0x14, 0x0, 0x68, 0x1, 0x0, 0x22, 0x20, 0x28,
+    0x7, 0xca, 0x2, 0x60, 0x12, 0x82, 0x0, 0x4e,
+    0x0, 0xe0, 0xa, 0x80, 0x14, 0x1, 0xf7, 0x80,
+    0x2c, 0x0, 0x80, 0xe, 0x0, 0x85, 0x1, 0x40,
+    0x25, 0x2, 0x20, 0x7, 0xca, 0x0, 0x50, 0x7,
+    0x0, 0xa0, 0x6, 0xe0, 0x2, 0x1, 0x10, 0x14,
+    0x3, 0xf9, 0x40, 0x88, 0xa, 0xe, 0x1, 0xca,
+    0x0, 0xd0, 0x50, 0x5, 0x80, 0x7f, 0x78, 0x2,
+    0x94, 0x1, 0xa0, 0x1e, 0x40, 0x70, 0xa0, 0x23,
+    0x0, 0xfe, 0x50, 0x2, 0xf8, 0xa, 0x0, 0x7b,
+    0x80, 0x5c, 0x81, 0x40, 0x3f, 0xe4, 0x2, 0x50,
+    0x70, 0xf, 0x94, 0x1, 0x0, 0xb, 0x0, 0xff,
+    0xb8, 0x3, 0x68, 0x7, 0xe4, 0x0, 0x84, 0xc0,
+    0x3f, 0xe4, 0x0, 0x85, 0x0, 0x3f, 0x70, 0x4,
+    0xe0, 0x1f, 0xf8, 0x50, 0x0, 0xe0, 0x1f, 0xca,
+    0x1, 0x50, 0x7, 0x80,
 
     /* U+0058 "X" */
-    0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf9, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x2f, 0xfd, 0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0x30, 0x0, 0x0, 0xbf, 0xf7,
-    0x0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x1,
-    0xef, 0xf3, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xd0, 0x1, 0xef, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0xaf, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xd2, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf2,
-    0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf7, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x1e, 0xff, 0x40, 0x0,
-    0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x3f, 0xfe,
-    0x10, 0x0, 0xd, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x8f, 0xfa, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf6, 0x4, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2,
+    0xc, 0xff, 0x28, 0x7, 0xf3, 0x7f, 0xa4, 0x1,
+    0xc0, 0xa, 0x20, 0xf, 0x8a, 0x40, 0xa4, 0x0,
+    0x52, 0x0, 0xe0, 0xf, 0xbc, 0x1, 0xc0, 0x19,
+    0x90, 0xd, 0xc0, 0x3a, 0x8, 0x20, 0xc0, 0x3a,
+    0x84, 0x20, 0xc0, 0x24, 0x70, 0x47, 0x0, 0xf0,
+    0xd0, 0x3, 0x80, 0x3, 0x40, 0x34, 0x1, 0xf9,
+    0x18, 0xa, 0x82, 0xc4, 0x2c, 0x40, 0x3f, 0xa4,
+    0x81, 0x69, 0x41, 0x94, 0x3, 0xfe, 0xf0, 0x2,
+    0x81, 0x48, 0x7, 0xfe, 0x28, 0x0, 0xa4, 0x3,
+    0xff, 0x85, 0x60, 0x17, 0x0, 0x7f, 0xf0, 0x60,
+    0xc0, 0x25, 0x60, 0xf, 0xf9, 0x1c, 0xb, 0x40,
+    0x12, 0x40, 0x1f, 0xc3, 0x40, 0xf, 0x29, 0x0,
+    0x70, 0x7, 0xf5, 0x88, 0x41, 0x3, 0x28, 0x1c,
+    0x0, 0x7c, 0xca, 0x8, 0xe0, 0x15, 0x88, 0x3a,
+    0x0, 0x71, 0x48, 0xd, 0x0, 0x61, 0xd0, 0x5,
+    0x8, 0x6, 0xf0, 0x5, 0x88, 0x7, 0x1b, 0x80,
+    0xd8, 0x5, 0x24, 0xa, 0xa0, 0xf, 0xa0, 0xc1,
+    0x58, 0x11, 0x80, 0xa8, 0x3, 0xfb, 0x80, 0x12,
+    0x40,
 
     /* U+0059 "Y" */
-    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xe0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x9f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x1e,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
-    0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
-    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x50, 0x1, 0xef, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xe0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x18, 0x7, 0xfd, 0xbf, 0xc0, 0xf,
+    0x0, 0x78, 0x7, 0xf9, 0xc8, 0x2c, 0x0, 0x6c,
+    0x6, 0xc0, 0x1f, 0x86, 0x1, 0x14, 0x2, 0x81,
+    0x8, 0x0, 0xfd, 0x60, 0x9, 0x0, 0xc3, 0x0,
+    0x32, 0x1, 0xe3, 0x50, 0x72, 0x0, 0xe6, 0x20,
+    0x62, 0x0, 0xee, 0x1, 0x80, 0xf, 0xb8, 0x1,
+    0x20, 0x19, 0x88, 0x2c, 0x3, 0xf1, 0xa8, 0x22,
+    0x80, 0x6, 0x0, 0xd4, 0x3, 0xfa, 0xc0, 0x16,
+    0x0, 0x81, 0xe, 0x0, 0xff, 0xc, 0x0, 0xc1,
+    0xb0, 0x31, 0x0, 0x7f, 0xce, 0x40, 0xfc, 0x3,
+    0x20, 0x1f, 0xfc, 0x1e, 0x0, 0x10, 0x40, 0x7,
+    0xff, 0x8, 0xd4, 0x0, 0x6c, 0x1, 0xff, 0xc3,
+    0xf0, 0x5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfd,
+    0x20,
 
     /* U+005A "Z" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x47, 0x77, 0x77, 0x77, 0x77, 0x77, 0xdf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf8, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x74, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9,
+    0x9f, 0xff, 0xfe, 0x19, 0x80, 0x7f, 0xf1, 0x76,
+    0x23, 0xfe, 0x20, 0x2, 0x1a, 0x3b, 0xff, 0x8c,
+    0x80, 0x68, 0x3, 0xfe, 0x2b, 0x0, 0x68, 0x80,
+    0x7f, 0xde, 0x0, 0x93, 0x0, 0xff, 0xa8, 0x81,
+    0x98, 0x1, 0xff, 0x3a, 0x81, 0xc8, 0x7, 0xfc,
+    0x90, 0x3, 0xc0, 0x1f, 0xf0, 0xd0, 0x2, 0x88,
+    0x3, 0xfe, 0xd1, 0x8, 0x40, 0xf, 0xfa, 0x4c,
+    0x11, 0xc0, 0x3f, 0xe6, 0x60, 0x15, 0x80, 0x7f,
+    0xc7, 0x20, 0xf, 0x0, 0xff, 0x87, 0x40, 0x14,
+    0x40, 0x1f, 0xf5, 0x8, 0x32, 0x80, 0x7f, 0xd0,
+    0x80, 0x72, 0x1, 0xff, 0x2b, 0x80, 0x11, 0xdf,
+    0xfe, 0x49, 0x0, 0x9e, 0x23, 0xfe, 0xd0, 0xf,
+    0xfe, 0x28,
 
     /* U+005B "[" */
-    0x1f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xfc, 0x1f,
-    0xfb, 0x33, 0x21, 0xff, 0xa0, 0x0, 0x1f, 0xfa,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x1f, 0xfa, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x1f, 0xfa, 0x0, 0x1,
-    0xff, 0xa0, 0x0, 0x1f, 0xfa, 0x0, 0x1, 0xff,
-    0xa0, 0x0, 0x1f, 0xfa, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x1f, 0xfa, 0x0, 0x1, 0xff, 0xa0, 0x0,
-    0x1f, 0xfa, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x1f,
-    0xfa, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x1f, 0xfa,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x1f, 0xfa, 0x0,
-    0x1, 0xff, 0xb3, 0x32, 0x1f, 0xff, 0xff, 0xc1,
-    0xff, 0xff, 0xfc,
+    0x1f, 0xfe, 0xc0, 0xf, 0xf2, 0x66, 0x38, 0x2,
+    0x13, 0x31, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfe,
+    0x22, 0x66, 0x20, 0x9, 0x33, 0x1c, 0x1, 0xf0,
 
     /* U+005C "\\" */
-    0x7, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x60,
+    0x7, 0x83, 0x0, 0xff, 0x63, 0xc0, 0x7, 0xfb,
+    0x81, 0x4, 0x3, 0xf9, 0x40, 0xe, 0x1, 0xfe,
+    0x50, 0xa0, 0xf, 0xf7, 0x81, 0x88, 0x7, 0xf2,
+    0x80, 0x18, 0x3, 0xfc, 0xa1, 0x40, 0x1f, 0xee,
+    0x2, 0x20, 0x7, 0xf2, 0x8, 0x50, 0x7, 0xf9,
+    0xc1, 0x40, 0x3f, 0xd4, 0x4, 0x60, 0x1f, 0xc6,
+    0x21, 0x60, 0x1f, 0xe6, 0x6, 0x0, 0xff, 0x50,
+    0xa, 0x0, 0x7f, 0x11, 0x3, 0x40, 0x3f, 0xd4,
+    0xe, 0x1, 0xfe, 0x50, 0x14, 0x0, 0xfe, 0x23,
+    0xe, 0x0, 0xff, 0x58, 0x28, 0x7, 0xf9, 0x80,
+    0xa, 0x1, 0xfc, 0x28, 0x1c, 0x1, 0xfe, 0xd0,
+    0x41, 0x0, 0xfe, 0x70, 0x3, 0x80, 0x7f, 0xa,
+    0x6, 0x80, 0x7f, 0xb8, 0x10, 0x40, 0x3f, 0x94,
+    0x0, 0xe0,
 
     /* U+005D "]" */
-    0x7f, 0xff, 0xff, 0x67, 0xff, 0xff, 0xf6, 0x13,
-    0x37, 0xff, 0x60, 0x0, 0x4f, 0xf6, 0x0, 0x4,
-    0xff, 0x60, 0x0, 0x4f, 0xf6, 0x0, 0x4, 0xff,
-    0x60, 0x0, 0x4f, 0xf6, 0x0, 0x4, 0xff, 0x60,
-    0x0, 0x4f, 0xf6, 0x0, 0x4, 0xff, 0x60, 0x0,
-    0x4f, 0xf6, 0x0, 0x4, 0xff, 0x60, 0x0, 0x4f,
-    0xf6, 0x0, 0x4, 0xff, 0x60, 0x0, 0x4f, 0xf6,
-    0x0, 0x4, 0xff, 0x60, 0x0, 0x4f, 0xf6, 0x0,
-    0x4, 0xff, 0x60, 0x0, 0x4f, 0xf6, 0x0, 0x4,
-    0xff, 0x60, 0x0, 0x4f, 0xf6, 0x0, 0x4, 0xff,
-    0x61, 0x33, 0x7f, 0xf6, 0x7f, 0xff, 0xff, 0x67,
-    0xff, 0xff, 0xf6,
+    0x7f, 0xfe, 0x60, 0xf, 0x9b, 0x31, 0x0, 0x10,
+    0x99, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x88,
+    0x99, 0xc0, 0x13, 0x66, 0x20, 0x3, 0xfc,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x7, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xd7, 0xf9,
-    0x0, 0x0, 0x0, 0xa, 0xf6, 0x1f, 0xf0, 0x0,
-    0x0, 0x1, 0xff, 0x0, 0xaf, 0x60, 0x0, 0x0,
-    0x8f, 0x90, 0x3, 0xfd, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0xd, 0xf4, 0x0, 0x6, 0xfb, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0xff,
-    0x20, 0x4f, 0xd0, 0x0, 0x0, 0x9, 0xf9, 0xb,
-    0xf7, 0x0, 0x0, 0x0, 0x2f, 0xf0,
+    0x0, 0xe7, 0x83, 0x0, 0xfe, 0x58, 0x78, 0x0,
+    0xfe, 0x90, 0x2, 0x10, 0x7, 0xc6, 0x62, 0x80,
+    0xb0, 0xf, 0xa4, 0x2d, 0x81, 0x80, 0x3c, 0x2a,
+    0xc, 0x2a, 0xc, 0x1, 0xd2, 0xc, 0x0, 0x90,
+    0xb0, 0xe, 0x60, 0xb0, 0x1, 0x91, 0x10, 0x2,
+    0x61, 0x42, 0x0, 0xac, 0x3c, 0x2, 0xb0, 0xf0,
+    0xc, 0xc0, 0x84, 0x8, 0x44, 0x40, 0xe, 0x60,
+    0xb0, 0xf0, 0xa0, 0xf, 0x58, 0x30, 0x0,
 
     /* U+005F "_" */
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbb, 0xff, 0xe1, 0x22, 0x7f, 0xf0, 0x80,
 
     /* U+0060 "`" */
-    0x38, 0x87, 0x0, 0x0, 0x6, 0xff, 0xb0, 0x0,
-    0x0, 0x2d, 0xfc, 0x10, 0x0, 0x0, 0xaf, 0xd1,
+    0x38, 0x83, 0x80, 0x63, 0xe7, 0x8b, 0x0, 0xcd,
+    0xa4, 0x98, 0x20, 0x11, 0x6a, 0x9e, 0x8,
 
     /* U+0061 "a" */
-    0x0, 0x17, 0xbe, 0xff, 0xda, 0x40, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xfe,
-    0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3, 0x70, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef, 0xff, 0xff,
-    0xf4, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f, 0xf5, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x9f, 0xf1,
-    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f, 0xf5, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe, 0x50, 0x1,
-    0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd, 0x92, 0x3f,
-    0xf5,
+    0x0, 0xb, 0xdf, 0x7f, 0xb6, 0x90, 0x3, 0x47,
+    0x42, 0x8, 0x0, 0x96, 0xe4, 0x2, 0x50, 0x15,
+    0x9a, 0x95, 0x0, 0x33, 0x0, 0x1d, 0x1d, 0x4c,
+    0xad, 0x5a, 0x0, 0x80, 0x1, 0xb8, 0x7, 0x89,
+    0xc0, 0x48, 0x3, 0xfd, 0xc0, 0x6, 0x0, 0x14,
+    0x67, 0x73, 0xfe, 0x90, 0xc, 0xda, 0xe6, 0x22,
+    0x0, 0xf0, 0x94, 0x80, 0xd7, 0x7f, 0xe9, 0x0,
+    0x94, 0x1, 0x4a, 0x20, 0x1f, 0xb8, 0x0, 0xa0,
+    0x1e, 0xe0, 0xb, 0x80, 0x8, 0x1, 0xc4, 0xe0,
+    0x12, 0x80, 0x2d, 0x40, 0x2, 0xd8, 0x1, 0x8a,
+    0x80, 0x6b, 0xfd, 0xd2, 0x2c, 0x1, 0x97, 0x58,
+    0x40, 0x4, 0xdb, 0x40, 0x10,
 
     /* U+0062 "b" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x5, 0xbe, 0xfd, 0xb5, 0x0, 0x0,
-    0x7f, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
-    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xf5,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
-    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7f, 0xfd, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
-    0x7f, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xf2, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0,
+    0x7f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0x4b, 0x7d, 0xfb, 0x6a, 0x1, 0xf3, 0xe5, 0x20,
+    0x81, 0x25, 0x69, 0x0, 0x75, 0x18, 0x2c, 0x4b,
+    0x88, 0x16, 0x90, 0x6, 0x12, 0xda, 0x76, 0x8e,
+    0x60, 0x7, 0x80, 0x77, 0x90, 0x7, 0x4a, 0x81,
+    0x28, 0x4, 0xc4, 0x1, 0xf4, 0x0, 0x3c, 0x2,
+    0xc0, 0xf, 0xc4, 0x20, 0xc0, 0x13, 0x0, 0x7f,
+    0x18, 0x10, 0x4, 0xc0, 0x1f, 0xc6, 0x4, 0x1,
+    0x60, 0x7, 0xe3, 0x10, 0x60, 0x9, 0x88, 0x3,
+    0xe8, 0x0, 0x78, 0x6, 0xf2, 0x0, 0xe9, 0x40,
+    0x25, 0x0, 0x88, 0x9b, 0x4e, 0xd1, 0xcc, 0x0,
+    0xf0, 0xd, 0xc6, 0xb, 0x12, 0xe2, 0x5, 0xa4,
+    0x1, 0x87, 0x29, 0x4, 0x5, 0x2b, 0x48, 0x0,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1,
-    0xdf, 0xfe, 0x96, 0x69, 0xff, 0xf8, 0x0, 0xbf,
-    0xfa, 0x0, 0x0, 0x1, 0xcf, 0x80, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0x20, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0x20, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x1,
-    0xcf, 0x80, 0x1, 0xdf, 0xfe, 0x96, 0x69, 0xff,
-    0xf8, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0,
-    0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xd9, 0x30, 0xe, 0x1b,
+    0xc6, 0x20, 0x1, 0x36, 0x48, 0x4, 0x38, 0x80,
+    0x2d, 0x32, 0x60, 0x3, 0x40, 0x2, 0x88, 0x17,
+    0xa5, 0x99, 0x3c, 0x60, 0x11, 0xa0, 0x1d, 0x0,
+    0x70, 0xee, 0xa0, 0x2c, 0x1, 0x0, 0x1f, 0x9,
+    0x0, 0xc, 0x0, 0x80, 0x1f, 0xf3, 0x80, 0x80,
+    0x7f, 0xe7, 0x1, 0x0, 0xff, 0xc6, 0x0, 0x40,
+    0xf, 0xfa, 0x80, 0x10, 0x1, 0xf0, 0x90, 0x0,
+    0x90, 0xe, 0x80, 0x38, 0x77, 0x50, 0x0, 0xa2,
+    0x5, 0xe9, 0x66, 0x4f, 0x18, 0x6, 0x1c, 0x40,
+    0x16, 0x99, 0x30, 0x1, 0xe0, 0x2, 0x1b, 0xc6,
+    0x20, 0x1, 0x36, 0x40, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x5a, 0xdf, 0xeb, 0x60, 0x2f, 0xf8,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfd, 0x4f, 0xf8,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xef, 0xf8,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0xf8,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8,
-    0xc, 0xff, 0x80, 0x0, 0x0, 0xb, 0xff, 0xf8,
-    0x1, 0xef, 0xfc, 0x63, 0x47, 0xef, 0xef, 0xf8,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8,
-    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x70, 0xf, 0xf8,
+    0x0, 0xff, 0xc5, 0xfe, 0x80, 0xf, 0xff, 0xf8,
+    0x7, 0xf2, 0xd6, 0xff, 0x5b, 0x0, 0x7c, 0x59,
+    0x4a, 0x40, 0x29, 0x3a, 0xc0, 0x18, 0x70, 0xc0,
+    0x5a, 0x64, 0xa0, 0x54, 0x1, 0xb4, 0x41, 0x7a,
+    0x59, 0x95, 0xc6, 0x20, 0x11, 0x98, 0xe, 0x80,
+    0x38, 0x74, 0x40, 0x2a, 0x0, 0x40, 0x7, 0xc2,
+    0xc0, 0x11, 0x0, 0x10, 0x3, 0xf5, 0x80, 0x4e,
+    0x2, 0x1, 0xfc, 0x20, 0x13, 0x80, 0x80, 0x7f,
+    0x8, 0x4, 0x40, 0x3, 0x0, 0xfc, 0x80, 0x15,
+    0x0, 0x20, 0x3, 0xf5, 0x0, 0x46, 0x60, 0x48,
+    0x0, 0xf5, 0x90, 0x6, 0xd1, 0x7, 0xc6, 0x34,
+    0x7e, 0x41, 0x0, 0xc3, 0x86, 0x7, 0x39, 0x70,
+    0x22, 0xd0, 0xe, 0x2c, 0xa4, 0x20, 0x13, 0x8e,
+    0x30, 0x8,
 
     /* U+0065 "e" */
-    0x0, 0x0, 0x4b, 0xdf, 0xec, 0x61, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x1,
-    0xef, 0xfb, 0x64, 0x59, 0xff, 0xf4, 0x0, 0xbf,
-    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xe1, 0x3f, 0xf6,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x69, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xfb, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x10, 0x0, 0xbf, 0xfb, 0x10, 0x0, 0x0,
-    0x5e, 0x30, 0x1, 0xdf, 0xff, 0x96, 0x68, 0xcf,
-    0xfc, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x39, 0xde, 0xfe, 0xa5, 0x0,
-    0x0,
+    0x0, 0xc9, 0x7b, 0xfd, 0x8c, 0x20, 0x1c, 0x39,
+    0x68, 0x40, 0x27, 0x3e, 0x80, 0x10, 0xf9, 0x82,
+    0x4d, 0xd3, 0x0, 0xda, 0x0, 0x28, 0x42, 0xec,
+    0xc8, 0xb3, 0xa4, 0x14, 0x26, 0x81, 0x28, 0x1,
+    0xc5, 0xe0, 0x2f, 0x40, 0x6, 0x0, 0xf8, 0x90,
+    0x34, 0x80, 0x1f, 0xff, 0xc8, 0xc, 0xe0, 0x1f,
+    0xfc, 0x13, 0x70, 0x7, 0xff, 0xfd, 0xc6, 0x0,
+    0x40, 0xf, 0xfa, 0xc0, 0x10, 0x1, 0xf8, 0x40,
+    0x6, 0x80, 0x76, 0x20, 0x1c, 0xbe, 0x60, 0xa,
+    0x20, 0x4e, 0x96, 0x64, 0x65, 0xf, 0x80, 0x7,
+    0x10, 0x0, 0xd3, 0x27, 0x30, 0x2e, 0x0, 0x86,
+    0xf1, 0x88, 0x40, 0x56, 0xb4, 0x80,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0, 0x1d,
-    0xff, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xa4, 0x49,
-    0x30, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xf,
-    0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x23, 0x4f, 0xfb, 0x33,
-    0x33, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xc3, 0x1b, 0xfd, 0x68, 0x1, 0xe, 0x39,
+    0x0, 0xa6, 0x80, 0x50, 0x40, 0xb7, 0x66, 0xa0,
+    0x9, 0xc0, 0xa9, 0x11, 0x26, 0x1, 0x8, 0x20,
+    0x7, 0xc2, 0x1, 0xfa, 0x7f, 0x80, 0xd, 0xff,
+    0x70, 0x7, 0xfe, 0xbc, 0xb0, 0x2, 0x66, 0x5a,
+    0x4, 0x6a, 0x0, 0x13, 0x3c, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xf1, 0x80,
 
     /* U+0067 "g" */
-    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0xc, 0xfc,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x4c, 0xfc,
-    0x3, 0xff, 0xfd, 0x86, 0x68, 0xef, 0xfe, 0xfc,
-    0xd, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xfc,
-    0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
-    0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0xd, 0xff, 0x90, 0x0, 0x0, 0x9, 0xff, 0xfc,
-    0x2, 0xff, 0xfe, 0x96, 0x69, 0xef, 0xff, 0xfc,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xfb,
-    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3, 0xe6, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe0,
-    0xc, 0xff, 0xea, 0x76, 0x68, 0xcf, 0xff, 0x50,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x3, 0x8b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+    0x0, 0xcb, 0x7b, 0xfd, 0x8e, 0x21, 0x9f, 0x80,
+    0x3, 0xda, 0x42, 0x1, 0x38, 0xf4, 0x0, 0xc7,
+    0x84, 0x4, 0xf3, 0x27, 0x11, 0x59, 0x0, 0x5c,
+    0x0, 0x7d, 0x86, 0x64, 0x73, 0x80, 0x80, 0x14,
+    0x81, 0xa0, 0x3, 0xd0, 0xc0, 0x17, 0x80, 0x2c,
+    0x3, 0xf5, 0x80, 0x4c, 0x2, 0x40, 0x1f, 0x88,
+    0x40, 0x30, 0x80, 0x7f, 0x84, 0x0, 0xc0, 0x2,
+    0x0, 0xfc, 0x40, 0x17, 0x80, 0x20, 0x3, 0xf4,
+    0x0, 0x4a, 0x40, 0xb2, 0x1, 0xe9, 0x50, 0xd,
+    0xe0, 0x6, 0xe9, 0x66, 0x4f, 0x30, 0x7, 0x16,
+    0x10, 0xb, 0x4c, 0x98, 0x45, 0x60, 0x7, 0x0,
+    0x1e, 0xd2, 0x10, 0x9, 0xc7, 0xa0, 0x0, 0x40,
+    0x32, 0xde, 0xff, 0x63, 0x89, 0x0, 0xc, 0x3,
+    0xff, 0x50, 0x3, 0x0, 0xf9, 0x80, 0x3e, 0x57,
+    0x1, 0x50, 0xf1, 0x9e, 0xa7, 0x66, 0x46, 0x50,
+    0x2, 0xc0, 0x1c, 0x60, 0x2b, 0x13, 0x27, 0x30,
+    0x4, 0xa8, 0x0, 0xb3, 0xe, 0x82, 0x0, 0x14,
+    0x8e, 0x60, 0x0,
 
     /* U+0068 "h" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x6,
-    0xbe, 0xfe, 0xb5, 0x0, 0x7, 0xff, 0x5d, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff, 0xfe, 0x97,
-    0x7a, 0xff, 0xf9, 0x7, 0xff, 0xfb, 0x0, 0x0,
-    0x3, 0xff, 0xf2, 0x7f, 0xfe, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x67, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0xf8, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x97, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
+    0x7f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf8,
+    0x8d, 0x7d, 0xfd, 0x6a, 0x1, 0xe6, 0xd9, 0x41,
+    0x1, 0x4a, 0xb0, 0xe, 0xa2, 0x16, 0x88, 0x28,
+    0x1, 0x24, 0x3, 0x93, 0xa5, 0xdd, 0x58, 0x0,
+    0x62, 0x0, 0x86, 0xc0, 0x38, 0xe0, 0x0, 0x80,
+    0x14, 0x80, 0x7c, 0x80, 0xe, 0x0, 0x8c, 0x3,
+    0xe2, 0x0, 0x8, 0x4, 0xe0, 0x1f, 0xe3, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf4, 0x80,
 
     /* U+0069 "i" */
-    0x5e, 0xd3, 0xdf, 0xfa, 0xbf, 0xf7, 0x6, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3,
+    0x5e, 0xd3, 0x81, 0x29, 0x60, 0x6, 0xdc, 0xd3,
+    0x83, 0x28, 0x7, 0x3f, 0xf8, 0xc0, 0x3f, 0xfd,
+    0x80,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x3, 0xee, 0x40, 0x0, 0x0, 0xbf,
-    0xfc, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0, 0x0,
-    0x6, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60,
-    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5, 0xff,
-    0x60, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0,
-    0x5, 0xff, 0x60, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x5f, 0xf6,
-    0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x5f,
-    0xf6, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0,
-    0x5f, 0xf6, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
-    0x0, 0x5f, 0xf5, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0xb6, 0x58, 0xff, 0xe0, 0x5f, 0xff, 0xff, 0xf4,
-    0x2, 0xad, 0xfe, 0xb3, 0x0,
+    0x0, 0xe3, 0xee, 0x20, 0x7, 0x40, 0x8a, 0x0,
+    0x38, 0x80, 0xa, 0x1, 0xd3, 0x38, 0x3, 0xcc,
+    0xc0, 0xf, 0xfe, 0x1a, 0xff, 0x98, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xef, 0x30, 0xe, 0xc0, 0x3,
+    0x5, 0xb2, 0xc3, 0x0, 0x9a, 0xa4, 0xd3, 0x80,
+    0x28, 0x1d, 0x48, 0x5, 0x31, 0x0,
 
     /* U+006B "k" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x20,
-    0x7f, 0xf3, 0x0, 0x0, 0x5, 0xff, 0xe2, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0,
-    0x7f, 0xf3, 0x0, 0x7, 0xff, 0xe2, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x8f, 0xfe, 0x20, 0x0, 0x0,
-    0x7f, 0xf3, 0x9, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x7f, 0xfe, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xfc, 0x5f, 0xff, 0x20, 0x0, 0x0,
-    0x7f, 0xff, 0xb0, 0x8, 0xff, 0xd0, 0x0, 0x0,
-    0x7f, 0xfa, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x10,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0,
+    0x7f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0xe9, 0xfe, 0xe2, 0x0, 0xff, 0x2d, 0x80, 0xe1,
+    0x0, 0x7f, 0x35, 0x0, 0xe1, 0x0, 0x7f, 0x3c,
+    0x80, 0xe1, 0x0, 0x7f, 0x44, 0x0, 0x70, 0x80,
+    0x3f, 0xa5, 0xc0, 0x70, 0x80, 0x3f, 0x3d, 0x30,
+    0x1, 0xc8, 0x3, 0xfa, 0x94, 0x2, 0x65, 0x0,
+    0xfe, 0x10, 0x3a, 0x0, 0x51, 0x0, 0x7f, 0x26,
+    0x2b, 0x80, 0x3c, 0x3, 0xf2, 0xd8, 0x2, 0x10,
+    0xa, 0x80, 0x3e, 0x90, 0xd, 0x64, 0xa, 0xe0,
+    0x1f, 0xfb, 0xc0, 0x10, 0x80, 0x1f, 0xf1, 0x50,
+    0x2, 0x84, 0x3, 0xfe, 0x57, 0x1, 0xd0,
 
     /* U+006C "l" */
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x7f, 0xf3,
+    0x7f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x38,
 
     /* U+006D "m" */
-    0x7f, 0xf2, 0x18, 0xce, 0xfd, 0x93, 0x0, 0x2,
-    0x8d, 0xff, 0xd9, 0x20, 0x0, 0x7f, 0xf5, 0xef,
-    0xff, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x7f, 0xff, 0xfc, 0x64, 0x5a, 0xff,
-    0xfa, 0xff, 0xc6, 0x45, 0xaf, 0xff, 0x30, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0,
-    0x0, 0x7, 0xff, 0xb0, 0x7f, 0xfd, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xdf,
-    0xf0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x8f, 0xf2, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f,
-    0xf3, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x8f, 0xf3,
+    0x7f, 0xf1, 0xc, 0x67, 0x7e, 0xc9, 0x80, 0x45,
+    0x1b, 0xfe, 0xd9, 0x20, 0xf, 0x3f, 0xb9, 0x88,
+    0x13, 0x63, 0x83, 0xeb, 0x90, 0x0, 0x9b, 0x58,
+    0x3, 0xa8, 0x4e, 0x6e, 0x94, 0x1, 0x15, 0x0,
+    0x73, 0x74, 0xa0, 0x9, 0x30, 0xe, 0x7c, 0x64,
+    0x5a, 0x90, 0x2, 0x83, 0xe3, 0x22, 0xd4, 0x0,
+    0x20, 0x3, 0x14, 0x0, 0x73, 0x10, 0x0, 0xe0,
+    0x3, 0x9c, 0x81, 0x0, 0x35, 0x0, 0x7c, 0x80,
+    0xb, 0x0, 0xf9, 0x0, 0x2, 0x1, 0x18, 0x7,
+    0xdc, 0x0, 0x30, 0xf, 0x84, 0x0, 0x60, 0x13,
+    0x80, 0x7f, 0x9c, 0x3, 0xfc, 0x20, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x50,
 
     /* U+006E "n" */
-    0x7f, 0xf2, 0x7, 0xce, 0xfe, 0xb5, 0x0, 0x7,
-    0xff, 0x5e, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x7f,
-    0xff, 0xfd, 0x75, 0x58, 0xef, 0xf9, 0x7, 0xff,
-    0xf9, 0x0, 0x0, 0x2, 0xef, 0xf2, 0x7f, 0xfd,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x67, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2f, 0xf8, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x97, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa7, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa7, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xa7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa0,
+    0x7f, 0xf1, 0x3, 0xe7, 0x7f, 0x5a, 0x80, 0x79,
+    0xfa, 0xc, 0x40, 0x52, 0xac, 0x3, 0xa8, 0x4a,
+    0x2a, 0x8e, 0x20, 0x92, 0x1, 0xcd, 0xae, 0xaa,
+    0x8c, 0x10, 0x62, 0x0, 0x8a, 0x40, 0x38, 0xa4,
+    0x0, 0x80, 0x15, 0x0, 0x7c, 0xa0, 0xe, 0x0,
+    0x8c, 0x3, 0xe3, 0x0, 0x8, 0x4, 0xe0, 0x1f,
+    0xe3, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xf4, 0x80,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xc9, 0x5b, 0xfd, 0xb0, 0x40, 0x1e, 0x1b,
+    0xb2, 0x90, 0x9, 0x3e, 0xc0, 0x6, 0x1f, 0x40,
+    0x16, 0x99, 0x28, 0x1, 0xec, 0x2, 0xa1, 0x5,
+    0xe9, 0x66, 0x57, 0x18, 0x23, 0x81, 0xa0, 0x1d,
+    0x0, 0x70, 0xe8, 0x84, 0x85, 0x80, 0x20, 0x3,
+    0xe1, 0x90, 0x15, 0x30, 0x2, 0x0, 0x7e, 0x40,
+    0x1, 0x38, 0x8, 0x7, 0xf0, 0x80, 0x39, 0xc0,
+    0x40, 0x3f, 0x84, 0x1, 0xc6, 0x0, 0x40, 0xf,
+    0xd6, 0x0, 0x2b, 0x0, 0x40, 0x7, 0xc2, 0xc0,
+    0x2a, 0x68, 0x7, 0x40, 0x1c, 0x3a, 0x21, 0x20,
+    0xa, 0x20, 0x5e, 0x96, 0x65, 0x71, 0x82, 0x38,
+    0x0, 0x71, 0x0, 0x5a, 0x64, 0xa0, 0x7, 0xb0,
+    0xc, 0x37, 0x65, 0x20, 0x12, 0x6d, 0x80, 0x8,
 
     /* U+0070 "p" */
-    0x7f, 0xf2, 0x6, 0xbe, 0xfd, 0xb5, 0x0, 0x0,
-    0x7f, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xfe, 0xfe, 0x84, 0x46, 0xcf, 0xff, 0x20,
-    0x7f, 0xff, 0xc1, 0x0, 0x0, 0x7, 0xff, 0xd0,
-    0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xf5,
-    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
-    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
-    0x7f, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xf3, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x3, 0x5f, 0x7e, 0xda, 0x80, 0x7c,
+    0xdb, 0x28, 0x20, 0x49, 0x5a, 0x40, 0x1d, 0x44,
+    0x2f, 0x76, 0x93, 0x2, 0xd2, 0x0, 0xc2, 0x7f,
+    0x8, 0x86, 0xc8, 0x0, 0x78, 0x6, 0x1d, 0x10,
+    0xe, 0x76, 0x2, 0x50, 0x9, 0x84, 0x3, 0xeb,
+    0x0, 0x78, 0x5, 0x80, 0x1f, 0x88, 0x41, 0x80,
+    0x27, 0x0, 0xfe, 0x30, 0x20, 0x9, 0x80, 0x3f,
+    0x8c, 0x8, 0x2, 0xc0, 0xf, 0xc6, 0x20, 0xc0,
+    0x13, 0x10, 0x7, 0xd0, 0x0, 0xf0, 0xd, 0xe4,
+    0x1, 0xd2, 0x80, 0x4a, 0x1, 0x9, 0x6d, 0x3b,
+    0x47, 0x30, 0x3, 0xc0, 0x35, 0x18, 0x2c, 0x4b,
+    0x88, 0x16, 0x90, 0x6, 0x7c, 0xa4, 0x10, 0x14,
+    0xad, 0x20, 0xf, 0x96, 0xfb, 0xfa, 0xd4, 0x3,
+    0xff, 0xf0,
 
     /* U+0071 "q" */
-    0x0, 0x0, 0x5a, 0xdf, 0xec, 0x60, 0xf, 0xf8,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfd, 0x2f, 0xf8,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xef, 0xf8,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x2c, 0xff, 0xf8,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8,
-    0xc, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0xf8,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xef, 0xf8,
-    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf8,
-    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x60, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0xcb, 0x5b, 0xfd, 0x8c, 0x0, 0xff, 0x40,
+    0x0, 0xb2, 0x94, 0x80, 0x4e, 0x74, 0x80, 0x30,
+    0xe1, 0x80, 0xb4, 0xc9, 0x40, 0xb0, 0x3, 0x68,
+    0x82, 0xf4, 0xb3, 0x2b, 0x4c, 0x40, 0x23, 0x30,
+    0x1d, 0x0, 0x71, 0x68, 0x80, 0x54, 0x0, 0x80,
+    0xf, 0x86, 0x40, 0x22, 0x0, 0x20, 0x7, 0xe4,
+    0x0, 0x9c, 0x4, 0x3, 0xf8, 0x40, 0x27, 0x1,
+    0x0, 0xfe, 0x10, 0x8, 0x80, 0x8, 0x1, 0xfa,
+    0xc0, 0x2a, 0x0, 0x40, 0x7, 0xc2, 0xc0, 0x11,
+    0x98, 0xe, 0x80, 0x38, 0x74, 0x40, 0x36, 0x88,
+    0x2f, 0x4b, 0x32, 0xb8, 0xc4, 0x3, 0xe, 0x18,
+    0xb, 0x4c, 0x94, 0xf, 0x40, 0x38, 0xb2, 0x90,
+    0x80, 0x4e, 0x70, 0x40, 0x3e, 0x5b, 0xdf, 0xec,
+    0x60, 0xf, 0xff, 0xc8,
 
     /* U+0072 "r" */
-    0x7f, 0xf2, 0x6, 0xce, 0x87, 0xff, 0x3d, 0xff,
-    0xf8, 0x7f, 0xfd, 0xff, 0xc9, 0x57, 0xff, 0xfd,
-    0x20, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x7, 0xff,
-    0x80, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x3, 0x67, 0x40, 0x4, 0x3b, 0x26,
+    0x20, 0x1b, 0x88, 0xd, 0xb4, 0x2, 0x22, 0x6e,
+    0x4a, 0x80, 0x6c, 0x20, 0xf, 0x38, 0x80, 0x7d,
+    0xa0, 0x1f, 0x98, 0x3, 0xff, 0xf0,
 
     /* U+0073 "s" */
-    0x0, 0x2, 0x9d, 0xff, 0xec, 0x83, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x5, 0xff,
-    0xe8, 0x65, 0x69, 0xef, 0x20, 0xb, 0xff, 0x20,
-    0x0, 0x0, 0x3, 0x0, 0xd, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfe, 0xb8, 0x51, 0x0,
-    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xd5, 0x0,
-    0x0, 0x0, 0x36, 0x9c, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x5, 0x70, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0xe, 0xff, 0xa7, 0x55,
-    0x7c, 0xff, 0xb0, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x10, 0x0, 0x38, 0xce, 0xff, 0xda, 0x50,
-    0x0,
+    0x0, 0x8a, 0x77, 0xfd, 0xd9, 0x6, 0x1, 0xa3,
+    0x58, 0x80, 0x2, 0x6f, 0x90, 0x0, 0x57, 0x1,
+    0x79, 0xa9, 0x61, 0xa, 0x0, 0x70, 0x3, 0x21,
+    0x95, 0xa7, 0xb0, 0x80, 0xc, 0x4, 0x40, 0xf,
+    0x18, 0x4, 0xc0, 0x4e, 0x1, 0xfe, 0x80, 0x4,
+    0x75, 0xc2, 0x88, 0x7, 0x1d, 0x90, 0xa, 0x3d,
+    0x76, 0xa8, 0x6, 0x4d, 0xc9, 0x63, 0x0, 0x15,
+    0x38, 0x7, 0x1b, 0x4e, 0x7d, 0x8, 0x40, 0x7,
+    0xf9, 0x58, 0x0, 0x40, 0xae, 0x1, 0xf1, 0x80,
+    0xc, 0x2e, 0x3e, 0x9d, 0x54, 0xf8, 0x80, 0x82,
+    0x22, 0x0, 0x2c, 0x55, 0x20, 0xc0, 0xe8, 0x7,
+    0x30, 0xe6, 0x20, 0x2, 0x5a, 0xc1, 0x0,
 
     /* U+0074 "t" */
-    0x0, 0x8, 0x85, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xfe, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x23, 0x4f, 0xfb, 0x33, 0x33, 0x0, 0x1,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xb5, 0x5a, 0x40, 0x0, 0x2e,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x19, 0xef, 0xea,
-    0x30,
+    0x0, 0xa2, 0xa, 0x1, 0xf0, 0xbb, 0xbc, 0x3,
+    0xff, 0x9f, 0x3f, 0xc0, 0x5, 0xff, 0xb8, 0x3,
+    0xff, 0x5e, 0x58, 0x1, 0x33, 0x2d, 0x2, 0x35,
+    0x0, 0x9, 0x9e, 0x0, 0xff, 0xfc, 0x88, 0x7,
+    0xff, 0x5, 0x0, 0x3f, 0x28, 0xd, 0xaa, 0xa9,
+    0x0, 0x28, 0x10, 0x4a, 0xa2, 0xf8, 0x4, 0x5e,
+    0xc2, 0x2, 0xb0,
 
     /* U+0075 "u" */
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x69,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f,
-    0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x69, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x68, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x8f, 0xf6, 0x5f, 0xf7, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0x61, 0xff, 0xe2, 0x0, 0x0, 0xa,
-    0xff, 0xf6, 0x8, 0xff, 0xe8, 0x44, 0x6d, 0xff,
-    0xff, 0x60, 0xa, 0xff, 0xff, 0xff, 0xfe, 0x5f,
-    0xf6, 0x0, 0x4, 0xae, 0xfe, 0xc7, 0x2, 0xff,
-    0x60,
+    0x9f, 0xf0, 0x80, 0x7c, 0xbf, 0xe6, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf8, 0x44, 0x0, 0x40, 0x1f,
+    0x68, 0x5, 0xa0, 0x4, 0x0, 0xf9, 0x80, 0x24,
+    0x0, 0x49, 0x0, 0x75, 0x8, 0x4, 0x2e, 0x3,
+    0x90, 0x88, 0x6d, 0x50, 0xe, 0x85, 0x1, 0x7b,
+    0xb4, 0x90, 0xd0, 0x7, 0x55, 0xa8, 0x80, 0x9c,
+    0x73, 0x80, 0x40,
 
     /* U+0076 "v" */
-    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf1, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x1f,
-    0xf9, 0x0, 0x8, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xff, 0x20, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0,
-    0xef, 0xb0, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0,
-    0x5f, 0xf4, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
-    0xc, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0,
-    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0xaf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xc0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x37, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x0, 0xfe, 0x2f, 0xf3, 0x85, 0x80,
+    0xb0, 0x7, 0xeb, 0x0, 0x30, 0x30, 0x85, 0x0,
+    0x7c, 0x2c, 0xc, 0x20, 0x6, 0x3, 0x30, 0x7,
+    0x98, 0x1, 0x60, 0x15, 0x0, 0x24, 0x3, 0xd2,
+    0x8, 0x40, 0x11, 0x28, 0x28, 0x80, 0x65, 0x10,
+    0xf0, 0xe, 0x90, 0x4, 0x80, 0x69, 0x2, 0x40,
+    0xe, 0x32, 0x6, 0x0, 0x8c, 0xc1, 0x60, 0x1f,
+    0x58, 0xa, 0x80, 0x24, 0x0, 0xc0, 0x1f, 0x30,
+    0x84, 0x80, 0xa8, 0x30, 0x7, 0xf3, 0x1, 0x99,
+    0x80, 0x16, 0x1, 0xfd, 0x20, 0x9, 0x90, 0x21,
+    0x0, 0x7f, 0xa, 0x82, 0x88, 0x78, 0x7, 0xfd,
+    0x20, 0x11, 0x20, 0x7, 0xfc, 0x66, 0x0, 0x58,
+    0x7, 0x80,
 
     /* U+0077 "w" */
-    0xaf, 0xe0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xd4, 0xff, 0x40, 0x0,
-    0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xe,
-    0xf7, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xb0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x8f, 0xf0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0xbf, 0xb0, 0x2, 0xff, 0x50, 0x0, 0x2, 0xff,
-    0x5f, 0xf6, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0xc,
-    0xfb, 0x0, 0x0, 0x8f, 0xd0, 0xbf, 0xc0, 0x0,
-    0x6, 0xfe, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0xe,
-    0xf7, 0x5, 0xff, 0x20, 0x0, 0xcf, 0x90, 0x0,
-    0x1, 0xff, 0x60, 0x4, 0xff, 0x20, 0xe, 0xf8,
-    0x0, 0x2f, 0xf3, 0x0, 0x0, 0xb, 0xfc, 0x0,
-    0xaf, 0xb0, 0x0, 0x9f, 0xe0, 0x8, 0xfd, 0x0,
-    0x0, 0x0, 0x5f, 0xf2, 0x1f, 0xf5, 0x0, 0x3,
-    0xff, 0x40, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef,
-    0x86, 0xff, 0x0, 0x0, 0xc, 0xf9, 0x4f, 0xf1,
-    0x0, 0x0, 0x0, 0x9, 0xfd, 0xcf, 0x90, 0x0,
-    0x0, 0x6f, 0xfa, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf3, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0x0, 0x0, 0x0,
+    0xaf, 0xe0, 0xf, 0xd5, 0xfc, 0x1, 0xfa, 0x7f,
+    0x78, 0x5, 0x0, 0x3c, 0x2a, 0x2, 0xa0, 0x1f,
+    0x38, 0x52, 0x8, 0x68, 0x7, 0x9c, 0x2, 0xe0,
+    0xf, 0x28, 0x83, 0x3, 0x3, 0x0, 0x7a, 0x80,
+    0x24, 0x10, 0xe, 0xe0, 0x41, 0xa, 0x0, 0x28,
+    0x6, 0x23, 0xa, 0x0, 0x38, 0x6, 0x14, 0xe,
+    0x0, 0x11, 0x87, 0x0, 0x6a, 0x2, 0x54, 0xa,
+    0x0, 0xce, 0x2, 0xa0, 0x15, 0x82, 0x8, 0x4,
+    0xc1, 0x41, 0xc0, 0x64, 0x1, 0x50, 0x38, 0x6,
+    0x60, 0x3, 0x80, 0x10, 0x41, 0x41, 0x44, 0x28,
+    0x0, 0x46, 0x14, 0x1, 0x85, 0x2, 0x80, 0x1c,
+    0x8, 0x40, 0x7, 0x6, 0x0, 0x50, 0x11, 0x80,
+    0x77, 0x1, 0x90, 0xa8, 0x70, 0x5, 0x40, 0x28,
+    0xc, 0x14, 0x1, 0xe5, 0x10, 0xa7, 0x0, 0x28,
+    0x4, 0x66, 0xd, 0x41, 0x6, 0x0, 0xf9, 0xc1,
+    0x68, 0x18, 0x3, 0xa8, 0x1b, 0x81, 0x4, 0x3,
+    0xea, 0x2, 0x30, 0xa0, 0xe, 0x70, 0x2, 0x86,
+    0x80, 0x7e, 0x32, 0x0, 0x11, 0x80, 0x70, 0xa8,
+    0x4, 0xc0, 0x1f, 0xd4, 0x0, 0xa0, 0xf, 0xb8,
+    0x0, 0xa0, 0x1c,
 
     /* U+0078 "x" */
-    0x1e, 0xfe, 0x10, 0x0, 0x0, 0x9, 0xff, 0x50,
-    0x3, 0xff, 0xc0, 0x0, 0x0, 0x5f, 0xf9, 0x0,
-    0x0, 0x6f, 0xf8, 0x0, 0x2, 0xef, 0xc0, 0x0,
-    0x0, 0xa, 0xff, 0x50, 0xc, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0xdf, 0xe2, 0x9f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xfe, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xc0, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x1d, 0xfe, 0x10, 0x9, 0xff, 0x50, 0x0,
-    0x0, 0xbf, 0xf4, 0x0, 0x0, 0xdf, 0xf2, 0x0,
-    0x7, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xfd, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0,
+    0x1e, 0xfe, 0x10, 0xf, 0x4f, 0xf9, 0x40, 0x74,
+    0x7, 0x40, 0x39, 0x58, 0x19, 0x40, 0x7, 0x20,
+    0x70, 0x1, 0x15, 0x81, 0xc8, 0x6, 0x65, 0x7,
+    0x50, 0x7, 0x8, 0x70, 0x7, 0xa8, 0x82, 0xca,
+    0x4c, 0x28, 0x80, 0x3e, 0xf0, 0x1c, 0x60, 0x75,
+    0x0, 0xfc, 0x52, 0x2, 0x7, 0x0, 0x1f, 0xe6,
+    0x10, 0x4, 0x80, 0x7f, 0xd4, 0x20, 0xb, 0x20,
+    0xf, 0xe6, 0x50, 0x50, 0x1e, 0x0, 0xfc, 0x72,
+    0x7, 0x54, 0x3, 0x90, 0xf, 0xf, 0x0, 0xe8,
+    0x2b, 0x3, 0x28, 0x7, 0x51, 0x5, 0x8, 0x2,
+    0x48, 0x28, 0x80, 0x27, 0x40, 0x74, 0x0, 0xde,
+    0x0, 0xf0, 0x1, 0xc0, 0x1c, 0x0, 0x71, 0x50,
+    0x15, 0x0,
 
     /* U+0079 "y" */
-    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x70, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xf0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x1f,
-    0xf8, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x8,
-    0xff, 0x10, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
-    0x6f, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0,
-    0xd, 0xfc, 0x0, 0x0, 0x0, 0xa, 0xff, 0x10,
-    0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0x79, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xfe, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x1, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0xeb, 0x65, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x6c, 0xff, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xd, 0xfe, 0x0, 0xfe, 0x2f, 0xf3, 0x85, 0x80,
+    0xb0, 0x7, 0xeb, 0x0, 0x38, 0x30, 0x85, 0x80,
+    0x7c, 0x2c, 0xe, 0x1, 0x48, 0x12, 0x80, 0x7a,
+    0x40, 0x12, 0x1, 0x30, 0x2, 0x40, 0x3c, 0xc0,
+    0xa2, 0x1, 0xb, 0x1, 0x98, 0x3, 0x30, 0x84,
+    0x80, 0x75, 0x80, 0x24, 0x3, 0x58, 0x19, 0x80,
+    0x38, 0x94, 0x14, 0x40, 0x8, 0x41, 0x0, 0x1f,
+    0x48, 0x2, 0x40, 0x1e, 0x4, 0x80, 0x1f, 0x19,
+    0x81, 0xc0, 0x90, 0x2c, 0x3, 0xfa, 0x0, 0xf,
+    0x60, 0x2c, 0x1, 0xfc, 0x84, 0x12, 0xc1, 0x20,
+    0x1f, 0xf5, 0x80, 0x80, 0x18, 0x3, 0xfe, 0x61,
+    0x0, 0x30, 0x80, 0x7f, 0xe7, 0x0, 0x58, 0x7,
+    0xfe, 0x16, 0x4, 0x20, 0xf, 0x84, 0x3, 0x40,
+    0x2, 0x0, 0x3f, 0x7d, 0xb2, 0xd3, 0x2, 0x98,
+    0x7, 0xcc, 0x29, 0x34, 0xa0, 0x56, 0x1, 0xf9,
+    0xa4, 0xc0, 0x5, 0x1a, 0x20, 0x1f, 0x80,
 
     /* U+007A "z" */
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x23, 0x33, 0x33,
-    0x33, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
-    0x33, 0x33, 0x33, 0x33, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80,
+    0xbf, 0xff, 0xf9, 0x40, 0x3f, 0xf0, 0xce, 0x67,
+    0xce, 0x0, 0x44, 0x11, 0x9f, 0x85, 0xc0, 0xa8,
+    0x3, 0xe1, 0xf0, 0x7, 0x8, 0x7, 0xd4, 0x41,
+    0x46, 0x1, 0xf4, 0x20, 0x3a, 0x80, 0x7c, 0x8e,
+    0x9, 0x0, 0x1f, 0x15, 0x80, 0xd0, 0x7, 0xef,
+    0x0, 0x68, 0x80, 0x7d, 0x44, 0x12, 0x60, 0x1f,
+    0x3a, 0x83, 0x30, 0x3, 0xe4, 0x80, 0x1a, 0x33,
+    0xf8, 0x64, 0x0, 0x39, 0x9f, 0xa4, 0xc0, 0x3f,
+    0xf0,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x6c, 0xff, 0x40, 0x0, 0x7f, 0xff,
-    0xf4, 0x0, 0xe, 0xff, 0x73, 0x10, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0,
-    0x2, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xf8, 0x0,
-    0x0, 0x2, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xf8,
-    0x0, 0x1, 0x3a, 0xff, 0x50, 0x0, 0x6f, 0xff,
-    0x90, 0x0, 0x6, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x7f, 0xf6, 0x0, 0x0, 0x2, 0xff, 0x80, 0x0,
-    0x0, 0x2f, 0xf8, 0x0, 0x0, 0x2, 0xff, 0x80,
-    0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x2, 0xff,
-    0x80, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x0, 0x2,
-    0xff, 0x80, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xf8, 0x31, 0x0, 0x6, 0xff, 0xff,
-    0x40, 0x0, 0x5, 0xcf, 0xf4,
+    0x0, 0xcd, 0x9f, 0xe4, 0x0, 0x9e, 0x4c, 0x3,
+    0xd2, 0x0, 0x8c, 0x50, 0x0, 0x88, 0x11, 0xcc,
+    0x40, 0x6, 0x0, 0x30, 0xf, 0xff, 0x68, 0x9c,
+    0x0, 0x34, 0x2, 0x7c, 0x50, 0x65, 0x0, 0xf9,
+    0x4, 0x2, 0x6f, 0x80, 0x27, 0x0, 0xe5, 0x0,
+    0x70, 0x7, 0xff, 0xbc, 0xc0, 0x6, 0x1, 0xc2,
+    0x20, 0x48, 0x31, 0x0, 0xa0, 0x0, 0xf8, 0xa0,
+    0x13, 0x51, 0x80, 0x40,
 
     /* U+007C "|" */
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7,
+    0x1f, 0xf3, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0xa0,
 
     /* U+007D "}" */
-    0x7f, 0xfb, 0x40, 0x0, 0x7, 0xff, 0xff, 0x40,
-    0x0, 0x14, 0x9f, 0xfc, 0x0, 0x0, 0x0, 0xdf,
-    0xf0, 0x0, 0x0, 0xa, 0xff, 0x0, 0x0, 0x0,
-    0xaf, 0xf0, 0x0, 0x0, 0xa, 0xff, 0x0, 0x0,
-    0x0, 0xaf, 0xf0, 0x0, 0x0, 0xa, 0xff, 0x0,
-    0x0, 0x0, 0xaf, 0xf0, 0x0, 0x0, 0xa, 0xff,
-    0x0, 0x0, 0x0, 0x8f, 0xf8, 0x30, 0x0, 0x1,
-    0xbf, 0xff, 0x30, 0x0, 0x2e, 0xff, 0xf3, 0x0,
-    0x9, 0xff, 0x50, 0x0, 0x0, 0xaf, 0xf0, 0x0,
-    0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0xaf, 0xf0,
-    0x0, 0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0xaf,
-    0xf0, 0x0, 0x0, 0xa, 0xff, 0x0, 0x0, 0x0,
-    0xaf, 0xf0, 0x0, 0x0, 0xd, 0xff, 0x0, 0x1,
-    0x49, 0xff, 0xc0, 0x0, 0x7f, 0xff, 0xf4, 0x0,
-    0x7, 0xff, 0xb4, 0x0, 0x0,
+    0x7f, 0xf5, 0xa0, 0x7, 0xc9, 0x68, 0x1, 0x35,
+    0xb0, 0x2, 0x0, 0x21, 0x49, 0x20, 0x30, 0xf,
+    0x38, 0x7, 0xff, 0xc8, 0x80, 0x10, 0x60, 0x1a,
+    0x50, 0x1f, 0xc, 0x2, 0x35, 0x0, 0xfa, 0xc4,
+    0x2b, 0xcc, 0x2, 0x30, 0x2, 0x80, 0x7f, 0xfb,
+    0xdc, 0x3, 0x85, 0x24, 0x80, 0xc0, 0x26, 0xb6,
+    0x0, 0x40, 0x7, 0x92, 0xd0, 0x2,
 
     /* U+007E "~" */
-    0x0, 0x7e, 0xfc, 0x30, 0x0, 0x2, 0xfa, 0x7,
-    0xff, 0xff, 0xf6, 0x0, 0x5, 0xf8, 0xe, 0xf6,
-    0x27, 0xff, 0x80, 0x1d, 0xf4, 0x3f, 0xb0, 0x0,
-    0x4e, 0xff, 0xff, 0xb0, 0x5f, 0x70, 0x0, 0x1,
-    0xaf, 0xfa, 0x10,
+    0x0, 0x3f, 0x7e, 0x18, 0x6, 0x2f, 0xa0, 0x78,
+    0x10, 0x3c, 0x60, 0x9, 0xc0, 0x82, 0x42, 0x76,
+    0x2, 0x60, 0x6, 0x3, 0xc, 0x51, 0x89, 0xec,
+    0x5f, 0xf8, 0x91, 0xc, 0x18, 0x1, 0x27, 0xa8,
+    0x1, 0x68, 0x0,
 
     /* U+00A0 " " */
 
     /* U+00A1 "¡" */
-    0x6, 0xfc, 0x10, 0xff, 0xf8, 0xd, 0xff, 0x60,
-    0x28, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xfc, 0x0, 0x5f, 0xd0, 0x6, 0xfe, 0x0, 0x7f,
-    0xf0, 0x7, 0xff, 0x0, 0x8f, 0xf0, 0x9, 0xff,
-    0x10, 0x9f, 0xf1, 0xa, 0xff, 0x20, 0xaf, 0xf3,
-    0xb, 0xff, 0x30, 0xcf, 0xf4, 0xc, 0xff, 0x50,
+    0x6, 0xfc, 0x10, 0x90, 0x39, 0x2, 0x0, 0x70,
+    0x7b, 0xcb, 0x1, 0x43, 0x0, 0x7c, 0xbf, 0x80,
+    0x18, 0x40, 0x6, 0x6, 0x0, 0x10, 0x10, 0xf,
+    0xbc, 0x3, 0x8, 0x0, 0x40, 0x3c, 0x60, 0x3,
+    0x0, 0xc2, 0x2, 0x1, 0x9c, 0x0, 0xe0, 0x18,
+    0x40,
 
     /* U+00A2 "¢" */
-    0x0, 0x0, 0x0, 0x19, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x1,
-    0x9f, 0xff, 0xff, 0xe8, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x20, 0x3, 0xff, 0xf9,
-    0x5f, 0xb3, 0xaf, 0xfc, 0x0, 0xdf, 0xf5, 0x1,
-    0xfb, 0x0, 0x8c, 0x30, 0x5f, 0xf9, 0x0, 0x1f,
-    0xb0, 0x0, 0x0, 0xa, 0xff, 0x20, 0x1, 0xfb,
-    0x0, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x1f, 0xb0,
-    0x0, 0x0, 0xc, 0xfe, 0x0, 0x1, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0xf0, 0x0, 0x1f, 0xb0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x1, 0xfb, 0x0, 0x0,
-    0x0, 0x1f, 0xfd, 0x0, 0x1f, 0xb0, 0x2, 0x50,
-    0x0, 0x8f, 0xfc, 0x21, 0xfb, 0x3, 0xef, 0xb0,
-    0x0, 0xbf, 0xff, 0xcf, 0xec, 0xff, 0xf6, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x16, 0xbf, 0xea, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0xcb, 0x0, 0x7f, 0xf0, 0x5b, 0x40,
+    0x3f, 0xf9, 0xea, 0xe, 0x40, 0x1f, 0x86, 0x7e,
+    0xc0, 0xf7, 0xa0, 0x3, 0x93, 0x98, 0x3, 0x85,
+    0xf4, 0x80, 0x7, 0x60, 0x6, 0xa0, 0x4c, 0x50,
+    0x2e, 0x0, 0x70, 0x2, 0xa5, 0x0, 0x7, 0x4e,
+    0x7e, 0xa, 0x40, 0xca, 0x1, 0xe8, 0xc3, 0xf,
+    0x0, 0x58, 0x7, 0xfc, 0xc0, 0x2, 0x0, 0xff,
+    0xe0, 0x88, 0x7, 0xfe, 0x60, 0x10, 0xf, 0xfd,
+    0xa0, 0x5, 0x0, 0xff, 0x98, 0x1, 0x0, 0x1f,
+    0x12, 0x80, 0x5, 0xc0, 0xb0, 0x80, 0x31, 0xe5,
+    0x58, 0x2, 0x10, 0xf, 0x74, 0xb, 0x98, 0x10,
+    0xd0, 0xa, 0xdc, 0x0, 0x60, 0x26, 0x0, 0xa6,
+    0x0, 0xd1, 0xd2, 0x80, 0x2b, 0x3e, 0xa0, 0x1e,
+    0x16, 0xa0, 0x5a, 0x60, 0xf, 0xfe, 0xb0,
 
     /* U+00A3 "£" */
-    0x0, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc8,
-    0x30, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x5, 0xff, 0xfd, 0xa8,
-    0x89, 0xcf, 0xf3, 0x0, 0x0, 0x2f, 0xff, 0x50,
-    0x0, 0x0, 0x1, 0x80, 0x0, 0x0, 0x9f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2d, 0xdd, 0xff, 0xfd, 0xdd, 0xdd, 0xdd,
-    0x10, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0x77, 0xff, 0xc7, 0x77, 0x77, 0x77,
-    0x77, 0x71, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4,
+    0x0, 0xfc, 0xb5, 0xbf, 0xee, 0xc8, 0x30, 0xf,
+    0x93, 0xa9, 0x48, 0x0, 0x26, 0xf8, 0xe0, 0x1c,
+    0xb6, 0x20, 0x4a, 0xee, 0x63, 0x0, 0x20, 0x6,
+    0x2a, 0x0, 0x56, 0xd4, 0x42, 0x73, 0x9c, 0xc0,
+    0x35, 0x80, 0x25, 0x40, 0x3c, 0x30, 0x1, 0xce,
+    0x2, 0xc0, 0x1f, 0xfc, 0x21, 0x5, 0x0, 0xff,
+    0xe1, 0x8, 0x0, 0x40, 0x3f, 0xfa, 0x25, 0xba,
+    0xc0, 0x2, 0xee, 0xfc, 0x20, 0x18, 0x8a, 0x0,
+    0x88, 0xbe, 0x0, 0xc5, 0xfe, 0xe0, 0x2, 0xff,
+    0xfc, 0x20, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x30,
+    0xbb, 0x98, 0x0, 0xce, 0xff, 0xe1, 0x38, 0x88,
+    0x0, 0x71, 0x1f, 0xe5, 0x0, 0xff, 0xe3, 0x0,
 
     /* U+00A4 "¤" */
-    0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x0, 0x8f, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe2, 0xc, 0xff, 0x60, 0x3a, 0xdf,
-    0xfc, 0x71, 0xc, 0xff, 0x60, 0xc, 0xff, 0xcf,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0x60, 0x0, 0xc,
-    0xff, 0xfc, 0x64, 0x48, 0xef, 0xff, 0x60, 0x0,
-    0x0, 0x9f, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xc0, 0x0, 0x7, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x20, 0x0, 0xbf, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xf5, 0x0, 0xc, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0,
-    0xbf, 0x80, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf5,
-    0x0, 0x7, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0x20, 0x0, 0x2f, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xc0, 0x0, 0x0, 0x9f, 0xf5, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0xa, 0xff,
-    0xfb, 0x63, 0x48, 0xef, 0xff, 0x40, 0x0, 0xa,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x40,
-    0xa, 0xff, 0x80, 0x4a, 0xef, 0xfc, 0x81, 0x1d,
-    0xff, 0x40, 0x9f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1d, 0xf3, 0x0, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x14, 0x0,
+    0x0, 0x18, 0x7, 0xff, 0x8, 0x80, 0x11, 0x8c,
+    0x1, 0xff, 0xb3, 0x4, 0x8, 0x12, 0xc0, 0x75,
+    0xbf, 0xec, 0x71, 0xc, 0x31, 0x40, 0xc3, 0x9,
+    0xcc, 0x29, 0x0, 0xe, 0x3b, 0x4c, 0x25, 0x80,
+    0x18, 0x60, 0x60, 0x73, 0x76, 0x71, 0x2, 0x9,
+    0x60, 0xc, 0xa0, 0x9, 0xc6, 0x44, 0x47, 0x28,
+    0x1, 0x40, 0x31, 0x30, 0x4b, 0x0, 0x7a, 0x8c,
+    0x3c, 0x3, 0x28, 0x13, 0x0, 0x7e, 0xf0, 0x32,
+    0x0, 0xb0, 0x14, 0x3, 0xf8, 0xc4, 0x1c, 0x2,
+    0x70, 0xf0, 0xf, 0xf1, 0x1, 0x80, 0x4e, 0x1e,
+    0x1, 0xfe, 0x10, 0x30, 0xb, 0x1, 0x40, 0x3f,
+    0x8c, 0x81, 0xc0, 0x25, 0x2, 0x60, 0xf, 0xd0,
+    0x6, 0x40, 0x11, 0x30, 0x4a, 0x80, 0x7a, 0x90,
+    0x3c, 0x3, 0x8c, 0x1, 0x56, 0xc6, 0x91, 0xca,
+    0x0, 0x70, 0xd, 0x4a, 0x4, 0x9, 0x39, 0x6e,
+    0x20, 0x21, 0x68, 0x0, 0xa5, 0x7, 0xdb, 0x51,
+    0x0, 0x1b, 0xf7, 0x90, 0x5a, 0x1, 0x83, 0xc0,
+    0x25, 0x77, 0xfb, 0x20, 0x45, 0x84, 0xe, 0x13,
+    0x50, 0x1, 0xff, 0xe, 0x59, 0x80,
 
     /* U+00A5 "¥" */
-    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x90, 0x2f, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x6f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0,
-    0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xf8, 0x0, 0x0, 0x1, 0xef, 0xd0, 0x0, 0x0,
-    0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x90, 0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x40, 0x0, 0x6, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x10, 0x2,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0x0, 0xcf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf5, 0x7f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xef, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0x99, 0x9c,
-    0xff, 0xff, 0xb9, 0x99, 0x91, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x3, 0x99, 0x99, 0x9c, 0xff, 0xb9, 0x99,
-    0x99, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0, 0x0,
-    0x0, 0x0,
+    0xc, 0xff, 0x18, 0x7, 0xfe, 0x4f, 0xf4, 0x87,
+    0x0, 0x38, 0x3, 0xfe, 0x1a, 0x2, 0x90, 0x29,
+    0x2, 0x80, 0xf, 0xf5, 0x88, 0x70, 0x4, 0xc8,
+    0xe, 0x60, 0x1f, 0x95, 0x40, 0xe6, 0x1, 0xa8,
+    0x43, 0x80, 0x3e, 0x1b, 0x2, 0x80, 0xe, 0x1b,
+    0x2, 0x90, 0xf, 0x50, 0x87, 0x80, 0x7c, 0xaa,
+    0x6, 0x40, 0xc, 0xc8, 0x10, 0x40, 0x1f, 0xac,
+    0x42, 0x84, 0x0, 0x52, 0x6, 0xe0, 0x1f, 0xc3,
+    0x40, 0x36, 0x0, 0xe0, 0x7, 0x0, 0x7f, 0xc8,
+    0xc0, 0xaa, 0x73, 0x8, 0x20, 0xf, 0xfd, 0x22,
+    0x17, 0x0, 0x6e, 0x1, 0xfc, 0x73, 0x38, 0x80,
+    0x40, 0xf, 0x33, 0x84, 0x3, 0x95, 0x9b, 0x18,
+    0x6, 0x46, 0x6c, 0x40, 0x1c, 0xdf, 0xfd, 0x0,
+    0xb, 0xff, 0xe3, 0x0, 0xff, 0xe7, 0x37, 0xff,
+    0x40, 0x2, 0xff, 0xf8, 0xc0, 0x39, 0x59, 0xb8,
+    0xc0, 0x8, 0xcd, 0xc4, 0x1, 0xc7, 0x33, 0xd6,
+    0x0, 0xf9, 0x9e, 0x10, 0xf, 0xff, 0x0,
 
     /* U+00A6 "¦" */
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0xd, 0xd5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xd5, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7, 0x1f, 0xf7,
-    0x1f, 0xf7, 0x1f, 0xf7,
+    0x1f, 0xf3, 0x80, 0x7f, 0xf5, 0x4, 0x8a, 0xd,
+    0xd2, 0x80, 0x7f, 0xf2, 0x77, 0x4a, 0x24, 0x50,
+    0x7, 0xff, 0x50,
 
     /* U+00A7 "§" */
-    0x0, 0x0, 0x5b, 0xef, 0xfd, 0xa6, 0x10, 0x0,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0xcf,
-    0xf9, 0x43, 0x35, 0x9e, 0xc0, 0x3, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x20, 0x5, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xb6, 0x10, 0x0,
-    0x0, 0xdf, 0xfc, 0xff, 0xff, 0xf6, 0x0, 0x8,
-    0xfe, 0x30, 0x4, 0x8e, 0xff, 0x50, 0xe, 0xf8,
-    0x0, 0x0, 0x1, 0xcf, 0xd0, 0xf, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0xc, 0xfd, 0x10, 0x0,
-    0x0, 0x7f, 0xe0, 0x5, 0xff, 0xf8, 0x30, 0x2,
-    0xef, 0x90, 0x0, 0x6f, 0xff, 0xff, 0xcf, 0xfd,
-    0x0, 0x0, 0x0, 0x5a, 0xef, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0x9f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x60, 0x7, 0x40, 0x0,
-    0x0, 0x4, 0xff, 0x40, 0xe, 0xfc, 0x74, 0x24,
-    0x8f, 0xfd, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff,
-    0xd2, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xc7, 0x0,
-    0x0,
+    0x0, 0xcb, 0x7d, 0xfe, 0xda, 0x61, 0x0, 0x87,
+    0x29, 0x4, 0x0, 0x4b, 0x3e, 0x20, 0xd, 0x30,
+    0x6b, 0xcc, 0x53, 0x9, 0x8, 0x19, 0x82, 0xa5,
+    0xc, 0xcb, 0x3d, 0xc0, 0x3, 0x0, 0x10, 0x3,
+    0xe2, 0x0, 0x8, 0x1, 0xc0, 0x3f, 0xc8, 0x41,
+    0x34, 0x80, 0x1f, 0xdc, 0x0, 0x5b, 0xfb, 0x61,
+    0x0, 0xee, 0x0, 0x18, 0x1, 0x27, 0x98, 0x2,
+    0x82, 0x1c, 0xc7, 0xdb, 0x88, 0x4a, 0x80, 0x18,
+    0x18, 0xc0, 0x9, 0x1e, 0x61, 0x0, 0x1, 0xe,
+    0x0, 0xe1, 0xa0, 0x20, 0x1, 0x85, 0x88, 0x7,
+    0x8, 0x8, 0x2, 0x40, 0xba, 0xc, 0x0, 0x52,
+    0xe, 0x0, 0x59, 0x0, 0x3e, 0x7e, 0x68, 0x94,
+    0x80, 0x4d, 0xf4, 0xa2, 0x6, 0x0, 0x90, 0xf,
+    0x2d, 0x76, 0x30, 0x2, 0x80, 0x3f, 0x8e, 0x6c,
+    0x5, 0x40, 0x3f, 0xc8, 0x0, 0x30, 0x3, 0xa0,
+    0x7, 0x90, 0x0, 0x40, 0x9, 0xbc, 0x74, 0x24,
+    0x8b, 0x2, 0x40, 0x15, 0x3, 0x8b, 0xdb, 0x70,
+    0x2f, 0x0, 0xd, 0xe3, 0x98, 0x80, 0x9c, 0x69,
+    0x0, 0x0,
 
     /* U+00A8 "¨" */
-    0x3c, 0xa0, 0x1, 0xbb, 0x19, 0xff, 0x20, 0x6f,
-    0xf6, 0x4e, 0xb0, 0x1, 0xdd, 0x20,
+    0x3c, 0xa0, 0x0, 0xdd, 0x86, 0x8d, 0x48, 0x1d,
+    0x10, 0xfa, 0x28, 0x40, 0xe4, 0x44,
 
     /* U+00A9 "©" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xff,
-    0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xfa, 0x64, 0x35, 0x8d, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb1, 0x0, 0x0, 0x0, 0x5, 0xeb,
-    0x10, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdb, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x9,
-    0xd0, 0x0, 0x4, 0xae, 0xfe, 0xa2, 0x0, 0x5,
-    0xf1, 0x0, 0xf5, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0xd, 0x80, 0x5f, 0x0, 0x8, 0xff,
-    0x71, 0x0, 0x7f, 0x90, 0x0, 0x8c, 0x8, 0xc0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x10, 0x0, 0x5,
-    0xf0, 0x9b, 0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0x1a, 0xa0, 0x6, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xf1, 0x8c, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0x6, 0xf0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x10,
-    0x0, 0x8, 0xd0, 0x1f, 0x40, 0x8, 0xff, 0x71,
-    0x0, 0x7f, 0x90, 0x0, 0xd8, 0x0, 0xbc, 0x0,
-    0x9, 0xff, 0xfe, 0xff, 0xf6, 0x0, 0x5f, 0x20,
-    0x2, 0xf7, 0x0, 0x4, 0xae, 0xfe, 0xa2, 0x0,
-    0x1e, 0x80, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xc0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xd1, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x73, 0x10, 0x25, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x23, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe7, 0xa5, 0x6f, 0xfd, 0x8e, 0x20,
+    0x1f, 0xe2, 0xcb, 0xb, 0xb6, 0x52, 0x57, 0x40,
+    0x7, 0xe5, 0xd7, 0xea, 0x64, 0x35, 0x8d, 0xa6,
+    0xb1, 0x0, 0xe4, 0xa8, 0xb1, 0x0, 0xf9, 0x71,
+    0xa8, 0x3, 0xd, 0x33, 0x80, 0x7f, 0x8b, 0xd1,
+    0xc0, 0x28, 0x39, 0x0, 0x92, 0xbb, 0xfa, 0x88,
+    0x0, 0x55, 0x2, 0x0, 0x68, 0x0, 0xa6, 0xd4,
+    0x40, 0x57, 0x58, 0x0, 0xa5, 0x20, 0xa0, 0xa0,
+    0x8, 0x60, 0x8e, 0xff, 0x40, 0x78, 0x4, 0xa8,
+    0x1a, 0x60, 0x13, 0x85, 0x38, 0x80, 0x1f, 0xa4,
+    0x2, 0xd3, 0x1, 0x70, 0x2, 0x1, 0x28, 0x7,
+    0x8, 0x6, 0x60, 0x13, 0x10, 0x1, 0x0, 0x80,
+    0x7f, 0xf0, 0x89, 0x80, 0x4, 0x2, 0x1, 0xff,
+    0x30, 0xf, 0x18, 0x1, 0x0, 0x94, 0x3, 0x84,
+    0x3, 0x69, 0x3, 0x82, 0x0, 0x1c, 0x29, 0xc4,
+    0x0, 0xfd, 0x20, 0x12, 0xa8, 0x5, 0x20, 0x1,
+    0xc, 0x11, 0xdc, 0xf8, 0xf, 0x0, 0x29, 0x50,
+    0x2, 0x4d, 0xc0, 0x13, 0x6a, 0x23, 0x2e, 0xb0,
+    0xd, 0xb9, 0x0, 0xa, 0x61, 0x0, 0x9, 0x5d,
+    0xfd, 0x44, 0x3, 0xa5, 0x0, 0x19, 0x9e, 0xdc,
+    0x3, 0xf1, 0xe0, 0xe8, 0x7, 0xa2, 0xa3, 0x5c,
+    0xc4, 0x9, 0x6b, 0x1f, 0x44, 0x3, 0xe5, 0xe5,
+    0xac, 0xef, 0xda, 0xc, 0xa0, 0xf, 0xf0, 0xc6,
+    0xf6, 0xe6, 0xfd, 0x18, 0x7, 0x80,
 
     /* U+00AA "ª" */
-    0x6, 0xce, 0xfe, 0x91, 0x7, 0xfc, 0x88, 0xcf,
-    0xd0, 0x4, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0,
-    0x7, 0xf7, 0x8, 0xdf, 0xff, 0xff, 0x7a, 0xf9,
-    0x33, 0x38, 0xf7, 0xef, 0x0, 0x0, 0x8f, 0x7b,
-    0xf6, 0x11, 0x6f, 0xf7, 0x1b, 0xff, 0xfd, 0x9f,
-    0x70, 0x1, 0x21, 0x0, 0x31,
+    0x6, 0xce, 0xfe, 0x91, 0x7, 0x90, 0x67, 0x26,
+    0xc0, 0x7b, 0xc8, 0x86, 0x19, 0x28, 0x20, 0x6,
+    0xb0, 0x20, 0x8d, 0xff, 0xa0, 0x1, 0x4e, 0x99,
+    0x93, 0x80, 0x10, 0x24, 0xce, 0x0, 0x94, 0x18,
+    0x44, 0xce, 0x0, 0xa4, 0x9e, 0xe5, 0xb0, 0x0,
+    0x6f, 0xb7, 0xb6, 0x71, 0x80,
 
     /* U+00AB "«" */
-    0x0, 0x0, 0xab, 0x60, 0x6, 0xba, 0x0, 0x0,
-    0x9f, 0xd0, 0x3, 0xff, 0x40, 0x0, 0x5f, 0xf2,
-    0x1, 0xef, 0x80, 0x0, 0x2f, 0xf6, 0x0, 0xbf,
-    0xc0, 0x0, 0xd, 0xfa, 0x0, 0x7f, 0xe1, 0x0,
-    0x8, 0xff, 0x10, 0x2f, 0xf6, 0x0, 0x0, 0x2f,
-    0xf7, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x5f, 0xf3,
-    0x1, 0xef, 0x90, 0x0, 0x0, 0x9f, 0xe1, 0x3,
-    0xff, 0x50, 0x0, 0x0, 0xcf, 0xa0, 0x6, 0xfe,
-    0x10, 0x0, 0x2, 0xef, 0x60, 0xa, 0xfc, 0x0,
+    0x0, 0xd5, 0x6c, 0x0, 0x6b, 0xa0, 0xd, 0x2a,
+    0xcc, 0x3, 0x94, 0xe0, 0x9, 0x58, 0x3c, 0x7,
+    0x41, 0xd0, 0x0, 0x54, 0x12, 0x41, 0x42, 0x70,
+    0x1, 0x78, 0x2b, 0x3, 0xa0, 0xe8, 0x5, 0x4,
+    0x16, 0x5, 0x1, 0x2, 0x1, 0x50, 0x1, 0x80,
+    0x90, 0x2c, 0x3, 0x15, 0x4, 0x18, 0x50, 0x94,
+    0x80, 0x65, 0x60, 0xd1, 0x16, 0x83, 0x28, 0x6,
+    0x93, 0x1b, 0x3, 0x90, 0xb1, 0x0, 0xdc, 0x2a,
+    0xc0, 0xca, 0x3a, 0x0,
 
     /* U+00AC "¬" */
-    0x3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf6,
+    0x3, 0x3f, 0xfc, 0x25, 0x99, 0xff, 0x9c, 0x3,
+    0xff, 0x84, 0x5f, 0xff, 0xe0, 0xf, 0xff, 0x78,
 
     /* U+00AD "­" */
-    0x25, 0x55, 0x55, 0x55, 0x6, 0xff, 0xff, 0xff,
-    0xf2, 0x6f, 0xff, 0xff, 0xff, 0x20,
+    0x25, 0x5f, 0x81, 0x2a, 0xbe, 0x20, 0xf, 0xe0,
 
     /* U+00AE "®" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xad, 0xff,
-    0xfc, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2c,
-    0xfa, 0x64, 0x35, 0x8d, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xb1, 0x0, 0x0, 0x0, 0x5, 0xeb,
-    0x10, 0x0, 0x0, 0x4f, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdb, 0x0, 0x0, 0x1e, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xf7, 0x0, 0x9,
-    0xd0, 0x0, 0xcf, 0xff, 0xff, 0xb5, 0x0, 0x5,
-    0xf1, 0x0, 0xf5, 0x0, 0xc, 0xfa, 0x99, 0xbf,
-    0xf7, 0x0, 0xd, 0x80, 0x5f, 0x0, 0x0, 0xcf,
-    0x20, 0x0, 0x2e, 0xf1, 0x0, 0x8c, 0x8, 0xc0,
-    0x0, 0xc, 0xf2, 0x0, 0x0, 0xaf, 0x30, 0x5,
-    0xf0, 0x9b, 0x0, 0x0, 0xcf, 0x20, 0x0, 0xb,
-    0xf2, 0x0, 0x3f, 0x1a, 0xa0, 0x0, 0xc, 0xf2,
-    0x0, 0x18, 0xfd, 0x0, 0x3, 0xf1, 0x8c, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x5f,
-    0x6, 0xf0, 0x0, 0xc, 0xfa, 0x99, 0xdf, 0x20,
-    0x0, 0x8, 0xd0, 0x1f, 0x40, 0x0, 0xcf, 0x20,
-    0x3, 0xfc, 0x0, 0x0, 0xd8, 0x0, 0xbc, 0x0,
-    0xc, 0xf2, 0x0, 0x8, 0xf7, 0x0, 0x5f, 0x20,
-    0x2, 0xf7, 0x0, 0xcf, 0x20, 0x0, 0xc, 0xf2,
-    0x1e, 0x80, 0x0, 0x6, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xc0, 0x0, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x3d, 0xd1, 0x0, 0x0,
-    0x0, 0x5, 0xfd, 0x73, 0x10, 0x25, 0xaf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8d, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x23, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe7, 0xa5, 0x6f, 0xfd, 0x8e, 0x20,
+    0x1f, 0xe2, 0xcb, 0xb, 0xb6, 0x52, 0x57, 0x40,
+    0x7, 0xe5, 0xd7, 0xea, 0x64, 0x35, 0x8d, 0xa6,
+    0xb1, 0x0, 0xe4, 0xa8, 0xb1, 0x0, 0xf9, 0x71,
+    0xa8, 0x3, 0xd, 0x33, 0x80, 0x7f, 0x8b, 0xd1,
+    0xc0, 0x28, 0x39, 0x0, 0x67, 0xff, 0x5a, 0x80,
+    0xa, 0xa0, 0x40, 0xd, 0x0, 0x1c, 0xac, 0xc4,
+    0x45, 0x38, 0x1, 0x4a, 0x41, 0x41, 0x40, 0x3a,
+    0x26, 0x57, 0xa3, 0x2, 0x0, 0x54, 0xd, 0x30,
+    0xf, 0xf1, 0x20, 0x10, 0x3, 0x4c, 0x5, 0xc0,
+    0x3f, 0xe1, 0x1, 0x0, 0x30, 0x9, 0x88, 0x7,
+    0xf0, 0xc2, 0x11, 0x0, 0x38, 0x98, 0x3, 0xdb,
+    0xfe, 0xe7, 0x2f, 0x0, 0x98, 0x7, 0x8c, 0x3,
+    0xca, 0xcc, 0x20, 0xf2, 0x0, 0xb4, 0x81, 0xc1,
+    0x0, 0x3a, 0x26, 0x5c, 0x1c, 0x1, 0x95, 0x40,
+    0x29, 0x0, 0x1f, 0x8d, 0xcd, 0xc0, 0xa, 0x54,
+    0x0, 0x93, 0x70, 0xf, 0xd0, 0x70, 0x43, 0x6e,
+    0x40, 0x2, 0x98, 0x40, 0xcf, 0x20, 0xd, 0x9e,
+    0x7a, 0x50, 0x1, 0x99, 0xed, 0xc0, 0x3f, 0x1e,
+    0xe, 0x80, 0x7a, 0x2a, 0x35, 0xcc, 0x40, 0x96,
+    0xb1, 0xf4, 0x40, 0x3e, 0x5e, 0x5a, 0xce, 0xfd,
+    0xa0, 0xca, 0x0, 0xff, 0xc, 0x6f, 0x6e, 0x6f,
+    0xd1, 0x80, 0x78,
 
     /* U+00AF "¯" */
-    0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0x2f, 0xff, 0xff,
-    0xff, 0xff,
+    0x1a, 0xaf, 0xe3, 0x55, 0xfe,
 
     /* U+00B0 "°" */
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x7e, 0xff,
-    0xc4, 0x0, 0xa, 0xfa, 0x67, 0xdf, 0x50, 0x4f,
-    0x80, 0x0, 0xc, 0xf0, 0x9f, 0x0, 0x0, 0x4,
-    0xf5, 0xbd, 0x0, 0x0, 0x2, 0xf6, 0x9f, 0x10,
-    0x0, 0x5, 0xf4, 0x3f, 0xa0, 0x0, 0x1e, 0xe0,
-    0x8, 0xfd, 0x9a, 0xff, 0x40, 0x0, 0x5c, 0xfe,
-    0xa2, 0x0,
+    0x0, 0xc2, 0x1, 0xf3, 0xf7, 0x3f, 0x10, 0x2,
+    0xa8, 0x49, 0x81, 0xb5, 0x4, 0x57, 0xa6, 0x7d,
+    0x3a, 0xd, 0x8, 0x0, 0xd0, 0xa, 0x44, 0x0,
+    0xe6, 0x3, 0x22, 0x8, 0x6, 0x70, 0x2a, 0xb,
+    0x0, 0x86, 0xc5, 0xd, 0xd7, 0x66, 0xb8, 0x68,
+    0x1, 0x14, 0x2c, 0x8b, 0xa8, 0x0,
 
     /* U+00B1 "±" */
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x3, 0x33, 0x33, 0xff,
-    0x73, 0x33, 0x31, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x31, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0xf7, 0xf9, 0x40, 0x3f, 0xfc, 0x86, 0x7c,
+    0x0, 0x23, 0x3c, 0x25, 0x99, 0xc0, 0x8, 0xcc,
+    0xce, 0x1, 0xff, 0xc2, 0x2f, 0xfe, 0x0, 0x57,
+    0xfe, 0x60, 0xf, 0xff, 0x97, 0xf9, 0x40, 0x3f,
+    0xf9, 0x6, 0x7f, 0xf8, 0x4b, 0x33, 0xff, 0x38,
+    0x7, 0xff, 0x8,
 
     /* U+00B2 "²" */
-    0x0, 0x6b, 0xef, 0xeb, 0x40, 0x0, 0xcf, 0xfc,
-    0xbd, 0xff, 0x60, 0x7, 0xa1, 0x0, 0x5, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf1, 0x0, 0x0,
-    0x0, 0x2, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0x50, 0x0, 0x0, 0x2, 0xdf, 0x80, 0x0, 0x0,
-    0x3, 0xef, 0x70, 0x0, 0x0, 0x4, 0xff, 0x50,
-    0x0, 0x0, 0x5, 0xff, 0x40, 0x0, 0x0, 0x6,
-    0xff, 0xca, 0xaa, 0xaa, 0x60, 0xbf, 0xff, 0xff,
-    0xff, 0xfa,
+    0x0, 0x35, 0xf7, 0xf5, 0xa0, 0x5, 0x92, 0x84,
+    0x86, 0x96, 0xc0, 0xb, 0x5e, 0xcb, 0xda, 0x9,
+    0x0, 0x3d, 0x8, 0x4, 0xa2, 0x2, 0x1, 0xf1,
+    0x8, 0xc0, 0x1e, 0x1f, 0xb, 0x0, 0xf1, 0x61,
+    0x3a, 0x80, 0x71, 0xe1, 0x44, 0x0, 0x39, 0x30,
+    0x69, 0xc0, 0x39, 0x6c, 0x2d, 0x40, 0x39, 0xa8,
+    0xf, 0xaa, 0xb3, 0x6, 0x80, 0xd, 0x57, 0xb0,
 
     /* U+00B3 "³" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x10, 0x8a, 0xaa,
-    0xaa, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x4f, 0xe1,
-    0x0, 0x0, 0x0, 0x3f, 0xe2, 0x0, 0x0, 0x0,
-    0x2e, 0xf3, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x47, 0x8c, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x96, 0x0, 0x0, 0x1c, 0xf6, 0x1f,
-    0xff, 0xcb, 0xcf, 0xfc, 0x0, 0x17, 0xce, 0xff,
-    0xc7, 0x0,
+    0xe, 0xff, 0xfc, 0x20, 0xca, 0xbc, 0x40, 0x42,
+    0x11, 0x55, 0xb8, 0x87, 0x0, 0x3c, 0x76, 0x38,
+    0x20, 0x1c, 0x5a, 0x1a, 0x40, 0x1e, 0xb1, 0xc,
+    0xa2, 0x0, 0xed, 0x87, 0x35, 0xc1, 0x0, 0xc8,
+    0xf1, 0x8c, 0x32, 0x1, 0xfb, 0x0, 0x82, 0x58,
+    0x3, 0xc, 0x86, 0xb, 0x4f, 0xe5, 0xe7, 0x19,
+    0x98, 0x7a, 0xc, 0x90, 0xcd, 0x18, 0x0,
 
     /* U+00B4 "´" */
-    0x0, 0x1, 0x78, 0x71, 0x0, 0x2d, 0xfe, 0x40,
-    0x2, 0xef, 0xb1, 0x0, 0x3e, 0xf7, 0x0, 0x0,
+    0x0, 0x85, 0xe1, 0xc4, 0x0, 0x59, 0xc, 0x62,
+    0x5, 0x84, 0x9e, 0x80, 0x78, 0x31, 0x62, 0x0,
 
     /* U+00B5 "µ" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x87,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x2, 0xff, 0x87, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x2f, 0xf8, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0x87, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x2f, 0xf8, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x87, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x2f, 0xf8, 0x7f, 0xf3, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x87, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x6f, 0xf8, 0x7f, 0xf9, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x87, 0xff, 0xf3, 0x0, 0x0, 0x8,
-    0xff, 0xf8, 0x7f, 0xff, 0xf9, 0x54, 0x6c, 0xff,
-    0xff, 0x87, 0xff, 0xdf, 0xff, 0xff, 0xff, 0x5f,
-    0xf8, 0x7f, 0xf3, 0x6c, 0xff, 0xd9, 0x20, 0xff,
-    0x87, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x80, 0x7c, 0x5f, 0xe8, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xf7, 0x44, 0x3, 0xcc, 0x1,
+    0xf2, 0x80, 0x7b, 0x0, 0x3e, 0xa0, 0xf, 0x31,
+    0x80, 0x74, 0x18, 0x7, 0xd9, 0x2a, 0x8d, 0x8e,
+    0x1, 0xf1, 0x3, 0x55, 0xc9, 0x85, 0x0, 0x7b,
+    0xa4, 0xc0, 0x4, 0xda, 0xa0, 0x1f, 0x36, 0x7f,
+    0xb6, 0x48, 0x3f, 0xd0, 0x1, 0xff, 0xf0,
 
     /* U+00B6 "¶" */
-    0x0, 0x5, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0xc, 0xff, 0xff, 0xff, 0xa1, 0x11, 0x1f, 0xf3,
-    0x3f, 0xff, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x6f, 0xff, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x6f, 0xff, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x3f, 0xff, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0xc, 0xff, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x2, 0xdf, 0xff, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x7, 0xcf, 0xff, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf3,
-    0x0, 0x0, 0x0, 0x69, 0x50, 0x0, 0x9, 0x91,
+    0x0, 0x96, 0xfb, 0xff, 0xf8, 0xc0, 0x72, 0x90,
+    0x40, 0x3f, 0xed, 0x30, 0xe, 0x5e, 0xec, 0x1,
+    0x19, 0x80, 0x3c, 0x62, 0x38, 0x2, 0x50, 0xf,
+    0xfe, 0x9a, 0x80, 0x7f, 0xf0, 0xcc, 0xc0, 0x1f,
+    0xfc, 0x3e, 0x20, 0xf, 0xfe, 0x11, 0x6c, 0x18,
+    0x7, 0xff, 0x9, 0xf3, 0xd4, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0x0, 0xff, 0xf6, 0xe3, 0x60,
+    0x6, 0x66, 0x10,
 
     /* U+00B7 "·" */
-    0x5, 0xc9, 0x0, 0xff, 0xf7, 0x1f, 0xff, 0x80,
-    0x7f, 0xc1,
+    0x5, 0xc9, 0x0, 0x51, 0xb3, 0x88, 0x5, 0xe3,
+    0x0, 0x72,
 
     /* U+00B8 "¸" */
-    0x0, 0x5b, 0x0, 0x0, 0xb, 0xd0, 0x0, 0x0,
-    0xff, 0xf5, 0x0, 0x0, 0x2e, 0xf0, 0x0, 0x0,
-    0xcf, 0x16, 0xb8, 0xaf, 0xc0, 0x6d, 0xfe, 0xa1,
-    0x0,
+    0x0, 0x2d, 0x80, 0x77, 0x30, 0x7, 0x21, 0x7a,
+    0x80, 0x5f, 0xa3, 0x40, 0x18, 0x88, 0x2, 0xd7,
+    0x14, 0x66, 0x10, 0x67, 0x45, 0xd0,
 
     /* U+00B9 "¹" */
-    0x8f, 0xff, 0xf8, 0x0, 0x5, 0xaa, 0xcf, 0x80,
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x7f,
-    0x80, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x7f, 0x80, 0x0, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x7a, 0xac, 0xfd,
-    0xaa, 0x3b, 0xff, 0xff, 0xff, 0xf5,
+    0x8f, 0xfd, 0x0, 0x16, 0xaa, 0x8c, 0x3, 0x96,
+    0xa9, 0x60, 0x1f, 0xff, 0x87, 0xaa, 0x58, 0x2d,
+    0x50, 0xf1, 0x54, 0x60, 0x4a, 0xa6,
 
     /* U+00BA "º" */
-    0x0, 0x7, 0xdf, 0xeb, 0x50, 0x0, 0x1d, 0xfe,
-    0xab, 0xff, 0x90, 0x9, 0xf9, 0x0, 0x1, 0xdf,
-    0x40, 0xff, 0x0, 0x0, 0x4, 0xfa, 0x1f, 0xc0,
-    0x0, 0x0, 0x1f, 0xc0, 0xff, 0x0, 0x0, 0x4,
-    0xfa, 0x9, 0xf9, 0x0, 0x1, 0xdf, 0x40, 0xd,
-    0xfe, 0xab, 0xff, 0x90, 0x0, 0x7, 0xdf, 0xeb,
-    0x50, 0x0,
+    0x0, 0x9f, 0x7f, 0xad, 0x40, 0x21, 0xd8, 0x35,
+    0x52, 0x54, 0x80, 0x20, 0x9b, 0xaa, 0xf8, 0x99,
+    0x1, 0x82, 0x40, 0x21, 0x90, 0xe1, 0x3, 0x0,
+    0xe5, 0x6, 0x10, 0x30, 0xe, 0x50, 0x60, 0x60,
+    0x90, 0x8, 0x64, 0x38, 0x24, 0x9b, 0xaa, 0xf8,
+    0x99, 0x0, 0x1b, 0x6, 0xaa, 0x4a, 0x90,
 
     /* U+00BB "»" */
-    0x9, 0xb8, 0x0, 0x4b, 0xb1, 0x0, 0x0, 0x2f,
-    0xf5, 0x0, 0xcf, 0xb0, 0x0, 0x0, 0x6f, 0xf2,
-    0x1, 0xef, 0x70, 0x0, 0x0, 0xaf, 0xc0, 0x4,
-    0xff, 0x30, 0x0, 0x0, 0xdf, 0x90, 0x8, 0xfe,
-    0x10, 0x0, 0x4, 0xff, 0x40, 0xe, 0xf9, 0x0,
-    0x0, 0xbf, 0xc0, 0x5, 0xff, 0x30, 0x0, 0x7f,
-    0xe1, 0x2, 0xff, 0x60, 0x0, 0x3f, 0xf4, 0x0,
-    0xcf, 0xa0, 0x0, 0x1e, 0xf8, 0x0, 0x9f, 0xd0,
-    0x0, 0xa, 0xfc, 0x0, 0x4f, 0xf3, 0x0, 0x0,
+    0x9, 0xb8, 0x0, 0x25, 0xd8, 0x40, 0x35, 0xa3,
+    0xa8, 0x23, 0xa5, 0x0, 0x62, 0x90, 0xa2, 0xd,
+    0x14, 0x70, 0xc, 0xca, 0x1c, 0x3, 0x41, 0x6,
+    0x1, 0xa8, 0x8e, 0x41, 0x1c, 0x34, 0x40, 0x34,
+    0x83, 0x20, 0x40, 0x8a, 0x0, 0x37, 0x81, 0xa0,
+    0x28, 0x85, 0x0, 0x4e, 0x83, 0xa0, 0x54, 0x12,
+    0x60, 0x3, 0x80, 0xa1, 0xe, 0x5, 0x60, 0x0,
+    0xe8, 0x3a, 0x4, 0x99, 0x50, 0x5, 0x62, 0x70,
+    0x8, 0xc1, 0xc0, 0x10,
 
     /* U+00BC "¼" */
-    0x8f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfd, 0x0, 0x0, 0x0, 0x5, 0xaa, 0xcf,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0x80, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0x80, 0x0, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x3f, 0xe1,
-    0x0, 0x0, 0x0, 0x7f, 0x80, 0x0, 0x0, 0x4f,
-    0xd0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x50, 0xd, 0xf3, 0x0, 0x0,
-    0xa, 0xf7, 0x0, 0x0, 0x7, 0xaa, 0xaa, 0xaa,
-    0xa3, 0x9, 0xf8, 0x0, 0x0, 0x6, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xfd,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0,
-    0xdf, 0x40, 0xd, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0x80, 0x0, 0x0, 0x9f, 0x80, 0x0,
-    0xde, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x4f, 0xfa, 0xaa, 0xae, 0xfa, 0xa2,
-    0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xe0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xe0, 0x0,
+    0x8f, 0xfd, 0x0, 0x1f, 0xf1, 0xfe, 0x80, 0x7d,
+    0xaa, 0xa3, 0x0, 0xff, 0xe0, 0xf0, 0x70, 0x7,
+    0xcb, 0x54, 0xb0, 0xf, 0xfd, 0x24, 0xe6, 0x1,
+    0xff, 0xca, 0x36, 0x28, 0x0, 0xff, 0xe5, 0xf0,
+    0x70, 0x7, 0xff, 0x2e, 0x49, 0xcc, 0x3, 0xff,
+    0x94, 0x6c, 0x50, 0x1, 0xff, 0xcb, 0xe0, 0xe0,
+    0xf, 0xfe, 0x5c, 0x93, 0x98, 0x6, 0x3f, 0xe1,
+    0x0, 0xff, 0xe1, 0x23, 0x14, 0x0, 0x61, 0xd0,
+    0xd1, 0x0, 0xaf, 0xfd, 0x0, 0xff, 0xe5, 0x0,
+    0x48, 0x70, 0x7, 0x58, 0xc1, 0x80, 0x6c, 0x55,
+    0xf9, 0x82, 0x49, 0xcc, 0x3, 0x32, 0xa3, 0x80,
+    0x73, 0xd5, 0x7c, 0x68, 0xc5, 0x0, 0x18, 0xa4,
+    0x68, 0x3, 0xff, 0x87, 0x41, 0xc0, 0x1d, 0xe1,
+    0x42, 0x1b, 0xc0, 0x1f, 0xf4, 0x8b, 0x98, 0x6,
+    0x92, 0x74, 0x0, 0xff, 0xe1, 0x23, 0x14, 0x0,
+    0x64, 0x60, 0x2a, 0xa8, 0xc6, 0xa8, 0x40, 0x1f,
+    0x50, 0x70, 0x7, 0x18, 0x1, 0x57, 0x8, 0x2a,
+    0x84, 0x3, 0xd2, 0x2e, 0x60, 0x1c, 0xff, 0xfe,
+    0x1, 0xff, 0x18, 0x7, 0x23, 0x14, 0x0, 0x7f,
+    0xf2, 0xe8, 0x38, 0x3, 0xff, 0x8e,
 
     /* U+00BD "½" */
-    0x5a, 0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x99, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0x0, 0xb, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xf8, 0x0, 0x0, 0x0, 0x6f, 0xb0,
-    0x2, 0x79, 0xa8, 0x50, 0x0, 0x0, 0x7, 0xf8,
-    0x0, 0x0, 0x2, 0xfe, 0x10, 0x8f, 0xff, 0xff,
-    0xfd, 0x20, 0x7a, 0xac, 0xfd, 0xaa, 0x30, 0xc,
-    0xf5, 0x1, 0xbc, 0x41, 0x2, 0xaf, 0xc0, 0xbf,
-    0xff, 0xff, 0xff, 0x50, 0x7f, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x0, 0x6, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfc, 0xaa, 0xaa, 0xa5, 0x0,
-    0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xf8,
+    0x5a, 0xac, 0xa0, 0x1f, 0xf0, 0xcc, 0x80, 0x3d,
+    0xaa, 0xbb, 0x40, 0x3f, 0xeb, 0x6e, 0x0, 0xf4,
+    0x7f, 0xa0, 0x3, 0xff, 0x2a, 0x8d, 0xc0, 0x3f,
+    0xf9, 0x23, 0x61, 0xc0, 0x1f, 0xfc, 0xaa, 0x19,
+    0x20, 0xf, 0xfe, 0x4b, 0x22, 0x18, 0x3, 0xff,
+    0x92, 0x32, 0x14, 0x1, 0xff, 0xca, 0xa0, 0xa1,
+    0x0, 0xff, 0xe4, 0xb2, 0x21, 0x40, 0x9e, 0x6a,
+    0x14, 0x3, 0xff, 0x84, 0x52, 0x34, 0x11, 0xb0,
+    0xca, 0xf5, 0xa4, 0xf, 0x54, 0xb0, 0x5a, 0xa1,
+    0x80, 0x38, 0x2c, 0x44, 0x66, 0xbe, 0xfd, 0x52,
+    0xe0, 0xc5, 0x51, 0x81, 0x2a, 0x98, 0x1c, 0xd5,
+    0x40, 0x37, 0x88, 0x20, 0x54, 0x6, 0x17, 0xff,
+    0xf2, 0x94, 0xd, 0x80, 0x7f, 0x10, 0x10, 0x7,
+    0xfb, 0xc2, 0x84, 0x3, 0xfb, 0x82, 0xc0, 0x3f,
+    0xa0, 0x99, 0x0, 0x3f, 0xe, 0x1b, 0xb0, 0x7,
+    0xe3, 0x72, 0x90, 0xf, 0xc5, 0xe7, 0x10, 0x0,
+    0xfe, 0xe0, 0xe0, 0xf, 0xc9, 0xa3, 0x4e, 0x1,
+    0xfd, 0x24, 0xe6, 0x1, 0xf3, 0x58, 0xe2, 0x80,
+    0x7f, 0x23, 0x14, 0x0, 0x7c, 0xf2, 0x5, 0x35,
+    0x59, 0x40, 0x3a, 0x83, 0x80, 0x3f, 0x58, 0x0,
+    0xd5, 0x7b, 0x40,
 
     /* U+00BE "¾" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x8a,
-    0xaa, 0xaa, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x9, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x47, 0x8c, 0xfe, 0x10, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xf8, 0x0, 0x0, 0xdf, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xa0, 0x0, 0x9f, 0x80, 0x0, 0x0, 0x2c,
-    0xc1, 0x0, 0x0, 0x95, 0x0, 0x0, 0x1c, 0xf6,
-    0x0, 0x4f, 0xd0, 0x0, 0x0, 0xc, 0xf5, 0x0,
-    0x0, 0x1f, 0xff, 0xcb, 0xcf, 0xfc, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0,
-    0x17, 0xce, 0xff, 0xc7, 0x0, 0x9, 0xf8, 0x0,
-    0x0, 0x5, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xfd, 0x0, 0x0, 0x2,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x30, 0x0, 0x0, 0xcf, 0x50,
-    0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0x80, 0x0, 0x0, 0x9f, 0x90, 0x0, 0xde,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0,
-    0x0, 0x0, 0x4f, 0xfa, 0xaa, 0xae, 0xfa, 0xa2,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xf3, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xe0, 0x0,
+    0xe, 0xff, 0xfc, 0x20, 0x1f, 0x8f, 0xf4, 0x3,
+    0xf3, 0x2a, 0xf1, 0x1, 0x8, 0x7, 0xee, 0xe,
+    0x0, 0xfd, 0x15, 0x5b, 0x88, 0x70, 0x3, 0xf4,
+    0x93, 0x98, 0x7, 0xfe, 0x3b, 0x1c, 0x10, 0xf,
+    0x8d, 0x8a, 0x0, 0x3f, 0xf1, 0x68, 0x69, 0x0,
+    0x7e, 0xe0, 0xe0, 0xf, 0xfe, 0xd, 0x88, 0x65,
+    0x10, 0x7, 0xa4, 0x9c, 0xc0, 0x3f, 0xf8, 0x3b,
+    0xe, 0x6b, 0x82, 0x1, 0x8d, 0x8a, 0x0, 0x3f,
+    0xf8, 0x48, 0xf1, 0x8c, 0x32, 0x1, 0xb8, 0x38,
+    0x3, 0xff, 0x8f, 0x80, 0x40, 0x14, 0x93, 0x98,
+    0x6, 0x2c, 0xc0, 0x80, 0x69, 0x50, 0xc, 0x32,
+    0x18, 0x0, 0x46, 0x28, 0x0, 0xee, 0x39, 0x10,
+    0x8, 0x5a, 0xbf, 0x2f, 0x38, 0xcc, 0xc0, 0x9,
+    0xe, 0x0, 0xe9, 0x36, 0x50, 0xc, 0x3d, 0x6,
+    0x48, 0x66, 0x8c, 0x0, 0x49, 0x39, 0x80, 0x65,
+    0x63, 0x90, 0xf, 0xb, 0xe7, 0x7f, 0xb1, 0xc0,
+    0x8, 0xc5, 0x0, 0x18, 0xa8, 0x38, 0x3, 0xff,
+    0x8b, 0x41, 0xc0, 0x1d, 0xc1, 0x44, 0x19, 0xa0,
+    0x1f, 0xfc, 0x19, 0x17, 0x30, 0xd, 0x26, 0xca,
+    0x0, 0x13, 0x0, 0xff, 0xc8, 0xc5, 0x0, 0x19,
+    0x18, 0xe, 0xaa, 0x31, 0xaa, 0x10, 0x7, 0xf5,
+    0x7, 0x0, 0x71, 0x80, 0x15, 0x70, 0x82, 0xa8,
+    0x40, 0x3f, 0x48, 0xb9, 0x80, 0x73, 0xff, 0xf8,
+    0x7, 0xfc, 0x60, 0x1f, 0x23, 0x14, 0x0, 0x7f,
+    0xf3, 0x68, 0x38, 0x3, 0xff, 0x8e,
 
     /* U+00BF "¿" */
-    0x0, 0x0, 0x1, 0xcf, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xbb, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1d, 0xa1,
-    0x9, 0xff, 0xe7, 0x20, 0x13, 0x8f, 0xff, 0x70,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x8, 0xef, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x0, 0x35, 0x54, 0x30, 0x0, 0x0,
+    0x0, 0xe1, 0xcf, 0x70, 0xf, 0xf9, 0x8c, 0x20,
+    0x3, 0xfe, 0x10, 0x0, 0x80, 0x7f, 0xcd, 0x2f,
+    0x80, 0x1f, 0xf9, 0xa0, 0x80, 0x3f, 0xf9, 0xc5,
+    0x76, 0x60, 0xf, 0xf9, 0x12, 0x10, 0xf, 0xf0,
+    0xc0, 0x1, 0x80, 0x3f, 0x8b, 0x4, 0x28, 0x40,
+    0x3f, 0x16, 0x10, 0x4a, 0x80, 0x7e, 0x1c, 0x10,
+    0xa6, 0x0, 0xfe, 0x81, 0x9, 0x50, 0xf, 0xf3,
+    0x81, 0x30, 0x7, 0xfc, 0x20, 0x20, 0x1f, 0xfc,
+    0x23, 0x20, 0xf, 0xe, 0xd0, 0x83, 0x0, 0x31,
+    0xc8, 0x4, 0xe3, 0x89, 0x58, 0x20, 0x80, 0x63,
+    0x7f, 0xb1, 0xc0, 0x10, 0xe0, 0x3a, 0xe2, 0x1,
+    0xe5, 0xd7, 0x0, 0xd1, 0xd9, 0x54, 0xbc, 0xfa,
+    0x20, 0x0,
 
     /* U+00C0 "À" */
-    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x33,
-    0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4,
+    0x0, 0xf2, 0xff, 0xb8, 0x80, 0x3f, 0xf8, 0xab,
+    0x82, 0x2f, 0x10, 0xf, 0xfe, 0x29, 0xf9, 0x13,
+    0x4, 0x3, 0xff, 0x8a, 0x3a, 0x85, 0xa0, 0x1f,
+    0xfc, 0x7b, 0xfc, 0x0, 0xff, 0xe3, 0x37, 0xfb,
+    0x40, 0x3f, 0xf8, 0xd6, 0x0, 0x24, 0x0, 0xff,
+    0xe2, 0x21, 0x0, 0x5e, 0x1, 0xff, 0xc4, 0xf0,
+    0x16, 0x4, 0x20, 0xf, 0xfe, 0x11, 0x20, 0x34,
+    0x0, 0x20, 0x3, 0xff, 0x85, 0x60, 0x9, 0x15,
+    0x5, 0x10, 0xf, 0xfc, 0x2c, 0xa, 0x21, 0x20,
+    0x9, 0x0, 0xff, 0xcc, 0x0, 0x90, 0x1, 0x98,
+    0x18, 0x3, 0xff, 0x48, 0x11, 0x80, 0x54, 0x2,
+    0xc0, 0x1f, 0xe6, 0x10, 0xb0, 0xc, 0xc2, 0x16,
+    0x1, 0xfe, 0xb0, 0x16, 0x0, 0xe6, 0x2, 0x40,
+    0xf, 0xc8, 0x40, 0xc0, 0x1e, 0x90, 0x7, 0x80,
+    0x7e, 0xf0, 0x6, 0x99, 0xf8, 0x8c, 0x10, 0xc0,
+    0x3c, 0x48, 0x0, 0xac, 0xcf, 0x8c, 0x1, 0x20,
+    0x1e, 0xb0, 0xf, 0xfe, 0x12, 0x88, 0x6, 0x16,
+    0x3, 0xff, 0xff, 0x50, 0x2, 0x40, 0x33, 0x0,
+    0x24, 0x3, 0xfc, 0xa2, 0xc, 0x1, 0xa4, 0x5,
+    0x40, 0x3f, 0xe6, 0x1, 0x60, 0x2, 0x88, 0x30,
+    0x7, 0xfe, 0x90, 0x5, 0x80, 0x24, 0x1, 0x20,
+    0x1f, 0xf8, 0x54, 0x9, 0x0,
 
     /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x33,
-    0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4,
+    0x0, 0xff, 0xd1, 0xfe, 0xb0, 0xf, 0xfe, 0x2b,
+    0xb8, 0x1a, 0xc0, 0x3f, 0xf8, 0x8d, 0x1, 0x12,
+    0x1, 0xff, 0xc4, 0x69, 0xb, 0x70, 0xf, 0xfe,
+    0x2b, 0x7f, 0x90, 0x3, 0xff, 0x8c, 0xdf, 0xed,
+    0x0, 0xff, 0xe3, 0x58, 0x0, 0x90, 0x3, 0xff,
+    0x88, 0x84, 0x1, 0x78, 0x7, 0xff, 0x13, 0xc0,
+    0x58, 0x10, 0x80, 0x3f, 0xf8, 0x44, 0x80, 0xd0,
+    0x0, 0x80, 0xf, 0xfe, 0x15, 0x80, 0x24, 0x54,
+    0x14, 0x40, 0x3f, 0xf0, 0xb0, 0x28, 0x84, 0x80,
+    0x24, 0x3, 0xff, 0x30, 0x2, 0x40, 0x6, 0x60,
+    0x60, 0xf, 0xfd, 0x20, 0x46, 0x1, 0x50, 0xb,
+    0x0, 0x7f, 0x98, 0x42, 0xc0, 0x33, 0x8, 0x58,
+    0x7, 0xfa, 0xc0, 0x58, 0x3, 0x98, 0x9, 0x0,
+    0x3f, 0x21, 0x3, 0x0, 0x7a, 0x40, 0x1e, 0x1,
+    0xfb, 0xc0, 0x1a, 0x67, 0xe2, 0x30, 0x43, 0x0,
+    0xf1, 0x20, 0x2, 0xb3, 0x3e, 0x30, 0x4, 0x80,
+    0x7a, 0xc0, 0x3f, 0xf8, 0x4a, 0x20, 0x18, 0x58,
+    0xf, 0xff, 0xfd, 0x40, 0x9, 0x0, 0xcc, 0x0,
+    0x90, 0xf, 0xf2, 0x88, 0x30, 0x6, 0x90, 0x15,
+    0x0, 0xff, 0x98, 0x5, 0x80, 0xa, 0x20, 0xc0,
+    0x1f, 0xfa, 0x40, 0x16, 0x0, 0x90, 0x4, 0x80,
+    0x7f, 0xe1, 0x50, 0x24,
 
     /* U+00C2 "Â" */
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfd, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0x50, 0xbf, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf4, 0x0, 0xa,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x33,
-    0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4,
+    0x0, 0xfe, 0x8f, 0xf7, 0x8, 0x7, 0xff, 0x11,
+    0xdc, 0x4, 0x38, 0x20, 0x1f, 0xfc, 0x26, 0x80,
+    0xad, 0x42, 0xd0, 0xf, 0xfe, 0xa, 0xc8, 0x5a,
+    0x85, 0xa9, 0xe0, 0x7, 0xfe, 0x5f, 0xf2, 0x0,
+    0x55, 0xf8, 0x1, 0xff, 0xc3, 0x6f, 0xf6, 0x80,
+    0x7f, 0xf1, 0xac, 0x0, 0x48, 0x1, 0xff, 0xc4,
+    0x42, 0x0, 0xbc, 0x3, 0xff, 0x89, 0xe0, 0x2c,
+    0x8, 0x40, 0x1f, 0xfc, 0x22, 0x40, 0x68, 0x0,
+    0x40, 0x7, 0xff, 0xa, 0xc0, 0x12, 0x2a, 0xa,
+    0x20, 0x1f, 0xf8, 0x58, 0x14, 0x42, 0x40, 0x12,
+    0x1, 0xff, 0x98, 0x1, 0x20, 0x3, 0x30, 0x30,
+    0x7, 0xfe, 0x90, 0x23, 0x0, 0xa8, 0x5, 0x80,
+    0x3f, 0xcc, 0x21, 0x60, 0x19, 0x84, 0x2c, 0x3,
+    0xfd, 0x60, 0x2c, 0x1, 0xcc, 0x4, 0x80, 0x1f,
+    0x90, 0x81, 0x80, 0x3d, 0x20, 0xf, 0x0, 0xfd,
+    0xe0, 0xd, 0x33, 0xf1, 0x18, 0x21, 0x80, 0x78,
+    0x90, 0x1, 0x59, 0x9f, 0x18, 0x2, 0x40, 0x3d,
+    0x60, 0x1f, 0xfc, 0x25, 0x10, 0xc, 0x2c, 0x7,
+    0xff, 0xfe, 0xa0, 0x4, 0x80, 0x66, 0x0, 0x48,
+    0x7, 0xf9, 0x44, 0x18, 0x3, 0x48, 0xa, 0x80,
+    0x7f, 0xcc, 0x2, 0xc0, 0x5, 0x10, 0x60, 0xf,
+    0xfd, 0x20, 0xb, 0x0, 0x48, 0x2, 0x40, 0x3f,
+    0xf0, 0xa8, 0x12, 0x0,
 
     /* U+00C3 "Ã" */
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xa1, 0x0, 0xad,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfb,
-    0xfd, 0x32, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0x50, 0x3d, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0x0, 0x0, 0x67,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x33,
-    0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4,
+    0x0, 0xf8, 0xf7, 0xe8, 0x40, 0x15, 0xa0, 0x1f,
+    0xfc, 0x1d, 0x24, 0x5c, 0x32, 0x57, 0x0, 0xff,
+    0xc8, 0x35, 0x78, 0x19, 0xa1, 0x0, 0x1f, 0xf9,
+    0xdc, 0xa0, 0x7b, 0x31, 0xa4, 0x1, 0xff, 0x8e,
+    0x0, 0x33, 0x39, 0x0, 0x7f, 0xf1, 0x1b, 0xfd,
+    0xa0, 0x1f, 0xfc, 0x6b, 0x0, 0x12, 0x0, 0x7f,
+    0xf1, 0x10, 0x80, 0x2f, 0x0, 0xff, 0xe2, 0x78,
+    0xb, 0x2, 0x10, 0x7, 0xff, 0x8, 0x90, 0x1a,
+    0x0, 0x10, 0x1, 0xff, 0xc2, 0xb0, 0x4, 0x8a,
+    0x82, 0x88, 0x7, 0xfe, 0x16, 0x5, 0x10, 0x90,
+    0x4, 0x80, 0x7f, 0xe6, 0x0, 0x48, 0x0, 0xcc,
+    0xc, 0x1, 0xff, 0xa4, 0x8, 0xc0, 0x2a, 0x1,
+    0x60, 0xf, 0xf3, 0x8, 0x58, 0x6, 0x61, 0xb,
+    0x0, 0xff, 0x58, 0xb, 0x0, 0x73, 0x1, 0x20,
+    0x7, 0xe4, 0x20, 0x60, 0xf, 0x48, 0x3, 0xc0,
+    0x3f, 0x78, 0x3, 0x4c, 0xfc, 0x46, 0x8, 0x60,
+    0x1e, 0x24, 0x0, 0x56, 0x67, 0xc6, 0x0, 0x90,
+    0xf, 0x58, 0x7, 0xff, 0x9, 0x44, 0x3, 0xb,
+    0x1, 0xff, 0xff, 0xa8, 0x1, 0x20, 0x19, 0x80,
+    0x12, 0x1, 0xfe, 0x51, 0x6, 0x0, 0xd2, 0x2,
+    0xa0, 0x1f, 0xf3, 0x0, 0xb0, 0x1, 0x44, 0x18,
+    0x3, 0xff, 0x48, 0x2, 0xc0, 0x12, 0x0, 0x90,
+    0xf, 0xfc, 0x2a, 0x4, 0x80,
 
     /* U+00C4 "Ä" */
-    0x0, 0x0, 0x0, 0x4, 0xd8, 0x0, 0x2c, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xfa, 0x0, 0x3e, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x3f,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x33,
-    0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
-    0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf4,
+    0x0, 0xf9, 0x36, 0x0, 0x5, 0x94, 0x1, 0xff,
+    0xc2, 0xf2, 0x70, 0x5, 0x1a, 0x98, 0x7, 0xff,
+    0x7, 0x81, 0x40, 0x16, 0x26, 0x60, 0xf, 0xfe,
+    0xa, 0xfd, 0x0, 0xf, 0xb0, 0x3, 0xff, 0xb4,
+    0xdf, 0xed, 0x0, 0xff, 0xe3, 0x58, 0x0, 0x90,
+    0x3, 0xff, 0x88, 0x84, 0x1, 0x78, 0x7, 0xff,
+    0x13, 0xc0, 0x58, 0x10, 0x80, 0x3f, 0xf8, 0x44,
+    0x80, 0xd0, 0x0, 0x80, 0xf, 0xfe, 0x15, 0x80,
+    0x24, 0x54, 0x14, 0x40, 0x3f, 0xf0, 0xb0, 0x28,
+    0x84, 0x80, 0x24, 0x3, 0xff, 0x30, 0x2, 0x40,
+    0x6, 0x60, 0x60, 0xf, 0xfd, 0x20, 0x46, 0x1,
+    0x50, 0xb, 0x0, 0x7f, 0x98, 0x42, 0xc0, 0x33,
+    0x8, 0x58, 0x7, 0xfa, 0xc0, 0x58, 0x3, 0x98,
+    0x9, 0x0, 0x3f, 0x21, 0x3, 0x0, 0x7a, 0x40,
+    0x1e, 0x1, 0xfb, 0xc0, 0x1a, 0x67, 0xe2, 0x30,
+    0x43, 0x0, 0xf1, 0x20, 0x2, 0xb3, 0x3e, 0x30,
+    0x4, 0x80, 0x7a, 0xc0, 0x3f, 0xf8, 0x4a, 0x20,
+    0x18, 0x58, 0xf, 0xff, 0xfd, 0x40, 0x9, 0x0,
+    0xcc, 0x0, 0x90, 0xf, 0xf2, 0x88, 0x30, 0x6,
+    0x90, 0x15, 0x0, 0xff, 0x98, 0x5, 0x80, 0xa,
+    0x20, 0xc0, 0x1f, 0xfa, 0x40, 0x16, 0x0, 0x90,
+    0x4, 0x80, 0x7f, 0xe1, 0x50, 0x24,
 
     /* U+00C5 "Å" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xef, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0x64, 0xcc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb8, 0x0, 0x1f,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc7, 0x0, 0xf, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7e, 0x20, 0x9e, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xe9, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0x81, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x10,
-    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfa, 0x0, 0x3f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0xc, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xd0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf5, 0x33, 0x33, 0x33, 0x3c, 0xff,
-    0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x60, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xd0, 0xc, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf4,
+    0x0, 0xff, 0xe9, 0xb7, 0x7d, 0x8, 0x7, 0xff,
+    0x11, 0x66, 0x2d, 0xb4, 0x3, 0xff, 0x89, 0xce,
+    0xc9, 0xa6, 0x60, 0xf, 0xfe, 0x1b, 0xf8, 0x0,
+    0x41, 0xc0, 0x3f, 0xf8, 0x77, 0x24, 0x12, 0x28,
+    0x1, 0xff, 0xc3, 0x77, 0x6f, 0xa6, 0x80, 0x7f,
+    0xf1, 0x67, 0xfb, 0x4c, 0x3, 0xff, 0x8e, 0x20,
+    0x1f, 0xfc, 0x76, 0xff, 0x68, 0x7, 0xff, 0x1a,
+    0xc0, 0x4, 0x80, 0x1f, 0xfc, 0x44, 0x20, 0xb,
+    0xc0, 0x3f, 0xf8, 0x9e, 0x2, 0xc0, 0x84, 0x1,
+    0xff, 0xc2, 0x24, 0x6, 0x80, 0x4, 0x0, 0x7f,
+    0xf0, 0xac, 0x1, 0x22, 0xa0, 0xa2, 0x1, 0xff,
+    0x85, 0x81, 0x44, 0x24, 0x1, 0x20, 0x1f, 0xf9,
+    0x80, 0x12, 0x0, 0x33, 0x3, 0x0, 0x7f, 0xe9,
+    0x2, 0x30, 0xa, 0x80, 0x58, 0x3, 0xfc, 0xc2,
+    0x16, 0x1, 0x98, 0x42, 0xc0, 0x3f, 0xd6, 0x2,
+    0xc0, 0x1c, 0xc0, 0x48, 0x1, 0xf9, 0x8, 0x18,
+    0x3, 0xd2, 0x0, 0xf0, 0xf, 0xde, 0x0, 0xd3,
+    0x3f, 0x11, 0x82, 0x18, 0x7, 0x89, 0x0, 0x15,
+    0x99, 0xf1, 0x80, 0x24, 0x3, 0xd6, 0x1, 0xff,
+    0xc2, 0x51, 0x0, 0xc2, 0xc0, 0x7f, 0xff, 0xea,
+    0x0, 0x48, 0x6, 0x60, 0x4, 0x80, 0x7f, 0x94,
+    0x41, 0x80, 0x34, 0x80, 0xa8, 0x7, 0xfc, 0xc0,
+    0x2c, 0x0, 0x51, 0x6, 0x0, 0xff, 0xd2, 0x0,
+    0xb0, 0x4, 0x80, 0x24, 0x3, 0xff, 0xa, 0x81,
+    0x20,
 
     /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0xbf, 0xf9, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x57, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xc0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf3, 0x7,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfa, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x10, 0x7, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x80, 0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x7, 0xff,
-    0x96, 0x66, 0x66, 0x66, 0x66, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x73, 0x33, 0x33, 0x9f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf7, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x7, 0xff, 0x97,
-    0x77, 0x77, 0x77, 0x77, 0x75, 0x2, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xbf, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc,
+    0x0, 0xff, 0xd5, 0xff, 0xff, 0xc3, 0x50, 0xf,
+    0xf8, 0xd4, 0x3, 0xff, 0x9f, 0xe0, 0x28, 0x0,
+    0x68, 0x8f, 0xf3, 0x80, 0x7f, 0x98, 0xc2, 0xf0,
+    0x1, 0xae, 0xff, 0xe2, 0x0, 0xfe, 0x18, 0x3,
+    0x50, 0xf, 0xfe, 0x64, 0x8, 0x78, 0x7, 0xff,
+    0x30, 0x98, 0x14, 0xc0, 0x3f, 0xf9, 0x92, 0x0,
+    0xb0, 0xf, 0xfe, 0x62, 0xa0, 0x38, 0x80, 0x7f,
+    0xf3, 0x20, 0x6, 0x0, 0x3d, 0x7f, 0xff, 0xc4,
+    0x1, 0xf3, 0x90, 0x58, 0x7, 0xff, 0x30, 0x60,
+    0xd, 0x40, 0x3e, 0x69, 0x9f, 0xe2, 0x0, 0xf5,
+    0x80, 0x2c, 0xcf, 0xb8, 0x1, 0xac, 0xdf, 0xc0,
+    0x1e, 0x35, 0x0, 0x46, 0x67, 0x30, 0x7, 0xff,
+    0x1b, 0xc0, 0x3f, 0xf9, 0xec, 0x61, 0x1f, 0xff,
+    0x40, 0x7, 0xff, 0x10, 0x60, 0x9, 0xc0, 0x3f,
+    0xf9, 0x90, 0x21, 0x20, 0x1f, 0xf6, 0xbb, 0xff,
+    0x94, 0x9, 0x81, 0x10, 0x1, 0xff, 0x34, 0x47,
+    0xfa, 0x42, 0x40, 0x12, 0x1, 0xff, 0xcc,
 
     /* U+00C7 "Ç" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xda, 0x50,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
-    0x89, 0xbf, 0xff, 0xf8, 0x0, 0x5, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x6, 0xef, 0xb0, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0x90, 0x0,
-    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x29, 0x0,
-    0x0, 0x5f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6e,
-    0xfb, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0xa8, 0x8a,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3,
-    0x8c, 0xff, 0xed, 0xa5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xfe, 0x91, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xa8, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8d, 0xfe, 0x91, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xc6, 0x77, 0xf6, 0xd2, 0x80, 0x7e,
+    0x2b, 0xc7, 0x31, 0x1, 0x25, 0xae, 0x50, 0xe,
+    0x5d, 0x40, 0x1, 0x2b, 0xb2, 0x0, 0x6, 0xa0,
+    0x2, 0x5a, 0x0, 0x26, 0x6d, 0x44, 0xdf, 0xc8,
+    0x81, 0x80, 0x6, 0x80, 0xf, 0x66, 0x1, 0xe6,
+    0xc6, 0xb0, 0x5, 0x80, 0x16, 0x0, 0x3f, 0x8a,
+    0x40, 0x2, 0xa0, 0xa, 0x0, 0xff, 0xe1, 0x20,
+    0x1, 0x80, 0x3f, 0xf8, 0x7a, 0x0, 0xc0, 0xf,
+    0xfe, 0x19, 0x0, 0x18, 0x3, 0xff, 0xac, 0x40,
+    0x6, 0x0, 0xff, 0xe1, 0xe8, 0x3, 0x0, 0x3f,
+    0xf8, 0x68, 0x0, 0x60, 0xf, 0xfe, 0x18, 0xa8,
+    0x2, 0x80, 0x3f, 0xf8, 0x76, 0x0, 0x58, 0x0,
+    0xfe, 0x29, 0x0, 0x86, 0x80, 0xf, 0x66, 0x1,
+    0xe6, 0xc6, 0xb0, 0x9, 0x68, 0x0, 0x99, 0xb5,
+    0x10, 0xaf, 0x91, 0x3, 0x0, 0xcb, 0xa6, 0x0,
+    0x25, 0x77, 0x28, 0x0, 0x6a, 0x0, 0x38, 0xb3,
+    0xe, 0x60, 0x1, 0x25, 0xae, 0x50, 0xf, 0xc7,
+    0x18, 0x66, 0xed, 0xa5, 0x0, 0xff, 0xe0, 0x99,
+    0x48, 0x80, 0x7f, 0xf0, 0xed, 0x99, 0xa0, 0x1f,
+    0xfc, 0x34, 0x81, 0x30, 0xf, 0xfe, 0xc, 0x54,
+    0x58, 0xa0, 0x7, 0xff, 0x9, 0xdc, 0xad, 0x40,
+    0x1e,
 
     /* U+00C8 "È" */
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0xab, 0xfd, 0x40, 0x1f, 0xfa, 0xa0, 0x16,
+    0x40, 0x3f, 0xf3, 0xd0, 0x34, 0x0, 0x7f, 0xe5,
+    0xc1, 0x78, 0x0, 0xff, 0xc7, 0xdf, 0x0, 0x1e,
+    0x1f, 0xff, 0xfe, 0xe, 0x0, 0x7f, 0xf2, 0xa,
+    0x23, 0xfd, 0x20, 0x19, 0x9d, 0xff, 0xca, 0x1,
+    0xff, 0xff, 0x0, 0xfe, 0x4f, 0xff, 0xe9, 0x0,
+    0xff, 0xe4, 0x94, 0xcf, 0xf5, 0x0, 0x73, 0x37,
+    0xf8, 0xc0, 0x3f, 0xff, 0x2c, 0xef, 0xff, 0x8,
+    0x4, 0x51, 0x1f, 0xf1, 0x80, 0x7f, 0xf1, 0x0,
 
     /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0xfc, 0x3b, 0xfe, 0x70, 0xf, 0xfb, 0x48,
+    0x2d, 0xc0, 0x3f, 0xd8, 0x63, 0xa8, 0x1, 0xfe,
+    0xb3, 0x37, 0x90, 0x7, 0xfd, 0x7f, 0x82, 0x1,
+    0xe1, 0xff, 0xff, 0xe0, 0xe0, 0x7, 0xff, 0x20,
+    0xa2, 0x3f, 0xd2, 0x1, 0x99, 0xdf, 0xfc, 0xa0,
+    0x1f, 0xff, 0xf0, 0xf, 0xe4, 0xff, 0xfe, 0x90,
+    0xf, 0xfe, 0x49, 0x4c, 0xff, 0x50, 0x7, 0x33,
+    0x7f, 0x8c, 0x3, 0xff, 0xf2, 0xce, 0xff, 0xf0,
+    0x80, 0x45, 0x11, 0xff, 0x18, 0x7, 0xff, 0x10,
 
     /* U+00CA "Ê" */
-    0x0, 0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xd1, 0x3e, 0xf7, 0x0, 0x0,
-    0x0, 0xa, 0xfc, 0x10, 0x2, 0xef, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0xf6, 0x7f, 0xa8, 0x3, 0xfe, 0xc3, 0x10,
+    0x59, 0x0, 0xfe, 0xb3, 0x2f, 0xc1, 0x67, 0x0,
+    0xfa, 0x90, 0xf0, 0x4f, 0x6, 0x18, 0x3, 0xd5,
+    0xf8, 0x20, 0x2, 0xef, 0x60, 0x8, 0x7f, 0xff,
+    0xf8, 0x38, 0x1, 0xff, 0xc8, 0x28, 0x8f, 0xf4,
+    0x80, 0x66, 0x77, 0xff, 0x28, 0x7, 0xff, 0xfc,
+    0x3, 0xf9, 0x3f, 0xff, 0xa4, 0x3, 0xff, 0x92,
+    0x53, 0x3f, 0xd4, 0x1, 0xcc, 0xdf, 0xe3, 0x0,
+    0xff, 0xfc, 0xb3, 0xbf, 0xfc, 0x20, 0x11, 0x44,
+    0x7f, 0xc6, 0x1, 0xff, 0xc4,
 
     /* U+00CB "Ë" */
-    0x0, 0x0, 0x9d, 0x30, 0x6, 0xd6, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x40, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x0, 0xd3, 0xa6, 0x0, 0x6d, 0x60, 0xf, 0x85,
+    0x8a, 0x40, 0x10, 0x56, 0x1, 0xf0, 0xa0, 0x70,
+    0x1, 0x82, 0x80, 0x3f, 0x5f, 0xa0, 0x2, 0x3d,
+    0xc0, 0x3f, 0xf9, 0x3, 0xff, 0xff, 0xc1, 0xc0,
+    0xf, 0xfe, 0x41, 0x44, 0x7f, 0xa4, 0x3, 0x33,
+    0xbf, 0xf9, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xc9,
+    0xff, 0xfd, 0x20, 0x1f, 0xfc, 0x92, 0x99, 0xfe,
+    0xa0, 0xe, 0x66, 0xff, 0x18, 0x7, 0xff, 0xe5,
+    0x9d, 0xff, 0xe1, 0x0, 0x8a, 0x23, 0xfe, 0x30,
+    0xf, 0xfe, 0x20,
 
     /* U+00CC "Ì" */
-    0x4e, 0xfe, 0x20, 0x0, 0x2, 0xdf, 0xe2, 0x0,
-    0x0, 0x1c, 0xfe, 0x10, 0x0, 0x0, 0xaf, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x1, 0xff, 0xb0,
+    0x4e, 0xfe, 0x20, 0x9, 0x30, 0x87, 0x8, 0x2,
+    0x2c, 0x31, 0xc1, 0x0, 0x87, 0x14, 0x70, 0x40,
+    0x35, 0x7e, 0x88, 0x4, 0x3f, 0xeb, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xff, 0xc0, 0x20,
 
     /* U+00CD "Í" */
-    0x0, 0x6, 0xff, 0xc1, 0x0, 0x6f, 0xfa, 0x0,
-    0x5, 0xff, 0x80, 0x0, 0x4f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x9b, 0xfd, 0x82, 0x0, 0x69, 0x5, 0xc1,
+    0x5, 0x90, 0x7a, 0x0, 0x25, 0x4, 0xc0, 0x4,
+    0x9f, 0xe6, 0x0, 0xc3, 0xfe, 0xb0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xfc, 0x3, 0xc0,
 
     /* U+00CE "Î" */
-    0x0, 0x6, 0xff, 0xe2, 0x0, 0x0, 0x5, 0xff,
-    0xdf, 0xe2, 0x0, 0x4, 0xff, 0x60, 0xaf, 0xd1,
-    0x3, 0xff, 0x50, 0x0, 0x9f, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0,
+    0x0, 0x9b, 0xfd, 0xc4, 0x1, 0xcb, 0x20, 0x43,
+    0x84, 0x1, 0x25, 0x4, 0xea, 0x8f, 0x88, 0x1d,
+    0x85, 0x30, 0x53, 0x16, 0x9, 0xff, 0x94, 0x2,
+    0x9f, 0xd1, 0x0, 0x87, 0xfd, 0x60, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xcc,
 
     /* U+00CF "Ï" */
-    0x3d, 0x90, 0x1, 0xcb, 0xa, 0xff, 0x10, 0x7f,
-    0xf5, 0x4e, 0xb0, 0x2, 0xed, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb,
-    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x1, 0xff,
-    0xb0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x1,
-    0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
+    0x3d, 0x90, 0x0, 0xe5, 0x84, 0x93, 0x8, 0x31,
+    0xa2, 0xf0, 0xa0, 0x82, 0x89, 0x22, 0x3a, 0xc0,
+    0x5, 0xda, 0x20, 0x1f, 0xf0, 0xff, 0xac, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xff, 0x0, 0xff, 0xe6,
     0x0,
 
     /* U+00D0 "Ð" */
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x77, 0x77, 0x77, 0x9b, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x0, 0x1, 0x7f, 0xff, 0xb0, 0x0, 0x0, 0xd,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0x70, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x10, 0x0, 0xd, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xb0, 0x0, 0xd, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0x2, 0x33,
-    0xff, 0xf3, 0x33, 0x33, 0x10, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfb, 0x0, 0x0, 0xdf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x70, 0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf7, 0x0,
-    0x0, 0xd, 0xff, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x77,
-    0x77, 0x79, 0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xda, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0xb7, 0xff, 0xfb, 0x69, 0x40, 0x3f, 0xf9,
+    0x4, 0xb5, 0xcc, 0x1, 0xff, 0x44, 0x79, 0x90,
+    0x0, 0x33, 0x60, 0x1f, 0xe7, 0x7f, 0x4d, 0xf4,
+    0x0, 0x12, 0xc0, 0x3f, 0xf8, 0xa2, 0xfa, 0x20,
+    0x8e, 0x1, 0xff, 0xc6, 0x2d, 0x0, 0x40, 0x80,
+    0x7f, 0xf1, 0x8d, 0x80, 0xc, 0x1, 0xff, 0xc7,
+    0xa0, 0x6, 0x0, 0x7f, 0xf1, 0xcc, 0x0, 0xa1,
+    0x7f, 0xe2, 0x0, 0x7f, 0xf4, 0x0, 0x7c, 0x40,
+    0x20, 0x1f, 0xfc, 0xc9, 0xcc, 0x0, 0x59, 0x9d,
+    0x20, 0x1f, 0x10, 0x8, 0x11, 0x98, 0x80, 0x6,
+    0x7c, 0x20, 0x1e, 0x30, 0x2, 0x80, 0x7f, 0xf1,
+    0xe8, 0x1, 0x80, 0x1f, 0xfc, 0x63, 0x60, 0x3,
+    0x0, 0x7f, 0xf1, 0x4b, 0x40, 0x10, 0x20, 0x1f,
+    0xfc, 0x31, 0x7d, 0x10, 0x47, 0x0, 0xfc, 0xef,
+    0xe9, 0xbe, 0x80, 0x2, 0x58, 0x7, 0xf4, 0x47,
+    0x99, 0x0, 0x3, 0x36, 0x1, 0xff, 0xc5, 0x25,
+    0xae, 0x60, 0xe,
 
     /* U+00D1 "Ñ" */
-    0x0, 0x0, 0x2, 0xcf, 0xb1, 0x0, 0x8f, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfb, 0xfe, 0x42, 0xeb,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0x60, 0x2d, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x28, 0x10, 0x0,
-    0x57, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x1f, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xfc, 0x1f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xf, 0xfc, 0x1f, 0xfc, 0xdf, 0xf9, 0x0, 0x0,
-    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x2f, 0xff, 0x50,
-    0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x5, 0xff,
-    0xf2, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
-    0x9f, 0xfd, 0x10, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
-    0x0, 0xc, 0xff, 0xb0, 0x0, 0xf, 0xfc, 0x1f,
-    0xfb, 0x0, 0x1, 0xef, 0xf8, 0x0, 0xf, 0xfc,
-    0x1f, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0x40, 0xf,
-    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0xaf,
-    0xfd, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xaf, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xfc, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfc, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc, 0x1f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfc,
+    0x0, 0xe2, 0xcf, 0xb1, 0x0, 0x47, 0x80, 0x7f,
+    0x79, 0xa2, 0x3d, 0x9, 0x90, 0x3, 0xf1, 0x94,
+    0xde, 0x9d, 0xe8, 0xc0, 0x7, 0xe1, 0x77, 0x1,
+    0x6d, 0x46, 0x98, 0x7, 0xe2, 0x81, 0x0, 0x95,
+    0xc8, 0x3, 0x87, 0xfd, 0x40, 0x1f, 0xf7, 0xfb,
+    0x0, 0x25, 0x60, 0xf, 0xfe, 0x2c, 0x98, 0x7,
+    0xff, 0x17, 0x44, 0x3, 0xff, 0x88, 0x3a, 0x1,
+    0xff, 0xc2, 0x32, 0x3, 0x90, 0xf, 0xfe, 0xb,
+    0xf8, 0x1, 0x94, 0x3, 0xff, 0x82, 0x54, 0x0,
+    0xa2, 0x0, 0xff, 0xe0, 0xab, 0x0, 0x3c, 0x40,
+    0x3f, 0xf8, 0x32, 0x60, 0x54, 0x1, 0xff, 0xc2,
+    0xd1, 0x4, 0x80, 0xf, 0xfe, 0x8, 0xe8, 0x1,
+    0xd0, 0x3, 0xff, 0x82, 0x72, 0x0, 0xb2, 0x0,
+    0xff, 0xe0, 0xb2, 0x80, 0x3c, 0x3, 0xff, 0x85,
+    0x46, 0x5, 0x40, 0x1f, 0xfc, 0x2e, 0x10, 0x50,
+    0xf, 0xfe, 0x11, 0x50, 0x7, 0xff, 0x15, 0x20,
+    0x3, 0xff, 0x8a, 0xea, 0x1, 0xff, 0xc5, 0xa2,
+    0x0,
 
     /* U+00D2 "Ò" */
-    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2d, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89,
-    0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xf5, 0x7f, 0xa4, 0x3, 0xff, 0x8d, 0x54,
+    0x6, 0xa0, 0xf, 0xfe, 0x32, 0xe9, 0x2d, 0x80,
+    0x7f, 0xf1, 0x8b, 0x60, 0xd0, 0x3, 0xff, 0x8e,
+    0xf0, 0x80, 0x1f, 0xfc, 0x33, 0x8c, 0xef, 0xf6,
+    0xd3, 0x0, 0x7f, 0xc5, 0x78, 0xe6, 0x20, 0x2,
+    0x59, 0xe7, 0x0, 0xfc, 0xba, 0x80, 0x2, 0x57,
+    0x64, 0x0, 0xc, 0x58, 0x80, 0x72, 0x50, 0x1,
+    0x33, 0x6a, 0x26, 0xfe, 0x40, 0x9, 0xa0, 0x18,
+    0x68, 0x0, 0xf6, 0x60, 0x1e, 0x6d, 0x20, 0x39,
+    0x0, 0xa0, 0x41, 0x60, 0x3, 0xf8, 0xbc, 0x0,
+    0xc4, 0x2, 0xc0, 0xa, 0x0, 0xff, 0x8a, 0x0,
+    0x16, 0x8, 0x0, 0x60, 0xf, 0xfe, 0xb, 0x0,
+    0x10, 0x34, 0x1, 0x80, 0x1f, 0xfc, 0x11, 0x20,
+    0x20, 0x20, 0x3, 0x0, 0x7f, 0xf0, 0x98, 0x0,
+    0x40, 0x1f, 0xfc, 0xa2, 0x0, 0x30, 0x7, 0xff,
+    0x9, 0x80, 0x5, 0xa0, 0xc, 0x0, 0xff, 0xe0,
+    0x89, 0x1, 0x2, 0x0, 0x18, 0x3, 0xff, 0x82,
+    0xc0, 0x4, 0x1, 0x60, 0x5, 0x0, 0x7f, 0xc5,
+    0x0, 0xb, 0x0, 0x40, 0x82, 0xc0, 0x7, 0xf1,
+    0x78, 0x1, 0x88, 0x0, 0x34, 0x0, 0x7b, 0x30,
+    0xf, 0x36, 0x90, 0x1c, 0x80, 0x64, 0xa0, 0x2,
+    0x66, 0xd4, 0x4d, 0xfc, 0x80, 0xf, 0x40, 0x3c,
+    0xba, 0x80, 0x2, 0x57, 0x64, 0x0, 0xa3, 0x4,
+    0x3, 0xe2, 0xbc, 0x73, 0x10, 0x1, 0x2c, 0xfb,
+    0x80, 0x70,
 
     /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xe4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x84, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89,
-    0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0x8b, 0xbf, 0x90, 0x3, 0xff, 0x88,
+    0x78, 0x27, 0xe8, 0x1, 0xff, 0xc3, 0x4c, 0x17,
+    0xc1, 0x0, 0xff, 0xe2, 0x1b, 0xdc, 0x0, 0x7f,
+    0xf1, 0x9e, 0x10, 0x3, 0xff, 0x88, 0x71, 0x9d,
+    0xfe, 0xda, 0x60, 0xf, 0xf8, 0xaf, 0x1c, 0xc4,
+    0x0, 0x4b, 0x3c, 0xe0, 0x1f, 0x97, 0x50, 0x0,
+    0x4a, 0xec, 0x80, 0x1, 0x8b, 0x10, 0xe, 0x4a,
+    0x0, 0x26, 0x6d, 0x44, 0xdf, 0xc8, 0x1, 0x34,
+    0x3, 0xd, 0x0, 0x1e, 0xcc, 0x3, 0xcd, 0xa4,
+    0x7, 0x20, 0x14, 0x8, 0x2c, 0x0, 0x7f, 0x17,
+    0x80, 0x18, 0x80, 0x58, 0x1, 0x40, 0x1f, 0xf1,
+    0x40, 0x2, 0xc1, 0x0, 0xc, 0x1, 0xff, 0xc1,
+    0x60, 0x2, 0x6, 0x80, 0x30, 0x3, 0xff, 0x82,
+    0x24, 0x4, 0x4, 0x0, 0x60, 0xf, 0xfe, 0x13,
+    0x0, 0x8, 0x3, 0xff, 0x94, 0x40, 0x6, 0x0,
+    0xff, 0xe1, 0x30, 0x0, 0xb4, 0x1, 0x80, 0x1f,
+    0xfc, 0x11, 0x20, 0x20, 0x40, 0x3, 0x0, 0x7f,
+    0xf0, 0x58, 0x0, 0x80, 0x2c, 0x0, 0xa0, 0xf,
+    0xf8, 0xa0, 0x1, 0x60, 0x8, 0x10, 0x58, 0x0,
+    0xfe, 0x2f, 0x0, 0x31, 0x0, 0x6, 0x80, 0xf,
+    0x66, 0x1, 0xe6, 0xd2, 0x3, 0x90, 0xc, 0x94,
+    0x0, 0x4c, 0xda, 0x89, 0xbf, 0x90, 0x1, 0xe8,
+    0x7, 0x97, 0x50, 0x0, 0x4a, 0xec, 0x80, 0x14,
+    0x60, 0x80, 0x7c, 0x57, 0x8e, 0x62, 0x0, 0x25,
+    0x9f, 0x70, 0xe,
 
     /* U+00D4 "Ô" */
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xae, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3e, 0xf7, 0x1, 0xcf, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x40, 0x0, 0x7,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89,
-    0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xfc, 0x5d, 0xfe, 0x90, 0xf, 0xfe, 0x21,
+    0x60, 0xa8, 0xb5, 0x0, 0x7f, 0xf0, 0x8f, 0x6,
+    0x2b, 0xcd, 0x6c, 0x3, 0xff, 0x82, 0x8d, 0x6e,
+    0x3, 0x90, 0x68, 0x1, 0xff, 0x9e, 0x10, 0x3,
+    0x3c, 0x20, 0x7, 0xfe, 0x38, 0xce, 0xff, 0x6d,
+    0x30, 0x7, 0xfc, 0x57, 0x8e, 0x62, 0x0, 0x25,
+    0x9e, 0x70, 0xf, 0xcb, 0xa8, 0x0, 0x25, 0x76,
+    0x40, 0x0, 0xc5, 0x88, 0x7, 0x25, 0x0, 0x13,
+    0x36, 0xa2, 0x6f, 0xe4, 0x0, 0x9a, 0x1, 0x86,
+    0x80, 0xf, 0x66, 0x1, 0xe6, 0xd2, 0x3, 0x90,
+    0xa, 0x4, 0x16, 0x0, 0x3f, 0x8b, 0xc0, 0xc,
+    0x40, 0x2c, 0x0, 0xa0, 0xf, 0xf8, 0xa0, 0x1,
+    0x60, 0x80, 0x6, 0x0, 0xff, 0xe0, 0xb0, 0x1,
+    0x3, 0x40, 0x18, 0x1, 0xff, 0xc1, 0x12, 0x2,
+    0x2, 0x0, 0x30, 0x7, 0xff, 0x9, 0x80, 0x4,
+    0x1, 0xff, 0xca, 0x20, 0x3, 0x0, 0x7f, 0xf0,
+    0x98, 0x0, 0x5a, 0x0, 0xc0, 0xf, 0xfe, 0x8,
+    0x90, 0x10, 0x20, 0x1, 0x80, 0x3f, 0xf8, 0x2c,
+    0x0, 0x40, 0x16, 0x0, 0x50, 0x7, 0xfc, 0x50,
+    0x0, 0xb0, 0x4, 0x8, 0x2c, 0x0, 0x7f, 0x17,
+    0x80, 0x18, 0x80, 0x3, 0x40, 0x7, 0xb3, 0x0,
+    0xf3, 0x69, 0x1, 0xc8, 0x6, 0x4a, 0x0, 0x26,
+    0x6d, 0x44, 0xdf, 0xc8, 0x0, 0xf4, 0x3, 0xcb,
+    0xa8, 0x0, 0x25, 0x76, 0x40, 0xa, 0x30, 0x40,
+    0x3e, 0x2b, 0xc7, 0x31, 0x0, 0x12, 0xcf, 0xb8,
+    0x7,
 
     /* U+00D5 "Õ" */
-    0x0, 0x0, 0x0, 0x8, 0xed, 0x50, 0x1, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xdd,
-    0xf8, 0x18, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcd, 0x0, 0x8f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x75, 0x0, 0x2, 0x75,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89,
-    0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xfa, 0x3b, 0x54, 0x0, 0x3e, 0xc0, 0x1f,
+    0xf9, 0x9c, 0xc2, 0xa0, 0x64, 0x14, 0x3, 0xff,
+    0x51, 0x6e, 0x9d, 0xdc, 0xea, 0x60, 0x1f, 0xfa,
+    0xe0, 0x1, 0x1b, 0x15, 0x40, 0xf, 0xfe, 0xb,
+    0xa8, 0x4, 0x4e, 0xa0, 0x1f, 0xfc, 0x23, 0x8c,
+    0xef, 0xf6, 0xd3, 0x0, 0x7f, 0xc5, 0x78, 0xe6,
+    0x20, 0x2, 0x59, 0xe7, 0x0, 0xfc, 0xba, 0x80,
+    0x2, 0x57, 0x64, 0x0, 0xc, 0x58, 0x80, 0x72,
+    0x50, 0x1, 0x33, 0x6a, 0x26, 0xfe, 0x40, 0x9,
+    0xa0, 0x18, 0x68, 0x0, 0xf6, 0x60, 0x1e, 0x6d,
+    0x20, 0x39, 0x0, 0xa0, 0x41, 0x60, 0x3, 0xf8,
+    0xbc, 0x0, 0xc4, 0x2, 0xc0, 0xa, 0x0, 0xff,
+    0x8a, 0x0, 0x16, 0x8, 0x0, 0x60, 0xf, 0xfe,
+    0xb, 0x0, 0x10, 0x34, 0x1, 0x80, 0x1f, 0xfc,
+    0x11, 0x20, 0x20, 0x20, 0x3, 0x0, 0x7f, 0xf0,
+    0x98, 0x0, 0x40, 0x1f, 0xfc, 0xa2, 0x0, 0x30,
+    0x7, 0xff, 0x9, 0x80, 0x5, 0xa0, 0xc, 0x0,
+    0xff, 0xe0, 0x89, 0x1, 0x2, 0x0, 0x18, 0x3,
+    0xff, 0x82, 0xc0, 0x4, 0x1, 0x60, 0x5, 0x0,
+    0x7f, 0xc5, 0x0, 0xb, 0x0, 0x40, 0x82, 0xc0,
+    0x7, 0xf1, 0x78, 0x1, 0x88, 0x0, 0x34, 0x0,
+    0x7b, 0x30, 0xf, 0x36, 0x90, 0x1c, 0x80, 0x64,
+    0xa0, 0x2, 0x66, 0xd4, 0x4d, 0xfc, 0x80, 0xf,
+    0x40, 0x3c, 0xba, 0x80, 0x2, 0x57, 0x64, 0x0,
+    0xa3, 0x4, 0x3, 0xe2, 0xbc, 0x73, 0x10, 0x1,
+    0x2c, 0xfb, 0x80, 0x70,
 
     /* U+00D6 "Ö" */
-    0x0, 0x0, 0x0, 0xa, 0xc2, 0x0, 0x7d, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
-    0x0, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xe3, 0x0, 0x9f, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x8f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2,
-    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89,
-    0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xfa, 0xb0, 0x80, 0xf, 0xa8, 0x1, 0xff,
+    0xc1, 0x35, 0x3a, 0x0, 0x41, 0x40, 0x7, 0xff,
+    0x4, 0xcc, 0x36, 0x0, 0x60, 0xa0, 0xf, 0xfe,
+    0x16, 0x71, 0x80, 0x27, 0xd8, 0x3, 0xff, 0xae,
+    0x71, 0x9d, 0xfe, 0xda, 0x60, 0xf, 0xf8, 0xaf,
+    0x1c, 0xc4, 0x0, 0x4b, 0x3c, 0xe0, 0x1f, 0x97,
+    0x50, 0x0, 0x4a, 0xec, 0x80, 0x1, 0x8b, 0x10,
+    0xe, 0x4a, 0x0, 0x26, 0x6d, 0x44, 0xdf, 0xc8,
+    0x1, 0x34, 0x3, 0xd, 0x0, 0x1e, 0xcc, 0x3,
+    0xcd, 0xa4, 0x7, 0x20, 0x14, 0x8, 0x2c, 0x0,
+    0x7f, 0x17, 0x80, 0x18, 0x80, 0x58, 0x1, 0x40,
+    0x1f, 0xf1, 0x40, 0x2, 0xc1, 0x0, 0xc, 0x1,
+    0xff, 0xc1, 0x60, 0x2, 0x6, 0x80, 0x30, 0x3,
+    0xff, 0x82, 0x24, 0x4, 0x4, 0x0, 0x60, 0xf,
+    0xfe, 0x13, 0x0, 0x8, 0x3, 0xff, 0x94, 0x40,
+    0x6, 0x0, 0xff, 0xe1, 0x30, 0x0, 0xb4, 0x1,
+    0x80, 0x1f, 0xfc, 0x11, 0x20, 0x20, 0x40, 0x3,
+    0x0, 0x7f, 0xf0, 0x58, 0x0, 0x80, 0x2c, 0x0,
+    0xa0, 0xf, 0xf8, 0xa0, 0x1, 0x60, 0x8, 0x10,
+    0x58, 0x0, 0xfe, 0x2f, 0x0, 0x31, 0x0, 0x6,
+    0x80, 0xf, 0x66, 0x1, 0xe6, 0xd2, 0x3, 0x90,
+    0xc, 0x94, 0x0, 0x4c, 0xda, 0x89, 0xbf, 0x90,
+    0x1, 0xe8, 0x7, 0x97, 0x50, 0x0, 0x4a, 0xec,
+    0x80, 0x14, 0x60, 0x80, 0x7c, 0x57, 0x8e, 0x62,
+    0x0, 0x25, 0x9f, 0x70, 0xe,
 
     /* U+00D7 "×" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xc2, 0x0,
-    0x0, 0xb, 0x50, 0xcf, 0xe2, 0x0, 0xb, 0xff,
-    0x12, 0xef, 0xe2, 0xb, 0xff, 0x60, 0x2, 0xef,
-    0xeb, 0xff, 0x60, 0x0, 0x2, 0xef, 0xff, 0x60,
-    0x0, 0x0, 0xb, 0xff, 0xe2, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xe2, 0x0, 0xa, 0xff, 0x63, 0xef,
-    0xe2, 0xa, 0xff, 0x60, 0x3, 0xef, 0xe1, 0x6f,
-    0x60, 0x0, 0x3, 0xea, 0x0, 0x30, 0x0, 0x0,
-    0x2, 0x0,
+    0x0, 0xff, 0x8b, 0x8, 0x3, 0xad, 0x43, 0x8f,
+    0x8, 0x2, 0xb4, 0xa1, 0xe1, 0x16, 0x10, 0x5a,
+    0x4, 0x89, 0x60, 0x8b, 0x2d, 0x2, 0x58, 0x0,
+    0x58, 0x22, 0x40, 0x96, 0x0, 0xc4, 0xa0, 0x1,
+    0x40, 0xe, 0xa4, 0x0, 0xe, 0x10, 0x5, 0x4a,
+    0x13, 0x82, 0x2c, 0x20, 0xa5, 0x9, 0x63, 0xd1,
+    0x16, 0xe, 0x4, 0xb0, 0x0, 0xf4, 0x50, 0x5b,
+    0x18, 0x3, 0x1e, 0x50, 0x0,
 
     /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0xaf, 0x80,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xda, 0x89, 0xbf, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x4f, 0xff, 0xb3, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x8, 0xfc, 0xdf, 0xf9, 0x0, 0x9, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x4f, 0xd0, 0x2f, 0xff, 0x20,
-    0x1f, 0xff, 0x0, 0x0, 0x0, 0x1, 0xef, 0x30,
-    0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0, 0x0, 0x0,
-    0xb, 0xf7, 0x0, 0x1, 0xff, 0xd0, 0x8f, 0xf5,
-    0x0, 0x0, 0x0, 0x6f, 0xc0, 0x0, 0x0, 0xdf,
-    0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x2, 0xff, 0x10,
-    0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3, 0x0, 0x0,
-    0xd, 0xf5, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x8f,
-    0xf5, 0x0, 0x0, 0x9f, 0xa0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x4, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f, 0xff, 0x0,
-    0x1e, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x90,
-    0x9, 0xff, 0xa0, 0xbf, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x20, 0x1, 0xef, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x0, 0x4f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xda, 0x89, 0xbf,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe2, 0x9f, 0xf0, 0x80, 0x7f, 0xf1,
+    0x47, 0x43, 0x44, 0x3, 0xe3, 0x8c, 0xef, 0xf6,
+    0xd3, 0x5, 0x8b, 0x98, 0x7, 0x8a, 0xf1, 0xcc,
+    0x40, 0x4, 0xb3, 0xea, 0x70, 0x1, 0xe5, 0xd4,
+    0x0, 0x12, 0xbb, 0x20, 0x6, 0x21, 0x0, 0xe4,
+    0xa0, 0x2, 0x66, 0xd4, 0x4d, 0xf0, 0x4, 0x3a,
+    0x1, 0x86, 0x80, 0xf, 0x66, 0x1, 0xd2, 0x6,
+    0x40, 0x72, 0x1, 0x40, 0x82, 0xc0, 0x7, 0x91,
+    0xcb, 0x3c, 0x0, 0xc4, 0x2, 0xc0, 0xa, 0x0,
+    0xf0, 0xd0, 0x70, 0x14, 0x0, 0x2c, 0x10, 0x0,
+    0xc0, 0x1f, 0x50, 0xc1, 0x80, 0x18, 0x0, 0x81,
+    0xa0, 0xc, 0x0, 0xf3, 0x21, 0xb8, 0x4, 0x24,
+    0x4, 0x4, 0x0, 0x60, 0xe, 0x29, 0xd, 0x0,
+    0xe6, 0x0, 0x10, 0x7, 0xf7, 0x85, 0x8, 0x7,
+    0xf1, 0x0, 0x18, 0x3, 0x49, 0x2a, 0x80, 0x3c,
+    0xc0, 0x2, 0xd0, 0x6, 0x0, 0x48, 0xc5, 0x40,
+    0x1e, 0x12, 0x2, 0x4, 0x0, 0x30, 0x0, 0x68,
+    0x38, 0x3, 0xe6, 0x0, 0x20, 0xb, 0x0, 0x28,
+    0x28, 0x60, 0xc0, 0x3c, 0x50, 0x0, 0xb0, 0x4,
+    0x8, 0x2f, 0xa2, 0x1c, 0x3, 0xc5, 0xe0, 0x6,
+    0x20, 0x0, 0xd0, 0x6, 0xe0, 0xf, 0x36, 0x90,
+    0x1c, 0x80, 0x64, 0xa0, 0xa, 0xb6, 0xa2, 0x6f,
+    0xe4, 0x0, 0x7a, 0x1, 0xec, 0x0, 0xc4, 0xae,
+    0xc8, 0x1, 0x46, 0x8, 0x7, 0x23, 0x17, 0xe3,
+    0x98, 0x80, 0x9, 0x67, 0xdc, 0x3, 0xc3, 0x41,
+    0xc0, 0x71, 0x9d, 0xfe, 0xda, 0x60, 0xf, 0xca,
+    0xd4, 0x60, 0x1f, 0xfc, 0x50,
 
     /* U+00D9 "Ù" */
-    0x0, 0x0, 0x6f, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xea, 0x88, 0xae, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
+    0x0, 0xcd, 0xfe, 0xd1, 0x0, 0xff, 0xe0, 0xb6,
+    0x91, 0x30, 0x80, 0x3f, 0xf8, 0x25, 0xaa, 0x58,
+    0x60, 0x1f, 0xfc, 0x2a, 0xa3, 0x20, 0x7, 0xff,
+    0xd, 0x61, 0xc0, 0x3e, 0x3f, 0xf4, 0x80, 0x7f,
+    0x9b, 0xfc, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0x90, 0x40, 0x6, 0x1, 0xfe,
+    0x10, 0x0, 0x90, 0x1, 0xc0, 0x3f, 0xda, 0x0,
+    0x60, 0x30, 0x22, 0x0, 0x7f, 0x20, 0x9, 0x5,
+    0x80, 0x20, 0x3, 0xf3, 0x88, 0x38, 0x1, 0xc4,
+    0x16, 0x40, 0x3c, 0xf0, 0x0, 0xb0, 0xa, 0x80,
+    0xd, 0xd5, 0x10, 0xae, 0x80, 0x5, 0x10, 0x4,
+    0x98, 0x20, 0x2a, 0xee, 0x51, 0x1, 0xb5, 0x0,
+    0xe3, 0xe9, 0x51, 0x0, 0xa, 0x4f, 0x20, 0x4,
 
     /* U+00DA "Ú" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xfe, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x86,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xea, 0x88, 0xae, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
+    0x0, 0xff, 0x5f, 0xfa, 0x0, 0x3f, 0xf0, 0xe2,
+    0xd, 0xc0, 0x7, 0xfc, 0x38, 0x66, 0xf4, 0x0,
+    0xff, 0xc8, 0xb3, 0x82, 0x1, 0xff, 0xc1, 0x58,
+    0x60, 0xf, 0xc7, 0xfe, 0x90, 0xf, 0xf3, 0x7f,
+    0x94, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff, 0x0,
+    0xff, 0xf2, 0x8, 0x0, 0xc0, 0x3f, 0xc2, 0x0,
+    0x12, 0x0, 0x38, 0x7, 0xfb, 0x40, 0xc, 0x6,
+    0x4, 0x40, 0xf, 0xe4, 0x1, 0x20, 0xb0, 0x4,
+    0x0, 0x7e, 0x71, 0x7, 0x0, 0x38, 0x82, 0xc8,
+    0x7, 0x9e, 0x0, 0x16, 0x1, 0x50, 0x1, 0xba,
+    0xa2, 0x15, 0xd0, 0x0, 0xa2, 0x0, 0x93, 0x4,
+    0x5, 0x5d, 0xca, 0x20, 0x36, 0xa0, 0x1c, 0x7d,
+    0x2a, 0x20, 0x1, 0x49, 0xe4, 0x0, 0x80,
 
     /* U+00DB "Û" */
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xdb, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1c, 0xfb, 0x0, 0x9f,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x58, 0x60, 0x0,
-    0x5, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xea, 0x88, 0xae, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
+    0x0, 0xfa, 0xff, 0xda, 0x20, 0x1f, 0xfa, 0xd0,
+    0x90, 0xb0, 0x40, 0x3f, 0x87, 0x11, 0x1b, 0x6c,
+    0x5e, 0x40, 0x1f, 0x91, 0x13, 0x60, 0x9, 0xa6,
+    0x40, 0xf, 0xcb, 0xc, 0x1, 0x96, 0x18, 0x3,
+    0x1f, 0xfa, 0x40, 0x3f, 0xcd, 0xfe, 0x50, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xc8,
+    0x20, 0x3, 0x0, 0xff, 0x8, 0x0, 0x48, 0x0,
+    0xe0, 0x1f, 0xed, 0x0, 0x30, 0x18, 0x11, 0x0,
+    0x3f, 0x90, 0x4, 0x82, 0xc0, 0x10, 0x1, 0xf9,
+    0xc4, 0x1c, 0x0, 0xe2, 0xb, 0x20, 0x1e, 0x78,
+    0x0, 0x58, 0x5, 0x40, 0x6, 0xea, 0x88, 0x57,
+    0x40, 0x2, 0x88, 0x2, 0x4c, 0x10, 0x15, 0x77,
+    0x28, 0x80, 0xda, 0x80, 0x71, 0xf4, 0xa8, 0x80,
+    0x5, 0x27, 0x90, 0x2,
 
     /* U+00DC "Ü" */
-    0x0, 0x0, 0x6, 0xd6, 0x0, 0x4d, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfd, 0x0, 0xbf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xf7, 0x0, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf5, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf4, 0xf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xf2, 0xc, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x7, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0x90, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x4f,
-    0xff, 0xea, 0x88, 0xae, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x60, 0x0,
-    0x0,
+    0x0, 0xe6, 0xd6, 0x0, 0x26, 0xc0, 0x7, 0xfa,
+    0xa, 0xc0, 0x1e, 0x4e, 0x20, 0x1f, 0xcc, 0x14,
+    0x0, 0xe0, 0x51, 0x0, 0xfe, 0x8f, 0x70, 0x2,
+    0xfd, 0x0, 0x7f, 0xf2, 0xcf, 0xfd, 0x20, 0x1f,
+    0xe6, 0xff, 0x28, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xe4, 0x10, 0x1, 0x80, 0x7f,
+    0x84, 0x0, 0x24, 0x0, 0x70, 0xf, 0xf6, 0x80,
+    0x18, 0xc, 0x8, 0x80, 0x1f, 0xc8, 0x2, 0x41,
+    0x60, 0x8, 0x0, 0xfc, 0xe2, 0xe, 0x0, 0x71,
+    0x5, 0x90, 0xf, 0x3c, 0x0, 0x2c, 0x2, 0xa0,
+    0x3, 0x75, 0x44, 0x2b, 0xa0, 0x1, 0x44, 0x1,
+    0x26, 0x8, 0xa, 0xbb, 0x94, 0x40, 0x6d, 0x40,
+    0x38, 0xfa, 0x54, 0x40, 0x2, 0x93, 0xc8, 0x1,
 
     /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xe0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x9f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
-    0x0, 0x1e, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0x0, 0x6, 0xff, 0x90, 0x0, 0x0,
-    0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0xdf, 0xf2,
-    0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfb, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x50, 0x1, 0xef, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x9,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf8, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xdf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xff, 0xab, 0xfd, 0x20, 0x1f, 0xfc, 0x3a,
+    0x50, 0x89, 0x0, 0xff, 0xe1, 0x4a, 0x85, 0xb8,
+    0x7, 0xff, 0xa, 0x18, 0x75, 0x0, 0x3f, 0xf8,
+    0x71, 0xfc, 0x40, 0x1f, 0xd9, 0xfe, 0x30, 0xf,
+    0xfb, 0x7f, 0x80, 0x1e, 0x0, 0xf0, 0xf, 0xf3,
+    0x90, 0x58, 0x0, 0xd8, 0xd, 0x80, 0x3f, 0xc,
+    0x2, 0x28, 0x5, 0x2, 0x10, 0x1, 0xfa, 0xc0,
+    0x12, 0x1, 0x86, 0x0, 0x64, 0x3, 0xc6, 0xa0,
+    0xe4, 0x1, 0xcc, 0x40, 0xc4, 0x1, 0xdc, 0x3,
+    0x0, 0x1f, 0x70, 0x2, 0x40, 0x33, 0x10, 0x58,
+    0x7, 0xe3, 0x50, 0x45, 0x0, 0xc, 0x1, 0xa8,
+    0x7, 0xf5, 0x80, 0x2c, 0x1, 0x2, 0x1c, 0x1,
+    0xfe, 0x18, 0x1, 0x83, 0x60, 0x62, 0x0, 0xff,
+    0x9c, 0x81, 0xf8, 0x6, 0x40, 0x3f, 0xf8, 0x3c,
+    0x0, 0x20, 0x80, 0xf, 0xfe, 0x11, 0xa8, 0x0,
+    0xd8, 0x3, 0xff, 0x87, 0xe0, 0xb, 0x0, 0xff,
+    0xff, 0x80, 0x7f, 0xfa, 0x40,
 
     /* U+00DE "Þ" */
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x30, 0x1, 0xff, 0xd7, 0x77, 0x77, 0x7a,
-    0xef, 0xff, 0x40, 0x1f, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfe, 0x1, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf6, 0x1f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xa1, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x1f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xb1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8, 0x1f, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0x31, 0xff,
-    0xb0, 0x0, 0x0, 0x3, 0x8f, 0xff, 0x90, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x1f, 0xfd, 0x66, 0x66, 0x65, 0x41, 0x0, 0x0,
-    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x1f, 0xf5, 0x80, 0x7f, 0xf9, 0x93, 0xff, 0xdb,
+    0x4a, 0x1, 0xff, 0xc2, 0x25, 0xad, 0x30, 0xe,
+    0x28, 0x8f, 0x28, 0x81, 0x62, 0x0, 0x66, 0x77,
+    0xf5, 0x73, 0x80, 0x28, 0x3, 0xff, 0x83, 0xa,
+    0x2, 0xc0, 0x1f, 0xfc, 0x19, 0x0, 0x60, 0x7,
+    0xff, 0x4, 0x80, 0x2, 0x1, 0xff, 0xc1, 0x30,
+    0xf, 0xfe, 0x22, 0x0, 0xc, 0x3, 0xff, 0x14,
+    0x0, 0x2c, 0x3, 0xfc, 0x71, 0xa2, 0xc, 0x60,
+    0x12, 0x7f, 0xfb, 0x1c, 0x0, 0xb2, 0x1, 0xff,
+    0xc1, 0x3a, 0xa0, 0x7, 0x14, 0xcf, 0x55, 0xf6,
+    0x28, 0x7, 0x99, 0xbc, 0xa8, 0x20, 0x1f, 0xfd,
+    0xb0,
 
     /* U+00DF "ß" */
-    0x0, 0x0, 0x6b, 0xef, 0xec, 0x71, 0x0, 0x0,
-    0x0, 0x2d, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x1, 0xef, 0xfc, 0x76, 0x7b, 0xff, 0xf3, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0x0, 0x5f, 0xfb, 0x0,
-    0x1f, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0x0,
-    0x4f, 0xf6, 0x0, 0x0, 0x0, 0x8, 0xff, 0x0,
-    0x6f, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0,
-    0x7f, 0xf3, 0x0, 0x1, 0x39, 0xff, 0xc0, 0x0,
-    0x7f, 0xf3, 0x0, 0xf, 0xff, 0xfd, 0x10, 0x0,
-    0x7f, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xe6, 0x0,
-    0x7f, 0xf3, 0x0, 0x4, 0x46, 0x9f, 0xff, 0x70,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf2,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf8,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf2,
-    0x7f, 0xf3, 0x0, 0x97, 0x67, 0x9f, 0xff, 0x90,
-    0x7f, 0xf3, 0x0, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x7f, 0xf3, 0x1, 0xbe, 0xff, 0xd9, 0x30, 0x0,
+    0x0, 0xcd, 0x7d, 0xfd, 0x8e, 0x20, 0x1e, 0x2d,
+    0x94, 0x10, 0x13, 0x8f, 0x40, 0xc, 0x38, 0x40,
+    0x71, 0x30, 0x80, 0x36, 0x60, 0x15, 0x88, 0x46,
+    0x3b, 0x3d, 0xd0, 0x2, 0x0, 0x2, 0xa0, 0x8e,
+    0x1, 0xca, 0x80, 0x80, 0x5, 0x0, 0x68, 0x7,
+    0xc6, 0x1, 0x88, 0x0, 0x40, 0x1f, 0x18, 0x8,
+    0x0, 0x40, 0xe, 0x1, 0xe4, 0x40, 0x30, 0x7,
+    0xf0, 0x9c, 0xd8, 0x1c, 0x0, 0x7f, 0x76, 0x30,
+    0x16, 0x80, 0x7f, 0xf0, 0x8b, 0xd8, 0x3, 0xfa,
+    0xed, 0x2c, 0x3, 0x2e, 0x1, 0xf9, 0x10, 0xd3,
+    0xc4, 0x10, 0x40, 0x1f, 0xf0, 0xc8, 0x2, 0x80,
+    0x3f, 0xf2, 0x0, 0x8, 0x3, 0xff, 0xa0, 0x80,
+    0x2, 0x0, 0xff, 0x86, 0x40, 0x14, 0x1, 0xe9,
+    0x76, 0x79, 0xe2, 0x6, 0x20, 0xf, 0x34, 0x4c,
+    0x30, 0x1, 0xa4, 0x3, 0xc2, 0x82, 0x0, 0x26,
+    0xc9, 0x0,
 
     /* U+00E0 "à" */
-    0x0, 0x6f, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef,
-    0xff, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f,
-    0xf5, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f,
-    0xf5, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe,
-    0x50, 0x1, 0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd,
-    0x92, 0x3f, 0xf5,
+    0x0, 0x37, 0xfb, 0x44, 0x3, 0xf9, 0xb0, 0x4b,
+    0x4, 0x3, 0xf8, 0xfc, 0xcb, 0x4, 0x3, 0xf8,
+    0x71, 0x42, 0xc0, 0x3f, 0xea, 0xda, 0x0, 0xff,
+    0xe4, 0x8b, 0xdf, 0x7f, 0xb6, 0x90, 0x3, 0x47,
+    0x42, 0x8, 0x0, 0x96, 0xe4, 0x2, 0x50, 0x15,
+    0x9a, 0x95, 0x0, 0x33, 0x0, 0x1d, 0x1d, 0x4c,
+    0xad, 0x5a, 0x0, 0x80, 0x1, 0xb8, 0x7, 0x89,
+    0xc0, 0x48, 0x3, 0xfd, 0xc0, 0x6, 0x0, 0x14,
+    0x67, 0x73, 0xfe, 0x90, 0xc, 0xda, 0xe6, 0x22,
+    0x0, 0xf0, 0x94, 0x80, 0xd7, 0x7f, 0xe9, 0x0,
+    0x94, 0x1, 0x4a, 0x20, 0x1f, 0xb8, 0x0, 0xa0,
+    0x1e, 0xe0, 0xb, 0x80, 0x8, 0x1, 0xc4, 0xe0,
+    0x12, 0x80, 0x2d, 0x40, 0x2, 0xd8, 0x1, 0x8a,
+    0x80, 0x6b, 0xfd, 0xd2, 0x2c, 0x1, 0x97, 0x58,
+    0x40, 0x4, 0xdb, 0x40, 0x10,
 
     /* U+00E1 "á" */
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xdc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef,
-    0xff, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f,
-    0xf5, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f,
-    0xf5, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe,
-    0x50, 0x1, 0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd,
-    0x92, 0x3f, 0xf5,
+    0x0, 0xfd, 0x5f, 0xea, 0x0, 0xfe, 0x95, 0x8,
+    0xa0, 0xf, 0xd2, 0xc1, 0x6e, 0x1, 0xf9, 0xd0,
+    0xf5, 0x0, 0x3f, 0x9f, 0x70, 0x80, 0x3f, 0xf9,
+    0x22, 0xf7, 0xdf, 0xed, 0xa4, 0x0, 0xd1, 0xd0,
+    0x82, 0x0, 0x25, 0xb9, 0x0, 0x94, 0x5, 0x66,
+    0xa5, 0x40, 0xc, 0xc0, 0x7, 0x47, 0x53, 0x2b,
+    0x56, 0x80, 0x20, 0x0, 0x6e, 0x1, 0xe2, 0x70,
+    0x12, 0x0, 0xff, 0x70, 0x1, 0x80, 0x5, 0x19,
+    0xdc, 0xff, 0xa4, 0x3, 0x36, 0xb9, 0x88, 0x80,
+    0x3c, 0x25, 0x20, 0x35, 0xdf, 0xfa, 0x40, 0x25,
+    0x0, 0x52, 0x88, 0x7, 0xee, 0x0, 0x28, 0x7,
+    0xb8, 0x2, 0xe0, 0x2, 0x0, 0x71, 0x38, 0x4,
+    0xa0, 0xb, 0x50, 0x0, 0xb6, 0x0, 0x62, 0xa0,
+    0x1a, 0xff, 0x74, 0x8b, 0x0, 0x65, 0xd6, 0x10,
+    0x1, 0x36, 0xd0, 0x4,
 
     /* U+00E2 "â" */
-    0x0, 0x0, 0x9, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfd, 0xfc, 0x10, 0x0, 0x0, 0x8,
-    0xfe, 0x31, 0xcf, 0xc0, 0x0, 0x0, 0x6d, 0xc2,
-    0x0, 0xa, 0xd9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef,
-    0xff, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f,
-    0xf5, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f,
-    0xf5, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe,
-    0x50, 0x1, 0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd,
-    0x92, 0x3f, 0xf5,
+    0x0, 0xe9, 0xff, 0x68, 0x80, 0x7e, 0x96, 0x2,
+    0x26, 0x88, 0x7, 0xa1, 0x87, 0x30, 0x66, 0xd0,
+    0xe, 0x65, 0x3c, 0x31, 0xc5, 0x19, 0x0, 0xcd,
+    0xb8, 0x40, 0x15, 0x6c, 0x80, 0x7f, 0xf1, 0x85,
+    0xef, 0xbf, 0xdb, 0x48, 0x1, 0xa3, 0xa1, 0x4,
+    0x0, 0x4b, 0x72, 0x1, 0x28, 0xa, 0xcd, 0x4a,
+    0x80, 0x19, 0x80, 0xe, 0x8e, 0xa6, 0x56, 0xad,
+    0x0, 0x40, 0x0, 0xdc, 0x3, 0xc4, 0xe0, 0x24,
+    0x1, 0xfe, 0xe0, 0x3, 0x0, 0xa, 0x33, 0xb9,
+    0xff, 0x48, 0x6, 0x6d, 0x73, 0x11, 0x0, 0x78,
+    0x4a, 0x40, 0x6b, 0xbf, 0xf4, 0x80, 0x4a, 0x0,
+    0xa5, 0x10, 0xf, 0xdc, 0x0, 0x50, 0xf, 0x70,
+    0x5, 0xc0, 0x4, 0x0, 0xe2, 0x70, 0x9, 0x40,
+    0x16, 0xa0, 0x1, 0x6c, 0x0, 0xc5, 0x40, 0x35,
+    0xfe, 0xe9, 0x16, 0x0, 0xcb, 0xac, 0x20, 0x2,
+    0x6d, 0xa0, 0x8,
 
     /* U+00E3 "ã" */
-    0x0, 0x4, 0xdf, 0x70, 0x0, 0xbc, 0x0, 0x0,
-    0xe, 0xfc, 0xf9, 0x0, 0xe9, 0x0, 0x0, 0x5f,
-    0x50, 0x6f, 0xbc, 0xf3, 0x0, 0x0, 0x7f, 0x0,
-    0x4, 0xef, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef,
-    0xff, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f,
-    0xf5, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f,
-    0xf5, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe,
-    0x50, 0x1, 0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd,
-    0x92, 0x3f, 0xf5,
+    0x0, 0x93, 0x7d, 0xc0, 0x2b, 0xc0, 0xe, 0xa2,
+    0x38, 0x90, 0x2, 0xa8, 0x3, 0x28, 0xd6, 0x4b,
+    0x5e, 0xd, 0x0, 0x62, 0x5, 0x6, 0xb5, 0x38,
+    0x30, 0xc, 0xfe, 0x1, 0x27, 0x7b, 0x80, 0x7f,
+    0xf1, 0xc5, 0xef, 0xbf, 0xdb, 0x48, 0x1, 0xa3,
+    0xa1, 0x4, 0x0, 0x4b, 0x72, 0x1, 0x28, 0xa,
+    0xcd, 0x4a, 0x80, 0x19, 0x80, 0xe, 0x8e, 0xa6,
+    0x56, 0xad, 0x0, 0x40, 0x0, 0xdc, 0x3, 0xc4,
+    0xe0, 0x24, 0x1, 0xfe, 0xe0, 0x3, 0x0, 0xa,
+    0x33, 0xb9, 0xff, 0x48, 0x6, 0x6d, 0x73, 0x11,
+    0x0, 0x78, 0x4a, 0x40, 0x6b, 0xbf, 0xf4, 0x80,
+    0x4a, 0x0, 0xa5, 0x10, 0xf, 0xdc, 0x0, 0x50,
+    0xf, 0x70, 0x5, 0xc0, 0x4, 0x0, 0xe2, 0x70,
+    0x9, 0x40, 0x16, 0xa0, 0x1, 0x6c, 0x0, 0xc5,
+    0x40, 0x35, 0xfe, 0xe9, 0x16, 0x0, 0xcb, 0xac,
+    0x20, 0x2, 0x6d, 0xa0, 0x8,
 
     /* U+00E4 "ä" */
-    0x0, 0x7, 0xf8, 0x0, 0x4e, 0xb0, 0x0, 0x0,
-    0xd, 0xfe, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x6,
-    0xd7, 0x0, 0x3d, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3,
-    0x70, 0x0, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef,
-    0xff, 0xff, 0xf4, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f,
-    0xf5, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5,
-    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f,
-    0xf5, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe,
-    0x50, 0x1, 0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd,
-    0x92, 0x3f, 0xf5,
+    0x0, 0x9f, 0xe0, 0x0, 0x9d, 0x60, 0x1e, 0xa0,
+    0x60, 0x7, 0xa, 0x10, 0x7, 0x59, 0x48, 0x2,
+    0x49, 0x88, 0x3, 0x9b, 0x5c, 0x0, 0x7b, 0x20,
+    0x1f, 0xfd, 0x51, 0x7b, 0xef, 0xf6, 0xd2, 0x0,
+    0x68, 0xe8, 0x41, 0x0, 0x12, 0xdc, 0x80, 0x4a,
+    0x2, 0xb3, 0x52, 0xa0, 0x6, 0x60, 0x3, 0xa3,
+    0xa9, 0x95, 0xab, 0x40, 0x10, 0x0, 0x37, 0x0,
+    0xf1, 0x38, 0x9, 0x0, 0x7f, 0xb8, 0x0, 0xc0,
+    0x2, 0x8c, 0xee, 0x7f, 0xd2, 0x1, 0x9b, 0x5c,
+    0xc4, 0x40, 0x1e, 0x12, 0x90, 0x1a, 0xef, 0xfd,
+    0x20, 0x12, 0x80, 0x29, 0x44, 0x3, 0xf7, 0x0,
+    0x14, 0x3, 0xdc, 0x1, 0x70, 0x1, 0x0, 0x38,
+    0x9c, 0x2, 0x50, 0x5, 0xa8, 0x0, 0x5b, 0x0,
+    0x31, 0x50, 0xd, 0x7f, 0xba, 0x45, 0x80, 0x32,
+    0xeb, 0x8, 0x0, 0x9b, 0x68, 0x2,
 
     /* U+00E5 "å" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xa1, 0x0, 0x0, 0x0, 0x0,
-    0x7e, 0x54, 0xcb, 0x0, 0x0, 0x0, 0x0, 0xd6,
-    0x0, 0x2f, 0x10, 0x0, 0x0, 0x0, 0xe5, 0x0,
-    0x1f, 0x20, 0x0, 0x0, 0x0, 0x9d, 0x21, 0xad,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xbe, 0xff, 0xda, 0x40, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xfe, 0xa6,
-    0x56, 0xaf, 0xff, 0x60, 0x3, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf4, 0x0, 0x28, 0xce, 0xef, 0xff, 0xff, 0xf4,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x2f,
-    0xfe, 0x51, 0x0, 0x0, 0x6f, 0xf5, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x7f, 0xf5, 0x0, 0x0,
-    0x2, 0xff, 0xf5, 0x2f, 0xfe, 0x50, 0x1, 0x6e,
-    0xff, 0xf5, 0x5, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xf5, 0x0, 0x29, 0xef, 0xfd, 0x92, 0x3f, 0xf5,
+    0x0, 0xff, 0xe3, 0xbf, 0x7d, 0x8, 0x7, 0xe7,
+    0x9b, 0xb3, 0x50, 0x7, 0xea, 0x85, 0x4e, 0x41,
+    0x0, 0xf8, 0xcc, 0x0, 0x30, 0x30, 0xf, 0x9e,
+    0x8, 0x6c, 0x88, 0x1, 0xf4, 0xbe, 0xf3, 0x78,
+    0x7, 0xf5, 0x7f, 0x61, 0x0, 0x7f, 0xc2, 0x1,
+    0xf8, 0x5e, 0xfb, 0xfd, 0xb4, 0x80, 0x1a, 0x3a,
+    0x10, 0x40, 0x4, 0xb7, 0x20, 0x12, 0x80, 0xac,
+    0xd4, 0xa8, 0x1, 0x98, 0x0, 0xe8, 0xea, 0x65,
+    0x6a, 0xd0, 0x4, 0x0, 0xd, 0xc0, 0x3c, 0x4e,
+    0x2, 0x40, 0x1f, 0xee, 0x0, 0x30, 0x0, 0xa3,
+    0x3b, 0x9f, 0xf4, 0x80, 0x66, 0xd7, 0x31, 0x10,
+    0x7, 0x84, 0xa4, 0x6, 0xbb, 0xff, 0x48, 0x4,
+    0xa0, 0xa, 0x51, 0x0, 0xfd, 0xc0, 0x5, 0x0,
+    0xf7, 0x0, 0x5c, 0x0, 0x40, 0xe, 0x27, 0x0,
+    0x94, 0x1, 0x6a, 0x0, 0x16, 0xc0, 0xc, 0x54,
+    0x3, 0x5f, 0xee, 0x91, 0x60, 0xc, 0xba, 0xc2,
+    0x0, 0x26, 0xda, 0x0, 0x80,
 
     /* U+00E6 "æ" */
-    0x0, 0x17, 0xbe, 0xff, 0xd9, 0x30, 0x0, 0x18,
-    0xce, 0xfd, 0x93, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0xd, 0xfe, 0xa6, 0x56, 0xaf, 0xff,
-    0xaf, 0xff, 0x96, 0x68, 0xef, 0xfc, 0x0, 0x3,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x28,
-    0xce, 0xee, 0xee, 0xff, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xef, 0xf7, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xf6, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x1, 0xc9, 0x0, 0x1f, 0xff, 0x72, 0x13,
-    0x8f, 0xfb, 0x6f, 0xff, 0xc7, 0x66, 0xaf, 0xff,
-    0x40, 0x4, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x29,
-    0xdf, 0xfd, 0xa4, 0x0, 0x0, 0x17, 0xce, 0xfe,
-    0xc8, 0x20, 0x0,
+    0x0, 0xb, 0xdf, 0x7f, 0xb6, 0x4c, 0x2, 0x18,
+    0xce, 0xfd, 0x93, 0x0, 0xe8, 0xe8, 0x41, 0x0,
+    0x13, 0x64, 0x3, 0x73, 0x98, 0x81, 0x36, 0x50,
+    0x6, 0x50, 0x15, 0x9a, 0x95, 0x0, 0x3d, 0x48,
+    0x1, 0xa6, 0x4e, 0x20, 0xb8, 0x1, 0x74, 0xf5,
+    0x32, 0xb5, 0x60, 0x1, 0x41, 0x3a, 0x59, 0x91,
+    0xce, 0x7, 0x0, 0x3, 0x60, 0xf, 0x1b, 0x0,
+    0x6, 0xc4, 0x3, 0xa1, 0x1, 0xc0, 0x3f, 0xef,
+    0x0, 0x48, 0x7, 0xef, 0x0, 0x20, 0x0, 0xa3,
+    0x3b, 0xba, 0x40, 0x11, 0xdd, 0xfa, 0x80, 0x6,
+    0xd, 0xae, 0x62, 0x3c, 0x1, 0x84, 0x7f, 0x80,
+    0x22, 0x90, 0x1a, 0xef, 0xfd, 0x20, 0x9, 0xff,
+    0xff, 0x9d, 0x40, 0x14, 0xa2, 0x1, 0xf6, 0x80,
+    0x7f, 0xee, 0x0, 0x28, 0x7, 0xb0, 0x0, 0x88,
+    0x0, 0xff, 0xb8, 0x0, 0xe0, 0x1c, 0x6a, 0x1,
+    0x5a, 0x0, 0x70, 0xe4, 0x80, 0x18, 0x1, 0x2e,
+    0x42, 0x71, 0x80, 0x92, 0x0, 0xbc, 0x76, 0x65,
+    0x71, 0xb2, 0x0, 0xd8, 0x2, 0x37, 0xb1, 0xc1,
+    0x2d, 0xa8, 0x40, 0xe2, 0x64, 0xa0, 0x8, 0x40,
+    0x2, 0x6b, 0x10, 0x0, 0x96, 0xec, 0x0, 0x5f,
+    0x83, 0x10, 0x13, 0x7d, 0x70, 0x0,
 
     /* U+00E7 "ç" */
-    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1,
-    0xdf, 0xfe, 0x96, 0x69, 0xff, 0xf8, 0x0, 0xbf,
-    0xfa, 0x0, 0x0, 0x1, 0xcf, 0x80, 0x3f, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0x20, 0x8, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0,
-    0x1, 0x20, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x1,
-    0xcf, 0x80, 0x1, 0xdf, 0xfe, 0x96, 0x69, 0xff,
-    0xf8, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x39, 0xff, 0xfd, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0x92, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0x7f, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0x10, 0x0, 0x0, 0x0,
-    0x6, 0xb8, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x6d, 0xfe, 0xa2, 0x0, 0x0, 0x0,
+    0x0, 0xc7, 0x3b, 0xfe, 0xd9, 0x30, 0xe, 0x1b,
+    0xc6, 0x20, 0x1, 0x36, 0x48, 0x4, 0x38, 0x80,
+    0x2d, 0x32, 0x60, 0x3, 0x40, 0x2, 0x88, 0x17,
+    0xa5, 0x99, 0x3c, 0x60, 0x11, 0xa0, 0x1d, 0x0,
+    0x70, 0xee, 0xa0, 0x2c, 0x1, 0x0, 0x1f, 0x9,
+    0x0, 0xc, 0x0, 0x80, 0x1f, 0xf3, 0x80, 0x80,
+    0x7f, 0xe7, 0x1, 0x0, 0xff, 0xc6, 0x0, 0x40,
+    0xf, 0xfa, 0x80, 0x10, 0x1, 0xf0, 0x90, 0x0,
+    0x90, 0xe, 0x80, 0x38, 0x77, 0x50, 0x0, 0xa2,
+    0x5, 0xe9, 0x66, 0x4f, 0x18, 0x6, 0x1c, 0x40,
+    0x16, 0x99, 0x30, 0x1, 0xe0, 0x2, 0x1b, 0xc6,
+    0x0, 0x89, 0xb2, 0x0, 0x3c, 0x72, 0xc3, 0xfb,
+    0x26, 0x1, 0xfc, 0x83, 0x24, 0x1, 0xff, 0x44,
+    0x1b, 0xc0, 0x3f, 0xe5, 0x73, 0x21, 0x0, 0xfc,
+    0xd7, 0x14, 0x64, 0x20, 0x1f, 0xcc, 0xe8, 0xbe,
+    0x1, 0xc0,
 
     /* U+00E8 "è" */
-    0x0, 0x1c, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xdd, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xdf, 0xec, 0x61, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x1, 0xef, 0xfb, 0x64,
-    0x59, 0xff, 0xf4, 0x0, 0xbf, 0xf4, 0x0, 0x0,
-    0x2, 0xdf, 0xe1, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x69, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0xbf, 0xfb, 0x10, 0x0, 0x0, 0x5e, 0x30, 0x1,
-    0xdf, 0xff, 0x96, 0x68, 0xcf, 0xfc, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x39, 0xde, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0xe, 0x7f, 0x98, 0x3, 0xfc, 0x38, 0xa1,
+    0x2c, 0x1, 0xff, 0x54, 0x4, 0xa8, 0x7, 0xfc,
+    0xf4, 0x50, 0x60, 0x1f, 0xf2, 0xee, 0x8c, 0x3,
+    0xff, 0x98, 0x97, 0xbf, 0xd8, 0xc2, 0x1, 0xc3,
+    0x96, 0x84, 0x2, 0x73, 0xe8, 0x1, 0xf, 0x98,
+    0x24, 0xdd, 0x30, 0xd, 0xa0, 0x2, 0x84, 0x2e,
+    0xcc, 0x8b, 0x3a, 0x41, 0x42, 0x68, 0x12, 0x80,
+    0x1c, 0x5e, 0x2, 0xf4, 0x0, 0x60, 0xf, 0x89,
+    0x3, 0x48, 0x1, 0xff, 0xfc, 0x80, 0xce, 0x1,
+    0xff, 0xc1, 0x37, 0x0, 0x7f, 0xff, 0xdc, 0x60,
+    0x4, 0x0, 0xff, 0xac, 0x1, 0x0, 0x1f, 0x84,
+    0x0, 0x68, 0x7, 0x62, 0x1, 0xcb, 0xe6, 0x0,
+    0xa2, 0x4, 0xe9, 0x66, 0x46, 0x50, 0xf8, 0x0,
+    0x71, 0x0, 0xd, 0x32, 0x73, 0x2, 0xe0, 0x8,
+    0x6f, 0x18, 0x84, 0x5, 0x6b, 0x48, 0x0,
 
     /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2c, 0xd7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xdf, 0xec, 0x61, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x1, 0xef, 0xfb, 0x64,
-    0x59, 0xff, 0xf4, 0x0, 0xbf, 0xf4, 0x0, 0x0,
-    0x2, 0xdf, 0xe1, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x69, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0xbf, 0xfb, 0x10, 0x0, 0x0, 0x5e, 0x30, 0x1,
-    0xdf, 0xff, 0x96, 0x68, 0xcf, 0xfc, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x39, 0xde, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0xfc, 0x7f, 0xee, 0x30, 0xf, 0xe3, 0xc0,
+    0x3f, 0x30, 0xf, 0xc7, 0x80, 0xb8, 0x20, 0x1f,
+    0x8b, 0xca, 0x28, 0x3, 0xfc, 0x59, 0xae, 0x1,
+    0xff, 0xcd, 0x4b, 0xdf, 0xec, 0x61, 0x0, 0xe1,
+    0xcb, 0x42, 0x1, 0x39, 0xf4, 0x0, 0x87, 0xcc,
+    0x12, 0x6e, 0x98, 0x6, 0xd0, 0x1, 0x42, 0x17,
+    0x66, 0x45, 0x9d, 0x20, 0xa1, 0x34, 0x9, 0x40,
+    0xe, 0x2f, 0x1, 0x7a, 0x0, 0x30, 0x7, 0xc4,
+    0x81, 0xa4, 0x0, 0xff, 0xfe, 0x40, 0x67, 0x0,
+    0xff, 0xe0, 0x9b, 0x80, 0x3f, 0xff, 0xee, 0x30,
+    0x2, 0x0, 0x7f, 0xd6, 0x0, 0x80, 0xf, 0xc2,
+    0x0, 0x34, 0x3, 0xb1, 0x0, 0xe5, 0xf3, 0x0,
+    0x51, 0x2, 0x74, 0xb3, 0x23, 0x28, 0x7c, 0x0,
+    0x38, 0x80, 0x6, 0x99, 0x39, 0x81, 0x70, 0x4,
+    0x37, 0x8c, 0x42, 0x2, 0xb5, 0xa4, 0x0,
 
     /* U+00EA "ê" */
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xcf, 0xf5, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0x80, 0x6f, 0xf5, 0x0, 0x0, 0x1,
-    0xcd, 0x60, 0x0, 0x4d, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xdf, 0xec, 0x61, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x1, 0xef, 0xfb, 0x64,
-    0x59, 0xff, 0xf4, 0x0, 0xbf, 0xf4, 0x0, 0x0,
-    0x2, 0xdf, 0xe1, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x69, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0xbf, 0xfb, 0x10, 0x0, 0x0, 0x5e, 0x30, 0x1,
-    0xdf, 0xff, 0x96, 0x68, 0xcf, 0xfc, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x39, 0xde, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0xe3, 0xff, 0x98, 0x3, 0xf8, 0xf0, 0xc,
+    0x25, 0x40, 0x3e, 0x2d, 0x7, 0xc9, 0xa, 0x50,
+    0xe, 0x1e, 0x39, 0x80, 0x6b, 0x28, 0x30, 0xc,
+    0x39, 0xac, 0x1, 0x26, 0xe8, 0xc0, 0x3f, 0xf9,
+    0x29, 0x7b, 0xfd, 0x8c, 0x20, 0x1c, 0x39, 0x68,
+    0x40, 0x27, 0x3e, 0x80, 0x10, 0xf9, 0x82, 0x4d,
+    0xd3, 0x0, 0xda, 0x0, 0x28, 0x42, 0xec, 0xc8,
+    0xb3, 0xa4, 0x14, 0x26, 0x81, 0x28, 0x1, 0xc5,
+    0xe0, 0x2f, 0x40, 0x6, 0x0, 0xf8, 0x90, 0x34,
+    0x80, 0x1f, 0xff, 0xc8, 0xc, 0xe0, 0x1f, 0xfc,
+    0x13, 0x70, 0x7, 0xff, 0xfd, 0xc6, 0x0, 0x40,
+    0xf, 0xfa, 0xc0, 0x10, 0x1, 0xf8, 0x40, 0x6,
+    0x80, 0x76, 0x20, 0x1c, 0xbe, 0x60, 0xa, 0x20,
+    0x4e, 0x96, 0x64, 0x65, 0xf, 0x80, 0x7, 0x10,
+    0x0, 0xd3, 0x27, 0x30, 0x2e, 0x0, 0x86, 0xf1,
+    0x88, 0x40, 0x56, 0xb4, 0x80,
 
     /* U+00EB "ë" */
-    0x0, 0x1, 0xdd, 0x10, 0xb, 0xe3, 0x0, 0x0,
-    0x0, 0x6f, 0xf5, 0x3, 0xff, 0x90, 0x0, 0x0,
-    0x1, 0xcb, 0x10, 0xa, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xdf, 0xec, 0x61, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0xe4, 0x0, 0x1, 0xef, 0xfb, 0x64,
-    0x59, 0xff, 0xf4, 0x0, 0xbf, 0xf4, 0x0, 0x0,
-    0x2, 0xdf, 0xe1, 0x3f, 0xf6, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x69, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0xbf, 0xfb, 0x10, 0x0, 0x0, 0x5e, 0x30, 0x1,
-    0xdf, 0xff, 0x96, 0x68, 0xcf, 0xfc, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x39, 0xde, 0xfe, 0xa5, 0x0, 0x0,
+    0x0, 0x87, 0x74, 0x20, 0xb, 0xe3, 0x0, 0xf3,
+    0x91, 0x10, 0xd, 0x6, 0x80, 0x3c, 0xe6, 0x88,
+    0x3, 0x53, 0xa0, 0xf, 0xe, 0x58, 0x80, 0x2b,
+    0xc, 0x3, 0xff, 0xb2, 0x97, 0xbf, 0xd8, 0xc2,
+    0x1, 0xc3, 0x96, 0x84, 0x2, 0x73, 0xe8, 0x1,
+    0xf, 0x98, 0x24, 0xdd, 0x30, 0xd, 0xa0, 0x2,
+    0x84, 0x2e, 0xcc, 0x8b, 0x3a, 0x41, 0x42, 0x68,
+    0x12, 0x80, 0x1c, 0x5e, 0x2, 0xf4, 0x0, 0x60,
+    0xf, 0x89, 0x3, 0x48, 0x1, 0xff, 0xfc, 0x80,
+    0xce, 0x1, 0xff, 0xc1, 0x37, 0x0, 0x7f, 0xff,
+    0xdc, 0x60, 0x4, 0x0, 0xff, 0xac, 0x1, 0x0,
+    0x1f, 0x84, 0x0, 0x68, 0x7, 0x62, 0x1, 0xcb,
+    0xe6, 0x0, 0xa2, 0x4, 0xe9, 0x66, 0x46, 0x50,
+    0xf8, 0x0, 0x71, 0x0, 0xd, 0x32, 0x73, 0x2,
+    0xe0, 0x8, 0x6f, 0x18, 0x84, 0x5, 0x6b, 0x48,
+    0x0,
 
     /* U+00EC "ì" */
-    0x9, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xfa, 0x0,
-    0x0, 0x3, 0xef, 0xa0, 0x0, 0x0, 0x1a, 0xc7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7f, 0xf3,
+    0x9, 0xff, 0x50, 0x6, 0x99, 0x2, 0xd0, 0x6,
+    0x6c, 0x15, 0xa0, 0xc, 0x7e, 0xac, 0xe0, 0x18,
+    0x6b, 0x1c, 0x3, 0xff, 0x3f, 0xf8, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xfd, 0x90,
 
     /* U+00ED "í" */
-    0x0, 0x1, 0xdf, 0xf6, 0x0, 0x1, 0xdf, 0xe3,
-    0x0, 0x1, 0xdf, 0xc1, 0x0, 0x0, 0x9c, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x87, 0x7f, 0xcc, 0x1, 0xe, 0x10, 0xe3,
+    0x0, 0x7, 0x8, 0xfc, 0xc0, 0x28, 0x16, 0xc1,
+    0x0, 0xd3, 0x92, 0x1, 0xff, 0xc3, 0x7f, 0xf1,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfd, 0x60,
 
     /* U+00EE "î" */
-    0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x9f, 0xef,
-    0xf5, 0x0, 0x6, 0xfe, 0x24, 0xff, 0x30, 0x1b,
-    0xc3, 0x0, 0x5c, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff,
-    0x30, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0,
+    0x0, 0xb3, 0xfd, 0x0, 0x1d, 0x26, 0x20, 0xea,
+    0x1, 0x33, 0x7, 0x2c, 0x28, 0xc0, 0x74, 0xf4,
+    0x92, 0x8e, 0x40, 0x6f, 0xc, 0x0, 0xb9, 0x40,
+    0x1f, 0xfc, 0x27, 0xff, 0x18, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xf0,
 
     /* U+00EF "ï" */
-    0x2e, 0xc0, 0x2e, 0xc0, 0x7f, 0xf3, 0x7f, 0xf3,
-    0x1b, 0xa0, 0x1b, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x7f, 0xf3, 0x0,
+    0x2e, 0xc0, 0x2e, 0xc0, 0x51, 0x33, 0x28, 0x99,
+    0x99, 0x14, 0xd9, 0x14, 0xc6, 0xe8, 0x6, 0xe8,
+    0x3, 0xff, 0x8e, 0xff, 0xe3, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf6, 0xc0,
 
     /* U+00F0 "ð" */
-    0x3, 0x9c, 0xef, 0xfe, 0xb7, 0x10, 0x4, 0x10,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xdf, 0x80,
-    0x1, 0xd9, 0x65, 0x46, 0xdf, 0xff, 0xfd, 0x50,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xfa, 0x3d, 0xff, 0x40,
-    0x0, 0x3e, 0xff, 0xf8, 0x10, 0x2, 0xff, 0xc0,
-    0x0, 0x1f, 0xe7, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5,
-    0x0, 0x0, 0x1, 0x34, 0x20, 0x0, 0x2f, 0xf9,
-    0x0, 0x6, 0xcf, 0xff, 0xfe, 0x90, 0xf, 0xfa,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xfd, 0x2f, 0xfb,
-    0xc, 0xff, 0xc5, 0x10, 0x15, 0xcf, 0xcf, 0xfb,
-    0x5f, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9,
-    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0,
-    0x3f, 0xfe, 0x20, 0x0, 0x0, 0x2e, 0xff, 0x10,
-    0x8, 0xff, 0xf9, 0x54, 0x6a, 0xff, 0xf5, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x2, 0x8d, 0xef, 0xeb, 0x60, 0x0, 0x0,
+    0x3, 0x9c, 0xef, 0xf7, 0x5b, 0x88, 0x1, 0x4,
+    0x0, 0xcc, 0x31, 0x0, 0xa, 0x47, 0x56, 0xdc,
+    0x80, 0x10, 0x9a, 0x6a, 0xe4, 0x80, 0xa, 0x44,
+    0xd0, 0x0, 0xec, 0xb2, 0x8d, 0x10, 0x6, 0x75,
+    0x0, 0xe6, 0xda, 0x30, 0x5c, 0x20, 0x54, 0x0,
+    0x8f, 0xa4, 0x81, 0xfa, 0x8f, 0xc0, 0x10, 0x1,
+    0x10, 0x8a, 0x3e, 0x4, 0x0, 0x4a, 0x6, 0x40,
+    0x1, 0xce, 0x70, 0xf, 0x78, 0x1, 0xc0, 0x23,
+    0x1, 0x34, 0x20, 0x9, 0xc0, 0x18, 0x1, 0x36,
+    0x76, 0x5e, 0xf4, 0x81, 0x0, 0xc, 0x7, 0x24,
+    0xc0, 0x30, 0xb6, 0x90, 0x0, 0x43, 0x4c, 0xe,
+    0xbb, 0xfa, 0x8c, 0xb8, 0x2, 0x53, 0x4, 0xc5,
+    0x10, 0x15, 0xc4, 0x30, 0x1, 0x78, 0x2, 0x40,
+    0x3e, 0xa0, 0x8, 0x58, 0x4, 0x80, 0x3e, 0x13,
+    0x0, 0x63, 0x80, 0x80, 0x7f, 0x8, 0x1, 0x8,
+    0x0, 0x80, 0x1f, 0x19, 0x2, 0x85, 0x0, 0x28,
+    0x80, 0x38, 0xb4, 0x1, 0x60, 0x6e, 0x3, 0xb2,
+    0xa8, 0xd5, 0xa2, 0x14, 0x20, 0x8, 0x70, 0x3,
+    0x55, 0xca, 0x80, 0xda, 0x80, 0x68, 0xd7, 0x21,
+    0x1, 0x49, 0xe4, 0x0, 0x80,
 
     /* U+00F1 "ñ" */
-    0x0, 0x0, 0xaf, 0xc2, 0x0, 0x4f, 0x30, 0x0,
-    0x0, 0x7f, 0xce, 0xe2, 0x8, 0xf1, 0x0, 0x0,
-    0xe, 0xc0, 0x1d, 0xe9, 0xfa, 0x0, 0x0, 0x0,
-    0xf7, 0x0, 0x1a, 0xfc, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x7,
-    0xce, 0xfe, 0xb5, 0x0, 0x7, 0xff, 0x5e, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff, 0xfd, 0x75,
-    0x58, 0xef, 0xf9, 0x7, 0xff, 0xf9, 0x0, 0x0,
-    0x2, 0xef, 0xf2, 0x7f, 0xfd, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x67, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x2f, 0xf8, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0x97, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xa7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f,
-    0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f, 0xf3,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
+    0x0, 0xd5, 0xf8, 0x40, 0x4, 0xf3, 0x0, 0xe7,
+    0x53, 0x2c, 0x20, 0xc0, 0x20, 0xe, 0x93, 0xcf,
+    0x3c, 0x97, 0x51, 0x0, 0xe1, 0xb0, 0x1c, 0x46,
+    0x3b, 0x0, 0xf7, 0xb8, 0x0, 0x6b, 0xf0, 0x40,
+    0x3f, 0xf8, 0xcf, 0xfe, 0x20, 0x7c, 0xef, 0xeb,
+    0x50, 0xf, 0x3f, 0x41, 0x88, 0xa, 0x55, 0x80,
+    0x75, 0x9, 0x45, 0x51, 0xc4, 0x12, 0x40, 0x39,
+    0xb5, 0xd5, 0x51, 0x82, 0xc, 0x40, 0x11, 0x48,
+    0x7, 0x14, 0x80, 0x10, 0x2, 0xa0, 0xf, 0x94,
+    0x1, 0xc0, 0x11, 0x80, 0x7c, 0x60, 0x1, 0x0,
+    0x9c, 0x3, 0xfc, 0x60, 0x1f, 0xff, 0xf0, 0xf,
+    0xfe, 0x90,
 
     /* U+00F2 "ò" */
-    0x0, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xd7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xa7, 0xfd, 0x40, 0x1f, 0xfa, 0x60, 0x16,
+    0x80, 0x3f, 0xf3, 0xd8, 0xac, 0x80, 0x7f, 0xe4,
+    0xc3, 0x47, 0x0, 0xff, 0xc5, 0x9a, 0xe0, 0x1f,
+    0xfc, 0xe4, 0xad, 0xfe, 0xd8, 0x20, 0xf, 0xd,
+    0xd9, 0x48, 0x4, 0x9f, 0x60, 0x3, 0xf, 0xa0,
+    0xb, 0x4c, 0x94, 0x0, 0xf6, 0x1, 0x50, 0x82,
+    0xf4, 0xb3, 0x2b, 0x8c, 0x11, 0xc0, 0xd0, 0xe,
+    0x80, 0x38, 0x74, 0x42, 0x42, 0xc0, 0x10, 0x1,
+    0xf0, 0xc8, 0xa, 0x98, 0x1, 0x0, 0x3f, 0x20,
+    0x0, 0x9c, 0x4, 0x3, 0xf8, 0x40, 0x1c, 0xe0,
+    0x20, 0x1f, 0xc2, 0x0, 0xe3, 0x0, 0x20, 0x7,
+    0xeb, 0x0, 0x15, 0x80, 0x20, 0x3, 0xe1, 0x60,
+    0x15, 0x34, 0x3, 0xa0, 0xe, 0x1d, 0x10, 0x90,
+    0x5, 0x10, 0x2f, 0x4b, 0x32, 0xb8, 0xc1, 0x1c,
+    0x0, 0x38, 0x80, 0x2d, 0x32, 0x50, 0x3, 0xd8,
+    0x6, 0x1b, 0xb2, 0x90, 0x9, 0x36, 0xc0, 0x4,
 
     /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xad, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xfc, 0x3b, 0xfe, 0x60, 0xf, 0xf0, 0xe1,
+    0xd, 0xb0, 0x7, 0xf0, 0xe9, 0x13, 0x10, 0x3,
+    0xfd, 0x62, 0xba, 0x40, 0x1f, 0xf5, 0x6d, 0x0,
+    0x7f, 0xf3, 0xd2, 0xb7, 0xfb, 0x60, 0x80, 0x3c,
+    0x37, 0x65, 0x20, 0x12, 0x7d, 0x80, 0xc, 0x3e,
+    0x80, 0x2d, 0x32, 0x50, 0x3, 0xd8, 0x5, 0x42,
+    0xb, 0xd2, 0xcc, 0xae, 0x30, 0x47, 0x3, 0x40,
+    0x3a, 0x0, 0xe1, 0xd1, 0x9, 0xb, 0x0, 0x40,
+    0x7, 0xc3, 0x20, 0x2a, 0x60, 0x4, 0x0, 0xfc,
+    0x80, 0x2, 0x70, 0x10, 0xf, 0xe1, 0x0, 0x73,
+    0x80, 0x80, 0x7f, 0x8, 0x3, 0x8c, 0x0, 0x80,
+    0x1f, 0xac, 0x0, 0x56, 0x0, 0x80, 0xf, 0x85,
+    0x80, 0x54, 0xd0, 0xe, 0x80, 0x38, 0x74, 0x42,
+    0x40, 0x14, 0x40, 0xbd, 0x2c, 0xca, 0xe3, 0x4,
+    0x70, 0x0, 0xe2, 0x0, 0xb4, 0xc9, 0x40, 0xf,
+    0x60, 0x18, 0x6e, 0xca, 0x40, 0x24, 0xdb, 0x0,
+    0x10,
 
     /* U+00F4 "ô" */
-    0x0, 0x0, 0x1, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfd, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xc1, 0x2e, 0xf9, 0x0, 0x0,
-    0x0, 0x9, 0xda, 0x0, 0x1, 0xcd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xe1, 0xdf, 0xf5, 0x0, 0x7f, 0xda, 0x44,
+    0x5, 0x90, 0xf, 0xec, 0x33, 0x66, 0x8b, 0x48,
+    0x7, 0xd2, 0x2b, 0x82, 0x5e, 0x68, 0xc0, 0x1e,
+    0x9d, 0xa0, 0x8, 0x73, 0x58, 0x3, 0xff, 0x96,
+    0x95, 0xbf, 0xdb, 0x4, 0x1, 0xe1, 0xbb, 0x29,
+    0x0, 0x93, 0xec, 0x0, 0x61, 0xf4, 0x1, 0x69,
+    0x92, 0x80, 0x1e, 0xc0, 0x2a, 0x10, 0x5e, 0x96,
+    0x65, 0x71, 0x82, 0x38, 0x1a, 0x1, 0xd0, 0x7,
+    0xe, 0x88, 0x48, 0x58, 0x2, 0x0, 0x3e, 0x19,
+    0x1, 0x53, 0x0, 0x20, 0x7, 0xe4, 0x0, 0x13,
+    0x80, 0x80, 0x7f, 0x8, 0x3, 0x9c, 0x4, 0x3,
+    0xf8, 0x40, 0x1c, 0x60, 0x4, 0x0, 0xfd, 0x60,
+    0x2, 0xb0, 0x4, 0x0, 0x7c, 0x2c, 0x2, 0xa6,
+    0x80, 0x74, 0x1, 0xc3, 0xa2, 0x12, 0x0, 0xa2,
+    0x5, 0xe9, 0x66, 0x57, 0x18, 0x23, 0x80, 0x7,
+    0x10, 0x5, 0xa6, 0x4a, 0x0, 0x7b, 0x0, 0xc3,
+    0x76, 0x52, 0x1, 0x26, 0xd8, 0x0, 0x80,
 
     /* U+00F5 "õ" */
-    0x0, 0x0, 0x7e, 0xe6, 0x0, 0xf, 0x70, 0x0,
-    0x0, 0x5, 0xfd, 0xdf, 0xa1, 0x7f, 0x40, 0x0,
-    0x0, 0xa, 0xe0, 0x7, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x6, 0x50, 0x0, 0x27, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xcf, 0xdc, 0x60, 0xb, 0xdc, 0x3, 0xcb,
+    0x6, 0x69, 0xa1, 0x70, 0x30, 0xf, 0x78, 0xee,
+    0xa1, 0x7a, 0x11, 0x0, 0x1e, 0xcb, 0x0, 0x3e,
+    0xc5, 0x58, 0x7, 0xcc, 0xa0, 0x11, 0x3a, 0x80,
+    0x7f, 0xf3, 0x52, 0xb7, 0xfb, 0x60, 0x80, 0x3c,
+    0x37, 0x65, 0x20, 0x12, 0x7d, 0x80, 0xc, 0x3e,
+    0x80, 0x2d, 0x32, 0x50, 0x3, 0xd8, 0x5, 0x42,
+    0xb, 0xd2, 0xcc, 0xae, 0x30, 0x47, 0x3, 0x40,
+    0x3a, 0x0, 0xe1, 0xd1, 0x9, 0xb, 0x0, 0x40,
+    0x7, 0xc3, 0x20, 0x2a, 0x60, 0x4, 0x0, 0xfc,
+    0x80, 0x2, 0x70, 0x10, 0xf, 0xe1, 0x0, 0x73,
+    0x80, 0x80, 0x7f, 0x8, 0x3, 0x8c, 0x0, 0x80,
+    0x1f, 0xac, 0x0, 0x56, 0x0, 0x80, 0xf, 0x85,
+    0x80, 0x54, 0xd0, 0xe, 0x80, 0x38, 0x74, 0x42,
+    0x40, 0x14, 0x40, 0xbd, 0x2c, 0xca, 0xe3, 0x4,
+    0x70, 0x0, 0xe2, 0x0, 0xb4, 0xc9, 0x40, 0xf,
+    0x60, 0x18, 0x6e, 0xca, 0x40, 0x24, 0xdb, 0x0,
+    0x10,
 
     /* U+00F6 "ö" */
-    0x0, 0x0, 0xbe, 0x40, 0x8, 0xf7, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xa0, 0xe, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x9d, 0x30, 0x6, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+    0x0, 0xd7, 0xc8, 0x0, 0x8f, 0x70, 0xf, 0x85,
+    0x7, 0x80, 0xc, 0x14, 0x1, 0xf0, 0xb1, 0x48,
+    0x2, 0xa, 0xc0, 0x3f, 0x4e, 0x98, 0x1, 0xb5,
+    0x80, 0x3f, 0xfb, 0x89, 0x5b, 0xfd, 0xb0, 0x40,
+    0x1e, 0x1b, 0xb2, 0x90, 0x9, 0x3e, 0xc0, 0x6,
+    0x1f, 0x40, 0x16, 0x99, 0x28, 0x1, 0xec, 0x2,
+    0xa1, 0x5, 0xe9, 0x66, 0x57, 0x18, 0x23, 0x81,
+    0xa0, 0x1d, 0x0, 0x70, 0xe8, 0x84, 0x85, 0x80,
+    0x20, 0x3, 0xe1, 0x90, 0x15, 0x30, 0x2, 0x0,
+    0x7e, 0x40, 0x1, 0x38, 0x8, 0x7, 0xf0, 0x80,
+    0x39, 0xc0, 0x40, 0x3f, 0x84, 0x1, 0xc6, 0x0,
+    0x40, 0xf, 0xd6, 0x0, 0x2b, 0x0, 0x40, 0x7,
+    0xc2, 0xc0, 0x2a, 0x68, 0x7, 0x40, 0x1c, 0x3a,
+    0x21, 0x20, 0xa, 0x20, 0x5e, 0x96, 0x65, 0x71,
+    0x82, 0x38, 0x0, 0x71, 0x0, 0x5a, 0x64, 0xa0,
+    0x7, 0xb0, 0xc, 0x37, 0x65, 0x20, 0x12, 0x6d,
+    0x80, 0x8,
 
     /* U+00F7 "÷" */
-    0x0, 0x0, 0x0, 0x24, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xce, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x31, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xce, 0x40, 0x0,
-    0x0,
+    0x0, 0xf1, 0x20, 0x7, 0xfc, 0x7b, 0x70, 0x1,
+    0xfe, 0x50, 0x1, 0x80, 0x7f, 0x9c, 0xc7, 0xc0,
+    0x3f, 0xc3, 0x9c, 0x80, 0x1f, 0xfc, 0x83, 0x3f,
+    0xfc, 0x25, 0x99, 0xff, 0x9c, 0x3, 0xff, 0x84,
+    0x5f, 0xff, 0xf9, 0x80, 0x3f, 0xf9, 0x4, 0x80,
+    0x1f, 0xf1, 0xed, 0xc0, 0x7, 0xf9, 0x40, 0x6,
+    0x1, 0xfe, 0x73, 0x1f, 0x0, 0xe0,
 
     /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x89, 0xf4, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x5, 0xff, 0xff, 0x70,
-    0x3f, 0xfc, 0x0, 0x0, 0x1e, 0xa1, 0xef, 0xe0,
-    0x8f, 0xf4, 0x0, 0x0, 0xae, 0x10, 0x7f, 0xf5,
-    0xbf, 0xf0, 0x0, 0x4, 0xf5, 0x0, 0x3f, 0xf7,
-    0xcf, 0xe0, 0x0, 0xe, 0xb0, 0x0, 0x2f, 0xf9,
-    0xbf, 0xf0, 0x0, 0x9f, 0x10, 0x0, 0x3f, 0xf7,
-    0x8f, 0xf4, 0x4, 0xf6, 0x0, 0x0, 0x8f, 0xf5,
-    0x3f, 0xfc, 0xd, 0xc0, 0x0, 0x1, 0xef, 0xe0,
-    0xb, 0xff, 0xff, 0x20, 0x0, 0x1c, 0xff, 0x70,
-    0x1, 0xdf, 0xff, 0x96, 0x6a, 0xff, 0xfb, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x8f, 0x7a, 0xdf, 0xed, 0x92, 0x0, 0x0,
-    0x2, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc5, 0xf0, 0x1, 0xff, 0xc1, 0xe2,
+    0x80, 0xe, 0x4a, 0xdf, 0xed, 0x89, 0x39, 0x0,
+    0xc3, 0x76, 0x52, 0x1, 0x27, 0x60, 0x40, 0x8,
+    0x7d, 0x0, 0x5a, 0x64, 0xa0, 0x15, 0x80, 0x54,
+    0x20, 0xbd, 0x2c, 0xcf, 0x0, 0x91, 0xc0, 0xd0,
+    0xe, 0x80, 0x21, 0xb5, 0xe1, 0x9, 0xb, 0x0,
+    0x40, 0x6, 0xb0, 0xb1, 0x90, 0x15, 0x30, 0x2,
+    0x0, 0x48, 0xb6, 0x20, 0x80, 0x2, 0x70, 0x10,
+    0xd, 0x48, 0xa0, 0x1, 0x0, 0x73, 0x80, 0x80,
+    0x52, 0x34, 0x1, 0x8, 0x3, 0x8c, 0x0, 0x80,
+    0x8d, 0x22, 0x1, 0x58, 0x0, 0xac, 0x1, 0x1,
+    0x26, 0xc0, 0x10, 0xb0, 0xa, 0x9a, 0x1, 0xf9,
+    0x70, 0x4, 0x3a, 0x21, 0x20, 0xa, 0x20, 0xa,
+    0xd9, 0x95, 0xc6, 0x8, 0xe0, 0x1, 0xc0, 0x9,
+    0xa6, 0x4a, 0x0, 0x7b, 0x0, 0xd2, 0x10, 0xa4,
+    0x2, 0x4d, 0xb0, 0x1, 0x89, 0xde, 0xad, 0xfe,
+    0xd9, 0x20, 0xe, 0xe2, 0x80, 0xf, 0xfc,
 
     /* U+00F9 "ù" */
-    0x0, 0x3e, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xcb, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x68, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0x61,
-    0xff, 0xe2, 0x0, 0x0, 0xa, 0xff, 0xf6, 0x8,
-    0xff, 0xe8, 0x44, 0x6d, 0xff, 0xff, 0x60, 0xa,
-    0xff, 0xff, 0xff, 0xfe, 0x5f, 0xf6, 0x0, 0x4,
-    0xae, 0xfe, 0xc7, 0x2, 0xff, 0x60,
+    0x0, 0x1f, 0x7f, 0x90, 0x3, 0xfc, 0x7e, 0x61,
+    0x68, 0x1, 0xfe, 0x1c, 0x60, 0xb4, 0x0, 0xff,
+    0xa6, 0x47, 0xe4, 0x1, 0xff, 0x36, 0x59, 0x0,
+    0x7f, 0xf2, 0x27, 0xfc, 0x20, 0x1f, 0x2f, 0xf9,
+    0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0x11, 0x0,
+    0x10, 0x7, 0xda, 0x1, 0x68, 0x1, 0x0, 0x3e,
+    0x60, 0x9, 0x0, 0x12, 0x40, 0x1d, 0x42, 0x1,
+    0xb, 0x80, 0xe4, 0x22, 0x1b, 0x54, 0x3, 0xa1,
+    0x40, 0x5e, 0xed, 0x24, 0x34, 0x1, 0xd5, 0x6a,
+    0x20, 0x27, 0x1c, 0xe0, 0x10,
 
     /* U+00FA "ú" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0xc3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x68, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0x61,
-    0xff, 0xe2, 0x0, 0x0, 0xa, 0xff, 0xf6, 0x8,
-    0xff, 0xe8, 0x44, 0x6d, 0xff, 0xff, 0x60, 0xa,
-    0xff, 0xff, 0xff, 0xfe, 0x5f, 0xf6, 0x0, 0x4,
-    0xae, 0xfe, 0xc7, 0x2, 0xff, 0x60,
+    0x0, 0xfc, 0xdf, 0xec, 0x10, 0xf, 0xe6, 0x90,
+    0x5c, 0x10, 0xf, 0xcd, 0x21, 0x34, 0x1, 0xfc,
+    0x74, 0x78, 0xc0, 0x1f, 0xe3, 0xcc, 0x18, 0x7,
+    0xff, 0x26, 0x7f, 0xc2, 0x1, 0xf2, 0xff, 0x98,
+    0x3, 0xff, 0xfe, 0x1, 0xff, 0xe1, 0x10, 0x1,
+    0x0, 0x7d, 0xa0, 0x16, 0x80, 0x10, 0x3, 0xe6,
+    0x0, 0x90, 0x1, 0x24, 0x1, 0xd4, 0x20, 0x10,
+    0xb8, 0xe, 0x42, 0x21, 0xb5, 0x40, 0x3a, 0x14,
+    0x5, 0xee, 0xd2, 0x43, 0x40, 0x1d, 0x56, 0xa2,
+    0x2, 0x71, 0xce, 0x1,
 
     /* U+00FB "û" */
-    0x0, 0x0, 0x6, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xcf, 0xf3, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x50, 0x7f, 0xf3, 0x0, 0x0, 0x2,
-    0xcc, 0x30, 0x0, 0x5c, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x68, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0x61,
-    0xff, 0xe2, 0x0, 0x0, 0xa, 0xff, 0xf6, 0x8,
-    0xff, 0xe8, 0x44, 0x6d, 0xff, 0xff, 0x60, 0xa,
-    0xff, 0xff, 0xff, 0xfe, 0x5f, 0xf6, 0x0, 0x4,
-    0xae, 0xfe, 0xc7, 0x2, 0xff, 0x60,
+    0x0, 0xe6, 0xff, 0x8c, 0x3, 0xf9, 0x64, 0xc,
+    0x30, 0xc0, 0x3e, 0x5a, 0xa, 0xc8, 0xc, 0x30,
+    0xe, 0x29, 0x3c, 0x50, 0x7a, 0x38, 0x10, 0xc,
+    0x59, 0x83, 0x0, 0x97, 0x2c, 0x40, 0x3f, 0xf8,
+    0xb3, 0xfe, 0x10, 0xf, 0x97, 0xfc, 0xc0, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0x8, 0x80, 0x8, 0x3,
+    0xed, 0x0, 0xb4, 0x0, 0x80, 0x1f, 0x30, 0x4,
+    0x80, 0x9, 0x20, 0xe, 0xa1, 0x0, 0x85, 0xc0,
+    0x72, 0x11, 0xd, 0xaa, 0x1, 0xd0, 0xa0, 0x2f,
+    0x76, 0x92, 0x1a, 0x0, 0xea, 0xb5, 0x10, 0x13,
+    0x8e, 0x70, 0x8,
 
     /* U+00FC "ü" */
-    0x0, 0x3, 0xeb, 0x0, 0x1d, 0xd1, 0x0, 0x0,
-    0x0, 0x9f, 0xf2, 0x6, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0xca, 0x0, 0x1b, 0xc1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x69, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5f,
-    0xf6, 0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x68, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf6,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0x61,
-    0xff, 0xe2, 0x0, 0x0, 0xa, 0xff, 0xf6, 0x8,
-    0xff, 0xe8, 0x44, 0x6d, 0xff, 0xff, 0x60, 0xa,
-    0xff, 0xff, 0xff, 0xfe, 0x5f, 0xf6, 0x0, 0x4,
-    0xae, 0xfe, 0xc7, 0x2, 0xff, 0x60,
+    0x0, 0x8f, 0xac, 0x0, 0x3b, 0xa1, 0x0, 0xf5,
+    0xa, 0x10, 0x39, 0x11, 0xc0, 0x3d, 0x46, 0xa4,
+    0xe, 0x86, 0xe0, 0x1e, 0x3c, 0xa0, 0x0, 0xde,
+    0x8, 0x7, 0xff, 0x56, 0x7f, 0xc2, 0x1, 0xf2,
+    0xff, 0x98, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xe1,
+    0x10, 0x1, 0x0, 0x7d, 0xa0, 0x16, 0x80, 0x10,
+    0x3, 0xe6, 0x0, 0x90, 0x1, 0x24, 0x1, 0xd4,
+    0x20, 0x10, 0xb8, 0xe, 0x42, 0x21, 0xb5, 0x40,
+    0x3a, 0x14, 0x5, 0xee, 0xd2, 0x43, 0x40, 0x1d,
+    0x56, 0xa2, 0x2, 0x71, 0xce, 0x1,
 
     /* U+00FD "ý" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xcc, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf0, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x7, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x10, 0x4, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf0, 0x2f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x79, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x65, 0xaf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x5f, 0xf6, 0x90, 0x7, 0xfc, 0xb4,
+    0xb, 0xa4, 0x1, 0xfe, 0x6a, 0x8, 0xa0, 0xf,
+    0xf8, 0xe8, 0xed, 0xc0, 0x3f, 0xf1, 0xe6, 0x10,
+    0x3, 0xff, 0x9b, 0xbf, 0xc0, 0x1f, 0xc5, 0xfe,
+    0x70, 0xb0, 0x16, 0x0, 0xfd, 0x60, 0x7, 0x6,
+    0x10, 0xb0, 0xf, 0x85, 0x81, 0xc0, 0x29, 0x2,
+    0x50, 0xf, 0x48, 0x2, 0x40, 0x26, 0x0, 0x48,
+    0x7, 0x98, 0x14, 0x40, 0x21, 0x60, 0x33, 0x0,
+    0x66, 0x10, 0x90, 0xe, 0xb0, 0x4, 0x80, 0x6b,
+    0x3, 0x30, 0x7, 0x12, 0x82, 0x88, 0x1, 0x8,
+    0x20, 0x3, 0xe9, 0x0, 0x48, 0x3, 0xc0, 0x90,
+    0x3, 0xe3, 0x30, 0x38, 0x12, 0x5, 0x80, 0x7f,
+    0x40, 0x1, 0xec, 0x5, 0x80, 0x3f, 0x90, 0x82,
+    0x58, 0x24, 0x3, 0xfe, 0xb0, 0x10, 0x3, 0x0,
+    0x7f, 0xcc, 0x20, 0x6, 0x10, 0xf, 0xfc, 0xe0,
+    0xb, 0x0, 0xff, 0xc2, 0xc0, 0x84, 0x1, 0xf0,
+    0x80, 0x68, 0x0, 0x40, 0x7, 0xef, 0xb6, 0x5a,
+    0x60, 0x53, 0x0, 0xf9, 0x85, 0x26, 0x94, 0xa,
+    0xc0, 0x3f, 0x34, 0x98, 0x0, 0xa3, 0x44, 0x3,
+    0xf0,
 
     /* U+00FE "þ" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x6, 0xbe, 0xfd, 0xb5, 0x0, 0x0,
-    0x7f, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
-    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xf5,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
-    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
-    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
-    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
-    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
-    0x7f, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x7f, 0xf3, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0x4d, 0x7d, 0xfb, 0x6a, 0x1, 0xf3, 0x64, 0xa0,
+    0x81, 0x25, 0x69, 0x0, 0x75, 0x98, 0x2c, 0x4b,
+    0x88, 0x16, 0x90, 0x6, 0x12, 0xda, 0x76, 0x8e,
+    0x60, 0x7, 0x80, 0x77, 0x90, 0x7, 0x4a, 0x81,
+    0x28, 0x4, 0xc4, 0x1, 0xf4, 0x0, 0x3c, 0x2,
+    0xc0, 0xf, 0xc4, 0x20, 0xc0, 0x13, 0x0, 0x7f,
+    0x18, 0x10, 0x4, 0xc0, 0x1f, 0xc6, 0x4, 0x1,
+    0x60, 0x7, 0xe3, 0x10, 0x60, 0x9, 0x88, 0x3,
+    0xe8, 0x0, 0x78, 0x6, 0xf2, 0x0, 0xe9, 0x40,
+    0x25, 0x0, 0x84, 0xb6, 0x9d, 0xa3, 0x98, 0x1,
+    0xe0, 0x1a, 0x8c, 0x16, 0x25, 0xc4, 0xb, 0x48,
+    0x3, 0x3e, 0x52, 0x8, 0xa, 0x56, 0x90, 0x7,
+    0xcb, 0x7d, 0xfd, 0x6a, 0x1, 0xff, 0xf8,
 
     /* U+00FF "ÿ" */
-    0x0, 0x0, 0x3e, 0xc0, 0x1, 0xdd, 0x20, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x30, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x2c, 0xa0, 0x0, 0xbc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x70, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xf0, 0x0, 0xef, 0xd0, 0x0,
-    0x0, 0x0, 0x1f, 0xf8, 0x0, 0x7, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0x1f, 0xfc,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x9f,
-    0xf3, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x2,
-    0xff, 0xa0, 0x0, 0xd, 0xfc, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x10, 0x4, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x3f, 0xf8, 0x0, 0xbf, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xf0, 0x2f, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0x79, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfe, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x9f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0xeb, 0x65, 0xaf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xd7,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc7, 0xd8, 0x0, 0x1d, 0xd1, 0x0, 0x7e,
+    0xb1, 0x33, 0x2, 0x11, 0x10, 0x3, 0xf5, 0x1a,
+    0x98, 0x2a, 0x1b, 0x80, 0x7e, 0x2c, 0xa0, 0xa,
+    0xf0, 0x40, 0x3f, 0xfb, 0x7b, 0xfc, 0x1, 0xfc,
+    0x5f, 0xe7, 0xb, 0x1, 0x60, 0xf, 0xd6, 0x0,
+    0x70, 0x61, 0xb, 0x0, 0xf8, 0x58, 0x1c, 0x2,
+    0x90, 0x25, 0x0, 0xf4, 0x80, 0x24, 0x2, 0x60,
+    0x4, 0x80, 0x79, 0x81, 0x44, 0x2, 0x16, 0x3,
+    0x30, 0x6, 0x61, 0x9, 0x0, 0xeb, 0x0, 0x48,
+    0x6, 0xb0, 0x33, 0x0, 0x71, 0x28, 0x28, 0x80,
+    0x10, 0x82, 0x0, 0x3e, 0x90, 0x4, 0x80, 0x3c,
+    0x9, 0x0, 0x3e, 0x33, 0x3, 0x81, 0x20, 0x58,
+    0x7, 0xf4, 0x0, 0x1e, 0xc0, 0x58, 0x3, 0xf9,
+    0x8, 0x25, 0x82, 0x40, 0x3f, 0xeb, 0x1, 0x0,
+    0x30, 0x7, 0xfc, 0xc2, 0x0, 0x61, 0x0, 0xff,
+    0xce, 0x0, 0xb0, 0xf, 0xfc, 0x2c, 0x8, 0x40,
+    0x1f, 0x8, 0x6, 0x80, 0x4, 0x0, 0x7e, 0xfb,
+    0x65, 0xa6, 0x5, 0x30, 0xf, 0x98, 0x52, 0x69,
+    0x40, 0xac, 0x3, 0xf3, 0x49, 0x80, 0xa, 0x34,
+    0x40, 0x3f,
 
     /* U+2022 "•" */
-    0x0, 0x1, 0x0, 0x4, 0xef, 0xc1, 0xe, 0xff,
-    0xfb, 0x1f, 0xff, 0xfd, 0xe, 0xff, 0xfa, 0x3,
-    0xcf, 0xb1
+    0x0, 0x84, 0x2, 0x4e, 0xe6, 0x8, 0x50, 0x81,
+    0xd0, 0x88, 0x2, 0x61, 0x10, 0x4, 0xe1, 0xa6,
+    0x9, 0x60,
+
+    /* padding */
+    0x0
 };
 
 
@@ -4031,196 +2743,196 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 120, .box_w = 5, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 50, .adv_w = 175, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 86, .adv_w = 315, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 276, .adv_w = 278, .box_w = 16, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 484, .adv_w = 378, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 704, .adv_w = 307, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 893, .adv_w = 94, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 909, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1000, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 1091, .adv_w = 179, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 1152, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 1243, .adv_w = 102, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 1263, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1277, .adv_w = 102, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1287, .adv_w = 158, .box_w = 12, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
-    {.bitmap_index = 1449, .adv_w = 299, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1619, .adv_w = 166, .box_w = 8, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1699, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1859, .adv_w = 256, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2009, .adv_w = 300, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2189, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2349, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2509, .adv_w = 268, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2669, .adv_w = 289, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2829, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2989, .adv_w = 102, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3027, .adv_w = 102, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3075, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 3166, .adv_w = 261, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 3229, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 3320, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3470, .adv_w = 463, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 3808, .adv_w = 328, .box_w = 22, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 4028, .adv_w = 339, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4208, .adv_w = 324, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4398, .adv_w = 370, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4598, .adv_w = 300, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4758, .adv_w = 284, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 4908, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5098, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5278, .adv_w = 139, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5318, .adv_w = 230, .box_w = 13, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 5448, .adv_w = 322, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5638, .adv_w = 266, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5788, .adv_w = 428, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6008, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6188, .adv_w = 376, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6408, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6578, .adv_w = 376, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6854, .adv_w = 326, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7034, .adv_w = 278, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7194, .adv_w = 263, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7364, .adv_w = 354, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7544, .adv_w = 319, .box_w = 21, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 7754, .adv_w = 504, .box_w = 31, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8064, .adv_w = 302, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8254, .adv_w = 290, .box_w = 20, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8454, .adv_w = 294, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8624, .adv_w = 149, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 8715, .adv_w = 158, .box_w = 13, .box_h = 27, .ofs_x = -2, .ofs_y = -3},
-    {.bitmap_index = 8891, .adv_w = 149, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 8982, .adv_w = 261, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 9060, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 9074, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 3, .ofs_y = 17},
-    {.bitmap_index = 9090, .adv_w = 268, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9195, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9363, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9476, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9644, .adv_w = 274, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9757, .adv_w = 158, .box_w = 11, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9873, .adv_w = 309, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10033, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10191, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10233, .adv_w = 127, .box_w = 9, .box_h = 26, .ofs_x = -3, .ofs_y = -5},
-    {.bitmap_index = 10350, .adv_w = 276, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10518, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10560, .adv_w = 474, .box_w = 26, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10755, .adv_w = 305, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10868, .adv_w = 284, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10988, .adv_w = 306, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 11148, .adv_w = 306, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 11308, .adv_w = 184, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11376, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11481, .adv_w = 185, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11586, .adv_w = 303, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11699, .adv_w = 250, .box_w = 17, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 11827, .adv_w = 403, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12015, .adv_w = 247, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12135, .adv_w = 250, .box_w = 17, .box_h = 20, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 12305, .adv_w = 233, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12403, .adv_w = 157, .box_w = 9, .box_h = 26, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 12520, .adv_w = 134, .box_w = 4, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 12572, .adv_w = 157, .box_w = 9, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 12689, .adv_w = 261, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 12724, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12724, .adv_w = 120, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 12772, .adv_w = 256, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 12937, .adv_w = 289, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13117, .adv_w = 314, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13298, .adv_w = 317, .box_w = 21, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 13508, .adv_w = 134, .box_w = 4, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 13560, .adv_w = 224, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 13721, .adv_w = 269, .box_w = 9, .box_h = 3, .ofs_x = 4, .ofs_y = 17},
-    {.bitmap_index = 13735, .adv_w = 359, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 13966, .adv_w = 181, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 14011, .adv_w = 226, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 14083, .adv_w = 261, .box_w = 14, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
-    {.bitmap_index = 14139, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 14153, .adv_w = 359, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14384, .adv_w = 269, .box_w = 10, .box_h = 2, .ofs_x = 3, .ofs_y = 18},
-    {.bitmap_index = 14394, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 14444, .adv_w = 261, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14563, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 14629, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
-    {.bitmap_index = 14695, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 6, .ofs_y = 17},
-    {.bitmap_index = 14711, .adv_w = 306, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 14861, .adv_w = 290, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 15053, .adv_w = 120, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 15063, .adv_w = 269, .box_w = 7, .box_h = 7, .ofs_x = 5, .ofs_y = -6},
-    {.bitmap_index = 15088, .adv_w = 193, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 15142, .adv_w = 187, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 15192, .adv_w = 226, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 15264, .adv_w = 463, .box_w = 27, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15534, .adv_w = 463, .box_w = 26, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15794, .adv_w = 463, .box_w = 29, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 16084, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 16234, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 16509, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 16784, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17059, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17334, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17609, .adv_w = 328, .box_w = 22, .box_h = 29, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 17928, .adv_w = 469, .box_w = 29, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18218, .adv_w = 324, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 18465, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18665, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18865, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19065, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19265, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 19365, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19465, .adv_w = 139, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 19603, .adv_w = 139, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19716, .adv_w = 374, .box_w = 23, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19946, .adv_w = 364, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 20171, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20446, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20721, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20996, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21271, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 21546, .adv_w = 261, .box_w = 11, .box_h = 12, .ofs_x = 3, .ofs_y = 4},
-    {.bitmap_index = 21612, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21876, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22101, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22326, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22551, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 22776, .adv_w = 290, .box_w = 20, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 23026, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23196, .adv_w = 303, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23364, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23511, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23658, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23805, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 23952, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24099, .adv_w = 268, .box_w = 14, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24267, .adv_w = 443, .box_w = 26, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24462, .adv_w = 256, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 24620, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24778, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24936, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25094, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25252, .adv_w = 125, .box_w = 8, .box_h = 21, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 25336, .adv_w = 125, .box_w = 9, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25431, .adv_w = 125, .box_w = 10, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 25536, .adv_w = 125, .box_w = 8, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25620, .adv_w = 287, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 25788, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25946, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26114, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26282, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26450, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26618, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 26786, .adv_w = 261, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 26891, .adv_w = 284, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 27043, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27201, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27359, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27517, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 27675, .adv_w = 250, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 27896, .adv_w = 306, .box_w = 16, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 28104, .adv_w = 250, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 28325, .adv_w = 141, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 5}
+    {.bitmap_index = 41, .adv_w = 175, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 66, .adv_w = 315, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 195, .adv_w = 278, .box_w = 16, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 337, .adv_w = 378, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 520, .adv_w = 307, .box_w = 18, .box_h = 21, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 681, .adv_w = 94, .box_w = 4, .box_h = 8, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 693, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 772, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 851, .adv_w = 179, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 10},
+    {.bitmap_index = 903, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 936, .adv_w = 102, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 957, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 965, .adv_w = 102, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 976, .adv_w = 158, .box_w = 12, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 1079, .adv_w = 299, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1217, .adv_w = 166, .box_w = 8, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1234, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1348, .adv_w = 256, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1456, .adv_w = 300, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1551, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1662, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1798, .adv_w = 268, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1894, .adv_w = 289, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2037, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2170, .adv_w = 102, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2196, .adv_w = 102, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2232, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2302, .adv_w = 261, .box_w = 14, .box_h = 9, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 2328, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2399, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2499, .adv_w = 463, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 2774, .adv_w = 328, .box_w = 22, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2919, .adv_w = 339, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3035, .adv_w = 324, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3170, .adv_w = 370, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3290, .adv_w = 300, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3338, .adv_w = 284, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3377, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3516, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3548, .adv_w = 139, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3554, .adv_w = 230, .box_w = 13, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3608, .adv_w = 322, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3731, .adv_w = 266, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3757, .adv_w = 428, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3886, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3989, .adv_w = 376, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4156, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4241, .adv_w = 376, .box_w = 23, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4450, .adv_w = 326, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4559, .adv_w = 278, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4689, .adv_w = 263, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4721, .adv_w = 354, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4797, .adv_w = 319, .box_w = 21, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4944, .adv_w = 504, .box_w = 31, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5180, .adv_w = 302, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5325, .adv_w = 290, .box_w = 20, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5430, .adv_w = 294, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5528, .adv_w = 149, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5552, .adv_w = 158, .box_w = 13, .box_h = 27, .ofs_x = -2, .ofs_y = -3},
+    {.bitmap_index = 5658, .adv_w = 149, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 5681, .adv_w = 261, .box_w = 13, .box_h = 12, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 5744, .adv_w = 224, .box_w = 14, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 5751, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 3, .ofs_y = 17},
+    {.bitmap_index = 5766, .adv_w = 268, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5859, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5963, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6056, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6162, .adv_w = 274, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6256, .adv_w = 158, .box_w = 11, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6308, .adv_w = 309, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6447, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6509, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6526, .adv_w = 127, .box_w = 9, .box_h = 26, .ofs_x = -3, .ofs_y = -5},
+    {.bitmap_index = 6572, .adv_w = 276, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6659, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6666, .adv_w = 474, .box_w = 26, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6761, .adv_w = 305, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6817, .adv_w = 284, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6921, .adv_w = 306, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 7027, .adv_w = 306, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7135, .adv_w = 184, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7165, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7260, .adv_w = 185, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7311, .adv_w = 303, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7362, .adv_w = 250, .box_w = 17, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7460, .adv_w = 403, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7615, .adv_w = 247, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7713, .adv_w = 250, .box_w = 17, .box_h = 20, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 7840, .adv_w = 233, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7905, .adv_w = 157, .box_w = 9, .box_h = 26, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7965, .adv_w = 134, .box_w = 4, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 7974, .adv_w = 157, .box_w = 9, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 8028, .adv_w = 261, .box_w = 14, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
+    {.bitmap_index = 8063, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8063, .adv_w = 120, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 8104, .adv_w = 256, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 8215, .adv_w = 289, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8311, .adv_w = 314, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8461, .adv_w = 317, .box_w = 21, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8596, .adv_w = 134, .box_w = 4, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 8615, .adv_w = 224, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 8761, .adv_w = 269, .box_w = 9, .box_h = 3, .ofs_x = 4, .ofs_y = 17},
+    {.bitmap_index = 8775, .adv_w = 359, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 8965, .adv_w = 181, .box_w = 9, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 9010, .adv_w = 226, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 9078, .adv_w = 261, .box_w = 14, .box_h = 8, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 9094, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 9102, .adv_w = 359, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 9281, .adv_w = 269, .box_w = 10, .box_h = 2, .ofs_x = 3, .ofs_y = 18},
+    {.bitmap_index = 9286, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 11},
+    {.bitmap_index = 9332, .adv_w = 261, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9375, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 9431, .adv_w = 193, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 9},
+    {.bitmap_index = 9486, .adv_w = 269, .box_w = 8, .box_h = 4, .ofs_x = 6, .ofs_y = 17},
+    {.bitmap_index = 9502, .adv_w = 306, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 9557, .adv_w = 290, .box_w = 16, .box_h = 24, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 9616, .adv_w = 120, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 9626, .adv_w = 269, .box_w = 7, .box_h = 7, .ofs_x = 5, .ofs_y = -6},
+    {.bitmap_index = 9648, .adv_w = 193, .box_w = 9, .box_h = 12, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 9670, .adv_w = 187, .box_w = 11, .box_h = 9, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 9717, .adv_w = 226, .box_w = 13, .box_h = 11, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 9785, .adv_w = 463, .box_w = 27, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9943, .adv_w = 463, .box_w = 26, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10106, .adv_w = 463, .box_w = 29, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10304, .adv_w = 257, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 10402, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10575, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10747, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10927, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11108, .adv_w = 328, .box_w = 22, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11282, .adv_w = 328, .box_w = 22, .box_h = 29, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11475, .adv_w = 469, .box_w = 29, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 11610, .adv_w = 324, .box_w = 19, .box_h = 26, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 11779, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11851, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 11923, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12000, .adv_w = 300, .box_w = 16, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12075, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12105, .adv_w = 139, .box_w = 8, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12135, .adv_w = 139, .box_w = 11, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12174, .adv_w = 139, .box_w = 9, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12207, .adv_w = 374, .box_w = 23, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 12338, .adv_w = 364, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 12475, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12669, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12864, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13065, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13269, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13466, .adv_w = 261, .box_w = 11, .box_h = 12, .ofs_x = 3, .ofs_y = 4},
+    {.bitmap_index = 13527, .adv_w = 376, .box_w = 22, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 13740, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13844, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13947, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14055, .adv_w = 354, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14159, .adv_w = 290, .box_w = 20, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 14292, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14381, .adv_w = 303, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14503, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14620, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14736, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14859, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 14984, .adv_w = 268, .box_w = 14, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15102, .adv_w = 268, .box_w = 14, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15235, .adv_w = 443, .box_w = 26, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15401, .adv_w = 256, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 15523, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15642, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15761, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 15886, .adv_w = 274, .box_w = 15, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16007, .adv_w = 125, .box_w = 8, .box_h = 21, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 16036, .adv_w = 125, .box_w = 9, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16067, .adv_w = 125, .box_w = 10, .box_h = 21, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16102, .adv_w = 125, .box_w = 8, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 16130, .adv_w = 287, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16287, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 16377, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16505, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16634, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16769, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 16906, .adv_w = 284, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 17036, .adv_w = 261, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 17090, .adv_w = 284, .box_w = 16, .box_h = 19, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 17225, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17302, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17378, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17461, .adv_w = 303, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17539, .adv_w = 250, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 17692, .adv_w = 306, .box_w = 16, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 17803, .adv_w = 250, .box_w = 17, .box_h = 26, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 17957, .adv_w = 141, .box_w = 6, .box_h = 6, .ofs_x = 1, .ofs_y = 5}
 };
 
 /*---------------------
@@ -4882,7 +3594,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
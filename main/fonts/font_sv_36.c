@@ -1,7 +1,8 @@
 /*******************************************************************************
  * Size: 36 px
  * Bpp: 4
- * Opts: --no-compress --no-prefilter --bpp 4 --size 36 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_36.c --force-fast-kern-format
+ * Compressed: tools/fonts/fontpack.py (prefilter + RLE)
+ * Opts: --bpp 4 --size 36 --font /Users/andersbratland/@code/ESP32/smart-home-panel/managed_components/lvgl__lvgl/scripts/built_in_font/Montserrat-Medium.ttf -r 0x20-0x7F,0xA0-0xFF,0x2022 --format lvgl -o /Users/andersbratland/@code/ESP32/smart-home-panel/main/fonts/font_sv_36.c --force-fast-kern-format
  ******************************************************************************/
 
 #include "lvgl.h"
@@ -21,6121 +22,3683 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0020 " " */
 
     /* U+0021 "!" */
-    0x2f, 0xff, 0xd0, 0x2f, 0xff, 0xd0, 0x1f, 0xff,
-    0xc0, 0xf, 0xff, 0xb0, 0xf, 0xff, 0xb0, 0xf,
-    0xff, 0xa0, 0xf, 0xff, 0x90, 0xe, 0xff, 0x90,
-    0xd, 0xff, 0x80, 0xd, 0xff, 0x70, 0xc, 0xff,
-    0x70, 0xc, 0xff, 0x60, 0xb, 0xff, 0x50, 0xa,
-    0xff, 0x50, 0xa, 0xff, 0x40, 0x9, 0xff, 0x30,
-    0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x76, 0x0, 0x2f,
-    0xff, 0xc0, 0x7f, 0xff, 0xf1, 0x5f, 0xff, 0xf0,
-    0x8, 0xed, 0x40,
+    0x2f, 0xfb, 0x40, 0x3e, 0x30, 0x8, 0x40, 0x40,
+    0x27, 0x0, 0xff, 0x84, 0x3, 0x8c, 0x0, 0x20,
+    0x1c, 0x60, 0x1, 0x0, 0xef, 0x0, 0x8, 0x7,
+    0xe1, 0x0, 0x38, 0x0, 0xc0, 0x2, 0x1, 0xf8,
+    0x40, 0x6, 0x0, 0x70, 0xf, 0xd3, 0xfe, 0x30,
+    0xf, 0xfe, 0x11, 0x3b, 0x0, 0xb, 0x62, 0x70,
+    0x14, 0x2, 0x31, 0x20, 0xc, 0x2a, 0xe2, 0x56,
+    0x0,
 
     /* U+0022 "\"" */
-    0xbf, 0xf4, 0x0, 0x3f, 0xfc, 0xbf, 0xf4, 0x0,
-    0x3f, 0xfc, 0xaf, 0xf3, 0x0, 0x2f, 0xfb, 0xaf,
-    0xf3, 0x0, 0x2f, 0xfb, 0xaf, 0xf2, 0x0, 0x1f,
-    0xfb, 0x9f, 0xf2, 0x0, 0x1f, 0xfa, 0x9f, 0xf2,
-    0x0, 0x1f, 0xfa, 0x9f, 0xf1, 0x0, 0xf, 0xf9,
-    0x8f, 0xf1, 0x0, 0xf, 0xf9, 0x49, 0x90, 0x0,
-    0x9, 0x95,
+    0xbf, 0xf2, 0x0, 0xf, 0xfd, 0x80, 0x1f, 0xe1,
+    0x0, 0x38, 0x0, 0x40, 0xe, 0x1, 0xff, 0xc1,
+    0x10, 0x1, 0x80, 0x46, 0x1, 0xf8, 0x40, 0x3f,
+    0xf8, 0x26, 0x0, 0x10, 0x1, 0x88, 0x7, 0xf6,
+    0x33, 0x4, 0x2, 0x66, 0x60,
 
     /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0x0, 0x0,
-    0x7, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x80, 0x0,
-    0x0, 0xb, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x30,
-    0x0, 0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xf1, 0x0, 0x0, 0x1, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x89, 0x99, 0x9f,
-    0xfe, 0x99, 0x99, 0x99, 0xdf, 0xf9, 0x99, 0x99,
-    0x30, 0x0, 0x0, 0x0, 0xff, 0x90, 0x0, 0x0,
-    0x9, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xf7, 0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x50, 0x0,
-    0x0, 0xd, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10,
-    0x0, 0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf0, 0x0, 0x0, 0x3, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xfd,
-    0x0, 0x0, 0x0, 0x5f, 0xf3, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x9, 0x99, 0x9a, 0xff, 0xc9, 0x99, 0x99,
-    0x9e, 0xfe, 0x99, 0x99, 0x91, 0x0, 0x0, 0x0,
-    0x2f, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x40, 0x0,
-    0x0, 0xf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xf2, 0x0, 0x0, 0x0, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xe0, 0x0, 0x0, 0x4, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfc,
-    0x0, 0x0, 0x0, 0x6f, 0xf1, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xfd, 0x9f, 0x80, 0x1e, 0x7f, 0xf0, 0x80,
+    0x7f, 0xe2, 0x6, 0x0, 0xf7, 0x0, 0x4, 0x3,
+    0xff, 0x8, 0x10, 0x7, 0x88, 0x8, 0x3, 0xff,
+    0x18, 0x3, 0x80, 0x3c, 0xc0, 0xc0, 0x1f, 0xf9,
+    0x80, 0xa, 0x1, 0xe2, 0x2, 0x0, 0xff, 0xc4,
+    0x0, 0x20, 0xe, 0x10, 0x7, 0x0, 0x7d, 0xdf,
+    0xfa, 0x0, 0x1d, 0xff, 0xdc, 0x0, 0x8f, 0xfc,
+    0xa0, 0x1f, 0xfc, 0xf6, 0x6e, 0x0, 0xb, 0x37,
+    0x88, 0x0, 0xcd, 0xe0, 0x4, 0x4c, 0xe0, 0x3,
+    0xcc, 0xf9, 0x0, 0x13, 0x3c, 0x60, 0x1e, 0x10,
+    0x7, 0x0, 0x78, 0x80, 0x80, 0x3f, 0xf1, 0x0,
+    0x8, 0x3, 0xcc, 0xc, 0x1, 0xff, 0x98, 0x0,
+    0xc0, 0x1e, 0x20, 0x20, 0xf, 0xfc, 0x60, 0x2,
+    0x0, 0xe1, 0x0, 0x70, 0x7, 0xfe, 0xe0, 0x0,
+    0x80, 0x71, 0x0, 0x8, 0x3, 0xff, 0x10, 0x10,
+    0x7, 0x98, 0x0, 0xc0, 0x1f, 0x7f, 0xf2, 0x81,
+    0x7f, 0xfa, 0x80, 0x19, 0xff, 0x8c, 0x3, 0xff,
+    0x9e, 0xcd, 0x94, 0x0, 0x6c, 0xde, 0x10, 0x16,
+    0x6e, 0x20, 0x4, 0xce, 0x80, 0x5, 0x4c, 0xf8,
+    0xc1, 0x66, 0x78, 0x40, 0x3c, 0xc0, 0x2, 0x0,
+    0xf1, 0x1, 0x0, 0x7f, 0xe2, 0x0, 0x30, 0x7,
+    0xee, 0x0, 0xff, 0xdc, 0x0, 0x20, 0xe, 0x20,
+    0x1, 0x0, 0x7f, 0xe2, 0x1, 0x0, 0xf3, 0x0,
+    0x18, 0x3, 0xff, 0x30, 0x10, 0x7, 0x88, 0x0,
+    0x40, 0x1f,
 
     /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x84, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xef, 0xff,
-    0xed, 0xa6, 0x10, 0x0, 0x0, 0x1, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0xdf, 0xff, 0xc6, 0x2c, 0xf9, 0x24, 0x8d,
-    0xff, 0x40, 0x6, 0xff, 0xf9, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x4a, 0x0, 0xb, 0xff, 0xe0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xa0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xb0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf2, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x60,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xfe, 0xae, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xfe, 0x95, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x27,
-    0xbf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfc, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x2, 0x9f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0xaf, 0xfd,
-    0x4, 0x30, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0xef, 0xfb, 0xc, 0xf9, 0x10, 0x0, 0xc, 0xf8,
-    0x0, 0x9, 0xff, 0xf6, 0x4f, 0xff, 0xfa, 0x62,
-    0x1c, 0xf8, 0x15, 0xcf, 0xff, 0xd0, 0x1b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x0, 0x37, 0xbd, 0xff, 0xff,
-    0xec, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf8,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x68, 0x40, 0xf, 0xfe, 0x2d, 0x3e,
+    0x0, 0x7f, 0xff, 0x4a, 0x33, 0x8c, 0x1f, 0xb6,
+    0x98, 0x40, 0x3c, 0x37, 0xae, 0x62, 0x1, 0x9,
+    0x2c, 0xf5, 0x8, 0x4, 0x5e, 0x80, 0x1f, 0xf9,
+    0x6c, 0x2, 0xf1, 0x0, 0x1c, 0xe9, 0x83, 0x6d,
+    0xb9, 0x0, 0x38, 0x0, 0xc4, 0x0, 0x6c, 0x62,
+    0x0, 0x9, 0x24, 0x6d, 0xaa, 0x0, 0x34, 0x0,
+    0x32, 0x1, 0xfe, 0x4a, 0x0, 0x98, 0x0, 0x80,
+    0x1f, 0xfc, 0x71, 0x0, 0xff, 0xe2, 0x30, 0x1,
+    0x8, 0x3, 0xff, 0x87, 0xa0, 0x16, 0x30, 0x7,
+    0xff, 0x9, 0x8c, 0x0, 0x33, 0xd4, 0x40, 0x1f,
+    0xfb, 0x10, 0x2, 0x15, 0x10, 0x69, 0x50, 0xf,
+    0xeb, 0xa3, 0x0, 0xe1, 0x6a, 0xfa, 0x20, 0xf,
+    0x97, 0x36, 0x10, 0x3, 0xcb, 0xb0, 0x1, 0xf8,
+    0x9e, 0xcc, 0xc, 0xc0, 0x19, 0xe8, 0x3, 0xff,
+    0x26, 0x6b, 0x0, 0x4a, 0xa0, 0xf, 0xfe, 0x9,
+    0x4d, 0x0, 0x5e, 0x1, 0xff, 0xc3, 0x53, 0x0,
+    0x38, 0x7, 0xff, 0x11, 0x80, 0x32, 0x18, 0x7,
+    0xff, 0x5, 0x0, 0xc, 0x11, 0x92, 0x20, 0x1f,
+    0xe9, 0x10, 0x6, 0xa1, 0x83, 0x75, 0x31, 0x8,
+    0x4, 0x2b, 0x8c, 0x0, 0x26, 0x54, 0x0, 0x96,
+    0x77, 0x8c, 0x1f, 0xa8, 0xc0, 0x3, 0xe0, 0x37,
+    0x44, 0x1, 0xff, 0x97, 0xc8, 0x2, 0x5d, 0xc8,
+    0x42, 0x0, 0xc2, 0x6f, 0xb4, 0x20, 0x1e, 0x37,
+    0xbd, 0xf3, 0x7, 0xec, 0x82, 0x0, 0xff, 0xfa,
+    0x0,
 
     /* U+0025 "%" */
-    0x0, 0x5, 0xbe, 0xfd, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x71,
-    0x4, 0xdf, 0xd0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0x70, 0x0, 0x0, 0x1, 0xef, 0xb0, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x9, 0xfc,
-    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0,
-    0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xb0, 0x0, 0x0, 0x4, 0xff, 0x0, 0x0, 0x2f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x9, 0xfc, 0x0,
-    0x0, 0x0, 0x6f, 0xf0, 0x0, 0xc, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0,
-    0x9, 0xfc, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x70, 0x0, 0x1, 0xff,
-    0x70, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0x71, 0x4, 0xdf, 0xe0, 0x0,
-    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x8f, 0xf4,
-    0x0, 0x5c, 0xef, 0xd7, 0x0, 0x0, 0x0, 0x6,
-    0xcf, 0xfe, 0x91, 0x0, 0x3f, 0xf8, 0x0, 0xaf,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xfd, 0x0, 0x7f, 0xf8, 0x11,
-    0x5e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0xf, 0xf7, 0x0, 0x0, 0x4f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0x70, 0x5, 0xff, 0x0, 0x0, 0x0, 0xcf, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x0,
-    0x9f, 0xc0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0xa, 0xfa,
-    0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xf6, 0x0, 0x0, 0xaf, 0xa0, 0x0,
-    0x0, 0x5, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfb, 0x0, 0x0, 0x9, 0xfb, 0x0, 0x0, 0x0,
-    0x7f, 0xe0, 0x0, 0x0, 0x0, 0xb, 0xfe, 0x10,
-    0x0, 0x0, 0x5f, 0xe0, 0x0, 0x0, 0xb, 0xfa,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xff, 0x50, 0x0, 0x2, 0xff, 0x50, 0x0,
-    0x0, 0x2, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x40, 0x2, 0xdf, 0xc0, 0x0, 0x0, 0x0,
-    0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xed, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xfd,
-    0x70, 0x0, 0x0,
+    0x0, 0x96, 0xfb, 0xf6, 0x4, 0x3, 0xfc, 0x3d,
+    0xf8, 0x1, 0xf5, 0x51, 0x4, 0x9, 0xfc, 0x80,
+    0x3f, 0xac, 0x43, 0x80, 0x3d, 0xa, 0x11, 0xdf,
+    0x64, 0x3e, 0x1, 0xf9, 0x54, 0x12, 0x40, 0x1c,
+    0x2e, 0xe, 0xe1, 0x4, 0xc0, 0x27, 0x0, 0xf0,
+    0xd8, 0x23, 0x0, 0x79, 0xc0, 0x10, 0x1, 0x85,
+    0x82, 0xc0, 0x3d, 0x42, 0x14, 0x1, 0xf7, 0x81,
+    0x80, 0x7b, 0xc0, 0xc0, 0x39, 0x90, 0x28, 0x40,
+    0x3e, 0x30, 0x70, 0xf, 0x10, 0x7, 0x8a, 0x41,
+    0x54, 0x1, 0xf8, 0xc1, 0xc0, 0x3c, 0x40, 0x1e,
+    0xe0, 0x1b, 0x0, 0xfe, 0xf0, 0x30, 0xf, 0x78,
+    0x18, 0x4, 0xe6, 0x14, 0x20, 0x1f, 0xce, 0x0,
+    0x70, 0xc, 0x2c, 0x16, 0x0, 0x28, 0x6, 0x40,
+    0xf, 0xf0, 0xb0, 0x43, 0x88, 0x26, 0x0, 0xb8,
+    0x3, 0x80, 0x64, 0x3, 0xff, 0x4a, 0x4, 0x77,
+    0xd9, 0xe, 0x80, 0x20, 0xc2, 0x80, 0xb, 0x9d,
+    0xfa, 0xe0, 0x1e, 0xb9, 0x30, 0x0, 0xb7, 0x98,
+    0x1b, 0x83, 0xa0, 0x55, 0xc, 0x40, 0xa3, 0x44,
+    0x3, 0x9b, 0x3f, 0xdd, 0x22, 0x0, 0xe0, 0x28,
+    0x7, 0x50, 0x7e, 0xe5, 0x9, 0x68, 0x7, 0xff,
+    0x6, 0x48, 0x38, 0x1, 0x1, 0x10, 0x11, 0x2d,
+    0x1, 0xa8, 0x7, 0xfc, 0x8c, 0x10, 0x60, 0xa0,
+    0x7, 0x0, 0xc8, 0x61, 0xe0, 0x1f, 0xe1, 0xa0,
+    0x37, 0x0, 0x60, 0x18, 0x7, 0x90, 0x10, 0x3,
+    0xfd, 0x62, 0x1c, 0x1, 0x18, 0x30, 0x7, 0xb8,
+    0x4, 0x3, 0xf9, 0x54, 0x12, 0x40, 0x1f, 0xf8,
+    0xc0, 0x3f, 0xc3, 0x60, 0x8c, 0x1, 0x8c, 0x4,
+    0x3, 0xc4, 0x2, 0x1, 0xfa, 0x84, 0x54, 0x1,
+    0xd8, 0xa, 0x1, 0xec, 0x4, 0x0, 0xf9, 0x90,
+    0x2c, 0x40, 0x39, 0x40, 0x54, 0x3, 0x12, 0x7,
+    0x80, 0x78, 0xa4, 0x15, 0x40, 0x1f, 0x40, 0x52,
+    0x0, 0xb, 0xc0, 0xd4, 0x3, 0xdc, 0x3, 0x60,
+    0x1f, 0x9d, 0x42, 0xfb, 0x74, 0x44, 0xd0, 0xf,
+    0x39, 0x85, 0x8, 0x7, 0xf5, 0x50, 0xc4, 0x89,
+    0x1a, 0x20, 0x0,
 
     /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x18, 0xce, 0xfe, 0xc7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xea, 0x89, 0xef, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x4, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf0,
-    0x0, 0x0, 0x3, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf2, 0x0, 0x0, 0x8, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9,
-    0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x60, 0x9, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf8, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf9,
-    0x2b, 0xff, 0xf7, 0x0, 0x0, 0xb, 0x83, 0x0,
-    0x0, 0xcf, 0xfe, 0x40, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x2f, 0xfc, 0x0, 0x8, 0xff, 0xf2, 0x0,
-    0x0, 0xb, 0xff, 0xf8, 0x0, 0x7f, 0xf8, 0x0,
-    0xf, 0xff, 0x60, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x90, 0xef, 0xf3, 0x0, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfc, 0xff, 0xc0, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x40, 0x0, 0x4f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x0, 0x0,
-    0x1f, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xb0, 0x0, 0x8, 0xff, 0xfe, 0x61,
-    0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff,
-    0xd2, 0x7f, 0xff, 0xc0, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x6, 0xff, 0x90,
-    0x0, 0x0, 0x5, 0xad, 0xef, 0xed, 0xa5, 0x0,
-    0x0, 0x0, 0x6b, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0xc6, 0x77, 0xf6, 0x38, 0x80, 0x7f,
+    0xf0, 0x9b, 0x9c, 0xc4, 0x4, 0xe3, 0xd0, 0x3,
+    0xff, 0x2c, 0x80, 0x5, 0x5d, 0x84, 0x6, 0xc4,
+    0x3, 0xfe, 0xb0, 0x2, 0x75, 0x44, 0xf1, 0x80,
+    0x24, 0x3, 0xfc, 0x42, 0x0, 0x90, 0xe, 0x80,
+    0x1, 0x80, 0x7f, 0x98, 0x2, 0x20, 0xe, 0x70,
+    0xf, 0xfe, 0xb, 0x0, 0x44, 0x1, 0xd6, 0x0,
+    0x20, 0xf, 0xf1, 0x10, 0x1, 0x60, 0x19, 0x5c,
+    0x1, 0x60, 0x1f, 0xf5, 0x80, 0x19, 0x80, 0x9,
+    0xa0, 0x4, 0x10, 0x7, 0xfc, 0xc8, 0x0, 0x98,
+    0xe6, 0x0, 0x4b, 0x80, 0x7f, 0xf0, 0x6c, 0xc0,
+    0xe, 0x20, 0x58, 0xc0, 0x1f, 0xfc, 0x22, 0x0,
+    0xe4, 0xd3, 0x0, 0xff, 0xe1, 0x46, 0x98, 0x6,
+    0x47, 0x0, 0xff, 0xe1, 0x5b, 0x80, 0x1b, 0x50,
+    0x1, 0xe, 0x1, 0xd7, 0x6, 0x1, 0xb1, 0x0,
+    0x6e, 0x4a, 0xd0, 0x1, 0x10, 0x0, 0x89, 0x1f,
+    0xc0, 0x28, 0x30, 0x6, 0x20, 0x5, 0x68, 0x0,
+    0x78, 0x0, 0x28, 0x1, 0x0, 0x27, 0x0, 0x49,
+    0x0, 0x75, 0xa8, 0x1, 0xe4, 0x24, 0x1, 0x60,
+    0x4, 0x0, 0x9c, 0x3, 0xea, 0x50, 0x3, 0x60,
+    0x81, 0x98, 0x0, 0x20, 0x10, 0x80, 0x7e, 0xa6,
+    0x0, 0x18, 0x2, 0x0, 0x21, 0x0, 0x90, 0x3,
+    0xfa, 0x58, 0x2, 0x14, 0x0, 0x94, 0x2, 0x91,
+    0x0, 0xfc, 0x48, 0x1, 0xd, 0x80, 0x42, 0xe0,
+    0x2, 0xf6, 0x10, 0xc, 0x95, 0xa4, 0x1, 0x92,
+    0xc0, 0x28, 0x50, 0x0, 0xcf, 0x73, 0x7b, 0xed,
+    0x40, 0x5, 0xb0, 0x0, 0x4c, 0x0, 0xaa, 0x4,
+    0x2, 0x12, 0x10, 0x8, 0x63, 0x49, 0xe4, 0x0,
+    0xa0, 0x19, 0xfa, 0x94, 0x84, 0x4, 0x96, 0xb9,
+    0xc0, 0x26, 0x94, 0x90, 0xf, 0x2d, 0x6f, 0x7f,
+    0x6d, 0x28, 0x7, 0x9a, 0xc0, 0x0,
 
     /* U+0027 "'" */
-    0xbf, 0xf4, 0xbf, 0xf4, 0xaf, 0xf3, 0xaf, 0xf3,
-    0xaf, 0xf2, 0x9f, 0xf2, 0x9f, 0xf2, 0x9f, 0xf1,
-    0x8f, 0xf1, 0x49, 0x90,
+    0xbf, 0xf2, 0x0, 0x61, 0x0, 0x38, 0x7, 0xc2,
+    0x60, 0x1f, 0xe3, 0x10, 0xb, 0x19, 0x82,
 
     /* U+0028 "(" */
-    0x0, 0x0, 0x9f, 0xfb, 0x0, 0x2, 0xff, 0xf2,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x2f, 0xff, 0x30,
-    0x0, 0x8f, 0xfd, 0x0, 0x0, 0xef, 0xf7, 0x0,
-    0x3, 0xff, 0xf2, 0x0, 0x7, 0xff, 0xe0, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0xe, 0xff, 0x70, 0x0,
-    0x1f, 0xff, 0x40, 0x0, 0x4f, 0xff, 0x20, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x8f, 0xfe, 0x0, 0x0, 0x8f, 0xfd, 0x0, 0x0,
-    0x9f, 0xfc, 0x0, 0x0, 0x8f, 0xfd, 0x0, 0x0,
-    0x8f, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x5f, 0xff, 0x0, 0x0, 0x4f, 0xff, 0x20, 0x0,
-    0x1f, 0xff, 0x40, 0x0, 0xe, 0xff, 0x70, 0x0,
-    0xb, 0xff, 0xa0, 0x0, 0x7, 0xff, 0xd0, 0x0,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0xcf, 0xf7, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0x30,
-    0x0, 0x9, 0xff, 0xa0, 0x0, 0x1, 0xff, 0xf2,
-    0x0, 0x0, 0x8f, 0xfb,
+    0x0, 0xd3, 0xfe, 0xb0, 0x8, 0x98, 0x1, 0x20,
+    0x14, 0x0, 0x14, 0x80, 0x4, 0xa0, 0x9, 0x0,
+    0xa8, 0x0, 0x46, 0x1, 0x30, 0x2, 0x80, 0x23,
+    0x10, 0x2, 0x80, 0x48, 0x0, 0x12, 0x0, 0xb0,
+    0x0, 0x80, 0x19, 0x40, 0x1a, 0x1, 0x8, 0x80,
+    0x6, 0x1, 0x28, 0x4, 0xc0, 0x10, 0x80, 0x44,
+    0x1, 0x10, 0x7, 0xde, 0x0, 0x10, 0xf, 0x8c,
+    0x3, 0x8, 0x0, 0x40, 0x30, 0x80, 0x4, 0x3,
+    0xe3, 0x0, 0xde, 0x0, 0x10, 0xc, 0x40, 0x1f,
+    0x8, 0x4, 0x40, 0x12, 0x80, 0x4c, 0x1, 0x8,
+    0x80, 0x6, 0x1, 0x94, 0x1, 0xa0, 0x1b, 0x0,
+    0xe, 0x1, 0x94, 0x0, 0x44, 0x0, 0x88, 0xc0,
+    0xa, 0x1, 0xac, 0x1, 0x40, 0x19, 0x80, 0x4,
+    0x60, 0x10, 0xb0, 0x2, 0x40, 0x34, 0x0, 0x14,
+    0x80, 0x21, 0x70, 0x4, 0x80,
 
     /* U+0029 ")" */
-    0x9f, 0xfb, 0x0, 0x0, 0x1f, 0xff, 0x40, 0x0,
-    0x8, 0xff, 0xc0, 0x0, 0x1, 0xff, 0xf4, 0x0,
-    0x0, 0xbf, 0xfa, 0x0, 0x0, 0x5f, 0xff, 0x10,
-    0x0, 0xf, 0xff, 0x50, 0x0, 0xc, 0xff, 0xa0,
-    0x0, 0x8, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xf1,
-    0x0, 0x1, 0xff, 0xf4, 0x0, 0x0, 0xff, 0xf6,
-    0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0xcf, 0xf9,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0xaf, 0xfb,
-    0x0, 0x0, 0xaf, 0xfb, 0x0, 0x0, 0xaf, 0xfb,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0xcf, 0xf9,
-    0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0, 0xff, 0xf6,
-    0x0, 0x1, 0xff, 0xf4, 0x0, 0x4, 0xff, 0xf1,
-    0x0, 0x8, 0xff, 0xd0, 0x0, 0xb, 0xff, 0xa0,
-    0x0, 0xf, 0xff, 0x40, 0x0, 0x5f, 0xfe, 0x0,
-    0x0, 0xbf, 0xf9, 0x0, 0x1, 0xff, 0xf4, 0x0,
-    0x8, 0xff, 0xc0, 0x0, 0x1f, 0xff, 0x30, 0x0,
-    0x9f, 0xfb, 0x0, 0x0,
+    0x9f, 0xf5, 0x80, 0x68, 0x0, 0x22, 0x0, 0x21,
+    0x70, 0x4, 0x0, 0x69, 0x0, 0x1a, 0x0, 0x42,
+    0x80, 0xe, 0x0, 0xdc, 0x0, 0x51, 0x0, 0x94,
+    0x2, 0x40, 0xc, 0x60, 0xf, 0x0, 0xc8, 0x0,
+    0x70, 0xd, 0x80, 0x2, 0x10, 0x9, 0x40, 0x25,
+    0x0, 0x84, 0x2, 0x20, 0xc, 0x40, 0xe, 0x0,
+    0xc2, 0x0, 0x10, 0xc, 0xe0, 0x2, 0x0, 0xc2,
+    0x1, 0xff, 0xcb, 0x10, 0xf, 0x9c, 0x0, 0x40,
+    0x18, 0x40, 0x2, 0x1, 0x88, 0x1, 0xc0, 0x10,
+    0x80, 0x44, 0x1, 0x28, 0x4, 0xa0, 0x16, 0x0,
+    0x8, 0x40, 0x23, 0x0, 0x38, 0x6, 0x40, 0x7,
+    0x0, 0x4a, 0x0, 0x14, 0x0, 0xb8, 0x0, 0xe0,
+    0x10, 0xa0, 0x3, 0x40, 0x29, 0x0, 0x1a, 0x0,
+    0x5, 0xc0, 0x1e, 0x1, 0x40, 0x1, 0xc, 0x2,
 
     /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x40, 0x0, 0x0, 0x4, 0x40,
-    0x0, 0xdf, 0x40, 0x1, 0x70, 0xd, 0xfb, 0x20,
-    0xdf, 0x40, 0x8f, 0xf4, 0x1b, 0xff, 0xf9, 0xef,
-    0x9e, 0xff, 0xe4, 0x0, 0x4c, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xff, 0xc3, 0x0,
-    0x7, 0xff, 0xfc, 0xef, 0xbf, 0xff, 0xb2, 0x1f,
-    0xfe, 0x60, 0xdf, 0x42, 0xbf, 0xf6, 0x6, 0x80,
-    0x0, 0xdf, 0x40, 0x4, 0xb0, 0x0, 0x0, 0x0,
-    0xdf, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x34, 0x10,
-    0x0, 0x0,
+    0x0, 0xf7, 0x7a, 0x0, 0x7f, 0xc6, 0x1, 0xf9,
+    0x10, 0x1, 0xf8, 0x5c, 0x1, 0x37, 0x62, 0x0,
+    0xe8, 0xe8, 0x41, 0x60, 0x4d, 0x93, 0xd, 0xe7,
+    0x1, 0x1, 0xbb, 0x18, 0x30, 0x83, 0x8, 0x47,
+    0x20, 0x1, 0x32, 0x0, 0x31, 0x73, 0x80, 0x61,
+    0x98, 0x0, 0xc5, 0xa6, 0x1, 0x3f, 0x30, 0x18,
+    0x82, 0x1, 0xe5, 0x90, 0xc0, 0xc, 0xe1, 0x87,
+    0xea, 0x2, 0x20, 0x65, 0xf9, 0x80, 0x31, 0x5d,
+    0x91, 0x81, 0xa0, 0x3, 0xf2, 0x58, 0x7, 0xff,
+    0x27, 0xad, 0x40, 0x38,
 
     /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x8, 0x88, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x87, 0xdd, 0xdd, 0xdd,
-    0xff, 0xfd, 0xdd, 0xdd, 0xd7, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0xfa, 0x22, 0x0, 0xff, 0xe1, 0x3b, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x2c, 0xff, 0xf8,
+    0x2, 0xff, 0xf4, 0x0, 0x7f, 0xf1, 0x78, 0x8b,
+    0xc0, 0x11, 0x17, 0xbd, 0xf7, 0x7c, 0x1, 0x6e,
+    0xf9, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xe0,
 
     /* U+002C "," */
-    0x4, 0xcd, 0x60, 0x1f, 0xff, 0xf3, 0x3f, 0xff,
-    0xf7, 0x1f, 0xff, 0xf5, 0x3, 0xef, 0xf1, 0x0,
-    0xff, 0xb0, 0x3, 0xff, 0x60, 0x7, 0xff, 0x0,
-    0xb, 0xfb, 0x0, 0xf, 0xf5, 0x0,
+    0x4, 0xcd, 0x60, 0x1b, 0x32, 0x93, 0x20, 0xc,
+    0x84, 0x1, 0x88, 0x70, 0x40, 0x8, 0x6, 0x20,
+    0x82, 0x6, 0x0, 0xd0, 0x2, 0x0, 0x18, 0x1,
+    0x80, 0x80, 0x12, 0x7, 0x0, 0x0,
 
     /* U+002D "-" */
-    0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xef, 0xff, 0xd6, 0x20, 0x1f, 0xfc, 0x70,
 
     /* U+002E "." */
-    0x3, 0xcc, 0x50, 0x1f, 0xff, 0xf3, 0x4f, 0xff,
-    0xf7, 0x2f, 0xff, 0xf4, 0x5, 0xee, 0x70,
+    0x3, 0xcc, 0x28, 0xe, 0x19, 0xa8, 0xd4, 0x3,
+    0x23, 0x0, 0x63, 0x2a, 0x11, 0x42, 0x0,
 
     /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x87,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc3, 0x10, 0x70, 0xf, 0xfc, 0xce,
+    0xed, 0x0, 0xff, 0xd4, 0x0, 0xe0, 0xf, 0xf8,
+    0xc8, 0x5, 0x0, 0x3f, 0xeb, 0x0, 0x38, 0x7,
+    0xfe, 0x60, 0x5, 0x0, 0x7f, 0xc8, 0x20, 0x46,
+    0x1, 0xff, 0x68, 0x1, 0x40, 0x3f, 0xf3, 0x80,
+    0x28, 0x3, 0xfe, 0x51, 0x3, 0x20, 0xf, 0xfb,
+    0xc0, 0x16, 0x1, 0xff, 0x94, 0x0, 0xc0, 0x1f,
+    0xf3, 0x0, 0x10, 0x40, 0x3f, 0xed, 0x0, 0x68,
+    0x7, 0xfc, 0x28, 0x0, 0x70, 0xf, 0xf9, 0x80,
+    0xa, 0x20, 0x1f, 0xf5, 0x80, 0x3c, 0x3, 0xfe,
+    0x23, 0x0, 0x28, 0x7, 0xfd, 0x40, 0x6, 0x0,
+    0xff, 0xca, 0x0, 0xd0, 0xf, 0xf8, 0xc8, 0x5,
+    0x0, 0x3f, 0xea, 0x0, 0x30, 0x7, 0xfe, 0x70,
+    0x5, 0x80, 0x7f, 0xc8, 0x20, 0x46, 0x1, 0xff,
+    0x70, 0x2, 0x80, 0x3f, 0xf2, 0x80, 0x14, 0x3,
+    0xfe, 0x50, 0x1, 0x90, 0x7, 0xfd, 0xc0, 0xa,
+    0x0, 0xff, 0x85, 0x0, 0xe, 0x1, 0xff, 0x38,
+    0x1, 0x4, 0x3, 0xfe, 0xa0, 0x7, 0x0, 0x7f,
+    0xc4, 0x60, 0x5, 0x0, 0xff, 0x94, 0x0, 0xa0,
+    0x1f, 0xfa, 0x80, 0x1c, 0x1, 0xff,
 
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x6, 0xae, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xb5, 0x33, 0x5a,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x3f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0x0, 0x0,
-    0xcf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfc, 0x0, 0x3, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x30, 0x9, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x90,
-    0xd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xd0, 0xf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x2f, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf2, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf3, 0x4f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf3, 0x2f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0xd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xd0, 0x9, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x3, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x30, 0x0, 0xcf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xe4,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xf3, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xa5, 0x33, 0x5a, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xbe, 0xff, 0xeb, 0x60,
-    0x0, 0x0, 0x0,
+    0x0, 0xf9, 0xab, 0xbf, 0xdd, 0x6c, 0x1, 0xff,
+    0x97, 0xa5, 0x44, 0x0, 0x29, 0x3c, 0xa0, 0x1f,
+    0xd1, 0x42, 0x1, 0xf8, 0x6a, 0x0, 0x3e, 0x77,
+    0x0, 0x49, 0x59, 0x8a, 0x50, 0x9, 0xe0, 0x3,
+    0x8e, 0x0, 0x2b, 0xb2, 0x99, 0x96, 0xac, 0x2,
+    0x73, 0x0, 0xde, 0x1, 0x62, 0x0, 0x79, 0x30,
+    0x2, 0xf0, 0x8, 0xcc, 0x0, 0x63, 0x0, 0xfc,
+    0x6c, 0x0, 0x33, 0x0, 0x28, 0x2, 0xb0, 0xf,
+    0xf5, 0x80, 0x54, 0x0, 0x40, 0x1, 0x90, 0x7,
+    0xf8, 0x8c, 0x0, 0x80, 0x2, 0x0, 0x28, 0x7,
+    0xfe, 0x50, 0x1, 0x1, 0x0, 0x5c, 0x1, 0xff,
+    0xbc, 0x2, 0x21, 0x0, 0x84, 0x3, 0xff, 0x18,
+    0x4, 0x2e, 0x1, 0x18, 0x7, 0xff, 0x11, 0xdc,
+    0x1, 0x18, 0x7, 0xff, 0x11, 0xc4, 0x2, 0x10,
+    0xf, 0xfc, 0x60, 0x10, 0x90, 0x5, 0xc0, 0x1f,
+    0xfb, 0xc0, 0x22, 0x2, 0x0, 0x28, 0x7, 0xfe,
+    0x50, 0x1, 0x0, 0x10, 0x0, 0x64, 0x1, 0xfe,
+    0x23, 0x0, 0x20, 0x2, 0x80, 0x2b, 0x0, 0xff,
+    0x58, 0x5, 0x40, 0x3, 0x30, 0x1, 0x8c, 0x3,
+    0xf1, 0xb0, 0x0, 0xcc, 0x1, 0x78, 0x5, 0xa8,
+    0x1, 0xe4, 0xd0, 0xb, 0xc0, 0x31, 0xc0, 0x0,
+    0x6e, 0x94, 0xcc, 0xb5, 0x62, 0x0, 0x73, 0x0,
+    0xe7, 0x70, 0x4, 0xb5, 0x98, 0xa5, 0x0, 0x9a,
+    0x0, 0x3e, 0x8a, 0x10, 0xf, 0xc3, 0x52, 0x1,
+    0xfc, 0xbd, 0x28, 0x20, 0x1, 0x49, 0xe5, 0x0,
+    0xe0,
 
     /* U+0031 "1" */
-    0xbf, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0xff, 0xff,
-    0xff, 0xf8, 0xbf, 0xff, 0xff, 0xff, 0xf8, 0x11,
-    0x11, 0x11, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xff, 0xf8,
+    0xbf, 0xff, 0xd0, 0x1, 0xff, 0xc8, 0xae, 0xee,
+    0x0, 0xc2, 0x3e, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfd, 0x40,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x5, 0xac, 0xef, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3f, 0xff,
-    0xfe, 0x95, 0x32, 0x36, 0xbf, 0xff, 0xf6, 0x0,
-    0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfe, 0x0, 0x0, 0x75, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xfd, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xe3, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7,
+    0x0, 0xe5, 0xac, 0xef, 0xf7, 0x5b, 0x88, 0x7,
+    0xe8, 0xfa, 0x53, 0x10, 0x0, 0xa4, 0x73, 0x80,
+    0x71, 0xf3, 0x80, 0x7f, 0xd1, 0x40, 0x11, 0xe0,
+    0x80, 0x5, 0xab, 0x37, 0x25, 0x0, 0x25, 0x60,
+    0x1, 0xb0, 0x1, 0xfa, 0x54, 0xc8, 0xda, 0xe4,
+    0x2, 0x80, 0xa, 0x62, 0xa0, 0x3, 0xf3, 0x28,
+    0x0, 0x4c, 0x2, 0x75, 0x0, 0xff, 0x78, 0x4,
+    0xc0, 0x1f, 0xfc, 0x31, 0x0, 0x84, 0x3, 0xff,
+    0x86, 0x40, 0x13, 0x0, 0x7f, 0xf0, 0xe8, 0x0,
+    0x24, 0x1, 0xff, 0xc2, 0x43, 0x0, 0x30, 0x7,
+    0xff, 0x8, 0xa8, 0x0, 0x30, 0x1, 0xff, 0xc1,
+    0x2c, 0x10, 0x5, 0x0, 0x7f, 0xf0, 0x4b, 0x4,
+    0x1, 0x48, 0x1, 0xff, 0x8f, 0x4, 0x1, 0x4a,
+    0x1, 0xff, 0x8f, 0x4, 0x1, 0x4a, 0x1, 0xff,
+    0x93, 0x0, 0x2b, 0x50, 0xf, 0xfc, 0xb6, 0x1,
+    0x62, 0x0, 0x7f, 0xe5, 0xa0, 0x0, 0xe1, 0x80,
+    0x7f, 0xe6, 0xa0, 0x0, 0xe1, 0x80, 0x7f, 0xe7,
+    0x90, 0x1, 0x61, 0x0, 0x7f, 0xe8, 0x80, 0x0,
+    0x78, 0xc4, 0x7f, 0xc0, 0x7, 0x70, 0x4, 0x39,
+    0xdd, 0xff, 0x38, 0x68, 0x7, 0xff, 0x68,
 
     /* U+0033 "3" */
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x12, 0xdf, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfc, 0x63, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfe,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x22,
-    0x33, 0x6a, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xe0, 0x45, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0xe, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff, 0x48,
-    0xff, 0xff, 0xc8, 0x53, 0x23, 0x5a, 0xff, 0xff,
-    0xb0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x48, 0xbd,
-    0xef, 0xed, 0xa5, 0x10, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xe2, 0x0, 0x7f, 0xf6, 0x48,
+    0x1, 0x7d, 0xdf, 0xed, 0x20, 0x0, 0xf8, 0x0,
+    0x47, 0xfe, 0x92, 0x0, 0x51, 0x0, 0x7f, 0xe8,
+    0x40, 0x4, 0xa0, 0x7, 0xfe, 0x57, 0x0, 0x33,
+    0x0, 0x3f, 0xf1, 0xd0, 0x1, 0x24, 0x3, 0xff,
+    0xe, 0x80, 0xa, 0x80, 0x3f, 0xf8, 0x38, 0x20,
+    0xf, 0x10, 0xf, 0xfd, 0x44, 0x0, 0x34, 0x30,
+    0xf, 0xfc, 0x80, 0x11, 0xce, 0x73, 0x0, 0x7f,
+    0xf1, 0x46, 0x6c, 0x3, 0xfb, 0x37, 0x31, 0x2a,
+    0x1, 0x25, 0x80, 0x7e, 0x22, 0x19, 0x9a, 0xb4,
+    0x80, 0x8, 0xa0, 0x1f, 0xfc, 0x12, 0xf0, 0xb,
+    0xc0, 0x3f, 0xf8, 0x44, 0x60, 0x4, 0x0, 0xff,
+    0xe1, 0xb0, 0x0, 0x40, 0x3f, 0xf8, 0x6c, 0x0,
+    0x10, 0x45, 0x0, 0xff, 0x88, 0xc0, 0x8, 0x15,
+    0x51, 0x0, 0x7e, 0x2f, 0x0, 0xba, 0x4, 0x17,
+    0x72, 0x14, 0xc8, 0xd6, 0xb4, 0x80, 0x8, 0x8b,
+    0x20, 0x8, 0xde, 0xb3, 0x72, 0x94, 0x2, 0x3a,
+    0x3, 0xd8, 0x10, 0xf, 0xf9, 0xf0, 0x40, 0x27,
+    0xeb, 0x74, 0x21, 0x1, 0x25, 0xae, 0x80, 0x8,
 
     /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xe1,
-    0x0, 0x0, 0x48, 0x87, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf4, 0x0, 0x0, 0x8, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x8f, 0xfd, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
-    0x0, 0x2, 0xef, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xaa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc5, 0xff, 0x58, 0x7, 0xff, 0x1b,
+    0xc0, 0x3, 0x40, 0x1f, 0xfc, 0x5b, 0x20, 0x6,
+    0x88, 0x7, 0xff, 0x11, 0xd0, 0x1, 0x26, 0x1,
+    0xff, 0xc4, 0x48, 0x0, 0x2b, 0x0, 0x7f, 0xf1,
+    0x6, 0x80, 0x5, 0x40, 0x1f, 0xfc, 0x5d, 0x10,
+    0x7, 0x80, 0x7f, 0xf1, 0x64, 0xc0, 0x14, 0x40,
+    0x1f, 0xfc, 0x46, 0x60, 0x1, 0x94, 0x3, 0xff,
+    0x88, 0x72, 0x0, 0x39, 0x0, 0xff, 0xe2, 0xf,
+    0x0, 0x7, 0x40, 0x32, 0x44, 0x1c, 0x3, 0xfa,
+    0x88, 0x1, 0x42, 0x1, 0xb1, 0xdd, 0x40, 0x1f,
+    0x9d, 0x0, 0x10, 0x80, 0x1f, 0xfc, 0x44, 0x80,
+    0x2, 0x38, 0x7, 0xff, 0x10, 0xa8, 0x0, 0x56,
+    0x1, 0xff, 0xc5, 0xe1, 0x0, 0x70, 0x7, 0xff,
+    0x16, 0xc, 0x2, 0xcf, 0xff, 0xce, 0x0, 0x2f,
+    0xfd, 0x44, 0x1, 0xff, 0xe1, 0xaf, 0xff, 0xfe,
+    0xa, 0x80, 0xb, 0xff, 0x50, 0x7, 0xff, 0xfc,
+    0x3, 0xff, 0xb8,
 
     /* U+0035 "5" */
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x9,
-    0xff, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
-    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x31, 0x11, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xc9, 0x40, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x7d, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf4, 0x0, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf1,
-    0x8, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xb0, 0x2f, 0xff, 0xfe, 0xa6, 0x42, 0x34,
-    0x8e, 0xff, 0xff, 0x30, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x3b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x0, 0x16, 0xad, 0xef, 0xfd, 0xc8, 0x30,
-    0x0, 0x0,
+    0x0, 0x93, 0xff, 0xff, 0x84, 0x1, 0xc4, 0x1,
+    0xff, 0xc7, 0x10, 0xf, 0xfe, 0x3f, 0x0, 0xf,
+    0xbb, 0xfe, 0x0, 0xe3, 0x0, 0x30, 0x8f, 0xfc,
+    0x1, 0xcc, 0x0, 0x20, 0xf, 0xfe, 0x21, 0x0,
+    0x3c, 0x3, 0xff, 0x88, 0x20, 0x2, 0x0, 0xff,
+    0xe1, 0x88, 0x4, 0x20, 0x1f, 0xfc, 0x32, 0x0,
+    0x9c, 0x46, 0x0, 0xff, 0xce, 0x1, 0x67, 0x75,
+    0xfe, 0xc9, 0x40, 0xf, 0x88, 0x3, 0xf8, 0xda,
+    0xf9, 0x0, 0x38, 0x40, 0x3f, 0xf0, 0xdb, 0x80,
+    0x67, 0xff, 0xfb, 0x6e, 0x8, 0x2, 0x84, 0x0,
+    0xff, 0x89, 0x1f, 0x5c, 0x2, 0x90, 0xf, 0xfe,
+    0x1c, 0x20, 0x0, 0x88, 0x1, 0xff, 0xc3, 0xe0,
+    0x9, 0xc0, 0x3f, 0xf8, 0x6c, 0x1, 0x18, 0x7,
+    0xff, 0xd, 0x80, 0x22, 0x0, 0x40, 0x7, 0xfe,
+    0xe0, 0x9, 0x42, 0x1f, 0x54, 0x3, 0xfa, 0x50,
+    0x0, 0x82, 0x4e, 0x5, 0x5d, 0x4c, 0x84, 0x69,
+    0x1c, 0xc0, 0x14, 0x1, 0x30, 0x4, 0x2b, 0x37,
+    0xb9, 0x6e, 0x20, 0x15, 0x18, 0x2, 0x71, 0x0,
+    0x3f, 0xe3, 0xc5, 0x0, 0xc7, 0x7d, 0x2a, 0x42,
+    0x0, 0x23, 0x7c, 0xc1, 0x80, 0x40,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xeb,
-    0x82, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x94, 0x21, 0x13, 0x6b,
-    0xe0, 0x0, 0x0, 0xd, 0xff, 0xfa, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x70, 0x3, 0x8c, 0xef, 0xed,
-    0x94, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x4f, 0xff,
-    0x6d, 0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0x40,
-    0x3, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x4b,
-    0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfa, 0x1, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0,
-    0xe, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x20, 0xaf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf3, 0x5, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20,
-    0xe, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xe0, 0x0, 0x6f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf8, 0x0, 0x0, 0xbf, 0xff,
-    0xc5, 0x0, 0x0, 0x3a, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xee, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x16,
-    0xad, 0xef, 0xec, 0x82, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x5a, 0xb7, 0xfe, 0xeb, 0x82, 0x0,
+    0xfe, 0x8e, 0x95, 0x20, 0x8, 0x51, 0xf6, 0x40,
+    0x3c, 0x5c, 0xe0, 0x1f, 0xf7, 0x80, 0x71, 0x68,
+    0x80, 0x4d, 0x7b, 0xdc, 0xc9, 0x41, 0x60, 0xe,
+    0xf0, 0x9, 0x7a, 0x50, 0x84, 0x46, 0xd7, 0xc0,
+    0x1d, 0x4, 0x0, 0x7a, 0x10, 0xf, 0xfe, 0x8,
+    0xb8, 0x0, 0xe0, 0x3, 0xff, 0x86, 0xc0, 0x14,
+    0x0, 0x7f, 0xf1, 0x30, 0x0, 0x48, 0x1, 0xff,
+    0xc4, 0x40, 0x3, 0x80, 0x7f, 0xf1, 0x4, 0x2,
+    0xd0, 0x1, 0xc6, 0x77, 0xf6, 0xca, 0x0, 0x71,
+    0x0, 0x42, 0x2a, 0xc7, 0x31, 0x1, 0x26, 0xbc,
+    0x30, 0x9, 0xc0, 0x36, 0x28, 0x4, 0x22, 0x0,
+    0xc7, 0x88, 0x0, 0x70, 0xa, 0x48, 0xe, 0xbf,
+    0xb9, 0xf6, 0x80, 0x15, 0x90, 0x8, 0x7, 0x3e,
+    0x28, 0x6, 0x4b, 0x80, 0xa, 0x0, 0xc0, 0x31,
+    0xc0, 0x7, 0xe7, 0x40, 0x2, 0x80, 0x88, 0x2,
+    0x90, 0xf, 0xf6, 0x80, 0x44, 0x8, 0x1, 0x30,
+    0x7, 0xf8, 0x80, 0x21, 0xf, 0x0, 0x98, 0x3,
+    0xfc, 0x40, 0x10, 0x82, 0x88, 0x3, 0x80, 0x3f,
+    0xda, 0x0, 0x12, 0x0, 0x40, 0x1, 0x20, 0x3,
+    0xf3, 0xa0, 0x1, 0x80, 0x26, 0x40, 0x3, 0xe2,
+    0x80, 0x63, 0xa8, 0x0, 0x14, 0x80, 0x6b, 0x40,
+    0x1, 0xd7, 0xf7, 0x3f, 0x14, 0x0, 0x3e, 0x20,
+    0x1d, 0x70, 0x1, 0x84, 0x40, 0x19, 0x7c, 0x80,
+    0x3e, 0x7e, 0x95, 0x21, 0x1, 0x37, 0xda, 0x10,
+    0x8,
 
     /* U+0037 "7" */
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xef, 0xf9,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x3f, 0xff, 0x90,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x20, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfb, 0x0, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf4, 0x0, 0x89, 0x94,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xef, 0xff, 0xfe, 0x30, 0x80, 0x7f, 0xf6, 0xc4,
+    0x2, 0x6e, 0xef, 0xf6, 0x0, 0x4c, 0x1, 0x84,
+    0x7f, 0xea, 0x0, 0xac, 0x3, 0xff, 0x84, 0x2c,
+    0x0, 0x42, 0x0, 0xff, 0xe1, 0x30, 0x5, 0xe0,
+    0x6, 0x6b, 0x0, 0x3f, 0xa4, 0x0, 0x68, 0x0,
+    0x89, 0x92, 0x0, 0x7e, 0x61, 0x0, 0x48, 0x7,
+    0xff, 0xe, 0xc0, 0x2, 0xa0, 0x1f, 0xfc, 0x25,
+    0x20, 0x4, 0x80, 0x7f, 0xf0, 0xe4, 0x2, 0x70,
+    0xf, 0xfe, 0x11, 0x98, 0x0, 0xe0, 0x1f, 0xfc,
+    0x39, 0x0, 0xa4, 0x3, 0xff, 0x84, 0x4a, 0x0,
+    0x51, 0x0, 0xff, 0xe1, 0x58, 0x5, 0x20, 0x1f,
+    0xfc, 0x21, 0x60, 0x2, 0x18, 0x7, 0xff, 0xa,
+    0x40, 0x2f, 0x0, 0xff, 0xe1, 0xb0, 0x0, 0x90,
+    0x3, 0xff, 0x84, 0xc2, 0x0, 0xb0, 0xf, 0xfe,
+    0x1d, 0x80, 0x5, 0x80, 0x3f, 0xf8, 0x4a, 0x40,
+    0x9, 0x0, 0xff, 0xe1, 0xc8, 0x4, 0xc0, 0x1f,
+    0xfc, 0x23, 0x30, 0x1, 0x84, 0x3, 0xff, 0x85,
+    0x0, 0x15, 0x80, 0x7f, 0x80,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x1, 0x6a, 0xde, 0xfe, 0xdb, 0x72,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x10, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xee, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0xb, 0xff, 0xfe, 0x61, 0x0, 0x1, 0x5d, 0xff,
-    0xfd, 0x0, 0x2, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf5, 0x0, 0x6f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90, 0x7,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfa, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x80, 0x1, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf4, 0x0, 0x8,
-    0xff, 0xfb, 0x20, 0x0, 0x0, 0x29, 0xff, 0xfb,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xeb, 0xbb, 0xdf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
-    0x0, 0x1d, 0xff, 0xfd, 0x73, 0x0, 0x2, 0x6c,
-    0xff, 0xfe, 0x20, 0xa, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfc, 0x1, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf3,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x76, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf9, 0x5f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x82,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf5, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xfb,
-    0x51, 0x0, 0x0, 0x4a, 0xff, 0xff, 0x60, 0x0,
-    0x5f, 0xff, 0xff, 0xfe, 0xee, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x40, 0x0, 0x0, 0x0, 0x2, 0x7b,
-    0xde, 0xfe, 0xdb, 0x73, 0x0, 0x0, 0x0,
+    0x0, 0xe1, 0x6a, 0xde, 0xfe, 0xdb, 0x72, 0x0,
+    0xfe, 0x8e, 0x95, 0x21, 0x1, 0x24, 0x8d, 0xa1,
+    0x0, 0xe1, 0xc7, 0x0, 0xe1, 0x10, 0x6, 0x5c,
+    0x20, 0xd, 0x46, 0x0, 0x19, 0xef, 0xee, 0xa8,
+    0x80, 0x5, 0xe0, 0x11, 0x20, 0x0, 0xfd, 0x84,
+    0x2, 0x15, 0xd5, 0x0, 0x12, 0x80, 0x10, 0x2,
+    0x81, 0x0, 0xfd, 0x60, 0x16, 0x0, 0x4, 0x2,
+    0x50, 0xf, 0xe1, 0x20, 0x1, 0x80, 0x8, 0x2,
+    0x20, 0xf, 0xf1, 0x0, 0x8, 0x0, 0x80, 0x14,
+    0x80, 0x7f, 0x38, 0x5, 0x80, 0x1, 0x70, 0x2,
+    0xd9, 0x0, 0x71, 0x4c, 0x0, 0x11, 0x0, 0x14,
+    0x30, 0x1, 0x37, 0xae, 0xed, 0xd3, 0x0, 0x12,
+    0xc0, 0x3a, 0x60, 0x2, 0x14, 0x48, 0x80, 0x26,
+    0xb0, 0xe, 0x1a, 0x80, 0xf, 0xf9, 0xb0, 0x80,
+    0x21, 0xc5, 0x0, 0x14, 0x67, 0xfd, 0xb2, 0x60,
+    0x3, 0xc2, 0x0, 0x59, 0x0, 0x1f, 0x5c, 0xc0,
+    0x22, 0x6c, 0x90, 0x0, 0xf0, 0xa, 0x80, 0x12,
+    0x0, 0x3f, 0x99, 0xc0, 0x6, 0x64, 0x0, 0xb8,
+    0x3, 0xfe, 0xa0, 0x9, 0xc, 0x2, 0x60, 0xf,
+    0xf8, 0x80, 0x2e, 0x30, 0x9, 0x80, 0x3f, 0xe2,
+    0x0, 0x85, 0xc0, 0x2e, 0x0, 0xff, 0xa8, 0x2,
+    0xd2, 0x30, 0x2, 0x38, 0x7, 0xf2, 0xb8, 0x0,
+    0x54, 0x3c, 0x2, 0x8b, 0x51, 0x0, 0xc9, 0x54,
+    0x0, 0xa0, 0x0, 0x74, 0x1, 0x25, 0x77, 0x6f,
+    0xb5, 0x0, 0xa1, 0x80, 0x25, 0xd4, 0x0, 0xc2,
+    0x30, 0x6, 0x2b, 0x70, 0xe, 0x2b, 0xd8, 0x42,
+    0x10, 0x12, 0x48, 0xcd, 0x40, 0x8,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x16, 0xbd, 0xff, 0xdb, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xee, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xa, 0xff,
-    0xfc, 0x50, 0x0, 0x4, 0xaf, 0xff, 0xd0, 0x0,
-    0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf9, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x20, 0xef, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x90, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xe0,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf1, 0xcf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xf4, 0x6f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf6, 0xd, 0xff,
-    0xfd, 0x50, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xf7,
-    0x2, 0xef, 0xff, 0xff, 0xee, 0xff, 0xff, 0xf5,
-    0xff, 0xf7, 0x0, 0x1b, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x32, 0xff, 0xf6, 0x0, 0x0, 0x38, 0xce,
-    0xfe, 0xd9, 0x40, 0x3, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf2, 0x0, 0x0, 0xbc, 0x73, 0x10, 0x13, 0x7d,
-    0xff, 0xff, 0x50, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x0,
-    0x0, 0x17, 0xbd, 0xff, 0xfd, 0xb7, 0x20, 0x0,
-    0x0, 0x0,
+    0x0, 0xc2, 0xd7, 0xbf, 0xed, 0xb7, 0x20, 0xf,
+    0xe7, 0xe9, 0x42, 0x0, 0x12, 0x46, 0xc8, 0x80,
+    0x7b, 0x20, 0x3, 0x8, 0x80, 0x33, 0x60, 0x80,
+    0x6a, 0x30, 0x1, 0xd7, 0xf7, 0x3e, 0xd4, 0x0,
+    0x58, 0x1, 0x22, 0x80, 0x17, 0x14, 0x3, 0x25,
+    0x50, 0x0, 0x52, 0x0, 0xe0, 0x0, 0xd0, 0x7,
+    0xe5, 0x80, 0x3, 0x10, 0x20, 0x1, 0xc0, 0x3f,
+    0xcc, 0x1, 0x58, 0x8, 0x0, 0x40, 0x3f, 0xc2,
+    0x1, 0x38, 0x8, 0x0, 0x40, 0x3f, 0xc2, 0x1,
+    0x8, 0x88, 0x0, 0xe0, 0x1f, 0xe9, 0x0, 0xcb,
+    0x40, 0x1, 0xa0, 0xf, 0xca, 0xe0, 0x18, 0x98,
+    0x80, 0xb, 0xaa, 0x1, 0x8e, 0xa8, 0x1, 0xc2,
+    0x1e, 0x20, 0x2, 0xaf, 0xee, 0x7e, 0x28, 0x2,
+    0x80, 0x38, 0xbd, 0x0, 0x30, 0x88, 0x2, 0x3c,
+    0x70, 0x8, 0x40, 0x3, 0x78, 0xe6, 0x20, 0x24,
+    0xd7, 0x86, 0x20, 0x11, 0x80, 0x63, 0x8c, 0xef,
+    0xed, 0x94, 0x0, 0x28, 0x4, 0xe0, 0x1f, 0xfc,
+    0x3c, 0x0, 0x88, 0x3, 0xff, 0x84, 0x2a, 0x0,
+    0x50, 0xf, 0xfe, 0x1c, 0x80, 0x5c, 0x1, 0xff,
+    0xc2, 0x57, 0x0, 0x1a, 0x0, 0x7f, 0xf0, 0x5e,
+    0x80, 0x2e, 0x0, 0xd7, 0x8e, 0x62, 0x2, 0x6f,
+    0xb0, 0x1, 0x51, 0x0, 0x46, 0x87, 0x19, 0xdf,
+    0xd9, 0x4, 0x1, 0x52, 0x80, 0x65, 0x0, 0xff,
+    0x97, 0x94, 0x3, 0x9b, 0xa1, 0x8, 0x2, 0x24,
+    0x8d, 0xa1, 0x0, 0xe0,
 
     /* U+003A ":" */
-    0x5, 0xee, 0x70, 0x2f, 0xff, 0xf4, 0x4f, 0xff,
-    0xf6, 0x1f, 0xff, 0xf3, 0x4, 0xcc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xcc, 0x50, 0x1f, 0xff, 0xf3,
-    0x4f, 0xff, 0xf7, 0x2f, 0xff, 0xf4, 0x5, 0xee,
-    0x70,
+    0x5, 0xee, 0x38, 0x15, 0x8, 0xa1, 0x18, 0x3,
+    0x12, 0x80, 0x65, 0x1b, 0x33, 0x51, 0x82, 0x66,
+    0x14, 0x3, 0xff, 0xcc, 0x79, 0x85, 0x1, 0xc3,
+    0x35, 0x1a, 0x80, 0x64, 0x60, 0xc, 0x65, 0x42,
+    0x28, 0x40,
 
     /* U+003B ";" */
-    0x5, 0xee, 0x70, 0x2f, 0xff, 0xf4, 0x4f, 0xff,
-    0xf6, 0x1f, 0xff, 0xf3, 0x4, 0xcc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xcd, 0x60, 0x1f, 0xff, 0xf3,
-    0x3f, 0xff, 0xf7, 0x1f, 0xff, 0xf5, 0x3, 0xef,
-    0xf1, 0x0, 0xff, 0xb0, 0x3, 0xff, 0x60, 0x7,
-    0xff, 0x0, 0xb, 0xfb, 0x0, 0xf, 0xf5, 0x0,
+    0x5, 0xee, 0x38, 0x15, 0x8, 0xa1, 0x18, 0x3,
+    0x12, 0x80, 0x65, 0x1b, 0x33, 0x51, 0x82, 0x66,
+    0x14, 0x3, 0xff, 0xcc, 0x99, 0xac, 0x3, 0x66,
+    0x52, 0x64, 0x1, 0x90, 0x80, 0x31, 0xe, 0x8,
+    0x1, 0x0, 0xc4, 0x10, 0x40, 0xc0, 0x1a, 0x0,
+    0x40, 0x3, 0x0, 0x30, 0x10, 0x2, 0x40, 0xe0,
+    0x0,
 
     /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16,
-    0xd8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff,
-    0xfd, 0x71, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff,
-    0xa3, 0x0, 0x0, 0x6, 0xcf, 0xff, 0xff, 0xc6,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xe8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xc6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xff, 0xfb, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xcf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x39, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x20,
+    0x0, 0xff, 0xe2, 0x8, 0x7, 0xff, 0x4, 0x5b,
+    0x64, 0x3, 0xfe, 0x4a, 0xe9, 0x20, 0xf, 0xe1,
+    0x7d, 0xb5, 0x0, 0xbc, 0x3, 0xcb, 0x7d, 0x4,
+    0x0, 0x28, 0xe7, 0x0, 0x8a, 0x3a, 0x90, 0x2,
+    0x5c, 0xd7, 0x10, 0x3, 0x66, 0xb8, 0x80, 0xe,
+    0x7e, 0x8c, 0x3, 0x4c, 0x8c, 0x0, 0x2f, 0xb8,
+    0xc0, 0x1f, 0xf4, 0x74, 0x10, 0x7, 0xff, 0x6,
+    0x31, 0x80, 0x3f, 0xd6, 0xe2, 0x0, 0x39, 0xf9,
+    0x30, 0xf, 0x8a, 0x3a, 0xd0, 0x2, 0x6c, 0xd7,
+    0x10, 0xf, 0x92, 0xfa, 0x8, 0x0, 0x51, 0xd6,
+    0xa0, 0x1f, 0xb, 0xed, 0xa8, 0x4, 0x95, 0xca,
+    0x1, 0xf9, 0x2b, 0xa4, 0xc0, 0x3, 0xa0, 0x1f,
+    0xe1, 0x6c, 0xc3, 0x0, 0x7f, 0xf0, 0xce, 0x7e,
+    0x80,
 
     /* U+003D "=" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0xcc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x79, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x9f, 0xff, 0xfe, 0x1c, 0x0, 0x7f, 0xf1, 0x78,
+    0xcf, 0xff, 0x87, 0xcf, 0x99, 0xff, 0xc3, 0x60,
+    0xf, 0xff, 0xc3, 0xee, 0xff, 0xf0, 0xdf, 0x88,
+    0xbf, 0xf8, 0x7e, 0x1, 0xff, 0xc5,
 
     /* U+003E ">" */
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xc6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x8d, 0xff, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xff, 0xff,
-    0xe8, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6, 0xcf,
-    0xff, 0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xcf, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x3, 0xaf, 0xff, 0xff, 0xe8, 0x10, 0x0, 0x1,
-    0x7d, 0xff, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x5b,
-    0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xe9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x10, 0xf, 0xfe, 0x24, 0x63, 0x8, 0x7, 0xff,
+    0x8, 0xe7, 0xa9, 0x0, 0x3f, 0xee, 0x0, 0x96,
+    0xf5, 0xc4, 0x3, 0xf3, 0xeb, 0x90, 0x0, 0xa3,
+    0xad, 0x0, 0x3e, 0x28, 0xdb, 0x50, 0x9, 0x2f,
+    0xa0, 0x80, 0x3e, 0x4a, 0xf9, 0x30, 0x0, 0xbe,
+    0xda, 0x80, 0x7e, 0x6c, 0xd7, 0x10, 0x2, 0x54,
+    0x0, 0x7f, 0x14, 0x74, 0x0, 0x7f, 0xf0, 0x9b,
+    0x20, 0x3, 0xfe, 0x3a, 0xf9, 0x30, 0x0, 0xbc,
+    0x80, 0x61, 0x7d, 0xc5, 0x0, 0x96, 0xfa, 0x4,
+    0x0, 0xb7, 0xd0, 0x40, 0x2, 0x8e, 0xa4, 0x0,
+    0x9b, 0xe9, 0x0, 0x25, 0xcd, 0x71, 0x0, 0xef,
+    0x0, 0x8e, 0x7e, 0x8c, 0x3, 0xf8, 0x5b, 0x71,
+    0x80, 0x3f, 0xeb, 0xe9, 0x20, 0xf, 0xfe, 0x8,
 
     /* U+003F "?" */
-    0x0, 0x0, 0x16, 0xad, 0xff, 0xfe, 0xb7, 0x10,
-    0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x4, 0xff, 0xff, 0xd7,
-    0x31, 0x1, 0x4a, 0xff, 0xff, 0x80, 0x2c, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfe, 0x0,
-    0x7, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6e, 0xe6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc2, 0xd5, 0xbf, 0xf7, 0x5b, 0x88, 0x7,
+    0x86, 0x7a, 0x54, 0x80, 0x21, 0x48, 0xe8, 0x0,
+    0xc7, 0xec, 0x1, 0xff, 0x3d, 0x80, 0x13, 0x4,
+    0x0, 0x51, 0x9d, 0xfd, 0x6a, 0x1, 0x24, 0x3,
+    0x18, 0x2, 0x75, 0xcc, 0x40, 0x52, 0xa8, 0x1,
+    0x30, 0x16, 0x45, 0xb0, 0x7, 0xe5, 0x40, 0x0,
+    0x88, 0x0, 0xe8, 0x1, 0xfe, 0xc0, 0x8, 0xc0,
+    0x3f, 0xf8, 0x5e, 0x1, 0x10, 0x7, 0xff, 0x9,
+    0x80, 0x6, 0x1, 0xff, 0xc2, 0xa1, 0x0, 0x40,
+    0x7, 0xff, 0x6, 0x94, 0x0, 0xc8, 0x1, 0xff,
+    0xad, 0x40, 0xd, 0x20, 0x1f, 0xfb, 0x10, 0x0,
+    0xf2, 0x1, 0xff, 0xa8, 0xc0, 0x11, 0x0, 0xf,
+    0xfc, 0x8a, 0x0, 0x57, 0x0, 0xff, 0xe0, 0xe8,
+    0x5, 0x60, 0x1f, 0xfc, 0x25, 0x0, 0x8, 0x80,
+    0x3f, 0xf8, 0x59, 0xfe, 0xe0, 0xf, 0xff, 0x48,
+    0xbb, 0x84, 0x3, 0xff, 0x87, 0x91, 0xf, 0x0,
+    0xff, 0xe1, 0x19, 0x0, 0x5, 0x0, 0x3f, 0xf8,
+    0x22, 0x1, 0x98, 0x3, 0xff, 0x82, 0x52, 0x22,
+    0x92, 0x0, 0xf0,
 
     /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x59, 0xbe,
-    0xef, 0xfe, 0xca, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xbf,
-    0xff, 0xfd, 0xa7, 0x65, 0x56, 0x8b, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4b, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xcf, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x10,
-    0x0, 0x0, 0x4, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xfb, 0x0, 0x0, 0x1, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x5a, 0xef, 0xfd, 0x94, 0x0, 0x7f, 0xfa,
-    0x0, 0x8f, 0xf6, 0x0, 0x0, 0x8f, 0xf6, 0x0,
-    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0x27,
-    0xff, 0xa0, 0x0, 0xcf, 0xe0, 0x0, 0xf, 0xfd,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0xcd, 0xff,
-    0xfe, 0x9f, 0xfa, 0x0, 0x4, 0xff, 0x60, 0x5,
-    0xff, 0x60, 0x0, 0x2, 0xff, 0xfe, 0x60, 0x0,
-    0x1, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0xd, 0xfb,
-    0x0, 0xbf, 0xf0, 0x0, 0x0, 0xdf, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xfa, 0x0, 0x0,
-    0x7f, 0xf0, 0xe, 0xfc, 0x0, 0x0, 0x4f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xa0,
-    0x0, 0x4, 0xff, 0x31, 0xff, 0x90, 0x0, 0x9,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfa, 0x0, 0x0, 0x1f, 0xf6, 0x2f, 0xf7, 0x0,
-    0x0, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xa0, 0x0, 0x0, 0xff, 0x73, 0xff,
-    0x60, 0x0, 0xd, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0xf, 0xf7,
-    0x3f, 0xf6, 0x0, 0x0, 0xdf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0,
-    0xff, 0x72, 0xff, 0x70, 0x0, 0xc, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x0,
-    0x0, 0x1f, 0xf6, 0x1f, 0xf9, 0x0, 0x0, 0x9f,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xa0, 0x0, 0x3, 0xff, 0x30, 0xef, 0xc0, 0x0,
-    0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfa, 0x0, 0x0, 0x7f, 0xf0, 0xa, 0xff,
-    0x10, 0x0, 0xc, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xb0, 0x0, 0xd, 0xfb, 0x0,
-    0x5f, 0xf6, 0x0, 0x0, 0x2f, 0xff, 0xe6, 0x0,
-    0x0, 0x17, 0xff, 0xef, 0xff, 0x30, 0x8, 0xff,
-    0x40, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xcb, 0xdf, 0xff, 0xe1, 0xef, 0xff, 0xcd,
-    0xff, 0xb0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0,
-    0x3d, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x5, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x1e, 0xff, 0x20,
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x40, 0x0,
-    0x4, 0xbe, 0xfc, 0x70, 0x0, 0x0, 0x0, 0x4f,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe7,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x28, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xda, 0x76, 0x66, 0x8a, 0xdf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef, 0xff,
-    0xec, 0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xcb, 0x37, 0xdc, 0xff, 0x76, 0x53,
+    0x90, 0x7, 0xff, 0x20, 0xeb, 0xe9, 0x90, 0x44,
+    0x0, 0x13, 0x58, 0xdd, 0x30, 0x7, 0xff, 0x10,
+    0xaf, 0x14, 0x0, 0x4b, 0x13, 0x54, 0x97, 0x40,
+    0x1, 0x4f, 0x30, 0x7, 0xff, 0x5, 0xb5, 0x0,
+    0x63, 0xb6, 0x9d, 0x95, 0x4d, 0x17, 0xf6, 0x80,
+    0x33, 0x62, 0x1, 0xfe, 0x89, 0x0, 0x47, 0x38,
+    0x80, 0x7f, 0x92, 0xf4, 0xc1, 0x30, 0x40, 0x3f,
+    0x3b, 0x80, 0x71, 0xc0, 0x3f, 0xf8, 0x65, 0x90,
+    0x5, 0x82, 0x1, 0xe4, 0x80, 0x2f, 0x30, 0xf,
+    0xfe, 0x33, 0xc8, 0x15, 0x0, 0x70, 0xd0, 0x3,
+    0xc4, 0x3, 0x96, 0xbb, 0xfd, 0xb2, 0x80, 0x7,
+    0xff, 0x50, 0x33, 0x82, 0x30, 0x6, 0x91, 0x9,
+    0x20, 0xc, 0x7b, 0x4a, 0x20, 0x2, 0x6b, 0xb1,
+    0x0, 0x7a, 0xc, 0x20, 0x3, 0x38, 0x13, 0x0,
+    0x65, 0xc2, 0x0, 0x88, 0xc8, 0x0, 0x99, 0xc0,
+    0x1e, 0x80, 0x16, 0x0, 0x28, 0x2, 0xc0, 0x31,
+    0x50, 0x0, 0x67, 0xf7, 0x37, 0x9c, 0x5, 0x80,
+    0x3c, 0x84, 0x1a, 0x0, 0xe0, 0x3, 0x0, 0x6f,
+    0x0, 0xf, 0xb0, 0x6, 0x18, 0xc0, 0xf, 0xea,
+    0x4, 0x0, 0x28, 0x18, 0x6, 0x42, 0x0, 0x68,
+    0x80, 0x7c, 0x72, 0x1, 0xf8, 0xc0, 0x6, 0x22,
+    0x5, 0x0, 0xda, 0x0, 0x43, 0x0, 0xfe, 0x61,
+    0x0, 0xf9, 0x40, 0xa, 0x60, 0xe, 0x0, 0xca,
+    0x0, 0xc0, 0xf, 0xf9, 0xc0, 0x3e, 0x10, 0x0,
+    0x88, 0x0, 0x20, 0x18, 0x40, 0x4, 0x1, 0xff,
+    0x70, 0x7, 0xff, 0x88, 0x40, 0x2, 0x1, 0x84,
+    0x0, 0x40, 0x1f, 0xf7, 0x0, 0x7c, 0x20, 0x1,
+    0x30, 0x7, 0x0, 0x65, 0x0, 0x60, 0x7, 0xfc,
+    0xe0, 0x1f, 0x10, 0x1, 0x44, 0x40, 0xa0, 0x1b,
+    0x40, 0x8, 0x60, 0x1f, 0xca, 0x20, 0x1f, 0x20,
+    0x0, 0xc1, 0x0, 0xc4, 0x2, 0x43, 0x0, 0x70,
+    0x80, 0x7c, 0x74, 0x1, 0x8, 0x6, 0xa0, 0x40,
+    0x7, 0x80, 0x1c, 0x3, 0x70, 0x0, 0xbd, 0x80,
+    0x30, 0xbe, 0x0, 0x80, 0x10, 0xc0, 0x10, 0x41,
+    0xe0, 0x5, 0x0, 0x58, 0x6, 0x2a, 0x0, 0xc,
+    0xfe, 0x5e, 0xf4, 0x0, 0xf8, 0x80, 0x33, 0x1a,
+    0xe0, 0x88, 0x0, 0x9c, 0x9, 0xc0, 0x32, 0xe1,
+    0x0, 0x46, 0x84, 0x0, 0x4c, 0x1b, 0x0, 0x8c,
+    0x80, 0xe8, 0x3, 0x48, 0x84, 0x10, 0x6, 0x3d,
+    0xa5, 0x10, 0x1, 0x2d, 0xd8, 0x81, 0x6d, 0x4,
+    0xe, 0x30, 0x40, 0x30, 0xd0, 0x3, 0x4, 0x3,
+    0x96, 0xbb, 0xfd, 0xb4, 0x80, 0x19, 0x2f, 0xbf,
+    0x1c, 0x3, 0xe4, 0x80, 0x1f, 0x30, 0xf, 0xfe,
+    0x93, 0xb8, 0x7, 0x20, 0x3, 0xff, 0xa5, 0x12,
+    0x0, 0x7e, 0x72, 0x0, 0xfe, 0x28, 0x90, 0xf,
+    0xfe, 0x23, 0x6a, 0x0, 0xc6, 0xea, 0x9d, 0x9a,
+    0x8a, 0xdd, 0x3b, 0x0, 0x7f, 0xf1, 0x4a, 0xec,
+    0x80, 0x2, 0x58, 0x99, 0x9d, 0x48, 0x0, 0xa2,
+    0x1, 0xff, 0xc6, 0x4b, 0xea, 0x63, 0x10, 0x8,
+    0x4d, 0xab, 0xa8, 0x40, 0x3f, 0x80,
 
     /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x7f,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf5, 0x1f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xe0, 0x9, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x70, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0, 0x0,
-    0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x4f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf2, 0x0, 0x0, 0xd, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xa0,
-    0x0, 0x0, 0x6, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfe,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff,
-    0x60, 0x0, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0,
-    0x0, 0xe, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf5, 0x0, 0x0, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0xef, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x30, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0,
-    0xc, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xff, 0xdb, 0xff, 0x10, 0x7, 0xff, 0x29,
+    0x8, 0x2, 0xb0, 0xf, 0xfe, 0x54, 0x0, 0x66,
+    0x10, 0xf, 0xfe, 0x41, 0x98, 0x3, 0xa4, 0x3,
+    0xff, 0x91, 0x20, 0x3, 0x80, 0x3, 0x80, 0x7f,
+    0xf1, 0xc9, 0x40, 0x12, 0xc0, 0x13, 0x80, 0x7f,
+    0xf1, 0xac, 0x0, 0x2a, 0x2c, 0x0, 0x90, 0xf,
+    0xfe, 0x28, 0xb0, 0x2, 0x40, 0x16, 0x0, 0x15,
+    0x0, 0xff, 0xe2, 0x48, 0x4, 0xe0, 0x2, 0x40,
+    0x4, 0x0, 0x7f, 0xf1, 0x18, 0x0, 0xc0, 0x1b,
+    0xc0, 0x4, 0x80, 0x1f, 0xfc, 0x26, 0x10, 0x5,
+    0x80, 0x64, 0x20, 0x7, 0x80, 0x7f, 0xf0, 0xac,
+    0x0, 0xa4, 0x1, 0xd6, 0x0, 0x43, 0x0, 0xff,
+    0xca, 0x40, 0x9, 0x0, 0xf3, 0x8, 0x2, 0x40,
+    0x3f, 0xf4, 0x80, 0xc, 0xc0, 0x1f, 0x30, 0x1,
+    0x48, 0x3, 0xfc, 0x66, 0x0, 0x48, 0x7, 0xe9,
+    0x0, 0xac, 0x3, 0xfd, 0x0, 0x1, 0x50, 0xf,
+    0xc2, 0xa0, 0x6, 0x10, 0xf, 0xc4, 0x80, 0x1,
+    0xff, 0xff, 0x28, 0x4, 0xc0, 0x1f, 0xac, 0x3,
+    0xff, 0x8d, 0x20, 0x1f, 0xb, 0x0, 0x4, 0x8b,
+    0xff, 0x82, 0x0, 0x16, 0x0, 0xf4, 0x80, 0x59,
+    0xbb, 0xff, 0xc1, 0x20, 0x5, 0x80, 0x79, 0x80,
+    0xa, 0x40, 0x1f, 0xfc, 0x1b, 0x0, 0x12, 0x80,
+    0x66, 0x10, 0x4, 0x80, 0x7f, 0xf0, 0x98, 0x40,
+    0x12, 0x1, 0xa0, 0x0, 0x66, 0x0, 0xff, 0xe1,
+    0xb0, 0x0, 0xcc, 0x0, 0x51, 0x0, 0x48, 0x7,
+    0xff, 0x12, 0x40, 0x28, 0x0, 0x48, 0x0, 0x54,
+    0x3, 0xff, 0x88, 0x2c, 0x0, 0x42,
 
     /* U+0042 "B" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x50, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0, 0x3f,
-    0xff, 0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff,
-    0xf9, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xf5, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x2, 0x5c, 0xff, 0xfb, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x81, 0x0, 0x3, 0xff, 0xfe,
-    0xee, 0xee, 0xee, 0xee, 0xef, 0xff, 0xff, 0xf4,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x8f, 0xff, 0xf4, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xd0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0x33, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x63, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0x13, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x27, 0xef, 0xff, 0x90, 0x3f, 0xff, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xc0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xed, 0xa6, 0x10, 0x0, 0x0,
+    0x3f, 0xff, 0xfd, 0xdb, 0x4a, 0x1, 0xff, 0xc7,
+    0x12, 0x5a, 0xe6, 0x0, 0xfc, 0x23, 0xfc, 0x1,
+    0x86, 0x64, 0x1, 0xf4, 0x77, 0x7e, 0xfc, 0x50,
+    0x9, 0x94, 0x3, 0xff, 0x88, 0x75, 0x20, 0x14,
+    0x80, 0x7f, 0xf1, 0x98, 0xc0, 0x6, 0x1, 0xff,
+    0xc7, 0x40, 0x8, 0x40, 0x3f, 0xf9, 0x42, 0x1,
+    0xff, 0xc6, 0x40, 0x1, 0x0, 0x7f, 0xf1, 0x9c,
+    0xc0, 0x16, 0x1, 0xff, 0xc3, 0x25, 0xc8, 0x0,
+    0x23, 0x0, 0x7a, 0x7f, 0xff, 0x6d, 0x18, 0x1,
+    0x6c, 0x3, 0xff, 0x92, 0x42, 0x1, 0xf0, 0x8f,
+    0xf8, 0x3, 0x3f, 0x20, 0x7, 0xa3, 0xbb, 0xfb,
+    0xf1, 0xc0, 0x2b, 0x40, 0xf, 0xfe, 0x21, 0xc6,
+    0x80, 0x52, 0x1, 0xff, 0xc6, 0x28, 0x0, 0x11,
+    0x80, 0x7f, 0xf1, 0x90, 0x2, 0x50, 0xf, 0xfe,
+    0xea, 0x0, 0x46, 0x1, 0xff, 0xc5, 0x29, 0x0,
+    0x90, 0x3, 0xff, 0x86, 0x4f, 0x82, 0x0, 0x61,
+    0x0, 0xd1, 0xdd, 0xfd, 0xfb, 0x2, 0x0, 0x39,
+    0x0, 0xe1, 0x1f, 0xf0, 0x7, 0x3e, 0x0, 0x7f,
+    0xf1, 0x4, 0x96, 0x7a, 0x0, 0x20,
 
     /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc7, 0x43, 0x24, 0x6b, 0xff, 0xff, 0xf4,
-    0x0, 0x5, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xd1, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x10,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x10,
-    0x0, 0x6, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xd2, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc7, 0x43, 0x24, 0x6b, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0,
+    0x0, 0xfe, 0x49, 0xce, 0xff, 0x76, 0x4a, 0x0,
+    0x7f, 0xe7, 0xeb, 0x63, 0x10, 0x0, 0x9b, 0x5f,
+    0xb8, 0x7, 0xe4, 0xe8, 0x10, 0xf, 0xfa, 0x38,
+    0xc0, 0x39, 0xac, 0x40, 0x23, 0x8b, 0xcd, 0xb9,
+    0x40, 0x8, 0x71, 0x0, 0x25, 0x90, 0x8, 0xb3,
+    0xe, 0x86, 0x48, 0xd7, 0xca, 0x0, 0x25, 0x0,
+    0x15, 0x0, 0x4d, 0xa6, 0x1, 0xf8, 0x6a, 0x87,
+    0x82, 0x0, 0xe0, 0x9, 0xa4, 0x3, 0xff, 0x2e,
+    0x8, 0x1, 0xc, 0x0, 0x72, 0x1, 0xff, 0xc6,
+    0xe0, 0xb, 0xc0, 0x3f, 0xf8, 0xe8, 0x0, 0x23,
+    0x0, 0xff, 0xe3, 0x8, 0x80, 0xa, 0x1, 0xff,
+    0xc7, 0x20, 0xb, 0x80, 0x3f, 0xf8, 0xee, 0x1,
+    0x18, 0x7, 0xff, 0x1d, 0xc0, 0x23, 0x0, 0xff,
+    0xe3, 0x90, 0x5, 0xc0, 0x1f, 0xfc, 0x71, 0x10,
+    0x1, 0x40, 0x3f, 0xf9, 0x8, 0x0, 0x23, 0x0,
+    0xff, 0xe3, 0xf0, 0x5, 0xe0, 0x1f, 0xfc, 0x74,
+    0x30, 0x1, 0xc8, 0x7, 0xff, 0x1f, 0x80, 0x26,
+    0x80, 0xf, 0xfc, 0xd8, 0x20, 0x11, 0x48, 0x4,
+    0xf8, 0x60, 0x1f, 0x8a, 0xa4, 0xf0, 0x80, 0x26,
+    0x90, 0x8, 0xf3, 0xe, 0x86, 0x48, 0xd7, 0xaa,
+    0x0, 0x26, 0x0, 0xcd, 0x62, 0x1, 0x1c, 0x5e,
+    0x6d, 0xca, 0x0, 0x43, 0xa8, 0x1, 0xc9, 0xce,
+    0x20, 0x1f, 0xe1, 0x8e, 0x20, 0xf, 0xd1, 0xd4,
+    0xc6, 0x20, 0x1, 0x36, 0xbe, 0x70, 0x8,
 
     /* U+0044 "D" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x3f,
-    0xff, 0x61, 0x11, 0x11, 0x11, 0x24, 0x8d, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xe1, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf8, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x60, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xa0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xd0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x60, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0x10, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xf9, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe1, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0x30,
-    0x0, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x11, 0x24,
-    0x8d, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xb8,
-    0x30, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfd, 0xb7, 0x6, 0x1, 0xff, 0xca,
+    0x24, 0x7c, 0xd6, 0x0, 0xff, 0xe6, 0x14, 0xe1,
+    0x0, 0x7f, 0x4f, 0x77, 0xdb, 0x6e, 0x40, 0x11,
+    0xea, 0x0, 0x7f, 0x8, 0xfc, 0x49, 0x1b, 0x64,
+    0x1, 0x59, 0x80, 0x7f, 0xf1, 0xd3, 0x58, 0x2,
+    0xd1, 0x0, 0xff, 0xe4, 0x4a, 0x80, 0x6, 0x40,
+    0x3f, 0xf9, 0x34, 0x20, 0x7, 0x10, 0xf, 0xfe,
+    0x4c, 0x0, 0x4e, 0x1, 0xff, 0xc9, 0x60, 0xb,
+    0x0, 0x3f, 0xf9, 0x46, 0x0, 0x70, 0xf, 0xfe,
+    0x53, 0x0, 0x8, 0x3, 0xff, 0x94, 0x60, 0x1f,
+    0xfc, 0xd3, 0x0, 0xff, 0xe6, 0xb0, 0x0, 0x80,
+    0x3f, 0xf9, 0x46, 0x0, 0x70, 0xf, 0xfe, 0x4b,
+    0x0, 0x58, 0x1, 0xff, 0xc9, 0x80, 0x9, 0xc0,
+    0x3f, 0xf9, 0x14, 0x20, 0x6, 0x10, 0xf, 0xfe,
+    0x3c, 0xa8, 0x0, 0x60, 0x3, 0xff, 0x8c, 0x9a,
+    0xc0, 0x16, 0x88, 0x7, 0xc2, 0x3f, 0x12, 0x46,
+    0xd9, 0x0, 0x56, 0x60, 0x1f, 0x4f, 0x77, 0xdb,
+    0x6e, 0x40, 0x11, 0x6a, 0x0, 0x7f, 0xf2, 0x4a,
+    0x74, 0x80, 0x3f, 0xf8, 0xc4, 0x8f, 0x9a, 0xc0,
+    0x1f,
 
     /* U+0045 "E" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x10, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1,
+    0x3f, 0xff, 0xfe, 0x2c, 0x80, 0x7f, 0xf8, 0x67,
+    0xbb, 0xff, 0x83, 0x20, 0x1e, 0x11, 0xff, 0xe0,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfc, 0xf3, 0xff,
+    0xff, 0x80, 0x3f, 0xfc, 0x73, 0xff, 0xff, 0x80,
+    0x3f, 0xff, 0xe0, 0x1f, 0xfe, 0x91, 0x1f, 0xfe,
+    0x10, 0x7, 0x4f, 0x77, 0xff, 0x8, 0x40, 0x3f,
+    0xfb, 0x80,
 
     /* U+0046 "F" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xf6, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfe, 0x2c, 0x80, 0x7f, 0xf7, 0xa7,
+    0xbb, 0xff, 0x83, 0x20, 0x1c, 0x23, 0xff, 0xc1,
+    0x0, 0xff, 0xff, 0x80, 0x7f, 0xfc, 0xe7, 0xff,
+    0xff, 0x0, 0x7f, 0xf8, 0x27, 0xff, 0xff, 0x0,
+    0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfc,
+    0xb0,
 
     /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xca, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc8, 0x53, 0x24, 0x5a, 0xef, 0xff, 0xf8,
-    0x0, 0x5, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xf3, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0x30,
-    0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7a, 0xa7, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfb, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfb, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfb, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0x0, 0x5, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xef, 0xfb, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc8, 0x43, 0x23, 0x59, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xda, 0x61, 0x0, 0x0,
+    0x0, 0xfe, 0x49, 0xce, 0xff, 0x76, 0x52, 0x88,
+    0x7, 0xfc, 0xfd, 0x6c, 0x62, 0x0, 0x13, 0x5a,
+    0xe9, 0x10, 0xf, 0x8f, 0x60, 0x40, 0x3f, 0xe6,
+    0xe6, 0x0, 0xe6, 0xc2, 0x0, 0x8d, 0xeb, 0x36,
+    0xe9, 0x44, 0x2, 0x98, 0x0, 0x96, 0x40, 0x22,
+    0xcc, 0x42, 0x99, 0x22, 0xd7, 0x40, 0x80, 0x2c,
+    0x0, 0x54, 0x1, 0x36, 0x98, 0x7, 0xf3, 0xe2,
+    0x61, 0x80, 0x24, 0x2, 0x69, 0x0, 0xff, 0xc5,
+    0x66, 0x0, 0x34, 0x0, 0x1c, 0x80, 0x7f, 0xf1,
+    0xa8, 0x2, 0xf0, 0xf, 0xfe, 0x3b, 0x80, 0xc,
+    0xc0, 0x1f, 0xfc, 0x61, 0x10, 0x1, 0x0, 0x3f,
+    0xf8, 0xe4, 0x1, 0x70, 0x7, 0xff, 0x1d, 0xc0,
+    0x23, 0x0, 0xff, 0xe1, 0xbd, 0x51, 0xdc, 0x1,
+    0x18, 0x7, 0xff, 0xe, 0xd5, 0x58, 0x40, 0x17,
+    0x0, 0x7f, 0xf1, 0xc4, 0x40, 0x5, 0x0, 0xff,
+    0xe4, 0x38, 0x0, 0x8c, 0x3, 0xff, 0x8f, 0xa0,
+    0x17, 0x80, 0x7f, 0xf1, 0xd1, 0x0, 0x3, 0x90,
+    0xf, 0xfe, 0x3c, 0x80, 0x4d, 0x20, 0x1f, 0xfc,
+    0x62, 0xa0, 0x9, 0xb4, 0xc0, 0x3f, 0x94, 0x80,
+    0x3c, 0xb2, 0x1, 0x16, 0x62, 0x10, 0xc8, 0xd6,
+    0x7a, 0x84, 0x0, 0x20, 0x19, 0xb0, 0x80, 0x23,
+    0x7b, 0xcd, 0xca, 0x61, 0x0, 0x96, 0xc0, 0x38,
+    0xf6, 0x4, 0x3, 0xfe, 0x4b, 0xa1, 0x0, 0xf9,
+    0xfa, 0xd8, 0xc4, 0x0, 0x24, 0xb3, 0xd6, 0x80,
+    0x0,
 
     /* U+0048 "H" */
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x73,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0x3f, 0xff, 0x61, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x3f, 0xff, 0x73, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x70,
+    0x3f, 0xf9, 0x80, 0x3f, 0xf8, 0x25, 0xff, 0x38,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xf2, 0x11, 0xff, 0xe1, 0x0, 0x7e, 0x9e, 0xef,
+    0xfe, 0xe, 0x0, 0x7f, 0xfa, 0xa7, 0xff, 0xff,
+    0x83, 0xa0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xf8,
 
     /* U+0049 "I" */
-    0x3f, 0xff, 0x63, 0xff, 0xf6, 0x3f, 0xff, 0x63,
-    0xff, 0xf6, 0x3f, 0xff, 0x63, 0xff, 0xf6, 0x3f,
-    0xff, 0x63, 0xff, 0xf6, 0x3f, 0xff, 0x63, 0xff,
-    0xf6, 0x3f, 0xff, 0x63, 0xff, 0xf6, 0x3f, 0xff,
-    0x63, 0xff, 0xf6, 0x3f, 0xff, 0x63, 0xff, 0xf6,
-    0x3f, 0xff, 0x63, 0xff, 0xf6, 0x3f, 0xff, 0x63,
-    0xff, 0xf6, 0x3f, 0xff, 0x63, 0xff, 0xf6, 0x3f,
-    0xff, 0x63, 0xff, 0xf6, 0x3f, 0xff, 0x60,
+    0x3f, 0xf9, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xfe,
+    0x10,
 
     /* U+004A "J" */
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x1, 0x11, 0x11, 0x11, 0x11, 0xbf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc,
-    0x0, 0x93, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
-    0x8, 0xfe, 0x30, 0x0, 0x0, 0xa, 0xff, 0xf5,
-    0x1f, 0xff, 0xfa, 0x41, 0x14, 0xbf, 0xff, 0xe0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+    0x0, 0xb3, 0xff, 0xfe, 0xe0, 0xf, 0xfe, 0xbe,
+    0xf7, 0x7e, 0x40, 0xf, 0x8, 0xff, 0x80, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0x68,
+    0x80, 0xc, 0x3, 0xff, 0x38, 0x0, 0x40, 0x12,
+    0x60, 0x1f, 0x9, 0x80, 0x14, 0x21, 0xb4, 0xc0,
+    0x3d, 0x60, 0x16, 0xb, 0x80, 0xe5, 0x20, 0x89,
+    0x2d, 0x40, 0x2, 0xa3, 0x40, 0x12, 0xdf, 0x72,
+    0xd0, 0x2, 0xd0, 0x2, 0xe1, 0x0, 0x7e, 0x1b,
+    0x30, 0x8, 0xf6, 0xd4, 0x80, 0x2, 0x93, 0xc8,
+    0x0,
 
     /* U+004B "K" */
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfa, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xfb, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfc, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfd, 0x10, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x5, 0xff, 0xfd, 0x10, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x4, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x4, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x4, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x4, 0xff,
-    0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x3, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x63, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x68, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0x60, 0xa, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0xb, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xd, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf6,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf2,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xd1, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x90, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x60,
+    0x3f, 0xf9, 0x80, 0x3f, 0xf3, 0x7f, 0xd4, 0x1,
+    0xff, 0xc5, 0x69, 0x0, 0x25, 0x0, 0x7f, 0xf1,
+    0x1a, 0x40, 0x9, 0x60, 0x1f, 0xfc, 0x45, 0x90,
+    0x1, 0xd8, 0x7, 0xff, 0x11, 0x68, 0x0, 0x78,
+    0x1, 0xff, 0xc4, 0x5a, 0x0, 0x16, 0x80, 0x7f,
+    0xf1, 0x16, 0x80, 0x5, 0x82, 0x1, 0xff, 0xc3,
+    0x4a, 0x0, 0xe, 0x8, 0x7, 0xff, 0xd, 0x2c,
+    0x0, 0x38, 0x20, 0x1f, 0xfc, 0x34, 0xb0, 0x0,
+    0xe1, 0x0, 0x7f, 0xf0, 0xd2, 0xc0, 0x3, 0xa4,
+    0x1, 0xff, 0xc3, 0x3b, 0x0, 0x90, 0xc0, 0x3f,
+    0xf8, 0x67, 0x80, 0x19, 0x5c, 0x3, 0xff, 0x85,
+    0xf8, 0x1, 0xe8, 0x40, 0xf, 0xfe, 0xb, 0x0,
+    0x52, 0xe0, 0x15, 0x90, 0x7, 0xff, 0xe, 0x5a,
+    0x14, 0x2, 0xf1, 0x0, 0xff, 0xe0, 0xcb, 0x0,
+    0x29, 0x0, 0x5, 0xa0, 0x1f, 0xfa, 0x58, 0x3,
+    0x59, 0x0, 0xe, 0x40, 0x3f, 0xce, 0xc0, 0x1e,
+    0xc1, 0x0, 0x33, 0x0, 0x3f, 0xb8, 0x3, 0xe1,
+    0xd0, 0xa, 0x50, 0x3, 0xff, 0x8a, 0x76, 0x1,
+    0x59, 0x0, 0x7f, 0xf1, 0x52, 0x40, 0x2f, 0x10,
+    0xf, 0xfe, 0x2b, 0x38, 0x0, 0xa8, 0x3, 0xff,
+    0x8d, 0xa, 0x0, 0x49, 0x0, 0xff, 0xe3, 0x51,
+    0x80, 0x19, 0x80,
 
     /* U+004C "L" */
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x3f, 0xf9, 0x80, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xcc, 0x11, 0xff, 0xe0,
+    0x80, 0x74, 0xf7, 0x7f, 0xf0, 0x40, 0x3f, 0xfb,
+    0x60,
 
     /* U+004D "M" */
-    0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x3f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x3f, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf9, 0x3f, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf9,
-    0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xf9, 0x3f, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf9, 0x3f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf9, 0x3f, 0xff, 0xaf, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xfa, 0xef, 0xf9,
-    0x3f, 0xff, 0x3c, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf9, 0x3f, 0xff,
-    0x33, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0x70, 0xef, 0xf9, 0x3f, 0xff, 0x30, 0x9f,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0x0,
-    0xef, 0xf9, 0x3f, 0xff, 0x30, 0x1e, 0xff, 0x90,
-    0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0xef, 0xf9,
-    0x3f, 0xff, 0x30, 0x6, 0xff, 0xf3, 0x0, 0x0,
-    0xc, 0xff, 0xa0, 0x0, 0xef, 0xf9, 0x3f, 0xff,
-    0x30, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x5f, 0xff,
-    0x10, 0x0, 0xef, 0xf9, 0x3f, 0xff, 0x30, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0xef, 0xf7, 0x0, 0x0,
-    0xef, 0xf9, 0x3f, 0xff, 0x30, 0x0, 0x9, 0xff,
-    0xe1, 0x8, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xf9,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0xef, 0xf9, 0x2f,
-    0xff, 0x40, 0x0, 0x0, 0xef, 0xf9, 0x3f, 0xff,
-    0x30, 0x0, 0x0, 0x5f, 0xff, 0xcf, 0xfa, 0x0,
-    0x0, 0x0, 0xef, 0xf9, 0x3f, 0xff, 0x30, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xdf, 0xf9, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xf9,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x3f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xd, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf9, 0x3f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf9, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9,
-    0x3f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9,
+    0x3f, 0xf8, 0x40, 0x3f, 0xf8, 0xf7, 0xfe, 0x80,
+    0xd, 0x60, 0x1f, 0xfc, 0x64, 0x40, 0x0, 0x40,
+    0x32, 0x98, 0x7, 0xff, 0x16, 0x40, 0x3f, 0xb8,
+    0x3, 0xff, 0x88, 0xe4, 0x1, 0xfc, 0x4c, 0x1,
+    0xff, 0xc2, 0x18, 0x0, 0xff, 0xa0, 0x40, 0x3f,
+    0xf8, 0x36, 0x1, 0xff, 0x86, 0x0, 0x3f, 0xf1,
+    0xa8, 0x7, 0xf9, 0x40, 0xc, 0x60, 0x1f, 0xf7,
+    0x80, 0x14, 0x40, 0x3e, 0x93, 0x0, 0x78, 0x7,
+    0xf9, 0x8c, 0x1, 0x60, 0x1f, 0xde, 0x0, 0x36,
+    0x0, 0xfc, 0x30, 0x0, 0x81, 0x0, 0xfe, 0x36,
+    0x0, 0x40, 0x80, 0x7d, 0x2, 0x4, 0xe0, 0x1f,
+    0xf4, 0x8, 0xc, 0x0, 0x78, 0x98, 0x1, 0x20,
+    0x1f, 0xf8, 0x60, 0x0, 0xc6, 0x1, 0xdc, 0x0,
+    0x54, 0x0, 0xff, 0xe0, 0xb1, 0x80, 0x3c, 0x3,
+    0x29, 0x80, 0x2c, 0x3, 0xff, 0x87, 0xc0, 0x3,
+    0x60, 0xa, 0xc0, 0x10, 0x20, 0x1f, 0xfc, 0x32,
+    0x60, 0x4, 0x8, 0x40, 0x81, 0x38, 0x7, 0xff,
+    0x16, 0x44, 0x6, 0x9, 0xc0, 0x12, 0x1, 0xff,
+    0xc7, 0xb0, 0x3, 0x70, 0x1, 0x50, 0x3, 0xff,
+    0x8e, 0xa6, 0x0, 0x30, 0x5, 0x80, 0x78, 0xc0,
+    0x3f, 0xf8, 0x5c, 0x1, 0xa0, 0x40, 0x3f, 0xf9,
+    0x24, 0xe0, 0x2, 0x70, 0xf, 0xfe, 0x5c, 0x10,
+    0x48, 0x7, 0xff, 0x37, 0x7d, 0x0, 0x3f, 0xff,
+    0x0,
 
     /* U+004E "N" */
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x73, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x73, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x73, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0xdf,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x73, 0xff, 0xf6, 0xbf, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0xdf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x73,
-    0xff, 0xf6, 0x2, 0xef, 0xff, 0x70, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x4, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2f, 0xff, 0x73, 0xff,
-    0xf6, 0x0, 0x7, 0xff, 0xfe, 0x20, 0x0, 0x2,
-    0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0, 0xa, 0xff,
-    0xfd, 0x0, 0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6,
-    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x2, 0xff,
-    0xf7, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x1e, 0xff,
-    0xf7, 0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf5, 0x2, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf2, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xd3, 0xff, 0xf7, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xdf, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xf7, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf7, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x70,
+    0x3f, 0xf8, 0x80, 0x3f, 0xf8, 0x25, 0xff, 0x38,
+    0x6, 0xf1, 0x0, 0xff, 0xe4, 0x95, 0x0, 0x7f,
+    0xf2, 0x92, 0x40, 0x3f, 0xf9, 0x4c, 0xc0, 0xf,
+    0xfe, 0x54, 0x98, 0x7, 0xff, 0x18, 0x80, 0x2d,
+    0x10, 0xf, 0xfe, 0x2d, 0xa0, 0x0, 0x74, 0x3,
+    0xff, 0x8d, 0x64, 0x0, 0x3a, 0x0, 0xff, 0xe3,
+    0x78, 0x80, 0x15, 0xc0, 0x3f, 0xf8, 0xa5, 0x40,
+    0x14, 0x20, 0x7, 0xff, 0x15, 0x20, 0x2, 0xa2,
+    0x0, 0xff, 0xe2, 0xba, 0x80, 0x7, 0xc0, 0x3f,
+    0xf8, 0xd4, 0x60, 0x2, 0xa0, 0xf, 0xfe, 0x36,
+    0x88, 0x1, 0x5c, 0x3, 0xff, 0x8a, 0x3a, 0x1,
+    0x42, 0x80, 0x7f, 0xf1, 0x4e, 0x40, 0x2a, 0x20,
+    0xf, 0xfe, 0x2b, 0x30, 0x2, 0xf1, 0x0, 0xff,
+    0xe2, 0xc9, 0x80, 0xb, 0x80, 0x3f, 0xf8, 0xda,
+    0x20, 0x2, 0x0, 0xff, 0xe3, 0xe, 0x80, 0x7f,
+    0xf2, 0x8e, 0x80, 0x3f, 0xf9, 0x4a, 0xe0, 0x1f,
+    0xfc, 0xa8, 0x40, 0xf, 0xfe, 0x55, 0x90, 0x4,
 
     /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xca, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xc7,
-    0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70,
-    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0xe, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
-    0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x3, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23, 0x6a, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x49, 0xce, 0xff, 0x76, 0x52, 0x88,
+    0x7, 0xff, 0xd, 0xfa, 0xd8, 0xc4, 0x0, 0x26,
+    0xb5, 0xd2, 0x20, 0x1f, 0xf1, 0xec, 0x8, 0x7,
+    0xfc, 0xdc, 0xc0, 0x1f, 0xcb, 0x84, 0x1, 0x1c,
+    0x5e, 0x6e, 0x4a, 0x0, 0x69, 0x90, 0x7, 0xcb,
+    0x40, 0x11, 0xe6, 0x1d, 0xc, 0x8d, 0xaf, 0x94,
+    0x2, 0x69, 0x0, 0xe2, 0xa0, 0x9, 0xb0, 0xc0,
+    0x3f, 0xd, 0x50, 0x2, 0x65, 0x0, 0xd2, 0x1,
+    0x34, 0x80, 0x7f, 0xe5, 0xa0, 0xa, 0xc0, 0x23,
+    0x40, 0x1, 0xc8, 0x7, 0xff, 0x9, 0x58, 0x0,
+    0x2e, 0x0, 0xa0, 0xb, 0xc0, 0x3f, 0xf8, 0x92,
+    0x20, 0xa, 0x0, 0x38, 0x0, 0x8c, 0x3, 0xff,
+    0x8a, 0xe0, 0x2, 0x20, 0x88, 0x0, 0xa0, 0x1f,
+    0xfc, 0x6c, 0x0, 0x9c, 0x80, 0x2e, 0x0, 0xff,
+    0xe3, 0x38, 0x4, 0x4e, 0x1, 0x18, 0x7, 0xff,
+    0x18, 0xc0, 0x33, 0x80, 0x46, 0x1, 0xff, 0xc6,
+    0x30, 0xc, 0x40, 0x17, 0x0, 0x7f, 0xf1, 0x9c,
+    0x2, 0x21, 0x10, 0x1, 0x40, 0x3f, 0xf8, 0xd8,
+    0x1, 0x38, 0x38, 0x0, 0x8c, 0x3, 0xff, 0x8a,
+    0xe0, 0x2, 0x20, 0x50, 0x5, 0xe0, 0x1f, 0xfc,
+    0x48, 0x10, 0x5, 0x0, 0xd, 0x0, 0x7, 0x20,
+    0x1f, 0xfc, 0x25, 0x70, 0x0, 0xb0, 0x5, 0x20,
+    0x13, 0x40, 0x7, 0xfe, 0x5a, 0x0, 0xac, 0x40,
+    0x22, 0xa0, 0x9, 0xf0, 0xc0, 0x3f, 0xc, 0xd0,
+    0x4, 0xca, 0x1, 0xcb, 0x20, 0x11, 0xe6, 0x1d,
+    0xc, 0x8d, 0xab, 0x98, 0x2, 0x59, 0x0, 0xf9,
+    0xb0, 0x80, 0x23, 0x8b, 0xcd, 0xc9, 0x50, 0xd,
+    0x14, 0x1, 0xfc, 0x7b, 0x2, 0x1, 0xff, 0x37,
+    0x38, 0x7, 0xfe, 0x7e, 0xb6, 0x31, 0x0, 0x9,
+    0x2c, 0xf4, 0x88, 0x7, 0x80,
 
     /* U+0050 "P" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x12, 0x47,
-    0xdf, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xe0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x25, 0xbf, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x94,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x61, 0x11, 0x11,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xfb, 0xae, 0xc, 0x3, 0xff, 0x8c,
+    0x28, 0xf9, 0xa6, 0x1, 0xff, 0xc8, 0x2c, 0x80,
+    0xf, 0xa7, 0xbb, 0xdb, 0x70, 0x40, 0x13, 0xb8,
+    0x3, 0xe1, 0x1f, 0x12, 0x3e, 0xc8, 0x5, 0x4,
+    0x1, 0xff, 0xc4, 0x69, 0x0, 0xac, 0x3, 0xff,
+    0x8a, 0xc4, 0x0, 0x70, 0xf, 0xfe, 0x32, 0x0,
+    0x4, 0x3, 0xff, 0x8c, 0x20, 0x10, 0x80, 0x7f,
+    0xf1, 0x44, 0x2, 0x10, 0xf, 0xfe, 0x2a, 0x0,
+    0x4, 0x3, 0xff, 0x8a, 0xa4, 0x0, 0x70, 0xf,
+    0xfe, 0x22, 0x50, 0x5, 0x40, 0x1f, 0xfc, 0x12,
+    0x5b, 0xb0, 0x4, 0xe6, 0x1, 0xd3, 0xff, 0xf6,
+    0xd2, 0x0, 0x4d, 0x0, 0x1f, 0xfc, 0x61, 0xa9,
+    0x0, 0xff, 0xe2, 0x13, 0x5f, 0x28, 0x7, 0xe9,
+    0xee, 0xf7, 0xfb, 0x65, 0x0, 0x3f, 0xe1, 0x1f,
+    0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0x0,
 
     /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xca, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xfc, 0x74, 0x32, 0x46, 0xbf, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xd3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf7, 0x0, 0x9, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xd0, 0x0, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0x20, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x4f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf7, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x70, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf5, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x20,
-    0xa, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xe0, 0x0, 0x4f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x10, 0x0, 0x3, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef, 0xff,
-    0x60, 0x0, 0x0, 0x7, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfa, 0x52, 0x11,
-    0x24, 0x9e, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xff, 0xfe, 0x72, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x6,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfb, 0x30, 0x0, 0x3a, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xed, 0xef, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x8c, 0xff,
-    0xeb, 0x60, 0x0,
+    0x0, 0xfe, 0x49, 0xce, 0xff, 0x76, 0x52, 0x88,
+    0x7, 0xff, 0x11, 0xfa, 0xd8, 0xc4, 0x0, 0x26,
+    0xb5, 0xd2, 0x20, 0x1f, 0xf8, 0xf6, 0x4, 0x3,
+    0xfe, 0x6e, 0x60, 0xf, 0xf2, 0xe1, 0x0, 0x47,
+    0x17, 0x9b, 0x72, 0x80, 0x1a, 0x64, 0x1, 0xf9,
+    0x28, 0x2, 0x2c, 0xc3, 0xa1, 0x92, 0x35, 0xf2,
+    0x80, 0x4d, 0x20, 0x1e, 0x1b, 0x0, 0x9b, 0x4c,
+    0x3, 0xf0, 0xd4, 0x80, 0x4c, 0xa0, 0x1d, 0x40,
+    0x13, 0x48, 0x7, 0xfe, 0x6a, 0x0, 0xac, 0x3,
+    0x1a, 0x0, 0xe, 0x40, 0x3f, 0xf8, 0x4a, 0xc0,
+    0x1, 0x70, 0xa, 0x80, 0x2f, 0x0, 0xff, 0xe2,
+    0x40, 0x5, 0x40, 0x13, 0x80, 0x8, 0xc0, 0x3f,
+    0xf8, 0x82, 0xc0, 0x2, 0x20, 0x8, 0x80, 0xa,
+    0x1, 0xff, 0xc6, 0xc0, 0x9, 0xc0, 0x80, 0x2e,
+    0x0, 0xff, 0xe3, 0x38, 0x4, 0x40, 0xe0, 0x11,
+    0x80, 0x7f, 0xf1, 0x8c, 0x3, 0x9c, 0x2, 0x30,
+    0xf, 0xfe, 0x31, 0x80, 0x71, 0x0, 0x5c, 0x1,
+    0xff, 0xc6, 0x60, 0x8, 0x80, 0x44, 0x0, 0x40,
+    0xf, 0xfe, 0x36, 0x0, 0x4e, 0x0, 0x40, 0x1,
+    0x90, 0x7, 0xff, 0x15, 0x80, 0x2, 0x40, 0xe,
+    0x0, 0xa4, 0x3, 0xff, 0x89, 0x2, 0x0, 0x60,
+    0x9, 0x8, 0x0, 0x90, 0x1, 0xff, 0xc2, 0x47,
+    0x0, 0xa4, 0x3, 0x70, 0x4, 0xee, 0x0, 0xff,
+    0xc9, 0x40, 0x14, 0x88, 0x6, 0x38, 0x0, 0xa2,
+    0xc4, 0x3, 0xfa, 0x2c, 0x40, 0xa, 0xc0, 0x1e,
+    0x77, 0x0, 0x49, 0xd4, 0xa4, 0x22, 0x24, 0x9e,
+    0x70, 0x9, 0x28, 0x3, 0xf4, 0x48, 0x6, 0x5a,
+    0xde, 0xe6, 0xdb, 0x8, 0x4, 0xf6, 0x1, 0xfe,
+    0x6d, 0x50, 0xf, 0xfc, 0x99, 0x0, 0x1f, 0xf8,
+    0xab, 0x61, 0x4, 0x3, 0x86, 0x36, 0xcc, 0x3,
+    0xff, 0x86, 0x4f, 0x7d, 0xf6, 0x1, 0x8, 0x10,
+    0x7, 0x99, 0x80, 0x1f, 0xfc, 0x24, 0xb0, 0xa,
+    0x2c, 0xc0, 0x23, 0xa9, 0x92, 0x0, 0x7f, 0xf0,
+    0x93, 0x48, 0x0, 0x99, 0xdb, 0xd8, 0xa0, 0x1,
+    0x0, 0xff, 0xe1, 0x96, 0xb0, 0x4, 0x24, 0x20,
+    0x2, 0xb5, 0x0, 0xff, 0xe2, 0xce, 0xb9, 0x80,
+    0x5, 0x27, 0x50, 0x0,
 
     /* U+0052 "R" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x83,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x12, 0x47,
-    0xdf, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xe0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xe0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0x90, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x25, 0xbf, 0xff,
-    0xf8, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x70, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf2, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf2, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfd, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x80,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf3,
+    0x3f, 0xff, 0xfb, 0xae, 0xc, 0x3, 0xff, 0x8c,
+    0x28, 0xf9, 0xa6, 0x1, 0xff, 0xc8, 0x2c, 0x80,
+    0xf, 0xa7, 0xbb, 0xdb, 0x70, 0x40, 0x13, 0xb8,
+    0x3, 0xe1, 0x1f, 0x12, 0x3e, 0xc8, 0x5, 0x4,
+    0x1, 0xff, 0xc4, 0x69, 0x0, 0xac, 0x3, 0xff,
+    0x8a, 0xc4, 0x0, 0x70, 0xf, 0xfe, 0x32, 0x0,
+    0x4, 0x3, 0xff, 0x8c, 0x20, 0x10, 0x80, 0x7f,
+    0xf1, 0x44, 0x2, 0x10, 0xf, 0xfe, 0x2a, 0x0,
+    0x4, 0x3, 0xff, 0x8a, 0xa4, 0x0, 0x70, 0xf,
+    0xfe, 0x22, 0x50, 0x5, 0x60, 0x1f, 0xfc, 0x12,
+    0x5b, 0xb0, 0x4, 0xe4, 0x1, 0xd3, 0xff, 0xf6,
+    0xd2, 0x0, 0x4d, 0x0, 0x1f, 0xfc, 0x62, 0xa9,
+    0x0, 0xff, 0xe3, 0x16, 0xa8, 0x7, 0xe9, 0xff,
+    0xfa, 0x40, 0x4, 0xe0, 0x1f, 0xfc, 0x56, 0x30,
+    0x4, 0x10, 0x7, 0xff, 0x17, 0x80, 0x2e, 0x0,
+    0xff, 0xe2, 0x94, 0x80, 0xd, 0xc0, 0x3f, 0xf8,
+    0xac, 0x80, 0x8, 0x20, 0xf, 0xfe, 0x2d, 0x0,
+    0x5e, 0x1, 0xff, 0xc5, 0x19, 0x0, 0x14, 0x0,
+    0x7f, 0xf1, 0x59, 0x0, 0xe, 0x60,
 
     /* U+0053 "S" */
-    0x0, 0x0, 0x1, 0x7b, 0xdf, 0xff, 0xeb, 0x84,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xdf,
-    0xff, 0xd7, 0x31, 0x1, 0x25, 0x9e, 0xff, 0x40,
-    0x6, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6b, 0x0, 0xb, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe,
-    0x95, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xfd, 0x95, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x26, 0xbf, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x36, 0xbf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x8f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfd, 0x5, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0xd, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf5, 0x5f, 0xff, 0xfd, 0x84, 0x21, 0x1,
-    0x37, 0xdf, 0xff, 0xc0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x3b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x15, 0x9c, 0xef, 0xff, 0xda, 0x61,
-    0x0, 0x0,
+    0x0, 0xe1, 0x7b, 0xdf, 0xfb, 0xae, 0x10, 0x3,
+    0xe1, 0x9e, 0x84, 0x20, 0x8, 0x51, 0xef, 0xa0,
+    0x3, 0x16, 0x30, 0x7, 0xfc, 0x2f, 0x40, 0x17,
+    0x90, 0x0, 0xa3, 0x3b, 0xfb, 0x69, 0x84, 0x1,
+    0xc0, 0x6, 0x20, 0x2, 0xeb, 0x98, 0x80, 0x92,
+    0xcf, 0x4a, 0x20, 0x1, 0xa0, 0x1, 0xa0, 0xf,
+    0xf3, 0x58, 0x4, 0xc0, 0x4, 0x0, 0xff, 0xe3,
+    0x88, 0x7, 0xff, 0x11, 0x80, 0x8, 0x40, 0x1f,
+    0xfc, 0x3d, 0x0, 0xb1, 0x40, 0x3f, 0xf8, 0x4c,
+    0x60, 0x1, 0xae, 0x95, 0x10, 0xf, 0xfb, 0x14,
+    0x2, 0x16, 0xae, 0xd9, 0x50, 0xf, 0xea, 0xb3,
+    0x0, 0xe2, 0x6a, 0xfa, 0x20, 0xf, 0x93, 0x36,
+    0x50, 0x3, 0xcb, 0xb0, 0x1, 0xf8, 0x9a, 0xff,
+    0x25, 0x0, 0x33, 0xd0, 0x7, 0xfc, 0x6d, 0x7c,
+    0xe0, 0x12, 0xa8, 0x3, 0xff, 0x82, 0x31, 0x60,
+    0x17, 0x80, 0x7f, 0xf0, 0xd0, 0xc0, 0xe, 0x1,
+    0xff, 0xc4, 0x60, 0xc, 0xaa, 0x0, 0xff, 0xe0,
+    0xa0, 0x1, 0x82, 0x2a, 0xcc, 0x3, 0xfd, 0x42,
+    0x0, 0xe5, 0x20, 0x4c, 0xd8, 0x42, 0x10, 0x13,
+    0x7d, 0x50, 0x1, 0xaa, 0xc0, 0x11, 0x3d, 0xef,
+    0x7f, 0x64, 0x10, 0x0, 0xb4, 0x1, 0x58, 0x80,
+    0x1f, 0xf9, 0xb4, 0x40, 0x23, 0xbe, 0xa6, 0x31,
+    0x0, 0x89, 0x67, 0xa4, 0x2,
 
     /* U+0054 "T" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x11, 0x11, 0x11, 0x14, 0xff, 0xf6, 0x11, 0x11,
-    0x11, 0x11, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xff, 0xfe, 0x40, 0x7, 0xff, 0x7b, 0x3b,
+    0xbe, 0xb0, 0xa, 0x7b, 0xbf, 0x8, 0xfe, 0x70,
+    0x8, 0xc4, 0x7f, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xc2,
 
     /* U+0055 "U" */
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfd, 0x5f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc,
-    0x4f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0xc, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf3, 0x6, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x4, 0xef, 0xff, 0x50, 0x0,
-    0x3f, 0xff, 0xfe, 0x85, 0x32, 0x36, 0xcf, 0xff,
-    0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xed, 0x95,
-    0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x80, 0x3f, 0xf8, 0x33, 0xfe, 0xe0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xf1, 0x10, 0x8, 0x40, 0x3f,
+    0xf8, 0x26, 0x0, 0x33, 0x0, 0x4e, 0x1, 0xff,
+    0xc1, 0x10, 0x0, 0x88, 0x2, 0x20, 0xf, 0xfe,
+    0xa, 0x80, 0x1d, 0x0, 0x2c, 0x0, 0xff, 0xc4,
+    0x20, 0xc, 0x3, 0x0, 0x28, 0x80, 0x7f, 0xd4,
+    0x1, 0x20, 0x50, 0x5, 0x60, 0x1f, 0xe3, 0x70,
+    0x1, 0x18, 0x31, 0x0, 0x16, 0x80, 0x3f, 0x26,
+    0x80, 0x50, 0x1, 0x70, 0x4, 0xbd, 0xa, 0x64,
+    0x6d, 0x96, 0x20, 0x6, 0x50, 0x8, 0xec, 0x2,
+    0x17, 0xac, 0xdc, 0x93, 0x0, 0x96, 0x40, 0x39,
+    0x35, 0x0, 0x3f, 0xc3, 0x34, 0x1, 0xf1, 0x5e,
+    0xc2, 0x8, 0x0, 0x49, 0xab, 0x98, 0x3,
 
     /* U+0056 "V" */
-    0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x5f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf0, 0x0, 0xef, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x7, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0x1f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf3,
-    0x0, 0x0, 0x2, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfc, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf4, 0x0, 0x0, 0x6f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xb0, 0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x20, 0x4,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf9, 0x0, 0xbf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xf1, 0x2f, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x79,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfe, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xc, 0xff, 0x84, 0x3, 0xff, 0x88, 0x5f, 0xf3,
+    0x84, 0x80, 0x52, 0x1, 0xff, 0xc4, 0xb0, 0x9,
+    0xc1, 0x44, 0x0, 0xc0, 0x1f, 0xfc, 0x31, 0x60,
+    0x3, 0x0, 0x52, 0x0, 0x16, 0x0, 0xff, 0xe1,
+    0x30, 0x5, 0x60, 0x13, 0x0, 0x56, 0x1, 0xff,
+    0xc2, 0x90, 0x2, 0x90, 0x4, 0x2c, 0x0, 0x24,
+    0x0, 0xff, 0xcc, 0x20, 0x9, 0x0, 0xeb, 0x0,
+    0xbc, 0x3, 0xff, 0x58, 0x0, 0xcc, 0x1, 0xc4,
+    0x80, 0x4, 0x20, 0xf, 0xf2, 0x10, 0x2, 0x40,
+    0x3e, 0xf0, 0xa, 0xc0, 0x3f, 0xde, 0x0, 0x15,
+    0x0, 0xf9, 0x8, 0x0, 0xc2, 0x1, 0xf8, 0x90,
+    0x1, 0x20, 0x1f, 0xd6, 0x1, 0x30, 0x7, 0xeb,
+    0x0, 0x98, 0x3, 0xf9, 0x84, 0x1, 0x20, 0x1f,
+    0xb, 0x0, 0x18, 0x40, 0x3f, 0xd2, 0x0, 0x15,
+    0x0, 0xf4, 0x80, 0x56, 0x1, 0xff, 0x30, 0x5,
+    0x0, 0x1e, 0x60, 0x2, 0x10, 0x7, 0xfc, 0x2c,
+    0x0, 0x24, 0x0, 0xcc, 0x20, 0xf, 0x0, 0xff,
+    0xe0, 0xd8, 0x5, 0xe0, 0x1a, 0xc0, 0x6, 0x80,
+    0x1f, 0xfc, 0x12, 0x40, 0x2, 0x10, 0x1, 0x8,
+    0x1, 0x20, 0x1f, 0xfc, 0x3f, 0x0, 0xac, 0x1,
+    0xe0, 0x1, 0x50, 0xf, 0xfe, 0x1a, 0x10, 0x1,
+    0x84, 0x90, 0x1, 0x20, 0x1f, 0xfc, 0x5b, 0x0,
+    0x9a, 0xc0, 0x26, 0x0, 0xff, 0xe2, 0xb0, 0x80,
+    0x25, 0x80, 0xc, 0x20, 0x1f, 0xfc, 0x66, 0x0,
+    0x8, 0x5, 0x60, 0x1f, 0xfc, 0x79, 0x0, 0xe4,
+    0x20, 0xf, 0xfe, 0x38, 0xb0, 0x6, 0xf0, 0xf,
+    0xfe, 0x4d, 0x80, 0x44, 0x80, 0x1f, 0xe0,
 
     /* U+0057 "W" */
-    0xaf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x35, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0xf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xf8, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x5, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xd0, 0x0, 0xf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0xaf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc3, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x30,
-    0x0, 0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf7, 0xd, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xd0, 0x0, 0x0, 0xf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x10, 0x8f, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xc0, 0x2, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x20, 0x0, 0x0, 0x4, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xef, 0xf6, 0x0, 0xd, 0xff, 0xa0,
-    0x0, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xb0, 0x0, 0x0, 0x4f, 0xff, 0x10,
-    0x0, 0x7f, 0xff, 0x0, 0x0, 0x0, 0xef, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0,
-    0x9, 0xff, 0xb0, 0x0, 0x2, 0xff, 0xf5, 0x0,
-    0x0, 0x4f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf5, 0x0, 0x0, 0xef, 0xf6, 0x0, 0x0,
-    0xc, 0xff, 0xa0, 0x0, 0xa, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x5f,
-    0xff, 0x10, 0x0, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x10, 0xa, 0xff, 0xb0, 0x0, 0x0, 0x1,
-    0xff, 0xf5, 0x0, 0x4f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x0, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0xa, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xb0, 0x5f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x0, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0x1b, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf5, 0x5f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf7,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xba, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf8, 0x3, 0xff, 0x82, 0xdf, 0xf1, 0x80,
+    0x7f, 0xe3, 0xff, 0x8f, 0xc0, 0x25, 0x0, 0xff,
+    0xd4, 0x1, 0x50, 0x7, 0xfe, 0xb0, 0x0, 0x9a,
+    0x80, 0x5c, 0x1, 0xff, 0x11, 0x80, 0x4e, 0x1,
+    0xff, 0x98, 0x0, 0xc0, 0x5, 0x0, 0x20, 0x7,
+    0xfc, 0xa0, 0x18, 0x50, 0x3, 0xfc, 0x62, 0x0,
+    0xb0, 0x7, 0x80, 0x4a, 0x1, 0xfe, 0xa0, 0xe,
+    0xd0, 0xf, 0xf5, 0x0, 0x8, 0xc0, 0xa, 0x1,
+    0x70, 0x7, 0xf1, 0x10, 0x0, 0xa0, 0x7, 0x0,
+    0xff, 0x38, 0x1, 0x40, 0x32, 0x80, 0x10, 0x3,
+    0xfa, 0x80, 0x7, 0x20, 0x1, 0x40, 0xf, 0xc6,
+    0x20, 0xb, 0x0, 0xde, 0x1, 0x28, 0x7, 0xe5,
+    0x0, 0x59, 0x90, 0x3, 0x40, 0x3f, 0x50, 0x0,
+    0x8c, 0x3, 0x28, 0x5, 0xc0, 0x1f, 0x19, 0x0,
+    0x18, 0x14, 0x0, 0xe0, 0x1f, 0x9c, 0x0, 0xa0,
+    0x1e, 0x50, 0x2, 0x0, 0x7d, 0x40, 0x3, 0x10,
+    0xa0, 0x0, 0xa0, 0x7, 0x90, 0x40, 0x14, 0x1,
+    0xee, 0x0, 0x94, 0x3, 0xce, 0x0, 0xa0, 0x1,
+    0x10, 0x1, 0xc0, 0x1e, 0xd0, 0x1, 0x10, 0x3,
+    0xc8, 0x1, 0x70, 0x7, 0x20, 0x80, 0x1c, 0x2,
+    0xa0, 0x2, 0x80, 0x79, 0xc0, 0xa, 0x1, 0xf9,
+    0x40, 0x8, 0x1, 0xda, 0x0, 0x41, 0x0, 0x94,
+    0x2, 0x50, 0xc, 0x82, 0x0, 0xa0, 0xf, 0xdc,
+    0x1, 0x28, 0x6, 0x70, 0x6, 0x80, 0x62, 0x30,
+    0x7, 0x80, 0x6e, 0x0, 0x11, 0x0, 0x3f, 0x20,
+    0x80, 0x38, 0x2, 0x51, 0x0, 0x38, 0x7, 0x58,
+    0x1, 0x40, 0x32, 0x80, 0x28, 0x3, 0xfc, 0x80,
+    0x4, 0x10, 0x7, 0x80, 0x10, 0x40, 0x39, 0x80,
+    0x25, 0x0, 0x20, 0x4, 0xa0, 0x1f, 0xee, 0x0,
+    0x9c, 0x0, 0xa0, 0xe, 0x0, 0xf0, 0xa0, 0x3,
+    0xc0, 0x1c, 0x0, 0x22, 0x0, 0x7f, 0x90, 0x40,
+    0x1a, 0xa, 0x1, 0x28, 0x7, 0xda, 0x0, 0x50,
+    0x2, 0x80, 0x28, 0x3, 0xff, 0x38, 0x1, 0x7,
+    0x80, 0xa, 0x1, 0xf9, 0xc0, 0x25, 0x50, 0x4,
+    0xa0, 0x1f, 0xfb, 0x40, 0x26, 0x40, 0x7, 0x80,
+    0x7e, 0x14, 0x0, 0x77, 0x80, 0xc, 0x80, 0x3f,
+    0xf2, 0x8, 0x2, 0x0, 0x25, 0x0, 0xfe, 0xe0,
+    0x2, 0x28, 0x2, 0xc0, 0x3f, 0xf8, 0x4e, 0x1,
+    0xca, 0x1, 0xfe, 0x50, 0xf, 0x28, 0x7, 0xff,
+    0xb, 0x40, 0x3b, 0x80, 0x3f, 0xe5, 0x0, 0xc6,
+    0x40, 0x1f, 0xfc, 0x24, 0x10, 0x8, 0x50, 0x3,
+    0xfe, 0xf0, 0xd, 0x60, 0x1f, 0xfc, 0x47, 0x0,
+    0x9c, 0x3, 0xff, 0x28, 0x6, 0x60, 0xf, 0xc0,
 
     /* U+0058 "X" */
-    0x9, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xb0, 0x0, 0xdf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe, 0x10,
-    0x0, 0x2f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf4, 0x0, 0x0, 0x6, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xf3, 0x0, 0x0, 0xc, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x8f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xa0, 0x4, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf6, 0x1e, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xcf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf7, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xb0, 0x9, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xfe, 0x10, 0x0, 0xdf, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xf4, 0x0, 0x0, 0x2f,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x90, 0x0, 0x0, 0x6, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0x70, 0x0, 0x0, 0x1e, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf3, 0x0,
-    0x0, 0xaf, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xfd, 0x0, 0x6, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xa0,
-    0x3f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf6,
+    0x9, 0xff, 0xa0, 0x3, 0xff, 0x1f, 0xfd, 0x60,
+    0x9, 0x20, 0x3, 0xa0, 0x7, 0xfd, 0xc0, 0x1,
+    0xa0, 0xb, 0xc0, 0x2a, 0x10, 0xf, 0xea, 0x20,
+    0x5, 0x8, 0x4, 0x52, 0x0, 0x1a, 0x0, 0xfc,
+    0xaa, 0x0, 0x3a, 0x0, 0x73, 0x28, 0x1, 0x1c,
+    0x3, 0xc5, 0x40, 0x3, 0x80, 0xf, 0xac, 0x40,
+    0x10, 0x60, 0x1d, 0xc0, 0x1, 0xd0, 0xf, 0xc3,
+    0xa0, 0x17, 0x0, 0x68, 0x30, 0x5, 0x88, 0x7,
+    0xf1, 0xc0, 0x0, 0xa8, 0x0, 0x8e, 0x0, 0x65,
+    0x0, 0xff, 0x9d, 0x0, 0xa, 0xc3, 0x40, 0x2,
+    0x90, 0xf, 0xfe, 0xd, 0x8, 0x2, 0x74, 0x40,
+    0x1e, 0x1, 0xff, 0xc2, 0x1a, 0x0, 0x8c, 0x1,
+    0x24, 0x1, 0xff, 0xc3, 0x47, 0x0, 0xca, 0xc0,
+    0x1f, 0xfc, 0x5d, 0x0, 0xc4, 0x1, 0xff, 0xc5,
+    0x1b, 0x0, 0xce, 0x80, 0x1f, 0xfc, 0x4d, 0x10,
+    0xe, 0xa1, 0x0, 0xff, 0xe1, 0x41, 0x80, 0x22,
+    0x80, 0x3, 0x40, 0x1f, 0xfc, 0x14, 0x70, 0x2,
+    0x3a, 0xb0, 0x1, 0x1c, 0x3, 0xfe, 0x1a, 0x0,
+    0xd, 0x0, 0x24, 0x80, 0x10, 0x60, 0x1f, 0xea,
+    0x10, 0x5, 0x8, 0x5, 0xe0, 0x16, 0x88, 0x7,
+    0xe7, 0x40, 0x3, 0x20, 0x6, 0x29, 0x0, 0xd,
+    0x0, 0x7c, 0x70, 0x0, 0x29, 0x0, 0xf3, 0x28,
+    0x1, 0x1c, 0x3, 0x87, 0x40, 0x2f, 0x0, 0xfd,
+    0x62, 0x0, 0x83, 0x0, 0xd6, 0x20, 0x9, 0x20,
+    0xf, 0xc3, 0xa0, 0x17, 0x0, 0x4c, 0xa0, 0x4,
+    0x60, 0xf, 0xf1, 0xc0, 0x0, 0xa8, 0xe, 0x40,
+    0x3, 0x40, 0x1f, 0xf9, 0xd0, 0x0, 0xac,
 
     /* U+0059 "Y" */
-    0xd, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x20, 0x3f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x80, 0x0, 0x9f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xd0, 0x0, 0x1, 0xef,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf4, 0x0, 0x0, 0x6, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x40, 0x0, 0x0, 0xb,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xfd, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x1,
-    0xef, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x9f, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0x5c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xd, 0xff, 0x70, 0x80, 0x7f, 0xf0, 0x9b, 0xfe,
+    0x20, 0xe0, 0x0, 0xc0, 0x7, 0xff, 0x4, 0x64,
+    0x0, 0xe4, 0x6, 0xc0, 0x6, 0x30, 0xf, 0xfd,
+    0x60, 0x2, 0x80, 0xa, 0x4, 0x1, 0xc0, 0x1f,
+    0xf2, 0x28, 0x2, 0x40, 0x30, 0xc0, 0x0, 0x9c,
+    0x3, 0xfd, 0x20, 0x5, 0x40, 0xe, 0x63, 0x0,
+    0x40, 0x80, 0x7e, 0x82, 0x0, 0x58, 0x7, 0xdc,
+    0x1, 0x58, 0x7, 0xc4, 0xe0, 0x8, 0x10, 0xf,
+    0x89, 0xc0, 0xa, 0x80, 0x1e, 0x90, 0x1, 0x38,
+    0x7, 0xf4, 0x8, 0x2, 0x40, 0x39, 0x50, 0x1,
+    0xc0, 0x1f, 0xf5, 0x0, 0xa, 0x0, 0x21, 0xb0,
+    0x3, 0x18, 0x7, 0xfc, 0x88, 0x0, 0x39, 0x0,
+    0x20, 0x40, 0x60, 0x3, 0xff, 0x83, 0x40, 0x14,
+    0x81, 0xb0, 0x2, 0x4, 0x3, 0xff, 0x82, 0x30,
+    0x0, 0x45, 0xf0, 0x1, 0xb0, 0x7, 0xff, 0xd,
+    0xc8, 0x1, 0x46, 0x0, 0xe0, 0xf, 0xfe, 0x2f,
+    0x0, 0x73, 0x90, 0x7, 0xff, 0x14, 0xd8, 0x2,
+    0x18, 0x0, 0xff, 0xe3, 0xd8, 0x5, 0x20, 0x1f,
+    0xfc, 0xc1, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xfa, 0xe0,
 
     /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x12, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfc, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9,
+    0x3f, 0xff, 0xfe, 0x41, 0x0, 0x7f, 0xf7, 0x84,
+    0xcd, 0xdd, 0xff, 0xc2, 0xd1, 0x0, 0xa8, 0x40,
+    0x47, 0xff, 0x85, 0x22, 0x0, 0x84, 0x0, 0xff,
+    0xe1, 0xca, 0x0, 0x15, 0xc0, 0x3f, 0xf8, 0x6c,
+    0xc0, 0x1, 0xd0, 0x7, 0xff, 0xc, 0xe4, 0x0,
+    0x3a, 0x1, 0xff, 0xc3, 0x1d, 0x0, 0xb4, 0x40,
+    0x3f, 0xf8, 0x7a, 0x20, 0x9, 0x30, 0xf, 0xfe,
+    0x1d, 0x18, 0x1, 0x98, 0x1, 0xff, 0xc3, 0x75,
+    0x0, 0x1c, 0x80, 0x7f, 0xf0, 0xd2, 0x0, 0x3,
+    0xa0, 0x1f, 0xfc, 0x32, 0xa0, 0xb, 0x44, 0x3,
+    0xff, 0x87, 0xe2, 0x0, 0xa3, 0x0, 0xff, 0xe1,
+    0xd9, 0x0, 0x1d, 0x40, 0x3f, 0xf8, 0x70, 0x80,
+    0x4, 0x80, 0xf, 0xfe, 0x1a, 0xb8, 0x0, 0xa8,
+    0x3, 0xff, 0x86, 0x54, 0x1, 0x78, 0x80, 0x7f,
+    0xf0, 0x87, 0xc0, 0x2a, 0x20, 0xf, 0xfe, 0x1d,
+    0x10, 0x1, 0xd4, 0x3, 0xff, 0x87, 0x28, 0x0,
+    0x39, 0x11, 0xff, 0xe1, 0x2, 0xb0, 0x4, 0x7d,
+    0xdf, 0xfc, 0x39, 0x20, 0xf, 0xfe, 0xf8,
 
     /* U+005B "[" */
-    0x3f, 0xff, 0xff, 0xff, 0x43, 0xff, 0xff, 0xff,
-    0xf4, 0x3f, 0xff, 0xdd, 0xdd, 0x33, 0xff, 0xf3,
-    0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff,
-    0x30, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f,
-    0xff, 0x30, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0,
-    0x3f, 0xff, 0x30, 0x0, 0x3, 0xff, 0xf3, 0x0,
-    0x0, 0x3f, 0xff, 0x30, 0x0, 0x3, 0xff, 0xf3,
-    0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0x30,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff,
-    0x30, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x3f,
-    0xff, 0xdd, 0xdd, 0x33, 0xff, 0xff, 0xff, 0xf4,
-    0x3f, 0xff, 0xff, 0xff, 0x40,
+    0x3f, 0xff, 0x90, 0x3, 0xff, 0x82, 0x45, 0x9c,
+    0x3, 0x76, 0xec, 0x60, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0x83,
+    0xdb, 0xb1, 0x80, 0x62, 0x2c, 0xe0, 0x1f, 0xc0,
 
     /* U+005C "\\" */
-    0x28, 0x86, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x28, 0x83, 0x0, 0x7f, 0xe2, 0x77, 0x48, 0x80,
+    0x7f, 0xe5, 0x0, 0x30, 0x7, 0xfe, 0xe0, 0x5,
+    0x0, 0x7f, 0xe4, 0x10, 0x22, 0x0, 0x7f, 0xe7,
+    0x0, 0x50, 0x7, 0xfe, 0xa0, 0x3, 0x0, 0x7f,
+    0xe3, 0x10, 0x13, 0x0, 0xff, 0xcc, 0x0, 0xa0,
+    0xf, 0xfd, 0x40, 0x7, 0x0, 0xff, 0xc4, 0x40,
+    0x14, 0x0, 0xff, 0xd4, 0x0, 0xe0, 0xf, 0xfc,
+    0xc0, 0x5, 0x0, 0xff, 0xc2, 0x60, 0x5, 0x0,
+    0xff, 0xd4, 0x0, 0xe0, 0xf, 0xfc, 0xe0, 0x4,
+    0x10, 0xf, 0xf8, 0x50, 0x0, 0xe0, 0x1f, 0xfb,
+    0x80, 0x14, 0x1, 0xff, 0x94, 0x0, 0x64, 0x1,
+    0xff, 0x94, 0x0, 0xa0, 0x1f, 0xfb, 0x80, 0x14,
+    0x1, 0xff, 0x90, 0x40, 0x8c, 0x3, 0xff, 0x38,
+    0x2, 0x80, 0x3f, 0xf5, 0x0, 0x1c, 0x3, 0xff,
+    0x19, 0x0, 0xa0, 0x7, 0xfe, 0x50, 0x7, 0x0,
+    0x7f, 0xea, 0x0, 0x28, 0x7, 0xfe, 0x23, 0x0,
+    0x28, 0x7, 0xfe, 0xb0, 0x7, 0x0, 0x7f, 0xe6,
+    0x0, 0x20, 0x80, 0x7f, 0xc2, 0x80, 0x7, 0x0,
+    0xff, 0xdc, 0x0, 0xa0, 0xf, 0xfc, 0xa0, 0x3,
+    0x10, 0xf, 0xfc, 0xa0, 0x6,
 
     /* U+005D "]" */
-    0x5f, 0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff,
-    0xf3, 0x4d, 0xdd, 0xdf, 0xff, 0x30, 0x0, 0x4,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0x30, 0x0,
-    0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0x30,
-    0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0x30, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f,
-    0xff, 0x30, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0x30, 0x0, 0x4, 0xff, 0xf3, 0x0,
-    0x0, 0x4f, 0xff, 0x30, 0x0, 0x4, 0xff, 0xf3,
-    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x4, 0xff,
-    0xf3, 0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x4,
-    0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0x30, 0x0,
-    0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff, 0x30,
-    0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f, 0xff,
-    0x30, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x4f,
-    0xff, 0x30, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0,
-    0x4f, 0xff, 0x30, 0x0, 0x4, 0xff, 0xf3, 0x4d,
-    0xdd, 0xdf, 0xff, 0x35, 0xff, 0xff, 0xff, 0xf3,
-    0x5f, 0xff, 0xff, 0xff, 0x30,
+    0x5f, 0xff, 0x8c, 0x3, 0xf8, 0x48, 0xb0, 0x6,
+    0x4d, 0xda, 0x40, 0x3f, 0xff, 0xe0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x5, 0x37,
+    0x69, 0x0, 0xc2, 0x45, 0x80, 0x3f, 0xf8, 0x20,
 
     /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xc, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x60, 0x6f,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0, 0x0,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0,
-    0x9, 0xff, 0x20, 0x0, 0x0, 0x8, 0xff, 0x20,
-    0x0, 0x2f, 0xf8, 0x0, 0x0, 0x0, 0xef, 0xc0,
-    0x0, 0x0, 0xbf, 0xe0, 0x0, 0x0, 0x6f, 0xf5,
-    0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0xc, 0xfe,
-    0x0, 0x0, 0x0, 0xe, 0xfc, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0xaf,
-    0xf1, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x1f,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x10,
+    0x0, 0xf1, 0x7f, 0xc4, 0x1, 0xff, 0xa8, 0x2,
+    0xb0, 0xf, 0xfc, 0xe0, 0x13, 0x0, 0x7f, 0xcc,
+    0x0, 0x80, 0x3, 0x0, 0x7f, 0xac, 0x9, 0xcc,
+    0x2c, 0x3, 0xf9, 0x8, 0x2c, 0x28, 0x9, 0x0,
+    0x3f, 0x70, 0x1, 0x81, 0x80, 0x1e, 0x1, 0xf0,
+    0xa8, 0x30, 0x4, 0xc0, 0x84, 0x1, 0xe9, 0x0,
+    0x58, 0x5, 0x60, 0xa, 0x0, 0xf3, 0x1, 0x90,
+    0x4, 0x48, 0xc, 0x1, 0xcc, 0x21, 0x20, 0x1d,
+    0xc0, 0x2c, 0x1, 0xa8, 0x5, 0x40, 0x39, 0x44,
+    0x28, 0x2, 0x33, 0x3, 0x0, 0x7c, 0xc0, 0x66,
+    0x0, 0x48, 0x2, 0x40, 0x3e, 0x90, 0x4, 0x80,
+    0xa8, 0x28, 0x80, 0x7c, 0x28, 0xa, 0x20,
 
     /* U+005F "_" */
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff,
+    0x33, 0xff, 0xe3, 0x66, 0x7f, 0xf1, 0x80, 0x3f,
+    0xf8, 0xc0,
 
     /* U+0060 "`" */
-    0x38, 0x88, 0x60, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xb0, 0x0, 0x0,
-    0x1, 0xaf, 0xfc, 0x10, 0x0, 0x0, 0x6, 0xff,
-    0xd1,
+    0x38, 0x89, 0x80, 0x38, 0xfd, 0xdd, 0x34, 0x1,
+    0xcf, 0x82, 0xb, 0x60, 0x1c, 0x7e, 0xa0, 0x98,
+    0x20, 0x18, 0x6a, 0x40, 0xf0, 0x40,
 
     /* U+0061 "a" */
-    0x0, 0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0,
-    0x26, 0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77,
-    0x77, 0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc,
-    0xff, 0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6,
-    0x3, 0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff,
-    0xf6, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0xef, 0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6,
-    0x0, 0xef, 0xf6,
+    0x0, 0xc7, 0x17, 0xdf, 0xee, 0xc8, 0x20, 0xf,
+    0x2e, 0xe3, 0xa0, 0x80, 0x4, 0xdf, 0x68, 0x3,
+    0x35, 0x10, 0x7, 0xf9, 0x70, 0x2, 0x70, 0x0,
+    0xbe, 0x7f, 0xdb, 0x22, 0x0, 0x37, 0x0, 0xc,
+    0xc7, 0x41, 0x80, 0x44, 0xde, 0x20, 0x9, 0x0,
+    0x99, 0xc0, 0x3f, 0xc, 0x0, 0x4, 0x80, 0x3f,
+    0xf8, 0x28, 0x1, 0x30, 0x7, 0xff, 0x4, 0xc0,
+    0x21, 0x0, 0x85, 0xef, 0xbf, 0xfd, 0xc0, 0x11,
+    0x80, 0x17, 0xa1, 0x4, 0x3, 0xff, 0x25, 0x0,
+    0x48, 0xf1, 0x1e, 0x0, 0xe9, 0x0, 0xe, 0xdc,
+    0x3b, 0xf3, 0x0, 0x61, 0x20, 0x4, 0x10, 0x7,
+    0xfe, 0x30, 0x9, 0x40, 0x3f, 0x28, 0x6, 0x30,
+    0x9, 0x40, 0x3f, 0x48, 0x6, 0x13, 0x0, 0x41,
+    0x80, 0x71, 0x69, 0x0, 0x77, 0x80, 0x7, 0x2e,
+    0x1e, 0x33, 0x48, 0x40, 0x38, 0xec, 0x40, 0x8,
+    0xf0, 0xe6, 0x5, 0xa2, 0x1, 0xc9, 0xf2, 0x82,
+    0x0, 0x25, 0x9d, 0x30, 0xc,
 
     /* U+0062 "b" */
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x2, 0x8c, 0xef, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0xb, 0xff,
-    0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0xbf, 0xff, 0xff, 0xe8, 0x30, 0x2, 0x7d,
-    0xff, 0xfe, 0x10, 0xb, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0xbf, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4,
-    0xb, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0xbf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0xb, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf0, 0xbf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xb,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0xbf, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0xb, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0xbf,
-    0xff, 0xff, 0xe8, 0x30, 0x2, 0x7d, 0xff, 0xfe,
-    0x10, 0xb, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0xbf, 0xf9, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0xb, 0xff,
-    0x90, 0x2, 0x8c, 0xef, 0xec, 0x83, 0x0, 0x0,
-    0x0,
+    0xbf, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xc5, 0x19, 0xdf, 0xd9, 0x6, 0x1, 0xff, 0x4e,
+    0xb9, 0x88, 0x9, 0xbe, 0x50, 0x80, 0x7c, 0xf6,
+    0xc0, 0x1f, 0xcb, 0xe6, 0x1, 0xe3, 0x40, 0x17,
+    0xcf, 0xf6, 0xc1, 0x0, 0x7, 0x44, 0x3, 0xe3,
+    0xf8, 0x30, 0x1, 0x3e, 0xa8, 0x0, 0x68, 0x3,
+    0xc3, 0xa2, 0x1, 0xf5, 0x20, 0x1, 0x10, 0x1,
+    0xd6, 0x20, 0x1f, 0xd2, 0x1, 0x68, 0x7, 0x28,
+    0x7, 0xf8, 0x90, 0x0, 0x80, 0x18, 0x80, 0x3f,
+    0xf1, 0x0, 0x8, 0x3, 0x30, 0x7, 0xfe, 0xe0,
+    0xf, 0x98, 0x3, 0xff, 0x70, 0x7, 0xc4, 0x1,
+    0xff, 0x94, 0x0, 0x40, 0x1c, 0xc0, 0x1f, 0xe2,
+    0x30, 0x2, 0x0, 0x74, 0x8, 0x7, 0xf4, 0x80,
+    0x5a, 0x1, 0xc3, 0xa2, 0x1, 0xf5, 0x20, 0x1,
+    0x10, 0x1, 0xe3, 0xf8, 0x30, 0x1, 0x3e, 0xa8,
+    0x0, 0x68, 0x3, 0x99, 0x0, 0x5f, 0x3f, 0xdb,
+    0x4, 0x0, 0x1d, 0x10, 0xf, 0x5b, 0x0, 0x7f,
+    0x27, 0x98, 0x7, 0xe9, 0xd7, 0x31, 0x1, 0x37,
+    0xcb, 0x10, 0xc,
 
     /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x5, 0xff, 0xff,
-    0xa4, 0x10, 0x14, 0xbf, 0xff, 0xe1, 0x2, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x52,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x52, 0x0, 0x2, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0, 0x4,
-    0xff, 0xff, 0xa4, 0x10, 0x14, 0xaf, 0xff, 0xe1,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x49, 0xdf,
-    0xff, 0xd9, 0x40, 0x0, 0x0,
+    0x0, 0xf2, 0x4e, 0x77, 0xfb, 0x65, 0x0, 0x3f,
+    0x16, 0x5b, 0x18, 0x80, 0x9, 0xaf, 0x8, 0x3,
+    0x9b, 0x4c, 0x3, 0xf8, 0xf4, 0xc0, 0x25, 0x90,
+    0x9, 0x6f, 0xbf, 0xad, 0x0, 0x2d, 0x10, 0x2a,
+    0x0, 0xae, 0x90, 0x40, 0x52, 0xe8, 0x0, 0xc2,
+    0x10, 0x1, 0x5a, 0x0, 0x7c, 0xb5, 0xb0, 0x0,
+    0x50, 0x2, 0xa0, 0x7, 0xf2, 0x90, 0x1, 0x0,
+    0x2e, 0x0, 0xff, 0xe1, 0x10, 0x4, 0xa0, 0x1f,
+    0xfc, 0x21, 0x0, 0x84, 0x3, 0xff, 0x84, 0x20,
+    0x10, 0x80, 0x7f, 0xf0, 0x88, 0x2, 0x50, 0xf,
+    0xfe, 0x12, 0x0, 0x5c, 0x1, 0xff, 0xc3, 0x50,
+    0x2, 0xa0, 0x7, 0xf2, 0x90, 0x5, 0x0, 0x15,
+    0x20, 0x7, 0xcb, 0x5b, 0x20, 0x2, 0xb0, 0x0,
+    0xdd, 0x20, 0x80, 0xa5, 0x50, 0x0, 0xe2, 0x0,
+    0x49, 0x0, 0x96, 0xfb, 0xfa, 0xd4, 0x2, 0xd1,
+    0x0, 0x9b, 0x4c, 0x3, 0xf8, 0xf8, 0xc0, 0x38,
+    0xb2, 0xd8, 0x80, 0x22, 0x6b, 0xc1, 0x0,
 
     /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x5, 0xad, 0xff, 0xdb,
-    0x50, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x3f, 0xff, 0x40, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-    0xf4, 0x0, 0x7f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf4, 0xb, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x41, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xf4, 0x4f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x46, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x46, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x41,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf4, 0xb, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x40, 0x3f, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0xf4, 0x0,
-    0x7f, 0xff, 0xf7, 0x10, 0x0, 0x18, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x8f, 0xff, 0xff, 0xec, 0xef,
-    0xff, 0xf8, 0xff, 0xf4, 0x0, 0x0, 0x4e, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0xf, 0xff, 0x40, 0x0,
-    0x0, 0x6, 0xad, 0xff, 0xeb, 0x60, 0x0, 0xff,
-    0xf4,
+    0x0, 0xff, 0xe2, 0x1f, 0xfc, 0x80, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0x6a, 0xd6, 0xff, 0xb6, 0xd4,
+    0x3, 0xfe, 0x4e, 0xa5, 0x20, 0x1, 0x25, 0x6a,
+    0x0, 0x7e, 0x8b, 0x10, 0xf, 0xc5, 0x76, 0x0,
+    0xf3, 0xb8, 0x2, 0x5b, 0xef, 0xea, 0x40, 0x3,
+    0x80, 0x71, 0xc0, 0x5, 0x54, 0x41, 0x1, 0x5b,
+    0x90, 0xf, 0xa0, 0x2, 0xa5, 0x0, 0xf9, 0xa0,
+    0x3, 0x85, 0x0, 0x8, 0xa0, 0x1f, 0xce, 0x40,
+    0x19, 0x40, 0x2e, 0x0, 0xff, 0xa8, 0x3, 0x10,
+    0x4, 0x80, 0x1f, 0xf1, 0x80, 0x61, 0x0, 0x84,
+    0x3, 0xfe, 0x60, 0xc, 0x20, 0x10, 0x80, 0x7f,
+    0xc2, 0x1, 0x88, 0x2, 0x50, 0xf, 0xf9, 0x40,
+    0x32, 0x80, 0x5a, 0x1, 0xff, 0x50, 0x6, 0x14,
+    0x0, 0x31, 0x80, 0x7f, 0x21, 0x80, 0x74, 0x0,
+    0x5c, 0x40, 0x1f, 0x1d, 0x0, 0x78, 0xe0, 0x0,
+    0x5a, 0xe2, 0x1, 0xc, 0x60, 0x80, 0x7c, 0xee,
+    0x0, 0xa3, 0xb9, 0x9d, 0xc7, 0x0, 0x38, 0x7,
+    0xd1, 0x62, 0x1, 0x9, 0x88, 0x0, 0x6a, 0x0,
+    0x3f, 0x27, 0x4a, 0x90, 0x0, 0x52, 0x79, 0x40,
+    0x38,
 
     /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfe, 0xef, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f,
-    0xff, 0xd5, 0x10, 0x0, 0x4c, 0xff, 0xf8, 0x0,
-    0x2, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x40, 0xa, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xc0, 0x1f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf1, 0x4f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x6f, 0xff, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x73, 0x4f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x10, 0x0, 0x2, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x7, 0xe2, 0x0, 0x0, 0x6f,
-    0xff, 0xfb, 0x51, 0x0, 0x26, 0xdf, 0xfd, 0x10,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x49,
-    0xce, 0xff, 0xda, 0x60, 0x0, 0x0,
+    0x0, 0xf2, 0xd6, 0xff, 0xba, 0xd8, 0x40, 0x3f,
+    0x93, 0xa9, 0x48, 0x0, 0x29, 0x3c, 0xc0, 0x1f,
+    0x45, 0x88, 0x4, 0x22, 0x0, 0xd3, 0x40, 0x1c,
+    0xce, 0x0, 0x2a, 0xee, 0xbe, 0xcc, 0x0, 0xb0,
+    0x1, 0x14, 0x80, 0x13, 0x54, 0x40, 0x24, 0xc6,
+    0x0, 0x3a, 0x0, 0x20, 0x0, 0x56, 0x1, 0xfa,
+    0x50, 0x1, 0x0, 0x2a, 0x0, 0x80, 0xf, 0xf4,
+    0x0, 0xc, 0x54, 0x2, 0x40, 0xf, 0xf1, 0x88,
+    0x1, 0x8, 0x2, 0xef, 0xff, 0xf8, 0x40, 0x4,
+    0x20, 0x1f, 0xfc, 0x71, 0x0, 0xa2, 0x3f, 0xf8,
+    0x68, 0x40, 0x12, 0x3b, 0xff, 0xf0, 0x8d, 0x0,
+    0x2a, 0x0, 0xff, 0xe2, 0x28, 0x1, 0x8c, 0x3,
+    0xfc, 0x20, 0x1a, 0x0, 0x2c, 0x40, 0xf, 0xcf,
+    0xe4, 0x1, 0x14, 0x80, 0x57, 0x65, 0x10, 0x1,
+    0x36, 0xc0, 0xf8, 0x80, 0x4d, 0x0, 0x12, 0x57,
+    0x7f, 0xb6, 0x48, 0x0, 0xe2, 0x1, 0x9f, 0x8,
+    0x3, 0xf8, 0x62, 0x80, 0x3c, 0x7b, 0x6c, 0x62,
+    0x0, 0x25, 0x9e, 0x70, 0x8,
 
     /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x3a, 0xdf, 0xfd, 0x92, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x6f, 0xff, 0xfe, 0xdf, 0xf5, 0x0, 0x0, 0xef,
-    0xfe, 0x30, 0x0, 0x50, 0x0, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x5c,
-    0xcd, 0xff, 0xfd, 0xcc, 0xcc, 0x80, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xf1, 0xd6, 0xff, 0xb6, 0x48, 0x3, 0xa3,
+    0x14, 0x80, 0x4, 0xdc, 0x1, 0x99, 0xc0, 0x21,
+    0x20, 0x4, 0x80, 0x68, 0x0, 0xe, 0x76, 0xfd,
+    0x28, 0x4, 0x42, 0x0, 0xb3, 0x0, 0x94, 0x3,
+    0x8, 0x4, 0xe0, 0x1f, 0xfc, 0x87, 0xff, 0x60,
+    0x5, 0xbf, 0xfa, 0xc0, 0x3f, 0xf8, 0x64, 0x66,
+    0x20, 0x8, 0x8c, 0xf8, 0x17, 0x31, 0xc0, 0x17,
+    0x66, 0x68, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff,
+    0xc0, 0x3f, 0xfe, 0x20,
 
     /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x6a, 0xdf, 0xfe, 0xb6, 0x10,
-    0xc, 0xff, 0x80, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0xcf, 0xf8, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xff, 0x80,
-    0x9, 0xff, 0xff, 0x94, 0x10, 0x3, 0x8f, 0xff,
-    0xff, 0xf8, 0x5, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x1c, 0xff, 0xff, 0x80, 0xdf, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xf8, 0x2f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x85, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf8, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x87, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf8, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x82, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf8, 0xc, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0x80, 0x4f, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xf8, 0x0, 0x8f, 0xff, 0xfa, 0x41,
-    0x1, 0x39, 0xff, 0xff, 0xff, 0x80, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xf8,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0xe, 0xff, 0x80, 0x0, 0x0, 0x6, 0xad, 0xff,
-    0xeb, 0x71, 0x0, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf2, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xfe, 0x0, 0x7, 0xf9, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x70, 0x1,
-    0xff, 0xff, 0xa6, 0x20, 0x0, 0x26, 0xdf, 0xff,
-    0xe1, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0xbd, 0xef, 0xfe, 0xb8, 0x20, 0x0,
-    0x0,
+    0x0, 0xf3, 0x56, 0xff, 0xba, 0xd8, 0x40, 0x19,
+    0xfe, 0x80, 0xc, 0xbd, 0x2a, 0x40, 0x1, 0x49,
+    0xe7, 0x0, 0xfd, 0x54, 0x10, 0xf, 0xe8, 0xa0,
+    0xf, 0x4a, 0x80, 0x4d, 0x7d, 0xfe, 0xc7, 0x0,
+    0x29, 0x80, 0x65, 0x60, 0x1, 0x6c, 0xa0, 0x80,
+    0xe, 0x38, 0xc0, 0x3d, 0x0, 0x17, 0x90, 0x7,
+    0xc3, 0xa2, 0x1, 0x88, 0x80, 0x7, 0x20, 0xf,
+    0xe1, 0x80, 0xc, 0xe0, 0x15, 0x0, 0x7f, 0xcc,
+    0x1, 0x88, 0x2, 0x20, 0xf, 0xfc, 0x20, 0x1f,
+    0x8, 0x7, 0xff, 0x10, 0x80, 0x22, 0x0, 0xff,
+    0x84, 0x40, 0x13, 0x80, 0x54, 0x1, 0xff, 0x30,
+    0x6, 0x23, 0x0, 0x31, 0x80, 0x7f, 0xc, 0x80,
+    0x74, 0x0, 0x5a, 0x60, 0x1f, 0x16, 0x8, 0x7,
+    0x23, 0x80, 0x7, 0x29, 0x4, 0x4, 0xe7, 0x48,
+    0x3, 0xe8, 0x50, 0x9, 0x6f, 0xbf, 0xb1, 0x80,
+    0xa, 0x20, 0x1e, 0xaa, 0x8, 0x7, 0xf4, 0x50,
+    0x7, 0xe5, 0xe9, 0x52, 0x0, 0xa, 0x47, 0x38,
+    0x8, 0x3, 0xc0, 0x3c, 0xd5, 0xbf, 0xee, 0xb7,
+    0x10, 0x10, 0x8, 0x80, 0x3f, 0xf8, 0x88, 0x1,
+    0x38, 0x4, 0x60, 0x1f, 0xfa, 0x0, 0x2, 0x40,
+    0x7, 0xc9, 0x10, 0xf, 0xe9, 0x20, 0x4, 0x80,
+    0x6, 0x1, 0xba, 0x98, 0x80, 0x22, 0x6d, 0x60,
+    0x0, 0xb0, 0x0, 0xc8, 0x2, 0x59, 0xdf, 0xfb,
+    0x64, 0x80, 0x3, 0xa2, 0x0, 0x2d, 0x81, 0x0,
+    0xff, 0x93, 0xcc, 0x3, 0x9f, 0xad, 0xd0, 0x84,
+    0x0, 0x28, 0xfb, 0x62, 0x1,
 
     /* U+0068 "h" */
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x3, 0x8c, 0xef,
-    0xec, 0x81, 0x0, 0x0, 0xbf, 0xfb, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xcd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xd6, 0x21, 0x14, 0xaf, 0xff, 0xf4,
-    0xb, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0xbf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x1b, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf4, 0xbf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x5b, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
+    0xbf, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xfe,
+    0x7, 0x19, 0xdf, 0xd9, 0x2, 0x1, 0xf8, 0x6b,
+    0x1c, 0xc4, 0x4, 0xdf, 0x9c, 0x3, 0xcf, 0x8a,
+    0x1, 0xfd, 0x12, 0x1, 0xc6, 0x40, 0x53, 0xbd,
+    0xcb, 0x50, 0x9, 0x90, 0x3, 0xcd, 0xac, 0x42,
+    0x24, 0xa9, 0x0, 0xa0, 0x3, 0x92, 0x40, 0x3e,
+    0x64, 0x0, 0x18, 0x80, 0x68, 0x0, 0xfe, 0xe0,
+    0x9, 0x40, 0x21, 0x30, 0xf, 0xe7, 0x0, 0x84,
+    0x2, 0x20, 0xf, 0xf1, 0x80, 0x46, 0x1, 0x38,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xd8,
 
     /* U+0069 "i" */
-    0x0, 0x66, 0x10, 0xd, 0xff, 0xd0, 0x4f, 0xff,
-    0xf4, 0x2f, 0xff, 0xf2, 0x6, 0xdd, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff,
-    0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb,
-    0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0,
-    0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff,
-    0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb,
-    0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0,
-    0xb, 0xff, 0xb0, 0xb, 0xff, 0xb0, 0xb, 0xff,
-    0xb0,
+    0x0, 0x33, 0x4, 0x1, 0xb3, 0x2c, 0x4, 0x20,
+    0x1, 0x23, 0x0, 0x66, 0x29, 0x22, 0x51, 0x3,
+    0x6e, 0x94, 0x3, 0xff, 0x85, 0x7f, 0xeb, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xf5, 0x80,
 
     /* U+006A "j" */
-    0x0, 0x0, 0x0, 0x0, 0x57, 0x20, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x4, 0xce, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xb0, 0x4, 0x60, 0x0, 0x9f,
-    0xff, 0x60, 0xb, 0xff, 0xef, 0xff, 0xfe, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x5, 0xbe,
-    0xff, 0xd8, 0x10, 0x0,
+    0x0, 0xfc, 0xae, 0x40, 0x1f, 0xae, 0xa3, 0x48,
+    0x3, 0xc2, 0x80, 0x12, 0x80, 0x78, 0x40, 0x31,
+    0x0, 0x7d, 0x66, 0x2e, 0xa0, 0x1f, 0x26, 0x74,
+    0x0, 0x7f, 0xf5, 0x23, 0xfd, 0xc0, 0x1f, 0xff,
+    0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3,
+    0xfe, 0x20, 0x1, 0x80, 0x7e, 0x70, 0x3, 0x0,
+    0x11, 0x80, 0x29, 0x20, 0x6, 0x80, 0x3e, 0x7f,
+    0xbd, 0x80, 0x2, 0xc0, 0x48, 0x0, 0x10, 0x8,
+    0x74, 0x0, 0x54, 0x82, 0x0, 0x27, 0xf3, 0x0,
 
     /* U+006B "k" */
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xb0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfb, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xb0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x1, 0xcf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x2d, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x3, 0xef,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x4f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf7, 0xef, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0x40,
-    0x4f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xe3, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0xbf, 0xfe, 0x20, 0x0, 0x0, 0x9f, 0xff, 0xb0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf8, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0x50, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf2, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xfd, 0x10, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xb0,
+    0xbf, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xcd, 0xff, 0x60, 0x7, 0xff, 0xa, 0x24, 0x0,
+    0x98, 0x1, 0xff, 0xc1, 0x97, 0x0, 0x25, 0x80,
+    0x7f, 0xf0, 0x69, 0x80, 0x9, 0x60, 0x1f, 0xfc,
+    0x1b, 0x50, 0x2, 0xd8, 0x7, 0xfe, 0x1c, 0x40,
+    0x2, 0xd0, 0x7, 0xfe, 0x2c, 0x30, 0x2, 0xd0,
+    0x7, 0xfe, 0x3c, 0x20, 0x2, 0xd0, 0x7, 0xfe,
+    0x4c, 0x10, 0x9, 0x80, 0x3f, 0xf2, 0xd8, 0x7,
+    0x1c, 0x80, 0x7f, 0xc2, 0x1, 0x40, 0x80, 0x19,
+    0x80, 0x1f, 0xfc, 0x1b, 0x7a, 0x0, 0xa4, 0xc0,
+    0x3f, 0xc3, 0x88, 0x9, 0x20, 0x16, 0x88, 0x7,
+    0xe1, 0xc3, 0x0, 0x99, 0x80, 0x1, 0xa0, 0xf,
+    0xca, 0x40, 0x1d, 0x26, 0x0, 0x48, 0x0, 0xff,
+    0xe1, 0xe8, 0x80, 0x1d, 0x40, 0x3f, 0xf8, 0x43,
+    0xa0, 0x15, 0x10, 0x7, 0xff, 0x8, 0xe8, 0x2,
+    0xf1, 0x0, 0xff, 0xe1, 0x2b, 0x80, 0xa, 0x80,
 
     /* U+006C "l" */
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb,
-    0xbf, 0xfb, 0xbf, 0xfb,
+    0xbf, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xf9,
+    0xa0,
 
     /* U+006D "m" */
-    0xbf, 0xf9, 0x0, 0x5a, 0xdf, 0xfd, 0xb5, 0x0,
-    0x0, 0x0, 0x5a, 0xde, 0xfe, 0xb6, 0x0, 0x0,
-    0xbf, 0xf9, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xd3,
-    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0xbf, 0xfc, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0x37, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x30,
-    0xbf, 0xff, 0xff, 0x92, 0x0, 0x3, 0xcf, 0xff,
-    0xef, 0xff, 0xa3, 0x0, 0x3, 0xbf, 0xff, 0xd0,
-    0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf5,
-    0xbf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0xbf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd,
-    0xbf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfe,
-    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xbf, 0xf4, 0x80, 0x16, 0xb7, 0xfd, 0xb6, 0xa0,
+    0x1e, 0x5a, 0xde, 0xfe, 0xb6, 0x0, 0xfc, 0x59,
+    0x4a, 0x40, 0x2, 0x4a, 0xd3, 0x0, 0x2f, 0x52,
+    0x90, 0x80, 0xa4, 0xf1, 0x80, 0x72, 0xe1, 0x80,
+    0x42, 0x1, 0x8b, 0xd, 0xe8, 0x40, 0x21, 0x0,
+    0xc3, 0x86, 0x1, 0x8c, 0x41, 0xb7, 0xfb, 0xf0,
+    0xc0, 0x2d, 0x80, 0x2, 0xe7, 0xf7, 0xe2, 0x0,
+    0x5c, 0x1, 0xea, 0x92, 0x0, 0x8f, 0x10, 0x0,
+    0x20, 0x8, 0xa3, 0x0, 0x8e, 0xd4, 0x0, 0x4a,
+    0x1, 0x99, 0x40, 0x3e, 0x90, 0xc, 0x8e, 0x1,
+    0xf5, 0x80, 0x5e, 0x1, 0xac, 0x3, 0xf1, 0x10,
+    0x2, 0xf0, 0xf, 0xc2, 0x80, 0x7, 0x0, 0x84,
+    0x80, 0x3f, 0x9c, 0x2, 0x40, 0xf, 0xe3, 0x0,
+    0x18, 0x4, 0x40, 0x1f, 0xe3, 0x0, 0x8, 0x7,
+    0xff, 0x4, 0x40, 0x27, 0x0, 0xff, 0xe0, 0x98,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xff, 0x80, 0x0,
 
     /* U+006E "n" */
-    0xbf, 0xf9, 0x0, 0x49, 0xde, 0xfe, 0xc8, 0x10,
-    0x0, 0xb, 0xff, 0x92, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0xbf, 0xfb, 0xef, 0xff, 0xfe,
-    0xef, 0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xfa,
-    0x30, 0x0, 0x17, 0xff, 0xff, 0x40, 0xbf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0xb,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf1, 0xbf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x4b, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf5, 0xbf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x60,
+    0xbf, 0xf4, 0x80, 0x12, 0x77, 0xbf, 0xb2, 0x4,
+    0x3, 0xf1, 0x65, 0xb1, 0x8, 0x9, 0xbf, 0x38,
+    0x7, 0x8b, 0xc, 0x2, 0x11, 0x0, 0x68, 0x90,
+    0xe, 0x41, 0x5, 0xcf, 0xee, 0xa0, 0x2, 0x64,
+    0x0, 0xf4, 0xd1, 0x80, 0x42, 0xf6, 0x1, 0x40,
+    0x7, 0x2b, 0x0, 0x7c, 0x8a, 0x0, 0x31, 0x0,
+    0xd0, 0x1, 0xfd, 0xc0, 0x12, 0x80, 0x42, 0x40,
+    0x1f, 0xcc, 0x1, 0x8, 0x4, 0x40, 0x1f, 0xe3,
+    0x0, 0x8c, 0x2, 0x70, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0xfc, 0x3, 0xff, 0xb0,
 
     /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xc9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xa4, 0x10, 0x15, 0xbf, 0xff,
-    0xf3, 0x0, 0x2, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xe1, 0x0, 0xaf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x80, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xfe, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x47, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf5, 0x6f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x44, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf2, 0xf, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfe,
-    0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x70, 0x2, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xe1, 0x0, 0x5, 0xff,
-    0xff, 0xa4, 0x10, 0x15, 0xbf, 0xff, 0xf3, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x49, 0xdf, 0xff, 0xc9, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xf2, 0x4e, 0xff, 0xd9, 0x26, 0x1, 0xfe,
+    0x3d, 0xb6, 0x20, 0x8, 0xdb, 0x30, 0x40, 0x1f,
+    0x3e, 0x10, 0x7, 0xf1, 0xea, 0x80, 0x72, 0xc0,
+    0x4, 0xb7, 0xdf, 0xd4, 0x80, 0x15, 0x18, 0x4,
+    0x54, 0x0, 0x1b, 0xa4, 0x10, 0x15, 0xba, 0x0,
+    0xb4, 0x40, 0x10, 0x1, 0x52, 0x0, 0x7c, 0xb2,
+    0x0, 0x19, 0x0, 0x28, 0x1, 0x50, 0x3, 0xf9,
+    0x8c, 0x0, 0xc0, 0x80, 0x17, 0x0, 0x7f, 0xd4,
+    0x0, 0x12, 0x20, 0x4, 0xa0, 0x1f, 0xf1, 0x0,
+    0x4c, 0x20, 0x10, 0x80, 0x7f, 0xcc, 0x1, 0x8,
+    0x80, 0x21, 0x0, 0xff, 0x98, 0x2, 0x12, 0x0,
+    0x94, 0x3, 0xfe, 0x30, 0x9, 0x90, 0x2, 0xf0,
+    0xf, 0xfa, 0x80, 0x2, 0x40, 0xa0, 0x4, 0x40,
+    0x7, 0xf3, 0x10, 0x2, 0x40, 0x10, 0x1, 0x5a,
+    0x0, 0x7c, 0xd2, 0x0, 0x16, 0x0, 0x15, 0x0,
+    0x57, 0x48, 0x20, 0x2b, 0x72, 0x1, 0x68, 0x80,
+    0x4b, 0x20, 0x12, 0xdf, 0x7f, 0x52, 0x0, 0x54,
+    0x60, 0x1c, 0xd8, 0x40, 0x1f, 0xc7, 0xaa, 0x1,
+    0xf1, 0xed, 0xb1, 0x0, 0x46, 0xd7, 0x84, 0x1,
+    0x80,
 
     /* U+0070 "p" */
-    0xbf, 0xf9, 0x0, 0x38, 0xce, 0xfe, 0xc8, 0x30,
-    0x0, 0x0, 0xb, 0xff, 0x91, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0xbf, 0xfb, 0xdf,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xe3, 0x0, 0xb,
-    0xff, 0xff, 0xfd, 0x50, 0x0, 0x4, 0xbf, 0xff,
-    0xe1, 0x0, 0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xb0, 0xb, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0xbf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf9, 0xb, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xd0, 0xbf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xf0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xb, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xd0, 0xbf, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf9,
-    0xb, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x40, 0xbf, 0xff, 0xfc, 0x20, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xb0, 0xb, 0xff, 0xff,
-    0xff, 0x83, 0x0, 0x27, 0xdf, 0xff, 0xe1, 0x0,
-    0xbf, 0xfc, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe3, 0x0, 0xb, 0xff, 0xb0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x28, 0xce, 0xfe, 0xc8, 0x30, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0xbf, 0xf4, 0x80, 0xe, 0x33, 0xbf, 0xb2, 0xc,
+    0x3, 0xfc, 0x35, 0x8e, 0x62, 0x2, 0x6f, 0x94,
+    0x20, 0x1f, 0x16, 0x28, 0x4, 0x44, 0x0, 0xcb,
+    0xe6, 0x1, 0xe4, 0x20, 0x2a, 0xfd, 0xd7, 0xda,
+    0x0, 0x7, 0x44, 0x3, 0xe4, 0xd5, 0x0, 0xc9,
+    0x70, 0x0, 0x1a, 0x0, 0xf1, 0x58, 0x7, 0xe7,
+    0x50, 0x2, 0x20, 0x3, 0xa0, 0x3, 0xfd, 0x60,
+    0x16, 0x80, 0x72, 0x80, 0x7f, 0x85, 0x0, 0x8,
+    0x1, 0x8c, 0x3, 0xff, 0x18, 0x0, 0x80, 0x33,
+    0x80, 0x7f, 0xef, 0x0, 0xf9, 0x80, 0x3f, 0xf7,
+    0x0, 0x7c, 0x40, 0x1f, 0xf9, 0x40, 0x4, 0x1,
+    0xcc, 0x1, 0xfe, 0x23, 0x0, 0x20, 0x7, 0x40,
+    0x80, 0x7f, 0x70, 0x5, 0xa0, 0x1c, 0x3a, 0x40,
+    0x1f, 0x51, 0x80, 0x11, 0x0, 0x1e, 0x3d, 0x83,
+    0x0, 0x13, 0xea, 0x80, 0x6, 0x80, 0x38, 0xd4,
+    0x0, 0xf9, 0xfe, 0xd8, 0x20, 0x0, 0xe8, 0x80,
+    0x73, 0xd3, 0x80, 0x7f, 0x27, 0x98, 0x7, 0xe8,
+    0xd7, 0x31, 0x1, 0x37, 0xcb, 0x10, 0xf, 0xf1,
+    0x46, 0x77, 0xf6, 0x41, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfd, 0xa0,
 
     /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfd, 0xb6, 0x0,
-    0xf, 0xff, 0x40, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0xff, 0xf4, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0x40,
-    0x7, 0xff, 0xff, 0xa4, 0x10, 0x15, 0xbf, 0xff,
-    0xff, 0xf4, 0x3, 0xff, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x40, 0xbf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf4, 0x1f,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x44, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf4, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x47, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf4, 0x6f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0x44, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf4, 0x1f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x40, 0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf4, 0x3, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x40, 0x7, 0xff,
-    0xff, 0xa4, 0x10, 0x15, 0xbf, 0xff, 0xff, 0xf4,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7f, 0xff, 0x40, 0x0, 0x4, 0xef, 0xff, 0xff,
-    0xff, 0xfd, 0x33, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x6a, 0xdf, 0xfd, 0xb5, 0x0, 0x3f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf4,
+    0x0, 0xf2, 0xd6, 0xff, 0xb6, 0xd8, 0x2, 0xff,
+    0x90, 0x3, 0x27, 0x52, 0x90, 0x0, 0x92, 0x79,
+    0x0, 0x3f, 0x45, 0x88, 0x7, 0xe1, 0xb6, 0x0,
+    0xf3, 0xb8, 0x2, 0x5b, 0xef, 0xea, 0x40, 0x4,
+    0x80, 0x71, 0xc0, 0x0, 0x6e, 0x90, 0x40, 0x56,
+    0xe4, 0x3, 0xe8, 0x0, 0xa9, 0x0, 0x3e, 0x68,
+    0x0, 0xe1, 0x40, 0x2, 0xa0, 0x7, 0xf3, 0x90,
+    0x6, 0x50, 0xb, 0x80, 0x3f, 0xea, 0x0, 0xc4,
+    0x1, 0x28, 0x7, 0xfc, 0x60, 0x18, 0x40, 0x21,
+    0x0, 0xff, 0x98, 0x3, 0x8, 0x4, 0x20, 0x1f,
+    0xf3, 0x0, 0x62, 0x0, 0x94, 0x3, 0xfe, 0x30,
+    0xc, 0xa0, 0x17, 0x80, 0x7f, 0xd4, 0x1, 0x85,
+    0x0, 0x8, 0x80, 0xf, 0xe6, 0x20, 0xe, 0x80,
+    0xa, 0xd0, 0x3, 0xe6, 0x90, 0xf, 0x1c, 0x0,
+    0x57, 0x48, 0x20, 0x2b, 0x72, 0x1, 0xf9, 0xdc,
+    0x1, 0x2d, 0xf7, 0xf5, 0x20, 0x2, 0x0, 0x3e,
+    0x8b, 0x10, 0xf, 0xc5, 0x88, 0x1, 0xf9, 0x3a,
+    0x54, 0x80, 0x4, 0x95, 0xa6, 0x1, 0xff, 0x35,
+    0x6f, 0xfb, 0x6d, 0x40, 0x3f, 0xff, 0xe0, 0x1f,
+    0xfe, 0xe0,
 
     /* U+0072 "r" */
-    0xbf, 0xf9, 0x0, 0x38, 0xce, 0x8b, 0xff, 0x90,
-    0xaf, 0xff, 0xf8, 0xbf, 0xf9, 0xbf, 0xff, 0xff,
-    0x8b, 0xff, 0xff, 0xff, 0x96, 0x42, 0xbf, 0xff,
-    0xfc, 0x10, 0x0, 0xb, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x50, 0x0, 0x0, 0xb, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0,
+    0xbf, 0xf4, 0x80, 0xe, 0x33, 0xa0, 0x3, 0xab,
+    0x1c, 0xc4, 0x3, 0xad, 0x40, 0x3f, 0x32, 0x0,
+    0x1a, 0x6e, 0x80, 0x38, 0xfa, 0x59, 0x8, 0x3,
+    0x16, 0x8, 0x7, 0xe8, 0x0, 0xff, 0x28, 0x7,
+    0xf1, 0x80, 0x7f, 0x9c, 0x3, 0xff, 0xfe, 0x1,
+    0xff, 0xd3,
 
     /* U+0073 "s" */
-    0x0, 0x0, 0x6, 0xad, 0xff, 0xed, 0xa7, 0x20,
-    0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb1, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xe6, 0x10, 0x0, 0x25,
-    0xbf, 0x60, 0x6, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x8f, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xfd, 0xa7, 0x30, 0x0, 0x0, 0x0, 0x6e, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x0, 0x0, 0x0, 0x4,
-    0x8b, 0xef, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x8e, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x0,
-    0xa3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd0,
-    0x7f, 0xfc, 0x73, 0x0, 0x0, 0x3a, 0xff, 0xf8,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x1, 0x6a, 0xde, 0xff, 0xeb, 0x82,
-    0x0, 0x0,
+    0x0, 0xe6, 0xad, 0xff, 0x76, 0xd3, 0x90, 0x7,
+    0x2f, 0x4a, 0x90, 0x0, 0x49, 0x63, 0x6c, 0x40,
+    0xd, 0x42, 0x1, 0xfe, 0x51, 0x1, 0x90, 0x0,
+    0xcf, 0x7f, 0xdb, 0x48, 0x10, 0x0, 0x70, 0xb,
+    0x58, 0x40, 0x22, 0x5b, 0xd6, 0x0, 0x70, 0x0,
+    0x4c, 0x3, 0xf1, 0x0, 0x5e, 0x0, 0x13, 0x0,
+    0xff, 0xca, 0x1, 0x64, 0x18, 0x7, 0xf8, 0x9c,
+    0x2, 0x7c, 0xfd, 0xa7, 0x30, 0xf, 0x44, 0x88,
+    0x6, 0x25, 0x8c, 0xe8, 0x0, 0xe6, 0xeb, 0x74,
+    0x10, 0xc, 0x2f, 0x82, 0x1, 0xc9, 0x17, 0xdc,
+    0xb7, 0x10, 0x1, 0xc0, 0x7, 0xf0, 0xa4, 0x71,
+    0x0, 0x1c, 0x3, 0xff, 0x82, 0xa0, 0x1, 0x0,
+    0x51, 0x80, 0x7f, 0x18, 0x0, 0x81, 0xd7, 0x30,
+    0xe6, 0x1, 0x8e, 0x90, 0x0, 0xa1, 0x20, 0x3,
+    0x8c, 0xff, 0xd8, 0xa0, 0x2, 0x80, 0xd4, 0x0,
+    0xff, 0x97, 0x40, 0x7, 0x7d, 0x2a, 0x42, 0x0,
+    0x14, 0x7d, 0xa0, 0x0,
 
     /* U+0074 "t" */
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x5c, 0xcd, 0xff, 0xfd, 0xcc, 0xcc,
-    0x80, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x50, 0x1, 0x81, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xef, 0xf7, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x4a, 0xef, 0xfc,
-    0x81,
+    0x0, 0x8f, 0xfe, 0x30, 0xf, 0xff, 0x23, 0xff,
+    0xb0, 0x2, 0xcf, 0xfd, 0x60, 0x1f, 0xfc, 0x32,
+    0x33, 0x10, 0x4, 0x46, 0x7c, 0xb, 0x98, 0xe0,
+    0xb, 0xb3, 0x34, 0x0, 0x7f, 0xff, 0xc0, 0x3f,
+    0xfd, 0xee, 0x1, 0xfc, 0x40, 0x16, 0x0, 0x7f,
+    0x9, 0x0, 0x1d, 0x40, 0x3, 0x2, 0x1, 0xa0,
+    0x2, 0xaf, 0xee, 0x3b, 0x0, 0x65, 0x70, 0xc,
+    0x20, 0xa, 0x0, 0xe8, 0xb5, 0x10, 0x1, 0xbe,
+    0x0,
 
     /* U+0075 "u" */
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x1d, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xf1, 0xcf, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x19, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xf1, 0x4f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0x10, 0xcf,
-    0xff, 0xb3, 0x0, 0x1, 0x6e, 0xff, 0xff, 0xf1,
-    0x2, 0xef, 0xff, 0xff, 0xde, 0xff, 0xff, 0xaf,
-    0xff, 0x10, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xfe,
-    0x53, 0xff, 0xf1, 0x0, 0x0, 0x4a, 0xdf, 0xfe,
-    0xb6, 0x0, 0x3f, 0xff, 0x10,
+    0xef, 0xf4, 0x0, 0x7f, 0x9b, 0xfe, 0x10, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xae,
+    0x20, 0x18, 0xc0, 0x2, 0x1, 0xfe, 0xf0, 0xc,
+    0x20, 0x5, 0x0, 0xff, 0x20, 0x6, 0x50, 0x1,
+    0x88, 0x7, 0xe4, 0x30, 0xd, 0xa0, 0x15, 0x0,
+    0x7c, 0x54, 0x1, 0xc8, 0x60, 0x4, 0xb3, 0x0,
+    0x85, 0xb0, 0x40, 0x3d, 0xc2, 0x0, 0x4c, 0xfd,
+    0xee, 0x48, 0x82, 0x80, 0x71, 0x61, 0x80, 0x62,
+    0x10, 0x0, 0xd4, 0x80, 0x78, 0xb2, 0xd4, 0x80,
+    0x2, 0x93, 0xca, 0x1, 0xc0,
 
     /* U+0076 "v" */
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xe0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0, 0xef,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x10, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf2, 0x0, 0x0,
-    0xa, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xb0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xcf,
-    0xfc, 0x0, 0x0, 0x0, 0x8f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x0, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x90,
-    0x0, 0x6, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0x0, 0xd, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf7, 0x0, 0x4f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x52, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xc9,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0,
+    0xd, 0xff, 0x58, 0x7, 0xfe, 0x7f, 0xf7, 0x0,
+    0x2c, 0x0, 0x84, 0x1, 0xff, 0x50, 0x2, 0x40,
+    0xc, 0x20, 0xb, 0x0, 0xff, 0x29, 0x0, 0x18,
+    0x2, 0x60, 0x3, 0x8, 0x7, 0xf4, 0x80, 0x18,
+    0x40, 0x29, 0x0, 0x98, 0x3, 0xf1, 0x98, 0x1,
+    0x60, 0x18, 0x54, 0x1, 0x20, 0x1f, 0xa4, 0x0,
+    0x84, 0x1, 0xd2, 0x0, 0x15, 0x0, 0xf0, 0xa8,
+    0x3, 0xc0, 0x3c, 0x66, 0x0, 0x48, 0x7, 0xa4,
+    0x0, 0x48, 0x1, 0xf4, 0x80, 0xc, 0x80, 0x39,
+    0x80, 0x16, 0x1, 0xf9, 0x44, 0x1, 0x60, 0x19,
+    0x84, 0x5, 0x80, 0x3f, 0xa4, 0x0, 0xc2, 0x1,
+    0x58, 0x1, 0x80, 0x3f, 0xcc, 0x1, 0x30, 0x1,
+    0x8, 0x1, 0x20, 0x1f, 0xe1, 0x60, 0x4, 0x80,
+    0x3c, 0x0, 0xa2, 0x1, 0xff, 0x58, 0x0, 0x54,
+    0x90, 0x1, 0x20, 0x1f, 0xf8, 0x90, 0x1, 0x36,
+    0x0, 0x33, 0x0, 0x7f, 0xf0, 0x7c, 0x0, 0x6c,
+    0x0, 0x90, 0xf, 0xfe, 0x12, 0x10, 0x6, 0x15,
+    0x0, 0xff, 0xe1, 0xd8, 0x6, 0x90, 0xf, 0xfe,
+    0x23, 0x8, 0x4, 0xc0, 0x1f, 0x80,
 
     /* U+0077 "w" */
-    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe,
-    0x3, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0x90, 0xd, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xf3, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xfd, 0x0, 0x1, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xef, 0xf6, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x70, 0x0, 0xb, 0xff, 0x80, 0x0, 0x0,
-    0x4, 0xff, 0xd7, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xff, 0xf1, 0x0, 0x0, 0x5f, 0xfd, 0x0, 0x0,
-    0x0, 0xaf, 0xf7, 0x1f, 0xff, 0x20, 0x0, 0x0,
-    0x6f, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xf3, 0x0,
-    0x0, 0x1f, 0xff, 0x10, 0xbf, 0xf7, 0x0, 0x0,
-    0xc, 0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0x90,
-    0x0, 0x7, 0xff, 0xb0, 0x4, 0xff, 0xd0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
-    0x0, 0x0, 0xdf, 0xf4, 0x0, 0xe, 0xff, 0x30,
-    0x0, 0x8f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xf5, 0x0, 0x3f, 0xfe, 0x0, 0x0, 0x8f, 0xf9,
-    0x0, 0xe, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xb0, 0x9, 0xff, 0x80, 0x0, 0x2, 0xff,
-    0xf0, 0x4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x10, 0xef, 0xf2, 0x0, 0x0, 0xc,
-    0xff, 0x50, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf6, 0x5f, 0xfc, 0x0, 0x0, 0x0,
-    0x6f, 0xfb, 0xf, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xcb, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xff, 0xf7, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0,
+    0x9f, 0xf5, 0x0, 0x7f, 0x9b, 0xfd, 0xc0, 0x1f,
+    0xe2, 0xff, 0x70, 0x50, 0x1, 0x44, 0x3, 0xfa,
+    0x80, 0x2, 0x80, 0x1f, 0xd4, 0x0, 0x70, 0x32,
+    0x0, 0x38, 0x7, 0xe2, 0x30, 0xb, 0x80, 0x3f,
+    0x98, 0x1, 0x40, 0xa, 0x0, 0x50, 0x7, 0xea,
+    0x0, 0xca, 0x1, 0xf9, 0x4, 0x8, 0xc0, 0xc,
+    0x0, 0x32, 0x0, 0xf9, 0x80, 0x2, 0x0, 0x60,
+    0xf, 0xb8, 0x1, 0x40, 0x10, 0xa0, 0x2, 0x80,
+    0x3c, 0x82, 0x5, 0x20, 0xa, 0x0, 0xf9, 0x40,
+    0xc, 0x1, 0xb8, 0x0, 0xa0, 0x1e, 0xe0, 0x5,
+    0x30, 0x0, 0xc8, 0x3, 0x98, 0x0, 0x82, 0x1,
+    0x94, 0x0, 0x46, 0x1, 0x85, 0x40, 0xc, 0x28,
+    0x0, 0x50, 0xe, 0xa0, 0x7, 0x0, 0x79, 0x80,
+    0x14, 0x1, 0x98, 0x0, 0x82, 0x1e, 0x0, 0xa0,
+    0xc, 0x46, 0x2, 0xa0, 0x1e, 0xa0, 0x3, 0x80,
+    0x6a, 0x0, 0x78, 0x1, 0x4, 0x8, 0xc0, 0x2a,
+    0x0, 0x38, 0x7, 0xc6, 0x40, 0x2a, 0x0, 0x32,
+    0x1, 0x40, 0x9, 0x80, 0x14, 0x1, 0x30, 0x2,
+    0x80, 0x3f, 0x50, 0x3, 0x80, 0x14, 0x0, 0x60,
+    0xd, 0x40, 0x6, 0x0, 0x20, 0x81, 0x18, 0x7,
+    0xe6, 0x0, 0x20, 0x83, 0x80, 0x28, 0x3, 0x11,
+    0x80, 0x14, 0x38, 0x1, 0x40, 0x1f, 0xc2, 0x80,
+    0x7, 0x51, 0x3, 0x20, 0xe, 0xa0, 0x7, 0x2,
+    0x80, 0x18, 0x3, 0xfd, 0xc0, 0xa, 0xe0, 0x4,
+    0x80, 0x79, 0x80, 0x8, 0xe0, 0x4, 0x10, 0xf,
+    0xf2, 0x80, 0xd, 0x0, 0xa, 0x1, 0xf2, 0x80,
+    0x20, 0x1, 0xc0, 0x1f, 0xf9, 0x80, 0x33, 0x0,
+    0x7e, 0xe0, 0xc, 0x2a, 0x1, 0xff, 0xb4, 0x3,
+    0x50, 0x7, 0xe4, 0x20, 0x9, 0xc0, 0x3f, 0xf8,
+    0x28, 0x40, 0x2, 0x30, 0xf, 0xea, 0x0, 0xa8,
+    0x3, 0xe0,
 
     /* U+0078 "x" */
-    0xb, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x90, 0x1, 0xef, 0xfd, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xa0,
-    0x0, 0x0, 0xb, 0xff, 0xe1, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x7f, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x30, 0x4, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xd1, 0x1e,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xfb, 0xcf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xf5, 0x7f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x90, 0xb,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfc,
-    0x0, 0x1, 0xef, 0xfc, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe1, 0x0, 0x0, 0x3f, 0xff, 0xa0, 0x0,
-    0x0, 0x9f, 0xff, 0x40, 0x0, 0x0, 0x7, 0xff,
-    0xf6, 0x0, 0x5, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x30, 0x2f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xe1,
+    0xb, 0xff, 0x88, 0x3, 0xf1, 0xff, 0xd2, 0x0,
+    0xa1, 0x0, 0x78, 0x7, 0xc3, 0xa0, 0x3, 0x90,
+    0x0, 0xe8, 0x0, 0xa8, 0x3, 0xd4, 0x20, 0x3a,
+    0x1, 0x8e, 0x0, 0xa, 0xc0, 0x19, 0xd0, 0x1,
+    0x42, 0x1, 0xce, 0xa0, 0x9, 0x30, 0x2, 0x40,
+    0x2, 0x10, 0x3, 0xea, 0x20, 0x7, 0x8, 0xa8,
+    0x0, 0x8e, 0x1, 0xfd, 0xe0, 0x2, 0xad, 0x10,
+    0x2b, 0x0, 0xff, 0x15, 0x0, 0x10, 0xc0, 0x1e,
+    0x1, 0xff, 0x95, 0x80, 0x35, 0x10, 0x7, 0xff,
+    0x6, 0x80, 0x21, 0x40, 0xf, 0xfe, 0x17, 0x0,
+    0x43, 0x40, 0x1f, 0xfc, 0x1a, 0x20, 0xc, 0x90,
+    0x1, 0xff, 0x3a, 0x80, 0x2a, 0x0, 0xe, 0x80,
+    0x1f, 0xc9, 0x0, 0x6, 0x57, 0x40, 0x5, 0x10,
+    0x7, 0xc3, 0x40, 0x3, 0x90, 0x5, 0x8, 0xf,
+    0x0, 0x7d, 0xa2, 0x3, 0xa0, 0x10, 0xe8, 0x0,
+    0xe8, 0x3, 0xa4, 0xc0, 0x14, 0x20, 0x18, 0xe0,
+    0x0, 0xac, 0x1, 0x2b, 0x0, 0x1d, 0x0, 0x3c,
+    0xe8, 0x0, 0x93, 0x2, 0xa0, 0x2, 0x40, 0x7,
+    0xea, 0x20, 0x6, 0x88,
 
     /* U+0079 "y" */
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xe0, 0x6, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0, 0xef,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x10, 0x0, 0x8f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0x0, 0x0,
-    0x9, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xbf,
-    0xfd, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0xef,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xf2, 0x0, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x3f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x10, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x71, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe9,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x0, 0x0, 0x1, 0xef, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xa3, 0x0, 0x3d, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x9d, 0xff, 0xd9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x58, 0x7, 0xfe, 0x7f, 0xf7, 0x0,
+    0x2c, 0x0, 0x86, 0x1, 0xff, 0x50, 0x2, 0x40,
+    0xc, 0x20, 0x9, 0x0, 0xff, 0x29, 0x0, 0x18,
+    0x2, 0x60, 0x2, 0x88, 0x7, 0xf7, 0x0, 0x18,
+    0x40, 0x29, 0x0, 0xa4, 0x3, 0xf1, 0x20, 0x2,
+    0xc0, 0x30, 0xb0, 0x1, 0x80, 0x3f, 0x58, 0x1,
+    0x8, 0x3, 0xac, 0x0, 0x2c, 0x1, 0xe1, 0x60,
+    0x7, 0x80, 0x78, 0x90, 0x1, 0x60, 0x1e, 0x60,
+    0x1, 0x20, 0x7, 0xde, 0x0, 0x24, 0x0, 0xe9,
+    0x0, 0x40, 0x7, 0xe4, 0x20, 0x7, 0x80, 0x65,
+    0x10, 0x15, 0x0, 0xfe, 0xb0, 0x2, 0x10, 0x5,
+    0x20, 0x9, 0x0, 0xff, 0x30, 0x80, 0x2c, 0x0,
+    0x66, 0x0, 0x30, 0x7, 0xfd, 0x20, 0x6, 0x10,
+    0x90, 0x3, 0x8, 0x7, 0xfc, 0xc0, 0x13, 0xa,
+    0x80, 0x2c, 0x3, 0xff, 0xb, 0x0, 0x26, 0x0,
+    0x8, 0x40, 0x1f, 0xfc, 0x1b, 0x0, 0xb, 0x0,
+    0x3c, 0x3, 0xff, 0x84, 0x48, 0x1, 0x8d, 0x0,
+    0x3f, 0xf8, 0x7e, 0x1, 0xa4, 0x3, 0xff, 0x88,
+    0x86, 0x0, 0x15, 0x0, 0xff, 0xe2, 0x90, 0x2,
+    0x40, 0x3f, 0xf8, 0xae, 0x20, 0x6, 0x0, 0xff,
+    0x8, 0x7, 0xc, 0x80, 0x1c, 0x40, 0x3f, 0xdb,
+    0x46, 0x0, 0x3c, 0x10, 0x19, 0x0, 0xff, 0x29,
+    0xae, 0x7f, 0xb0, 0x80, 0x16, 0x20, 0x1f, 0xe3,
+    0x0, 0xfd, 0x2a, 0x1, 0xff, 0x36, 0xb1, 0x0,
+    0x9, 0xb5, 0x80, 0x3f, 0xf0,
 
     /* U+007A "z" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x4c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcd, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60,
+    0x5f, 0xff, 0xfe, 0x19, 0x0, 0x7f, 0xf1, 0x44,
+    0xcf, 0xfc, 0x40, 0x11, 0x11, 0x33, 0x3f, 0xc0,
+    0x1b, 0xc0, 0x3f, 0xea, 0x20, 0x5, 0x10, 0x7,
+    0xf9, 0xd4, 0x0, 0xea, 0x1, 0xfe, 0x48, 0x0,
+    0x24, 0x0, 0x7f, 0x8a, 0x80, 0x5, 0x60, 0x1f,
+    0xf7, 0x88, 0xf, 0x80, 0x7f, 0xd4, 0x40, 0xa,
+    0x20, 0xf, 0xf3, 0xa8, 0x2, 0x10, 0x3, 0xfc,
+    0x90, 0x0, 0x57, 0x0, 0xff, 0x15, 0x80, 0xe,
+    0x80, 0x3f, 0xef, 0x0, 0xe, 0x80, 0x7f, 0xd6,
+    0x40, 0xa, 0x10, 0xf, 0xf4, 0x20, 0x2, 0x50,
+    0x3, 0xfc, 0x8e, 0x1, 0x5e, 0xef, 0xf9, 0x74,
+    0x3, 0x11, 0x7f, 0xc6, 0x1, 0xff, 0xc5,
 
     /* U+007B "{" */
-    0x0, 0x0, 0x7, 0xcf, 0xff, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x0, 0x8, 0xff, 0xff, 0xec, 0x0,
-    0xd, 0xff, 0xf3, 0x0, 0x0, 0xf, 0xff, 0x80,
-    0x0, 0x0, 0xf, 0xff, 0x60, 0x0, 0x0, 0x1f,
-    0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xff,
-    0x60, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x1f, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x8f,
-    0xff, 0x30, 0x0, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0xcd, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0x0,
-    0x1f, 0xff, 0x50, 0x0, 0x0, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x1f,
-    0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0,
-    0x0, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xff,
-    0x60, 0x0, 0x0, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0xf, 0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0xd, 0xff, 0xf3, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xec, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x0, 0x0, 0x7, 0xcf, 0xff,
+    0x0, 0xe7, 0xcf, 0xf8, 0x3, 0x64, 0x18, 0x7,
+    0xa0, 0xc0, 0x21, 0x30, 0x9, 0x40, 0x2c, 0xec,
+    0x0, 0x88, 0x0, 0xe6, 0x1, 0xfb, 0x80, 0x38,
+    0x40, 0x3f, 0xff, 0xa6, 0x1, 0xd2, 0x1, 0x30,
+    0x5, 0xfe, 0x70, 0x1, 0x98, 0x3, 0xe2, 0xd0,
+    0xc, 0x64, 0x0, 0x2c, 0x0, 0xd9, 0xb2, 0x0,
+    0x24, 0x0, 0xe7, 0x0, 0x84, 0x3, 0xf8, 0xc0,
+    0x3f, 0xfe, 0xa2, 0x1, 0xff, 0xc1, 0xf0, 0xf,
+    0x10, 0x1, 0x8c, 0x3, 0xa8, 0x2, 0xce, 0xc0,
+    0x9, 0xcc, 0x2, 0x13, 0x0, 0xd9, 0x6, 0x1,
 
     /* U+007C "|" */
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff,
+    0x3f, 0xf8, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xe9,
 
     /* U+007D "}" */
-    0x5f, 0xfe, 0xb4, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xef, 0xfa, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0x80, 0x0, 0x3,
-    0xff, 0xff, 0xd7, 0x0, 0x0, 0x9f, 0xff, 0x10,
-    0x0, 0x0, 0xb, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x80, 0x0, 0x4d, 0xff, 0xff,
-    0xf2, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x5f, 0xfe, 0xa4, 0x0, 0x0, 0x0,
+    0x5f, 0xf7, 0x5a, 0x0, 0x7e, 0x14, 0xb7, 0x0,
+    0xc2, 0x40, 0x1a, 0x8, 0x2, 0x4d, 0xf7, 0x0,
+    0xa8, 0x3, 0xd0, 0x20, 0x2, 0x0, 0xf9, 0x40,
+    0x2, 0x1, 0xff, 0xff, 0x0, 0xff, 0xce, 0x1,
+    0xf1, 0x0, 0xc, 0xc0, 0x1e, 0xb0, 0xb, 0x3e,
+    0x0, 0x31, 0x50, 0x7, 0xf1, 0xd0, 0x4, 0x5e,
+    0x1, 0xa8, 0x2, 0xed, 0x70, 0xc, 0x40, 0x3,
+    0x10, 0xf, 0xe7, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0x28, 0x0, 0x40, 0x3d, 0x2, 0x0, 0x20, 0x9,
+    0x37, 0xdc, 0x2, 0xa0, 0x8, 0x48, 0x3, 0x41,
+    0x0, 0x78, 0x56, 0xdc, 0x3,
 
     /* U+007E "~" */
-    0x0, 0x6c, 0xfe, 0xb3, 0x0, 0x0, 0x0, 0x7f,
-    0xd0, 0x8f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xb,
-    0xfb, 0x3f, 0xff, 0xbb, 0xff, 0xfc, 0x20, 0x4,
-    0xff, 0x79, 0xff, 0x30, 0x3, 0xdf, 0xff, 0xbb,
-    0xff, 0xf2, 0xcf, 0x90, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf7, 0xa, 0xc5, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xc5, 0x0,
+    0x0, 0x36, 0x7f, 0x59, 0x80, 0x79, 0xff, 0x42,
+    0x24, 0xc0, 0x53, 0x24, 0x3, 0xb0, 0x18, 0xdc,
+    0x0, 0x88, 0x0, 0x36, 0x10, 0x1, 0x10, 0x19,
+    0x40, 0xc, 0xbb, 0x61, 0x1, 0xed, 0xdc, 0x0,
+    0x55, 0x3, 0x18, 0x0, 0xf5, 0x40, 0x8, 0x80,
+    0x4, 0x13, 0x1e, 0x0, 0x75, 0x5a, 0x0, 0xe,
+    0x9c, 0x0,
 
     /* U+00A0 " " */
 
     /* U+00A1 "¡" */
-    0x8, 0xed, 0x40, 0x4f, 0xff, 0xe0, 0x7f, 0xff,
-    0xf1, 0x2f, 0xff, 0xc0, 0x2, 0x76, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0x30, 0x9, 0xff, 0x30, 0xa, 0xff,
-    0x40, 0xa, 0xff, 0x50, 0xb, 0xff, 0x50, 0xc,
-    0xff, 0x60, 0xc, 0xff, 0x70, 0xd, 0xff, 0x70,
-    0xe, 0xff, 0x80, 0xe, 0xff, 0x90, 0xf, 0xff,
-    0xa0, 0xf, 0xff, 0xa0, 0xf, 0xff, 0xb0, 0x1f,
-    0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x2f, 0xff, 0xd0,
-    0x17, 0x77, 0x60,
+    0x8, 0xed, 0x40, 0x47, 0x12, 0xa0, 0x30, 0x8,
+    0x44, 0xa0, 0x11, 0x89, 0x6c, 0x4e, 0x0, 0x9,
+    0xd8, 0x3, 0xff, 0x87, 0x3f, 0xe3, 0x0, 0xfc,
+    0x60, 0x7, 0x0, 0xe1, 0x0, 0x8, 0x7, 0x38,
+    0x0, 0xc0, 0x38, 0x40, 0x2, 0x1, 0xc6, 0x0,
+    0xf0, 0xe, 0x10, 0x0, 0x80, 0xc, 0x3, 0xfe,
+    0x10, 0x10, 0x9, 0xc0, 0x3e, 0x30, 0x8, 0x40,
+    0xe2, 0x2b, 0x0,
 
     /* U+00A2 "¢" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x52, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xdf, 0xff, 0xff, 0xd7, 0x10,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xe6,
-    0xd, 0xf7, 0x6, 0xff, 0xff, 0x20, 0x3f, 0xff,
-    0xd1, 0x0, 0xdf, 0x70, 0x2, 0xee, 0x40, 0xb,
-    0xff, 0xf2, 0x0, 0xd, 0xf7, 0x0, 0x2, 0x0,
-    0x1, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x30, 0x0, 0xd, 0xf7,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf0, 0x0, 0x0,
-    0xdf, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x0,
-    0x0, 0xd, 0xf7, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf1, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0xd, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf4, 0x0, 0xd,
-    0xf7, 0x0, 0x6, 0x40, 0x0, 0x1e, 0xff, 0xf4,
-    0x0, 0xdf, 0x70, 0x6, 0xff, 0xa1, 0x0, 0x4f,
-    0xff, 0xfb, 0x5d, 0xf8, 0x5c, 0xff, 0xfd, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xff,
-    0xeb, 0x82, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
-    0x0, 0x0,
+    0x0, 0xfe, 0x45, 0x20, 0xf, 0xfe, 0x24, 0xd2,
+    0x80, 0x7f, 0xfa, 0x44, 0x1, 0xe0, 0x1f, 0xf8,
+    0x63, 0x78, 0x81, 0xff, 0x5c, 0x40, 0x3e, 0x7e,
+    0x72, 0x0, 0xe2, 0x8e, 0x50, 0xe, 0xa8, 0x0,
+    0xf0, 0x80, 0x6a, 0x60, 0xa, 0x14, 0x0, 0x33,
+    0xe4, 0x13, 0xf2, 0x1, 0x49, 0x1, 0xb8, 0x0,
+    0xbd, 0x80, 0x39, 0xb4, 0x45, 0x64, 0x10, 0x1,
+    0x78, 0x80, 0x7c, 0x59, 0xc8, 0x2, 0x80, 0x7,
+    0x20, 0xf, 0xe2, 0x0, 0x90, 0x2, 0xb0, 0xf,
+    0xfe, 0x11, 0x0, 0x46, 0x1, 0xff, 0xd5, 0x10,
+    0x8, 0x40, 0x3f, 0xf8, 0x44, 0x1, 0x28, 0x7,
+    0xff, 0x9, 0x0, 0x2e, 0x0, 0xff, 0xe1, 0xb0,
+    0x1, 0x50, 0x3, 0xf9, 0x90, 0x2, 0x81, 0x0,
+    0x5a, 0x0, 0x7c, 0xd3, 0x74, 0x20, 0x34, 0x1,
+    0x5d, 0x94, 0x1, 0xeb, 0x92, 0x0, 0x71, 0x0,
+    0x25, 0x0, 0x49, 0x44, 0xf, 0x46, 0x0, 0x1f,
+    0x0, 0xcb, 0x86, 0x1, 0xfc, 0x9e, 0x40, 0x1c,
+    0x79, 0x87, 0x30, 0x0, 0xa3, 0xed, 0x88, 0x7,
+    0xe3, 0x8c, 0x20, 0x9b, 0x82, 0x0, 0xff, 0xf8,
+    0x80,
 
     /* U+00A3 "£" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7b, 0xdf, 0xff,
-    0xeb, 0x83, 0x0, 0x0, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x3e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x2, 0xff, 0xff, 0xe8, 0x53,
-    0x23, 0x58, 0xcf, 0xf1, 0x0, 0x0, 0xc, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2, 0x60, 0x0,
-    0x0, 0x4f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x55, 0x55, 0xff, 0xfb, 0x55, 0x55, 0x55,
-    0x55, 0x50, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
-    0x11, 0xff, 0xf9, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2,
+    0x0, 0xfe, 0x17, 0xbd, 0xff, 0xba, 0xe0, 0xc0,
+    0x3f, 0x86, 0xba, 0x10, 0x80, 0x21, 0x47, 0xcd,
+    0x40, 0xf, 0x1f, 0xa8, 0x7, 0xfc, 0x44, 0x0,
+    0xe2, 0xc1, 0x0, 0xb, 0xd6, 0x6e, 0x53, 0x98,
+    0x1, 0xc0, 0x3b, 0x80, 0x26, 0xe8, 0x53, 0x23,
+    0x58, 0xcd, 0x91, 0x0, 0xc8, 0x60, 0x5, 0x90,
+    0xf, 0xe2, 0x60, 0xe, 0xe0, 0xa, 0xc0, 0x3f,
+    0xf8, 0xae, 0x0, 0x31, 0x0, 0xff, 0xe2, 0x90,
+    0x1, 0x40, 0x3f, 0xfd, 0xca, 0xb8, 0x2, 0x25,
+    0x5f, 0xe0, 0xe, 0xba, 0xa8, 0x2, 0x4a, 0xaf,
+    0xe2, 0x0, 0xff, 0xe7, 0x77, 0xfc, 0x1, 0x37,
+    0xff, 0xf1, 0x0, 0x7f, 0xff, 0xc0, 0x3f, 0xfe,
+    0x22, 0x38, 0x3, 0x8, 0xff, 0xf0, 0x43, 0xfb,
+    0xa0, 0x9, 0xbb, 0xbf, 0xf8, 0x24, 0x1, 0xff,
+    0xe0,
 
     /* U+00A4 "¤" */
-    0x2, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x34, 0x0, 0x2e, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef, 0x30,
-    0xaf, 0xff, 0x50, 0x0, 0x49, 0xbc, 0xb9, 0x50,
-    0x0, 0x3f, 0xff, 0xc0, 0xb, 0xff, 0xf6, 0x5e,
-    0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0xfd, 0x10,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xc5, 0x20, 0x14, 0xaf, 0xff, 0xfd, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x3,
-    0xdf, 0xfc, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0x60, 0x0,
-    0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x0,
-    0x1, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf4, 0x0, 0x2, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x0,
-    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf5, 0x0, 0x0, 0xef, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0x0,
-    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xe0, 0x0, 0x0, 0x3f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0,
-    0x0, 0xb, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xfd, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x82, 0x0, 0x1, 0x7e, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0xfb, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xf9, 0x0,
-    0x7f, 0xff, 0xa0, 0x2, 0x8c, 0xef, 0xfc, 0x93,
-    0x0, 0x8f, 0xff, 0xa0, 0x5f, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80,
-    0x6, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x79, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x40, 0xf, 0xfe, 0x29, 0xa0, 0x0, 0xb2,
+    0xd4, 0x3, 0xff, 0x86, 0x7b, 0x66, 0x10, 0x21,
+    0x4a, 0x1, 0x24, 0xde, 0x5c, 0xa8, 0x4, 0x78,
+    0x21, 0xe1, 0x48, 0x0, 0xa6, 0x5e, 0xb6, 0x43,
+    0x46, 0xaf, 0x84, 0xc0, 0x1, 0x68, 0x2, 0xd0,
+    0x1, 0x34, 0x20, 0x1f, 0x9e, 0xc0, 0x5, 0x82,
+    0x1, 0x5a, 0x0, 0x63, 0xad, 0xfe, 0xb5, 0x0,
+    0xc5, 0x82, 0x1, 0xc4, 0x1, 0x56, 0x29, 0x0,
+    0xa5, 0x61, 0x0, 0x4, 0x40, 0x1c, 0x4c, 0x0,
+    0xb5, 0x0, 0xf8, 0xf0, 0x40, 0xd8, 0x3, 0xac,
+    0x0, 0xe8, 0x1, 0xfc, 0x34, 0x0, 0xb0, 0xe,
+    0x70, 0x4, 0x80, 0x7f, 0xc8, 0x60, 0x42, 0x1,
+    0x8, 0x80, 0x84, 0x3, 0xff, 0x20, 0x1, 0x40,
+    0x23, 0x0, 0x30, 0x7, 0xff, 0x7, 0x80, 0x2,
+    0x1, 0x18, 0x1, 0xc0, 0x3f, 0xf8, 0x3c, 0x1,
+    0xe1, 0x10, 0x18, 0x7, 0xff, 0x4, 0xc0, 0xe,
+    0x1, 0x90, 0x0, 0xe0, 0x1f, 0xf1, 0x20, 0x9,
+    0x0, 0x69, 0x0, 0x41, 0x0, 0x7f, 0xb8, 0x1,
+    0x20, 0x1c, 0x68, 0x0, 0xf3, 0x0, 0xf8, 0x6c,
+    0xc0, 0x9c, 0x3, 0xd8, 0x0, 0x2c, 0x82, 0x0,
+    0x85, 0xfd, 0x0, 0xe, 0x1, 0xe6, 0x80, 0xc,
+    0xfb, 0xdb, 0xdc, 0x81, 0x0, 0x96, 0x40, 0x33,
+    0xc8, 0x1, 0x18, 0x2, 0x12, 0x10, 0x9, 0x18,
+    0x0, 0xd2, 0x0, 0x78, 0x0, 0x2d, 0xce, 0xb9,
+    0x88, 0x0, 0xdb, 0x2e, 0x5c, 0x0, 0xd4, 0x4,
+    0x0, 0x5a, 0x0, 0x14, 0x67, 0x7f, 0xb2, 0x4c,
+    0x1, 0xe, 0x0, 0x20, 0x59, 0x5a, 0x0, 0xff,
+    0xe1, 0xc4, 0x1a, 0x0, 0xd, 0x40, 0x1f, 0xfc,
+    0x57, 0x90, 0x0,
 
     /* U+00A5 "¥" */
-    0xc, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x30, 0x2f, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x80, 0x0, 0x5f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xc0,
-    0x0, 0x0, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70,
-    0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x30, 0x9, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfd, 0x5, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xfa, 0xef, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0xc, 0xff, 0x70, 0x80, 0x7f, 0xf1, 0x1f, 0xfe,
+    0x30, 0xe0, 0x0, 0xd0, 0x7, 0xff, 0xc, 0xa0,
+    0x0, 0xe6, 0x5, 0x40, 0x4, 0x70, 0xf, 0xfe,
+    0x17, 0x80, 0xe, 0x0, 0x25, 0x50, 0x2, 0xc,
+    0x3, 0xff, 0x49, 0x0, 0x38, 0x3, 0xa8, 0x80,
+    0x1c, 0x1, 0xff, 0x23, 0x0, 0x24, 0x80, 0x3d,
+    0xc0, 0x2, 0x90, 0xf, 0xe1, 0xa0, 0x2, 0xb0,
+    0x7, 0xc7, 0x0, 0x6, 0x50, 0xf, 0xd4, 0x20,
+    0x36, 0x1, 0xfc, 0xe6, 0x0, 0xb1, 0x0, 0xf3,
+    0xa0, 0x2, 0x84, 0x3, 0xfd, 0xa2, 0x3, 0x40,
+    0x1c, 0x70, 0x0, 0x74, 0x0, 0xff, 0x86, 0xc0,
+    0x8, 0xe0, 0x1b, 0x80, 0x7, 0x0, 0x1f, 0xfc,
+    0x15, 0x50, 0x2, 0xc, 0x1, 0x24, 0x0, 0xe0,
+    0xf, 0xfe, 0x1d, 0x10, 0x3, 0x81, 0x58, 0x1,
+    0x24, 0x1, 0xff, 0xc4, 0xe0, 0x1, 0x55, 0x80,
+    0x15, 0x80, 0x3f, 0xf8, 0xa6, 0xe0, 0x5, 0x10,
+    0x1b, 0x0, 0xff, 0xe0, 0xd7, 0xff, 0x38, 0x7,
+    0xf, 0x7f, 0xf0, 0x80, 0x7f, 0xf5, 0xab, 0xff,
+    0xdc, 0x1, 0x3f, 0xff, 0xc2, 0x1, 0xff, 0xf1,
+    0xaf, 0xff, 0x70, 0x4, 0xff, 0xff, 0x8, 0x7,
+    0xff, 0x5a, 0xbf, 0xfd, 0xc0, 0x13, 0xff, 0xfc,
+    0x20, 0x1f, 0xff, 0xf0, 0xf, 0xe0,
 
     /* U+00A6 "¦" */
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x16, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0x66, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
-    0x3f, 0xff,
+    0x3f, 0xf8, 0x3, 0xff, 0xc0, 0x53, 0x30, 0xb3,
+    0x40, 0x1f, 0xfc, 0xc1, 0x66, 0x8a, 0x66, 0x0,
+    0xff, 0xf0, 0x0,
 
     /* U+00A7 "§" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc9, 0x50,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0xa, 0xff, 0xff, 0xdc, 0xcd, 0xff,
-    0xff, 0xa0, 0x5, 0xff, 0xf7, 0x10, 0x0, 0x0,
-    0x39, 0xf3, 0x0, 0xbf, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x0, 0xd, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfd,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xb6, 0x10, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xe, 0xff,
-    0xa1, 0x4, 0x8c, 0xff, 0xff, 0x90, 0x6, 0xff,
-    0xc0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0x40, 0x9f,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0xa,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x5, 0xff, 0xb0,
-    0x8f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa,
-    0x2, 0xff, 0xfd, 0x61, 0x0, 0x0, 0xd, 0xff,
-    0x50, 0x5, 0xff, 0xff, 0xfc, 0x84, 0x4d, 0xff,
-    0xc0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x0, 0x0, 0x0, 0x16, 0xae, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8e,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xe0, 0x3, 0xd3, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfb, 0x0, 0xaf, 0xfc, 0x73,
-    0x10, 0x14, 0xbf, 0xff, 0x40, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x6, 0xdf,
-    0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0,
-    0x26, 0x9a, 0xba, 0x84, 0x0, 0x0, 0x0,
+    0x0, 0xe1, 0x7b, 0xef, 0xf7, 0x64, 0xa8, 0x7,
+    0xa3, 0xa1, 0x4, 0x0, 0x26, 0xd5, 0xee, 0x1,
+    0x53, 0x80, 0x44, 0x66, 0x20, 0xd, 0xa0, 0x5,
+    0x50, 0x2, 0x3b, 0x73, 0x1b, 0xf8, 0xc1, 0x20,
+    0xe, 0x0, 0x43, 0x88, 0x7, 0x1c, 0xe9, 0x80,
+    0x18, 0x0, 0x80, 0x1f, 0xc4, 0x1, 0xe5, 0x0,
+    0xff, 0xe0, 0xa0, 0x2, 0x10, 0x3, 0xff, 0x58,
+    0x0, 0x6f, 0x60, 0xc0, 0x3f, 0x8a, 0x80, 0x22,
+    0x7c, 0xfb, 0x61, 0x0, 0xe3, 0xb0, 0xf, 0x92,
+    0x79, 0xc0, 0x36, 0x88, 0x2f, 0x7d, 0xb9, 0x80,
+    0x51, 0x20, 0x6, 0x10, 0x3a, 0x10, 0x48, 0xcd,
+    0x50, 0x3, 0x20, 0x78, 0x2, 0x80, 0x3c, 0x54,
+    0xa0, 0xd, 0x3, 0x0, 0xff, 0xbc, 0x0, 0x40,
+    0x40, 0xb, 0x0, 0xfc, 0x60, 0x1, 0xa, 0x0,
+    0x16, 0xb0, 0x80, 0x75, 0x80, 0x3c, 0xa, 0x80,
+    0x5, 0x3d, 0x90, 0x88, 0xd2, 0x3, 0x50, 0x2,
+    0xe2, 0x0, 0x46, 0xf7, 0x62, 0x3, 0xd0, 0xc,
+    0x77, 0xd2, 0xa2, 0x1, 0xd6, 0x20, 0x1e, 0x16,
+    0xae, 0xc7, 0x10, 0x4, 0x28, 0x7, 0xf8, 0xe3,
+    0x8c, 0x1, 0xc0, 0x1f, 0xfc, 0x1f, 0x0, 0x28,
+    0x7, 0xff, 0x4, 0x40, 0x38, 0xf4, 0xc0, 0x3f,
+    0x58, 0x1, 0x40, 0x12, 0x59, 0x87, 0x31, 0x1,
+    0x4b, 0x60, 0x7, 0x80, 0x18, 0x0, 0x71, 0x9d,
+    0xfd, 0x68, 0x0, 0x74, 0x0, 0x64, 0x90, 0x7,
+    0xe1, 0x98, 0x0, 0xcd, 0xba, 0x96, 0x54, 0x57,
+    0xbe, 0x60, 0x8,
 
     /* U+00A8 "¨" */
-    0x5, 0x94, 0x0, 0x0, 0x79, 0x13, 0xff, 0xf1,
-    0x0, 0x8f, 0xfc, 0x5f, 0xff, 0x30, 0x9, 0xff,
-    0xe0, 0xaf, 0x90, 0x0, 0x2d, 0xe5,
+    0x5, 0x94, 0x0, 0xcf, 0x22, 0x74, 0xd6, 0x20,
+    0x8, 0x83, 0x6b, 0x0, 0x44, 0x0, 0x10, 0x1,
+    0x2a, 0x81, 0x8c, 0x1, 0x64, 0x36,
 
     /* U+00A9 "©" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xca, 0x9a, 0xcf, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xb4,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xf6, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf5, 0x0, 0x0, 0x2, 0xfd, 0x10, 0x0,
-    0x4, 0xad, 0xfe, 0xc7, 0x10, 0x0, 0x1d, 0xf1,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x3f, 0xa0, 0x0, 0x3f,
-    0x90, 0x0, 0x1e, 0xff, 0xe9, 0x67, 0xbf, 0xff,
-    0x40, 0x0, 0xaf, 0x20, 0x9, 0xf2, 0x0, 0xb,
-    0xff, 0xa0, 0x0, 0x0, 0x4f, 0xb1, 0x0, 0x3,
-    0xf8, 0x0, 0xed, 0x0, 0x3, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x20, 0x0, 0x0, 0xe, 0xc0, 0x1f,
-    0x90, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0x3, 0xf7, 0x0, 0xa,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xf1, 0x4f, 0x60, 0x0, 0xcf, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0x13,
-    0xf7, 0x0, 0xa, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xf1, 0x1f, 0x90, 0x0,
-    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0xed, 0x0, 0x2, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0xf, 0xc0,
-    0x9, 0xf2, 0x0, 0xb, 0xff, 0xa0, 0x0, 0x0,
-    0x4f, 0xb1, 0x0, 0x5, 0xf7, 0x0, 0x3f, 0x90,
-    0x0, 0x1e, 0xff, 0xe9, 0x77, 0xbf, 0xff, 0x40,
-    0x0, 0xcf, 0x10, 0x0, 0xbf, 0x30, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x5f, 0x90,
-    0x0, 0x2, 0xfd, 0x10, 0x0, 0x4, 0xad, 0xfe,
-    0xc7, 0x10, 0x0, 0x2e, 0xe1, 0x0, 0x0, 0x6,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xb4, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xca, 0x9a, 0xcf, 0xfe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xfc, 0x2d, 0x5b, 0xff, 0x6d, 0x30, 0x80,
+    0x7f, 0xf0, 0x86, 0x7a, 0x54, 0x55, 0x94, 0x56,
+    0x7a, 0x44, 0x3, 0xfe, 0x5f, 0x64, 0xbf, 0xca,
+    0x9a, 0xcf, 0xb4, 0x6f, 0x40, 0xf, 0xe7, 0xa0,
+    0xbb, 0x20, 0x7, 0xc9, 0x76, 0xb, 0x60, 0xf,
+    0x9a, 0xf, 0xd0, 0x3, 0xfe, 0x4f, 0x39, 0x50,
+    0xe, 0x29, 0x2d, 0x10, 0x9, 0x2b, 0x7f, 0xb1,
+    0xc4, 0x0, 0x3a, 0x54, 0x20, 0x1a, 0x43, 0x84,
+    0x0, 0x39, 0x6a, 0x40, 0x27, 0x1e, 0xa0, 0x1,
+    0xe0, 0xb0, 0x8, 0xd1, 0x8c, 0x0, 0x3e, 0x60,
+    0x2d, 0x30, 0x80, 0x34, 0x80, 0x3, 0x55, 0x10,
+    0x2, 0x82, 0xc0, 0x2a, 0x10, 0x5e, 0x96, 0x7b,
+    0xb0, 0x22, 0x80, 0x52, 0x14, 0x0, 0x72, 0x20,
+    0x0, 0xd0, 0xe, 0x80, 0x39, 0x36, 0xc4, 0x2,
+    0x31, 0x40, 0x11, 0x20, 0x5, 0x60, 0x8, 0x0,
+    0xf8, 0x80, 0x3c, 0xa6, 0x4, 0x1c, 0x1, 0x10,
+    0x1, 0x0, 0x3f, 0xf8, 0x44, 0x2, 0xe0, 0x20,
+    0x13, 0x0, 0x7f, 0xf2, 0x1c, 0x4, 0x2, 0x60,
+    0xf, 0xfe, 0x41, 0x7, 0x0, 0x44, 0x0, 0x40,
+    0xf, 0xfe, 0x12, 0x80, 0x8c, 0x80, 0x15, 0x0,
+    0x20, 0x3, 0xe2, 0x0, 0xf1, 0x98, 0x0, 0xe4,
+    0x40, 0x1, 0x20, 0x1d, 0x0, 0x72, 0x6d, 0x88,
+    0x4, 0xa1, 0x60, 0xa, 0xb, 0x0, 0xa8, 0x41,
+    0x7a, 0x5d, 0xd7, 0x60, 0x45, 0x0, 0xa4, 0x18,
+    0x0, 0x68, 0xc6, 0x0, 0x1f, 0x30, 0x16, 0x88,
+    0x20, 0xd, 0x20, 0x1, 0x4d, 0x84, 0x2, 0x90,
+    0xe1, 0x0, 0xe, 0x5a, 0x90, 0x9, 0xc7, 0xa8,
+    0x0, 0xac, 0x60, 0x3, 0x14, 0x96, 0x88, 0x4,
+    0x95, 0xbf, 0xd8, 0xe2, 0x0, 0x2c, 0x1d, 0x10,
+    0xe, 0x68, 0x3c, 0x40, 0xf, 0xf9, 0x74, 0x68,
+    0xc0, 0x3e, 0x7a, 0x3b, 0xb2, 0x0, 0x7c, 0xb9,
+    0x45, 0x8a, 0x1, 0xfc, 0xbe, 0xc9, 0x7f, 0x95,
+    0x35, 0x9f, 0x44, 0xfa, 0x60, 0x1f, 0xf0, 0xcf,
+    0x4a, 0x8a, 0xb2, 0x8a, 0xd7, 0x40, 0x7, 0xc0,
 
     /* U+00AA "ª" */
-    0x0, 0x6a, 0xef, 0xfd, 0x91, 0x0, 0x1e, 0xff,
-    0xfe, 0xff, 0xff, 0x30, 0xc, 0xa4, 0x0, 0x5,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf2, 0x1, 0x9d,
-    0xff, 0xff, 0xff, 0xf3, 0x2e, 0xfe, 0xa8, 0x88,
-    0xaf, 0xf3, 0x8f, 0xe1, 0x0, 0x0, 0x4f, 0xf3,
-    0xaf, 0xc0, 0x0, 0x0, 0x7f, 0xf3, 0x6f, 0xf7,
-    0x10, 0x28, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xff,
-    0x9f, 0xf3, 0x0, 0x26, 0x88, 0x61, 0x9, 0x91,
+    0x0, 0x35, 0x77, 0xfb, 0x64, 0x40, 0x3, 0xd2,
+    0xa2, 0x20, 0x26, 0xe3, 0x1, 0x25, 0xbf, 0xef,
+    0xa0, 0x7, 0x80, 0x32, 0x90, 0x2, 0x57, 0x3,
+    0x10, 0xf, 0xda, 0x0, 0x30, 0x19, 0xdf, 0xfd,
+    0x40, 0x1, 0x2f, 0x63, 0x57, 0x79, 0x40, 0x2a,
+    0x11, 0x7d, 0x44, 0x5c, 0x1, 0x10, 0x10, 0x80,
+    0x63, 0x0, 0xb0, 0xd, 0xc4, 0xa, 0x20, 0x1,
+    0x33, 0x2, 0x3b, 0xf5, 0xd8, 0x3, 0x4e, 0xcb,
+    0xba, 0x7a, 0x59, 0x84,
 
     /* U+00AB "«" */
-    0x0, 0x0, 0x3, 0x99, 0x70, 0x0, 0x49, 0x96,
-    0x0, 0x0, 0x1e, 0xff, 0x30, 0x2, 0xff, 0xf2,
-    0x0, 0x0, 0xbf, 0xf7, 0x0, 0xc, 0xff, 0x50,
-    0x0, 0x8, 0xff, 0xb0, 0x0, 0x9f, 0xf9, 0x0,
-    0x0, 0x4f, 0xfe, 0x10, 0x5, 0xff, 0xd0, 0x0,
-    0x1, 0xef, 0xf3, 0x0, 0x2f, 0xff, 0x20, 0x0,
-    0xc, 0xff, 0x70, 0x0, 0xdf, 0xf6, 0x0, 0x0,
-    0x2f, 0xff, 0x20, 0x3, 0xff, 0xf1, 0x0, 0x0,
-    0x5, 0xff, 0xd0, 0x0, 0x7f, 0xfc, 0x0, 0x0,
-    0x0, 0x9f, 0xfa, 0x0, 0xb, 0xff, 0x80, 0x0,
-    0x0, 0xc, 0xff, 0x60, 0x1, 0xdf, 0xf4, 0x0,
-    0x0, 0x2, 0xef, 0xf2, 0x0, 0x3f, 0xfe, 0x10,
-    0x0, 0x0, 0x4f, 0xfd, 0x0, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0xaf, 0xf8,
+    0x0, 0xe3, 0x99, 0x38, 0x4, 0x93, 0x26, 0x0,
+    0xc3, 0xac, 0xc4, 0x0, 0x15, 0xb3, 0x10, 0x3,
+    0x50, 0x84, 0x18, 0x3, 0x80, 0x14, 0x40, 0x14,
+    0x20, 0x23, 0x80, 0x24, 0xc1, 0x94, 0x2, 0x47,
+    0x1, 0xa0, 0x2, 0xb0, 0x14, 0x80, 0x43, 0x40,
+    0xd, 0x10, 0x2a, 0x0, 0x78, 0x6, 0xd1, 0x8,
+    0x30, 0x7, 0x80, 0x24, 0x80, 0x22, 0x30, 0x2,
+    0x80, 0xc, 0x80, 0xe, 0x1, 0x8a, 0x80, 0x1e,
+    0x0, 0x38, 0x0, 0x68, 0x7, 0x2b, 0x1, 0x50,
+    0x1, 0xd0, 0xe, 0x0, 0x3a, 0x4c, 0x15, 0x80,
+    0x14, 0x40, 0xe8, 0x1, 0xdc, 0x21, 0x24, 0x3,
+    0xc0, 0xa, 0x10, 0xc, 0x54, 0x0, 0xf0, 0x1,
+    0xc8, 0xe, 0x80, 0x72, 0x38, 0x15, 0x0, 0x19,
+    0x40, 0xe0,
 
     /* U+00AC "¬" */
-    0x7c, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
-    0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x48, 0x84,
+    0x7c, 0xcf, 0xfe, 0x1b, 0x71, 0x9f, 0xff, 0xf,
+    0x80, 0x3f, 0xf8, 0xb3, 0xff, 0xff, 0x9c, 0x3,
+    0xff, 0xfe, 0x1, 0xff, 0xce, 0xc7, 0x76, 0x0,
 
     /* U+00AD "­" */
-    0xef, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xef, 0xff, 0xd6, 0x20, 0x1f, 0xfc, 0x70,
 
     /* U+00AE "®" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0xad, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xca, 0x9a, 0xcf, 0xff, 0x91,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xb4,
-    0x0, 0x0, 0x0, 0x4, 0xbf, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xfe, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xf6, 0x0, 0x0, 0x0, 0x6,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xf5, 0x0, 0x0, 0x2, 0xfd, 0x10, 0xa,
-    0xff, 0xff, 0xff, 0xda, 0x30, 0x0, 0x1d, 0xf1,
-    0x0, 0x0, 0xbf, 0x30, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x3f, 0xa0, 0x0, 0x3f,
-    0x90, 0x0, 0xa, 0xfb, 0x0, 0x1, 0x4c, 0xff,
-    0x40, 0x0, 0xaf, 0x20, 0x9, 0xf2, 0x0, 0x0,
-    0xaf, 0xb0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x3,
-    0xf8, 0x0, 0xed, 0x0, 0x0, 0xa, 0xfb, 0x0,
-    0x0, 0x0, 0x8f, 0xd0, 0x0, 0xe, 0xc0, 0x1f,
-    0x90, 0x0, 0x0, 0xaf, 0xb0, 0x0, 0x0, 0x8,
-    0xfd, 0x0, 0x0, 0xbf, 0x3, 0xf7, 0x0, 0x0,
-    0xa, 0xfb, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x9, 0xf1, 0x4f, 0x60, 0x0, 0x0, 0xaf, 0xb0,
-    0x0, 0x3, 0xcf, 0xf4, 0x0, 0x0, 0x9f, 0x13,
-    0xf7, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x9, 0xf1, 0x1f, 0x90, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xcf, 0x0, 0xed, 0x0, 0x0, 0xa, 0xfc,
-    0x0, 0x1, 0xef, 0x80, 0x0, 0x0, 0xf, 0xc0,
-    0x9, 0xf2, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x5,
-    0xff, 0x20, 0x0, 0x5, 0xf7, 0x0, 0x3f, 0x90,
-    0x0, 0xa, 0xfc, 0x0, 0x0, 0xa, 0xfc, 0x0,
-    0x0, 0xcf, 0x10, 0x0, 0xbf, 0x30, 0x0, 0xaf,
-    0xc0, 0x0, 0x0, 0x1e, 0xf7, 0x0, 0x5f, 0x90,
-    0x0, 0x2, 0xfd, 0x10, 0x6, 0x96, 0x0, 0x0,
-    0x0, 0x49, 0x80, 0x2e, 0xe1, 0x0, 0x0, 0x6,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xfd, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xef, 0xb4, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xd3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9f, 0xff, 0xca, 0x9a, 0xcf, 0xfe,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x16, 0xad, 0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xfc, 0x2d, 0x5b, 0xff, 0x6d, 0x30, 0x80,
+    0x7f, 0xf0, 0x86, 0x7a, 0x54, 0x55, 0x94, 0x56,
+    0x7a, 0x44, 0x3, 0xfe, 0x5f, 0x64, 0xbf, 0xca,
+    0x9a, 0xcf, 0xb4, 0x6f, 0x40, 0xf, 0xe7, 0xa0,
+    0xbb, 0x20, 0x7, 0xc9, 0x76, 0xb, 0x60, 0xf,
+    0x9a, 0xf, 0xd0, 0x3, 0xfe, 0x4f, 0x39, 0x50,
+    0xe, 0x29, 0x2d, 0x10, 0xaf, 0xff, 0x6d, 0x18,
+    0x0, 0x74, 0xa8, 0x40, 0x34, 0x87, 0x8, 0x7,
+    0xf1, 0x2e, 0x38, 0x0, 0x78, 0x2c, 0x2, 0x34,
+    0x63, 0x0, 0xe4, 0xff, 0xba, 0xcc, 0x21, 0x0,
+    0x6, 0xaa, 0x20, 0x5, 0x5, 0x80, 0x7f, 0x85,
+    0x30, 0x83, 0xc0, 0x29, 0xa, 0x0, 0x39, 0x10,
+    0x3, 0xff, 0x82, 0xa0, 0xc0, 0x11, 0x8a, 0x0,
+    0x89, 0x0, 0x3f, 0xf9, 0x2a, 0x60, 0x41, 0xc0,
+    0x1f, 0xfc, 0x25, 0x6, 0x0, 0xc4, 0x2, 0xe0,
+    0x20, 0x1f, 0xf8, 0xf0, 0x83, 0xc0, 0x3e, 0x70,
+    0x10, 0xf, 0x93, 0xff, 0x61, 0x83, 0xa0, 0x7,
+    0xc4, 0x1c, 0x1, 0xff, 0xc2, 0xb8, 0x0, 0xe5,
+    0x1, 0x19, 0x0, 0x3e, 0x3f, 0xfb, 0x84, 0x30,
+    0x3, 0xc6, 0x60, 0x3, 0x91, 0x0, 0x3f, 0xc3,
+    0x60, 0xe4, 0x1, 0x94, 0x2c, 0x1, 0x41, 0x60,
+    0x1f, 0xf2, 0xa8, 0x38, 0x3, 0x48, 0x30, 0x0,
+    0xd1, 0x8c, 0x3, 0xfe, 0xb1, 0x37, 0x0, 0x29,
+    0xb0, 0x80, 0x52, 0x1c, 0x20, 0xc, 0x6a, 0x0,
+    0xe1, 0xa6, 0xf0, 0x2b, 0x18, 0x0, 0xc5, 0x25,
+    0xa2, 0xd, 0x2c, 0x1, 0xe4, 0x98, 0x2c, 0x1d,
+    0x10, 0xe, 0x68, 0x3c, 0x40, 0xf, 0xf9, 0x74,
+    0x68, 0xc0, 0x3e, 0x7a, 0x3b, 0xb2, 0x0, 0x7c,
+    0xb9, 0x45, 0x8a, 0x1, 0xfc, 0xbe, 0xc9, 0x7f,
+    0x95, 0x35, 0x9f, 0x44, 0xfa, 0x60, 0x1f, 0xf0,
+    0xcf, 0x4a, 0x8a, 0xb2, 0x8a, 0xd7, 0x40, 0x7,
+    0xc0,
 
     /* U+00AF "¯" */
-    0x2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x11, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0,
+    0x2, 0x2f, 0xf8, 0x45, 0xbb, 0xff, 0x58, 0x7,
+    0xff, 0x4,
 
     /* U+00B0 "°" */
-    0x0, 0x1, 0x7b, 0xdb, 0x71, 0x0, 0x0, 0x4,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x2, 0xff, 0x92,
-    0x2, 0x8f, 0xf3, 0x0, 0xcf, 0x70, 0x0, 0x0,
-    0x7f, 0xd0, 0x2f, 0xe0, 0x0, 0x0, 0x0, 0xef,
-    0x34, 0xfa, 0x0, 0x0, 0x0, 0xa, 0xf6, 0x5f,
-    0xa0, 0x0, 0x0, 0x0, 0xaf, 0x62, 0xfe, 0x0,
-    0x0, 0x0, 0xd, 0xf4, 0xd, 0xf6, 0x0, 0x0,
-    0x6, 0xfe, 0x0, 0x4f, 0xf7, 0x10, 0x7, 0xff,
-    0x50, 0x0, 0x6f, 0xff, 0xef, 0xff, 0x70, 0x0,
-    0x0, 0x29, 0xdf, 0xea, 0x30, 0x0,
+    0x0, 0x85, 0xef, 0x6d, 0xc4, 0x3, 0x93, 0xe1,
+    0x9, 0x23, 0x94, 0x2, 0x2b, 0x16, 0xdf, 0xd7,
+    0xa, 0x30, 0x7, 0x4, 0x49, 0x1, 0x44, 0x3,
+    0x80, 0x8c, 0x5c, 0x3, 0x9c, 0x48, 0xd8, 0x10,
+    0x3, 0xe4, 0x5, 0x10, 0xf, 0xfc, 0xe0, 0x80,
+    0x1f, 0x38, 0x11, 0x42, 0xc0, 0x1c, 0xc4, 0x28,
+    0x12, 0x12, 0xe2, 0x0, 0x79, 0xb, 0x0, 0x24,
+    0x84, 0x77, 0x3e, 0x2, 0x14, 0x2, 0x6d, 0x62,
+    0x11, 0x2e, 0x38, 0x0,
 
     /* U+00B1 "±" */
-    0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x7c, 0xcc, 0xcc, 0xcf, 0xff,
-    0xcc, 0xcc, 0xcc, 0x69, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xd7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8,
+    0x0, 0xfb, 0xfe, 0x0, 0xff, 0xff, 0x80, 0x7f,
+    0xf1, 0x5f, 0x33, 0xc0, 0x16, 0x67, 0x9b, 0x8c,
+    0xfc, 0x1, 0x19, 0xfb, 0x80, 0x3f, 0xf8, 0xb3,
+    0xff, 0xe0, 0xb, 0xff, 0xd0, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xe2, 0xee, 0xc0, 0x1f, 0xfc, 0x22,
+    0x28, 0x3, 0xff, 0xba, 0xfb, 0xbf, 0xfc, 0x37,
+    0xe2, 0x2f, 0xfe, 0x1f, 0x80, 0x7f, 0xf1, 0x40,
 
     /* U+00B2 "²" */
-    0x0, 0x5a, 0xdf, 0xfe, 0xb5, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0xaf, 0xf9, 0x43,
-    0x35, 0xcf, 0xf8, 0x0, 0x82, 0x0, 0x0, 0x0,
-    0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xf8, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xf4, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xe3, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xe3, 0x11, 0x11, 0x11, 0x14, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0,
+    0x0, 0x2d, 0x6f, 0xfb, 0xad, 0x40, 0x22, 0xda,
+    0x52, 0x0, 0xa, 0x55, 0x80, 0x20, 0x81, 0xaf,
+    0x31, 0x46, 0x9, 0x1, 0x4f, 0xb2, 0x86, 0x65,
+    0xc2, 0x6, 0x0, 0x41, 0x0, 0x79, 0x0, 0x40,
+    0x3f, 0xc8, 0x6, 0x1, 0xfd, 0x4, 0x10, 0x1,
+    0xfa, 0x5c, 0x1d, 0x0, 0x3e, 0xa6, 0x7, 0x80,
+    0xf, 0xe, 0x28, 0x4c, 0x0, 0x78, 0xb0, 0xc2,
+    0xd8, 0x3, 0xc7, 0x84, 0x38, 0x80, 0x1e, 0x5c,
+    0x11, 0x69, 0x8, 0xf9, 0x28, 0x0, 0x39, 0xdd,
+    0xea, 0x10, 0xf, 0xfc,
 
     /* U+00B3 "³" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x11,
-    0x11, 0x11, 0x1b, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xfb, 0x82,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x1, 0x26, 0xdf, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfb, 0x2, 0x60, 0x0,
-    0x0, 0x0, 0x2f, 0xf8, 0xa, 0xfd, 0x84, 0x32,
-    0x48, 0xef, 0xf2, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x17, 0xbe, 0xff, 0xec, 0x71,
-    0x0,
+    0x9, 0xff, 0xff, 0x80, 0x3f, 0xf8, 0x22, 0x0,
+    0x9e, 0xef, 0x90, 0x1, 0xa0, 0x10, 0x8f, 0xa1,
+    0x2, 0xcc, 0x3, 0xf4, 0x30, 0x52, 0x0, 0x7e,
+    0x77, 0x5, 0x28, 0x7, 0xe3, 0x80, 0x7, 0x41,
+    0x0, 0x7c, 0xc0, 0x12, 0x3e, 0xb0, 0x7, 0x97,
+    0xfb, 0x64, 0x82, 0x4c, 0x3, 0xe1, 0x26, 0xc0,
+    0x5, 0x0, 0x7f, 0x84, 0x80, 0x80, 0x98, 0x3,
+    0xe2, 0x20, 0x18, 0x44, 0xec, 0x21, 0x92, 0x46,
+    0x0, 0x28, 0x8, 0x9, 0xef, 0x36, 0xdc, 0x45,
+    0x64, 0x11, 0xd0, 0x82, 0x0, 0x13, 0x8f, 0x40,
 
     /* U+00B4 "´" */
-    0x0, 0x0, 0x28, 0x88, 0x70, 0x0, 0x2, 0xef,
-    0xfd, 0x30, 0x0, 0x3f, 0xff, 0xa0, 0x0, 0x4,
-    0xff, 0xf6, 0x0, 0x0, 0x6f, 0xfd, 0x20, 0x0,
-    0x0,
+    0x0, 0xc5, 0x11, 0x38, 0x6, 0x2c, 0x77, 0x2a,
+    0x0, 0x47, 0xa2, 0xb, 0xa6, 0x0, 0x4c, 0x0,
+    0x4d, 0x0, 0x4d, 0x60, 0x5a, 0xc0, 0x18,
 
     /* U+00B5 "µ" */
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x3b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf3, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x3b, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x3b,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf3, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x3b, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf3, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x3b, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf3, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x3b, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf3, 0xbf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x3b, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf3, 0xbf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0x3b, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xf3,
-    0xbf, 0xff, 0xff, 0xff, 0xde, 0xff, 0xff, 0x9f,
-    0xff, 0x3b, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0xff, 0xf3, 0xbf, 0xfb, 0x4, 0xae, 0xff,
-    0xd9, 0x30, 0xf, 0xff, 0x3b, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x80, 0x7f, 0x8f, 0xfe, 0x30, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xae,
+    0xe0, 0x1f, 0x38, 0x7, 0xf8, 0x80, 0x3e, 0x30,
+    0xf, 0xf6, 0x0, 0x7e, 0x40, 0xf, 0xc2, 0xa0,
+    0x1f, 0xa4, 0x3, 0xe1, 0xd0, 0xf, 0xe2, 0xd4,
+    0x0, 0xcb, 0x86, 0x1, 0xfe, 0x2b, 0xfd, 0xef,
+    0xa2, 0x6, 0x0, 0xf8, 0xd0, 0x2, 0x21, 0x0,
+    0x9a, 0x40, 0x3e, 0x7b, 0xb2, 0x88, 0x0, 0x9b,
+    0x24, 0x3, 0xfc, 0x95, 0xdf, 0xed, 0x93, 0x0,
+    0x7f, 0xc6, 0x1, 0xff, 0xff, 0x0, 0xff, 0xed,
+    0x80,
 
     /* U+00B6 "¶" */
-    0x0, 0x0, 0x39, 0xce, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0xfa, 0xaa, 0xaa, 0xcf, 0xf8, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x6,
-    0xef, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x4, 0x79, 0xef, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
-    0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0, 0x5f, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x0, 0x0,
-    0x5f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x8a, 0xa0,
-    0x0, 0x0, 0x3a, 0xa5,
+    0x0, 0xc7, 0x39, 0xdf, 0xff, 0xf4, 0x0, 0x6,
+    0xb1, 0x8c, 0x40, 0x3f, 0xf8, 0x23, 0x8a, 0x1,
+    0xf2, 0xaf, 0x18, 0x6, 0x82, 0x0, 0xfd, 0x55,
+    0xd2, 0x1, 0x98, 0x3, 0xff, 0x8c, 0x60, 0x1f,
+    0xfc, 0x77, 0x0, 0xff, 0xe3, 0xb8, 0x7, 0xff,
+    0x1c, 0xc4, 0x3, 0xff, 0x8f, 0x20, 0x1f, 0xfc,
+    0x77, 0x50, 0xf, 0xfe, 0x3d, 0x48, 0x80, 0x7f,
+    0xf1, 0x9b, 0xae, 0x18, 0x40, 0x3f, 0xf8, 0x88,
+    0xf2, 0x60, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xc7, 0x55, 0x80, 0x39, 0x95, 0x5a,
 
     /* U+00B7 "·" */
-    0x7, 0xcb, 0x30, 0x5f, 0xff, 0xe0, 0x9f, 0xff,
-    0xf2, 0x6f, 0xff, 0xf0, 0x9, 0xed, 0x40,
+    0x7, 0xcb, 0x30, 0x58, 0x34, 0xd0, 0xc0, 0x8,
+    0x4b, 0xc0, 0x31, 0x33, 0x4, 0xac, 0x0,
 
     /* U+00B8 "¸" */
-    0x0, 0x5, 0xfa, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x0, 0xd, 0xfe, 0xa2, 0x0, 0x0, 0x78,
-    0xef, 0xe0, 0x0, 0x0, 0x2, 0xff, 0x40, 0x41,
-    0x0, 0x6f, 0xf4, 0xe, 0xff, 0xff, 0xfc, 0x1,
-    0x8d, 0xfe, 0xc7, 0x0,
+    0x0, 0x97, 0xe8, 0x3, 0xd8, 0x1e, 0x1, 0xe4,
+    0xb, 0xa2, 0x0, 0xd4, 0xe0, 0xb8, 0x1, 0x9e,
+    0x30, 0x5, 0x1, 0x4, 0x0, 0x80, 0x1a, 0xbb,
+    0xfd, 0x20, 0x68, 0x2c, 0x40, 0x27, 0x18, 0x0,
 
     /* U+00B9 "¹" */
-    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x1, 0x11, 0x1e, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x1, 0x11, 0x1e, 0xfa, 0x11, 0x10, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xf5,
+    0xc, 0xff, 0xea, 0x0, 0xff, 0xe2, 0xef, 0x74,
+    0x20, 0x1f, 0x8, 0xe0, 0xf, 0xff, 0xf8, 0x7,
+    0xff, 0x44, 0x47, 0x0, 0x42, 0x30, 0xf, 0x76,
+    0x10, 0x5e, 0xe9, 0x40, 0x3f, 0xf0,
 
     /* U+00BA "º" */
-    0x0, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0xb, 0xff, 0x82,
-    0x12, 0x8f, 0xfb, 0x4, 0xff, 0x60, 0x0, 0x0,
-    0x5f, 0xf5, 0xaf, 0xd0, 0x0, 0x0, 0x0, 0xcf,
-    0xac, 0xf9, 0x0, 0x0, 0x0, 0x8, 0xfd, 0xcf,
-    0x90, 0x0, 0x0, 0x0, 0x9f, 0xda, 0xfd, 0x0,
-    0x0, 0x0, 0xc, 0xfa, 0x4f, 0xf6, 0x0, 0x0,
-    0x6, 0xff, 0x40, 0xbf, 0xf9, 0x31, 0x39, 0xff,
-    0xb0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xb1, 0x0,
-    0x0, 0x5b, 0xef, 0xeb, 0x50, 0x0,
+    0x0, 0x96, 0xfb, 0xfa, 0xd4, 0x3, 0xd, 0xd2,
+    0x8, 0xa, 0x55, 0x88, 0x2, 0x90, 0x1f, 0x7b,
+    0x5c, 0x12, 0x81, 0x10, 0x13, 0x4, 0x25, 0x14,
+    0x8, 0xbc, 0x4, 0xc0, 0x1c, 0xa6, 0x1e, 0xc0,
+    0x80, 0x1f, 0x20, 0x38, 0x7, 0xf8, 0x40, 0xc,
+    0x8, 0x1, 0xf2, 0x83, 0xf0, 0x13, 0x0, 0x73,
+    0x18, 0x72, 0x20, 0x26, 0x46, 0x27, 0x32, 0x4,
+    0x40, 0x5a, 0x3, 0x67, 0x63, 0x2, 0x50, 0x5,
+    0x74, 0x82, 0x2, 0x95, 0x62, 0x0,
 
     /* U+00BB "»" */
-    0x59, 0x95, 0x0, 0x6, 0x99, 0x40, 0x0, 0x0,
-    0x1e, 0xff, 0x30, 0x1, 0xef, 0xf2, 0x0, 0x0,
-    0x3, 0xff, 0xe1, 0x0, 0x4f, 0xfd, 0x0, 0x0,
-    0x0, 0x7f, 0xfb, 0x0, 0x8, 0xff, 0xa0, 0x0,
-    0x0, 0xb, 0xff, 0x80, 0x0, 0xcf, 0xf6, 0x0,
-    0x0, 0x1, 0xef, 0xf4, 0x0, 0x2e, 0xff, 0x30,
-    0x0, 0x0, 0x4f, 0xfe, 0x10, 0x5, 0xff, 0xd1,
-    0x0, 0x0, 0xe, 0xff, 0x50, 0x1, 0xff, 0xf3,
-    0x0, 0x0, 0xaf, 0xf9, 0x0, 0xb, 0xff, 0x80,
-    0x0, 0x6, 0xff, 0xc0, 0x0, 0x7f, 0xfb, 0x0,
-    0x0, 0x3f, 0xfe, 0x20, 0x4, 0xff, 0xe1, 0x0,
-    0x0, 0xdf, 0xf4, 0x0, 0x1e, 0xff, 0x30, 0x0,
-    0xa, 0xff, 0x80, 0x0, 0xbf, 0xf7, 0x0, 0x0,
-    0x6f, 0xfc, 0x0, 0x7, 0xff, 0xa0, 0x0, 0x0,
+    0x59, 0x92, 0x80, 0x4d, 0x32, 0x40, 0xe, 0x47,
+    0x6a, 0x30, 0x3, 0xb9, 0xac, 0x80, 0x30, 0xe8,
+    0x3, 0x44, 0x6, 0x80, 0x1e, 0x1, 0xc7, 0x0,
+    0x34, 0x0, 0x47, 0x2, 0xa0, 0xe, 0x74, 0x4,
+    0x80, 0x4, 0x18, 0x2b, 0x0, 0x75, 0x8, 0x3a,
+    0x0, 0x38, 0x42, 0x4c, 0x3, 0xd, 0x0, 0x28,
+    0x40, 0xac, 0x1, 0xc2, 0x1, 0x90, 0x40, 0x50,
+    0x0, 0x80, 0x2, 0x20, 0x6, 0xa1, 0x6, 0x50,
+    0x5, 0x0, 0x1c, 0xc0, 0x26, 0x50, 0x39, 0x0,
+    0x3a, 0x2, 0x40, 0x4, 0x72, 0x3, 0xc0, 0x4,
+    0x80, 0x1a, 0x0, 0xdc, 0x0, 0xa2, 0x1, 0xa0,
+    0x6, 0x88, 0x5, 0x44, 0xe, 0x80, 0xa, 0x10,
+    0x83, 0x0, 0x99, 0x40, 0xe0, 0x0, 0xe8, 0xa,
+    0xe0, 0x18,
 
     /* U+00BC "¼" */
-    0x0, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0x0, 0x0, 0x0, 0x2, 0x66, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xa0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0x30, 0x0, 0x0, 0x0, 0xdf, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0xaf,
-    0xf2, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x1, 0xef, 0xc0, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0xaf, 0xf2, 0x0, 0x0,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x30, 0x3, 0x31,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xfe, 0x10, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xa0,
-    0x0, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0xdf,
-    0xe1, 0x11, 0x11, 0xff, 0x61, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x88, 0x20, 0x0,
+    0x0, 0x8, 0xf0, 0x7, 0xff, 0x14, 0x44, 0x1,
+    0xfe, 0xce, 0xee, 0xa0, 0xf, 0xfe, 0x1c, 0x77,
+    0xc, 0x3, 0xff, 0xa4, 0x8e, 0x10, 0x60, 0x1f,
+    0xd9, 0xff, 0x8, 0x7, 0xff, 0xc, 0x68, 0xd,
+    0xc0, 0x3f, 0xfa, 0x56, 0x21, 0xc0, 0x1f, 0xfd,
+    0x25, 0x50, 0x49, 0x0, 0x7f, 0xf4, 0x46, 0xc1,
+    0x58, 0x3, 0xff, 0xa5, 0x42, 0x2b, 0x0, 0xff,
+    0xe9, 0x3a, 0x5, 0x8, 0x7, 0xff, 0x44, 0xa0,
+    0x19, 0x0, 0x3f, 0xfa, 0x5e, 0x5, 0x20, 0x1e,
+    0x26, 0x61, 0x0, 0x7f, 0xf2, 0x20, 0x83, 0x80,
+    0x3e, 0xf9, 0xb2, 0x0, 0xff, 0xe3, 0xa3, 0x84,
+    0x18, 0x7, 0xa8, 0x83, 0xc0, 0x38, 0x7f, 0xf0,
+    0x82, 0xff, 0xca, 0x0, 0x1a, 0x3, 0x70, 0xf,
+    0x32, 0x84, 0x90, 0x7, 0xff, 0x1e, 0xc4, 0x38,
+    0x3, 0xc5, 0x20, 0xac, 0x1, 0xe1, 0xff, 0xff,
+    0x28, 0x2a, 0x82, 0x48, 0x3, 0xde, 0x5, 0x40,
+    0x1f, 0xfc, 0x71, 0xa0, 0x56, 0x0, 0xf5, 0x10,
+    0x70, 0x0, 0xcc, 0x20, 0x1f, 0xfc, 0x3a, 0x1,
+    0xb0, 0xf, 0x2a, 0x82, 0x4c, 0x1, 0x98, 0x40,
+    0xf, 0xfe, 0x13, 0xa0, 0x50, 0x80, 0x71, 0x50,
+    0x2b, 0x0, 0x7f, 0xf1, 0xca, 0x1, 0x90, 0x3,
+    0xde, 0x3, 0x62, 0x38, 0x0, 0x62, 0x20, 0xf,
+    0xfb, 0xc0, 0xa4, 0x3, 0xcc, 0x40, 0x3d, 0xdc,
+    0x0, 0x9e, 0xe2, 0x0, 0x7f, 0x41, 0x7, 0x0,
+    0x7c, 0x20, 0x1f, 0xfc, 0xa4, 0x70, 0x83, 0x0,
+    0xf9, 0xff, 0xfe, 0xd0, 0x5, 0x7f, 0x90, 0x3,
+    0xe1, 0xa0, 0x37, 0x0, 0xff, 0xe9, 0x58, 0x87,
+    0x0, 0x7f, 0xf4, 0x84, 0x9e, 0xc8, 0x3, 0xff,
+    0x8a, 0x6e, 0xf0, 0x4,
 
     /* U+00BD "½" */
-    0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x11, 0x1e, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x7, 0xbe, 0xff,
-    0xda, 0x30, 0x0, 0x0, 0x0, 0xe, 0xfa, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xa0, 0x4, 0xef, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xe, 0xfa,
-    0x0, 0x0, 0x0, 0xb, 0xfe, 0x10, 0xe, 0xff,
-    0x83, 0x23, 0x6e, 0xff, 0x40, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x7f, 0xf4, 0x0, 0x2,
-    0xb1, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x2, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xfb, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x1e, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6,
+    0xc, 0xff, 0xea, 0x0, 0xff, 0xe1, 0xc7, 0xf8,
+    0xc0, 0x3f, 0xfa, 0x26, 0xe0, 0xe6, 0x1, 0xfb,
+    0x3b, 0xa1, 0x0, 0xff, 0xe2, 0x70, 0x14, 0x0,
+    0x7f, 0x84, 0x60, 0xf, 0xfe, 0x24, 0x90, 0x70,
+    0x7, 0xff, 0x45, 0x18, 0x20, 0xc0, 0x3f, 0xfa,
+    0x34, 0x6, 0xe0, 0x1f, 0xfd, 0x1a, 0x10, 0xe0,
+    0xf, 0xfe, 0x8a, 0xa8, 0x24, 0x80, 0x3f, 0xfa,
+    0x3, 0x60, 0x8c, 0x1, 0xff, 0xd1, 0xa1, 0x15,
+    0x0, 0x7f, 0xf4, 0x59, 0x2, 0xc4, 0x0, 0xf7,
+    0xdf, 0xed, 0xa3, 0x0, 0xff, 0xe3, 0xc, 0x82,
+    0xa8, 0x13, 0xa1, 0x4, 0x0, 0x4b, 0x90, 0x1,
+    0xff, 0xc5, 0xa0, 0x1b, 0x0, 0x50, 0x83, 0xe6,
+    0xe4, 0x88, 0x3a, 0x0, 0xff, 0xe1, 0x5, 0xff,
+    0x94, 0x0, 0xe8, 0x14, 0x20, 0xc, 0x4e, 0x83,
+    0x23, 0x6f, 0x0, 0x70, 0x7, 0xff, 0x8, 0xa0,
+    0x19, 0x0, 0x22, 0xb1, 0x0, 0xe1, 0x20, 0x10,
+    0x1f, 0xff, 0xf2, 0x87, 0x1, 0x48, 0x7, 0xfe,
+    0x12, 0xc, 0x0, 0xff, 0xe0, 0xc1, 0x87, 0x0,
+    0x7f, 0xf0, 0x74, 0x0, 0xc0, 0x1f, 0xf8, 0xdc,
+    0x1c, 0xc0, 0x3f, 0xe1, 0xc3, 0xb, 0x10, 0xf,
+    0xfd, 0xc0, 0x50, 0x1, 0xff, 0xe, 0x18, 0x52,
+    0x0, 0x7f, 0xe9, 0x20, 0xf0, 0xf, 0xf8, 0xfc,
+    0x87, 0x14, 0x3, 0xff, 0x23, 0x4, 0x10, 0x7,
+    0xf9, 0x30, 0x4b, 0xc, 0x3, 0xff, 0xd, 0x1,
+    0xb8, 0x7, 0xf9, 0xac, 0xf, 0x8, 0x3, 0xff,
+    0x83, 0x62, 0x1c, 0x1, 0xfe, 0x89, 0x4, 0xd0,
+    0x11, 0xe0, 0xf, 0xca, 0xa0, 0x92, 0x0, 0xfe,
+    0x77, 0x0, 0x13, 0xbb, 0xe6, 0x0, 0xf0, 0xd8,
+    0x23, 0x0, 0x7f, 0xb8, 0x3, 0xff,
 
     /* U+00BE "¾" */
-    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x5d, 0xff, 0x30, 0x0, 0x0,
-    0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xf9,
-    0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xb0, 0x0, 0x8, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x7d, 0xd3, 0x0, 0x0, 0x2, 0x60,
-    0x0, 0x0, 0x0, 0x2f, 0xf8, 0x0, 0x4, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0,
-    0x0, 0xaf, 0xd8, 0x43, 0x24, 0x8e, 0xff, 0x20,
-    0x1, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x2e, 0xfb,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0xaf, 0xf2, 0x0, 0x0, 0x0,
-    0xd, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x1, 0x7b,
-    0xef, 0xfe, 0xc7, 0x10, 0x0, 0x5f, 0xf6, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xfa, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xfe, 0x10, 0x0, 0x0, 0x4, 0xff,
-    0x80, 0x0, 0xab, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
-    0x1, 0xef, 0xb0, 0x0, 0xf, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xcf, 0xe2, 0x11, 0x11, 0xff,
-    0x61, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xd0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0x88, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x88, 0x20,
-    0x0,
+    0x0, 0x8, 0xff, 0xc0, 0x1f, 0xfc, 0x11, 0x10,
+    0x7, 0xfa, 0x7b, 0xbf, 0xe0, 0xf, 0xfd, 0x1d,
+    0xc3, 0x0, 0xff, 0xe4, 0x8, 0x7, 0xfc, 0x8e,
+    0x10, 0x60, 0x1f, 0xd3, 0xff, 0xf2, 0x0, 0xe0,
+    0x7, 0xf8, 0x68, 0xd, 0xc0, 0x3f, 0xf8, 0xb4,
+    0x81, 0xa4, 0x1, 0xfe, 0xb1, 0xe, 0x0, 0xff,
+    0xe2, 0xca, 0x85, 0x98, 0x7, 0xf9, 0x54, 0x12,
+    0x40, 0x1f, 0xfc, 0x48, 0x60, 0xa4, 0x0, 0xff,
+    0xd, 0x82, 0xb0, 0x7, 0xff, 0x11, 0x1c, 0x1,
+    0x30, 0x40, 0x1f, 0xd4, 0x22, 0xb0, 0xf, 0xfe,
+    0x28, 0x80, 0x46, 0xfa, 0xe0, 0x1f, 0x3a, 0x5,
+    0x8, 0x7, 0xff, 0x15, 0x7f, 0xdd, 0x44, 0x10,
+    0x60, 0x1c, 0x50, 0xc, 0x80, 0x1f, 0xfc, 0x91,
+    0x5c, 0x0, 0x50, 0x7, 0x78, 0x14, 0x80, 0x7f,
+    0xf3, 0x4, 0x80, 0x80, 0x34, 0x10, 0x70, 0x7,
+    0xcf, 0xba, 0x30, 0xe, 0x26, 0x0, 0xf8, 0x88,
+    0x6, 0x1, 0x23, 0x84, 0x18, 0x7, 0x92, 0x9,
+    0x4c, 0x3, 0xa2, 0x76, 0x10, 0xc9, 0x23, 0x0,
+    0x14, 0x0, 0x1a, 0x3, 0x70, 0xf, 0x15, 0x2,
+    0x40, 0x7, 0x88, 0x9, 0xef, 0x36, 0xdc, 0x45,
+    0x64, 0x0, 0xb1, 0xe, 0x0, 0xfb, 0xc4, 0xa8,
+    0x3, 0xe8, 0xe8, 0x41, 0x0, 0x9, 0xc7, 0xa0,
+    0x1, 0x54, 0x12, 0x40, 0x1e, 0xa2, 0xf, 0x10,
+    0xf, 0xc2, 0xf7, 0xdf, 0xee, 0xc7, 0x10, 0x0,
+    0xd0, 0x2b, 0x0, 0x79, 0xd4, 0x28, 0x80, 0x3f,
+    0xf9, 0x34, 0x3, 0x60, 0x1e, 0x48, 0x7, 0x50,
+    0x5, 0x59, 0x80, 0x7f, 0xf1, 0x1d, 0x2, 0x84,
+    0x3, 0x86, 0x81, 0x20, 0x2, 0x54, 0x60, 0xf,
+    0xfe, 0x19, 0x40, 0x32, 0x0, 0x7b, 0x44, 0x52,
+    0x23, 0x80, 0x6, 0x22, 0x0, 0xff, 0xe0, 0xf8,
+    0x14, 0x80, 0x79, 0x8c, 0x7, 0x7b, 0xb0, 0x2,
+    0x7b, 0x88, 0x1, 0xff, 0x41, 0x7, 0x0, 0x7c,
+    0x20, 0x1f, 0xfc, 0xc4, 0x70, 0x83, 0x0, 0xf9,
+    0xff, 0xfe, 0xd0, 0x5, 0x7f, 0x90, 0x3, 0xf8,
+    0x68, 0xd, 0xc0, 0x3f, 0xfa, 0x96, 0x21, 0xc0,
+    0x1f, 0xfd, 0x41, 0x27, 0xb2, 0x0, 0xff, 0xe2,
+    0x9b, 0xbc, 0x1,
 
     /* U+00BF "¿" */
-    0x0, 0x0, 0x0, 0xa, 0xfc, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x85, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3e,
-    0xee, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x94, 0x0, 0x4f, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xf8, 0x0,
-    0xdf, 0xff, 0xf8, 0x30, 0x2, 0x49, 0xff, 0xff,
-    0xc0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x38, 0xce,
-    0xff, 0xec, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0xfa, 0xbf, 0x8, 0x3, 0xff, 0x85, 0xa,
+    0x7, 0xc0, 0x1f, 0xfc, 0x22, 0x0, 0x88, 0x3,
+    0xff, 0x85, 0xe0, 0x13, 0x0, 0x7f, 0xf0, 0x97,
+    0x1e, 0xa0, 0x3, 0xff, 0x86, 0x70, 0xa0, 0x1f,
+    0xfe, 0x93, 0xee, 0x94, 0x3, 0xff, 0x84, 0x82,
+    0x33, 0x0, 0x7f, 0xf0, 0x46, 0x40, 0x2, 0x60,
+    0x1f, 0xfc, 0x1d, 0x10, 0x5, 0x80, 0x7f, 0xe1,
+    0xc3, 0x0, 0x3a, 0x80, 0x7f, 0xc3, 0x86, 0x0,
+    0x78, 0x0, 0xff, 0xd8, 0x40, 0x8, 0x80, 0x7,
+    0xfe, 0x92, 0x0, 0x4b, 0x80, 0x7f, 0xe1, 0x60,
+    0x2, 0xb0, 0x7, 0xff, 0x5, 0x0, 0x29, 0x0,
+    0xff, 0xe1, 0x10, 0x4, 0x40, 0x1f, 0xfc, 0x64,
+    0x0, 0xff, 0x4a, 0x0, 0xc, 0x2, 0xb2, 0x0,
+    0xf8, 0x6d, 0xae, 0x1, 0x8, 0x0, 0x3b, 0x6,
+    0x0, 0x24, 0x9e, 0x40, 0x2, 0x0, 0x3c, 0x40,
+    0x27, 0xcf, 0xf6, 0xdb, 0x0, 0x49, 0x80, 0x2,
+    0xc4, 0x0, 0xff, 0xd, 0x58, 0x6, 0x2b, 0xc7,
+    0x31, 0x0, 0x9, 0xb5, 0x72, 0x80, 0x40,
 
     /* U+00C0 "À" */
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x87, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0xef,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x30, 0x5, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xfc, 0xf1, 0x7, 0x20, 0xf, 0xfe, 0x5a,
+    0x2b, 0xc6, 0x10, 0x7, 0xff, 0x28, 0xf5, 0x40,
+    0x70, 0xc0, 0x3f, 0xf9, 0x75, 0x20, 0x38, 0x80,
+    0x1f, 0xfc, 0xb6, 0xd2, 0xb, 0x50, 0xf, 0xfe,
+    0x59, 0x6f, 0xf9, 0x40, 0x3f, 0xfc, 0xfb, 0xff,
+    0x10, 0x7, 0xff, 0x29, 0x8, 0x2, 0xb0, 0xf,
+    0xfe, 0x54, 0x0, 0x66, 0x10, 0xf, 0xfe, 0x41,
+    0x98, 0x3, 0xa4, 0x3, 0xff, 0x91, 0x20, 0x3,
+    0x80, 0x3, 0x80, 0x7f, 0xf1, 0xc9, 0x40, 0x12,
+    0xc0, 0x13, 0x80, 0x7f, 0xf1, 0xac, 0x0, 0x2a,
+    0x2c, 0x0, 0x90, 0xf, 0xfe, 0x28, 0xb0, 0x2,
+    0x40, 0x16, 0x0, 0x15, 0x0, 0xff, 0xe2, 0x48,
+    0x4, 0xe0, 0x2, 0x40, 0x4, 0x0, 0x7f, 0xf1,
+    0x18, 0x0, 0xc0, 0x1b, 0xc0, 0x4, 0x80, 0x1f,
+    0xfc, 0x26, 0x10, 0x5, 0x80, 0x64, 0x20, 0x7,
+    0x80, 0x7f, 0xf0, 0xac, 0x0, 0xa4, 0x1, 0xd6,
+    0x0, 0x43, 0x0, 0xff, 0xca, 0x40, 0x9, 0x0,
+    0xf3, 0x8, 0x2, 0x40, 0x3f, 0xf4, 0x80, 0xc,
+    0xc0, 0x1f, 0x30, 0x1, 0x48, 0x3, 0xfc, 0x66,
+    0x0, 0x48, 0x7, 0xe9, 0x0, 0xac, 0x3, 0xfd,
+    0x0, 0x1, 0x50, 0xf, 0xc2, 0xa0, 0x6, 0x10,
+    0xf, 0xc4, 0x80, 0x1, 0xff, 0xff, 0x28, 0x4,
+    0xc0, 0x1f, 0xac, 0x3, 0xff, 0x8d, 0x20, 0x1f,
+    0xb, 0x0, 0x4, 0x8b, 0xff, 0x82, 0x0, 0x16,
+    0x0, 0xf4, 0x80, 0x59, 0xbb, 0xff, 0xc1, 0x20,
+    0x5, 0x80, 0x79, 0x80, 0xa, 0x40, 0x1f, 0xfc,
+    0x1b, 0x0, 0x12, 0x80, 0x66, 0x10, 0x4, 0x80,
+    0x7f, 0xf0, 0x98, 0x40, 0x12, 0x1, 0xa0, 0x0,
+    0x66, 0x0, 0xff, 0xe1, 0xb0, 0x0, 0xcc, 0x0,
+    0x51, 0x0, 0x48, 0x7, 0xff, 0x12, 0x40, 0x28,
+    0x0, 0x48, 0x0, 0x54, 0x3, 0xff, 0x88, 0x2c,
+    0x0, 0x42,
 
     /* U+00C1 "Á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x68, 0x88, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0xef,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x30, 0x5, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xff, 0xe2, 0x34, 0x44, 0x60, 0x1f, 0xfc,
+    0xaa, 0x97, 0x77, 0x98, 0x7, 0xff, 0x26, 0xd4,
+    0xb, 0x1c, 0x3, 0xff, 0x90, 0x38, 0x80, 0xba,
+    0x60, 0x1f, 0xfc, 0x82, 0xc3, 0x9, 0xa0, 0xf,
+    0xfe, 0x51, 0x6f, 0xf9, 0x80, 0x3f, 0xfd, 0x1b,
+    0xff, 0x10, 0x7, 0xff, 0x29, 0x8, 0x2, 0xb0,
+    0xf, 0xfe, 0x54, 0x0, 0x66, 0x10, 0xf, 0xfe,
+    0x41, 0x98, 0x3, 0xa4, 0x3, 0xff, 0x91, 0x20,
+    0x3, 0x80, 0x3, 0x80, 0x7f, 0xf1, 0xc9, 0x40,
+    0x12, 0xc0, 0x13, 0x80, 0x7f, 0xf1, 0xac, 0x0,
+    0x2a, 0x2c, 0x0, 0x90, 0xf, 0xfe, 0x28, 0xb0,
+    0x2, 0x40, 0x16, 0x0, 0x15, 0x0, 0xff, 0xe2,
+    0x48, 0x4, 0xe0, 0x2, 0x40, 0x4, 0x0, 0x7f,
+    0xf1, 0x18, 0x0, 0xc0, 0x1b, 0xc0, 0x4, 0x80,
+    0x1f, 0xfc, 0x26, 0x10, 0x5, 0x80, 0x64, 0x20,
+    0x7, 0x80, 0x7f, 0xf0, 0xac, 0x0, 0xa4, 0x1,
+    0xd6, 0x0, 0x43, 0x0, 0xff, 0xca, 0x40, 0x9,
+    0x0, 0xf3, 0x8, 0x2, 0x40, 0x3f, 0xf4, 0x80,
+    0xc, 0xc0, 0x1f, 0x30, 0x1, 0x48, 0x3, 0xfc,
+    0x66, 0x0, 0x48, 0x7, 0xe9, 0x0, 0xac, 0x3,
+    0xfd, 0x0, 0x1, 0x50, 0xf, 0xc2, 0xa0, 0x6,
+    0x10, 0xf, 0xc4, 0x80, 0x1, 0xff, 0xff, 0x28,
+    0x4, 0xc0, 0x1f, 0xac, 0x3, 0xff, 0x8d, 0x20,
+    0x1f, 0xb, 0x0, 0x4, 0x8b, 0xff, 0x82, 0x0,
+    0x16, 0x0, 0xf4, 0x80, 0x59, 0xbb, 0xff, 0xc1,
+    0x20, 0x5, 0x80, 0x79, 0x80, 0xa, 0x40, 0x1f,
+    0xfc, 0x1b, 0x0, 0x12, 0x80, 0x66, 0x10, 0x4,
+    0x80, 0x7f, 0xf0, 0x98, 0x40, 0x12, 0x1, 0xa0,
+    0x0, 0x66, 0x0, 0xff, 0xe1, 0xb0, 0x0, 0xcc,
+    0x0, 0x51, 0x0, 0x48, 0x7, 0xff, 0x12, 0x40,
+    0x28, 0x0, 0x48, 0x0, 0x54, 0x3, 0xff, 0x88,
+    0x2c, 0x0, 0x42,
 
     /* U+00C2 "Â" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x58, 0x87,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfd, 0x9f, 0xfd, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xa0, 0x6, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0,
-    0x3e, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0xef,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x30, 0x5, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xff, 0xcb, 0x10, 0x70, 0xf, 0xfe, 0x5c,
+    0x53, 0xba, 0x30, 0x40, 0x3f, 0xf9, 0x12, 0xe0,
+    0x4c, 0x7, 0x82, 0x1, 0xff, 0xc6, 0xa6, 0x5,
+    0xd9, 0x90, 0x17, 0x90, 0x7, 0xff, 0x12, 0xd4,
+    0x22, 0x80, 0xd, 0x82, 0x2c, 0x20, 0xf, 0xfe,
+    0x1d, 0xff, 0x9c, 0x3, 0x1f, 0x7f, 0x10, 0x7,
+    0xff, 0x8f, 0x7f, 0xe2, 0x0, 0xff, 0xe5, 0x21,
+    0x0, 0x56, 0x1, 0xff, 0xca, 0x80, 0xc, 0xc2,
+    0x1, 0xff, 0xc8, 0x33, 0x0, 0x74, 0x80, 0x7f,
+    0xf2, 0x24, 0x0, 0x70, 0x0, 0x70, 0xf, 0xfe,
+    0x39, 0x28, 0x2, 0x58, 0x2, 0x70, 0xf, 0xfe,
+    0x35, 0x80, 0x5, 0x45, 0x80, 0x12, 0x1, 0xff,
+    0xc5, 0x16, 0x0, 0x48, 0x2, 0xc0, 0x2, 0xa0,
+    0x1f, 0xfc, 0x49, 0x0, 0x9c, 0x0, 0x48, 0x0,
+    0x80, 0xf, 0xfe, 0x23, 0x0, 0x18, 0x3, 0x78,
+    0x0, 0x90, 0x3, 0xff, 0x84, 0xc2, 0x0, 0xb0,
+    0xc, 0x84, 0x0, 0xf0, 0xf, 0xfe, 0x15, 0x80,
+    0x14, 0x80, 0x3a, 0xc0, 0x8, 0x60, 0x1f, 0xf9,
+    0x48, 0x1, 0x20, 0x1e, 0x61, 0x0, 0x48, 0x7,
+    0xfe, 0x90, 0x1, 0x98, 0x3, 0xe6, 0x0, 0x29,
+    0x0, 0x7f, 0x8c, 0xc0, 0x9, 0x0, 0xfd, 0x20,
+    0x15, 0x80, 0x7f, 0xa0, 0x0, 0x2a, 0x1, 0xf8,
+    0x54, 0x0, 0xc2, 0x1, 0xf8, 0x90, 0x0, 0x3f,
+    0xff, 0xe5, 0x0, 0x98, 0x3, 0xf5, 0x80, 0x7f,
+    0xf1, 0xa4, 0x3, 0xe1, 0x60, 0x0, 0x91, 0x7f,
+    0xf0, 0x40, 0x2, 0xc0, 0x1e, 0x90, 0xb, 0x37,
+    0x7f, 0xf8, 0x24, 0x0, 0xb0, 0xf, 0x30, 0x1,
+    0x48, 0x3, 0xff, 0x83, 0x60, 0x2, 0x50, 0xc,
+    0xc2, 0x0, 0x90, 0xf, 0xfe, 0x13, 0x8, 0x2,
+    0x40, 0x34, 0x0, 0xc, 0xc0, 0x1f, 0xfc, 0x36,
+    0x0, 0x19, 0x80, 0xa, 0x20, 0x9, 0x0, 0xff,
+    0xe2, 0x48, 0x5, 0x0, 0x9, 0x0, 0xa, 0x80,
+    0x7f, 0xf1, 0x5, 0x80, 0x8, 0x40,
 
     /* U+00C3 "Ã" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xf9, 0x10, 0x0, 0xad,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xe5, 0x5, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xa1,
-    0x2a, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0x20, 0x0, 0x4b,
-    0xed, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf9, 0x0, 0x0,
-    0x4f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0xd, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xa0, 0x0, 0x0, 0x6, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdf, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf5, 0x0,
-    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xfc, 0x0, 0x0, 0xef,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0x30, 0x5, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf2,
+    0x0, 0xff, 0x84, 0x3, 0xff, 0x9a, 0xbd, 0xcf,
+    0x91, 0x0, 0xab, 0x44, 0x3, 0xff, 0x86, 0x54,
+    0x20, 0x6, 0xf5, 0x5, 0x51, 0x8, 0x7, 0xff,
+    0xe, 0xc1, 0x7b, 0x54, 0x6b, 0xe8, 0x24, 0x3,
+    0xff, 0x88, 0x43, 0x2, 0x55, 0x68, 0x25, 0x2c,
+    0x1, 0xff, 0xc4, 0xbe, 0x20, 0x9, 0x2f, 0xb5,
+    0x80, 0x3f, 0xfc, 0xbb, 0xff, 0x10, 0x7, 0xff,
+    0x29, 0x8, 0x2, 0xb0, 0xf, 0xfe, 0x54, 0x0,
+    0x66, 0x10, 0xf, 0xfe, 0x41, 0x98, 0x3, 0xa4,
+    0x3, 0xff, 0x91, 0x20, 0x3, 0x80, 0x3, 0x80,
+    0x7f, 0xf1, 0xc9, 0x40, 0x12, 0xc0, 0x13, 0x80,
+    0x7f, 0xf1, 0xac, 0x0, 0x2a, 0x2c, 0x0, 0x90,
+    0xf, 0xfe, 0x28, 0xb0, 0x2, 0x40, 0x16, 0x0,
+    0x15, 0x0, 0xff, 0xe2, 0x48, 0x4, 0xe0, 0x2,
+    0x40, 0x4, 0x0, 0x7f, 0xf1, 0x18, 0x0, 0xc0,
+    0x1b, 0xc0, 0x4, 0x80, 0x1f, 0xfc, 0x26, 0x10,
+    0x5, 0x80, 0x64, 0x20, 0x7, 0x80, 0x7f, 0xf0,
+    0xac, 0x0, 0xa4, 0x1, 0xd6, 0x0, 0x43, 0x0,
+    0xff, 0xca, 0x40, 0x9, 0x0, 0xf3, 0x8, 0x2,
+    0x40, 0x3f, 0xf4, 0x80, 0xc, 0xc0, 0x1f, 0x30,
+    0x1, 0x48, 0x3, 0xfc, 0x66, 0x0, 0x48, 0x7,
+    0xe9, 0x0, 0xac, 0x3, 0xfd, 0x0, 0x1, 0x50,
+    0xf, 0xc2, 0xa0, 0x6, 0x10, 0xf, 0xc4, 0x80,
+    0x1, 0xff, 0xff, 0x28, 0x4, 0xc0, 0x1f, 0xac,
+    0x3, 0xff, 0x8d, 0x20, 0x1f, 0xb, 0x0, 0x4,
+    0x8b, 0xff, 0x82, 0x0, 0x16, 0x0, 0xf4, 0x80,
+    0x59, 0xbb, 0xff, 0xc1, 0x20, 0x5, 0x80, 0x79,
+    0x80, 0xa, 0x40, 0x1f, 0xfc, 0x1b, 0x0, 0x12,
+    0x80, 0x66, 0x10, 0x4, 0x80, 0x7f, 0xf0, 0x98,
+    0x40, 0x12, 0x1, 0xa0, 0x0, 0x66, 0x0, 0xff,
+    0xe1, 0xb0, 0x0, 0xcc, 0x0, 0x51, 0x0, 0x48,
+    0x7, 0xff, 0x12, 0x40, 0x28, 0x0, 0x48, 0x0,
+    0x54, 0x3, 0xff, 0x88, 0x2c, 0x0, 0x42,
 
     /* U+00C4 "Ä" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xed, 0x20, 0x0,
-    0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0x90, 0x3, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x70, 0x2, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x97,
-    0x0, 0x0, 0x49, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf5, 0x1f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x9,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x8,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf5, 0x0, 0x0, 0x6f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x5, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2,
+    0x0, 0xfe, 0x5e, 0xd2, 0x0, 0xab, 0xe8, 0x3,
+    0xff, 0x8d, 0x42, 0x56, 0x0, 0x35, 0x5, 0x40,
+    0xf, 0xfe, 0x29, 0x0, 0x38, 0x0, 0x20, 0x13,
+    0x80, 0x7f, 0xf1, 0x7d, 0xa1, 0xc0, 0x5, 0x6d,
+    0x46, 0x1, 0xff, 0xc5, 0x29, 0x70, 0xc, 0x92,
+    0xa0, 0x1f, 0xfe, 0x5d, 0xff, 0x88, 0x3, 0xff,
+    0x94, 0x84, 0x1, 0x58, 0x7, 0xff, 0x2a, 0x0,
+    0x33, 0x8, 0x7, 0xff, 0x20, 0xcc, 0x1, 0xd2,
+    0x1, 0xff, 0xc8, 0x90, 0x1, 0xc0, 0x1, 0xc0,
+    0x3f, 0xf8, 0xe4, 0xa0, 0x9, 0x60, 0x9, 0xc0,
+    0x3f, 0xf8, 0xd6, 0x0, 0x15, 0x16, 0x0, 0x48,
+    0x7, 0xff, 0x14, 0x58, 0x1, 0x20, 0xb, 0x0,
+    0xa, 0x80, 0x7f, 0xf1, 0x24, 0x2, 0x70, 0x1,
+    0x20, 0x2, 0x0, 0x3f, 0xf8, 0x8c, 0x0, 0x60,
+    0xd, 0xe0, 0x2, 0x40, 0xf, 0xfe, 0x13, 0x8,
+    0x2, 0xc0, 0x32, 0x10, 0x3, 0xc0, 0x3f, 0xf8,
+    0x56, 0x0, 0x52, 0x0, 0xeb, 0x0, 0x21, 0x80,
+    0x7f, 0xe5, 0x20, 0x4, 0x80, 0x79, 0x84, 0x1,
+    0x20, 0x1f, 0xfa, 0x40, 0x6, 0x60, 0xf, 0x98,
+    0x0, 0xa4, 0x1, 0xfe, 0x33, 0x0, 0x24, 0x3,
+    0xf4, 0x80, 0x56, 0x1, 0xfe, 0x80, 0x0, 0xa8,
+    0x7, 0xe1, 0x50, 0x3, 0x8, 0x7, 0xe2, 0x40,
+    0x0, 0xff, 0xff, 0x94, 0x2, 0x60, 0xf, 0xd6,
+    0x1, 0xff, 0xc6, 0x90, 0xf, 0x85, 0x80, 0x2,
+    0x45, 0xff, 0xc1, 0x0, 0xb, 0x0, 0x7a, 0x40,
+    0x2c, 0xdd, 0xff, 0xe0, 0x90, 0x2, 0xc0, 0x3c,
+    0xc0, 0x5, 0x20, 0xf, 0xfe, 0xd, 0x80, 0x9,
+    0x40, 0x33, 0x8, 0x2, 0x40, 0x3f, 0xf8, 0x4c,
+    0x20, 0x9, 0x0, 0xd0, 0x0, 0x33, 0x0, 0x7f,
+    0xf0, 0xd8, 0x0, 0x66, 0x0, 0x28, 0x80, 0x24,
+    0x3, 0xff, 0x89, 0x20, 0x14, 0x0, 0x24, 0x0,
+    0x2a, 0x1, 0xff, 0xc4, 0x16, 0x0, 0x21, 0x0,
 
     /* U+00C5 "Å" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9e, 0xfb,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfa, 0x9e, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0x50, 0x2, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbe,
-    0x0, 0x0, 0x9f, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcd, 0x0, 0x0,
-    0x8f, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0x20, 0x0, 0xce, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xd4, 0x3a, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfc, 0x7f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf5, 0x1f, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xe0, 0x9,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x70, 0x2, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf9,
-    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0,
-    0xd, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xa0, 0x0, 0x0, 0x6, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfe, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdf, 0xff, 0x60, 0x0, 0x0, 0x8,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xd0, 0x0, 0x0, 0xe, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xf5, 0x0, 0x0, 0x6f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc, 0x0,
-    0x0, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x5, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0xc, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2,
+    0x0, 0xff, 0x86, 0x7b, 0xec, 0xc0, 0x3f, 0xf9,
+    0x58, 0xc8, 0xcb, 0x86, 0x1, 0xff, 0xc8, 0x72,
+    0xaa, 0x4e, 0x7, 0x80, 0x7f, 0xf2, 0x30, 0x54,
+    0x0, 0x4c, 0x62, 0x1, 0xff, 0xc7, 0x73, 0x0,
+    0xc2, 0x1, 0xff, 0xc9, 0x52, 0x20, 0x4, 0x82,
+    0x20, 0xf, 0xfe, 0x3d, 0x87, 0xa1, 0xd1, 0xc8,
+    0x7, 0xff, 0x20, 0xac, 0xef, 0x15, 0xdc, 0x1,
+    0xff, 0xc9, 0x4e, 0xbb, 0x74, 0x0, 0x7f, 0xf3,
+    0x11, 0x2, 0x1, 0xff, 0xcc, 0xdf, 0xf8, 0x80,
+    0x3f, 0xf9, 0x48, 0x40, 0x15, 0x80, 0x7f, 0xf2,
+    0xa0, 0x3, 0x30, 0x80, 0x7f, 0xf2, 0xc, 0xc0,
+    0x1d, 0x20, 0x1f, 0xfc, 0x89, 0x0, 0x1c, 0x0,
+    0x1c, 0x3, 0xff, 0x8e, 0x4a, 0x0, 0x96, 0x0,
+    0x9c, 0x3, 0xff, 0x8d, 0x60, 0x1, 0x51, 0x60,
+    0x4, 0x80, 0x7f, 0xf1, 0x45, 0x80, 0x12, 0x0,
+    0xb0, 0x0, 0xa8, 0x7, 0xff, 0x12, 0x40, 0x27,
+    0x0, 0x12, 0x0, 0x20, 0x3, 0xff, 0x88, 0xc0,
+    0x6, 0x0, 0xde, 0x0, 0x24, 0x0, 0xff, 0xe1,
+    0x30, 0x80, 0x2c, 0x3, 0x21, 0x0, 0x3c, 0x3,
+    0xff, 0x85, 0x60, 0x5, 0x20, 0xe, 0xb0, 0x2,
+    0x18, 0x7, 0xfe, 0x52, 0x0, 0x48, 0x7, 0x98,
+    0x40, 0x12, 0x1, 0xff, 0xa4, 0x0, 0x66, 0x0,
+    0xf9, 0x80, 0xa, 0x40, 0x1f, 0xe3, 0x30, 0x2,
+    0x40, 0x3f, 0x48, 0x5, 0x60, 0x1f, 0xe8, 0x0,
+    0xa, 0x80, 0x7e, 0x15, 0x0, 0x30, 0x80, 0x7e,
+    0x24, 0x0, 0xf, 0xff, 0xf9, 0x40, 0x26, 0x0,
+    0xfd, 0x60, 0x1f, 0xfc, 0x69, 0x0, 0xf8, 0x58,
+    0x0, 0x24, 0x5f, 0xfc, 0x10, 0x0, 0xb0, 0x7,
+    0xa4, 0x2, 0xcd, 0xdf, 0xfe, 0x9, 0x0, 0x2c,
+    0x3, 0xcc, 0x0, 0x52, 0x0, 0xff, 0xe0, 0xd8,
+    0x0, 0x94, 0x3, 0x30, 0x80, 0x24, 0x3, 0xff,
+    0x84, 0xc2, 0x0, 0x90, 0xd, 0x0, 0x3, 0x30,
+    0x7, 0xff, 0xd, 0x80, 0x6, 0x60, 0x2, 0x88,
+    0x2, 0x40, 0x3f, 0xf8, 0x92, 0x1, 0x40, 0x2,
+    0x40, 0x2, 0xa0, 0x1f, 0xfc, 0x41, 0x60, 0x2,
+    0x10,
 
     /* U+00C6 "Æ" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0x7a, 0xff, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xd0, 0x9f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xf4, 0x9, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0,
-    0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0x10, 0x9, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x70, 0x0, 0x9f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xd0, 0x0, 0x9,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf5,
-    0x0, 0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfb, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x20, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf1,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
-    0x8f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0xb, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+    0x0, 0xff, 0xe1, 0xaf, 0xff, 0xff, 0x20, 0x80,
+    0x3f, 0xf8, 0x76, 0x1, 0xff, 0xd7, 0x81, 0x0,
+    0xff, 0xeb, 0x13, 0x80, 0x21, 0x40, 0x2e, 0xef,
+    0xfe, 0x11, 0x0, 0x7f, 0xf0, 0x64, 0x0, 0x4e,
+    0x60, 0x10, 0x8f, 0xff, 0x8, 0x3, 0xff, 0x82,
+    0xa8, 0x0, 0x90, 0xf, 0xfe, 0xa5, 0x80, 0x15,
+    0x0, 0x3f, 0xfa, 0x70, 0x20, 0xb, 0x0, 0xff,
+    0xe9, 0x93, 0x80, 0x20, 0x40, 0x3f, 0xfa, 0x72,
+    0x0, 0x27, 0x0, 0xff, 0xe9, 0xaa, 0x0, 0x20,
+    0x3, 0xff, 0xa9, 0x60, 0x4, 0x50, 0xf, 0xdf,
+    0xff, 0xfa, 0x40, 0x3f, 0xd0, 0x20, 0x9, 0x0,
+    0xff, 0xe9, 0x93, 0x80, 0x1c, 0x80, 0x3f, 0xfa,
+    0x72, 0x0, 0x18, 0x0, 0xff, 0x7f, 0xff, 0xe9,
+    0x0, 0xfc, 0xa8, 0x0, 0xb0, 0xf, 0xfe, 0xa5,
+    0x80, 0x55, 0xff, 0xf3, 0x0, 0x7f, 0xf2, 0xe0,
+    0x40, 0x3f, 0xfa, 0xc4, 0xe0, 0x1, 0x22, 0xfe,
+    0x10, 0xf, 0xfe, 0x54, 0x80, 0x7, 0xb7, 0x7f,
+    0x9c, 0x3, 0xff, 0x92, 0xa8, 0x0, 0xb0, 0xf,
+    0xfe, 0xa5, 0x80, 0xd, 0x40, 0x3f, 0xf8, 0x42,
+    0x3f, 0xfc, 0x30, 0x4, 0x8, 0x3, 0x80, 0x3f,
+    0xf8, 0x7d, 0xdf, 0xfc, 0x2b, 0x2, 0x70, 0x3,
+    0x10, 0x7, 0xff, 0x4e, 0x40, 0x3, 0x20, 0x1f,
+    0xfd, 0x30,
 
     /* U+00C7 "Ç" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc7, 0x43, 0x24, 0x6b, 0xff, 0xff, 0xf4,
-    0x0, 0x5, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xd1, 0x0, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0x10,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c, 0x10,
-    0x0, 0x6, 0xff, 0xff, 0xc3, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xd2, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xc7, 0x43, 0x24, 0x6b, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x8,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xff, 0xfe,
-    0xc9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0xdf,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x72, 0x2, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9c, 0xec, 0x92,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x49, 0xce, 0xff, 0x76, 0x4a, 0x0,
+    0x7f, 0xe7, 0xeb, 0x63, 0x10, 0x0, 0x9b, 0x5f,
+    0xb8, 0x7, 0xe4, 0xe8, 0x10, 0xf, 0xfa, 0x38,
+    0xc0, 0x39, 0xac, 0x40, 0x23, 0x8b, 0xcd, 0xb9,
+    0x40, 0x8, 0x71, 0x0, 0x25, 0x90, 0x8, 0xb3,
+    0xe, 0x86, 0x48, 0xd7, 0xca, 0x0, 0x25, 0x0,
+    0x15, 0x0, 0x4d, 0xa6, 0x1, 0xf8, 0x6a, 0x87,
+    0x82, 0x0, 0xe0, 0x9, 0xa4, 0x3, 0xff, 0x2e,
+    0x8, 0x1, 0xc, 0x0, 0x72, 0x1, 0xff, 0xc6,
+    0xe0, 0xb, 0xc0, 0x3f, 0xf8, 0xe8, 0x0, 0x23,
+    0x0, 0xff, 0xe3, 0x8, 0x80, 0xa, 0x1, 0xff,
+    0xc7, 0x20, 0xb, 0x80, 0x3f, 0xf8, 0xee, 0x1,
+    0x18, 0x7, 0xff, 0x1d, 0xc0, 0x23, 0x0, 0xff,
+    0xe3, 0x90, 0x5, 0xc0, 0x1f, 0xfc, 0x71, 0x10,
+    0x1, 0x40, 0x3f, 0xf9, 0x8, 0x0, 0x23, 0x0,
+    0xff, 0xe3, 0xf0, 0x5, 0xe0, 0x1f, 0xfc, 0x74,
+    0x30, 0x1, 0xc8, 0x7, 0xff, 0x1f, 0x80, 0x26,
+    0x80, 0xf, 0xfc, 0xd8, 0x20, 0x11, 0x48, 0x4,
+    0xf8, 0x60, 0x1f, 0x8a, 0xa4, 0xf0, 0x80, 0x26,
+    0x90, 0x8, 0xf3, 0xe, 0x86, 0x48, 0xd7, 0xaa,
+    0x0, 0x26, 0x0, 0xcd, 0x62, 0x1, 0x1c, 0x5e,
+    0x6d, 0xca, 0x0, 0x43, 0xa8, 0x1, 0xc9, 0xce,
+    0x20, 0x1f, 0xe1, 0x8e, 0x20, 0xf, 0xd1, 0xd4,
+    0xc6, 0x1, 0x9, 0xb5, 0xf3, 0x80, 0x7f, 0xe5,
+    0x9c, 0x30, 0xde, 0xc9, 0x40, 0xf, 0xfe, 0x29,
+    0x83, 0x0, 0x7f, 0xf2, 0x10, 0x1, 0x7c, 0x60,
+    0x1f, 0xfc, 0x64, 0xec, 0x21, 0xf0, 0xf, 0xfe,
+    0x38, 0x9d, 0x1, 0x80, 0x7f, 0xf1, 0x5c, 0x80,
+    0xac, 0x4, 0x3, 0xff, 0x88, 0xb1, 0xbf, 0xa6,
+    0x16, 0x1, 0xff, 0xc4, 0x76, 0x31, 0x36, 0xd5,
+    0x0, 0xf8,
 
     /* U+00C8 "È" */
-    0x0, 0x4, 0x88, 0x86, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xff, 0x61, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0x92, 0x22, 0x60, 0xf, 0xfe, 0x1a, 0x3,
+    0xba, 0x64, 0x1, 0xff, 0xc3, 0x8b, 0x10, 0x6a,
+    0x0, 0xff, 0xe1, 0xa7, 0xa0, 0x2d, 0x80, 0x7f,
+    0xf0, 0xc6, 0xdc, 0x13, 0x4, 0x3, 0xff, 0x87,
+    0x1f, 0xec, 0x10, 0xf, 0xfe, 0x79, 0xff, 0xff,
+    0xf1, 0x64, 0x3, 0xff, 0xc3, 0x3d, 0xdf, 0xfc,
+    0x19, 0x0, 0xf0, 0x8f, 0xff, 0x4, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xe7, 0x9f, 0xff, 0xfc, 0x1,
+    0xff, 0xe3, 0x9f, 0xff, 0xfc, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xf4, 0x88, 0xff, 0xf0, 0x80, 0x3a,
+    0x7b, 0xbf, 0xf8, 0x42, 0x1, 0xff, 0xdc,
 
     /* U+00C9 "É" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x88, 0x87,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xff, 0x61, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0xff, 0x8a, 0x22, 0x70, 0xf, 0xfe, 0x11,
+    0xeb, 0xb9, 0x14, 0x3, 0xff, 0x82, 0x98, 0x0,
+    0x6c, 0x20, 0xf, 0xfc, 0xb6, 0x0, 0xa9, 0x0,
+    0xff, 0xe0, 0xbd, 0x1, 0xea, 0x80, 0x7f, 0xf0,
+    0x9f, 0xfd, 0x84, 0x1, 0xff, 0xd0, 0x3f, 0xff,
+    0xfe, 0x2c, 0x80, 0x7f, 0xf8, 0x67, 0xbb, 0xff,
+    0x83, 0x20, 0x1e, 0x11, 0xff, 0xe0, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xfc, 0xf3, 0xff, 0xff, 0x80,
+    0x3f, 0xfc, 0x73, 0xff, 0xff, 0x80, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfe, 0x91, 0x1f, 0xfe, 0x10, 0x7,
+    0x4f, 0x77, 0xff, 0x8, 0x40, 0x3f, 0xfb, 0x80,
 
     /* U+00CA "Ê" */
-    0x0, 0x0, 0x0, 0x1, 0x78, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xf9, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0x40, 0x1c, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xd2, 0x0, 0x0, 0x9f, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x3f, 0xff, 0x61, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0xf8, 0x5e, 0x20, 0xa0, 0x1f, 0xfc, 0x22,
+    0xf8, 0x77, 0x53, 0x0, 0x7f, 0xe2, 0xc1, 0x6,
+    0x10, 0x97, 0x0, 0xff, 0x1e, 0x8, 0x5c, 0xf9,
+    0x84, 0x40, 0x3, 0xf2, 0x60, 0x96, 0xa0, 0xe,
+    0x30, 0x3c, 0x80, 0x7c, 0x9f, 0xed, 0x20, 0xd,
+    0x3f, 0xe9, 0x0, 0xff, 0xe6, 0x1f, 0xff, 0xff,
+    0x16, 0x40, 0x3f, 0xfc, 0x33, 0xdd, 0xff, 0xc1,
+    0x90, 0xf, 0x8, 0xff, 0xf0, 0x40, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfe, 0x79, 0xff, 0xff, 0xc0, 0x1f,
+    0xfe, 0x39, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0x48, 0x8f, 0xff, 0x8, 0x3, 0xa7,
+    0xbb, 0xff, 0x84, 0x20, 0x1f, 0xfd, 0xc0,
 
     /* U+00CB "Ë" */
-    0x0, 0x0, 0xb, 0xf8, 0x0, 0x3, 0xde, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x20, 0xb,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x10, 0x9, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0x93, 0x0, 0x1, 0x88, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
+    0x0, 0xeb, 0xf8, 0x0, 0x8f, 0x79, 0x0, 0x3f,
+    0x99, 0x1, 0xc8, 0x1, 0x4, 0x32, 0x1, 0xfc,
+    0x40, 0x11, 0x80, 0x8, 0x0, 0xc0, 0x1f, 0xc9,
+    0x2d, 0x82, 0x0, 0x87, 0x75, 0x0, 0x7f, 0x9a,
+    0x4c, 0x2, 0x18, 0x80, 0x80, 0x7f, 0xf3, 0x4f,
+    0xff, 0xff, 0x8b, 0x20, 0x1f, 0xfe, 0x19, 0xee,
+    0xff, 0xe0, 0xc8, 0x7, 0x84, 0x7f, 0xf8, 0x20,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0x3c, 0xff, 0xff,
+    0xe0, 0xf, 0xff, 0x1c, 0xff, 0xff, 0xe0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0xa4, 0x47, 0xff, 0x84,
+    0x1, 0xd3, 0xdd, 0xff, 0xc2, 0x10, 0xf, 0xfe,
+    0xe0,
 
     /* U+00CC "Ì" */
-    0x5, 0x88, 0x85, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
+    0x5, 0x88, 0x94, 0x3, 0xca, 0x4e, 0xea, 0x70,
+    0xf, 0x55, 0x0, 0x11, 0x0, 0xf, 0x2e, 0x90,
+    0x3d, 0x0, 0x78, 0xb5, 0x81, 0x6c, 0x3, 0xe9,
+    0xff, 0x58, 0x7, 0xff, 0x14, 0xff, 0xe6, 0x0,
+    0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xe0, 0x1f, 0xfd, 0xc0,
 
     /* U+00CD "Í" */
-    0x0, 0x0, 0x3, 0x88, 0x86, 0x0, 0x0, 0x5,
-    0xff, 0xfb, 0x10, 0x0, 0x6, 0xff, 0xf7, 0x0,
-    0x0, 0x7, 0xff, 0xe3, 0x0, 0x0, 0x9, 0xff,
-    0xb1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0xe3, 0x88, 0x98, 0x3, 0x97, 0x1d, 0xc6,
+    0xe0, 0x19, 0xa8, 0x1, 0x16, 0x20, 0x13, 0xc8,
+    0xe, 0x38, 0x6, 0x98, 0x4, 0xf3, 0x0, 0xe9,
+    0xff, 0x58, 0x80, 0x7f, 0xf1, 0x4f, 0xfe, 0x60,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xfe, 0x1, 0xff, 0xe0,
 
     /* U+00CE "Î" */
-    0x0, 0x0, 0x28, 0x88, 0x40, 0x0, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x8e, 0xff, 0x60, 0x0, 0x4, 0xff, 0xe3,
-    0x2, 0xdf, 0xf6, 0x0, 0x5f, 0xfc, 0x10, 0x0,
-    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0xc5, 0x11, 0x20, 0x7, 0xe3, 0xc7, 0x7a,
+    0xd4, 0x3, 0xc9, 0x82, 0xe, 0x21, 0x4c, 0x1,
+    0x92, 0xc0, 0x72, 0x30, 0x82, 0x58, 0x0, 0xb6,
+    0x7, 0xe6, 0x5, 0xaa, 0x12, 0xe0, 0xbf, 0xec,
+    0x10, 0xd, 0x5f, 0xe7, 0x0, 0xff, 0xe3, 0x9f,
+    0xfc, 0xc0, 0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xdd,
 
     /* U+00CF "Ï" */
-    0x1c, 0xe6, 0x0, 0x4, 0xed, 0x38, 0xff, 0xf0,
-    0x0, 0xdf, 0xfb, 0x7f, 0xfe, 0x0, 0xb, 0xff,
-    0x90, 0x79, 0x20, 0x0, 0x19, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x3, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff,
-    0xf6, 0x0, 0x0,
+    0x1c, 0xe6, 0x0, 0x93, 0xb4, 0xe4, 0xc6, 0x40,
+    0x29, 0x12, 0x8f, 0x0, 0x8, 0x4, 0xc0, 0x2,
+    0x78, 0x6c, 0x0, 0xa9, 0x9e, 0x41, 0xe4, 0x80,
+    0x21, 0x98, 0x0, 0xff, 0xe1, 0x9f, 0xfc, 0xc0,
+    0x1f, 0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff,
+    0xfc, 0x3, 0xff, 0xbc,
 
     /* U+00D0 "Ð" */
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xec, 0x94, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe5, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xb1,
-    0x11, 0x11, 0x11, 0x24, 0x7b, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xd0, 0x0, 0x0, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xf0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x29,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xf3, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x47, 0xdd, 0xdf, 0xff,
-    0xfd, 0xdd, 0xdd, 0xda, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xf3, 0x0, 0x0, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0x20, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xd0, 0x0, 0x0, 0xf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xaf, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xb1, 0x11, 0x11, 0x11,
-    0x23, 0x6b, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0x95, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xfb, 0xb2, 0x50, 0x3, 0xff,
+    0x9a, 0x26, 0xd7, 0xd0, 0x20, 0x1f, 0xfc, 0xe1,
+    0x7f, 0x50, 0xf, 0xfc, 0x9d, 0xdf, 0x6d, 0xc2,
+    0x0, 0x43, 0x50, 0x1, 0xff, 0x8, 0xfe, 0x24,
+    0x7b, 0xd5, 0x0, 0x9d, 0xc0, 0x1f, 0xfc, 0xa2,
+    0xaa, 0x0, 0x50, 0x60, 0x1f, 0xfc, 0xb5, 0xa0,
+    0xb, 0x80, 0x3f, 0xf9, 0x8a, 0xa0, 0x1, 0x28,
+    0x7, 0xff, 0x32, 0x0, 0x2f, 0x0, 0xff, 0xe6,
+    0x12, 0x0, 0x14, 0x3, 0xff, 0x9b, 0x80, 0x11,
+    0x4f, 0xfc, 0x1, 0x2f, 0xff, 0xb0, 0x3, 0xf8,
+    0x80, 0x21, 0x0, 0xff, 0xe8, 0x3f, 0x11, 0x40,
+    0x18, 0x8b, 0xcc, 0x1, 0xff, 0xc1, 0x77, 0x6e,
+    0xc0, 0x12, 0xee, 0xfa, 0x80, 0x3f, 0x88, 0x2,
+    0x10, 0xf, 0xfe, 0x66, 0x0, 0x44, 0x1, 0xff,
+    0xcb, 0x14, 0x0, 0x28, 0x7, 0xff, 0x32, 0xc0,
+    0x2f, 0x0, 0xff, 0xe5, 0xaa, 0x80, 0x4, 0xa0,
+    0x1f, 0xfc, 0xa5, 0xa0, 0xa, 0x40, 0x3f, 0xf9,
+    0x25, 0x54, 0x0, 0xa1, 0x0, 0x3f, 0x84, 0x7f,
+    0x11, 0xb5, 0xea, 0x80, 0x4e, 0xe0, 0xf, 0xf2,
+    0x77, 0x7d, 0xb9, 0x28, 0x1, 0xd, 0x40, 0x7,
+    0xff, 0x35, 0xfd, 0x40, 0x3f, 0xf9, 0x22, 0x6d,
+    0x5f, 0x2, 0x1, 0xe0,
 
     /* U+00D1 "Ñ" */
-    0x0, 0x0, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xfc, 0x40, 0x0, 0x5d, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x91, 0x2d, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xe3, 0x16,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xe8, 0x0, 0x1, 0x9d, 0xea, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x73,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x73, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x73, 0xff, 0xfd,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf7, 0x3f, 0xff, 0x6b, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0xd,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x2e, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x4f,
-    0xff, 0xf4, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x3f,
-    0xff, 0x60, 0x0, 0x7f, 0xff, 0xe2, 0x0, 0x0,
-    0x2f, 0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0xaf,
-    0xff, 0xd0, 0x0, 0x2, 0xff, 0xf7, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x2f,
-    0xff, 0x73, 0xff, 0xf6, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0x70, 0x2, 0xff, 0xf7, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x50, 0x2f, 0xff,
-    0x73, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x22, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfd, 0x3f, 0xff, 0x73,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfd, 0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x73, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf7, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x73, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf7, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0x73, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7,
+    0x0, 0xfc, 0x22, 0x0, 0xff, 0xe3, 0x8d, 0xf7,
+    0x31, 0x0, 0x25, 0xd7, 0x0, 0xff, 0xa9, 0x0,
+    0x7, 0x72, 0x25, 0x4, 0x40, 0xf, 0xf1, 0xa0,
+    0xe7, 0x48, 0x37, 0x69, 0x11, 0x40, 0x3f, 0xcc,
+    0x2c, 0x62, 0xdc, 0xc4, 0x2b, 0x80, 0x1f, 0xf2,
+    0xf4, 0x0, 0x43, 0x3b, 0xd4, 0x20, 0x1f, 0xfd,
+    0x13, 0xff, 0x88, 0x3, 0xff, 0x82, 0x5f, 0xf3,
+    0x80, 0x6f, 0x10, 0xf, 0xfe, 0x49, 0x50, 0x7,
+    0xff, 0x29, 0x24, 0x3, 0xff, 0x94, 0xcc, 0x0,
+    0xff, 0xe5, 0x49, 0x80, 0x7f, 0xf1, 0x88, 0x2,
+    0xd1, 0x0, 0xff, 0xe2, 0xda, 0x0, 0x7, 0x40,
+    0x3f, 0xf8, 0xd6, 0x40, 0x3, 0xa0, 0xf, 0xfe,
+    0x37, 0x88, 0x1, 0x5c, 0x3, 0xff, 0x8a, 0x54,
+    0x1, 0x42, 0x0, 0x7f, 0xf1, 0x52, 0x0, 0x2a,
+    0x20, 0xf, 0xfe, 0x2b, 0xa8, 0x0, 0x7c, 0x3,
+    0xff, 0x8d, 0x46, 0x0, 0x2a, 0x0, 0xff, 0xe3,
+    0x68, 0x80, 0x15, 0xc0, 0x3f, 0xf8, 0xa3, 0xa0,
+    0x14, 0x28, 0x7, 0xff, 0x14, 0xe4, 0x2, 0xa2,
+    0x0, 0xff, 0xe2, 0xb3, 0x0, 0x2f, 0x10, 0xf,
+    0xfe, 0x2c, 0x98, 0x0, 0xb8, 0x3, 0xff, 0x8d,
+    0xa2, 0x0, 0x20, 0xf, 0xfe, 0x30, 0xe8, 0x7,
+    0xff, 0x28, 0xe8, 0x3, 0xff, 0x94, 0xae, 0x1,
+    0xff, 0xca, 0x84, 0x0, 0xff, 0xe5, 0x59, 0x0,
+    0x40,
 
     /* U+00D2 "Ò" */
-    0x0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xef, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf8, 0x73, 0xfe, 0x70, 0xf, 0xfe, 0x50,
+    0xe3, 0x0, 0x21, 0x80, 0x3f, 0xf9, 0x73, 0x20,
+    0x4, 0xb0, 0x7, 0xff, 0x2d, 0xac, 0x42, 0x58,
+    0x3, 0xff, 0x96, 0x98, 0x41, 0x2c, 0x1, 0xff,
+    0xcb, 0x2d, 0xff, 0x30, 0x7, 0xff, 0x91, 0x27,
+    0x3b, 0xfd, 0xd9, 0x4a, 0x20, 0x1f, 0xfc, 0x37,
+    0xeb, 0x63, 0x10, 0x0, 0x9a, 0xd7, 0x48, 0x80,
+    0x7f, 0xc7, 0xb0, 0x20, 0x1f, 0xf3, 0x73, 0x0,
+    0x7f, 0x2e, 0x10, 0x4, 0x71, 0x79, 0xb9, 0x28,
+    0x1, 0xa6, 0x40, 0x1f, 0x2d, 0x0, 0x47, 0x98,
+    0x74, 0x32, 0x36, 0xbe, 0x50, 0x9, 0xa4, 0x3,
+    0x8a, 0x80, 0x26, 0xc3, 0x0, 0xfc, 0x35, 0x40,
+    0x9, 0x94, 0x3, 0x48, 0x4, 0xd2, 0x1, 0xff,
+    0x96, 0x80, 0x2b, 0x0, 0x8d, 0x0, 0x7, 0x20,
+    0x1f, 0xfc, 0x25, 0x60, 0x0, 0xb8, 0x2, 0x80,
+    0x2f, 0x0, 0xff, 0xe2, 0x48, 0x80, 0x28, 0x0,
+    0xe0, 0x2, 0x30, 0xf, 0xfe, 0x2b, 0x80, 0x8,
+    0x82, 0x20, 0x2, 0x80, 0x7f, 0xf1, 0xb0, 0x2,
+    0x72, 0x0, 0xb8, 0x3, 0xff, 0x8c, 0xe0, 0x11,
+    0x38, 0x4, 0x60, 0x1f, 0xfc, 0x63, 0x0, 0xce,
+    0x1, 0x18, 0x7, 0xff, 0x18, 0xc0, 0x31, 0x0,
+    0x5c, 0x1, 0xff, 0xc6, 0x70, 0x8, 0x84, 0x40,
+    0x5, 0x0, 0xff, 0xe3, 0x60, 0x4, 0xe0, 0xe0,
+    0x2, 0x30, 0xf, 0xfe, 0x2b, 0x80, 0x8, 0x81,
+    0x40, 0x17, 0x80, 0x7f, 0xf1, 0x20, 0x40, 0x14,
+    0x0, 0x34, 0x0, 0x1c, 0x80, 0x7f, 0xf0, 0x95,
+    0xc0, 0x2, 0xc0, 0x14, 0x80, 0x4d, 0x0, 0x1f,
+    0xf9, 0x68, 0x2, 0xb1, 0x0, 0x8a, 0x80, 0x27,
+    0xc3, 0x0, 0xfc, 0x33, 0x40, 0x13, 0x28, 0x7,
+    0x2c, 0x80, 0x47, 0x98, 0x74, 0x32, 0x36, 0xae,
+    0x60, 0x9, 0x64, 0x3, 0xe6, 0xc2, 0x0, 0x8e,
+    0x2f, 0x37, 0x25, 0x40, 0x34, 0x50, 0x7, 0xf1,
+    0xec, 0x8, 0x7, 0xfc, 0xdc, 0xe0, 0x1f, 0xf9,
+    0xfa, 0xd8, 0xc4, 0x0, 0x24, 0xb3, 0xd2, 0x20,
+    0x1e,
 
     /* U+00D3 "Ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x9f, 0x7f, 0xb8, 0xc0, 0x3f,
+    0xf9, 0x25, 0xa2, 0x5, 0xe6, 0x1, 0xff, 0xc8,
+    0x2c, 0x10, 0x5d, 0x10, 0xf, 0xfe, 0x41, 0x60,
+    0x83, 0xd0, 0x7, 0xff, 0x24, 0xb0, 0x42, 0xa0,
+    0x3, 0xff, 0x94, 0x5d, 0xfe, 0x50, 0xf, 0xff,
+    0x2a, 0x4e, 0x77, 0xfb, 0xb2, 0x94, 0x40, 0x3f,
+    0xf8, 0x6f, 0xd6, 0xc6, 0x20, 0x1, 0x35, 0xae,
+    0x91, 0x0, 0xff, 0x8f, 0x60, 0x40, 0x3f, 0xe6,
+    0xe6, 0x0, 0xfe, 0x5c, 0x20, 0x8, 0xe2, 0xf3,
+    0x72, 0x50, 0x3, 0x4c, 0x80, 0x3e, 0x5a, 0x0,
+    0x8f, 0x30, 0xe8, 0x64, 0x6d, 0x7c, 0xa0, 0x13,
+    0x48, 0x7, 0x15, 0x0, 0x4d, 0x86, 0x1, 0xf8,
+    0x6a, 0x80, 0x13, 0x28, 0x6, 0x90, 0x9, 0xa4,
+    0x3, 0xff, 0x2d, 0x0, 0x56, 0x1, 0x1a, 0x0,
+    0xe, 0x40, 0x3f, 0xf8, 0x4a, 0xc0, 0x1, 0x70,
+    0x5, 0x0, 0x5e, 0x1, 0xff, 0xc4, 0x91, 0x0,
+    0x50, 0x1, 0xc0, 0x4, 0x60, 0x1f, 0xfc, 0x57,
+    0x0, 0x11, 0x4, 0x40, 0x5, 0x0, 0xff, 0xe3,
+    0x60, 0x4, 0xe4, 0x1, 0x70, 0x7, 0xff, 0x19,
+    0xc0, 0x22, 0x70, 0x8, 0xc0, 0x3f, 0xf8, 0xc6,
+    0x1, 0x9c, 0x2, 0x30, 0xf, 0xfe, 0x31, 0x80,
+    0x62, 0x0, 0xb8, 0x3, 0xff, 0x8c, 0xe0, 0x11,
+    0x8, 0x80, 0xa, 0x1, 0xff, 0xc6, 0xc0, 0x9,
+    0xc1, 0xc0, 0x4, 0x60, 0x1f, 0xfc, 0x57, 0x0,
+    0x11, 0x2, 0x80, 0x2f, 0x0, 0xff, 0xe2, 0x40,
+    0x80, 0x28, 0x0, 0x68, 0x0, 0x39, 0x0, 0xff,
+    0xe1, 0x2b, 0x80, 0x5, 0x80, 0x29, 0x0, 0x9a,
+    0x0, 0x3f, 0xf2, 0xd0, 0x5, 0x62, 0x1, 0x15,
+    0x0, 0x4f, 0x86, 0x1, 0xf8, 0x66, 0x80, 0x26,
+    0x50, 0xe, 0x59, 0x0, 0x8f, 0x30, 0xe8, 0x64,
+    0x6d, 0x5c, 0xc0, 0x12, 0xc8, 0x7, 0xcd, 0x84,
+    0x1, 0x1c, 0x5e, 0x6e, 0x4a, 0x80, 0x68, 0xa0,
+    0xf, 0xe3, 0xd8, 0x10, 0xf, 0xf9, 0xb9, 0xc0,
+    0x3f, 0xf3, 0xf5, 0xb1, 0x88, 0x0, 0x49, 0x67,
+    0xa4, 0x40, 0x3c,
 
     /* U+00D4 "Ô" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xdf, 0xf9, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x80, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6, 0x0, 0x0,
-    0x3e, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x87, 0x7f, 0xe4, 0x0, 0xff, 0xe4,
+    0x8e, 0x10, 0x5, 0x68, 0x1, 0xff, 0xc7, 0x1c,
+    0x20, 0x6a, 0x0, 0x59, 0x80, 0x7f, 0xf1, 0xb4,
+    0x81, 0xe5, 0x6c, 0x1, 0x86, 0x1, 0xff, 0xc4,
+    0xc3, 0x9, 0x80, 0x2, 0x60, 0x86, 0x90, 0x7,
+    0xff, 0xf, 0x3f, 0xcc, 0x1, 0x8f, 0xbf, 0x88,
+    0x3, 0xff, 0xc0, 0x93, 0x9d, 0xfe, 0xec, 0xa5,
+    0x10, 0xf, 0xfe, 0x1b, 0xf5, 0xb1, 0x88, 0x0,
+    0x4d, 0x6b, 0xa4, 0x40, 0x3f, 0xe3, 0xd8, 0x10,
+    0xf, 0xf9, 0xb9, 0x80, 0x3f, 0x97, 0x8, 0x2,
+    0x38, 0xbc, 0xdc, 0x94, 0x0, 0xd3, 0x20, 0xf,
+    0x96, 0x80, 0x23, 0xcc, 0x3a, 0x19, 0x1b, 0x5f,
+    0x28, 0x4, 0xd2, 0x1, 0xc5, 0x40, 0x13, 0x61,
+    0x80, 0x7e, 0x1a, 0xa0, 0x4, 0xca, 0x1, 0xa4,
+    0x2, 0x69, 0x0, 0xff, 0xcb, 0x40, 0x15, 0x80,
+    0x46, 0x80, 0x3, 0x90, 0xf, 0xfe, 0x12, 0xb0,
+    0x0, 0x5c, 0x1, 0x40, 0x17, 0x80, 0x7f, 0xf1,
+    0x24, 0x40, 0x14, 0x0, 0x70, 0x1, 0x18, 0x7,
+    0xff, 0x15, 0xc0, 0x4, 0x41, 0x10, 0x1, 0x40,
+    0x3f, 0xf8, 0xd8, 0x1, 0x39, 0x0, 0x5c, 0x1,
+    0xff, 0xc6, 0x70, 0x8, 0x9c, 0x2, 0x30, 0xf,
+    0xfe, 0x31, 0x80, 0x67, 0x0, 0x8c, 0x3, 0xff,
+    0x8c, 0x60, 0x18, 0x80, 0x2e, 0x0, 0xff, 0xe3,
+    0x38, 0x4, 0x42, 0x20, 0x2, 0x80, 0x7f, 0xf1,
+    0xb0, 0x2, 0x70, 0x70, 0x1, 0x18, 0x7, 0xff,
+    0x15, 0xc0, 0x4, 0x40, 0xa0, 0xb, 0xc0, 0x3f,
+    0xf8, 0x90, 0x20, 0xa, 0x0, 0x1a, 0x0, 0xe,
+    0x40, 0x3f, 0xf8, 0x4a, 0xe0, 0x1, 0x60, 0xa,
+    0x40, 0x26, 0x80, 0xf, 0xfc, 0xb4, 0x1, 0x58,
+    0x80, 0x45, 0x40, 0x13, 0xe1, 0x80, 0x7e, 0x19,
+    0xa0, 0x9, 0x94, 0x3, 0x96, 0x40, 0x23, 0xcc,
+    0x3a, 0x19, 0x1b, 0x57, 0x30, 0x4, 0xb2, 0x1,
+    0xf3, 0x61, 0x0, 0x47, 0x17, 0x9b, 0x92, 0xa0,
+    0x1a, 0x28, 0x3, 0xf8, 0xf6, 0x4, 0x3, 0xfe,
+    0x6e, 0x70, 0xf, 0xfc, 0xfd, 0x6c, 0x62, 0x0,
+    0x12, 0x59, 0xe9, 0x10, 0xf,
 
     /* U+00D5 "Õ" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xd4, 0x0,
-    0x0, 0x9b, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x60, 0x0, 0xef,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xd3, 0x5e, 0xf7, 0x8, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0x50,
-    0x3, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xce, 0x10, 0x0, 0x1a,
-    0xec, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x2c, 0xfd, 0x40, 0xd, 0x36, 0x20,
+    0x1f, 0xfc, 0x4c, 0x30, 0x2b, 0x60, 0x9, 0xd0,
+    0x40, 0x3f, 0xf8, 0x6c, 0x25, 0x94, 0x32, 0xe1,
+    0x2, 0x80, 0x1f, 0xfc, 0x4c, 0x8, 0x35, 0xd1,
+    0x8f, 0x70, 0x80, 0xf, 0xfe, 0x23, 0xa, 0x0,
+    0xf, 0xd4, 0x4e, 0xcc, 0x3, 0xff, 0x89, 0x9c,
+    0x20, 0x10, 0xd7, 0x62, 0x0, 0x7f, 0xf8, 0x92,
+    0x73, 0xbf, 0xdd, 0x94, 0xa2, 0x1, 0xff, 0xc3,
+    0x7e, 0xb6, 0x31, 0x0, 0x9, 0xad, 0x74, 0x88,
+    0x7, 0xfc, 0x7b, 0x2, 0x1, 0xff, 0x37, 0x30,
+    0x7, 0xf2, 0xe1, 0x0, 0x47, 0x17, 0x9b, 0x92,
+    0x80, 0x1a, 0x64, 0x1, 0xf2, 0xd0, 0x4, 0x79,
+    0x87, 0x43, 0x23, 0x6b, 0xe5, 0x0, 0x9a, 0x40,
+    0x38, 0xa8, 0x2, 0x6c, 0x30, 0xf, 0xc3, 0x54,
+    0x0, 0x99, 0x40, 0x34, 0x80, 0x4d, 0x20, 0x1f,
+    0xf9, 0x68, 0x2, 0xb0, 0x8, 0xd0, 0x0, 0x72,
+    0x1, 0xff, 0xc2, 0x56, 0x0, 0xb, 0x80, 0x28,
+    0x2, 0xf0, 0xf, 0xfe, 0x24, 0x88, 0x2, 0x80,
+    0xe, 0x0, 0x23, 0x0, 0xff, 0xe2, 0xb8, 0x0,
+    0x88, 0x22, 0x0, 0x28, 0x7, 0xff, 0x1b, 0x0,
+    0x27, 0x20, 0xb, 0x80, 0x3f, 0xf8, 0xce, 0x1,
+    0x13, 0x80, 0x46, 0x1, 0xff, 0xc6, 0x30, 0xc,
+    0xe0, 0x11, 0x80, 0x7f, 0xf1, 0x8c, 0x3, 0x10,
+    0x5, 0xc0, 0x1f, 0xfc, 0x67, 0x0, 0x88, 0x44,
+    0x0, 0x50, 0xf, 0xfe, 0x36, 0x0, 0x4e, 0xe,
+    0x0, 0x23, 0x0, 0xff, 0xe2, 0xb8, 0x0, 0x88,
+    0x14, 0x1, 0x78, 0x7, 0xff, 0x12, 0x4, 0x1,
+    0x40, 0x3, 0x40, 0x1, 0xc8, 0x7, 0xff, 0x9,
+    0x5c, 0x0, 0x2c, 0x1, 0x48, 0x4, 0xd0, 0x1,
+    0xff, 0x96, 0x80, 0x2b, 0x10, 0x8, 0xa8, 0x2,
+    0x7c, 0x30, 0xf, 0xc3, 0x34, 0x1, 0x32, 0x80,
+    0x72, 0xc8, 0x4, 0x79, 0x87, 0x43, 0x23, 0x6a,
+    0xe6, 0x0, 0x96, 0x40, 0x3e, 0x6c, 0x20, 0x8,
+    0xe2, 0xf3, 0x72, 0x54, 0x3, 0x45, 0x0, 0x7f,
+    0x1e, 0xc0, 0x80, 0x7f, 0xcd, 0xce, 0x1, 0xff,
+    0x9f, 0xad, 0x8c, 0x40, 0x2, 0x4b, 0x3d, 0x22,
+    0x1, 0xe0,
 
     /* U+00D6 "Ö" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x97, 0x0, 0x0,
-    0x49, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x70, 0x2, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0x90, 0x4, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xed,
-    0x20, 0x0, 0xaf, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xfe, 0x29, 0x70, 0xc, 0x92, 0x80, 0x1f,
+    0xfc, 0x6f, 0x68, 0x70, 0x1, 0x5b, 0x59, 0x0,
+    0x7f, 0xf1, 0x48, 0x1, 0xc0, 0x6, 0x0, 0x98,
+    0x3, 0xff, 0x8b, 0x22, 0x56, 0x0, 0x45, 0x5,
+    0x40, 0xf, 0xfe, 0x2b, 0x76, 0x90, 0x5, 0x5f,
+    0x40, 0x1f, 0xff, 0xe4, 0x9c, 0xef, 0xf7, 0x65,
+    0x28, 0x80, 0x7f, 0xf0, 0xdf, 0xad, 0x8c, 0x40,
+    0x2, 0x6b, 0x5d, 0x22, 0x1, 0xff, 0x1e, 0xc0,
+    0x80, 0x7f, 0xcd, 0xcc, 0x1, 0xfc, 0xb8, 0x40,
+    0x11, 0xc5, 0xe6, 0xe4, 0xa0, 0x6, 0x99, 0x0,
+    0x7c, 0xb4, 0x1, 0x1e, 0x61, 0xd0, 0xc8, 0xda,
+    0xf9, 0x40, 0x26, 0x90, 0xe, 0x2a, 0x0, 0x9b,
+    0xc, 0x3, 0xf0, 0xd5, 0x0, 0x26, 0x50, 0xd,
+    0x20, 0x13, 0x48, 0x7, 0xfe, 0x5a, 0x0, 0xac,
+    0x2, 0x34, 0x0, 0x1c, 0x80, 0x7f, 0xf0, 0x95,
+    0x80, 0x2, 0xe0, 0xa, 0x0, 0xbc, 0x3, 0xff,
+    0x89, 0x22, 0x0, 0xa0, 0x3, 0x80, 0x8, 0xc0,
+    0x3f, 0xf8, 0xae, 0x0, 0x22, 0x8, 0x80, 0xa,
+    0x1, 0xff, 0xc6, 0xc0, 0x9, 0xc8, 0x2, 0xe0,
+    0xf, 0xfe, 0x33, 0x80, 0x44, 0xe0, 0x11, 0x80,
+    0x7f, 0xf1, 0x8c, 0x3, 0x38, 0x4, 0x60, 0x1f,
+    0xfc, 0x63, 0x0, 0xc4, 0x1, 0x70, 0x7, 0xff,
+    0x19, 0xc0, 0x22, 0x11, 0x0, 0x14, 0x3, 0xff,
+    0x8d, 0x80, 0x13, 0x83, 0x80, 0x8, 0xc0, 0x3f,
+    0xf8, 0xae, 0x0, 0x22, 0x5, 0x0, 0x5e, 0x1,
+    0xff, 0xc4, 0x81, 0x0, 0x50, 0x0, 0xd0, 0x0,
+    0x72, 0x1, 0xff, 0xc2, 0x57, 0x0, 0xb, 0x0,
+    0x52, 0x1, 0x34, 0x0, 0x7f, 0xe5, 0xa0, 0xa,
+    0xc4, 0x2, 0x2a, 0x0, 0x9f, 0xc, 0x3, 0xf0,
+    0xcd, 0x0, 0x4c, 0xa0, 0x1c, 0xb2, 0x1, 0x1e,
+    0x61, 0xd0, 0xc8, 0xda, 0xb9, 0x80, 0x25, 0x90,
+    0xf, 0x9b, 0x8, 0x2, 0x38, 0xbc, 0xdc, 0x95,
+    0x0, 0xd1, 0x40, 0x1f, 0xc7, 0xb0, 0x20, 0x1f,
+    0xf3, 0x73, 0x80, 0x7f, 0xe7, 0xeb, 0x63, 0x10,
+    0x0, 0x92, 0xcf, 0x48, 0x80, 0x78,
 
     /* U+00D7 "×" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0x50, 0x0, 0x0, 0x0, 0x6b, 0x0, 0xb,
-    0xff, 0x60, 0x0, 0x0, 0x6f, 0xfb, 0x0, 0x9f,
-    0xff, 0x60, 0x0, 0x6f, 0xff, 0x90, 0x0, 0x9f,
-    0xff, 0x60, 0x7f, 0xff, 0x90, 0x0, 0x0, 0x9f,
-    0xff, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xcf,
-    0xff, 0x60, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x9f,
-    0xff, 0x60, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x9f,
-    0xff, 0x70, 0xc, 0xff, 0x80, 0x0, 0x0, 0x9f,
-    0xfc, 0x0, 0x1d, 0x80, 0x0, 0x0, 0x0, 0x9d,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0xe2, 0xda, 0x80, 0x7c, 0xd6, 0x1,
+    0x5a, 0x53, 0x0, 0x73, 0x4a, 0x58, 0x0, 0x80,
+    0x12, 0xc0, 0x13, 0x48, 0x0, 0x80, 0x12, 0xc0,
+    0x9, 0x60, 0x79, 0x0, 0x34, 0x80, 0x52, 0xc0,
+    0x9, 0xa8, 0x0, 0x34, 0x80, 0x74, 0xb0, 0x1,
+    0x40, 0xd, 0x20, 0x1f, 0x49, 0x80, 0x49, 0x20,
+    0x1f, 0x98, 0xc0, 0x24, 0x60, 0xf, 0x9e, 0x40,
+    0x6, 0x0, 0x96, 0x0, 0xe7, 0x80, 0x3, 0xe3,
+    0x0, 0x25, 0x80, 0x27, 0x80, 0x3, 0xc0, 0x4b,
+    0x0, 0x25, 0xc0, 0x16, 0x0, 0x78, 0x0, 0xa5,
+    0x80, 0x16, 0x0, 0xd2, 0x78, 0x0, 0xe9, 0x62,
+    0xd0, 0x0, 0xec, 0x0, 0x7d, 0x3a, 0x20,
 
     /* U+00D8 "Ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0x88, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x9c,
-    0xef, 0xfe, 0xca, 0x51, 0x9, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xc7, 0x43, 0x23, 0x6b, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xef, 0xff, 0xf5, 0x0, 0x0, 0xbf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfc,
-    0x5, 0xff, 0xfe, 0x0, 0x3, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xe1, 0x0, 0x9f,
-    0xff, 0x70, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0x40, 0x0, 0xe, 0xff, 0xd0,
-    0xe, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xf9, 0x0, 0x0, 0x9, 0xff, 0xf2, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x20, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0x4f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x6f, 0xf5, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf7,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x3, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf5, 0xe, 0xff, 0xd0, 0x0,
-    0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xf2, 0x9, 0xff, 0xf3, 0x0, 0x5, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xd0,
-    0x3, 0xff, 0xfc, 0x0, 0x2f, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0xbf,
-    0xff, 0x90, 0xcf, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x10, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x19, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xc7, 0x43, 0x23,
-    0x6a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfc,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0x80, 0x4, 0x9c,
-    0xef, 0xfe, 0xda, 0x61, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe5, 0xa4, 0x40, 0x40, 0x3f, 0xf9,
+    0x65, 0x6e, 0x42, 0x1, 0xff, 0xcb, 0xf0, 0x2a,
+    0x0, 0xff, 0x92, 0x73, 0xbf, 0xdd, 0x94, 0xa2,
+    0x12, 0x41, 0xc0, 0x1f, 0xe7, 0xeb, 0x63, 0x10,
+    0x0, 0x9a, 0xd7, 0x7b, 0x4, 0x18, 0x7, 0xe3,
+    0xd8, 0x10, 0xf, 0xfe, 0x13, 0x80, 0x7e, 0x5c,
+    0x20, 0x8, 0xe2, 0xf3, 0x72, 0x50, 0x3, 0xa4,
+    0x3, 0xe5, 0xa0, 0x8, 0xf3, 0xe, 0x86, 0x46,
+    0xd6, 0xa0, 0x19, 0xa4, 0x3, 0x8a, 0x80, 0x26,
+    0xc3, 0x0, 0xf9, 0x14, 0x4, 0x2, 0x65, 0x0,
+    0xd2, 0x1, 0x34, 0x80, 0x7e, 0x1a, 0x3, 0xea,
+    0x0, 0xac, 0x2, 0x34, 0x0, 0x1c, 0x80, 0x7f,
+    0x50, 0x8b, 0x41, 0x58, 0x0, 0x2e, 0x0, 0xa0,
+    0xb, 0xc0, 0x3f, 0x9d, 0x2, 0x84, 0x1, 0x22,
+    0x0, 0xa0, 0x3, 0x80, 0x8, 0xc0, 0x3f, 0x1c,
+    0x3, 0x20, 0x6, 0x70, 0x1, 0x10, 0x44, 0x0,
+    0x50, 0xf, 0xc3, 0xa0, 0x72, 0x1, 0xd8, 0x1,
+    0x39, 0x0, 0x5c, 0x1, 0xfa, 0x84, 0x38, 0x3,
+    0xce, 0x1, 0x13, 0x80, 0x46, 0x1, 0xf3, 0x20,
+    0x51, 0x0, 0x78, 0xc0, 0x33, 0x80, 0x46, 0x1,
+    0xe3, 0x90, 0x55, 0x0, 0x7c, 0x60, 0x18, 0x80,
+    0x2e, 0x0, 0xf7, 0x1, 0x50, 0x7, 0xe7, 0x0,
+    0x88, 0x44, 0x0, 0x50, 0xe, 0xa2, 0xe, 0x0,
+    0xfe, 0xc0, 0x9, 0xc1, 0xc0, 0x4, 0x60, 0x12,
+    0xa8, 0x24, 0xc0, 0x3f, 0x9c, 0x0, 0x44, 0xa,
+    0x0, 0xbc, 0x0, 0x54, 0x8, 0xc0, 0x1f, 0xd0,
+    0x20, 0xa, 0x0, 0x1a, 0x0, 0xe, 0x43, 0x80,
+    0x68, 0x3, 0xf9, 0x5c, 0x0, 0x2c, 0x1, 0x48,
+    0x4, 0xde, 0x61, 0xa2, 0x1, 0xf9, 0x68, 0x2,
+    0xb1, 0x0, 0x8a, 0x80, 0x39, 0xc, 0x3, 0xe1,
+    0x9a, 0x0, 0x99, 0x40, 0x39, 0x64, 0x3, 0x26,
+    0x3a, 0x19, 0x1b, 0x57, 0x30, 0x4, 0xb2, 0x1,
+    0xf3, 0x0, 0x71, 0xc5, 0xe6, 0xe4, 0xa8, 0x6,
+    0x8a, 0x0, 0xfd, 0x0, 0x3, 0x10, 0xf, 0xf9,
+    0xb9, 0xc0, 0x3f, 0x23, 0x83, 0xe7, 0x5b, 0x18,
+    0x80, 0x4, 0x96, 0x7a, 0x44, 0x3, 0xf0, 0xd0,
+    0x1c, 0x0, 0x12, 0x73, 0xbf, 0xdd, 0xb4, 0xc2,
+    0x1, 0xfe, 0xa1, 0xe, 0x0, 0xff, 0xe5, 0x0,
 
     /* U+00D9 "Ù" */
-    0x0, 0x0, 0xa, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x4f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xfe,
-    0x85, 0x32, 0x36, 0xcf, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0xea, 0xff, 0xa0, 0x3, 0xff, 0x8b, 0x4e,
+    0x0, 0x78, 0x0, 0xff, 0xe2, 0xc5, 0x0, 0x1e,
+    0x0, 0x3f, 0xf8, 0xab, 0x82, 0xe, 0xe0, 0xf,
+    0xfe, 0x29, 0xf9, 0x84, 0x38, 0x7, 0xff, 0x14,
+    0x73, 0xfc, 0xe0, 0x1f, 0xfd, 0x27, 0xff, 0x88,
+    0x3, 0xff, 0x83, 0x3f, 0xee, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f,
+    0xff, 0x11, 0x0, 0x84, 0x3, 0xff, 0x82, 0x60,
+    0x3, 0x30, 0x4, 0xe0, 0x1f, 0xfc, 0x11, 0x0,
+    0x8, 0x80, 0x22, 0x0, 0xff, 0xe0, 0xa8, 0x1,
+    0xd0, 0x2, 0xc0, 0xf, 0xfc, 0x42, 0x0, 0xc0,
+    0x30, 0x2, 0x88, 0x7, 0xfd, 0x40, 0x12, 0x5,
+    0x0, 0x56, 0x1, 0xfe, 0x37, 0x0, 0x11, 0x83,
+    0x10, 0x1, 0x68, 0x3, 0xf2, 0x68, 0x5, 0x0,
+    0x17, 0x0, 0x4b, 0xd0, 0xa6, 0x46, 0xd9, 0x62,
+    0x0, 0x65, 0x0, 0x8e, 0xc0, 0x21, 0x7a, 0xcd,
+    0xc9, 0x30, 0x9, 0x64, 0x3, 0x93, 0x50, 0x3,
+    0xfc, 0x33, 0x40, 0x1f, 0x15, 0xec, 0x20, 0x80,
+    0x4, 0x9a, 0xb9, 0x80, 0x30,
 
     /* U+00DA "Ú" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xef, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xb1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x4f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xfe,
-    0x85, 0x32, 0x36, 0xcf, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xc5, 0xdf, 0xf2, 0x0, 0x7f, 0xf0,
+    0xcb, 0x4, 0xb, 0x50, 0x3, 0xff, 0x84, 0x3e,
+    0x20, 0x98, 0x40, 0x1f, 0xfc, 0x21, 0xc2, 0x6,
+    0xb1, 0x0, 0xff, 0xe1, 0xe, 0x10, 0x4c, 0x80,
+    0x3f, 0xf8, 0x83, 0xbf, 0xe6, 0x0, 0xff, 0xe9,
+    0xbf, 0xfc, 0x40, 0x1f, 0xfc, 0x19, 0xff, 0x70,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe, 0x1, 0xff,
+    0xff, 0x0, 0xff, 0xf8, 0x88, 0x4, 0x20, 0x1f,
+    0xfc, 0x13, 0x0, 0x19, 0x80, 0x27, 0x0, 0xff,
+    0xe0, 0x88, 0x0, 0x44, 0x1, 0x10, 0x7, 0xff,
+    0x5, 0x40, 0xe, 0x80, 0x16, 0x0, 0x7f, 0xe2,
+    0x10, 0x6, 0x1, 0x80, 0x14, 0x40, 0x3f, 0xea,
+    0x0, 0x90, 0x28, 0x2, 0xb0, 0xf, 0xf1, 0xb8,
+    0x0, 0x8c, 0x18, 0x80, 0xb, 0x40, 0x1f, 0x93,
+    0x40, 0x28, 0x0, 0xb8, 0x2, 0x5e, 0x85, 0x32,
+    0x36, 0xcb, 0x10, 0x3, 0x28, 0x4, 0x76, 0x1,
+    0xb, 0xd6, 0x6e, 0x49, 0x80, 0x4b, 0x20, 0x1c,
+    0x9a, 0x80, 0x1f, 0xe1, 0x9a, 0x0, 0xf8, 0xaf,
+    0x61, 0x4, 0x0, 0x24, 0xd5, 0xcc, 0x1, 0x80,
 
     /* U+00DB "Û" */
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xb5, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0, 0x3e,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0x70, 0x0, 0x2, 0xdf, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x4f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xfe,
-    0x85, 0x32, 0x36, 0xcf, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0xfc, 0x3b, 0xff, 0x30, 0x7, 0xff, 0x13,
+    0x48, 0x2, 0x95, 0x0, 0xff, 0xe1, 0x61, 0x82,
+    0x50, 0x2, 0x94, 0x3, 0xff, 0x59, 0x83, 0x5a,
+    0xe0, 0x85, 0x20, 0x7, 0xfa, 0xd0, 0x22, 0x40,
+    0x7, 0x84, 0x16, 0x80, 0x1f, 0xd7, 0xfe, 0x70,
+    0xc, 0x5b, 0xfe, 0x40, 0xf, 0xfe, 0x73, 0xff,
+    0xc4, 0x1, 0xff, 0xc1, 0x9f, 0xf7, 0x0, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0x88, 0x80, 0x42, 0x1, 0xff, 0xc1,
+    0x30, 0x1, 0x98, 0x2, 0x70, 0xf, 0xfe, 0x8,
+    0x80, 0x4, 0x40, 0x11, 0x0, 0x7f, 0xf0, 0x54,
+    0x0, 0xe8, 0x1, 0x60, 0x7, 0xfe, 0x21, 0x0,
+    0x60, 0x18, 0x1, 0x44, 0x3, 0xfe, 0xa0, 0x9,
+    0x2, 0x80, 0x2b, 0x0, 0xff, 0x1b, 0x80, 0x8,
+    0xc1, 0x88, 0x0, 0xb4, 0x1, 0xf9, 0x34, 0x2,
+    0x80, 0xb, 0x80, 0x25, 0xe8, 0x53, 0x23, 0x6c,
+    0xb1, 0x0, 0x32, 0x80, 0x47, 0x60, 0x10, 0xbd,
+    0x66, 0xe4, 0x98, 0x4, 0xb2, 0x1, 0xc9, 0xa8,
+    0x1, 0xfe, 0x19, 0xa0, 0xf, 0x8a, 0xf6, 0x10,
+    0x40, 0x2, 0x4d, 0x5c, 0xc0, 0x18,
 
     /* U+00DC "Ü" */
-    0x0, 0x0, 0x0, 0x19, 0x80, 0x0, 0x4, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfa, 0x0, 0x2f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xd3, 0x0, 0x9,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe,
-    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfe, 0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfe, 0x6f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfd, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x4f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf7, 0xc, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xf3, 0x6, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xd0, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x4, 0xef, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xfe,
-    0x85, 0x32, 0x36, 0xcf, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x27, 0xbe, 0xff, 0xed, 0x95, 0x0, 0x0, 0x0,
+    0x0, 0xf0, 0xcc, 0x0, 0x64, 0x95, 0x0, 0xff,
+    0xd4, 0xcf, 0x20, 0x1, 0xb6, 0xa4, 0x0, 0xff,
+    0x98, 0x0, 0x60, 0x3, 0x0, 0x84, 0x3, 0xfe,
+    0x81, 0x29, 0x0, 0x13, 0x2, 0x28, 0x7, 0xfc,
+    0xbd, 0xa6, 0x1, 0x4f, 0xd8, 0x7, 0xff, 0x99,
+    0xff, 0xe2, 0x0, 0xff, 0xe0, 0xcf, 0xfb, 0x80,
+    0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xff,
+    0xf8, 0x7, 0xff, 0xc4, 0x40, 0x21, 0x0, 0xff,
+    0xe0, 0x98, 0x0, 0xcc, 0x1, 0x38, 0x7, 0xff,
+    0x4, 0x40, 0x2, 0x20, 0x8, 0x80, 0x3f, 0xf8,
+    0x2a, 0x0, 0x74, 0x0, 0xb0, 0x3, 0xff, 0x10,
+    0x80, 0x30, 0xc, 0x0, 0xa2, 0x1, 0xff, 0x50,
+    0x4, 0x81, 0x40, 0x15, 0x80, 0x7f, 0x8d, 0xc0,
+    0x4, 0x60, 0xc4, 0x0, 0x5a, 0x0, 0xfc, 0x9a,
+    0x1, 0x40, 0x5, 0xc0, 0x12, 0xf4, 0x29, 0x91,
+    0xb6, 0x58, 0x80, 0x19, 0x40, 0x23, 0xb0, 0x8,
+    0x5e, 0xb3, 0x72, 0x4c, 0x2, 0x59, 0x0, 0xe4,
+    0xd4, 0x0, 0xff, 0xc, 0xd0, 0x7, 0xc5, 0x7b,
+    0x8, 0x20, 0x1, 0x26, 0xae, 0x60, 0xc,
 
     /* U+00DD "Ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0x88, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xfe, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf2, 0x3, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x0, 0x9, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfd, 0x0, 0x0, 0x1e, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0x40, 0x0, 0x0, 0x6f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xbf,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xd0, 0x0, 0x0, 0x5f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x80, 0x0, 0x1e,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x20, 0x9, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfb, 0x3,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xf5, 0xcf, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe1, 0x1c, 0x44, 0xc0, 0x1f, 0xfc,
+    0x74, 0xc7, 0x72, 0x38, 0x7, 0xff, 0x19, 0x6c,
+    0x0, 0xf8, 0x20, 0x1f, 0xfc, 0x56, 0xa0, 0x1b,
+    0x80, 0xf, 0xfe, 0x33, 0xc8, 0x1f, 0xa0, 0x7,
+    0xff, 0x1d, 0xff, 0xd8, 0x20, 0x1f, 0xfd, 0x8d,
+    0xff, 0x70, 0x80, 0x7f, 0xf0, 0x9b, 0xfe, 0x20,
+    0xe0, 0x0, 0xc0, 0x7, 0xff, 0x4, 0x64, 0x0,
+    0xe4, 0x6, 0xc0, 0x6, 0x30, 0xf, 0xfd, 0x60,
+    0x2, 0x80, 0xa, 0x4, 0x1, 0xc0, 0x1f, 0xf2,
+    0x28, 0x2, 0x40, 0x30, 0xc0, 0x0, 0x9c, 0x3,
+    0xfd, 0x20, 0x5, 0x40, 0xe, 0x63, 0x0, 0x40,
+    0x80, 0x7e, 0x82, 0x0, 0x58, 0x7, 0xdc, 0x1,
+    0x58, 0x7, 0xc4, 0xe0, 0x8, 0x10, 0xf, 0x89,
+    0xc0, 0xa, 0x80, 0x1e, 0x90, 0x1, 0x38, 0x7,
+    0xf4, 0x8, 0x2, 0x40, 0x39, 0x50, 0x1, 0xc0,
+    0x1f, 0xf5, 0x0, 0xa, 0x0, 0x21, 0xb0, 0x3,
+    0x18, 0x7, 0xfc, 0x88, 0x0, 0x39, 0x0, 0x20,
+    0x40, 0x60, 0x3, 0xff, 0x83, 0x40, 0x14, 0x81,
+    0xb0, 0x2, 0x4, 0x3, 0xff, 0x82, 0x30, 0x0,
+    0x45, 0xf0, 0x1, 0xb0, 0x7, 0xff, 0xd, 0xc8,
+    0x1, 0x46, 0x0, 0xe0, 0xf, 0xfe, 0x2f, 0x0,
+    0x73, 0x90, 0x7, 0xff, 0x14, 0xd8, 0x2, 0x18,
+    0x0, 0xff, 0xe3, 0xd8, 0x5, 0x20, 0x1f, 0xfc,
+    0xc1, 0x0, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xc0,
+    0x3f, 0xfa, 0xe0,
 
     /* U+00DE "Þ" */
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb,
-    0x72, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x3f, 0xff, 0x61, 0x11, 0x11, 0x12,
-    0x48, 0xdf, 0xff, 0xf5, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfe, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x70, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xc0, 0x3f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xf1, 0x3f, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf1, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xc0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x70,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfe, 0x10, 0x3f, 0xff, 0x60, 0x0, 0x0,
-    0x1, 0x37, 0xdf, 0xff, 0xf5, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xeb, 0x82, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x3f, 0xf9, 0x80, 0x3f, 0xfe, 0xb3, 0xff, 0xf6,
+    0xdb, 0x90, 0x7, 0xff, 0x18, 0x92, 0x36, 0xc8,
+    0x3, 0xff, 0x90, 0x9a, 0xa0, 0x1f, 0x4f, 0x77,
+    0xb6, 0xdc, 0x80, 0x2a, 0x50, 0xf, 0x84, 0x7c,
+    0x49, 0x1a, 0xe0, 0x15, 0x80, 0x7f, 0xf1, 0x61,
+    0xc0, 0x2, 0xe0, 0x1f, 0xfc, 0x58, 0x10, 0x5,
+    0x80, 0x7f, 0xf1, 0x90, 0x0, 0x60, 0x1f, 0xfc,
+    0x62, 0x0, 0x84, 0x3, 0xff, 0xb6, 0x40, 0x10,
+    0x80, 0x7f, 0xf1, 0x50, 0x0, 0x60, 0x1f, 0xfc,
+    0x58, 0x10, 0x5, 0x80, 0x7f, 0xf1, 0x1d, 0xc0,
+    0x1, 0x60, 0xf, 0xfc, 0x26, 0xfb, 0x0, 0x15,
+    0x88, 0x7, 0x4f, 0xff, 0xbb, 0x20, 0x80, 0x29,
+    0x50, 0xf, 0xfe, 0x31, 0xeb, 0x0, 0x7f, 0xf0,
+    0xc5, 0x1f, 0x70, 0x80, 0x3f, 0x4f, 0xff, 0xdd,
+    0x70, 0x40, 0x1f, 0xff, 0xc0,
 
     /* U+00DF "ß" */
-    0x0, 0x0, 0x5, 0xad, 0xff, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xa1, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x3, 0xff,
-    0xff, 0x93, 0x0, 0x14, 0xbf, 0xff, 0xc0, 0x0,
-    0xd, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xf4, 0x0, 0x3f, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf8, 0x0, 0x7f, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0xaf, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf8, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf4, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xd0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x16, 0xdf, 0xfe, 0x20, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x6e, 0xff, 0xff, 0xd2, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfb,
-    0x30, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x38, 0xef, 0xff, 0x70, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xf1,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xf7, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xfb, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfc, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfb,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf8, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xf3, 0xbf, 0xfb, 0x0, 0x3,
-    0x31, 0x0, 0x26, 0xdf, 0xff, 0xa0, 0xbf, 0xfb,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xbf, 0xfb, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0xbf, 0xfb, 0x0, 0x8, 0xce, 0xff,
-    0xdb, 0x72, 0x0, 0x0,
+    0x0, 0xe5, 0xad, 0xff, 0x76, 0x41, 0x80, 0x7f,
+    0x1e, 0xd2, 0x90, 0x0, 0x4d, 0xf2, 0x84, 0x3,
+    0xcd, 0x84, 0x1, 0xfc, 0xb8, 0x20, 0x18, 0xe4,
+    0x2, 0x6c, 0xff, 0x75, 0xa0, 0x0, 0xb4, 0x3,
+    0x70, 0x5, 0x92, 0x60, 0x1, 0x4b, 0x70, 0x1,
+    0xa0, 0x0, 0xc8, 0x1, 0x26, 0x1, 0xf4, 0x8,
+    0x3, 0x0, 0x8, 0x1, 0x30, 0x7, 0xf2, 0x80,
+    0x8, 0x1, 0xa0, 0x2, 0x0, 0xff, 0x38, 0x0,
+    0x80, 0x2, 0x0, 0x60, 0xf, 0xe1, 0x30, 0x6,
+    0x0, 0x7f, 0xf0, 0xe8, 0x0, 0x48, 0x1, 0xff,
+    0x85, 0xb5, 0x0, 0x7c, 0x3, 0xfe, 0x6e, 0xe4,
+    0x90, 0x16, 0x10, 0x7, 0xfc, 0x22, 0x0, 0xc5,
+    0x26, 0x1, 0xff, 0xc6, 0x4c, 0x70, 0xf, 0xf3,
+    0xff, 0xd8, 0xe2, 0x0, 0x87, 0x0, 0xff, 0xe0,
+    0x9c, 0x79, 0x0, 0x20, 0x40, 0x3f, 0xf8, 0x43,
+    0xe0, 0x13, 0x0, 0x7f, 0xf0, 0xc8, 0xc0, 0x18,
+    0x1, 0xff, 0xc4, 0x70, 0x3, 0x80, 0x7f, 0xf1,
+    0x1c, 0x0, 0xe0, 0x1f, 0xfc, 0x31, 0x30, 0x1,
+    0x80, 0x7f, 0xf0, 0xf4, 0x2, 0xb0, 0xf, 0x8c,
+    0xc2, 0x0, 0x26, 0xd3, 0x0, 0x29, 0x80, 0x7d,
+    0x39, 0xdf, 0xed, 0x92, 0x0, 0x1d, 0x0, 0x7e,
+    0x70, 0xf, 0xcf, 0x80, 0x1f, 0xca, 0x62, 0x0,
+    0x24, 0x8d, 0x80, 0x8,
 
     /* U+00E0 "à" */
-    0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xc1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xfd, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x38, 0x87, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0, 0x26,
-    0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77, 0x77,
-    0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc, 0xff,
-    0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6, 0x3,
-    0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff, 0xf6,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xef,
-    0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6, 0x0,
-    0xef, 0xf6,
+    0x0, 0x9f, 0xfe, 0xc0, 0xf, 0xfe, 0xb, 0xe0,
+    0x81, 0xe0, 0x80, 0x7f, 0xe3, 0xf4, 0x3, 0xc2,
+    0x0, 0xff, 0xc3, 0x70, 0x5, 0x84, 0x1, 0xff,
+    0xc1, 0x7c, 0x76, 0x50, 0xf, 0xfe, 0x11, 0xc4,
+    0x1c, 0x3, 0xff, 0xa0, 0x71, 0x7d, 0xfe, 0xec,
+    0x82, 0x0, 0xf2, 0xee, 0x3a, 0x8, 0x0, 0x4d,
+    0xf6, 0x80, 0x33, 0x51, 0x0, 0x7f, 0x97, 0x0,
+    0x27, 0x0, 0xb, 0xe7, 0xfd, 0xb2, 0x20, 0x3,
+    0x70, 0x0, 0xcc, 0x74, 0x18, 0x4, 0x4d, 0xe2,
+    0x0, 0x90, 0x9, 0x9c, 0x3, 0xf0, 0xc0, 0x0,
+    0x48, 0x3, 0xff, 0x82, 0x80, 0x13, 0x0, 0x7f,
+    0xf0, 0x4c, 0x2, 0x10, 0x8, 0x5e, 0xfb, 0xff,
+    0xdc, 0x1, 0x18, 0x1, 0x7a, 0x10, 0x40, 0x3f,
+    0xf2, 0x50, 0x4, 0x8f, 0x11, 0xe0, 0xe, 0x90,
+    0x0, 0xed, 0xc3, 0xbf, 0x30, 0x6, 0x12, 0x0,
+    0x41, 0x0, 0x7f, 0xe3, 0x0, 0x94, 0x3, 0xf2,
+    0x80, 0x63, 0x0, 0x94, 0x3, 0xf4, 0x80, 0x61,
+    0x30, 0x4, 0x18, 0x7, 0x16, 0x90, 0x7, 0x78,
+    0x0, 0x72, 0xe1, 0xe3, 0x34, 0x84, 0x3, 0x8e,
+    0xc4, 0x0, 0x8f, 0xe, 0x60, 0x5a, 0x20, 0x1c,
+    0x9f, 0x28, 0x20, 0x2, 0x59, 0xd3, 0x0, 0xc0,
 
     /* U+00E1 "á" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xef,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0x88, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0, 0x26,
-    0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77, 0x77,
-    0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc, 0xff,
-    0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6, 0x3,
-    0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff, 0xf6,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xef,
-    0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6, 0x0,
-    0xef, 0xf6,
+    0x0, 0xff, 0xe, 0x7f, 0xcc, 0x1, 0xff, 0xe,
+    0x18, 0x16, 0x30, 0x7, 0xf8, 0xbc, 0x81, 0x74,
+    0xc0, 0x3f, 0xc7, 0x82, 0x13, 0x40, 0x1f, 0xf9,
+    0x19, 0xf5, 0x80, 0x3f, 0xf8, 0x2f, 0x10, 0x20,
+    0xf, 0xfe, 0x89, 0xc5, 0xf7, 0xfb, 0xb2, 0x8,
+    0x3, 0xcb, 0xb8, 0xe8, 0x20, 0x1, 0x37, 0xda,
+    0x0, 0xcd, 0x44, 0x1, 0xfe, 0x5c, 0x0, 0x9c,
+    0x0, 0x2f, 0x9f, 0xf6, 0xc8, 0x80, 0xd, 0xc0,
+    0x3, 0x31, 0xd0, 0x60, 0x11, 0x37, 0x88, 0x2,
+    0x40, 0x26, 0x70, 0xf, 0xc3, 0x0, 0x1, 0x20,
+    0xf, 0xfe, 0xa, 0x0, 0x4c, 0x1, 0xff, 0xc1,
+    0x30, 0x8, 0x40, 0x21, 0x7b, 0xef, 0xff, 0x70,
+    0x4, 0x60, 0x5, 0xe8, 0x41, 0x0, 0xff, 0xc9,
+    0x40, 0x12, 0x3c, 0x47, 0x80, 0x3a, 0x40, 0x3,
+    0xb7, 0xe, 0xfc, 0xc0, 0x18, 0x48, 0x1, 0x4,
+    0x1, 0xff, 0x8c, 0x2, 0x50, 0xf, 0xca, 0x1,
+    0x8c, 0x2, 0x50, 0xf, 0xd2, 0x1, 0x84, 0xc0,
+    0x10, 0x60, 0x1c, 0x5a, 0x40, 0x1d, 0xe0, 0x1,
+    0xcb, 0x87, 0x8c, 0xd2, 0x10, 0xe, 0x3b, 0x10,
+    0x2, 0x3c, 0x39, 0x81, 0x68, 0x80, 0x72, 0x7c,
+    0xa0, 0x80, 0x9, 0x67, 0x4c, 0x3,
 
     /* U+00E2 "â" */
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x91, 0xaf,
-    0xfb, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xf6, 0x0,
-    0x7, 0xff, 0xc1, 0x0, 0x0, 0x5, 0x88, 0x30,
-    0x0, 0x0, 0x48, 0x85, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0, 0x26,
-    0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77, 0x77,
-    0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc, 0xff,
-    0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6, 0x3,
-    0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff, 0xf6,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xef,
-    0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6, 0x0,
-    0xef, 0xf6,
+    0x0, 0xfa, 0xff, 0xea, 0x0, 0xff, 0xd6, 0x80,
+    0x12, 0xd0, 0x7, 0xfb, 0x10, 0x1b, 0x94, 0x16,
+    0xc0, 0x3e, 0x1c, 0x30, 0x99, 0xd, 0x40, 0x26,
+    0x8, 0x7, 0x22, 0x1f, 0x18, 0x2, 0x7b, 0x74,
+    0x40, 0x7, 0x2c, 0x40, 0xc0, 0x39, 0x22, 0xa,
+    0x1, 0xff, 0xcc, 0x38, 0xbe, 0xff, 0x76, 0x41,
+    0x0, 0x79, 0x77, 0x1d, 0x4, 0x0, 0x26, 0xfb,
+    0x40, 0x19, 0xa8, 0x80, 0x3f, 0xcb, 0x80, 0x13,
+    0x80, 0x5, 0xf3, 0xfe, 0xd9, 0x10, 0x1, 0xb8,
+    0x0, 0x66, 0x3a, 0xc, 0x2, 0x26, 0xf1, 0x0,
+    0x48, 0x4, 0xce, 0x1, 0xf8, 0x60, 0x0, 0x24,
+    0x1, 0xff, 0xc1, 0x40, 0x9, 0x80, 0x3f, 0xf8,
+    0x26, 0x1, 0x8, 0x4, 0x2f, 0x7d, 0xff, 0xee,
+    0x0, 0x8c, 0x0, 0xbd, 0x8, 0x20, 0x1f, 0xf9,
+    0x28, 0x2, 0x47, 0x88, 0xf0, 0x7, 0x48, 0x0,
+    0x76, 0xe1, 0xdf, 0x98, 0x3, 0x9, 0x0, 0x20,
+    0x80, 0x3f, 0xf1, 0x80, 0x4a, 0x1, 0xf9, 0x40,
+    0x31, 0x80, 0x4a, 0x1, 0xfa, 0x40, 0x30, 0x98,
+    0x2, 0xc, 0x3, 0x8b, 0x48, 0x3, 0xbc, 0x0,
+    0x39, 0x70, 0xf1, 0x9a, 0x42, 0x1, 0xc7, 0x62,
+    0x0, 0x47, 0x87, 0x30, 0x2d, 0x10, 0xe, 0x4f,
+    0x94, 0x10, 0x1, 0x2c, 0xe9, 0x80, 0x60,
 
     /* U+00E3 "ã" */
-    0x0, 0x0, 0x1a, 0xfe, 0xa2, 0x0, 0x8, 0xf7,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60, 0x2e,
-    0xf3, 0x0, 0x0, 0x4, 0xfe, 0x53, 0xaf, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x7, 0xf7, 0x0, 0x3,
-    0xbf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0, 0x26,
-    0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77, 0x77,
-    0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc, 0xff,
-    0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6, 0x3,
-    0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff, 0xf6,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xef,
-    0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6, 0x0,
-    0xef, 0xf6,
+    0x0, 0xc3, 0x5f, 0xd4, 0x40, 0x14, 0x7b, 0x80,
+    0x7b, 0x54, 0x5, 0x75, 0x80, 0x98, 0x10, 0x3,
+    0x90, 0xc6, 0xb1, 0x42, 0x7f, 0x45, 0xc, 0x3,
+    0x8c, 0x25, 0x4e, 0xb1, 0x0, 0xb, 0x40, 0x1e,
+    0x7f, 0x70, 0x8, 0xef, 0xfd, 0x42, 0x1, 0xff,
+    0xdf, 0x38, 0xbe, 0xff, 0x76, 0x41, 0x0, 0x79,
+    0x77, 0x1d, 0x4, 0x0, 0x26, 0xfb, 0x40, 0x19,
+    0xa8, 0x80, 0x3f, 0xcb, 0x80, 0x13, 0x80, 0x5,
+    0xf3, 0xfe, 0xd9, 0x10, 0x1, 0xb8, 0x0, 0x66,
+    0x3a, 0xc, 0x2, 0x26, 0xf1, 0x0, 0x48, 0x4,
+    0xce, 0x1, 0xf8, 0x60, 0x0, 0x24, 0x1, 0xff,
+    0xc1, 0x40, 0x9, 0x80, 0x3f, 0xf8, 0x26, 0x1,
+    0x8, 0x4, 0x2f, 0x7d, 0xff, 0xee, 0x0, 0x8c,
+    0x0, 0xbd, 0x8, 0x20, 0x1f, 0xf9, 0x28, 0x2,
+    0x47, 0x88, 0xf0, 0x7, 0x48, 0x0, 0x76, 0xe1,
+    0xdf, 0x98, 0x3, 0x9, 0x0, 0x20, 0x80, 0x3f,
+    0xf1, 0x80, 0x4a, 0x1, 0xf9, 0x40, 0x31, 0x80,
+    0x4a, 0x1, 0xfa, 0x40, 0x30, 0x98, 0x2, 0xc,
+    0x3, 0x8b, 0x48, 0x3, 0xbc, 0x0, 0x39, 0x70,
+    0xf1, 0x9a, 0x42, 0x1, 0xc7, 0x62, 0x0, 0x47,
+    0x87, 0x30, 0x2d, 0x10, 0xe, 0x4f, 0x94, 0x10,
+    0x1, 0x2c, 0xe9, 0x80, 0x60,
 
     /* U+00E4 "ä" */
-    0x0, 0x0, 0x7, 0x91, 0x0, 0x2, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xfc, 0x0, 0xd, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x2d, 0xe5, 0x0,
-    0x6, 0xed, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x1, 0xff, 0xe8, 0x30, 0x0, 0x26,
-    0xef, 0xff, 0x70, 0x0, 0x67, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5, 0x0,
-    0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77, 0x77,
-    0xff, 0xf6, 0xd, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0x1f, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0x2f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf6, 0x1f, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0xc, 0xff,
-    0xe3, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xf6, 0x3,
-    0xff, 0xff, 0xb8, 0x78, 0xcf, 0xfe, 0xff, 0xf6,
-    0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xef,
-    0xf6, 0x0, 0x1, 0x6b, 0xef, 0xfd, 0xa6, 0x0,
-    0xef, 0xf6,
+    0x0, 0xe7, 0x91, 0x0, 0x8a, 0x5c, 0x3, 0xf4,
+    0x41, 0xb4, 0x2, 0xf6, 0x87, 0x0, 0xf8, 0x80,
+    0x4, 0x1, 0x10, 0x3, 0x80, 0x3e, 0x82, 0x1b,
+    0x0, 0xa4, 0x4a, 0xc0, 0x3e, 0x2d, 0xe5, 0x0,
+    0x9b, 0xb4, 0x80, 0x3f, 0xfb, 0xe7, 0x17, 0xdf,
+    0xee, 0xc8, 0x20, 0xf, 0x2e, 0xe3, 0xa0, 0x80,
+    0x4, 0xdf, 0x68, 0x3, 0x35, 0x10, 0x7, 0xf9,
+    0x70, 0x2, 0x70, 0x0, 0xbe, 0x7f, 0xdb, 0x22,
+    0x0, 0x37, 0x0, 0xc, 0xc7, 0x41, 0x80, 0x44,
+    0xde, 0x20, 0x9, 0x0, 0x99, 0xc0, 0x3f, 0xc,
+    0x0, 0x4, 0x80, 0x3f, 0xf8, 0x28, 0x1, 0x30,
+    0x7, 0xff, 0x4, 0xc0, 0x21, 0x0, 0x85, 0xef,
+    0xbf, 0xfd, 0xc0, 0x11, 0x80, 0x17, 0xa1, 0x4,
+    0x3, 0xff, 0x25, 0x0, 0x48, 0xf1, 0x1e, 0x0,
+    0xe9, 0x0, 0xe, 0xdc, 0x3b, 0xf3, 0x0, 0x61,
+    0x20, 0x4, 0x10, 0x7, 0xfe, 0x30, 0x9, 0x40,
+    0x3f, 0x28, 0x6, 0x30, 0x9, 0x40, 0x3f, 0x48,
+    0x6, 0x13, 0x0, 0x41, 0x80, 0x71, 0x69, 0x0,
+    0x77, 0x80, 0x7, 0x2e, 0x1e, 0x33, 0x48, 0x40,
+    0x38, 0xec, 0x40, 0x8, 0xf0, 0xe6, 0x5, 0xa2,
+    0x1, 0xc9, 0xf2, 0x82, 0x0, 0x25, 0x9d, 0x30,
+    0xc,
 
     /* U+00E5 "å" */
-    0x0, 0x0, 0x0, 0x7, 0xdf, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xc9, 0xdf, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xfa, 0x0, 0xc,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf3, 0x0,
-    0x4, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x7, 0xf2,
-    0x0, 0x3, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xf6, 0x0, 0x8, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0x63, 0x7f, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1c, 0xff, 0xfb, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x34, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xec,
-    0x82, 0x0, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff, 0xe8,
-    0x30, 0x0, 0x26, 0xef, 0xff, 0x70, 0x0, 0x67,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xf5, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x4, 0xff, 0xff, 0xb8,
-    0x77, 0x77, 0x77, 0xff, 0xf6, 0xd, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0x1f, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0x2f,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6,
-    0x1f, 0xff, 0x60, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf6, 0xc, 0xff, 0xe3, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xf6, 0x3, 0xff, 0xff, 0xb8, 0x78, 0xcf,
-    0xfe, 0xff, 0xf6, 0x0, 0x4e, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0xef, 0xf6, 0x0, 0x1, 0x6b, 0xef,
-    0xfd, 0xa6, 0x0, 0xef, 0xf6,
+    0x0, 0xf9, 0xf7, 0xf5, 0x80, 0x3f, 0xf4, 0x40,
+    0x58, 0x25, 0xc0, 0x3f, 0xc4, 0xeb, 0x93, 0xa7,
+    0x2, 0x1, 0xfc, 0xa1, 0x20, 0x14, 0x2, 0x0,
+    0x7f, 0xc2, 0x1, 0x38, 0x18, 0x7, 0xf1, 0x82,
+    0x0, 0x56, 0xa, 0x1, 0xfc, 0x85, 0x2c, 0x6e,
+    0xe4, 0x30, 0xf, 0xf6, 0x1c, 0xe4, 0x25, 0x0,
+    0x7f, 0xc3, 0x98, 0xbd, 0xb1, 0x0, 0xff, 0xe0,
+    0x9a, 0x10, 0x7, 0xfc, 0x71, 0x7d, 0xfe, 0xec,
+    0x82, 0x0, 0xf2, 0xee, 0x3a, 0x8, 0x0, 0x4d,
+    0xf6, 0x80, 0x33, 0x51, 0x0, 0x7f, 0x97, 0x0,
+    0x27, 0x0, 0xb, 0xe7, 0xfd, 0xb2, 0x20, 0x3,
+    0x70, 0x0, 0xcc, 0x74, 0x18, 0x4, 0x4d, 0xe2,
+    0x0, 0x90, 0x9, 0x9c, 0x3, 0xf0, 0xc0, 0x0,
+    0x48, 0x3, 0xff, 0x82, 0x80, 0x13, 0x0, 0x7f,
+    0xf0, 0x4c, 0x2, 0x10, 0x8, 0x5e, 0xfb, 0xff,
+    0xdc, 0x1, 0x18, 0x1, 0x7a, 0x10, 0x40, 0x3f,
+    0xf2, 0x50, 0x4, 0x8f, 0x11, 0xe0, 0xe, 0x90,
+    0x0, 0xed, 0xc3, 0xbf, 0x30, 0x6, 0x12, 0x0,
+    0x41, 0x0, 0x7f, 0xe3, 0x0, 0x94, 0x3, 0xf2,
+    0x80, 0x63, 0x0, 0x94, 0x3, 0xf4, 0x80, 0x61,
+    0x30, 0x4, 0x18, 0x7, 0x16, 0x90, 0x7, 0x78,
+    0x0, 0x72, 0xe1, 0xe3, 0x34, 0x84, 0x3, 0x8e,
+    0xc4, 0x0, 0x8f, 0xe, 0x60, 0x5a, 0x20, 0x1c,
+    0x9f, 0x28, 0x20, 0x2, 0x59, 0xd3, 0x0, 0xc0,
 
     /* U+00E6 "æ" */
-    0x0, 0x0, 0x38, 0xbe, 0xff, 0xec, 0x82, 0x0,
-    0x0, 0x2, 0x7c, 0xef, 0xfd, 0x93, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x40, 0x0, 0x1, 0xff, 0xe8, 0x41, 0x0,
-    0x16, 0xef, 0xff, 0xef, 0xff, 0xb4, 0x0, 0x3,
-    0x9f, 0xff, 0xe2, 0x0, 0x0, 0x66, 0x0, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
-    0x0, 0x1, 0x7b, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x4, 0xff, 0xff, 0xb8, 0x77, 0x77,
-    0x77, 0xff, 0xfb, 0x77, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x70, 0xd, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0x80, 0x0, 0xb,
-    0xff, 0xf6, 0x0, 0x0, 0x4, 0xdf, 0xfa, 0xcf,
-    0xff, 0xe7, 0x20, 0x1, 0x4a, 0xff, 0xf6, 0x0,
-    0x2, 0xff, 0xff, 0xec, 0xab, 0xef, 0xff, 0xd1,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x20, 0x0, 0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xc7,
-    0x20, 0x0, 0x0, 0x1, 0x6b, 0xde, 0xfe, 0xc8,
-    0x30, 0x0, 0x0,
+    0x0, 0xc7, 0x17, 0xdf, 0xee, 0xc8, 0x20, 0xe,
+    0x27, 0xce, 0xff, 0x6c, 0x98, 0x7, 0xe5, 0xdc,
+    0x74, 0x10, 0x0, 0x9b, 0xec, 0x80, 0x51, 0xb0,
+    0x62, 0x0, 0x26, 0xcb, 0x10, 0xe, 0x6a, 0x20,
+    0xf, 0xf3, 0x50, 0xe3, 0x80, 0x7f, 0x27, 0xa0,
+    0x6, 0x70, 0x0, 0xbd, 0xf7, 0xfb, 0xa4, 0x40,
+    0xb, 0xe6, 0x0, 0x4b, 0xff, 0xb1, 0x80, 0x3,
+    0x44, 0x1, 0xc, 0xcb, 0xa1, 0x4, 0x0, 0x2d,
+    0xe2, 0x0, 0x10, 0x5, 0x5a, 0x0, 0x47, 0x38,
+    0x20, 0x3c, 0x1, 0x99, 0x80, 0x1f, 0x86, 0x0,
+    0x34, 0xa8, 0x7, 0xc7, 0x40, 0x3, 0x50, 0xf,
+    0xfe, 0x12, 0x0, 0x44, 0xc0, 0x1f, 0xc8, 0x80,
+    0x7, 0x80, 0x7f, 0xf0, 0x8c, 0x2, 0x40, 0xf,
+    0xfb, 0x40, 0x8, 0x1, 0x85, 0xef, 0xbf, 0xfd,
+    0xc0, 0x13, 0x7f, 0xff, 0xd2, 0x0, 0x10, 0x9,
+    0x7a, 0x10, 0x40, 0x3f, 0xf9, 0xc2, 0x9, 0x40,
+    0x12, 0x3c, 0x47, 0x80, 0x24, 0x88, 0xff, 0xe1,
+    0x88, 0x48, 0x0, 0xba, 0xe1, 0xdf, 0x98, 0x2,
+    0x17, 0x7f, 0xfe, 0x18, 0x9, 0x0, 0x20, 0x40,
+    0x3e, 0x30, 0x9, 0x44, 0x3, 0xff, 0x86, 0x60,
+    0x13, 0x0, 0x7e, 0x40, 0xd, 0x60, 0x1f, 0xfc,
+    0x33, 0x0, 0xac, 0x3, 0xe1, 0x80, 0xc, 0xb2,
+    0x1, 0xf8, 0xb6, 0x0, 0x21, 0x40, 0x3, 0xb0,
+    0x7, 0x26, 0x8, 0x29, 0x80, 0x1b, 0x9c, 0x80,
+    0x2, 0x95, 0xa4, 0xec, 0x1, 0x48, 0x5, 0x3d,
+    0x95, 0x7d, 0x64, 0x5, 0x7a, 0x40, 0x1, 0x8d,
+    0xff, 0x75, 0xa8, 0x0, 0x54, 0x2, 0x2c, 0x20,
+    0x0, 0x9a, 0xa0, 0x80, 0x17, 0x4, 0x5a, 0xe0,
+    0x1f, 0xe4, 0xc3, 0x0, 0xc7, 0xb4, 0xa4, 0x0,
+    0x13, 0x8d, 0xa1, 0x0, 0xa3, 0xa5, 0x8, 0x40,
+    0x4d, 0xf2, 0xc8, 0x2,
 
     /* U+00E7 "ç" */
-    0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xd9, 0x40,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x5, 0xff, 0xff,
-    0xa4, 0x10, 0x14, 0xbf, 0xff, 0xe1, 0x2, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
-    0xaf, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x52,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x52, 0x0, 0x2, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x5f, 0xf9, 0x0, 0x4,
-    0xff, 0xff, 0xa4, 0x10, 0x14, 0xaf, 0xff, 0xe1,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x49, 0xef,
-    0xff, 0xd9, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x13, 0xaf, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x53,
-    0x1, 0x8f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7c, 0xed, 0xb5, 0x0, 0x0, 0x0,
-    0x0,
+    0x0, 0xf2, 0x4e, 0x77, 0xfb, 0x65, 0x0, 0x3f,
+    0x16, 0x5b, 0x18, 0x80, 0x9, 0xaf, 0x8, 0x3,
+    0x9b, 0x4c, 0x3, 0xf8, 0xf4, 0xc0, 0x25, 0x90,
+    0x9, 0x6f, 0xbf, 0xad, 0x0, 0x2d, 0x10, 0x2a,
+    0x0, 0xae, 0x90, 0x40, 0x52, 0xe8, 0x0, 0xc2,
+    0x10, 0x1, 0x5a, 0x0, 0x7c, 0xb5, 0xb0, 0x0,
+    0x50, 0x2, 0xa0, 0x7, 0xf2, 0x90, 0x1, 0x0,
+    0x2e, 0x0, 0xff, 0xe1, 0x10, 0x4, 0xa0, 0x1f,
+    0xfc, 0x21, 0x0, 0x84, 0x3, 0xff, 0x84, 0x20,
+    0x10, 0x80, 0x7f, 0xf0, 0x88, 0x2, 0x50, 0xf,
+    0xfe, 0x12, 0x0, 0x5c, 0x1, 0xff, 0xc3, 0x50,
+    0x2, 0xa0, 0x7, 0xf2, 0x90, 0x5, 0x0, 0x15,
+    0x20, 0x7, 0xcb, 0x5b, 0x20, 0x2, 0xb0, 0x0,
+    0xdd, 0x20, 0x80, 0xa5, 0x50, 0x0, 0xe2, 0x0,
+    0x49, 0x0, 0x96, 0xfb, 0xfa, 0xd4, 0x2, 0xd1,
+    0x0, 0x9b, 0x4c, 0x3, 0xf8, 0xf8, 0xc0, 0x38,
+    0xb2, 0xd8, 0x40, 0x22, 0x6b, 0xc1, 0x0, 0xfc,
+    0x93, 0x20, 0x7f, 0xd9, 0x40, 0xf, 0xfd, 0x80,
+    0x1, 0x0, 0xff, 0xe1, 0xa0, 0x3f, 0x30, 0x7,
+    0xff, 0xb, 0xb1, 0x42, 0x44, 0x3, 0xff, 0x82,
+    0x27, 0x0, 0x4, 0x0, 0xff, 0x94, 0xc0, 0x68,
+    0x0, 0xc0, 0x1f, 0xe1, 0xac, 0xfe, 0x70, 0x53,
+    0x0, 0xff, 0xc, 0x18, 0x92, 0x55, 0x0, 0x3c,
 
     /* U+00E8 "è" */
-    0x0, 0x1, 0xcf, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4e,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xbf, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0x88, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xd5,
-    0x10, 0x0, 0x4c, 0xff, 0xf8, 0x0, 0x2, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xc0, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x6f, 0xff, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x73, 0x4f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x51, 0x0, 0x26, 0xdf, 0xfd, 0x10, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xda, 0x60, 0x0, 0x0,
+    0x0, 0x87, 0x3f, 0xe6, 0x0, 0xff, 0xe1, 0xe,
+    0x38, 0x2, 0x5c, 0x3, 0xff, 0x87, 0x16, 0x21,
+    0x10, 0x0, 0xff, 0xe1, 0xa7, 0xa0, 0x3d, 0x0,
+    0x7f, 0xf0, 0xc6, 0xe5, 0xc8, 0xc0, 0x3f, 0xf8,
+    0x8d, 0x10, 0x30, 0xf, 0xfe, 0xaa, 0xd6, 0xff,
+    0xba, 0xd8, 0x40, 0x3f, 0x93, 0xa9, 0x48, 0x0,
+    0x29, 0x3c, 0xc0, 0x1f, 0x45, 0x88, 0x4, 0x22,
+    0x0, 0xd3, 0x40, 0x1c, 0xce, 0x0, 0x2a, 0xee,
+    0xbe, 0xcc, 0x0, 0xb0, 0x1, 0x14, 0x80, 0x13,
+    0x54, 0x40, 0x24, 0xc6, 0x0, 0x3a, 0x0, 0x20,
+    0x0, 0x56, 0x1, 0xfa, 0x50, 0x1, 0x0, 0x2a,
+    0x0, 0x80, 0xf, 0xf4, 0x0, 0xc, 0x54, 0x2,
+    0x40, 0xf, 0xf1, 0x88, 0x1, 0x8, 0x2, 0xef,
+    0xff, 0xf8, 0x40, 0x4, 0x20, 0x1f, 0xfc, 0x71,
+    0x0, 0xa2, 0x3f, 0xf8, 0x68, 0x40, 0x12, 0x3b,
+    0xff, 0xf0, 0x8d, 0x0, 0x2a, 0x0, 0xff, 0xe2,
+    0x28, 0x1, 0x8c, 0x3, 0xfc, 0x20, 0x1a, 0x0,
+    0x2c, 0x40, 0xf, 0xcf, 0xe4, 0x1, 0x14, 0x80,
+    0x57, 0x65, 0x10, 0x1, 0x36, 0xc0, 0xf8, 0x80,
+    0x4d, 0x0, 0x12, 0x57, 0x7f, 0xb6, 0x48, 0x0,
+    0xe2, 0x1, 0x9f, 0x8, 0x3, 0xf8, 0x62, 0x80,
+    0x3c, 0x7b, 0x6c, 0x62, 0x0, 0x25, 0x9e, 0x70,
+    0x8,
 
     /* U+00E9 "é" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xfd,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x88, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xd5,
-    0x10, 0x0, 0x4c, 0xff, 0xf8, 0x0, 0x2, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xc0, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x6f, 0xff, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x73, 0x4f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x51, 0x0, 0x26, 0xdf, 0xfd, 0x10, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xda, 0x60, 0x0, 0x0,
+    0x0, 0xff, 0x97, 0xfe, 0xd2, 0x0, 0xff, 0xe0,
+    0xb5, 0x0, 0x1b, 0x48, 0x3, 0xff, 0x3c, 0x80,
+    0x2a, 0x40, 0x3f, 0xf8, 0x31, 0x0, 0x3d, 0x50,
+    0xf, 0xfe, 0x9, 0x3, 0xc6, 0x10, 0x7, 0xff,
+    0x8, 0xa2, 0xe, 0x1, 0xff, 0xd7, 0x5a, 0xdf,
+    0xf7, 0x5b, 0x8, 0x7, 0xf2, 0x75, 0x29, 0x0,
+    0x5, 0x27, 0x98, 0x3, 0xe8, 0xb1, 0x0, 0x84,
+    0x40, 0x1a, 0x68, 0x3, 0x99, 0xc0, 0x5, 0x5d,
+    0xd7, 0xd9, 0x80, 0x16, 0x0, 0x22, 0x90, 0x2,
+    0x6a, 0x88, 0x4, 0x98, 0xc0, 0x7, 0x40, 0x4,
+    0x0, 0xa, 0xc0, 0x3f, 0x4a, 0x0, 0x20, 0x5,
+    0x40, 0x10, 0x1, 0xfe, 0x80, 0x1, 0x8a, 0x80,
+    0x48, 0x1, 0xfe, 0x31, 0x0, 0x21, 0x0, 0x5d,
+    0xff, 0xff, 0x8, 0x0, 0x84, 0x3, 0xff, 0x8e,
+    0x20, 0x14, 0x47, 0xff, 0xd, 0x8, 0x2, 0x47,
+    0x7f, 0xfe, 0x11, 0xa0, 0x5, 0x40, 0x1f, 0xfc,
+    0x45, 0x0, 0x31, 0x80, 0x7f, 0x84, 0x3, 0x40,
+    0x5, 0x88, 0x1, 0xf9, 0xfc, 0x80, 0x22, 0x90,
+    0xa, 0xec, 0xa2, 0x0, 0x26, 0xd8, 0x1f, 0x10,
+    0x9, 0xa0, 0x2, 0x4a, 0xef, 0xf6, 0xc9, 0x0,
+    0x1c, 0x40, 0x33, 0xe1, 0x0, 0x7f, 0xc, 0x50,
+    0x7, 0x8f, 0x6d, 0x8c, 0x40, 0x4, 0xb3, 0xce,
+    0x1,
 
     /* U+00EA "ê" */
-    0x0, 0x0, 0x0, 0x3, 0xef, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xf4, 0x3e, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xfd, 0x20, 0x1, 0xcf, 0xf6, 0x0, 0x0,
-    0x0, 0x1, 0x88, 0x70, 0x0, 0x0, 0x7, 0x88,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xd5,
-    0x10, 0x0, 0x4c, 0xff, 0xf8, 0x0, 0x2, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xc0, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x6f, 0xff, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x73, 0x4f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x51, 0x0, 0x26, 0xdf, 0xfd, 0x10, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xda, 0x60, 0x0, 0x0,
+    0x0, 0xf8, 0xfb, 0xfe, 0x40, 0xf, 0xfe, 0x9,
+    0xe0, 0x80, 0x56, 0xa0, 0x1f, 0xf2, 0x60, 0x2,
+    0xf0, 0x42, 0x94, 0x3, 0xf9, 0x6c, 0xb, 0x50,
+    0xfc, 0xc2, 0x98, 0x3, 0xe1, 0xd7, 0x8d, 0x20,
+    0x0, 0xe4, 0x3f, 0x8, 0x7, 0x86, 0x20, 0xe0,
+    0x1e, 0x78, 0x80, 0x80, 0x7f, 0xf4, 0x56, 0xb7,
+    0xfd, 0xd6, 0xc2, 0x1, 0xfc, 0x9d, 0x4a, 0x40,
+    0x1, 0x49, 0xe6, 0x0, 0xfa, 0x2c, 0x40, 0x21,
+    0x10, 0x6, 0x9a, 0x0, 0xe6, 0x70, 0x1, 0x57,
+    0x75, 0xf6, 0x60, 0x5, 0x80, 0x8, 0xa4, 0x0,
+    0x9a, 0xa2, 0x1, 0x26, 0x30, 0x1, 0xd0, 0x1,
+    0x0, 0x2, 0xb0, 0xf, 0xd2, 0x80, 0x8, 0x1,
+    0x50, 0x4, 0x0, 0x7f, 0xa0, 0x0, 0x62, 0xa0,
+    0x12, 0x0, 0x7f, 0x8c, 0x40, 0x8, 0x40, 0x17,
+    0x7f, 0xff, 0xc2, 0x0, 0x21, 0x0, 0xff, 0xe3,
+    0x88, 0x5, 0x11, 0xff, 0xc3, 0x42, 0x0, 0x91,
+    0xdf, 0xff, 0x84, 0x68, 0x1, 0x50, 0x7, 0xff,
+    0x11, 0x40, 0xc, 0x60, 0x1f, 0xe1, 0x0, 0xd0,
+    0x1, 0x62, 0x0, 0x7e, 0x7f, 0x20, 0x8, 0xa4,
+    0x2, 0xbb, 0x28, 0x80, 0x9, 0xb6, 0x7, 0xc4,
+    0x2, 0x68, 0x0, 0x92, 0xbb, 0xfd, 0xb2, 0x40,
+    0x7, 0x10, 0xc, 0xf8, 0x40, 0x1f, 0xc3, 0x14,
+    0x1, 0xe3, 0xdb, 0x63, 0x10, 0x1, 0x2c, 0xf3,
+    0x80, 0x40,
 
     /* U+00EB "ë" */
-    0x0, 0x0, 0x7, 0xfc, 0x10, 0x0, 0xbf, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x70, 0x5,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0x50, 0x4, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x96, 0x0, 0x0, 0x69, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfe, 0xef,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x6f, 0xff, 0xd5,
-    0x10, 0x0, 0x4c, 0xff, 0xf8, 0x0, 0x2, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0x40,
-    0xa, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xc0, 0x1f, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x4f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf5, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x6f, 0xff, 0x77, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x73, 0x4f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x10, 0x0, 0x2, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xe2, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x51, 0x0, 0x26, 0xdf, 0xfd, 0x10, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff,
-    0xda, 0x60, 0x0, 0x0,
+    0x0, 0xe7, 0xfc, 0x10, 0xa, 0xfe, 0x0, 0x3f,
+    0xd0, 0x6, 0xc0, 0x5, 0x40, 0x72, 0x0, 0xfe,
+    0x10, 0x1, 0x0, 0x4, 0x2, 0x30, 0xf, 0xed,
+    0x69, 0x50, 0x2, 0x4b, 0x58, 0x80, 0x7f, 0x1c,
+    0xb0, 0x6, 0x69, 0x40, 0xf, 0xff, 0x3a, 0xd6,
+    0xff, 0xba, 0xd8, 0x40, 0x3f, 0x93, 0xa9, 0x48,
+    0x0, 0x29, 0x3c, 0xc0, 0x1f, 0x45, 0x88, 0x4,
+    0x22, 0x0, 0xd3, 0x40, 0x1c, 0xce, 0x0, 0x2a,
+    0xee, 0xbe, 0xcc, 0x0, 0xb0, 0x1, 0x14, 0x80,
+    0x13, 0x54, 0x40, 0x24, 0xc6, 0x0, 0x3a, 0x0,
+    0x20, 0x0, 0x56, 0x1, 0xfa, 0x50, 0x1, 0x0,
+    0x2a, 0x0, 0x80, 0xf, 0xf4, 0x0, 0xc, 0x54,
+    0x2, 0x40, 0xf, 0xf1, 0x88, 0x1, 0x8, 0x2,
+    0xef, 0xff, 0xf8, 0x40, 0x4, 0x20, 0x1f, 0xfc,
+    0x71, 0x0, 0xa2, 0x3f, 0xf8, 0x68, 0x40, 0x12,
+    0x3b, 0xff, 0xf0, 0x8d, 0x0, 0x2a, 0x0, 0xff,
+    0xe2, 0x28, 0x1, 0x8c, 0x3, 0xfc, 0x20, 0x1a,
+    0x0, 0x2c, 0x40, 0xf, 0xcf, 0xe4, 0x1, 0x14,
+    0x80, 0x57, 0x65, 0x10, 0x1, 0x36, 0xc0, 0xf8,
+    0x80, 0x4d, 0x0, 0x12, 0x57, 0x7f, 0xb6, 0x48,
+    0x0, 0xe2, 0x1, 0x9f, 0x8, 0x3, 0xf8, 0x62,
+    0x80, 0x3c, 0x7b, 0x6c, 0x62, 0x0, 0x25, 0x9e,
+    0x70, 0x8,
 
     /* U+00EC "ì" */
-    0x1c, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x70, 0x0, 0x0, 0x4, 0xef, 0xf9, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x56,
-    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0,
+    0x1c, 0xff, 0x98, 0x3, 0xe, 0x38, 0x2, 0x5c,
+    0x3, 0xa2, 0xc4, 0x22, 0x40, 0x39, 0x3d, 0x1,
+    0xa8, 0x3, 0x86, 0xea, 0x70, 0xc0, 0x3c, 0xac,
+    0xc3, 0x0, 0xff, 0xe1, 0xdf, 0xfa, 0xc0, 0x3f,
+    0xff, 0xe0, 0x1f, 0xff, 0xf0, 0xf, 0xfe, 0x98,
 
     /* U+00ED "í" */
-    0x0, 0x0, 0x5f, 0xff, 0xc2, 0x0, 0x7, 0xff,
-    0xf8, 0x0, 0x0, 0x9f, 0xfe, 0x40, 0x0, 0xa,
-    0xff, 0xb1, 0x0, 0x0, 0x36, 0x65, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0,
+    0x0, 0xcb, 0xff, 0x61, 0x0, 0x4f, 0x40, 0x7,
+    0xc2, 0x0, 0x4c, 0x0, 0xdc, 0x0, 0x54, 0xc0,
+    0x9e, 0x80, 0x11, 0xe4, 0xd5, 0x88, 0x6, 0x36,
+    0x62, 0x80, 0x7f, 0xf1, 0x6f, 0xfd, 0x60, 0x1f,
+    0xff, 0xf0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x5c,
 
     /* U+00EE "î" */
-    0x0, 0x2, 0xef, 0xfe, 0x20, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0xcf, 0xf6, 0x6f,
-    0xfc, 0x0, 0xb, 0xff, 0x50, 0x5, 0xff, 0xb0,
-    0x26, 0x63, 0x0, 0x0, 0x46, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0,
+    0x0, 0x8b, 0xbf, 0xdc, 0x40, 0x1c, 0x3e, 0x20,
+    0x1, 0xf1, 0x0, 0xda, 0x41, 0x32, 0x2, 0xd0,
+    0xa, 0xcc, 0x29, 0x99, 0x40, 0x76, 0x5, 0xb3,
+    0x8a, 0x0, 0x5b, 0x9d, 0x22, 0x33, 0xc, 0x3,
+    0x23, 0x30, 0x80, 0x3f, 0xf8, 0x97, 0xfe, 0xb0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0xfc, 0x3, 0xff,
+    0xf4,
 
     /* U+00EF "ï" */
-    0x4, 0x83, 0x0, 0x38, 0x40, 0x2f, 0xff, 0x11,
-    0xff, 0xf2, 0x4f, 0xff, 0x22, 0xff, 0xf4, 0xb,
-    0xf9, 0x0, 0x9f, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xb0, 0x0,
+    0x4, 0x83, 0x0, 0x1c, 0x20, 0x15, 0xbe, 0x8,
+    0xb1, 0xec, 0x98, 0x2, 0x33, 0x0, 0x4c, 0x88,
+    0x6, 0x22, 0x30, 0x22, 0x2, 0xfe, 0x40, 0x13,
+    0xf6, 0x1, 0xff, 0xcc, 0xbf, 0xf5, 0x80, 0x7f,
+    0xff, 0xc0, 0x3f, 0xff, 0xe0, 0x1f, 0xfd, 0x50,
 
     /* U+00F0 "ð" */
-    0x0, 0x37, 0xbd, 0xef, 0xfe, 0xc9, 0x50, 0x0,
-    0x1, 0x20, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x4a, 0xfc, 0x0, 0x0, 0x6f, 0xff,
-    0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x2, 0x84, 0x10, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xb3, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7d, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xff, 0xe8, 0x25, 0xff, 0xfa, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xfb, 0x50, 0x0, 0x8, 0xff,
-    0xf2, 0x0, 0x0, 0xe, 0xfe, 0x82, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x54, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xf1, 0x0, 0x0, 0x1, 0x6a, 0xcd, 0xcb, 0x71,
-    0x0, 0x2f, 0xff, 0x40, 0x0, 0x19, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0xff, 0xf6, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf, 0xff,
-    0x70, 0x1e, 0xff, 0xfc, 0x62, 0x0, 0x27, 0xdf,
-    0xfa, 0xff, 0xf8, 0xa, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x71, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6,
-    0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x47, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf1, 0x7f, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfd, 0x5,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x70, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf1, 0x0, 0xbf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf7, 0x0, 0x2,
-    0xef, 0xff, 0xa3, 0x0, 0x0, 0x5c, 0xff, 0xfb,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xef, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xce, 0xff, 0xda, 0x60, 0x0, 0x0,
-    0x0,
+    0x0, 0x1b, 0xde, 0xf7, 0xfb, 0xb2, 0x54, 0x3,
+    0x9, 0x0, 0x6a, 0x84, 0x21, 0x0, 0x9, 0xb5,
+    0x7b, 0xa5, 0x77, 0x0, 0x37, 0x80, 0x61, 0x10,
+    0x7, 0x45, 0xa8, 0x19, 0x0, 0x48, 0xf7, 0xdf,
+    0xdc, 0xf9, 0x0, 0xf2, 0x61, 0x0, 0x45, 0x8,
+    0x20, 0x2f, 0xb2, 0x1, 0xe5, 0x20, 0xf, 0x92,
+    0xfa, 0x8, 0x5, 0xf6, 0x80, 0x3, 0x60, 0x1c,
+    0x5d, 0x68, 0x0, 0x4a, 0xe8, 0x25, 0x70, 0x2,
+    0x90, 0x6, 0x20, 0x0, 0xbe, 0xda, 0x80, 0x69,
+    0x0, 0xa8, 0x3, 0xae, 0xdd, 0x4, 0x1, 0xe1,
+    0x60, 0x2, 0x80, 0x72, 0xa0, 0x7, 0xfb, 0x0,
+    0x4, 0x20, 0x1c, 0x2d, 0x59, 0xb9, 0x6e, 0x20,
+    0x7, 0x0, 0x94, 0x2, 0x19, 0xe9, 0x53, 0x23,
+    0x48, 0xe9, 0x2, 0x0, 0x88, 0x0, 0x5e, 0xc0,
+    0x1f, 0xcd, 0x80, 0x18, 0x40, 0x70, 0x40, 0x7,
+    0x3b, 0xfe, 0xd8, 0x20, 0x3a, 0x0, 0xbc, 0x2c,
+    0x40, 0xf, 0x8c, 0x40, 0x2, 0x7d, 0x50, 0x50,
+    0xb, 0xc5, 0x40, 0x9, 0x0, 0x1f, 0xa8, 0xc0,
+    0x30, 0xa0, 0x5, 0x0, 0x1f, 0xe8, 0x0, 0xc4,
+    0x40, 0x8, 0xc0, 0x3f, 0xc8, 0x1, 0x94, 0x3,
+    0xff, 0x8e, 0x42, 0x40, 0x11, 0x80, 0x7f, 0x8c,
+    0x2, 0xa0, 0x40, 0xa, 0x40, 0x3f, 0xd0, 0x1,
+    0x30, 0xa, 0x0, 0x15, 0x80, 0x3f, 0x4a, 0x0,
+    0x20, 0x40, 0x12, 0x20, 0x9, 0xa3, 0x0, 0xcb,
+    0x8c, 0x0, 0x47, 0x0, 0x8b, 0x40, 0x25, 0xcf,
+    0xef, 0xf5, 0x18, 0x1, 0x2c, 0x3, 0x8f, 0x50,
+    0x3, 0x8, 0x6, 0x18, 0xb0, 0xf, 0x8a, 0xf1,
+    0xcc, 0x40, 0x4, 0xb3, 0xce, 0x1, 0xc0,
 
     /* U+00F1 "ñ" */
-    0x0, 0x0, 0x2b, 0xfe, 0x91, 0x0, 0xa, 0xf4,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xe5, 0x3,
-    0xff, 0x10, 0x0, 0x0, 0x6, 0xfd, 0x43, 0xbf,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x9f, 0x50,
-    0x0, 0x4b, 0xfe, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0x90, 0x4, 0x9d, 0xef,
-    0xec, 0x81, 0x0, 0x0, 0xbf, 0xf9, 0x2c, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0xb, 0xff, 0xbe,
-    0xff, 0xff, 0xee, 0xff, 0xff, 0xf9, 0x0, 0xbf,
-    0xff, 0xff, 0xa3, 0x0, 0x1, 0x7f, 0xff, 0xf4,
-    0xb, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xc0, 0xbf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0x1b, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0xbf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x5b, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xf6, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xf6, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0x6b, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf6, 0xbf, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x6b, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf6,
+    0x0, 0xc5, 0x7f, 0xd2, 0x20, 0x15, 0x7a, 0x0,
+    0x7d, 0x88, 0x2, 0xde, 0xa0, 0x6a, 0xa, 0x1,
+    0xe6, 0x12, 0xbc, 0x41, 0xaf, 0xc0, 0x61, 0x0,
+    0xf7, 0x84, 0x21, 0xdd, 0x90, 0x5, 0xa4, 0x3,
+    0xe9, 0xf5, 0x0, 0x92, 0xff, 0xa4, 0x3, 0xff,
+    0xbf, 0x7f, 0xe9, 0x0, 0x24, 0xef, 0x7f, 0x64,
+    0x8, 0x7, 0xe2, 0xcb, 0x62, 0x10, 0x13, 0x7e,
+    0x70, 0xf, 0x16, 0x18, 0x4, 0x22, 0x0, 0xd1,
+    0x20, 0x1c, 0x82, 0xb, 0x9f, 0xdd, 0x40, 0x4,
+    0xc8, 0x1, 0xe9, 0xa3, 0x0, 0x85, 0xec, 0x2,
+    0x80, 0xe, 0x56, 0x0, 0xf9, 0x14, 0x0, 0x62,
+    0x1, 0xa0, 0x3, 0xfb, 0x80, 0x25, 0x0, 0x84,
+    0x80, 0x3f, 0x98, 0x2, 0x10, 0x8, 0x80, 0x3f,
+    0xc6, 0x1, 0x18, 0x4, 0xe0, 0x1f, 0xff, 0xf0,
+    0xf, 0xff, 0xf8, 0x7, 0xff, 0x60,
 
     /* U+00F2 "ò" */
-    0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4e, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1b, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xd2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x88,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0,
-    0x0,
+    0x0, 0xd1, 0xff, 0x58, 0x7, 0xff, 0x12, 0x2c,
+    0x41, 0x30, 0x40, 0x3f, 0xf8, 0x69, 0xe8, 0x7,
+    0x82, 0x1, 0xff, 0xc3, 0x1b, 0x80, 0x2c, 0x20,
+    0xf, 0xfe, 0x23, 0xe3, 0xaa, 0x0, 0x7f, 0xf1,
+    0x4e, 0x20, 0xc0, 0x1f, 0xfd, 0x74, 0x9d, 0xff,
+    0xb2, 0x4c, 0x3, 0xfc, 0x7b, 0x6c, 0x40, 0x11,
+    0xb6, 0x60, 0x80, 0x3e, 0x7c, 0x20, 0xf, 0xe3,
+    0xd5, 0x0, 0xe5, 0x80, 0x9, 0x6f, 0xbf, 0xa9,
+    0x0, 0x2a, 0x30, 0x8, 0xa8, 0x0, 0x37, 0x48,
+    0x20, 0x2b, 0x74, 0x1, 0x68, 0x80, 0x20, 0x2,
+    0xa4, 0x0, 0xf9, 0x64, 0x0, 0x32, 0x0, 0x50,
+    0x2, 0xa0, 0x7, 0xf3, 0x18, 0x1, 0x81, 0x0,
+    0x2e, 0x0, 0xff, 0xa8, 0x0, 0x24, 0x40, 0x9,
+    0x40, 0x3f, 0xe2, 0x0, 0x98, 0x40, 0x21, 0x0,
+    0xff, 0x98, 0x2, 0x11, 0x0, 0x42, 0x1, 0xff,
+    0x30, 0x4, 0x24, 0x1, 0x28, 0x7, 0xfc, 0x60,
+    0x13, 0x20, 0x5, 0xe0, 0x1f, 0xf5, 0x0, 0x4,
+    0x81, 0x40, 0x8, 0x80, 0xf, 0xe6, 0x20, 0x4,
+    0x80, 0x20, 0x2, 0xb4, 0x0, 0xf9, 0xa4, 0x0,
+    0x2c, 0x0, 0x2a, 0x0, 0xae, 0x90, 0x40, 0x56,
+    0xe4, 0x2, 0xd1, 0x0, 0x96, 0x40, 0x25, 0xbe,
+    0xfe, 0xa4, 0x0, 0xa8, 0xc0, 0x39, 0xb0, 0x80,
+    0x3f, 0x8f, 0x54, 0x3, 0xe3, 0xdb, 0x62, 0x0,
+    0x8d, 0xaf, 0x8, 0x3,
 
     /* U+00F3 "ó" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x78, 0x82,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0,
-    0x0,
+    0x0, 0xff, 0x87, 0x7f, 0xe5, 0x0, 0xff, 0xe1,
+    0x16, 0x10, 0x16, 0xa8, 0x7, 0xff, 0x4, 0xf0,
+    0x81, 0xb4, 0x80, 0x3f, 0xf8, 0x27, 0x82, 0x15,
+    0x20, 0x1f, 0xfc, 0x34, 0x77, 0x6a, 0x80, 0x7f,
+    0xf1, 0x1e, 0x20, 0x40, 0x1f, 0xfd, 0x84, 0x9d,
+    0xff, 0xb2, 0x4c, 0x3, 0xfc, 0x7b, 0x6c, 0x40,
+    0x11, 0xb6, 0x60, 0x80, 0x3e, 0x7c, 0x20, 0xf,
+    0xe3, 0xd5, 0x0, 0xe5, 0x80, 0x9, 0x6f, 0xbf,
+    0xa9, 0x0, 0x2a, 0x30, 0x8, 0xa8, 0x0, 0x37,
+    0x48, 0x20, 0x2b, 0x74, 0x1, 0x68, 0x80, 0x20,
+    0x2, 0xa4, 0x0, 0xf9, 0x64, 0x0, 0x32, 0x0,
+    0x50, 0x2, 0xa0, 0x7, 0xf3, 0x18, 0x1, 0x81,
+    0x0, 0x2e, 0x0, 0xff, 0xa8, 0x0, 0x24, 0x40,
+    0x9, 0x40, 0x3f, 0xe2, 0x0, 0x98, 0x40, 0x21,
+    0x0, 0xff, 0x98, 0x2, 0x11, 0x0, 0x42, 0x1,
+    0xff, 0x30, 0x4, 0x24, 0x1, 0x28, 0x7, 0xfc,
+    0x60, 0x13, 0x20, 0x5, 0xe0, 0x1f, 0xf5, 0x0,
+    0x4, 0x81, 0x40, 0x8, 0x80, 0xf, 0xe6, 0x20,
+    0x4, 0x80, 0x20, 0x2, 0xb4, 0x0, 0xf9, 0xa4,
+    0x0, 0x2c, 0x0, 0x2a, 0x0, 0xae, 0x90, 0x40,
+    0x56, 0xe4, 0x2, 0xd1, 0x0, 0x96, 0x40, 0x25,
+    0xbe, 0xfe, 0xa4, 0x0, 0xa8, 0xc0, 0x39, 0xb0,
+    0x80, 0x3f, 0x8f, 0x54, 0x3, 0xe3, 0xdb, 0x62,
+    0x0, 0x8d, 0xaf, 0x8, 0x3,
 
     /* U+00F4 "ô" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xcf, 0xf9, 0x1b, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xf6, 0x0, 0x8, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x68, 0x83, 0x0, 0x0,
-    0x4, 0x88, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0,
-    0x0,
+    0x0, 0xfd, 0x7f, 0xf4, 0x80, 0x7f, 0xf0, 0x87,
+    0x10, 0x2, 0x6a, 0x0, 0xff, 0xc3, 0xa6, 0xd,
+    0xc8, 0xb, 0x40, 0x1f, 0xe1, 0xc3, 0x9, 0x90,
+    0xdb, 0x82, 0xd8, 0x7, 0xf3, 0xab, 0xe3, 0x0,
+    0x51, 0x6e, 0x68, 0x1, 0xf9, 0xa2, 0x6, 0x1,
+    0xc9, 0x10, 0x40, 0xf, 0xfe, 0x9a, 0x4e, 0xff,
+    0xd9, 0x26, 0x1, 0xfe, 0x3d, 0xb6, 0x20, 0x8,
+    0xdb, 0x30, 0x40, 0x1f, 0x3e, 0x10, 0x7, 0xf1,
+    0xea, 0x80, 0x72, 0xc0, 0x4, 0xb7, 0xdf, 0xd4,
+    0x80, 0x15, 0x18, 0x4, 0x54, 0x0, 0x1b, 0xa4,
+    0x10, 0x15, 0xba, 0x0, 0xb4, 0x40, 0x10, 0x1,
+    0x52, 0x0, 0x7c, 0xb2, 0x0, 0x19, 0x0, 0x28,
+    0x1, 0x50, 0x3, 0xf9, 0x8c, 0x0, 0xc0, 0x80,
+    0x17, 0x0, 0x7f, 0xd4, 0x0, 0x12, 0x20, 0x4,
+    0xa0, 0x1f, 0xf1, 0x0, 0x4c, 0x20, 0x10, 0x80,
+    0x7f, 0xcc, 0x1, 0x8, 0x80, 0x21, 0x0, 0xff,
+    0x98, 0x2, 0x12, 0x0, 0x94, 0x3, 0xfe, 0x30,
+    0x9, 0x90, 0x2, 0xf0, 0xf, 0xfa, 0x80, 0x2,
+    0x40, 0xa0, 0x4, 0x40, 0x7, 0xf3, 0x10, 0x2,
+    0x40, 0x10, 0x1, 0x5a, 0x0, 0x7c, 0xd2, 0x0,
+    0x16, 0x0, 0x15, 0x0, 0x57, 0x48, 0x20, 0x2b,
+    0x72, 0x1, 0x68, 0x80, 0x4b, 0x20, 0x12, 0xdf,
+    0x7f, 0x52, 0x0, 0x54, 0x60, 0x1c, 0xd8, 0x40,
+    0x1f, 0xc7, 0xaa, 0x1, 0xf1, 0xed, 0xb1, 0x0,
+    0x46, 0xd7, 0x84, 0x1, 0x80,
 
     /* U+00F5 "õ" */
-    0x0, 0x0, 0x2, 0xbf, 0xea, 0x10, 0x0, 0x9f,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x71, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xe4, 0x3a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xe6, 0x0, 0x3, 0xae, 0xd8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0,
-    0x0,
+    0x0, 0xe2, 0xbf, 0xea, 0x10, 0xa, 0x7d, 0x40,
+    0x3f, 0xbd, 0x0, 0x57, 0x9c, 0x4d, 0x81, 0xc0,
+    0x3f, 0x29, 0xd, 0xe2, 0x84, 0x76, 0x2, 0x90,
+    0x7, 0xed, 0x18, 0x43, 0xac, 0x51, 0x27, 0xa0,
+    0xf, 0xe8, 0xe6, 0x0, 0x8e, 0xbb, 0x60, 0x3,
+    0xff, 0xd4, 0x93, 0xbf, 0xf6, 0x49, 0x80, 0x7f,
+    0x8f, 0x6d, 0x88, 0x2, 0x36, 0xcc, 0x10, 0x7,
+    0xcf, 0x84, 0x1, 0xfc, 0x7a, 0xa0, 0x1c, 0xb0,
+    0x1, 0x2d, 0xf7, 0xf5, 0x20, 0x5, 0x46, 0x1,
+    0x15, 0x0, 0x6, 0xe9, 0x4, 0x5, 0x6e, 0x80,
+    0x2d, 0x10, 0x4, 0x0, 0x54, 0x80, 0x1f, 0x2c,
+    0x80, 0x6, 0x40, 0xa, 0x0, 0x54, 0x0, 0xfe,
+    0x63, 0x0, 0x30, 0x20, 0x5, 0xc0, 0x1f, 0xf5,
+    0x0, 0x4, 0x88, 0x1, 0x28, 0x7, 0xfc, 0x40,
+    0x13, 0x8, 0x4, 0x20, 0x1f, 0xf3, 0x0, 0x42,
+    0x20, 0x8, 0x40, 0x3f, 0xe6, 0x0, 0x84, 0x80,
+    0x25, 0x0, 0xff, 0x8c, 0x2, 0x64, 0x0, 0xbc,
+    0x3, 0xfe, 0xa0, 0x0, 0x90, 0x28, 0x1, 0x10,
+    0x1, 0xfc, 0xc4, 0x0, 0x90, 0x4, 0x0, 0x56,
+    0x80, 0x1f, 0x34, 0x80, 0x5, 0x80, 0x5, 0x40,
+    0x15, 0xd2, 0x8, 0xa, 0xdc, 0x80, 0x5a, 0x20,
+    0x12, 0xc8, 0x4, 0xb7, 0xdf, 0xd4, 0x80, 0x15,
+    0x18, 0x7, 0x36, 0x10, 0x7, 0xf1, 0xea, 0x80,
+    0x7c, 0x7b, 0x6c, 0x40, 0x11, 0xb5, 0xe1, 0x0,
+    0x60,
 
     /* U+00F6 "ö" */
-    0x0, 0x0, 0x3, 0xde, 0x40, 0x0, 0x6f, 0xc1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0,
-    0xf, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xb0, 0x0, 0xef, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0x81, 0x0, 0x2, 0x97, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b,
-    0xff, 0xff, 0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xfe, 0x10, 0xa, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf8,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf4,
-    0x7f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x56, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xe0, 0xa, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf7, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x10, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5b, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3d, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0,
-    0x0,
+    0x0, 0xe3, 0xde, 0x40, 0x9, 0xbf, 0x4, 0x3,
+    0xfd, 0x4, 0x32, 0x1, 0x48, 0x1c, 0x80, 0x7f,
+    0x88, 0x0, 0xc0, 0x10, 0x80, 0x38, 0x3, 0xfd,
+    0x2e, 0xea, 0x0, 0xb1, 0xa1, 0x80, 0x3f, 0xe8,
+    0x80, 0x80, 0x45, 0x2e, 0x1, 0xff, 0xea, 0x49,
+    0xdf, 0xfb, 0x24, 0xc0, 0x3f, 0xc7, 0xb6, 0xc4,
+    0x1, 0x1b, 0x66, 0x8, 0x3, 0xe7, 0xc2, 0x0,
+    0xfe, 0x3d, 0x50, 0xe, 0x58, 0x0, 0x96, 0xfb,
+    0xfa, 0x90, 0x2, 0xa3, 0x0, 0x8a, 0x80, 0x3,
+    0x74, 0x82, 0x2, 0xb7, 0x40, 0x16, 0x88, 0x2,
+    0x0, 0x2a, 0x40, 0xf, 0x96, 0x40, 0x3, 0x20,
+    0x5, 0x0, 0x2a, 0x0, 0x7f, 0x31, 0x80, 0x18,
+    0x10, 0x2, 0xe0, 0xf, 0xfa, 0x80, 0x2, 0x44,
+    0x0, 0x94, 0x3, 0xfe, 0x20, 0x9, 0x84, 0x2,
+    0x10, 0xf, 0xf9, 0x80, 0x21, 0x10, 0x4, 0x20,
+    0x1f, 0xf3, 0x0, 0x42, 0x40, 0x12, 0x80, 0x7f,
+    0xc6, 0x1, 0x32, 0x0, 0x5e, 0x1, 0xff, 0x50,
+    0x0, 0x48, 0x14, 0x0, 0x88, 0x0, 0xfe, 0x62,
+    0x0, 0x48, 0x2, 0x0, 0x2b, 0x40, 0xf, 0x9a,
+    0x40, 0x2, 0xc0, 0x2, 0xa0, 0xa, 0xe9, 0x4,
+    0x5, 0x6e, 0x40, 0x2d, 0x10, 0x9, 0x64, 0x2,
+    0x5b, 0xef, 0xea, 0x40, 0xa, 0x8c, 0x3, 0x9b,
+    0x8, 0x3, 0xf8, 0xf5, 0x40, 0x3e, 0x3d, 0xb6,
+    0x20, 0x8, 0xda, 0xf0, 0x80, 0x30,
 
     /* U+00F7 "÷" */
-    0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7d, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0x79, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xef, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xfa, 0x0, 0x0,
-    0x0, 0x0,
+    0x0, 0xfc, 0x60, 0x1f, 0xfc, 0x22, 0xec, 0xe1,
+    0x0, 0xff, 0xd4, 0x20, 0x2c, 0x1, 0xff, 0xbc,
+    0x2, 0x10, 0xf, 0xfc, 0xe8, 0x8, 0xc0, 0x1f,
+    0xfc, 0x1b, 0xfb, 0x0, 0xff, 0xee, 0xbe, 0xef,
+    0xff, 0xd, 0xf8, 0x8b, 0xff, 0x87, 0xe0, 0x1f,
+    0xfc, 0x59, 0xff, 0xff, 0xe1, 0xc0, 0x7, 0xff,
+    0x78, 0xc0, 0x3f, 0xf8, 0x45, 0xd9, 0xc2, 0x1,
+    0xff, 0xa8, 0x40, 0x58, 0x3, 0xff, 0x78, 0x4,
+    0x20, 0x1f, 0xf9, 0xd0, 0x15, 0x80, 0x3c,
 
     /* U+00F8 "ø" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x4, 0x9d, 0xff, 0xfc, 0x93, 0xbf,
-    0x60, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x5f, 0xff, 0xfa, 0x41, 0x1, 0x5f, 0xff, 0xff,
-    0x30, 0x0, 0x2f, 0xff, 0xe4, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfe, 0x10, 0xa, 0xff, 0xf4, 0x0,
-    0x0, 0x1, 0xef, 0x26, 0xff, 0xf8, 0x0, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xaf, 0x70, 0xc, 0xff,
-    0xe0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x5f, 0xc0,
-    0x0, 0x6f, 0xff, 0x26, 0xff, 0xf1, 0x0, 0x0,
-    0x1e, 0xf2, 0x0, 0x4, 0xff, 0xf4, 0x7f, 0xff,
-    0x0, 0x0, 0xa, 0xf7, 0x0, 0x0, 0x2f, 0xff,
-    0x56, 0xff, 0xf1, 0x0, 0x5, 0xfd, 0x0, 0x0,
-    0x4, 0xff, 0xf4, 0x4f, 0xff, 0x40, 0x1, 0xef,
-    0x30, 0x0, 0x0, 0x7f, 0xff, 0x20, 0xff, 0xfb,
-    0x0, 0xaf, 0x80, 0x0, 0x0, 0xd, 0xff, 0xe0,
-    0xa, 0xff, 0xf4, 0x4f, 0xd0, 0x0, 0x0, 0x6,
-    0xff, 0xf7, 0x0, 0x2f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x6, 0xff, 0xfe, 0x10, 0x0, 0x5f, 0xff,
-    0xff, 0x41, 0x1, 0x5b, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x20, 0x0, 0x0, 0x0, 0x9f, 0x94,
-    0x9d, 0xff, 0xfc, 0x94, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x85, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xe2, 0xbc, 0x8, 0x7, 0xff, 0x15,
+    0xa0, 0xc4, 0x3, 0xff, 0x88, 0x32, 0x12, 0x1,
+    0xf9, 0x27, 0x7f, 0xec, 0x93, 0xa0, 0x92, 0x0,
+    0xf1, 0xed, 0xb1, 0x0, 0x46, 0xd8, 0x82, 0xc0,
+    0x1e, 0x7c, 0x20, 0xf, 0xf0, 0xa8, 0x7, 0x2c,
+    0x0, 0x4b, 0x7d, 0xfd, 0x40, 0x1a, 0x8c, 0x2,
+    0x2a, 0x0, 0xd, 0xd2, 0x8, 0x8, 0x7, 0xb4,
+    0x40, 0x10, 0x1, 0x52, 0x0, 0x61, 0xb0, 0xd9,
+    0x0, 0xc, 0x80, 0x14, 0x0, 0xa8, 0x1, 0xd6,
+    0x30, 0x4c, 0x60, 0x6, 0x4, 0x0, 0xb8, 0x3,
+    0x95, 0x46, 0xe0, 0xa, 0x0, 0x9, 0x10, 0x2,
+    0x50, 0xc, 0x36, 0x1c, 0x1, 0x10, 0x4, 0xc2,
+    0x1, 0x8, 0x6, 0xb1, 0x82, 0x0, 0x98, 0x2,
+    0x11, 0x0, 0x42, 0x1, 0x2a, 0x89, 0xc0, 0x33,
+    0x0, 0x42, 0x40, 0x12, 0x80, 0x6, 0xc3, 0x80,
+    0x38, 0xc0, 0x26, 0x40, 0xb, 0xc0, 0x16, 0x2e,
+    0x60, 0x1d, 0x40, 0x1, 0x20, 0x50, 0x2, 0x24,
+    0xa5, 0x0, 0x1c, 0xc4, 0x0, 0x90, 0x4, 0x0,
+    0x57, 0x60, 0xe0, 0xe, 0x69, 0x0, 0xb, 0x0,
+    0xa, 0x80, 0x39, 0xc4, 0x5, 0x6e, 0x40, 0x2d,
+    0x10, 0x9, 0x64, 0x3, 0x5f, 0x7f, 0x52, 0x0,
+    0x54, 0x60, 0x1c, 0xc0, 0x1f, 0xf1, 0xea, 0x80,
+    0x7a, 0x41, 0xad, 0x88, 0x2, 0x36, 0xbc, 0x20,
+    0xf, 0x23, 0x14, 0xa4, 0xef, 0xfd, 0x92, 0x80,
+    0x1f, 0xa8, 0x38, 0x3, 0xff, 0x8a, 0x6d, 0x46,
+    0x1, 0xff, 0xc4,
 
     /* U+00F9 "ù" */
-    0x0, 0x1b, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x46, 0x63, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0xdf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x1c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x14,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xf1, 0xc, 0xff, 0xfb, 0x30, 0x0, 0x16, 0xef,
-    0xff, 0xff, 0x10, 0x2e, 0xff, 0xff, 0xfd, 0xef,
-    0xff, 0xfa, 0xff, 0xf1, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x3f, 0xff, 0x10, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x3, 0xff, 0xf1,
+    0x0, 0xd, 0xff, 0xce, 0x1, 0xff, 0xc1, 0x1b,
+    0x80, 0x4, 0x48, 0x7, 0xff, 0x9, 0xf0, 0x81,
+    0xa8, 0x3, 0xff, 0x84, 0x7a, 0xa0, 0xb6, 0x1,
+    0xff, 0xc3, 0xab, 0x9d, 0x30, 0xf, 0xfe, 0x1a,
+    0x33, 0xc, 0x3, 0xff, 0x9d, 0xdf, 0xe8, 0x0,
+    0xff, 0x37, 0xfc, 0x20, 0x1f, 0xff, 0xf0, 0xf,
+    0xff, 0xf8, 0x7, 0xff, 0x5c, 0x40, 0x31, 0x80,
+    0x4, 0x3, 0xfd, 0xe0, 0x18, 0x40, 0xa, 0x1,
+    0xfe, 0x40, 0xc, 0xa0, 0x3, 0x10, 0xf, 0xc8,
+    0x60, 0x1b, 0x40, 0x2a, 0x0, 0xf8, 0xa8, 0x3,
+    0x90, 0xc0, 0x9, 0x66, 0x1, 0xb, 0x60, 0x80,
+    0x7b, 0x84, 0x0, 0x99, 0xfb, 0xdc, 0x91, 0x5,
+    0x0, 0xe2, 0xc3, 0x0, 0xc4, 0x20, 0x1, 0xa9,
+    0x0, 0xf1, 0x65, 0xa9, 0x0, 0x5, 0x27, 0x94,
+    0x3, 0x80,
 
     /* U+00FA "ú" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xfe, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x26, 0x65, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0xdf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x1c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x14,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xf1, 0xc, 0xff, 0xfb, 0x30, 0x0, 0x16, 0xef,
-    0xff, 0xff, 0x10, 0x2e, 0xff, 0xff, 0xfd, 0xef,
-    0xff, 0xfa, 0xff, 0xf1, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x3f, 0xff, 0x10, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x3, 0xff, 0xf1,
+    0x0, 0xff, 0x27, 0xfd, 0xa4, 0x1, 0xff, 0x9a,
+    0xc0, 0xd, 0xa4, 0x1, 0xff, 0x3c, 0x80, 0xd4,
+    0x80, 0x7f, 0xe9, 0x80, 0x3f, 0x50, 0xf, 0xfc,
+    0x5f, 0x35, 0x82, 0x1, 0xff, 0xc1, 0x26, 0x62,
+    0x80, 0x7f, 0xf4, 0x3b, 0xfd, 0x0, 0x1f, 0xe6,
+    0xff, 0x84, 0x3, 0xff, 0xfe, 0x1, 0xff, 0xff,
+    0x0, 0xff, 0xeb, 0x88, 0x6, 0x30, 0x0, 0x80,
+    0x7f, 0xbc, 0x3, 0x8, 0x1, 0x40, 0x3f, 0xc8,
+    0x1, 0x94, 0x0, 0x62, 0x1, 0xf9, 0xc, 0x3,
+    0x68, 0x5, 0x40, 0x1f, 0x15, 0x0, 0x72, 0x18,
+    0x1, 0x2c, 0xc0, 0x21, 0x6c, 0x10, 0xf, 0x70,
+    0x80, 0x13, 0x3f, 0x7b, 0x92, 0x20, 0xa0, 0x1c,
+    0x58, 0x60, 0x18, 0x84, 0x0, 0x35, 0x20, 0x1e,
+    0x2c, 0xb5, 0x20, 0x0, 0xa4, 0xf2, 0x80, 0x70,
 
     /* U+00FB "û" */
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x42,
-    0xdf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc,
-    0x20, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0, 0x6,
-    0x66, 0x0, 0x0, 0x0, 0x56, 0x62, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0xdf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x1c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x14,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xf1, 0xc, 0xff, 0xfb, 0x30, 0x0, 0x16, 0xef,
-    0xff, 0xff, 0x10, 0x2e, 0xff, 0xff, 0xfd, 0xef,
-    0xff, 0xfa, 0xff, 0xf1, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x3f, 0xff, 0x10, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x3, 0xff, 0xf1,
+    0x0, 0xf1, 0xf7, 0xfc, 0xa0, 0x1f, 0xf8, 0xf0,
+    0x40, 0x2a, 0x60, 0xf, 0xf2, 0x60, 0xd, 0xe9,
+    0x4, 0xb8, 0x7, 0xe6, 0xb0, 0x3c, 0x42, 0xd4,
+    0x8, 0x80, 0x7, 0xe9, 0x96, 0x10, 0x5, 0x75,
+    0x3c, 0x40, 0x1e, 0x66, 0x80, 0x3c, 0xac, 0xc2,
+    0x0, 0xff, 0xe5, 0x77, 0xfa, 0x0, 0x3f, 0xcd,
+    0xff, 0x8, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xfe,
+    0x1, 0xff, 0xd7, 0x10, 0xc, 0x60, 0x1, 0x0,
+    0xff, 0x78, 0x6, 0x10, 0x2, 0x80, 0x7f, 0x90,
+    0x3, 0x28, 0x0, 0xc4, 0x3, 0xf2, 0x18, 0x6,
+    0xd0, 0xa, 0x80, 0x3e, 0x2a, 0x0, 0xe4, 0x30,
+    0x2, 0x59, 0x80, 0x42, 0xd8, 0x20, 0x1e, 0xe1,
+    0x0, 0x26, 0x7e, 0xf7, 0x24, 0x41, 0x40, 0x38,
+    0xb0, 0xc0, 0x31, 0x8, 0x0, 0x6a, 0x40, 0x3c,
+    0x59, 0x6a, 0x40, 0x1, 0x49, 0xe5, 0x0, 0xe0,
 
     /* U+00FC "ü" */
-    0x0, 0x0, 0x29, 0x60, 0x0, 0x5, 0x94, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0x60, 0x3, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf8, 0x0,
-    0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7, 0xfc,
-    0x10, 0x0, 0xbf, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1, 0xef,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xf1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0x1e, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xf1, 0xef, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x1e, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0x1e, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xf1, 0xdf, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0x1c, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xf1, 0x9f, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x14,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
-    0xf1, 0xc, 0xff, 0xfb, 0x30, 0x0, 0x16, 0xef,
-    0xff, 0xff, 0x10, 0x2e, 0xff, 0xff, 0xfd, 0xef,
-    0xff, 0xfa, 0xff, 0xf1, 0x0, 0x2c, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x3f, 0xff, 0x10, 0x0, 0x4,
-    0xad, 0xff, 0xeb, 0x60, 0x3, 0xff, 0xf1,
+    0x0, 0xc5, 0x2c, 0x1, 0x96, 0x50, 0x3, 0xfb,
+    0x1a, 0x58, 0x0, 0x74, 0xd6, 0x20, 0x1f, 0x84,
+    0x1, 0xc0, 0x6, 0x0, 0x88, 0x3, 0xf4, 0x1,
+    0xc8, 0x1, 0x50, 0x18, 0xc0, 0x3f, 0x3f, 0xe0,
+    0x80, 0x57, 0xf2, 0x1, 0xff, 0xdf, 0xef, 0xf4,
+    0x0, 0x7f, 0x9b, 0xfe, 0x10, 0xf, 0xff, 0xf8,
+    0x7, 0xff, 0xfc, 0x3, 0xff, 0xae, 0x20, 0x18,
+    0xc0, 0x2, 0x1, 0xfe, 0xf0, 0xc, 0x20, 0x5,
+    0x0, 0xff, 0x20, 0x6, 0x50, 0x1, 0x88, 0x7,
+    0xe4, 0x30, 0xd, 0xa0, 0x15, 0x0, 0x7c, 0x54,
+    0x1, 0xc8, 0x60, 0x4, 0xb3, 0x0, 0x85, 0xb0,
+    0x40, 0x3d, 0xc2, 0x0, 0x4c, 0xfd, 0xee, 0x48,
+    0x82, 0x80, 0x71, 0x61, 0x80, 0x62, 0x10, 0x0,
+    0xd4, 0x80, 0x78, 0xb2, 0xd4, 0x80, 0x2, 0x93,
+    0xca, 0x1, 0xc0,
 
     /* U+00FD "ý" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1c, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xdf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x56, 0x62, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x6, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x70, 0x0, 0xef, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x8f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf9, 0x0, 0x3f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x10, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x71, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe9, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa3, 0x0, 0x3d, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xff, 0xd7, 0xff, 0x38, 0x7, 0xff, 0xc,
+    0x71, 0x0, 0xb1, 0xc0, 0x3f, 0xf8, 0x45, 0x86,
+    0xb, 0xa6, 0x1, 0xff, 0xc2, 0x3c, 0x20, 0x9a,
+    0x0, 0xff, 0xe2, 0x34, 0x4e, 0xb0, 0x7, 0xff,
+    0x15, 0x59, 0x84, 0x1, 0xff, 0xd5, 0xdf, 0xf5,
+    0x80, 0x7f, 0xe7, 0xff, 0x70, 0x2, 0xc0, 0x8,
+    0x60, 0x1f, 0xf5, 0x0, 0x24, 0x0, 0xc2, 0x0,
+    0x90, 0xf, 0xf2, 0x90, 0x1, 0x80, 0x26, 0x0,
+    0x28, 0x80, 0x7f, 0x70, 0x1, 0x84, 0x2, 0x90,
+    0xa, 0x40, 0x3f, 0x12, 0x0, 0x2c, 0x3, 0xb,
+    0x0, 0x18, 0x3, 0xf5, 0x80, 0x10, 0x80, 0x3a,
+    0xc0, 0x2, 0xc0, 0x1e, 0x16, 0x0, 0x78, 0x7,
+    0x89, 0x0, 0x16, 0x1, 0xe6, 0x0, 0x12, 0x0,
+    0x7d, 0xe0, 0x2, 0x40, 0xe, 0x90, 0x4, 0x0,
+    0x7e, 0x42, 0x0, 0x78, 0x6, 0x51, 0x1, 0x50,
+    0xf, 0xeb, 0x0, 0x21, 0x0, 0x52, 0x0, 0x90,
+    0xf, 0xf3, 0x8, 0x2, 0xc0, 0x6, 0x60, 0x3,
+    0x0, 0x7f, 0xd2, 0x0, 0x61, 0x9, 0x0, 0x30,
+    0x80, 0x7f, 0xcc, 0x1, 0x30, 0xa8, 0x2, 0xc0,
+    0x3f, 0xf0, 0xb0, 0x2, 0x60, 0x0, 0x84, 0x1,
+    0xff, 0xc1, 0xb0, 0x0, 0xb0, 0x3, 0xc0, 0x3f,
+    0xf8, 0x44, 0x80, 0x18, 0xd0, 0x3, 0xff, 0x87,
+    0xe0, 0x1a, 0x40, 0x3f, 0xf8, 0x88, 0x60, 0x1,
+    0x50, 0xf, 0xfe, 0x29, 0x0, 0x24, 0x3, 0xff,
+    0x8a, 0xe2, 0x0, 0x60, 0xf, 0xf0, 0x80, 0x70,
+    0xc8, 0x1, 0xc4, 0x3, 0xfd, 0xb4, 0x60, 0x3,
+    0xc1, 0x1, 0x90, 0xf, 0xf2, 0x9a, 0xe7, 0xfb,
+    0x8, 0x1, 0x62, 0x1, 0xfe, 0x30, 0xf, 0xd2,
+    0xa0, 0x1f, 0xf3, 0x6b, 0x10, 0x0, 0x9b, 0x58,
+    0x3, 0xff,
 
     /* U+00FE "þ" */
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xb0, 0x2, 0x8c, 0xef, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0xbf, 0xfb, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0xb, 0xff,
-    0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0x0, 0xbf, 0xff, 0xff, 0xf8, 0x30, 0x2, 0x7d,
-    0xff, 0xfe, 0x10, 0xb, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0xbf, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf4,
-    0xb, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0x90, 0xbf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfd, 0xb, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xb, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf0, 0xbf, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xb,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x90, 0xbf, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xf4, 0xb, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0xbf,
-    0xff, 0xff, 0xe8, 0x30, 0x2, 0x7d, 0xff, 0xfe,
-    0x10, 0xb, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0xbf, 0xfb, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0xb, 0xff,
-    0xb0, 0x2, 0x8c, 0xef, 0xec, 0x83, 0x0, 0x0,
-    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0xbf, 0xf5, 0x80, 0x7f, 0xff, 0xc0, 0x3f, 0xff,
+    0xc5, 0x19, 0xdf, 0xd9, 0x6, 0x1, 0xff, 0x4e,
+    0xb9, 0x88, 0x9, 0xbe, 0x50, 0x80, 0x7c, 0xf6,
+    0xc0, 0x1f, 0xcb, 0xe6, 0x1, 0xe3, 0x40, 0x3,
+    0xe7, 0xfb, 0x60, 0x80, 0x3, 0xa2, 0x1, 0xf1,
+    0xec, 0x18, 0x0, 0x9f, 0x54, 0x0, 0x34, 0x1,
+    0xe1, 0xd2, 0x0, 0xfa, 0x90, 0x0, 0x88, 0x0,
+    0xe8, 0x10, 0xf, 0xe9, 0x0, 0xb4, 0x3, 0x98,
+    0x3, 0xfc, 0x48, 0x0, 0x40, 0xc, 0x40, 0x1f,
+    0xf8, 0x80, 0x4, 0x1, 0x98, 0x3, 0xff, 0x70,
+    0x7, 0xcc, 0x1, 0xff, 0xb8, 0x3, 0xe2, 0x0,
+    0xff, 0xca, 0x0, 0x20, 0xe, 0x60, 0xf, 0xf1,
+    0x18, 0x1, 0x0, 0x3a, 0x4, 0x3, 0xfa, 0x40,
+    0x2d, 0x0, 0xe1, 0xd1, 0x0, 0xfa, 0x90, 0x0,
+    0x88, 0x0, 0xf1, 0xfc, 0x18, 0x0, 0x9f, 0x54,
+    0x0, 0x34, 0x1, 0xc6, 0x80, 0x2f, 0x9f, 0xed,
+    0x82, 0x0, 0xe, 0x88, 0x7, 0x3d, 0xb8, 0x7,
+    0xf2, 0x79, 0x80, 0x7e, 0x8d, 0x73, 0x10, 0x13,
+    0x7c, 0xb1, 0x0, 0xff, 0x14, 0x67, 0x7f, 0x64,
+    0x18, 0x7, 0xff, 0xfc, 0x3, 0xff, 0xda,
 
     /* U+00FF "ÿ" */
-    0x0, 0x0, 0x1, 0xce, 0x60, 0x0, 0x4e, 0xd3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf0,
-    0x0, 0xdf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xe0, 0x0, 0xbf, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x79, 0x20, 0x0, 0x19,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xe0,
-    0x6, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x70, 0x0, 0xef, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0x10, 0x0, 0x8f,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf9,
-    0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xf2, 0x0, 0x0, 0x9, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0, 0x0, 0x0,
-    0x2, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x40, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xb0, 0x0, 0x5, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf9, 0x0, 0x3f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x10, 0xaf,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x71, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xe9, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x1,
-    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xa3, 0x0, 0x3d, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x9d, 0xff, 0xd9, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0xe1, 0xce, 0x60, 0x9, 0x3b, 0x4c, 0x3,
+    0xfe, 0x93, 0x19, 0x0, 0xa4, 0x4a, 0x0, 0x3f,
+    0xef, 0x0, 0x8, 0x4, 0xc0, 0x2, 0x0, 0xff,
+    0x9e, 0x1b, 0x0, 0x2a, 0x67, 0x90, 0xf, 0xfc,
+    0xf2, 0x40, 0x10, 0xcc, 0x0, 0x7f, 0xfa, 0x37,
+    0xfd, 0x60, 0x1f, 0xf9, 0xff, 0xdc, 0x0, 0xb0,
+    0x2, 0x18, 0x7, 0xfd, 0x40, 0x9, 0x0, 0x30,
+    0x80, 0x24, 0x3, 0xfc, 0xa4, 0x0, 0x60, 0x9,
+    0x80, 0xa, 0x20, 0x1f, 0xdc, 0x0, 0x61, 0x0,
+    0xa4, 0x2, 0x90, 0xf, 0xc4, 0x80, 0xb, 0x0,
+    0xc2, 0xc0, 0x6, 0x0, 0xfd, 0x60, 0x4, 0x20,
+    0xe, 0xb0, 0x0, 0xb0, 0x7, 0x85, 0x80, 0x1e,
+    0x1, 0xe2, 0x40, 0x5, 0x80, 0x79, 0x80, 0x4,
+    0x80, 0x1f, 0x78, 0x0, 0x90, 0x3, 0xa4, 0x1,
+    0x0, 0x1f, 0x90, 0x80, 0x1e, 0x1, 0x94, 0x40,
+    0x54, 0x3, 0xfa, 0xc0, 0x8, 0x40, 0x14, 0x80,
+    0x24, 0x3, 0xfc, 0xc2, 0x0, 0xb0, 0x1, 0x98,
+    0x0, 0xc0, 0x1f, 0xf4, 0x80, 0x18, 0x42, 0x40,
+    0xc, 0x20, 0x1f, 0xf3, 0x0, 0x4c, 0x2a, 0x0,
+    0xb0, 0xf, 0xfc, 0x2c, 0x0, 0x98, 0x0, 0x21,
+    0x0, 0x7f, 0xf0, 0x6c, 0x0, 0x2c, 0x0, 0xf0,
+    0xf, 0xfe, 0x11, 0x20, 0x6, 0x34, 0x0, 0xff,
+    0xe1, 0xf8, 0x6, 0x90, 0xf, 0xfe, 0x22, 0x18,
+    0x0, 0x54, 0x3, 0xff, 0x8a, 0x40, 0x9, 0x0,
+    0xff, 0xe2, 0xb8, 0x80, 0x18, 0x3, 0xfc, 0x20,
+    0x1c, 0x32, 0x0, 0x71, 0x0, 0xff, 0x6d, 0x18,
+    0x0, 0xf0, 0x40, 0x64, 0x3, 0xfc, 0xa6, 0xb9,
+    0xfe, 0xc2, 0x0, 0x58, 0x80, 0x7f, 0x8c, 0x3,
+    0xf4, 0xa8, 0x7, 0xfc, 0xda, 0xc4, 0x0, 0x26,
+    0xd6, 0x0, 0xff, 0xc0,
 
     /* U+2022 "•" */
-    0x0, 0x37, 0x50, 0x0, 0x9f, 0xff, 0xd1, 0x5f,
-    0xff, 0xff, 0x99, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0xb1, 0xff, 0xff, 0xf5, 0x3, 0xcf, 0xd5,
+    0x0, 0x1b, 0xa8, 0x5, 0x39, 0x15, 0xa2, 0xac,
+    0x1, 0x14, 0x60, 0x7, 0x27, 0x0, 0x73, 0x30,
+    0x3, 0xb8, 0x70, 0xc0, 0xa9, 0x40,
+
+    /* padding */
     0x0
 };
 
@@ -6148,196 +3711,196 @@ static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 155, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
     {.bitmap_index = 0, .adv_w = 154, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 75, .adv_w = 225, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 125, .adv_w = 405, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 438, .adv_w = 358, .box_w = 20, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 778, .adv_w = 486, .box_w = 29, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1141, .adv_w = 395, .box_w = 24, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1453, .adv_w = 121, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
-    {.bitmap_index = 1473, .adv_w = 194, .box_w = 8, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 1605, .adv_w = 195, .box_w = 8, .box_h = 33, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 1737, .adv_w = 230, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 1835, .adv_w = 335, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 1971, .adv_w = 131, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2001, .adv_w = 221, .box_w = 10, .box_h = 3, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 2016, .adv_w = 131, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2031, .adv_w = 203, .box_w = 16, .box_h = 34, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 2303, .adv_w = 384, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2578, .adv_w = 213, .box_w = 10, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2703, .adv_w = 331, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2953, .adv_w = 329, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3191, .adv_w = 385, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3479, .adv_w = 331, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3729, .adv_w = 355, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3992, .adv_w = 344, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4242, .adv_w = 371, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4505, .adv_w = 355, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4755, .adv_w = 131, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4812, .adv_w = 131, .box_w = 6, .box_h = 24, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 4884, .adv_w = 335, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 5029, .adv_w = 335, .box_w = 17, .box_h = 11, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 5123, .adv_w = 335, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 5268, .adv_w = 330, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5506, .adv_w = 596, .box_w = 35, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 6066, .adv_w = 422, .box_w = 28, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 6416, .adv_w = 436, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 6704, .adv_w = 416, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7004, .adv_w = 476, .box_w = 26, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7329, .adv_w = 386, .box_w = 20, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7579, .adv_w = 366, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 7817, .adv_w = 445, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 8117, .adv_w = 468, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8405, .adv_w = 179, .box_w = 5, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8468, .adv_w = 295, .box_w = 16, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 8668, .adv_w = 414, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 8956, .adv_w = 342, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9194, .adv_w = 550, .box_w = 28, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9544, .adv_w = 468, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 9832, .adv_w = 484, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10182, .adv_w = 416, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 10457, .adv_w = 484, .box_w = 29, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10892, .adv_w = 419, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11167, .adv_w = 358, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11417, .adv_w = 338, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11680, .adv_w = 456, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 11955, .adv_w = 410, .box_w = 27, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 12293, .adv_w = 649, .box_w = 39, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 12781, .adv_w = 388, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 13081, .adv_w = 373, .box_w = 25, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 13394, .adv_w = 378, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13669, .adv_w = 192, .box_w = 9, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 13818, .adv_w = 203, .box_w = 16, .box_h = 34, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 14090, .adv_w = 192, .box_w = 9, .box_h = 33, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 14239, .adv_w = 336, .box_w = 17, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
-    {.bitmap_index = 14367, .adv_w = 288, .box_w = 18, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 14394, .adv_w = 346, .box_w = 10, .box_h = 5, .ofs_x = 4, .ofs_y = 22},
-    {.bitmap_index = 14419, .adv_w = 344, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14590, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 14863, .adv_w = 329, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15044, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15317, .adv_w = 353, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15507, .adv_w = 203, .box_w = 14, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15689, .adv_w = 397, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 15962, .adv_w = 392, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16209, .adv_w = 161, .box_w = 6, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16290, .adv_w = 164, .box_w = 12, .box_h = 34, .ofs_x = -4, .ofs_y = -7},
-    {.bitmap_index = 16494, .adv_w = 355, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16754, .adv_w = 161, .box_w = 4, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 16806, .adv_w = 609, .box_w = 32, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17110, .adv_w = 392, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 17291, .adv_w = 366, .box_w = 21, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17491, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 17764, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 18037, .adv_w = 236, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18142, .adv_w = 289, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18304, .adv_w = 238, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18465, .adv_w = 390, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 18646, .adv_w = 322, .box_w = 22, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 18855, .adv_w = 518, .box_w = 33, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19169, .adv_w = 318, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19359, .adv_w = 322, .box_w = 22, .box_h = 26, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 19645, .adv_w = 300, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19807, .adv_w = 202, .box_w = 10, .box_h = 33, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 19972, .adv_w = 172, .box_w = 4, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 20038, .adv_w = 202, .box_w = 11, .box_h = 33, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 20220, .adv_w = 335, .box_w = 17, .box_h = 6, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 20271, .adv_w = 155, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20271, .adv_w = 154, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 20346, .adv_w = 329, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 20612, .adv_w = 372, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 20887, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 21175, .adv_w = 407, .box_w = 27, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 21513, .adv_w = 172, .box_w = 4, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 21579, .adv_w = 288, .box_w = 17, .box_h = 29, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 21826, .adv_w = 346, .box_w = 11, .box_h = 4, .ofs_x = 5, .ofs_y = 22},
-    {.bitmap_index = 21848, .adv_w = 462, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22186, .adv_w = 233, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 22258, .adv_w = 290, .box_w = 16, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 22370, .adv_w = 335, .box_w = 17, .box_h = 10, .ofs_x = 2, .ofs_y = 4},
-    {.bitmap_index = 22455, .adv_w = 221, .box_w = 10, .box_h = 3, .ofs_x = 2, .ofs_y = 8},
-    {.bitmap_index = 22470, .adv_w = 462, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 22808, .adv_w = 346, .box_w = 13, .box_h = 3, .ofs_x = 4, .ofs_y = 23},
-    {.bitmap_index = 22828, .adv_w = 241, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 22906, .adv_w = 335, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 23093, .adv_w = 248, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 23191, .adv_w = 248, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 12},
-    {.bitmap_index = 23296, .adv_w = 346, .box_w = 10, .box_h = 5, .ofs_x = 8, .ofs_y = 22},
-    {.bitmap_index = 23321, .adv_w = 393, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 23568, .adv_w = 373, .box_w = 20, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 23868, .adv_w = 154, .box_w = 6, .box_h = 5, .ofs_x = 2, .ofs_y = 7},
-    {.bitmap_index = 23883, .adv_w = 346, .box_w = 9, .box_h = 8, .ofs_x = 6, .ofs_y = -8},
-    {.bitmap_index = 23919, .adv_w = 248, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 24009, .adv_w = 241, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 24087, .adv_w = 290, .box_w = 16, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 24199, .adv_w = 596, .box_w = 35, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 24654, .adv_w = 596, .box_w = 34, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 25079, .adv_w = 596, .box_w = 37, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 25560, .adv_w = 330, .box_w = 19, .box_h = 25, .ofs_x = 2, .ofs_y = -6},
-    {.bitmap_index = 25798, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 26246, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 26694, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 27142, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 27590, .adv_w = 422, .box_w = 28, .box_h = 31, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 28024, .adv_w = 422, .box_w = 28, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 28514, .adv_w = 603, .box_w = 37, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 28977, .adv_w = 416, .box_w = 24, .box_h = 33, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 29373, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29693, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30013, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30333, .adv_w = 386, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 30643, .adv_w = 179, .box_w = 11, .box_h = 32, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 30819, .adv_w = 179, .box_w = 11, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30995, .adv_w = 179, .box_w = 14, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 31219, .adv_w = 179, .box_w = 11, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31390, .adv_w = 480, .box_w = 29, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 31753, .adv_w = 468, .box_w = 23, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 32121, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 32569, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33017, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33465, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 33913, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 34361, .adv_w = 335, .box_w = 15, .box_h = 15, .ofs_x = 3, .ofs_y = 5},
-    {.bitmap_index = 34474, .adv_w = 484, .box_w = 28, .box_h = 30, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 34894, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35246, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35598, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 35950, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36302, .adv_w = 373, .box_w = 25, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 36702, .adv_w = 416, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 36977, .adv_w = 389, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 37237, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37471, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37705, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 37939, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38173, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38407, .adv_w = 344, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38668, .adv_w = 570, .box_w = 34, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 38991, .adv_w = 329, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 39248, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39508, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 39768, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40028, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 40288, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = -2, .ofs_y = 0},
-    {.bitmap_index = 40418, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 40548, .adv_w = 161, .box_w = 12, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
-    {.bitmap_index = 40704, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 40834, .adv_w = 369, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41107, .adv_w = 392, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 41354, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41627, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 41900, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42173, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42446, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 42719, .adv_w = 335, .box_w = 17, .box_h = 19, .ofs_x = 2, .ofs_y = 3},
-    {.bitmap_index = 42881, .adv_w = 366, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 43144, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43391, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43638, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 43885, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 44132, .adv_w = 322, .box_w = 22, .box_h = 33, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 44495, .adv_w = 393, .box_w = 21, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 44842, .adv_w = 322, .box_w = 22, .box_h = 33, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 45205, .adv_w = 181, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 7}
+    {.bitmap_index = 57, .adv_w = 225, .box_w = 10, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 94, .adv_w = 405, .box_w = 25, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 288, .adv_w = 358, .box_w = 20, .box_h = 34, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 489, .adv_w = 486, .box_w = 29, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 764, .adv_w = 395, .box_w = 24, .box_h = 26, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 1010, .adv_w = 121, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = 15},
+    {.bitmap_index = 1025, .adv_w = 194, .box_w = 8, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 1142, .adv_w = 195, .box_w = 8, .box_h = 33, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 1254, .adv_w = 230, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 1330, .adv_w = 335, .box_w = 17, .box_h = 16, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 1369, .adv_w = 131, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 1399, .adv_w = 221, .box_w = 10, .box_h = 3, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 1406, .adv_w = 131, .box_w = 6, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1421, .adv_w = 203, .box_w = 16, .box_h = 34, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 1579, .adv_w = 384, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1780, .adv_w = 213, .box_w = 10, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1801, .adv_w = 331, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1960, .adv_w = 329, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2112, .adv_w = 385, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2243, .adv_w = 331, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2401, .adv_w = 355, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2602, .adv_w = 344, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2743, .adv_w = 371, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2957, .adv_w = 355, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3153, .adv_w = 131, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3187, .adv_w = 131, .box_w = 6, .box_h = 24, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 3236, .adv_w = 335, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 3341, .adv_w = 335, .box_w = 17, .box_h = 11, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 3371, .adv_w = 335, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 3475, .adv_w = 330, .box_w = 19, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3622, .adv_w = 596, .box_w = 35, .box_h = 32, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 4028, .adv_w = 422, .box_w = 28, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4242, .adv_w = 436, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4392, .adv_w = 416, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4583, .adv_w = 476, .box_w = 26, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4736, .adv_w = 386, .box_w = 20, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4786, .adv_w = 366, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4827, .adv_w = 445, .box_w = 24, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5020, .adv_w = 468, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5065, .adv_w = 179, .box_w = 5, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5074, .adv_w = 295, .box_w = 16, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5147, .adv_w = 414, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5318, .adv_w = 342, .box_w = 19, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5351, .adv_w = 550, .box_w = 28, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5536, .adv_w = 468, .box_w = 23, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5672, .adv_w = 484, .box_w = 28, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5909, .adv_w = 416, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6028, .adv_w = 484, .box_w = 29, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 6320, .adv_w = 419, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6470, .adv_w = 358, .box_w = 20, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6651, .adv_w = 338, .box_w = 21, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6689, .adv_w = 456, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6800, .adv_w = 410, .box_w = 27, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7015, .adv_w = 649, .box_w = 39, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7359, .adv_w = 388, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7574, .adv_w = 373, .box_w = 25, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7730, .adv_w = 378, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7873, .adv_w = 192, .box_w = 9, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 7905, .adv_w = 203, .box_w = 16, .box_h = 34, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 8062, .adv_w = 192, .box_w = 9, .box_h = 33, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 8094, .adv_w = 336, .box_w = 17, .box_h = 15, .ofs_x = 2, .ofs_y = 5},
+    {.bitmap_index = 8189, .adv_w = 288, .box_w = 18, .box_h = 3, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 8199, .adv_w = 346, .box_w = 10, .box_h = 5, .ofs_x = 4, .ofs_y = 22},
+    {.bitmap_index = 8221, .adv_w = 344, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8354, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 8501, .adv_w = 329, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8636, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8789, .adv_w = 353, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8930, .adv_w = 203, .box_w = 14, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8998, .adv_w = 397, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 9203, .adv_w = 392, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9284, .adv_w = 161, .box_w = 6, .box_h = 27, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9314, .adv_w = 164, .box_w = 12, .box_h = 34, .ofs_x = -4, .ofs_y = -7},
+    {.bitmap_index = 9386, .adv_w = 355, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9514, .adv_w = 161, .box_w = 4, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9523, .adv_w = 609, .box_w = 32, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9657, .adv_w = 392, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 9734, .adv_w = 366, .box_w = 21, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9887, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 10042, .adv_w = 393, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = -7},
+    {.bitmap_index = 10196, .adv_w = 236, .box_w = 11, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10238, .adv_w = 289, .box_w = 17, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10370, .adv_w = 238, .box_w = 14, .box_h = 23, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10435, .adv_w = 390, .box_w = 19, .box_h = 19, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10512, .adv_w = 322, .box_w = 22, .box_h = 19, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10662, .adv_w = 518, .box_w = 33, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10904, .adv_w = 318, .box_w = 20, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11052, .adv_w = 322, .box_w = 22, .box_h = 26, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 11249, .adv_w = 300, .box_w = 17, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11344, .adv_w = 202, .box_w = 10, .box_h = 33, .ofs_x = 2, .ofs_y = -7},
+    {.bitmap_index = 11424, .adv_w = 172, .box_w = 4, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 11432, .adv_w = 202, .box_w = 11, .box_h = 33, .ofs_x = 0, .ofs_y = -7},
+    {.bitmap_index = 11517, .adv_w = 335, .box_w = 17, .box_h = 6, .ofs_x = 2, .ofs_y = 9},
+    {.bitmap_index = 11567, .adv_w = 155, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11567, .adv_w = 154, .box_w = 6, .box_h = 25, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 11626, .adv_w = 329, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 11779, .adv_w = 372, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11892, .adv_w = 403, .box_w = 24, .box_h = 24, .ofs_x = 1, .ofs_y = -1},
+    {.bitmap_index = 12119, .adv_w = 407, .box_w = 27, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 12293, .adv_w = 172, .box_w = 4, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 12312, .adv_w = 288, .box_w = 17, .box_h = 29, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 12515, .adv_w = 346, .box_w = 11, .box_h = 4, .ofs_x = 5, .ofs_y = 22},
+    {.bitmap_index = 12537, .adv_w = 462, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 12809, .adv_w = 233, .box_w = 12, .box_h = 12, .ofs_x = 1, .ofs_y = 15},
+    {.bitmap_index = 12877, .adv_w = 290, .box_w = 16, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 12983, .adv_w = 335, .box_w = 17, .box_h = 10, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 13007, .adv_w = 221, .box_w = 10, .box_h = 3, .ofs_x = 2, .ofs_y = 8},
+    {.bitmap_index = 13014, .adv_w = 462, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 13263, .adv_w = 346, .box_w = 13, .box_h = 3, .ofs_x = 4, .ofs_y = 23},
+    {.bitmap_index = 13273, .adv_w = 241, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 14},
+    {.bitmap_index = 13341, .adv_w = 335, .box_w = 17, .box_h = 22, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 13397, .adv_w = 248, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 12},
+    {.bitmap_index = 13473, .adv_w = 248, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 12},
+    {.bitmap_index = 13553, .adv_w = 346, .box_w = 10, .box_h = 5, .ofs_x = 8, .ofs_y = 22},
+    {.bitmap_index = 13576, .adv_w = 393, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 13657, .adv_w = 373, .box_w = 20, .box_h = 30, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 13743, .adv_w = 154, .box_w = 6, .box_h = 5, .ofs_x = 2, .ofs_y = 7},
+    {.bitmap_index = 13758, .adv_w = 346, .box_w = 9, .box_h = 8, .ofs_x = 6, .ofs_y = -8},
+    {.bitmap_index = 13790, .adv_w = 248, .box_w = 12, .box_h = 15, .ofs_x = 2, .ofs_y = 12},
+    {.bitmap_index = 13820, .adv_w = 241, .box_w = 13, .box_h = 12, .ofs_x = 1, .ofs_y = 15},
+    {.bitmap_index = 13890, .adv_w = 290, .box_w = 16, .box_h = 14, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 13996, .adv_w = 596, .box_w = 35, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14224, .adv_w = 596, .box_w = 34, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 14454, .adv_w = 596, .box_w = 37, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 14745, .adv_w = 330, .box_w = 19, .box_h = 25, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 14888, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15138, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15389, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15651, .adv_w = 422, .box_w = 28, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 15914, .adv_w = 422, .box_w = 28, .box_h = 31, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16170, .adv_w = 422, .box_w = 28, .box_h = 35, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16451, .adv_w = 603, .box_w = 37, .box_h = 25, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 16629, .adv_w = 416, .box_w = 24, .box_h = 33, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 16871, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 16958, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17046, .adv_w = 386, .box_w = 20, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17141, .adv_w = 386, .box_w = 20, .box_h = 31, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17230, .adv_w = 179, .box_w = 11, .box_h = 32, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 17274, .adv_w = 179, .box_w = 11, .box_h = 32, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 17318, .adv_w = 179, .box_w = 14, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 17375, .adv_w = 179, .box_w = 11, .box_h = 31, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17419, .adv_w = 480, .box_w = 29, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 17591, .adv_w = 468, .box_w = 23, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 17776, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18049, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18324, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18609, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18899, .adv_w = 484, .box_w = 28, .box_h = 32, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 19177, .adv_w = 335, .box_w = 15, .box_h = 15, .ofs_x = 3, .ofs_y = 5},
+    {.bitmap_index = 19272, .adv_w = 484, .box_w = 28, .box_h = 30, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 19576, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 19725, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 19877, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20035, .adv_w = 456, .box_w = 22, .box_h = 32, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20186, .adv_w = 373, .box_w = 25, .box_h = 32, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 20381, .adv_w = 416, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20498, .adv_w = 389, .box_w = 20, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 20678, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 20846, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21012, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21187, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21360, .adv_w = 344, .box_w = 18, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21529, .adv_w = 344, .box_w = 18, .box_h = 29, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21721, .adv_w = 570, .box_w = 34, .box_h = 19, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 21965, .adv_w = 329, .box_w = 19, .box_h = 27, .ofs_x = 1, .ofs_y = -8},
+    {.bitmap_index = 22149, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22326, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22503, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22689, .adv_w = 353, .box_w = 20, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 22867, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = -2, .ofs_y = 0},
+    {.bitmap_index = 22907, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 22947, .adv_w = 161, .box_w = 12, .box_h = 26, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 22996, .adv_w = 161, .box_w = 10, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 23036, .adv_w = 369, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23259, .adv_w = 392, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 23377, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23565, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23754, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 23951, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 24144, .adv_w = 366, .box_w = 21, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 24334, .adv_w = 335, .box_w = 17, .box_h = 19, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 24405, .adv_w = 366, .box_w = 21, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 24608, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 24722, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 24834, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 24954, .adv_w = 390, .box_w = 19, .box_h = 26, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 25069, .adv_w = 322, .box_w = 22, .box_h = 33, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 25303, .adv_w = 393, .box_w = 21, .box_h = 33, .ofs_x = 3, .ofs_y = -7},
+    {.bitmap_index = 25462, .adv_w = 322, .box_w = 22, .box_h = 33, .ofs_x = -1, .ofs_y = -7},
+    {.bitmap_index = 25698, .adv_w = 181, .box_w = 7, .box_h = 7, .ofs_x = 2, .ofs_y = 7}
 };
 
 /*---------------------
@@ -6999,7 +4562,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 3,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 0,
+    .bitmap_format = 1,
 #if LVGL_VERSION_MAJOR == 8
     .cache = &cache
 #endif
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "sdkconfig.h"
 #include "lvgl.h"
 
 // Custom Montserrat fonts with Latin-1 Supplement (Swedish å ä ö Å Ä Ö)
 extern const lv_font_t font_sv_16;
 extern const lv_font_t font_sv_18;
+#ifdef CONFIG_PANEL_FONT_LARGE
 extern const lv_font_t font_sv_28;
 extern const lv_font_t font_sv_36;
+#endif
@@ -0,0 +1,153 @@
+/*
+ * HA request health
+ *
+ * Adaptive timeouts: each endpoint class keeps its last HA_RTT_WINDOW
+ * round-trip times; the timeout is their p99 times a factor, clamped.
+ * Timed-out requests are observed with their full duration, so a slow HA
+ * pushes the timeout up towards the maximum instead of failing forever.
+ *
+ * Circuit breaker:
+ *
+ *   CLOSED --N consecutive failures--> OPEN --cool-down--> HALF_OPEN
+ *     ^                                 ^                     |
+ *     +-------- probe succeeded --------+--- probe failed ----+
+ *
+ * While OPEN every request fails immediately, so neither the poll loop nor
+ * UI commands on the LVGL task wait for timeouts while HA is down. Each
+ * failed probe doubles the cool-down up to CONFIG_HA_BREAKER_MAX_OPEN_MS.
+ */
+
+#include "ha_breaker.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "ha_breaker";
+
+#define MIN_SAMPLES     8
+#define BASE_OPEN_MS    1000
+#define BACKOFF_BASE_MS 200
+#define BACKOFF_MAX_MS  3000
+
+// ---- Adaptive timeouts ----
+
+void ha_rtt_observe(ha_rtt_t *rtt, uint32_t ms)
+{
+    rtt->samples[rtt->next] = ms > UINT16_MAX ? UINT16_MAX : (uint16_t)ms;
+    rtt->next = (rtt->next + 1) % HA_RTT_WINDOW;
+    if (rtt->count < HA_RTT_WINDOW) rtt->count++;
+}
+
+uint32_t ha_rtt_timeout_ms(const ha_rtt_t *rtt)
+{
+    if (rtt->count < MIN_SAMPLES) return CONFIG_HA_TIMEOUT_MAX_MS;
+
+    // Insertion sort of a copy; the window is tiny
+    uint16_t sorted[HA_RTT_WINDOW];
+    int n = rtt->count;
+    memcpy(sorted, rtt->samples, n * sizeof(sorted[0]));
+    for (int i = 1; i < n; i++) {
+        uint16_t v = sorted[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+
+    uint32_t p99 = sorted[(n * 99 + 99) / 100 - 1];
+    uint32_t t = p99 * CONFIG_HA_TIMEOUT_RTT_FACTOR;
+    if (t < CONFIG_HA_TIMEOUT_MIN_MS) t = CONFIG_HA_TIMEOUT_MIN_MS;
+    if (t > CONFIG_HA_TIMEOUT_MAX_MS) t = CONFIG_HA_TIMEOUT_MAX_MS;
+    return t;
+}
+
+uint32_t ha_backoff_ms(int attempt)
+{
+    uint32_t cap = BACKOFF_BASE_MS << (attempt < 4 ? attempt : 4);
+    if (cap > BACKOFF_MAX_MS) cap = BACKOFF_MAX_MS;
+    return esp_random() % (cap + 1);
+}
+
+// ---- Circuit breaker ----
+
+static portMUX_TYPE       s_lock = portMUX_INITIALIZER_UNLOCKED;
+static ha_breaker_state_t s_state;
+static int                s_failures;       // consecutive, while CLOSED
+static uint32_t           s_open_ms;        // current cool-down
+static int64_t            s_open_until_us;
+
+static metrics_gauge_t   m_state    = METRICS_GAUGE_INIT("ha_breaker_state", "Circuit breaker state (0 closed, 1 open, 2 half-open)");
+static metrics_counter_t m_trips    = METRICS_COUNTER_INIT("ha_breaker_trips_total", "Times the circuit breaker opened");
+static metrics_counter_t m_rejected = METRICS_COUNTER_INIT("ha_requests_rejected_total", "HA requests failed fast by the open breaker");
+
+static void set_state(ha_breaker_state_t st)
+{
+    s_state = st;
+    metrics_gauge_set(&m_state, st);
+}
+
+void ha_breaker_init(void)
+{
+    metrics_register_gauge(&m_state);
+    metrics_register_counter(&m_trips);
+    metrics_register_counter(&m_rejected);
+    s_open_ms = BASE_OPEN_MS;
+    set_state(HA_BREAKER_CLOSED);
+}
+
+bool ha_breaker_allow(void)
+{
+    bool allow = true;
+    taskENTER_CRITICAL(&s_lock);
+    if (s_state == HA_BREAKER_OPEN && esp_timer_get_time() >= s_open_until_us)
+        set_state(HA_BREAKER_HALF_OPEN);    // this caller is the probe
+    else if (s_state != HA_BREAKER_CLOSED)
+        allow = false;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (!allow) metrics_counter_inc(&m_rejected);
+    return allow;
+}
+
+void ha_breaker_record(bool ok)
+{
+    ha_breaker_state_t before, after;
+
+    taskENTER_CRITICAL(&s_lock);
+    before = s_state;
+    if (ok) {
+        s_failures = 0;
+        s_open_ms  = BASE_OPEN_MS;
+        set_state(HA_BREAKER_CLOSED);
+    } else if (s_state == HA_BREAKER_HALF_OPEN ||
+               (s_state == HA_BREAKER_CLOSED && ++s_failures >= CONFIG_HA_BREAKER_FAILURES)) {
+        if (s_state == HA_BREAKER_HALF_OPEN) {
+            s_open_ms *= 2;
+            if (s_open_ms > CONFIG_HA_BREAKER_MAX_OPEN_MS) s_open_ms = CONFIG_HA_BREAKER_MAX_OPEN_MS;
+        }
+        s_failures = 0;
+        s_open_until_us = esp_timer_get_time() + s_open_ms * 1000LL;
+        set_state(HA_BREAKER_OPEN);
+    }
+    after = s_state;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (before == after) return;
+    if (after == HA_BREAKER_OPEN) {
+        if (before == HA_BREAKER_CLOSED) metrics_counter_inc(&m_trips);
+        ESP_LOGW(TAG, "HA unreachable, failing fast for %lu ms", (unsigned long)s_open_ms);
+    } else if (after == HA_BREAKER_CLOSED) {
+        ESP_LOGI(TAG, "HA reachable again");
+    }
+}
+
+ha_breaker_state_t ha_breaker_state(void)
+{
+    return s_state;
+}
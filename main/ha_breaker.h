@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * HA request health: adaptive per-endpoint timeouts and a circuit breaker
+ * shared by every request to Home Assistant.
+ */
+
+// ---- Adaptive timeouts ----
+
+#define HA_RTT_WINDOW 32
+
+// Recent round-trip times of one endpoint class. Owned by the caller;
+// each instance must only be updated from one task.
+typedef struct {
+    uint16_t samples[HA_RTT_WINDOW];
+    uint8_t  next;
+    uint8_t  count;
+} ha_rtt_t;
+
+void ha_rtt_observe(ha_rtt_t *rtt, uint32_t ms);
+
+// p99 of the window times CONFIG_HA_TIMEOUT_RTT_FACTOR, clamped to
+// [CONFIG_HA_TIMEOUT_MIN_MS, CONFIG_HA_TIMEOUT_MAX_MS]. Returns the maximum
+// until the window has enough samples.
+uint32_t ha_rtt_timeout_ms(const ha_rtt_t *rtt);
+
+// ---- Circuit breaker ----
+
+typedef enum {
+    HA_BREAKER_CLOSED,      // requests flow
+    HA_BREAKER_OPEN,        // failing fast until the cool-down ends
+    HA_BREAKER_HALF_OPEN,   // one probe request in flight
+} ha_breaker_state_t;
+
+void ha_breaker_init(void);
+
+// Whether a request may be sent now. Every true return must be followed by
+// exactly one ha_breaker_record().
+bool ha_breaker_allow(void);
+
+// `ok` means HA answered (any status below 500)
+void ha_breaker_record(bool ok);
+
+ha_breaker_state_t ha_breaker_state(void);
+
+// Full-jitter exponential backoff for retry `attempt` (0-based)
+uint32_t ha_backoff_ms(int attempt);
@@ -0,0 +1,873 @@
+/*
+ * Asynchronous HA HTTP engine
+ *
+ * esp_http_client's is_async mode only works over TLS, so this drives raw
+ * lwIP sockets from a single task:
+ *
+ *   ha_engine_submit() -> request queue -> engine task -> N connection slots
+ *                                              ^
+ *                              select() on sockets + wake-up eventfd
+ *
+ * Each slot is one non-blocking TCP connection kept alive between requests:
+ *
+ *   CLOSED -> CONNECTING [-> HANDSHAKE] -> SENDING -> HEAD -> BODY -> IDLE
+ *                ^                                                     |
+ *                +------------- reconnect when HA closed it -----------+
+ *
+ * With an https:// base URL every slot runs TLS (ha_tls.c) and new
+ * connections resume the last TLS session, so only the first connection
+ * after boot pays for a full handshake. The request timeout is extended
+ * by CONFIG_HA_TLS_HANDSHAKE_MS while a handshake is part of it.
+ *
+ * Scheduling: one queue per priority class (ha_engine.h). Free slots take
+ * interactive requests first, then resync, then background. The last slot
+ * only ever carries interactive requests, so a user command never waits
+ * behind a poll; background requests are held back entirely while
+ * interactive work is queued or in flight, and queued polls of an entity
+ * are cancelled when a command for it is dispatched (their result would
+ * be discarded as stale anyway).
+ *
+ * Requests go out with sendmsg() over pre-serialized templates and
+ * responses are parsed inside the slot's receive buffer (ha_wire.c), so a
+ * request costs no heap allocation and no copy of headers or body. Over
+ * TLS the pieces are gathered into one buffer first so the request goes
+ * out as a single record.
+ * Bodies are framed by Content-Length, chunked encoding or connection
+ * close. A read that fails on a reused connection before any response
+ * byte arrived is resent once on a fresh one (HA drops idle connections);
+ * a service call is not, since HA may already have run it. Failed GETs
+ * wait in BACKOFF for a jittered retry; the adaptive timeout and circuit
+ * breaker (ha_breaker.c) apply per attempt.
+ */
+
+#include "ha_engine.h"
+#include "ha_breaker.h"
+#include "ha_wire.h"
+#include "ha_tls.h"
+#include "ha_gzip.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
+#include "esp_vfs_eventfd.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "sdkconfig.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+static const char *TAG = "ha_engine";
+
+#define HA_BASE_URL  CONFIG_HA_BASE_URL
+#define HA_TOKEN     CONFIG_HA_TOKEN
+
+#define MAX_CONNS     CONFIG_HA_MAX_INFLIGHT
+#define QUEUE_LEN     16       // per priority class
+#define RESERVED_CONN (MAX_CONNS > 1 ? MAX_CONNS - 1 : -1)
+#define RX_BUF_SIZE   2816     // response head + decoded body
+#define TX_BUF_SIZE   768      // gathered request, TLS only
+#define IO_AGAIN      -2       // conn_send()/conn_recv() would block
+#define SELECT_MAX_MS 1000
+// The handshake, X.509 chain verification against the certificate bundle
+// included, runs on the engine task; see the task table for the high-water mark
+#define STACK_HTTP    6144
+#define STACK_HTTPS   10240
+
+typedef enum {
+    CONN_CLOSED,
+    CONN_IDLE,          // connected, no request
+    CONN_CONNECTING,
+    CONN_HANDSHAKE,     // TLS only
+    CONN_SENDING,
+    CONN_HEAD,
+    CONN_BODY,
+    CONN_BACKOFF,       // request waiting for its retry, no socket
+} conn_state_t;
+
+typedef struct {
+    int            fd;
+    conn_state_t   state;
+    bool           reused;      // request went out on a kept-alive connection
+    bool           got_bytes;   // any response byte received
+    ha_request_t   req;
+    int            attempt;
+    int64_t        started_us;
+    int64_t        deadline_us; // timeout, or retry time in BACKOFF
+    uint32_t       cycles;      // CPU cycles spent on this request so far
+
+    struct iovec   iov[HA_WIRE_MAX_IOV];
+    int            iov_cnt;
+    int            iov_idx;
+    char           clen[12];
+
+    ha_tls_conn_t  tls;
+    char           tx[TX_BUF_SIZE];
+    int            tx_len;
+    const char    *tx_ext;      // body sent after tx when it does not fit
+    int            tx_ext_len;
+    int            tx_off;      // into tx, then tx_ext
+    uint32_t       hs_ms;       // TLS handshake time within this attempt
+
+    char           rx[RX_BUF_SIZE];
+    int            rx_len;      // bytes of rx in use (head + decoded body)
+    int            wire_bytes;  // response bytes received, head included
+    ha_wire_resp_t resp;
+    ha_gzip_t      gz;          // decoded body of a gzip response
+    uint32_t       inflate_cycles;
+} conn_t;
+
+// Ring of queued requests of one priority class. `space` counts free
+// entries so submitters can block; the ring itself is guarded by s_lock.
+typedef struct {
+    ha_request_t      items[QUEUE_LEN];
+    uint8_t           head;
+    uint8_t           count;
+    SemaphoreHandle_t space;
+} req_queue_t;
+
+static conn_t             s_conns[MAX_CONNS];
+static req_queue_t        s_queues[HA_PRIO_COUNT];
+static portMUX_TYPE       s_lock = portMUX_INITIALIZER_UNLOCKED;
+static int                s_wake_fd = -1;
+static struct sockaddr_in s_addr;
+static bool               s_addr_ok;
+static char               s_host[64];       // Host header value
+static char               s_hostname[64];
+static uint16_t           s_port;
+static bool               s_tls;            // https:// base URL
+static uint32_t           s_cycle_mark;
+
+// Only touched by the engine task
+static ha_rtt_t s_rtt[HA_EP_COUNT];
+
+// ---- Metrics ----
+
+static const uint32_t s_latency_bounds[] = { 10, 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+#define LATENCY_HELP "HA request duration (ms)"
+#define TIMEOUT_HELP "Adaptive timeout of the next HA request (ms)"
+
+static metrics_gauge_t     m_rtt = METRICS_GAUGE_INIT("ha_http_rtt_ms", "Duration of the last HA request (ms)");
+static metrics_histogram_t m_latency[HA_EP_COUNT] = {
+    [HA_EP_STATES]   = METRICS_HISTOGRAM_INIT_L("ha_http_latency_ms", LATENCY_HELP, "endpoint=\"states\"", s_latency_bounds),
+    [HA_EP_LIGHT]    = METRICS_HISTOGRAM_INIT_L("ha_http_latency_ms", LATENCY_HELP, "endpoint=\"light\"",  s_latency_bounds),
+    [HA_EP_COVER]    = METRICS_HISTOGRAM_INIT_L("ha_http_latency_ms", LATENCY_HELP, "endpoint=\"cover\"",  s_latency_bounds),
+    [HA_EP_TEMPLATE] = METRICS_HISTOGRAM_INIT_L("ha_http_latency_ms", LATENCY_HELP, "endpoint=\"template\"", s_latency_bounds),
+};
+static metrics_gauge_t m_timeout[HA_EP_COUNT] = {
+    [HA_EP_STATES]   = METRICS_GAUGE_INIT_L("ha_http_timeout_ms", TIMEOUT_HELP, "endpoint=\"states\""),
+    [HA_EP_LIGHT]    = METRICS_GAUGE_INIT_L("ha_http_timeout_ms", TIMEOUT_HELP, "endpoint=\"light\""),
+    [HA_EP_COVER]    = METRICS_GAUGE_INIT_L("ha_http_timeout_ms", TIMEOUT_HELP, "endpoint=\"cover\""),
+    [HA_EP_TEMPLATE] = METRICS_GAUGE_INIT_L("ha_http_timeout_ms", TIMEOUT_HELP, "endpoint=\"template\""),
+};
+static metrics_counter_t m_req_ok     = METRICS_COUNTER_INIT("ha_requests_ok_total", "HA requests answered with 200");
+static metrics_counter_t m_req_failed = METRICS_COUNTER_INIT("ha_requests_failed_total", "HA requests failed or non-200");
+static metrics_counter_t m_retries    = METRICS_COUNTER_INIT("ha_get_retries_total", "State GETs retried after a transport error or 5xx");
+static metrics_counter_t m_connects   = METRICS_COUNTER_INIT("ha_connections_opened_total", "TCP connections opened to HA");
+static metrics_gauge_t   m_inflight   = METRICS_GAUGE_INIT("ha_inflight", "HA requests currently on a connection");
+
+static const uint32_t s_bytes_bounds[] = { 128, 256, 512, 1024, 2048, 4096, 8192 };
+
+#define BYTES_HELP "Size of an HA response, head and body (bytes)"
+
+static metrics_histogram_t m_resp_bytes[HA_EP_COUNT] = {
+    [HA_EP_STATES]   = METRICS_HISTOGRAM_INIT_L("ha_http_response_bytes", BYTES_HELP, "endpoint=\"states\"", s_bytes_bounds),
+    [HA_EP_LIGHT]    = METRICS_HISTOGRAM_INIT_L("ha_http_response_bytes", BYTES_HELP, "endpoint=\"light\"",  s_bytes_bounds),
+    [HA_EP_COVER]    = METRICS_HISTOGRAM_INIT_L("ha_http_response_bytes", BYTES_HELP, "endpoint=\"cover\"",  s_bytes_bounds),
+    [HA_EP_TEMPLATE] = METRICS_HISTOGRAM_INIT_L("ha_http_response_bytes", BYTES_HELP, "endpoint=\"template\"", s_bytes_bounds),
+};
+
+static metrics_counter_t   m_gzip_wire = METRICS_COUNTER_INIT("ha_http_gzip_wire_bytes_total", "Compressed body bytes received from HA");
+static metrics_counter_t   m_gzip_body = METRICS_COUNTER_INIT("ha_http_gzip_body_bytes_total", "Body bytes after inflating gzip responses");
+static const uint32_t      s_inflate_bounds[] = { 10, 25, 50, 100, 250, 500, 1000, 2500 };
+static metrics_histogram_t m_inflate_kcycles = METRICS_HISTOGRAM_INIT("ha_http_inflate_kcycles", "CPU cost of inflating one gzip response (kcycles)", s_inflate_bounds);
+
+static const uint32_t s_wait_bounds[] = { 1, 5, 10, 25, 50, 100, 250, 500, 1000, 5000 };
+
+#define WAIT_HELP "Time from submit to dispatch onto a connection (ms)"
+
+static metrics_histogram_t m_queue_wait[HA_PRIO_COUNT] = {
+    [HA_PRIO_INTERACTIVE] = METRICS_HISTOGRAM_INIT_L("ha_queue_wait_ms", WAIT_HELP, "class=\"interactive\"", s_wait_bounds),
+    [HA_PRIO_RESYNC]      = METRICS_HISTOGRAM_INIT_L("ha_queue_wait_ms", WAIT_HELP, "class=\"resync\"",      s_wait_bounds),
+    [HA_PRIO_BACKGROUND]  = METRICS_HISTOGRAM_INIT_L("ha_queue_wait_ms", WAIT_HELP, "class=\"background\"",  s_wait_bounds),
+};
+static metrics_counter_t m_cancelled = METRICS_COUNTER_INIT("ha_requests_cancelled_total", "Queued polls cancelled by a command for the same entity");
+
+static const uint32_t s_kcycle_bounds[] = { 25, 50, 100, 200, 400, 800, 1600 };
+
+static metrics_histogram_t m_kcycles = METRICS_HISTOGRAM_INIT("ha_request_kcycles", "Engine CPU time per request, excluding the completion callback (kcycles)", s_kcycle_bounds);
+
+// ---- Connection helpers ----
+
+static bool conn_busy(const conn_t *c)
+{
+    return c->state != CONN_CLOSED && c->state != CONN_IDLE;
+}
+
+// Bill the CPU cycles since the last mark to this request
+static void charge(conn_t *c)
+{
+    uint32_t now = esp_cpu_get_cycle_count();
+    c->cycles += now - s_cycle_mark;
+    s_cycle_mark = now;
+}
+
+static void prepare_send(conn_t *c)
+{
+    c->iov_cnt = ha_wire_request(&c->req, c->iov, c->clen);
+    c->iov_idx = 0;
+    if (!s_tls) return;
+
+    // One mbedtls_ssl_write() per request: one record, one segment
+    c->tx_len = 0;
+    c->tx_off = 0;
+    c->tx_ext     = NULL;
+    c->tx_ext_len = 0;
+    for (int i = 0; i < c->iov_cnt; i++) {
+        size_t n = c->iov[i].iov_len;
+        if (c->tx_len + n > sizeof(c->tx)) {
+            // A long body (a template) follows the head in a second record
+            if (i == c->iov_cnt - 1) {
+                c->tx_ext     = c->iov[i].iov_base;
+                c->tx_ext_len = n;
+                return;
+            }
+            ESP_LOGE(TAG, "Request does not fit the TLS send buffer");
+            c->tx_len = 0;
+            return;
+        }
+        memcpy(c->tx + c->tx_len, c->iov[i].iov_base, n);
+        c->tx_len += n;
+    }
+}
+
+static void close_conn(conn_t *c)
+{
+    ha_tls_close(&c->tls);
+    if (c->fd >= 0) close(c->fd);
+    c->fd = -1;
+    c->state = CONN_CLOSED;
+}
+
+// recv() on the plain or TLS connection; IO_AGAIN when it would block
+static int conn_recv(conn_t *c, char *buf, int len)
+{
+    if (s_tls) {
+        int n = ha_tls_recv(&c->tls, buf, len);
+        return n == HA_TLS_WANT_READ || n == HA_TLS_WANT_WRITE ? IO_AGAIN : n;
+    }
+    int n = recv(c->fd, buf, len, 0);
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return IO_AGAIN;
+    return n;
+}
+
+static bool resolve(void)
+{
+    if (s_addr_ok) return true;
+
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *res = NULL;
+    if (getaddrinfo(s_hostname, NULL, &hints, &res) != 0 || !res) {
+        ESP_LOGW(TAG, "Cannot resolve %s", s_hostname);
+        return false;
+    }
+    memcpy(&s_addr, res->ai_addr, sizeof(s_addr));
+    s_addr.sin_port = htons(s_port);
+    freeaddrinfo(res);
+    s_addr_ok = true;
+    return true;
+}
+
+static void complete(conn_t *c, int status);
+static void begin_connect(conn_t *c);
+
+// Transport failure: resend once if a kept-alive connection went stale.
+// The resend is the same attempt as far as breaker and timeout go. Service
+// calls are not resent: HA may have run the call before the connection
+// died, and a second toggle would undo it.
+static void fail(conn_t *c)
+{
+    close_conn(c);
+    if (c->reused && !c->got_bytes && !c->req.service) {
+        c->reused = false;
+        prepare_send(c);
+        begin_connect(c);
+        return;
+    }
+    complete(c, HA_STATUS_TRANSPORT_ERROR);
+}
+
+static void try_send_tls(conn_t *c)
+{
+    if (c->tx_len == 0) {
+        fail(c);
+        return;
+    }
+    int total = c->tx_len + c->tx_ext_len;
+    while (c->tx_off < total) {
+        int n = c->tx_off < c->tx_len
+              ? ha_tls_send(&c->tls, c->tx + c->tx_off, c->tx_len - c->tx_off)
+              : ha_tls_send(&c->tls, c->tx_ext + (c->tx_off - c->tx_len), total - c->tx_off);
+        if (n == HA_TLS_WANT_READ || n == HA_TLS_WANT_WRITE) return;
+        if (n < 0) {
+            fail(c);
+            return;
+        }
+        c->tx_off += n;
+    }
+    c->state = CONN_HEAD;
+}
+
+static void try_send(conn_t *c)
+{
+    if (s_tls) {
+        try_send_tls(c);
+        return;
+    }
+    while (c->iov_idx < c->iov_cnt) {
+        struct msghdr msg = {
+            .msg_iov    = c->iov + c->iov_idx,
+            .msg_iovlen = c->iov_cnt - c->iov_idx,
+        };
+        int n = sendmsg(c->fd, &msg, 0);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return;
+            fail(c);
+            return;
+        }
+        // Skip fully sent pieces, trim a partially sent one
+        while (c->iov_idx < c->iov_cnt && (size_t)n >= c->iov[c->iov_idx].iov_len)
+            n -= c->iov[c->iov_idx++].iov_len;
+        if (n > 0) {
+            c->iov[c->iov_idx].iov_base = (char *)c->iov[c->iov_idx].iov_base + n;
+            c->iov[c->iov_idx].iov_len -= n;
+        }
+    }
+    c->state = CONN_HEAD;
+}
+
+static void step_handshake(conn_t *c)
+{
+    int r = ha_tls_handshake(&c->tls);
+    if (r == HA_TLS_WANT_READ || r == HA_TLS_WANT_WRITE) return;
+    if (r < 0) {
+        fail(c);
+        return;
+    }
+    c->hs_ms = c->tls.hs_ms;
+    c->state = CONN_SENDING;
+    try_send(c);
+}
+
+// TCP is up: start TLS, or the request itself
+static void on_connected(conn_t *c)
+{
+    if (!s_tls) {
+        c->state = CONN_SENDING;
+        try_send(c);
+        return;
+    }
+    if (ha_tls_open(&c->tls, c->fd) != ESP_OK) {
+        fail(c);
+        return;
+    }
+    c->state = CONN_HANDSHAKE;
+    step_handshake(c);
+}
+
+static void begin_connect(conn_t *c)
+{
+    if (!resolve()) {
+        complete(c, HA_STATUS_TRANSPORT_ERROR);
+        return;
+    }
+    c->fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (c->fd < 0) {
+        ESP_LOGE(TAG, "socket() failed: %d", errno);
+        complete(c, HA_STATUS_TRANSPORT_ERROR);
+        return;
+    }
+    fcntl(c->fd, F_SETFL, fcntl(c->fd, F_GETFL, 0) | O_NONBLOCK);
+    int one = 1;
+    setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    metrics_counter_inc(&m_connects);
+    if (s_tls) c->deadline_us += CONFIG_HA_TLS_HANDSHAKE_MS * 1000LL;
+
+    if (connect(c->fd, (struct sockaddr *)&s_addr, sizeof(s_addr)) == 0) {
+        on_connected(c);
+    } else if (errno == EINPROGRESS) {
+        c->state = CONN_CONNECTING;
+    } else {
+        fail(c);
+    }
+}
+
+// Send c->req on this slot, reusing the connection when it is alive
+static void start_request(conn_t *c)
+{
+    if (!ha_breaker_allow()) {
+        if (c->state == CONN_BACKOFF) c->state = CONN_CLOSED;
+        if (c->req.done) c->req.done(&c->req, HA_STATUS_REJECTED, "", 0);
+        return;
+    }
+
+    uint32_t timeout = ha_rtt_timeout_ms(&s_rtt[c->req.ep]);
+    metrics_gauge_set(&m_timeout[c->req.ep], (int32_t)timeout);
+    c->started_us  = esp_timer_get_time();
+    c->deadline_us = c->started_us + timeout * 1000LL;
+    c->got_bytes   = false;
+    c->hs_ms       = 0;
+    c->rx_len      = 0;
+    c->wire_bytes  = 0;
+    c->inflate_cycles = 0;
+    c->resp        = (ha_wire_resp_t){ 0 };
+    prepare_send(c);
+
+    if (c->state == CONN_IDLE) {
+        c->reused = true;
+        c->state  = CONN_SENDING;
+        try_send(c);
+    } else {
+        c->reused = false;
+        begin_connect(c);
+    }
+}
+
+// Observe the attempt, then retry it or hand the response to the caller
+static void complete(conn_t *c, int status)
+{
+    ha_endpoint_t ep = c->req.ep;
+    uint32_t ms = (uint32_t)((esp_timer_get_time() - c->started_us) / 1000);
+
+    charge(c);
+    metrics_histogram_observe(&m_kcycles, c->cycles / 1000);
+    c->cycles = 0;
+
+    // A handshake is not round-trip time; it has its own allowance
+    ha_rtt_observe(&s_rtt[ep], ms > c->hs_ms ? ms - c->hs_ms : 0);
+    ha_breaker_record(status > 0 && status < 500);
+    metrics_gauge_set(&m_rtt, (int32_t)ms);
+    metrics_histogram_observe(&m_latency[ep], ms);
+    metrics_counter_inc(status == 200 ? &m_req_ok : &m_req_failed);
+
+    bool retry = !c->req.service && (status < 0 || status >= 500) &&
+                 c->attempt < CONFIG_HA_GET_RETRIES &&
+                 ha_breaker_state() != HA_BREAKER_OPEN;
+    if (retry) {
+        close_conn(c);
+        c->state = CONN_BACKOFF;
+        c->deadline_us = esp_timer_get_time() + ha_backoff_ms(c->attempt) * 1000LL;
+        c->attempt++;
+        metrics_counter_inc(&m_retries);
+        return;
+    }
+
+    if (status > 0 && c->resp.keep_alive && c->fd >= 0) c->state = CONN_IDLE;
+    else                                                 close_conn(c);
+
+    const char *body = "";
+    int body_len = 0;
+    if (status > 0) metrics_histogram_observe(&m_resp_bytes[ep], (uint32_t)c->wire_bytes);
+    if (status > 0 && c->resp.gzip) {
+        metrics_counter_add(&m_gzip_body, (uint32_t)c->gz.out_len);
+        metrics_histogram_observe(&m_inflate_kcycles, c->inflate_cycles / 1000);
+        body     = c->gz.out;
+        body_len = c->gz.out_len;
+    } else if (status > 0 && c->resp.body) {
+        c->resp.body[c->resp.body_len] = '\0';
+        body     = c->resp.body;
+        body_len = c->resp.body_len;
+    }
+    if (c->req.done) c->req.done(&c->req, status, body, body_len);
+}
+
+// ---- Socket events ----
+
+static void on_writable(conn_t *c)
+{
+    if (c->state == CONN_CONNECTING) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &err, &len);
+        if (err) {
+            ESP_LOGD(TAG, "connect failed: %d", err);
+            fail(c);
+            return;
+        }
+        on_connected(c);
+    } else if (c->state == CONN_HANDSHAKE) {
+        step_handshake(c);
+    } else if (c->state == CONN_SENDING) {
+        try_send(c);
+    }
+}
+
+static void on_readable(conn_t *c)
+{
+    static char discard[512];
+
+    if (c->state == CONN_HANDSHAKE) {
+        step_handshake(c);
+        return;
+    }
+    for (;;) {
+        // Receive straight behind the head/decoded body; once the body is
+        // full, keep draining into a scratch buffer to stay in sync
+        char *dst = c->rx + c->rx_len;
+        int space = RX_BUF_SIZE - 1 - c->rx_len;
+        if (space <= 0) {
+            dst = discard;
+            space = sizeof(discard);
+        }
+
+        int n = conn_recv(c, dst, space);
+        if (n == IO_AGAIN) return;
+
+        if (c->state == CONN_IDLE) {
+            close_conn(c);  // HA closed the idle connection (or sent garbage)
+            return;
+        }
+        if (n < 0) {
+            fail(c);
+            return;
+        }
+        if (n == 0) {
+            if (c->state == CONN_BODY && c->resp.body_mode == HA_WIRE_BODY_UNTIL_CLOSE) {
+                close_conn(c);
+                complete(c, c->resp.status);
+            } else {
+                fail(c);
+            }
+            return;
+        }
+        c->got_bytes = true;
+        c->wire_bytes += n;
+
+        if (c->state == CONN_HEAD) {
+            int prev = c->rx_len;
+            c->rx_len += n;
+            c->rx[c->rx_len] = '\0';
+            int head_len = ha_wire_parse_head(&c->resp, c->rx, c->rx_len, prev, RX_BUF_SIZE);
+            if (head_len == 0) continue;
+            if (head_len < 0) {
+                ESP_LOGW(TAG, "Bad response head from HA");
+                c->reused = false;
+                fail(c);
+                return;
+            }
+            c->state = CONN_BODY;
+            if (c->resp.gzip && ha_gzip_begin(&c->gz) != ESP_OK) {
+                ESP_LOGE(TAG, "No memory to inflate a gzip response");
+                c->reused = false;
+                fail(c);
+                return;
+            }
+            if (c->resp.body_mode == HA_WIRE_BODY_LENGTH && c->resp.remaining == 0) {
+                complete(c, c->resp.status);
+                return;
+            }
+            dst = c->rx + head_len;
+            n   = c->rx_len - head_len;
+        }
+
+        bool done = ha_wire_feed_body(&c->resp, dst, n);
+        if (c->resp.gzip) {
+            // Inflate what arrived and reuse the receive buffer for the
+            // next compressed bytes
+            uint32_t t0 = esp_cpu_get_cycle_count();
+            metrics_counter_add(&m_gzip_wire, (uint32_t)c->resp.body_len);
+            ha_gzip_feed(&c->gz, c->resp.body, c->resp.body_len);
+            c->resp.body_len = 0;
+            c->inflate_cycles += esp_cpu_get_cycle_count() - t0;
+        }
+        c->rx_len = (int)(c->resp.body - c->rx) + c->resp.body_len;
+        if (done && c->resp.gzip && c->gz.failed) {
+            fail(c);
+            return;
+        }
+        if (done) {
+            complete(c, c->resp.status);
+            return;
+        }
+    }
+}
+
+// ---- Queues (any task) ----
+
+static bool queue_push(req_queue_t *q, const ha_request_t *req)
+{
+    bool ok = false;
+    taskENTER_CRITICAL(&s_lock);
+    if (q->count < QUEUE_LEN) {
+        q->items[(q->head + q->count) % QUEUE_LEN] = *req;
+        q->count++;
+        ok = true;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    return ok;
+}
+
+static bool queue_pop(req_queue_t *q, ha_request_t *out)
+{
+    bool ok = false;
+    taskENTER_CRITICAL(&s_lock);
+    if (q->count > 0) {
+        *out = q->items[q->head];
+        q->head = (q->head + 1) % QUEUE_LEN;
+        q->count--;
+        ok = true;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    if (ok) xSemaphoreGive(q->space);
+    return ok;
+}
+
+static bool queue_empty(const req_queue_t *q)
+{
+    return q->count == 0;
+}
+
+// ---- Scheduling (engine task) ----
+
+// Remove queued background requests for `entity_id` and complete them as
+// cancelled. Order of the remaining requests is kept.
+static void cancel_background(const char *entity_id)
+{
+    req_queue_t *q = &s_queues[HA_PRIO_BACKGROUND];
+    ha_request_t victims[4];
+    int n_victims = 0;
+
+    taskENTER_CRITICAL(&s_lock);
+    int kept = 0;
+    for (int i = 0; i < q->count; i++) {
+        ha_request_t *r = &q->items[(q->head + i) % QUEUE_LEN];
+        bool match = n_victims < (int)(sizeof(victims) / sizeof(victims[0])) &&
+                     r->entity_id && strcmp(r->entity_id, entity_id) == 0;
+        if (match) victims[n_victims++] = *r;
+        else       q->items[(q->head + kept++) % QUEUE_LEN] = *r;
+    }
+    q->count = kept;
+    taskEXIT_CRITICAL(&s_lock);
+
+    for (int i = 0; i < n_victims; i++) {
+        xSemaphoreGive(q->space);
+        metrics_counter_inc(&m_cancelled);
+        if (victims[i].done) victims[i].done(&victims[i], HA_STATUS_CANCELLED, "", 0);
+    }
+}
+
+static bool interactive_busy(void)
+{
+    if (!queue_empty(&s_queues[HA_PRIO_INTERACTIVE])) return true;
+    for (int i = 0; i < MAX_CONNS; i++)
+        if (conn_busy(&s_conns[i]) && s_conns[i].req.prio == HA_PRIO_INTERACTIVE) return true;
+    return false;
+}
+
+// A free slot for `prio`: prefer a kept-alive connection over a closed one
+static conn_t *free_conn(ha_priority_t prio)
+{
+    conn_t *closed = NULL;
+    for (int i = 0; i < MAX_CONNS; i++) {
+        if (i == RESERVED_CONN && prio != HA_PRIO_INTERACTIVE) continue;
+        if (s_conns[i].state == CONN_IDLE) return &s_conns[i];
+        if (s_conns[i].state == CONN_CLOSED && !closed) closed = &s_conns[i];
+    }
+    return closed;
+}
+
+static void dispatch(void)
+{
+    for (ha_priority_t prio = 0; prio < HA_PRIO_COUNT; prio++) {
+        if (prio == HA_PRIO_BACKGROUND && interactive_busy()) return;
+
+        conn_t *c;
+        while (!queue_empty(&s_queues[prio]) && (c = free_conn(prio)) &&
+               queue_pop(&s_queues[prio], &c->req)) {
+            int64_t now = esp_timer_get_time();
+            metrics_histogram_observe(&m_queue_wait[prio], (uint32_t)((now - c->req.queued_us) / 1000));
+            if (prio == HA_PRIO_INTERACTIVE && c->req.entity_id)
+                cancel_background(c->req.entity_id);
+
+            c->attempt = 0;
+            c->cycles  = 0;
+            s_cycle_mark = esp_cpu_get_cycle_count();
+            start_request(c);
+            if (conn_busy(c)) charge(c);
+        }
+    }
+}
+
+// ---- Engine task ----
+
+static void check_deadlines(int64_t now)
+{
+    for (int i = 0; i < MAX_CONNS; i++) {
+        conn_t *c = &s_conns[i];
+        if (!conn_busy(c) || now < c->deadline_us) continue;
+        s_cycle_mark = esp_cpu_get_cycle_count();
+        if (c->state == CONN_BACKOFF) {
+            start_request(c);
+            if (conn_busy(c)) charge(c);
+        } else {
+            ESP_LOGD(TAG, "%s timed out", c->req.service   ? c->req.service :
+                                           c->req.entity_id ? c->req.entity_id : "template");
+            close_conn(c);
+            complete(c, HA_STATUS_TRANSPORT_ERROR);
+        }
+    }
+}
+
+static void engine_task(void *arg)
+{
+    for (;;) {
+        dispatch();
+
+        fd_set rd, wr;
+        FD_ZERO(&rd);
+        FD_ZERO(&wr);
+        FD_SET(s_wake_fd, &rd);
+        int maxfd = s_wake_fd;
+        int busy = 0;
+        int64_t now  = esp_timer_get_time();
+        int64_t next = now + SELECT_MAX_MS * 1000LL;
+
+        for (int i = 0; i < MAX_CONNS; i++) {
+            conn_t *c = &s_conns[i];
+            if (conn_busy(c)) {
+                busy++;
+                if (c->deadline_us < next) next = c->deadline_us;
+            }
+            if (c->fd < 0) continue;
+            bool want_wr = c->state == CONN_CONNECTING || c->state == CONN_SENDING ||
+                           (c->state == CONN_HANDSHAKE && c->tls.want_write);
+            if (want_wr) FD_SET(c->fd, &wr);
+            else         FD_SET(c->fd, &rd);
+            if (c->fd > maxfd) maxfd = c->fd;
+        }
+        metrics_gauge_set(&m_inflight, busy);
+
+        int64_t wait_us = next > now ? next - now : 0;
+        struct timeval tv = {
+            .tv_sec  = wait_us / 1000000,
+            .tv_usec = wait_us % 1000000,
+        };
+        if (select(maxfd + 1, &rd, &wr, NULL, &tv) < 0) {
+            ESP_LOGE(TAG, "select() failed: %d", errno);
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+
+        if (FD_ISSET(s_wake_fd, &rd)) {
+            uint64_t v;
+            read(s_wake_fd, &v, sizeof(v));
+        }
+        for (int i = 0; i < MAX_CONNS; i++) {
+            conn_t *c = &s_conns[i];
+            int fd = c->fd;
+            if (fd < 0) continue;
+            s_cycle_mark = esp_cpu_get_cycle_count();
+            if (FD_ISSET(fd, &wr)) on_writable(c);
+            if (c->fd == fd && FD_ISSET(fd, &rd)) on_readable(c);
+            if (conn_busy(c)) charge(c);
+        }
+        check_deadlines(esp_timer_get_time());
+    }
+}
+
+// ---- Public API ----
+
+static bool parse_base_url(void)
+{
+    const char *p = HA_BASE_URL;
+    if (strncmp(p, "https://", 8) == 0) {
+        s_tls = true;
+        p += 8;
+    } else if (strncmp(p, "http://", 7) == 0) {
+        p += 7;
+    } else {
+        ESP_LOGE(TAG, "Base URL must start with http:// or https://: %s", p);
+        return false;
+    }
+    size_t host_len = strcspn(p, ":/");
+    if (host_len == 0 || host_len >= sizeof(s_hostname)) return false;
+    memcpy(s_hostname, p, host_len);
+    s_hostname[host_len] = '\0';
+    s_port = p[host_len] == ':' ? (uint16_t)atoi(p + host_len + 1) : (s_tls ? 443 : 80);
+    snprintf(s_host, sizeof(s_host), "%s:%u", s_hostname, s_port);
+    return true;
+}
+
+esp_err_t ha_engine_start(void)
+{
+    if (!parse_base_url()) return ESP_ERR_INVALID_ARG;
+    esp_err_t err = ha_wire_init(s_host, HA_TOKEN);
+    if (err != ESP_OK) return err;
+    if (s_tls) {
+        err = ha_tls_init(s_hostname);
+        if (err != ESP_OK) return err;
+    } else {
+        ESP_LOGW(TAG, "Plain http:// - the API token crosses the network unencrypted");
+    }
+
+    esp_vfs_eventfd_config_t efd_cfg = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+    err = esp_vfs_eventfd_register(&efd_cfg);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) return err;
+    s_wake_fd = eventfd(0, 0);
+    if (s_wake_fd < 0) return ESP_FAIL;
+
+    for (int i = 0; i < HA_PRIO_COUNT; i++) {
+        s_queues[i].space = xSemaphoreCreateCounting(QUEUE_LEN, QUEUE_LEN);
+        if (!s_queues[i].space) return ESP_ERR_NO_MEM;
+    }
+    for (int i = 0; i < MAX_CONNS; i++)
+        s_conns[i].fd = -1;
+
+    ha_breaker_init();
+    metrics_register_gauge(&m_rtt);
+    for (int i = 0; i < HA_EP_COUNT; i++)
+        metrics_register_histogram(&m_latency[i]);
+    for (int i = 0; i < HA_EP_COUNT; i++)
+        metrics_register_gauge(&m_timeout[i]);
+    metrics_register_counter(&m_req_ok);
+    metrics_register_counter(&m_req_failed);
+    metrics_register_counter(&m_retries);
+    metrics_register_counter(&m_connects);
+    metrics_register_gauge(&m_inflight);
+    metrics_register_histogram(&m_kcycles);
+    for (int i = 0; i < HA_EP_COUNT; i++)
+        metrics_register_histogram(&m_resp_bytes[i]);
+    metrics_register_counter(&m_gzip_wire);
+    metrics_register_counter(&m_gzip_body);
+    metrics_register_histogram(&m_inflate_kcycles);
+    for (int i = 0; i < HA_PRIO_COUNT; i++)
+        metrics_register_histogram(&m_queue_wait[i]);
+    metrics_register_counter(&m_cancelled);
+
+    xTaskCreate(engine_task, "ha_engine", s_tls ? STACK_HTTPS : STACK_HTTP, NULL, 6, NULL);
+    ESP_LOGI(TAG, "%s%s, %d connections", s_tls ? "https://" : "http://", s_host, MAX_CONNS);
+    return ESP_OK;
+}
+
+esp_err_t ha_engine_submit(const ha_request_t *req, TickType_t wait)
+{
+    if (s_wake_fd < 0 || req->prio >= HA_PRIO_COUNT) return ESP_ERR_INVALID_STATE;
+
+    req_queue_t *q = &s_queues[req->prio];
+    if (xSemaphoreTake(q->space, wait) != pdTRUE) return ESP_ERR_TIMEOUT;
+
+    ha_request_t r = *req;
+    r.queued_us = esp_timer_get_time();
+    queue_push(q, &r);      // cannot fail, space was reserved
+
+    uint64_t one = 1;
+    write(s_wake_fd, &one, sizeof(one));
+    return ESP_OK;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include <stdbool.h>
+
+/*
+ * Asynchronous HTTP/1.1 engine for Home Assistant requests.
+ *
+ * One task multiplexes up to CONFIG_HA_MAX_INFLIGHT keep-alive connections
+ * with select(). Callers queue requests and get a completion callback.
+ * Requests are dispatched strictly by priority class; one connection is
+ * reserved for interactive requests.
+ */
+
+// HA endpoint classes, used for timeouts and as the `endpoint` metrics label
+typedef enum {
+    HA_EP_STATES,
+    HA_EP_LIGHT,
+    HA_EP_COVER,
+    HA_EP_TEMPLATE,
+    HA_EP_COUNT,
+} ha_endpoint_t;
+
+// Dispatch order. Background requests wait while interactive work is
+// queued or in flight.
+typedef enum {
+    HA_PRIO_INTERACTIVE,    // user commands
+    HA_PRIO_RESYNC,         // re-read an entity after a failed command
+    HA_PRIO_BACKGROUND,     // periodic polls
+    HA_PRIO_COUNT,
+} ha_priority_t;
+
+// Completion status below 0
+#define HA_STATUS_TRANSPORT_ERROR  -1   // connect/send/receive failed or timed out
+#define HA_STATUS_REJECTED         -2   // circuit breaker open, nothing sent
+#define HA_STATUS_CANCELLED        -3   // superseded by an interactive request
+
+typedef struct ha_request ha_request_t;
+
+// Runs on the engine task and must not block. `body` is NUL-terminated
+// (truncated to the receive buffer) and only valid during the call.
+typedef void (*ha_done_fn)(const ha_request_t *req, int status, const char *body, int body_len);
+
+// String pointers must stay valid until completion (entity ids, service
+// names and templates are static); only `body` is copied with the request.
+// A queued background request for `entity_id` is cancelled when an
+// interactive request for the same entity is dispatched.
+struct ha_request {
+    ha_endpoint_t ep;
+    ha_priority_t prio;
+    const char   *entity_id;    // GET /api/states/<entity_id> when service is NULL
+    const char   *service;      // POST /api/services/<service>, e.g. "light/turn_on"
+    char          body[160];    // JSON body of a POST
+    const char   *payload;      // HA_EP_TEMPLATE: JSON body of POST /api/template
+    int           payload_len;
+    ha_done_fn    done;         // may be NULL
+    void         *ctx;
+    uint32_t      tag;          // caller data, passed back untouched
+    int64_t       queued_us;    // set by ha_engine_submit()
+};
+
+// Parse CONFIG_HA_BASE_URL and start the engine task
+esp_err_t ha_engine_start(void);
+
+// Queue a copy of `req` in its priority class, waiting up to `wait` ticks
+// for queue space
+esp_err_t ha_engine_submit(const ha_request_t *req, TickType_t wait);
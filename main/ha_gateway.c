@@ -0,0 +1,257 @@
+/*
+ * Panel gateway client
+ *
+ * One blocking TCP connection on its own task: send the hello with our
+ * entity ids, then read update frames and hand each entity's values to
+ * entity_push(). Decoding a frame is a walk over a few CBOR integers, no
+ * JSON and no string compares, which is the point of the gateway: HA's
+ * state objects are parsed once on the gateway host instead of on every
+ * panel.
+ *
+ * The gateway sends a heartbeat frame every 15 s; a connection that stays
+ * silent for three of them is considered dead and reconnected.
+ *
+ * Metrics: ha_gateway_frame_bytes per update frame, ha_gateway_decode_cycles
+ * per frame (compare with ha_poll_parse_cycles of the JSON path).
+ */
+
+#include "ha_gateway.h"
+#include "entity_model.h"
+#include "entity_push.h"
+#include "metrics.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "sdkconfig.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+static const char *TAG = "ha_gateway";
+
+#define FRAME_MAX       1024
+#define SILENCE_MS      45000
+#define RECONNECT_MS    5000
+
+static TaskHandle_t s_task;
+static void       (*s_on_link)(bool up);
+static atomic_bool  s_enabled;
+static atomic_bool  s_connected;
+static atomic_int   s_fd = -1;
+
+static const uint32_t s_bytes_bounds[] = { 16, 32, 64, 128, 256, 512, 1024 };
+static const uint32_t s_cycle_bounds[] = { 250, 500, 1000, 2500, 5000, 10000, 25000 };
+
+static metrics_histogram_t m_bytes     = METRICS_HISTOGRAM_INIT("ha_gateway_frame_bytes", "Size of a gateway update frame (bytes)", s_bytes_bounds);
+static metrics_histogram_t m_cycles    = METRICS_HISTOGRAM_INIT("ha_gateway_decode_cycles", "CPU cycles to decode and apply one gateway frame", s_cycle_bounds);
+static metrics_gauge_t     m_connected = METRICS_GAUGE_INIT("ha_gateway_connected", "1 while the panel gateway link is up");
+
+// ---- CBOR subset ----
+
+enum { CBOR_UINT = 0, CBOR_NEGINT = 1, CBOR_TEXT = 3, CBOR_ARRAY = 4 };
+
+static int cbor_put_head(uint8_t *p, int major, uint32_t v)
+{
+    if (v < 24)     { p[0] = major << 5 | v; return 1; }
+    if (v < 0x100)  { p[0] = major << 5 | 24; p[1] = v; return 2; }
+    p[0] = major << 5 | 25; p[1] = v >> 8; p[2] = v; return 3;
+}
+
+// Read one head; NULL on truncated input or an unsupported length
+static const uint8_t *cbor_head(const uint8_t *p, const uint8_t *end, int *major, uint32_t *v)
+{
+    if (p >= end) return NULL;
+    *major = *p >> 5;
+    uint8_t info = *p++ & 0x1f;
+    int n = info < 24 ? 0 : info == 24 ? 1 : info == 25 ? 2 : info == 26 ? 4 : -1;
+    if (n < 0 || end - p < n) return NULL;
+    *v = n ? 0 : info;
+    for (int i = 0; i < n; i++) *v = *v << 8 | *p++;
+    return p;
+}
+
+static const uint8_t *cbor_int(const uint8_t *p, const uint8_t *end, int32_t *out)
+{
+    int major;
+    uint32_t v;
+    if (!(p = cbor_head(p, end, &major, &v))) return NULL;
+    if (major == CBOR_UINT)   { *out = (int32_t)v;      return p; }
+    if (major == CBOR_NEGINT) { *out = -1 - (int32_t)v; return p; }
+    return NULL;
+}
+
+// ---- Frames ----
+
+static bool read_full(int fd, void *buf, int len)
+{
+    for (int got = 0; got < len;) {
+        int n = recv(fd, (char *)buf + got, len - got, 0);
+        if (n <= 0) return false;
+        got += n;
+    }
+    return true;
+}
+
+static bool send_hello(int fd)
+{
+    uint8_t buf[FRAME_MAX];
+    int n = 2;
+    n += cbor_put_head(buf + n, CBOR_ARRAY, entity_model_count());
+    for (int i = 0; i < entity_model_count(); i++) {
+        const char *id = entity_model_get(i)->entity_id;
+        int len = strlen(id);
+        if (n + 3 + len > (int)sizeof(buf)) return false;
+        n += cbor_put_head(buf + n, CBOR_TEXT, len);
+        memcpy(buf + n, id, len);
+        n += len;
+    }
+    buf[0] = (n - 2) >> 8;
+    buf[1] = n - 2;
+    return send(fd, buf, n, 0) == n;
+}
+
+// Decode one update frame and push every entity in it
+static bool apply_frame(const uint8_t *p, const uint8_t *end)
+{
+    int major;
+    uint32_t count;
+    if (!(p = cbor_head(p, end, &major, &count)) || major != CBOR_ARRAY) return false;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t fields;
+        int32_t f[5];
+        if (!(p = cbor_head(p, end, &major, &fields)) || major != CBOR_ARRAY || fields != 5) return false;
+        for (int k = 0; k < 5; k++)
+            if (!(p = cbor_int(p, end, &f[k]))) return false;
+
+        int index = f[0];
+        if (index < 0 || index >= entity_model_count()) continue;
+        entity_values_t v;
+        if (entity_model_get(index)->kind == ENTITY_COVER) {
+            if (f[4] < 0) continue;     // no position: nothing usable
+            v = (entity_values_t){ .brightness = -1, .position = f[4] };
+        } else {
+            v = (entity_values_t){
+                .on           = f[1] == 1,
+                .brightness   = f[2],
+                .color_temp_k = f[3] > 0 ? f[3] : 0,
+                .position     = -1,
+            };
+        }
+        entity_push(index, &v);
+    }
+    return true;
+}
+
+// ---- Connection ----
+
+static int connect_gateway(void)
+{
+    struct addrinfo hints = { .ai_family = AF_INET, .ai_socktype = SOCK_STREAM };
+    struct addrinfo *res = NULL;
+    char port[8];
+    snprintf(port, sizeof(port), "%d", CONFIG_HA_GATEWAY_PORT);
+    if (getaddrinfo(CONFIG_HA_GATEWAY_HOST, port, &hints, &res) != 0 || !res) {
+        ESP_LOGW(TAG, "Cannot resolve %s", CONFIG_HA_GATEWAY_HOST);
+        return -1;
+    }
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+    if (fd < 0) return -1;
+
+    struct timeval tv = { .tv_sec = SILENCE_MS / 1000 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+static void set_link(bool up)
+{
+    atomic_store(&s_connected, up);
+    metrics_gauge_set(&m_connected, up);
+    if (s_on_link) s_on_link(up);
+}
+
+static void gateway_task(void *arg)
+{
+    static uint8_t frame[FRAME_MAX];
+
+    while (1) {
+        if (!atomic_load(&s_enabled)) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        int fd = connect_gateway();
+        if (fd < 0 || !send_hello(fd)) {
+            if (fd >= 0) close(fd);
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RECONNECT_MS));
+            continue;
+        }
+        atomic_store(&s_fd, fd);
+        ESP_LOGI(TAG, "Connected to %s:%d", CONFIG_HA_GATEWAY_HOST, CONFIG_HA_GATEWAY_PORT);
+        set_link(true);
+
+        uint8_t len_be[2];
+        while (atomic_load(&s_enabled) && read_full(fd, len_be, 2)) {
+            int len = len_be[0] << 8 | len_be[1];
+            if (len > FRAME_MAX || !read_full(fd, frame, len)) break;
+            uint32_t t0 = esp_cpu_get_cycle_count();
+            if (!apply_frame(frame, frame + len)) {
+                ESP_LOGW(TAG, "Malformed frame (%d B)", len);
+                break;
+            }
+            if (len > 1) {      // not a heartbeat
+                metrics_histogram_observe(&m_bytes, len + 2);
+                metrics_histogram_observe(&m_cycles, esp_cpu_get_cycle_count() - t0);
+            }
+        }
+
+        atomic_store(&s_fd, -1);
+        close(fd);
+        ESP_LOGW(TAG, "Link down");
+        set_link(false);
+    }
+}
+
+bool ha_gateway_connected(void)
+{
+    return atomic_load(&s_connected);
+}
+
+esp_err_t ha_gateway_start(void)
+{
+    if (!s_task) return ESP_ERR_INVALID_STATE;
+    atomic_store(&s_enabled, true);
+    xTaskNotifyGive(s_task);
+    return ESP_OK;
+}
+
+void ha_gateway_stop(void)
+{
+    if (!s_task) return;
+    atomic_store(&s_enabled, false);
+    // Unblock recv(); the task closes the socket
+    int fd = atomic_load(&s_fd);
+    if (fd >= 0) shutdown(fd, SHUT_RDWR);
+}
+
+esp_err_t ha_gateway_init(void (*on_link)(bool up))
+{
+    if (strlen(CONFIG_HA_GATEWAY_HOST) == 0) return ESP_ERR_NOT_SUPPORTED;
+
+    s_on_link = on_link;
+    metrics_register_histogram(&m_bytes);
+    metrics_register_histogram(&m_cycles);
+    metrics_register_gauge(&m_connected);
+    if (xTaskCreate(gateway_task, "ha_gateway", 4096, NULL, 5, &s_task) != pdPASS) return ESP_ERR_NO_MEM;
+    return ESP_OK;
+}
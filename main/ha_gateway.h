@@ -0,0 +1,30 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdbool.h>
+
+/*
+ * State pushed by the panel gateway (tools/panel_gateway).
+ *
+ * The gateway runs next to HA, holds one HA WebSocket subscription and
+ * serves any number of panels over plain TCP. Every message is a 2-byte
+ * big-endian length followed by one CBOR item:
+ *
+ *   panel -> gateway  hello:  ["light.a", "cover.b", ...]   entity_model order
+ *   gateway -> panel  update: [[index, state, brightness, color_temp_k, position], ...]
+ *
+ * `state` is 0 off/closed/other, 1 on/open, 2 opening, 3 closing; the
+ * numbers use the entity_values_t conventions (-1 / 0 unknown). The first
+ * update holds every entity, later ones only those that changed. An empty
+ * update is a heartbeat.
+ */
+
+// Create the client task. ESP_ERR_NOT_SUPPORTED if no gateway is
+// configured. `on_link` runs on that task when the link goes up or down.
+esp_err_t ha_gateway_init(void (*on_link)(bool up));
+
+// Connect (and keep reconnecting) / disconnect
+esp_err_t ha_gateway_start(void);
+void      ha_gateway_stop(void);
+
+bool ha_gateway_connected(void);
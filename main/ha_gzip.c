@@ -0,0 +1,77 @@
+/*
+ * Streaming gunzip for HA responses
+ *
+ * zlib inflate with gzip framing (windowBits 16 + 15). HA bodies are
+ * decoded incrementally from the connection's receive buffer, so only the
+ * decoded body is ever held in full. Allocations go to PSRAM: per stream
+ * about 7 KB of inflate state, the 32 KB window the sender may reference,
+ * and the output buffer.
+ */
+
+#include "ha_gzip.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "ha_gzip";
+
+#define OUT_CAP CONFIG_HA_HTTP_GZIP_BODY_MAX
+
+static voidpf psram_alloc(voidpf opaque, uInt items, uInt size)
+{
+    return heap_caps_calloc(items, size, MALLOC_CAP_SPIRAM);
+}
+
+static void psram_free(voidpf opaque, voidpf ptr)
+{
+    heap_caps_free(ptr);
+}
+
+esp_err_t ha_gzip_begin(ha_gzip_t *g)
+{
+    if (!g->ready) {
+        g->out = heap_caps_malloc(OUT_CAP + 1, MALLOC_CAP_SPIRAM);
+        if (!g->out) return ESP_ERR_NO_MEM;
+        g->zs = (z_stream){ .zalloc = psram_alloc, .zfree = psram_free };
+        if (inflateInit2(&g->zs, 16 + MAX_WBITS) != Z_OK) {
+            heap_caps_free(g->out);
+            g->out = NULL;
+            return ESP_ERR_NO_MEM;
+        }
+        g->ready = true;
+    } else {
+        inflateReset(&g->zs);
+    }
+    g->failed  = false;
+    g->out_len = 0;
+    g->out[0]  = '\0';
+    return ESP_OK;
+}
+
+bool ha_gzip_feed(ha_gzip_t *g, const char *p, int n)
+{
+    if (g->failed) return false;
+
+    g->zs.next_in  = (Bytef *)p;
+    g->zs.avail_in = n;
+    while (g->zs.avail_in > 0) {
+        // Past the cap, inflate into a scratch area: the stream must still
+        // be followed to its end so its checksum and trailer are consumed
+        static char discard[512];
+        bool full = g->out_len >= OUT_CAP;
+        g->zs.next_out  = (Bytef *)(full ? discard : g->out + g->out_len);
+        g->zs.avail_out = full ? (uInt)sizeof(discard) : (uInt)(OUT_CAP - g->out_len);
+
+        int ret = inflate(&g->zs, Z_NO_FLUSH);
+        if (!full) g->out_len = OUT_CAP - g->zs.avail_out;
+        if (ret == Z_STREAM_END) break;
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            ESP_LOGW(TAG, "Corrupt gzip body: %s", g->zs.msg ? g->zs.msg : "?");
+            g->failed = true;
+            break;
+        }
+    }
+    g->out[g->out_len] = '\0';
+    return !g->failed;
+}
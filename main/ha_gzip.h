@@ -0,0 +1,31 @@
+#pragma once
+
+#include "esp_err.h"
+#include "zlib.h"
+#include <stdbool.h>
+
+/*
+ * Streaming gunzip of HA response bodies.
+ *
+ * Compressed bytes are fed as they arrive and inflated into a per-stream
+ * output buffer of CONFIG_HA_HTTP_GZIP_BODY_MAX bytes. Output past that is
+ * dropped like an oversized plain body, so the compressed input never has
+ * to be kept. zlib state and its 32 KB window live in PSRAM and are
+ * allocated on a stream's first gzip response, then reused.
+ *
+ * Engine task only.
+ */
+
+typedef struct {
+    z_stream zs;
+    bool     ready;         // inflateInit2() done
+    bool     failed;        // corrupt stream; output so far is kept
+    char    *out;           // NUL-terminated decoded body
+    int      out_len;
+} ha_gzip_t;
+
+// Start decoding a new body
+esp_err_t ha_gzip_begin(ha_gzip_t *g);
+
+// Inflate `n` compressed bytes. Returns false once the stream is corrupt.
+bool ha_gzip_feed(ha_gzip_t *g, const char *p, int n);
@@ -0,0 +1,381 @@
+/*
+ * Home Assistant over MQTT (mqtt_statestream)
+ *
+ * HA's mqtt_statestream integration publishes every state and attribute
+ * change as a retained message:
+ *
+ *   <statestream base>/light/kitchen/state              on
+ *   <statestream base>/light/kitchen/brightness         180
+ *   <statestream base>/cover/blinds/current_position    40
+ *
+ * On connect we subscribe to <base>/<domain>/<object>/+ for every entity in
+ * entity_model; the retained messages give the full state right away and
+ * later pushes arrive as HA changes it, with no polling. Each entity has a
+ * shadow of the attributes received so far, handed to entity_push() on
+ * every change (which also covers pushes that land while a command is
+ * settling).
+ *
+ * Commands are published with QoS 1 to <command topic>/<service> with the
+ * same JSON body the REST API takes. HA does not act on them by itself; the
+ * automation in the README forwards them to the service. The broker's
+ * PUBACK completes the command; the state change arrives as a push.
+ *
+ * Metrics: ha_mqtt_message_bytes is the wire size of each push (compare
+ * with ha_http_response_bytes of a REST poll); ha_mqtt_echo_ms is the time
+ * from publishing a command to the first push for that entity.
+ */
+
+#include "ha_mqtt.h"
+#include "entity_model.h"
+#include "entity_push.h"
+#include "metrics.h"
+#include "mqtt_client.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ha_mqtt";
+
+#define MAX_PENDING   16    // commands waiting for their PUBACK
+#define MAX_ORPHANS   4     // PUBACKs that beat their command into the table
+
+// ---- State ----
+
+typedef struct {
+    int         msg_id;         // 0 = free slot, -1 = reserved while publishing
+    const char *entity_id;
+    const char *service;
+    ha_done_fn  done;
+    void       *ctx;
+    uint32_t    tag;
+    int64_t     queued_us;
+} pending_t;
+
+// Attributes arrive one topic at a time and are merged here
+typedef struct {
+    entity_values_t vals;
+    bool            have_state;
+    int64_t         cmd_sent_us;    // last command publish, 0 once echoed
+} shadow_t;
+
+static esp_mqtt_client_handle_t s_client;
+static bool                     s_started;
+static void                   (*s_on_link)(bool up);
+static atomic_bool              s_connected;
+
+// Pending commands and shadows are touched by the MQTT task and the LVGL
+// task (commands)
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static pending_t    s_pending[MAX_PENDING];
+static int          s_orphans[MAX_ORPHANS];
+static shadow_t     s_shadow[ENTITY_MODEL_MAX];
+
+static const uint32_t s_bytes_bounds[] = { 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+static const uint32_t s_echo_bounds[]  = { 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+static metrics_histogram_t m_bytes    = METRICS_HISTOGRAM_INIT("ha_mqtt_message_bytes", "Wire size of a statestream message (bytes)", s_bytes_bounds);
+static metrics_histogram_t m_echo     = METRICS_HISTOGRAM_INIT("ha_mqtt_echo_ms", "Command publish to the first state push of its entity (ms)", s_echo_bounds);
+static metrics_gauge_t     m_connected = METRICS_GAUGE_INIT("ha_mqtt_connected", "1 while the MQTT broker connection is up");
+
+// ---- Commands ----
+
+static void finish(const pending_t *p, int status)
+{
+    ha_request_t req = {
+        .ep        = strncmp(p->service, "cover/", 6) == 0 ? HA_EP_COVER : HA_EP_LIGHT,
+        .prio      = HA_PRIO_INTERACTIVE,
+        .entity_id = p->entity_id,
+        .service   = p->service,
+        .done      = p->done,
+        .ctx       = p->ctx,
+        .tag       = p->tag,
+        .queued_us = p->queued_us,
+    };
+    p->done(&req, status, "", 0);
+}
+
+// PUBACK or give-up for `msg_id`, on the MQTT task
+static void complete_msg(int msg_id, int status)
+{
+    pending_t p = { 0 };
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_PENDING; i++) {
+        if (s_pending[i].msg_id > 0 && s_pending[i].msg_id == msg_id) {
+            p = s_pending[i];
+            s_pending[i].msg_id = 0;
+            break;
+        }
+    }
+    // The outbox may send and get the ack before ha_mqtt_command() has
+    // recorded the id; remember it for the publisher to pick up
+    if (!p.msg_id && status == 200) {
+        for (int i = 0; i < MAX_ORPHANS; i++) {
+            if (!s_orphans[i]) { s_orphans[i] = msg_id; break; }
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (p.msg_id) finish(&p, status);
+}
+
+// Reserved slots (-1) are skipped: their publisher is still between the
+// reservation and esp_mqtt_client_enqueue() and fills them in afterwards
+static void fail_all_pending(void)
+{
+    for (int i = 0; i < MAX_PENDING; i++) {
+        pending_t p = { 0 };
+        taskENTER_CRITICAL(&s_lock);
+        if (s_pending[i].msg_id > 0) {
+            p = s_pending[i];
+            s_pending[i].msg_id = 0;
+        }
+        if (i < MAX_ORPHANS) s_orphans[i] = 0;
+        taskEXIT_CRITICAL(&s_lock);
+        if (p.msg_id) finish(&p, HA_STATUS_TRANSPORT_ERROR);
+    }
+}
+
+esp_err_t ha_mqtt_command(const char *entity_id, const char *service, const char *body,
+                          ha_done_fn done, void *ctx, uint32_t tag)
+{
+    if (!s_client || !atomic_load(&s_connected)) return ESP_ERR_INVALID_STATE;
+
+    char topic[96];
+    snprintf(topic, sizeof(topic), "%s/%s", CONFIG_HA_MQTT_COMMAND_TOPIC, service);
+
+    pending_t p = {
+        .entity_id = entity_id,
+        .service   = service,
+        .done      = done,
+        .ctx       = ctx,
+        .tag       = tag,
+        .queued_us = esp_timer_get_time(),
+    };
+
+    // Reserve a slot first so a full table fails before anything is sent
+    int slot = -1;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_PENDING; i++) {
+        if (!s_pending[i].msg_id) { slot = i; s_pending[i] = (pending_t){ .msg_id = -1 }; break; }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    if (slot < 0) return ESP_ERR_NO_MEM;
+
+    // Non-blocking: the outbox is sent from the MQTT task
+    int msg_id = esp_mqtt_client_enqueue(s_client, topic, body, 0, 1, 0, true);
+    if (msg_id <= 0) {
+        taskENTER_CRITICAL(&s_lock);
+        s_pending[slot].msg_id = 0;
+        taskEXIT_CRITICAL(&s_lock);
+        return ESP_FAIL;
+    }
+    p.msg_id = msg_id;
+
+    bool acked = false;
+    int idx = entity_model_index(entity_model_find(entity_id));
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_ORPHANS; i++) {
+        if (s_orphans[i] == msg_id) { s_orphans[i] = 0; acked = true; break; }
+    }
+    s_pending[slot] = acked ? (pending_t){ 0 } : p;
+    if (idx >= 0) s_shadow[idx].cmd_sent_us = p.queued_us;
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (acked) finish(&p, 200);
+    ESP_LOGD(TAG, "%s -> %s published (msg %d)", entity_id, service, msg_id);
+    return ESP_OK;
+}
+
+// ---- State pushes ----
+
+static int parse_value(const char *data, int len)
+{
+    if (len == 0 || (len == 4 && memcmp(data, "null", 4) == 0)) return -1;
+    char num[12];
+    if (len >= (int)sizeof(num)) return -1;
+    memcpy(num, data, len);
+    num[len] = '\0';
+    return atoi(num);
+}
+
+// `topic` is <base>/<domain>/<object>/<attribute>, not NUL-terminated
+static void on_data(const char *topic, int topic_len, const char *data, int data_len)
+{
+    static const char base[] = CONFIG_HA_MQTT_STATESTREAM_BASE "/";
+    int base_len = sizeof(base) - 1;
+    if (topic_len <= base_len || memcmp(topic, base, base_len) != 0) return;
+
+    // "<domain>/<object>" and the attribute, split at the last '/'
+    const char *rest = topic + base_len;
+    int rest_len = topic_len - base_len;
+    int id_len = rest_len;
+    while (id_len > 0 && rest[id_len - 1] != '/') id_len--;
+    if (--id_len <= 0) return;
+    const char *attr = rest + id_len + 1;
+    int attr_len = rest_len - id_len - 1;
+
+    char entity_id[64];
+    if (id_len >= (int)sizeof(entity_id)) return;
+    memcpy(entity_id, rest, id_len);
+    entity_id[id_len] = '\0';
+    char *slash = strchr(entity_id, '/');
+    if (!slash) return;
+    *slash = '.';
+
+    int idx = entity_model_index(entity_model_find(entity_id));
+    if (idx < 0) return;
+
+    // statestream quotes string values as JSON; accept both forms
+    if (data_len >= 2 && data[0] == '"' && data[data_len - 1] == '"') {
+        data++;
+        data_len -= 2;
+    }
+
+    int64_t now = esp_timer_get_time();
+    int64_t echo_us = 0;
+    bool relevant = true;
+    taskENTER_CRITICAL(&s_lock);
+    shadow_t *s = &s_shadow[idx];
+    if (attr_len == 5 && memcmp(attr, "state", 5) == 0) {
+        s->vals.on = data_len == 2 && memcmp(data, "on", 2) == 0;
+        s->have_state = true;
+    } else if (attr_len == 10 && memcmp(attr, "brightness", 10) == 0) {
+        s->vals.brightness = parse_value(data, data_len);
+    } else if (attr_len == 17 && memcmp(attr, "color_temp_kelvin", 17) == 0) {
+        int k = parse_value(data, data_len);
+        s->vals.color_temp_k = k > 0 ? k : 0;
+    } else if (attr_len == 16 && memcmp(attr, "current_position", 16) == 0) {
+        s->vals.position = parse_value(data, data_len);
+    } else {
+        relevant = false;
+    }
+    entity_values_t vals = s->vals;
+    // Covers have no usable state without a position; lights need "state"
+    bool complete = entity_model_get(idx)->kind == ENTITY_COVER ? vals.position >= 0 : s->have_state;
+    if (relevant) {
+        if (s->cmd_sent_us) {
+            echo_us = now - s->cmd_sent_us;
+            s->cmd_sent_us = 0;
+        }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    metrics_histogram_observe(&m_bytes, (uint32_t)(topic_len + data_len + 4));
+    if (!relevant) return;
+    if (echo_us) metrics_histogram_observe(&m_echo, (uint32_t)(echo_us / 1000));
+    if (complete) entity_push(idx, &vals);
+}
+
+// ---- Connection ----
+
+static void subscribe_all(void)
+{
+    for (int i = 0; i < entity_model_count(); i++) {
+        const char *id = entity_model_get(i)->entity_id;
+        const char *dot = strchr(id, '.');
+        if (!dot) continue;
+        char topic[128];
+        snprintf(topic, sizeof(topic), "%s/%.*s/%s/+",
+                 CONFIG_HA_MQTT_STATESTREAM_BASE, (int)(dot - id), id, dot + 1);
+        esp_mqtt_client_subscribe(s_client, topic, 0);
+    }
+}
+
+static void set_link(bool up)
+{
+    atomic_store(&s_connected, up);
+    metrics_gauge_set(&m_connected, up);
+    if (s_on_link) s_on_link(up);
+}
+
+static void mqtt_event_handler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    esp_mqtt_event_handle_t ev = event_data;
+
+    switch ((esp_mqtt_event_id_t)event_id) {
+    case MQTT_EVENT_CONNECTED:
+        ESP_LOGI(TAG, "Connected, subscribing to %d entities", entity_model_count());
+        subscribe_all();
+        set_link(true);
+        break;
+    case MQTT_EVENT_DISCONNECTED:
+        ESP_LOGW(TAG, "Disconnected");
+        set_link(false);
+        fail_all_pending();
+        break;
+    case MQTT_EVENT_PUBLISHED:
+        complete_msg(ev->msg_id, 200);
+        break;
+    case MQTT_EVENT_DELETED:
+        // Expired from the outbox without an ack
+        complete_msg(ev->msg_id, HA_STATUS_TRANSPORT_ERROR);
+        break;
+    case MQTT_EVENT_DATA:
+        // Statestream values are short; a fragmented message is not ours
+        if (ev->current_data_offset == 0 && ev->data_len == ev->total_data_len)
+            on_data(ev->topic, ev->topic_len, ev->data, ev->data_len);
+        break;
+    case MQTT_EVENT_ERROR:
+        ESP_LOGW(TAG, "Error, type %d", ev->error_handle ? (int)ev->error_handle->error_type : -1);
+        break;
+    default:
+        break;
+    }
+}
+
+bool ha_mqtt_connected(void)
+{
+    return atomic_load(&s_connected);
+}
+
+esp_err_t ha_mqtt_init(void (*on_link)(bool up))
+{
+    if (strlen(CONFIG_HA_MQTT_BROKER_URL) == 0) return ESP_ERR_NOT_SUPPORTED;
+
+    for (int i = 0; i < ENTITY_MODEL_MAX; i++)
+        s_shadow[i].vals = (entity_values_t){ .brightness = -1, .position = -1 };
+
+    const esp_mqtt_client_config_t cfg = {
+        .broker.address.uri = CONFIG_HA_MQTT_BROKER_URL,
+        .credentials = {
+            .username = strlen(CONFIG_HA_MQTT_USERNAME) ? CONFIG_HA_MQTT_USERNAME : NULL,
+            .authentication.password = strlen(CONFIG_HA_MQTT_PASSWORD) ? CONFIG_HA_MQTT_PASSWORD : NULL,
+        },
+        .session.keepalive = 30,
+    };
+    s_client = esp_mqtt_client_init(&cfg);
+    if (!s_client) return ESP_ERR_NO_MEM;
+    esp_mqtt_client_register_event(s_client, ESP_EVENT_ANY_ID, mqtt_event_handler, NULL);
+
+    s_on_link = on_link;
+    metrics_register_histogram(&m_bytes);
+    metrics_register_histogram(&m_echo);
+    metrics_register_gauge(&m_connected);
+    return ESP_OK;
+}
+
+esp_err_t ha_mqtt_start(void)
+{
+    if (!s_client) return ESP_ERR_INVALID_STATE;
+    if (s_started) return ESP_OK;
+    esp_err_t err = esp_mqtt_client_start(s_client);
+    if (err != ESP_OK) return err;
+    s_started = true;
+    ESP_LOGI(TAG, "Broker %s, statestream %s", CONFIG_HA_MQTT_BROKER_URL, CONFIG_HA_MQTT_STATESTREAM_BASE);
+    return ESP_OK;
+}
+
+void ha_mqtt_stop(void)
+{
+    if (!s_started) return;
+    esp_mqtt_client_stop(s_client);
+    s_started = false;
+    // stop() tears the connection down without a DISCONNECTED event
+    if (atomic_load(&s_connected)) set_link(false);
+    fail_all_pending();
+}
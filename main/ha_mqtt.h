@@ -0,0 +1,33 @@
+#pragma once
+
+#include "ha_engine.h"
+#include "esp_err.h"
+#include <stdbool.h>
+
+/*
+ * HA state over MQTT.
+ *
+ * Subscribes to the mqtt_statestream topics of every entity in
+ * entity_model and applies each push like a poll result. Service calls
+ * are published to CONFIG_HA_MQTT_COMMAND_TOPIC/<service>, where an HA
+ * automation turns them into service calls (see README).
+ */
+
+// Create the client. Returns ESP_ERR_NOT_SUPPORTED if no broker is
+// configured. `on_link` runs on the MQTT task whenever the broker
+// connection comes up or goes down.
+esp_err_t ha_mqtt_init(void (*on_link)(bool up));
+
+// Connect (and keep reconnecting) / disconnect. Pending commands fail
+// with HA_STATUS_TRANSPORT_ERROR on stop. Not from the MQTT task.
+esp_err_t ha_mqtt_start(void);
+void      ha_mqtt_stop(void);
+
+bool ha_mqtt_connected(void);
+
+// Publish `body` for `service` (e.g. "light/turn_on") with QoS 1 without
+// blocking. `done` runs with status 200 once the broker acknowledged it,
+// or HA_STATUS_TRANSPORT_ERROR if the connection dropped first. An error
+// return means nothing was queued and `done` will not be called.
+esp_err_t ha_mqtt_command(const char *entity_id, const char *service, const char *body,
+                          ha_done_fn done, void *ctx, uint32_t tag);
@@ -0,0 +1,260 @@
+/*
+ * TLS client for the HA engine
+ *
+ * Server verification uses either the ESP-IDF certificate bundle (public
+ * CAs, e.g. Let's Encrypt or Nabu Casa) or a single pinned CA embedded
+ * from main/ha_ca.pem (a self-signed HA certificate). TLS 1.2 only: its
+ * session tickets and session ids are what mbedTLS resumes reliably, and
+ * an echoed session id is how a resumed handshake is told apart:
+ *
+ *   new connection -> offer s_session (ticket / id of the last handshake)
+ *     ServerHello echoes the ClientHello's id -> resumed: no certificate,
+ *                                                one round trip less
+ *     ServerHello carries another id          -> full handshake
+ *   either way s_session becomes the session just negotiated
+ *
+ * With a ticket, mbedTLS sends a fresh random id rather than the stored
+ * one, so the offered id is read from the ClientHello as it goes out.
+ *
+ * Socket I/O goes through counting BIO callbacks, so handshake bytes on
+ * the wire are measured exactly. Handshake time, bytes and the heap taken
+ * by a connection are exported per handshake kind.
+ */
+
+#include "ha_tls.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/x509_crt.h"
+#include "lwip/sockets.h"
+#include "sdkconfig.h"
+#include <errno.h>
+#include <string.h>
+
+#ifdef CONFIG_HA_TLS_CA_BUNDLE
+#include "esp_crt_bundle.h"
+#endif
+
+static const char *TAG = "ha_tls";
+
+static mbedtls_ssl_config       s_conf;
+static mbedtls_entropy_context  s_entropy;
+static mbedtls_ctr_drbg_context s_drbg;
+static mbedtls_ssl_session      s_session;
+static bool                     s_session_ok;
+static const char              *s_hostname;
+#ifdef CONFIG_HA_TLS_CA_PINNED
+static mbedtls_x509_crt         s_ca;
+extern const char ha_ca_pem_start[] asm("_binary_ha_ca_pem_start");
+extern const char ha_ca_pem_end[]   asm("_binary_ha_ca_pem_end");
+#endif
+
+enum { HS_FULL, HS_RESUMED, HS_KINDS };
+
+static const uint32_t s_hs_ms_bounds[]    = { 25, 50, 100, 200, 400, 800, 1600, 3200 };
+static const uint32_t s_hs_bytes_bounds[] = { 500, 1000, 2000, 4000, 8000, 16000 };
+
+#define HS_MS_HELP    "TLS handshake duration (ms)"
+#define HS_BYTES_HELP "Bytes sent and received during a TLS handshake"
+#define HEAP_HELP     "Heap taken by the last TLS connection after its handshake (bytes)"
+
+static metrics_histogram_t m_hs_ms[HS_KINDS] = {
+    [HS_FULL]    = METRICS_HISTOGRAM_INIT_L("ha_tls_handshake_ms", HS_MS_HELP, "kind=\"full\"",    s_hs_ms_bounds),
+    [HS_RESUMED] = METRICS_HISTOGRAM_INIT_L("ha_tls_handshake_ms", HS_MS_HELP, "kind=\"resumed\"", s_hs_ms_bounds),
+};
+static metrics_histogram_t m_hs_bytes[HS_KINDS] = {
+    [HS_FULL]    = METRICS_HISTOGRAM_INIT_L("ha_tls_handshake_bytes", HS_BYTES_HELP, "kind=\"full\"",    s_hs_bytes_bounds),
+    [HS_RESUMED] = METRICS_HISTOGRAM_INIT_L("ha_tls_handshake_bytes", HS_BYTES_HELP, "kind=\"resumed\"", s_hs_bytes_bounds),
+};
+static metrics_gauge_t   m_heap_int  = METRICS_GAUGE_INIT_L("ha_tls_conn_heap_bytes", HEAP_HELP, "mem=\"internal\"");
+static metrics_gauge_t   m_heap_ext  = METRICS_GAUGE_INIT_L("ha_tls_conn_heap_bytes", HEAP_HELP, "mem=\"psram\"");
+static metrics_counter_t m_hs_failed = METRICS_COUNTER_INIT("ha_tls_handshake_failures_total", "TLS handshakes that failed");
+
+// ---- Socket BIO ----
+
+static int bio_send(void *ctx, const unsigned char *buf, size_t len)
+{
+    ha_tls_conn_t *t = ctx;
+    int n = send(t->fd, buf, len, 0);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return MBEDTLS_ERR_SSL_WANT_WRITE;
+        return MBEDTLS_ERR_NET_SEND_FAILED;
+    }
+    // First record out is the ClientHello: 5 bytes record header, 4 bytes
+    // handshake header, version, 32 bytes random, then the session id
+    if (t->wire_bytes == 0 && n >= 44 && buf[0] == 0x16 && buf[5] == 0x01 &&
+        buf[43] <= sizeof(t->offered_id) && n >= 44 + buf[43]) {
+        t->offered_id_len = buf[43];
+        memcpy(t->offered_id, buf + 44, t->offered_id_len);
+    }
+    t->wire_bytes += n;
+    return n;
+}
+
+static int bio_recv(void *ctx, unsigned char *buf, size_t len)
+{
+    ha_tls_conn_t *t = ctx;
+    int n = recv(t->fd, buf, len, 0);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return MBEDTLS_ERR_SSL_WANT_READ;
+        return MBEDTLS_ERR_NET_RECV_FAILED;
+    }
+    t->wire_bytes += n;
+    return n;
+}
+
+// Map an mbedTLS result to the ha_tls.h convention
+static int io_result(ha_tls_conn_t *t, int ret)
+{
+    t->want_write = ret == MBEDTLS_ERR_SSL_WANT_WRITE;
+    if (ret >= 0) return ret;
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ)  return HA_TLS_WANT_READ;
+    if (ret == MBEDTLS_ERR_SSL_WANT_WRITE) return HA_TLS_WANT_WRITE;
+    return -1;
+}
+
+// ---- Public API ----
+
+esp_err_t ha_tls_init(const char *hostname)
+{
+    s_hostname = hostname;
+    mbedtls_ssl_config_init(&s_conf);
+    mbedtls_entropy_init(&s_entropy);
+    mbedtls_ctr_drbg_init(&s_drbg);
+    mbedtls_ssl_session_init(&s_session);
+
+    int ret = mbedtls_ctr_drbg_seed(&s_drbg, mbedtls_entropy_func, &s_entropy, NULL, 0);
+    if (ret == 0)
+        ret = mbedtls_ssl_config_defaults(&s_conf, MBEDTLS_SSL_IS_CLIENT,
+                                          MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "mbedTLS setup failed: -0x%04x", -ret);
+        return ESP_FAIL;
+    }
+    mbedtls_ssl_conf_rng(&s_conf, mbedtls_ctr_drbg_random, &s_drbg);
+    mbedtls_ssl_conf_authmode(&s_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    mbedtls_ssl_conf_max_tls_version(&s_conf, MBEDTLS_SSL_VERSION_TLS1_2);
+#ifdef MBEDTLS_SSL_SESSION_TICKETS
+    mbedtls_ssl_conf_session_tickets(&s_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+#ifdef CONFIG_HA_TLS_CA_BUNDLE
+    esp_err_t err = esp_crt_bundle_attach(&s_conf);
+    if (err != ESP_OK) return err;
+#else
+    mbedtls_x509_crt_init(&s_ca);
+    ret = mbedtls_x509_crt_parse(&s_ca, (const unsigned char *)ha_ca_pem_start,
+                                 ha_ca_pem_end - ha_ca_pem_start);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Cannot parse main/ha_ca.pem: -0x%04x", -ret);
+        return ESP_ERR_INVALID_ARG;
+    }
+    mbedtls_ssl_conf_ca_chain(&s_conf, &s_ca, NULL);
+#endif
+
+    for (int i = 0; i < HS_KINDS; i++)
+        metrics_register_histogram(&m_hs_ms[i]);
+    for (int i = 0; i < HS_KINDS; i++)
+        metrics_register_histogram(&m_hs_bytes[i]);
+    metrics_register_gauge(&m_heap_int);
+    metrics_register_gauge(&m_heap_ext);
+    metrics_register_counter(&m_hs_failed);
+    return ESP_OK;
+}
+
+esp_err_t ha_tls_open(ha_tls_conn_t *t, int fd)
+{
+    *t = (ha_tls_conn_t){
+        .fd          = fd,
+        .hs_start_us = esp_timer_get_time(),
+        .heap_int    = heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+        .heap_ext    = heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+    };
+    mbedtls_ssl_init(&t->ssl);
+    t->active = true;
+
+    int ret = mbedtls_ssl_setup(&t->ssl, &s_conf);
+    if (ret == 0) ret = mbedtls_ssl_set_hostname(&t->ssl, s_hostname);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "Session setup failed: -0x%04x", -ret);
+        ha_tls_close(t);
+        return ESP_ERR_NO_MEM;
+    }
+    mbedtls_ssl_set_bio(&t->ssl, t, bio_send, bio_recv, NULL);
+
+    t->resuming = s_session_ok && mbedtls_ssl_set_session(&t->ssl, &s_session) == 0;
+    return ESP_OK;
+}
+
+int ha_tls_handshake(ha_tls_conn_t *t)
+{
+    int ret = mbedtls_ssl_handshake(&t->ssl);
+    if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+        return io_result(t, ret);
+
+    if (ret != 0) {
+        uint32_t flags = mbedtls_ssl_get_verify_result(&t->ssl);
+        if (flags != 0 && flags != (uint32_t)-1) {
+            char why[128];
+            mbedtls_x509_crt_verify_info(why, sizeof(why), "", flags);
+            ESP_LOGE(TAG, "Certificate of %s rejected: %s", s_hostname, why);
+        } else {
+            ESP_LOGW(TAG, "Handshake failed: -0x%04x", -ret);
+        }
+        metrics_counter_inc(&m_hs_failed);
+        // Do not keep offering a session the server chokes on
+        if (t->resuming) {
+            mbedtls_ssl_session_free(&s_session);
+            mbedtls_ssl_session_init(&s_session);
+            s_session_ok = false;
+        }
+        return -1;
+    }
+
+    t->handshake_done = true;
+    t->hs_ms = (uint32_t)((esp_timer_get_time() - t->hs_start_us) / 1000);
+
+    // Keep the newest session; the id echo tells which kind this was
+    mbedtls_ssl_session_free(&s_session);
+    mbedtls_ssl_session_init(&s_session);
+    s_session_ok = mbedtls_ssl_get_session(&t->ssl, &s_session) == 0;
+    bool resumed = s_session_ok && t->resuming && t->offered_id_len > 0 &&
+                   mbedtls_ssl_session_get_id_len(&s_session) == t->offered_id_len &&
+                   memcmp(*mbedtls_ssl_session_get_id(&s_session), t->offered_id, t->offered_id_len) == 0;
+
+    int kind = resumed ? HS_RESUMED : HS_FULL;
+    metrics_histogram_observe(&m_hs_ms[kind], t->hs_ms);
+    metrics_histogram_observe(&m_hs_bytes[kind], t->wire_bytes);
+    // Approximate: other tasks allocate concurrently
+    size_t now_int = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    size_t now_ext = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    metrics_gauge_set(&m_heap_int, t->heap_int > now_int ? (int32_t)(t->heap_int - now_int) : 0);
+    metrics_gauge_set(&m_heap_ext, t->heap_ext > now_ext ? (int32_t)(t->heap_ext - now_ext) : 0);
+
+    ESP_LOGD(TAG, "%s handshake with %s: %lu ms, %lu bytes, %s",
+             resumed ? "Resumed" : "Full", s_hostname, (unsigned long)t->hs_ms,
+             (unsigned long)t->wire_bytes, mbedtls_ssl_get_ciphersuite(&t->ssl));
+    return 0;
+}
+
+int ha_tls_send(ha_tls_conn_t *t, const void *buf, size_t len)
+{
+    return io_result(t, mbedtls_ssl_write(&t->ssl, buf, len));
+}
+
+int ha_tls_recv(ha_tls_conn_t *t, void *buf, size_t len)
+{
+    int ret = mbedtls_ssl_read(&t->ssl, buf, len);
+    if (ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) return 0;
+    return io_result(t, ret);
+}
+
+void ha_tls_close(ha_tls_conn_t *t)
+{
+    if (t->active) mbedtls_ssl_free(&t->ssl);
+    t->active = false;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "esp_err.h"
+#include "mbedtls/ssl.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * TLS on the HA engine's own non-blocking sockets.
+ *
+ * mbedTLS is driven directly rather than through esp_tls so handshakes and
+ * records advance from the engine's select() loop. All connections share
+ * one config and one cached session: a new connection offers the session
+ * of the last completed handshake (ticket or session id) and gets an
+ * abbreviated handshake when HA accepts it.
+ *
+ * Engine task only.
+ */
+
+// Return values of the I/O calls besides byte counts
+#define HA_TLS_WANT_READ   -2
+#define HA_TLS_WANT_WRITE  -3
+
+typedef struct {
+    mbedtls_ssl_context ssl;
+    int      fd;
+    bool     active;        // ssl is set up and must be freed
+    bool     handshake_done;
+    bool     want_write;    // last call returned HA_TLS_WANT_WRITE
+    bool     resuming;      // a cached session was offered
+    int64_t  hs_start_us;
+    uint32_t hs_ms;         // handshake duration, once done
+    uint32_t wire_bytes;    // bytes sent + received on the socket
+    size_t   heap_int;      // free heap when the handshake started
+    size_t   heap_ext;
+    uint8_t  offered_id[32];    // session id in our ClientHello
+    uint8_t  offered_id_len;
+} ha_tls_conn_t;
+
+// Build the shared client config for `hostname` (SNI and certificate
+// check) with the CA source chosen in menuconfig
+esp_err_t ha_tls_init(const char *hostname);
+
+// Start a client session on connected socket `fd`
+esp_err_t ha_tls_open(ha_tls_conn_t *t, int fd);
+
+// Advance the handshake: 0 when done, HA_TLS_WANT_* or -1 on failure
+int ha_tls_handshake(ha_tls_conn_t *t);
+
+// send()/recv() on the session: a byte count, HA_TLS_WANT_* or -1.
+// ha_tls_recv() returns 0 when HA closed the session. After
+// HA_TLS_WANT_WRITE, ha_tls_send() must be repeated with the same data.
+int ha_tls_send(ha_tls_conn_t *t, const void *buf, size_t len);
+int ha_tls_recv(ha_tls_conn_t *t, void *buf, size_t len);
+
+// Free the session state; the socket is left to the caller
+void ha_tls_close(ha_tls_conn_t *t);
@@ -0,0 +1,226 @@
+/*
+ * HTTP/1.1 wire format for HA requests
+ *
+ * Request templates, built once:
+ *
+ *   GET  /api/states/ <entity_id> <get_tail>
+ *   POST /api/services/ <service> <post_mid> <length> \r\n\r\n <body>
+ *   POST /api/template <post_mid> <length> \r\n\r\n <payload>
+ *
+ * get_tail/post_mid hold the protocol version, Host, Authorization and (for
+ * POST) Content-Type headers. A request is sent as an iovec list over these
+ * pieces, so the ~250 bytes of constant header text are never copied.
+ *
+ * Responses: the head is parsed where it was received (status, the three
+ * headers that matter for framing, Content-Encoding). Chunked bodies are decoded in place by
+ * moving payload bytes down over the chunk framing; Content-Length bodies
+ * are not moved at all.
+ */
+
+#include "ha_wire.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "ha_wire";
+
+static const char s_get_head[]  = "GET /api/states/";
+static const char s_post_head[] = "POST /api/services/";
+static const char s_tmpl_head[] = "POST /api/template";
+static const char s_crlf2[]     = "\r\n\r\n";
+
+#ifdef CONFIG_HA_HTTP_GZIP
+#define ACCEPT_ENCODING "Accept-Encoding: gzip\r\n"
+#else
+#define ACCEPT_ENCODING ""
+#endif
+
+static char *s_get_tail;
+static int   s_get_tail_len;
+static char *s_post_mid;
+static int   s_post_mid_len;
+
+enum {
+    CHUNK_SIZE,
+    CHUNK_DATA,
+    CHUNK_DATA_END,     // CRLF after the chunk data
+    CHUNK_TRAILER,
+};
+
+#define IOV(p, n) ((struct iovec){ .iov_base = (void *)(p), .iov_len = (n) })
+
+// ---- Requests ----
+
+esp_err_t ha_wire_init(const char *host, const char *token)
+{
+    static const char get_fmt[]  = " HTTP/1.1\r\nHost: %s\r\nAuthorization: Bearer %s\r\n" ACCEPT_ENCODING "\r\n";
+    static const char post_fmt[] = " HTTP/1.1\r\nHost: %s\r\nAuthorization: Bearer %s\r\n" ACCEPT_ENCODING
+                                   "Content-Type: application/json\r\nContent-Length: ";
+
+    s_get_tail_len = snprintf(NULL, 0, get_fmt, host, token);
+    s_post_mid_len = snprintf(NULL, 0, post_fmt, host, token);
+    s_get_tail = malloc(s_get_tail_len + 1);
+    s_post_mid = malloc(s_post_mid_len + 1);
+    if (!s_get_tail || !s_post_mid) return ESP_ERR_NO_MEM;
+    snprintf(s_get_tail, s_get_tail_len + 1, get_fmt, host, token);
+    snprintf(s_post_mid, s_post_mid_len + 1, post_fmt, host, token);
+
+    ESP_LOGD(TAG, "Templates: GET tail %d B, POST headers %d B", s_get_tail_len, s_post_mid_len);
+    return ESP_OK;
+}
+
+int ha_wire_request(const ha_request_t *req, struct iovec iov[HA_WIRE_MAX_IOV], char clen[12])
+{
+    if (!req->service && req->ep != HA_EP_TEMPLATE) {
+        iov[0] = IOV(s_get_head, sizeof(s_get_head) - 1);
+        iov[1] = IOV(req->entity_id, strlen(req->entity_id));
+        iov[2] = IOV(s_get_tail, s_get_tail_len);
+        return 3;
+    }
+
+    if (req->ep == HA_EP_TEMPLATE) {
+        int clen_len = snprintf(clen, 12, "%d", req->payload_len);
+        iov[0] = IOV(s_tmpl_head, sizeof(s_tmpl_head) - 1);
+        iov[1] = IOV(s_post_mid, s_post_mid_len);
+        iov[2] = IOV(clen, clen_len);
+        iov[3] = IOV(s_crlf2, sizeof(s_crlf2) - 1);
+        iov[4] = IOV(req->payload, req->payload_len);
+        return 5;
+    }
+
+    int body_len = strlen(req->body);
+    int clen_len = snprintf(clen, 12, "%d", body_len);
+    iov[0] = IOV(s_post_head, sizeof(s_post_head) - 1);
+    iov[1] = IOV(req->service, strlen(req->service));
+    iov[2] = IOV(s_post_mid, s_post_mid_len);
+    iov[3] = IOV(clen, clen_len);
+    iov[4] = IOV(s_crlf2, sizeof(s_crlf2) - 1);
+    iov[5] = IOV(req->body, body_len);
+    return 6;
+}
+
+// ---- Response head ----
+
+static const char *header_value(const char *line, const char *name)
+{
+    size_t len = strlen(name);
+    if (strncasecmp(line, name, len) != 0 || line[len] != ':') return NULL;
+    line += len + 1;
+    while (*line == ' ' || *line == '\t') line++;
+    return line;
+}
+
+int ha_wire_parse_head(ha_wire_resp_t *r, char *buf, int len, int prev, int buf_size)
+{
+    char *end = strstr(buf + (prev > 3 ? prev - 3 : 0), "\r\n\r\n");
+    if (!end) return len >= buf_size - 1 ? -1 : 0;
+    if (strncmp(buf, "HTTP/1.", 7) != 0) return -1;
+
+    int head_len = end - buf + 4;
+    end[2] = '\0';  // keep the last header's CRLF for the line walk
+
+    r->status     = atoi(buf + 9);
+    r->keep_alive = buf[7] == '1';
+    r->gzip       = false;
+    r->body_mode  = HA_WIRE_BODY_UNTIL_CLOSE;
+    r->remaining  = 0;
+    r->chunk      = CHUNK_SIZE;
+    r->line_len   = 0;
+
+    int content_length = -1;
+    for (char *line = strstr(buf, "\r\n"); line && line[2] != '\0'; line = strstr(line, "\r\n")) {
+        line += 2;
+        const char *v;
+        if ((v = header_value(line, "Content-Length")))
+            content_length = atoi(v);
+        else if ((v = header_value(line, "Transfer-Encoding")) && strncasecmp(v, "chunked", 7) == 0)
+            r->body_mode = HA_WIRE_BODY_CHUNKED;
+        else if ((v = header_value(line, "Connection")) && strncasecmp(v, "close", 5) == 0)
+            r->keep_alive = false;
+        else if ((v = header_value(line, "Content-Encoding")) && strncasecmp(v, "gzip", 4) == 0)
+            r->gzip = true;
+    }
+
+    if (r->status == 204 || r->status == 304) content_length = 0;
+    if (r->body_mode != HA_WIRE_BODY_CHUNKED && content_length >= 0) {
+        r->body_mode = HA_WIRE_BODY_LENGTH;
+        r->remaining = content_length;
+    }
+    if (r->body_mode == HA_WIRE_BODY_UNTIL_CLOSE) r->keep_alive = false;
+
+    r->body     = buf + head_len;
+    r->body_len = 0;
+    r->body_cap = buf_size - 1 - head_len;     // room for a terminating NUL
+    return head_len;
+}
+
+// ---- Response body ----
+
+static void store(ha_wire_resp_t *r, const char *p, int n)
+{
+    int room = r->body_cap - r->body_len;
+    if (n > room) n = room;     // truncated; the rest is consumed and dropped
+    char *dst = r->body + r->body_len;
+    if (dst != p) memmove(dst, p, n);
+    r->body_len += n;
+}
+
+bool ha_wire_feed_body(ha_wire_resp_t *r, const char *p, int n)
+{
+    if (r->body_mode == HA_WIRE_BODY_UNTIL_CLOSE) {
+        store(r, p, n);
+        return false;
+    }
+    if (r->body_mode == HA_WIRE_BODY_LENGTH) {
+        int take = n < r->remaining ? n : r->remaining;
+        store(r, p, take);
+        r->remaining -= take;
+        return r->remaining == 0;
+    }
+
+    while (n > 0) {
+        if (r->chunk == CHUNK_DATA) {
+            int take = n < r->remaining ? n : r->remaining;
+            store(r, p, take);
+            p += take;
+            n -= take;
+            r->remaining -= take;
+            if (r->remaining == 0) r->chunk = CHUNK_DATA_END;
+            continue;
+        }
+
+        // Line-oriented states: chunk size, CRLF after data, trailer
+        char ch = *p++;
+        n--;
+        if (ch != '\n') {
+            if (r->line_len < sizeof(r->line) - 1) r->line[r->line_len++] = ch;
+            continue;
+        }
+        r->line[r->line_len] = '\0';
+        int line_len = r->line_len;
+        r->line_len = 0;
+
+        switch (r->chunk) {
+        case CHUNK_DATA_END:
+            r->chunk = CHUNK_SIZE;
+            break;
+        case CHUNK_TRAILER:
+            if (line_len <= 1) return true;     // empty line ends the message
+            break;
+        default: {
+            long size = strtol(r->line, NULL, 16);
+            if (size > 0) {
+                r->remaining = size;
+                r->chunk = CHUNK_DATA;
+            } else {
+                r->chunk = CHUNK_TRAILER;
+            }
+            break;
+        }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ha_engine.h"
+#include "lwip/sockets.h"
+#include <stdbool.h>
+
+/*
+ * HTTP/1.1 wire format for the fixed HA request shapes.
+ *
+ * Requests are gathered from pre-serialized templates plus the few bytes
+ * that vary (entity id, service, body), so nothing is formatted or copied
+ * per request. Responses are parsed in the connection's receive buffer:
+ * the head in place, the body decoded in place right behind it.
+ */
+
+#define HA_WIRE_MAX_IOV 6
+
+// Build the templates once from the Host header value and API token
+esp_err_t ha_wire_init(const char *host, const char *token);
+
+// Describe `req` as an iovec list. `clen` receives the Content-Length
+// digits and must outlive the send. Returns the number of entries.
+int ha_wire_request(const ha_request_t *req, struct iovec iov[HA_WIRE_MAX_IOV], char clen[12]);
+
+typedef enum {
+    HA_WIRE_BODY_LENGTH,
+    HA_WIRE_BODY_CHUNKED,
+    HA_WIRE_BODY_UNTIL_CLOSE,
+} ha_wire_body_mode_t;
+
+typedef struct {
+    int                 status;
+    bool                keep_alive;
+    bool                gzip;           // Content-Encoding: gzip
+    ha_wire_body_mode_t body_mode;
+    int                 remaining;      // LENGTH: body bytes left, CHUNKED: chunk bytes left
+    uint8_t             chunk;          // chunked decoder state
+    uint8_t             line_len;       // chunk size/trailer line length so far
+    char                line[14];
+    char               *body;           // decoded body, inside the receive buffer
+    int                 body_len;
+    int                 body_cap;
+} ha_wire_resp_t;
+
+// Parse a complete response head at `buf` (NUL-terminated, `len` bytes
+// received so far, the first `prev` already searched). Returns the head
+// length, 0 if the head is incomplete, or -1 if it is malformed.
+// On success the body is set up to start right after the head.
+int ha_wire_parse_head(ha_wire_resp_t *r, char *buf, int len, int prev, int buf_size);
+
+// Consume `n` received body bytes at `p`. Payload bytes are moved down to
+// r->body + r->body_len (a no-op for Content-Length bodies); anything past
+// body_cap is dropped. Returns true when the body is complete.
+bool ha_wire_feed_body(ha_wire_resp_t *r, const char *p, int n);
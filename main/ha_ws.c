@@ -0,0 +1,293 @@
+/*
+ * Home Assistant WebSocket commands
+ *
+ *   client                                  HA
+ *     <------------------------------------ {"type":"auth_required"}
+ *     {"type":"auth","access_token":...} -->
+ *     <------------------------------------ {"type":"auth_ok"}
+ *     {"id":7,"type":"call_service",...} -->
+ *     {"id":8,"type":"call_service",...} -->      both in flight
+ *     <------------------------------------ {"id":8,"type":"result","success":true}
+ *     <------------------------------------ {"id":7,"type":"result","success":true}
+ *
+ * A REST command costs a request-response on one of the engine's
+ * connections, so a scene that touches ten entities waits for up to ten
+ * round trips queued behind each other. Here every command is written to
+ * the one socket as soon as the UI issues it; HA runs the service calls
+ * concurrently and each result finds its command through the pending
+ * table by id, in whatever order it arrives.
+ *
+ * Commands are handed to a small sender task through a queue so the LVGL
+ * task never waits on the socket. esp_websocket_client owns the
+ * connection, reconnects, and delivers results on its own task.
+ */
+
+#include "ha_ws.h"
+#include "metrics.h"
+#include "esp_websocket_client.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CONFIG_HA_TLS_CA_BUNDLE
+#include "esp_crt_bundle.h"
+#endif
+
+static const char *TAG = "ha_ws";
+
+#define MAX_PENDING   16
+#define TX_QUEUE_LEN  16
+#define MSG_MAX       352
+#define EXPIRE_MS     CONFIG_HA_TIMEOUT_MAX_MS
+#define TX_POLL_MS    250
+
+#ifdef CONFIG_HA_TLS_CA_PINNED
+extern const char ha_ca_pem_start[] asm("_binary_ha_ca_pem_start");
+#endif
+
+typedef struct {
+    uint32_t    id;         // 0 = free slot
+    const char *entity_id;
+    const char *service;
+    ha_done_fn  done;
+    void       *ctx;
+    uint32_t    tag;
+    int64_t     queued_us;
+} pending_t;
+
+typedef struct {
+    uint16_t len;
+    char     text[MSG_MAX];
+} tx_msg_t;
+
+static esp_websocket_client_handle_t s_client;
+static QueueHandle_t                 s_tx;
+static atomic_bool                   s_ready;       // authenticated
+static atomic_uint                   s_next_id;
+static char                          s_uri[128];
+
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+static pending_t    s_pending[MAX_PENDING];
+
+static const uint32_t s_cmd_bounds[] = { 10, 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+static metrics_histogram_t m_cmd_ms   = METRICS_HISTOGRAM_INIT("ha_ws_command_ms", "WebSocket command queued to result (ms)", s_cmd_bounds);
+static metrics_gauge_t     m_inflight = METRICS_GAUGE_INIT("ha_ws_inflight", "WebSocket commands waiting for their result");
+static metrics_gauge_t     m_ready    = METRICS_GAUGE_INIT("ha_ws_ready", "1 while the HA WebSocket is authenticated");
+
+// ---- Pending commands ----
+
+static void finish(const pending_t *p, int status)
+{
+    ha_request_t req = {
+        .ep        = strncmp(p->service, "cover/", 6) == 0 ? HA_EP_COVER : HA_EP_LIGHT,
+        .prio      = HA_PRIO_INTERACTIVE,
+        .entity_id = p->entity_id,
+        .service   = p->service,
+        .done      = p->done,
+        .ctx       = p->ctx,
+        .tag       = p->tag,
+        .queued_us = p->queued_us,
+    };
+    metrics_histogram_observe(&m_cmd_ms, (uint32_t)((esp_timer_get_time() - p->queued_us) / 1000));
+    metrics_gauge_add(&m_inflight, -1);
+    p->done(&req, status, "", 0);
+}
+
+// Complete every pending command matching `id` (0 = all), or every one
+// queued before `older_than_us` when that is non-zero
+static void complete_pending(uint32_t id, int64_t older_than_us, int status)
+{
+    for (int i = 0; i < MAX_PENDING; i++) {
+        pending_t p = { 0 };
+        taskENTER_CRITICAL(&s_lock);
+        pending_t *e = &s_pending[i];
+        bool match = e->id && (older_than_us ? e->queued_us < older_than_us : (id == 0 || e->id == id));
+        if (match) {
+            p = *e;
+            e->id = 0;
+        }
+        taskEXIT_CRITICAL(&s_lock);
+        if (p.id) finish(&p, status);
+        if (p.id && id) return;
+    }
+}
+
+esp_err_t ha_ws_command(const char *entity_id, const char *service, const char *body,
+                        ha_done_fn done, void *ctx, uint32_t tag)
+{
+    if (!atomic_load(&s_ready)) return ESP_ERR_INVALID_STATE;
+
+    const char *slash = strchr(service, '/');
+    if (!slash) return ESP_ERR_INVALID_ARG;
+
+    uint32_t id = atomic_fetch_add(&s_next_id, 1);
+    tx_msg_t m;
+    int len = snprintf(m.text, sizeof(m.text),
+                       "{\"id\":%lu,\"type\":\"call_service\",\"domain\":\"%.*s\",\"service\":\"%s\",\"service_data\":%s}",
+                       (unsigned long)id, (int)(slash - service), service, slash + 1, body);
+    if (len >= (int)sizeof(m.text)) return ESP_ERR_INVALID_SIZE;
+    m.len = len;
+
+    pending_t p = {
+        .id        = id,
+        .entity_id = entity_id,
+        .service   = service,
+        .done      = done,
+        .ctx       = ctx,
+        .tag       = tag,
+        .queued_us = esp_timer_get_time(),
+    };
+
+    // The slot is taken before the message can reach HA, so a fast result
+    // always finds it
+    int slot = -1;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < MAX_PENDING; i++) {
+        if (!s_pending[i].id) { slot = i; s_pending[i] = p; break; }
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    if (slot < 0) return ESP_ERR_NO_MEM;
+
+    if (xQueueSend(s_tx, &m, 0) != pdTRUE) {
+        taskENTER_CRITICAL(&s_lock);
+        s_pending[slot].id = 0;
+        taskEXIT_CRITICAL(&s_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    metrics_gauge_add(&m_inflight, 1);
+    ESP_LOGD(TAG, "%s -> %s sent as #%lu", entity_id, service, (unsigned long)id);
+    return ESP_OK;
+}
+
+// ---- Sender ----
+
+static void ws_tx_task(void *arg)
+{
+    tx_msg_t m;
+    while (1) {
+        if (xQueueReceive(s_tx, &m, pdMS_TO_TICKS(TX_POLL_MS)) == pdTRUE &&
+            esp_websocket_client_is_connected(s_client)) {
+            // A failed write surfaces as a disconnect or an expired command
+            if (esp_websocket_client_send_text(s_client, m.text, m.len, pdMS_TO_TICKS(EXPIRE_MS)) < 0)
+                ESP_LOGW(TAG, "Send failed");
+        }
+        complete_pending(0, esp_timer_get_time() - EXPIRE_MS * 1000LL, HA_STATUS_TRANSPORT_ERROR);
+    }
+}
+
+// ---- Receiver ----
+
+static void set_ready(bool ready)
+{
+    atomic_store(&s_ready, ready);
+    metrics_gauge_set(&m_ready, ready);
+}
+
+static bool has_type(const char *msg, const char *type)
+{
+    char key[32];
+    snprintf(key, sizeof(key), "\"type\":\"%s\"", type);
+    return strstr(msg, key) != NULL;
+}
+
+static void on_message(const char *msg)
+{
+    if (has_type(msg, "result")) {
+        const char *id = strstr(msg, "\"id\":");
+        if (!id) return;
+        bool ok = strstr(msg, "\"success\":true") != NULL;
+        if (!ok) ESP_LOGW(TAG, "Command failed: %.120s", msg);
+        complete_pending((uint32_t)strtoul(id + 5, NULL, 10), 0, ok ? 200 : 400);
+    } else if (has_type(msg, "auth_required")) {
+        tx_msg_t m;
+        m.len = snprintf(m.text, sizeof(m.text), "{\"type\":\"auth\",\"access_token\":\"%s\"}", CONFIG_HA_TOKEN);
+        xQueueSendToFront(s_tx, &m, 0);
+    } else if (has_type(msg, "auth_ok")) {
+        ESP_LOGI(TAG, "Authenticated, commands go over the WebSocket");
+        set_ready(true);
+    } else if (has_type(msg, "auth_invalid")) {
+        ESP_LOGE(TAG, "HA rejected the access token");
+    }
+}
+
+static void ws_event_handler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data)
+{
+    esp_websocket_event_data_t *ev = event_data;
+
+    switch (event_id) {
+    case WEBSOCKET_EVENT_CONNECTED:
+        ESP_LOGD(TAG, "Connected to %s", s_uri);
+        break;
+    case WEBSOCKET_EVENT_DATA:
+        // Results are short; a fragmented frame is not one
+        if (ev->op_code == 0x1 && ev->payload_offset == 0 && ev->data_len == ev->payload_len) {
+            char msg[256];
+            int n = ev->data_len < (int)sizeof(msg) - 1 ? ev->data_len : (int)sizeof(msg) - 1;
+            memcpy(msg, ev->data_ptr, n);
+            msg[n] = '\0';
+            on_message(msg);
+        }
+        break;
+    case WEBSOCKET_EVENT_DISCONNECTED:
+    case WEBSOCKET_EVENT_CLOSED:
+        if (atomic_load(&s_ready)) ESP_LOGW(TAG, "Disconnected, commands fall back to REST");
+        set_ready(false);
+        xQueueReset(s_tx);
+        complete_pending(0, 0, HA_STATUS_TRANSPORT_ERROR);
+        break;
+    default:
+        break;
+    }
+}
+
+// ---- Start ----
+
+bool ha_ws_ready(void)
+{
+    return atomic_load(&s_ready);
+}
+
+esp_err_t ha_ws_start(void)
+{
+    const char *base = CONFIG_HA_BASE_URL;
+    bool tls = strncmp(base, "https://", 8) == 0;
+    const char *rest = base + (tls ? 8 : 7);
+    snprintf(s_uri, sizeof(s_uri), "%s%s/api/websocket", tls ? "wss://" : "ws://", rest);
+
+    s_tx = xQueueCreate(TX_QUEUE_LEN, sizeof(tx_msg_t));
+    if (!s_tx) return ESP_ERR_NO_MEM;
+    atomic_store(&s_next_id, 1);
+
+    const esp_websocket_client_config_t cfg = {
+        .uri                  = s_uri,
+        .reconnect_timeout_ms = 10000,
+        .network_timeout_ms   = 10000,
+        .buffer_size          = 1024,
+#if defined(CONFIG_HA_TLS_CA_BUNDLE)
+        .crt_bundle_attach    = esp_crt_bundle_attach,
+#elif defined(CONFIG_HA_TLS_CA_PINNED)
+        .cert_pem             = ha_ca_pem_start,
+#endif
+    };
+    s_client = esp_websocket_client_init(&cfg);
+    if (!s_client) return ESP_ERR_NO_MEM;
+    esp_websocket_register_events(s_client, WEBSOCKET_EVENT_ANY, ws_event_handler, NULL);
+
+    metrics_register_histogram(&m_cmd_ms);
+    metrics_register_gauge(&m_inflight);
+    metrics_register_gauge(&m_ready);
+
+    if (xTaskCreate(ws_tx_task, "ha_ws_tx", 3072, NULL, 5, NULL) != pdPASS) return ESP_ERR_NO_MEM;
+    esp_err_t err = esp_websocket_client_start(s_client);
+    if (err != ESP_OK) return err;
+    ESP_LOGI(TAG, "Commands via %s", s_uri);
+    return ESP_OK;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "ha_engine.h"
+#include "esp_err.h"
+#include <stdbool.h>
+
+/*
+ * Service calls over the HA WebSocket API.
+ *
+ * One authenticated connection to <base URL>/api/websocket carries every
+ * command as a call_service message with its own id. Commands go out as
+ * soon as they are issued, without waiting for earlier results, and each
+ * result is matched back to its command by id.
+ */
+
+// Connect (and keep reconnecting) in the background
+esp_err_t ha_ws_start(void);
+
+// Connected and authenticated
+bool ha_ws_ready(void);
+
+// Queue a call_service for `service` (e.g. "light/turn_on") with `body`
+// as service_data, without blocking. `done` runs with 200 when HA reports
+// success, 400 when it reports an error, or HA_STATUS_TRANSPORT_ERROR if
+// the connection dropped or no result came within CONFIG_HA_TIMEOUT_MAX_MS.
+// An error return means nothing was queued and `done` will not be called.
+esp_err_t ha_ws_command(const char *entity_id, const char *service, const char *body,
+                        ha_done_fn done, void *ctx, uint32_t tag);
@@ -0,0 +1,361 @@
+/*
+ * Invalidation heat map
+ *
+ * Hooks the display's INVALIDATE_AREA and RENDER_START/READY events.
+ * Rectangles invalidated between two frames belong to the next frame. A
+ * rectangle inside one already recorded for that frame is dropped, as LVGL
+ * drops it; this also hides render_slice.c's bands, which lie inside the area
+ * they were cut from. heatmap_init() must therefore run before
+ * render_slice_init(), so the original area is seen first.
+ *
+ * The overlay is a full-screen object on the top layer that draws one
+ * translucent rectangle per cell, from blue (rarely redrawn) to red (redrawn
+ * in most frames). It is invalidated once per second to follow the data.
+ * Those invalidations are not recorded, and frames containing them are left
+ * out of the render-time histogram because they redraw the whole screen.
+ *
+ * Timing uses esp_timer on the device and CLOCK_MONOTONIC elsewhere;
+ * nothing else here is platform specific.
+ */
+
+#include "heatmap.h"
+#include "obj_debug.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#define now_us() esp_timer_get_time()
+#else
+#include <time.h>
+static int64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+#endif
+
+#define CELL_PX           40
+#define FRAME_AREAS       8       // rectangles kept per frame record
+#define FRAME_LOG         64      // frame records kept
+#define RECT_STATS        32      // distinct rectangles counted
+#define OVERLAY_PERIOD_MS 1000
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+typedef struct {
+    int16_t x1, y1, x2, y2;
+} rect16_t;
+
+typedef struct {
+    uint32_t frame;
+    uint32_t render_us;     // 0: not timed (overlay refresh in the frame)
+    uint16_t n_areas;       // may exceed FRAME_AREAS
+    rect16_t area[FRAME_AREAS];
+} frame_rec_t;
+
+typedef struct {
+    rect16_t r;
+    uint32_t hits;
+} rect_stat_t;
+
+static const uint32_t s_ms_bounds[]    = { 2, 5, 10, 16, 33, 50, 100, 250, 500, 1000 };
+static const uint32_t s_pct_bounds[]   = { 1, 2, 5, 10, 25, 50, 75 };
+static const uint32_t s_areas_bounds[] = { 1, 2, 4, 8, 16 };
+
+typedef struct {
+    uint32_t frames;
+    uint32_t cells_max;
+    uint32_t *cells;        // cols * rows
+    uint32_t ms_hist[ARRAY_LEN(s_ms_bounds) + 1];
+    uint32_t pct_hist[ARRAY_LEN(s_pct_bounds) + 1];
+    uint32_t areas_hist[ARRAY_LEN(s_areas_bounds) + 1];
+    rect_stat_t rects[RECT_STATS];  // first distinct rectangles seen
+    uint32_t rects_other;           // hits on rectangles not in the table
+    frame_rec_t log[FRAME_LOG];
+    frame_rec_t pending;    // collecting for the next frame
+    frame_rec_t current;    // being rendered
+    bool pending_self, current_self;
+    int64_t render_start_us;
+} heatmap_t;
+
+static lv_display_t *s_display;
+static int32_t       s_hres, s_vres, s_cols, s_rows;
+static heatmap_t    *s_hm;
+static bool          s_recording;
+static bool          s_self;            // our own overlay invalidation
+static lv_obj_t     *s_overlay;
+static lv_timer_t   *s_overlay_timer;
+
+// ---- Recording ----
+
+static bool rect_in(const rect16_t *a, const rect16_t *b)
+{
+    return a->x1 >= b->x1 && a->y1 >= b->y1 && a->x2 <= b->x2 && a->y2 <= b->y2;
+}
+
+static uint32_t rect_px(const rect16_t *r)
+{
+    return (uint32_t)(r->x2 - r->x1 + 1) * (uint32_t)(r->y2 - r->y1 + 1);
+}
+
+static void hist_add(uint32_t *hist, const uint32_t *bounds, size_t n_bounds, uint32_t v)
+{
+    size_t i = 0;
+    while (i < n_bounds && v > bounds[i]) i++;
+    hist[i]++;
+}
+
+static void invalidate_cb(lv_event_t *e)
+{
+    if (!s_recording) return;
+    if (s_self) {
+        s_hm->pending_self = true;
+        return;
+    }
+    const lv_area_t *a = lv_event_get_param(e);
+    rect16_t r = { (int16_t)a->x1, (int16_t)a->y1, (int16_t)a->x2, (int16_t)a->y2 };
+    frame_rec_t *f = &s_hm->pending;
+    for (int i = 0; i < f->n_areas && i < FRAME_AREAS; i++)
+        if (rect_in(&r, &f->area[i])) return;
+    if (f->n_areas < FRAME_AREAS) f->area[f->n_areas] = r;
+    if (f->n_areas < UINT16_MAX) f->n_areas++;
+
+    for (int i = 0; i < RECT_STATS; i++) {
+        rect_stat_t *st = &s_hm->rects[i];
+        if (st->hits == 0) st->r = r;
+        if (memcmp(&st->r, &r, sizeof(r)) == 0) {
+            st->hits++;
+            return;
+        }
+    }
+    s_hm->rects_other++;
+}
+
+static void render_start_cb(lv_event_t *e)
+{
+    if (!s_recording) return;
+    s_hm->current = s_hm->pending;
+    s_hm->current_self = s_hm->pending_self;
+    memset(&s_hm->pending, 0, sizeof(s_hm->pending));
+    s_hm->pending_self = false;
+    s_hm->render_start_us = now_us();
+}
+
+static void count_cells(const frame_rec_t *f)
+{
+    // Once per frame per cell, however many rectangles touch it
+    for (int32_t row = 0; row < s_rows; row++) {
+        for (int32_t col = 0; col < s_cols; col++) {
+            int32_t x1 = col * CELL_PX, y1 = row * CELL_PX;
+            int32_t x2 = x1 + CELL_PX - 1, y2 = y1 + CELL_PX - 1;
+            for (int i = 0; i < f->n_areas && i < FRAME_AREAS; i++) {
+                const rect16_t *r = &f->area[i];
+                if (r->x1 <= x2 && x1 <= r->x2 && r->y1 <= y2 && y1 <= r->y2) {
+                    uint32_t *c = &s_hm->cells[row * s_cols + col];
+                    if (++*c > s_hm->cells_max) s_hm->cells_max = *c;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+static void render_ready_cb(lv_event_t *e)
+{
+    if (!s_recording) return;
+    frame_rec_t *f = &s_hm->current;
+    if (f->n_areas == 0) return;    // only the overlay changed
+
+    uint32_t us = (uint32_t)(now_us() - s_hm->render_start_us);
+    f->frame = ++s_hm->frames;
+    f->render_us = s_hm->current_self ? 0 : (us ? us : 1);
+    s_hm->log[(f->frame - 1) % FRAME_LOG] = *f;
+    count_cells(f);
+
+    uint64_t px = 0;
+    for (int i = 0; i < f->n_areas && i < FRAME_AREAS; i++)
+        px += rect_px(&f->area[i]);
+    uint32_t pct = (uint32_t)(px * 100 / ((uint64_t)s_hres * s_vres));
+    hist_add(s_hm->pct_hist, s_pct_bounds, ARRAY_LEN(s_pct_bounds), pct > 100 ? 100 : pct);
+    hist_add(s_hm->areas_hist, s_areas_bounds, ARRAY_LEN(s_areas_bounds), f->n_areas);
+    if (f->render_us)
+        hist_add(s_hm->ms_hist, s_ms_bounds, ARRAY_LEN(s_ms_bounds), f->render_us / 1000);
+}
+
+// ---- Overlay ----
+
+static void overlay_draw_cb(lv_event_t *e)
+{
+    if (!s_hm || !s_hm->cells_max) return;
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    for (int32_t row = 0; row < s_rows; row++) {
+        for (int32_t col = 0; col < s_cols; col++) {
+            uint32_t n = s_hm->cells[row * s_cols + col];
+            if (!n) continue;
+            uint8_t t = (uint8_t)(n * 255 / s_hm->cells_max);
+            dsc.bg_color = lv_color_mix(lv_color_hex(0xF38BA8), lv_color_hex(0x89B4FA), t);
+            dsc.bg_opa = (lv_opa_t)(40 + t * 120 / 255);
+            lv_area_t cell = { col * CELL_PX, row * CELL_PX, col * CELL_PX + CELL_PX - 1,
+                               row * CELL_PX + CELL_PX - 1 };
+            lv_draw_rect(layer, &dsc, &cell);
+        }
+    }
+}
+
+static void overlay_timer_cb(lv_timer_t *t)
+{
+    s_self = true;
+    lv_obj_invalidate(s_overlay);
+    s_self = false;
+}
+
+void heatmap_set_overlay(bool visible)
+{
+    if (visible && !s_overlay) {
+        s_self = true;
+        s_overlay = lv_obj_create(lv_display_get_layer_top(s_display));
+        lv_obj_remove_style_all(s_overlay);
+        lv_obj_set_size(s_overlay, s_hres, s_vres);
+        lv_obj_remove_flag(s_overlay, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_event_cb(s_overlay, overlay_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+        s_self = false;
+        s_overlay_timer = lv_timer_create(overlay_timer_cb, OVERLAY_PERIOD_MS, NULL);
+    } else if (!visible && s_overlay) {
+        lv_timer_delete(s_overlay_timer);
+        s_overlay_timer = NULL;
+        s_self = true;
+        lv_obj_delete(s_overlay);
+        s_self = false;
+        s_overlay = NULL;
+    }
+}
+
+// ---- Control ----
+
+void heatmap_reset(void)
+{
+    if (!s_hm) return;
+    uint32_t *cells = s_hm->cells;
+    memset(cells, 0, s_cols * s_rows * sizeof(cells[0]));
+    memset(s_hm, 0, sizeof(*s_hm));
+    s_hm->cells = cells;
+}
+
+void heatmap_set_recording(bool on)
+{
+    if (on && !s_hm) {
+        s_hm = lv_malloc_zeroed(sizeof(*s_hm));
+        if (!s_hm) return;
+        s_hm->cells = lv_malloc_zeroed(s_cols * s_rows * sizeof(s_hm->cells[0]));
+        if (!s_hm->cells) {
+            lv_free(s_hm);
+            s_hm = NULL;
+            return;
+        }
+    }
+    if (on && !s_recording) {
+        // Nothing collected while off belongs to the next frame
+        memset(&s_hm->pending, 0, sizeof(s_hm->pending));
+        memset(&s_hm->current, 0, sizeof(s_hm->current));
+    }
+    s_recording = on;
+}
+
+bool heatmap_recording(void)
+{
+    return s_recording;
+}
+
+// ---- Dump ----
+
+static void dump_hist(const char *name, const uint32_t *hist, const uint32_t *bounds, size_t n_bounds)
+{
+    printf("HM hist %s", name);
+    for (size_t i = 0; i < n_bounds; i++)
+        printf(" %lu:%lu", (unsigned long)bounds[i], (unsigned long)hist[i]);
+    printf(" inf:%lu\n", (unsigned long)hist[n_bounds]);
+}
+
+static int by_hits(const void *a, const void *b)
+{
+    uint32_t ha = ((const rect_stat_t *)a)->hits, hb = ((const rect_stat_t *)b)->hits;
+    return ha < hb ? 1 : ha > hb ? -1 : 0;
+}
+
+static lv_obj_t *rect_owner(const lv_area_t *a)
+{
+    lv_obj_t *top = lv_display_get_layer_top(s_display);
+    for (uint32_t i = lv_obj_get_child_count(top); i-- > 0;) {
+        lv_obj_t *child = lv_obj_get_child(top, i);
+        if (child == s_overlay) continue;
+        lv_obj_t *owner = obj_debug_find_owner(child, a);
+        if (owner) return owner;
+    }
+    return obj_debug_find_owner(lv_display_get_screen_active(s_display), a);
+}
+
+void heatmap_dump(void)
+{
+    if (!s_hm) {
+        printf("HM empty (heatmap on to record)\n");
+        return;
+    }
+    printf("HM begin v1 w=%ld h=%ld cell=%d cols=%ld rows=%ld frames=%lu recording=%d\n",
+           (long)s_hres, (long)s_vres, CELL_PX, (long)s_cols, (long)s_rows,
+           (unsigned long)s_hm->frames, s_recording);
+    for (int32_t row = 0; row < s_rows; row++) {
+        printf("HM grid %ld", (long)row);
+        for (int32_t col = 0; col < s_cols; col++)
+            printf(" %lu", (unsigned long)s_hm->cells[row * s_cols + col]);
+        printf("\n");
+    }
+    dump_hist("render_ms", s_hm->ms_hist, s_ms_bounds, ARRAY_LEN(s_ms_bounds));
+    dump_hist("dirty_pct", s_hm->pct_hist, s_pct_bounds, ARRAY_LEN(s_pct_bounds));
+    dump_hist("areas", s_hm->areas_hist, s_areas_bounds, ARRAY_LEN(s_areas_bounds));
+
+    rect_stat_t rects[RECT_STATS];
+    int n_rects = 0;
+    while (n_rects < RECT_STATS && s_hm->rects[n_rects].hits) n_rects++;
+    memcpy(rects, s_hm->rects, n_rects * sizeof(rects[0]));
+    qsort(rects, n_rects, sizeof(rects[0]), by_hits);
+    for (int i = 0; i < n_rects; i++) {
+        const rect16_t *r = &rects[i].r;
+        lv_area_t a = { r->x1, r->y1, r->x2, r->y2 };
+        char desc[80] = "-";
+        lv_obj_t *owner = rect_owner(&a);
+        if (owner) obj_debug_describe(owner, desc, sizeof(desc));
+        printf("HM rect %d,%d,%d,%d hits=%lu owner=%s\n", r->x1, r->y1, r->x2, r->y2,
+               (unsigned long)rects[i].hits, desc);
+    }
+    printf("HM rect_other hits=%lu\n", (unsigned long)s_hm->rects_other);
+
+    uint32_t first = s_hm->frames > FRAME_LOG ? s_hm->frames - FRAME_LOG + 1 : 1;
+    for (uint32_t n = first; n <= s_hm->frames; n++) {
+        const frame_rec_t *f = &s_hm->log[(n - 1) % FRAME_LOG];
+        printf("HM frame %lu us=%lu areas=%u", (unsigned long)f->frame, (unsigned long)f->render_us, f->n_areas);
+        for (int i = 0; i < f->n_areas && i < FRAME_AREAS; i++)
+            printf(" %d,%d,%d,%d", f->area[i].x1, f->area[i].y1, f->area[i].x2, f->area[i].y2);
+        printf("\n");
+    }
+    printf("HM end\n");
+}
+
+// ---- Init ----
+
+void heatmap_init(lv_display_t *display)
+{
+    s_display = display;
+    s_hres = lv_display_get_horizontal_resolution(display);
+    s_vres = lv_display_get_vertical_resolution(display);
+    s_cols = (s_hres + CELL_PX - 1) / CELL_PX;
+    s_rows = (s_vres + CELL_PX - 1) / CELL_PX;
+
+    lv_display_add_event_cb(display, invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(display, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+}
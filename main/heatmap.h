@@ -0,0 +1,32 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+
+/*
+ * Invalidation heat map (debug mode).
+ *
+ * While recording, every invalidated rectangle and every frame's render
+ * time is collected into:
+ * - a grid of CELL_PX cells counting the frames that redrew each cell
+ * - histograms of render time, dirty share of the screen and areas per frame
+ * - hit counts for the first 32 distinct rectangles, dumped by count
+ * - a ring of the last frames' rectangles
+ *
+ * heatmap_dump() prints it all as "HM ..." lines for
+ * tools/heatmap/heatmap.py. The overlay tints each cell by how often it was
+ * redrawn.
+ *
+ * Depends on LVGL and libc only, so it also runs in a host simulator. All
+ * functions must be called with the LVGL lock held.
+ */
+
+void heatmap_init(lv_display_t *display);
+
+// State is allocated from the LVGL heap on first use
+void heatmap_set_recording(bool on);
+bool heatmap_recording(void);
+
+void heatmap_set_overlay(bool visible);
+void heatmap_reset(void);
+void heatmap_dump(void);
@@ -0,0 +1,80 @@
+/*
+ * Icon atlas drawing
+ *
+ * Every icon is a rectangle of one A8 image (icons_atlas.c, generated by
+ * tools/icons/iconpack.py). An icon is drawn through a view: an image
+ * descriptor whose data points at the icon's first pixel and whose stride
+ * is the atlas width, as pill.c does for its discs. LVGL draws an A8
+ * image as a mask in the recolor color, so the tint is a draw parameter:
+ * an icon changes color with its widget's state at the price of one
+ * redraw of its box.
+ *
+ * Views are built on first use and kept, because LVGL reads the image
+ * source when the draw task runs, after lv_draw_image() has returned.
+ */
+
+#include "icon_atlas.h"
+#include <string.h>
+
+static lv_image_dsc_t s_views[ICON_COUNT];
+
+static const lv_image_dsc_t *view_get(icon_id_t id)
+{
+    lv_image_dsc_t *v = &s_views[id];
+    if (v->data) return v;
+
+    const icon_rect_t *r = &icon_rects[id];
+    uint32_t stride = icon_atlas.header.stride;
+    uint32_t offset = r->y * stride + r->x;
+    v->header.magic  = LV_IMAGE_HEADER_MAGIC;
+    v->header.cf     = LV_COLOR_FORMAT_A8;
+    v->header.w      = r->w;
+    v->header.h      = r->h;
+    v->header.stride = stride;
+    v->data_size     = icon_atlas.data_size - offset;
+    v->data          = icon_atlas.data + offset;
+    return v;
+}
+
+void icon_atlas_draw(lv_layer_t *layer, icon_id_t id, const lv_area_t *area, lv_color_t color,
+                     lv_opa_t opa)
+{
+    if (id <= ICON_NONE || id >= ICON_COUNT || opa <= LV_OPA_MIN) return;
+    const icon_rect_t *r = &icon_rects[id];
+    if (r->w == 0) return;
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = view_get(id);
+    dsc.recolor = color;
+    dsc.recolor_opa = LV_OPA_COVER;
+    dsc.opa = opa;
+
+    int32_t x = area->x1 + (lv_area_get_width(area) - ICON_SIZE) / 2 + r->ofs_x;
+    int32_t y = area->y1 + (lv_area_get_height(area) - ICON_SIZE) / 2 + r->ofs_y;
+    lv_area_t a = { x, y, x + r->w - 1, y + r->h - 1 };
+    lv_draw_image(layer, &dsc, &a);
+}
+
+bool icon_atlas_to_image(icon_id_t id, lv_image_dsc_t *out)
+{
+    if (id <= ICON_NONE || id >= ICON_COUNT) return false;
+    uint8_t *buf = lv_malloc_zeroed(ICON_SIZE * ICON_SIZE);
+    if (!buf) return false;
+
+    const icon_rect_t *r = &icon_rects[id];
+    uint32_t stride = icon_atlas.header.stride;
+    for (int y = 0; y < r->h; y++)
+        memcpy(buf + (r->ofs_y + y) * ICON_SIZE + r->ofs_x,
+               icon_atlas.data + (r->y + y) * stride + r->x, r->w);
+
+    memset(out, 0, sizeof(*out));
+    out->header.magic  = LV_IMAGE_HEADER_MAGIC;
+    out->header.cf     = LV_COLOR_FORMAT_A8;
+    out->header.w      = ICON_SIZE;
+    out->header.h      = ICON_SIZE;
+    out->header.stride = ICON_SIZE;
+    out->data_size     = ICON_SIZE * ICON_SIZE;
+    out->data          = buf;
+    return true;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "lvgl.h"
+#include "icons.h"      // generated: icon_id_t, ICON_SIZE
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Entity icons, packed at build time into one A8 atlas by
+ * tools/icons/iconpack.py (icons_atlas.c in the build directory).
+ *
+ * Only the icons named in rooms.c are packed. Each is stored cropped to its
+ * ink. An icon is drawn as a view into the atlas, tinted with any color,
+ * so a state change repaints it without rasterizing anything.
+ */
+
+// Where an icon sits in the atlas and where its ink sits in the
+// ICON_SIZE x ICON_SIZE square
+typedef struct {
+    uint16_t x, y;
+    uint8_t  w, h;
+    uint8_t  ofs_x, ofs_y;
+} icon_rect_t;
+
+extern const lv_image_dsc_t icon_atlas;
+extern const icon_rect_t    icon_rects[ICON_COUNT];
+
+// Draw `id` centered in `area` in `color`. Call from a widget's
+// LV_EVENT_DRAW_MAIN.
+void icon_atlas_draw(lv_layer_t *layer, icon_id_t id, const lv_area_t *area, lv_color_t color,
+                     lv_opa_t opa);
+
+// Copy `id` into a standalone ICON_SIZE x ICON_SIZE A8 image, the layout
+// the icon would have as its own image, for comparisons. The pixels are
+// lv_malloc'ed; free with lv_free((void *)out->data). False if out of memory.
+bool icon_atlas_to_image(icon_id_t id, lv_image_dsc_t *out);
@@ -0,0 +1,100 @@
+/*
+ * Baked layout
+ *
+ * A room page is a flex column holding a flex card full of flex rows, most
+ * of them LV_SIZE_CONTENT. LVGL lays such a tree out with a pass over every
+ * object, once when the page is built and again whenever a content-sized
+ * child changes size.
+ *
+ * The page's geometry only depends on the room configuration and the fonts,
+ * so it is recorded after the first layout pass: position (relative to the
+ * parent's content area, as lv_obj_set_pos takes it) and size of each
+ * object, depth first. Replaying it onto a freshly built copy sets these as
+ * fixed pixel values and switches every container to LV_LAYOUT_NONE before
+ * LVGL runs a layout. The one layout pass that remains then only refreshes
+ * fixed coordinates. The tree must be built identically, which is checked
+ * only by the object count.
+ *
+ * Pinning is paid for in LVGL heap: x, y, width, height (and the layout on
+ * containers) become a local style on every object, tens of bytes each,
+ * well above the 8 bytes of the record. ui_page_heap_bytes shows it.
+ */
+
+#include "layout_bake.h"
+#include <stdint.h>
+
+typedef struct {
+    int16_t x, y, w, h;
+} geom_t;
+
+struct layout_bake {
+    uint32_t n;
+    geom_t   geom[];
+};
+
+static uint32_t count_descendants(const lv_obj_t *obj)
+{
+    uint32_t n = 0;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++)
+        n += 1 + count_descendants(lv_obj_get_child(obj, i));
+    return n;
+}
+
+static void record(const lv_obj_t *obj, geom_t *geom, uint32_t *next)
+{
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++) {
+        lv_obj_t *c = lv_obj_get_child(obj, i);
+        geom[(*next)++] = (geom_t){
+            .x = (int16_t)lv_obj_get_x(c),     .y = (int16_t)lv_obj_get_y(c),
+            .w = (int16_t)lv_obj_get_width(c), .h = (int16_t)lv_obj_get_height(c),
+        };
+        record(c, geom, next);
+    }
+}
+
+static void pin(lv_obj_t *obj, const geom_t *geom, uint32_t *next)
+{
+    uint32_t children = lv_obj_get_child_count(obj);
+    if (children == 0) return;
+    lv_obj_set_layout(obj, LV_LAYOUT_NONE);
+    for (uint32_t i = 0; i < children; i++) {
+        lv_obj_t *c = lv_obj_get_child(obj, i);
+        const geom_t *g = &geom[(*next)++];
+        lv_obj_set_pos(c, g->x, g->y);
+        lv_obj_set_size(c, g->w, g->h);
+        pin(c, geom, next);
+    }
+}
+
+layout_bake_t *layout_bake_capture(lv_obj_t *root)
+{
+    lv_obj_update_layout(root);
+
+    uint32_t n = count_descendants(root);
+    layout_bake_t *bake = lv_malloc(sizeof(*bake) + n * sizeof(geom_t));
+    if (!bake) return NULL;
+    bake->n = n;
+    uint32_t next = 0;
+    record(root, bake->geom, &next);
+    return bake;
+}
+
+bool layout_bake_apply(const layout_bake_t *bake, lv_obj_t *root)
+{
+    if (count_descendants(root) != bake->n) return false;
+    uint32_t next = 0;
+    pin(root, bake->geom, &next);
+    return true;
+}
+
+uint32_t layout_bake_count(const layout_bake_t *bake)
+{
+    return bake ? bake->n : 0;
+}
+
+void layout_bake_free(layout_bake_t *bake)
+{
+    lv_free(bake);
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+
+/*
+ * Baked layout: the geometry of a built object tree, recorded once from a
+ * real layout pass and replayed onto an identical tree later.
+ *
+ * Replaying pins every descendant to its recorded position and size and
+ * turns layouts off, so LVGL has no flex or content-size work for the tree,
+ * neither when it is created nor when text inside it changes. The tree must
+ * be built the same way both times (same objects in the same order, same
+ * texts and fonts). All functions need the LVGL lock.
+ */
+
+typedef struct layout_bake layout_bake_t;
+
+// Run the pending layout of `root`'s screen and record every descendant of
+// `root`. NULL if out of memory. Free with layout_bake_free().
+layout_bake_t *layout_bake_capture(lv_obj_t *root);
+
+// Pin the descendants of `root` to `bake`. False, leaving the tree alone,
+// if it does not have the recorded number of objects.
+bool layout_bake_apply(const layout_bake_t *bake, lv_obj_t *root);
+
+// Objects recorded (0 for NULL)
+uint32_t layout_bake_count(const layout_bake_t *bake);
+
+void layout_bake_free(layout_bake_t *bake);
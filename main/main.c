@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/lock.h>
@@ -29,8 +30,17 @@
 #include "esp_lvgl_port.h"
 
 #include "ui.h"
+#include "rooms.h"
+#include "entity_model.h"
 #include "wifi.h"
 #include "mqtt_client_app.h"
+#include "sysmon.h"
+#include "console.h"
+#include "metrics_http.h"
+#include "disp_fb.h"
+#include "render_slice.h"
+#include "heatmap.h"
+#include "font_cache.h"
 
 
 static const char *TAG = "smart_home_panel";
@@ -42,6 +52,13 @@ static const char *TAG = "smart_home_panel";
 #define LCD_MIPI_DSI_LANE_NUM    2
 #define LCD_MIPI_DSI_LANE_MBPS   750   // Guition official demo (header says 1000, code uses 750)
 
+// DPI frame buffers in PSRAM, 750 KB each; LVGL draws into them directly
+#ifdef CONFIG_PANEL_DISPLAY_TRIPLE_BUFFER
+#define LCD_NUM_FBS              3
+#else
+#define LCD_NUM_FBS              2
+#endif
+
 // MIPI DSI timings (Guition official demo)
 #define LCD_HSYNC_PULSE_WIDTH    12
 #define LCD_HBP                  42
@@ -151,13 +168,13 @@ static esp_lcd_panel_handle_t init_display(void)
     };
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_dbi(mipi_dsi_bus, &dbi_config, &mipi_dbi_io));
 
-    // DPI panel config — 2 frame buffers + DMA2D for flicker-free display
+    // DPI panel config — 2 or 3 frame buffers + DMA2D for flicker-free display
     esp_lcd_dpi_panel_config_t dpi_config = {
         .virtual_channel = 0,
         .dpi_clk_src = MIPI_DSI_DPI_CLK_SRC_DEFAULT,
         .dpi_clock_freq_mhz = LCD_MIPI_DSI_DPI_CLK_MHZ,
         .pixel_format = LCD_COLOR_PIXEL_FORMAT_RGB565,
-        .num_fbs = 2,
+        .num_fbs = LCD_NUM_FBS,
         .video_timing = {
             .h_size = LCD_H_RES,
             .v_size = LCD_V_RES,
@@ -260,10 +277,24 @@ void app_main(void)
 
     esp_lcd_touch_handle_t touch_handle = init_touch();
 
-    // Initialize LVGL
+    // Initialize LVGL. lv_init() also starts LV_DRAW_SW_DRAW_UNIT_CNT draw
+    // threads (sdkconfig.defaults); the port task (priority 4) dispatches
+    // draw tasks to them and they (priority 3) render in parallel.
     const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
     ESP_ERROR_CHECK(lvgl_port_init(&lvgl_cfg));
 
+#ifdef CONFIG_PANEL_DISPLAY_ZERO_COPY
+    // LVGL renders into the DPI frame buffers and flips them (disp_fb.c)
+    lv_display_t *lvgl_display = NULL;
+    if (lvgl_port_lock(0)) {
+        lvgl_display = disp_fb_create(panel_handle, LCD_H_RES, LCD_V_RES, LCD_NUM_FBS);
+        lvgl_port_unlock();
+    }
+    if (!lvgl_display) {
+        ESP_LOGE(TAG, "Cannot create the zero-copy LVGL display");
+        abort();
+    }
+#else
     const lvgl_port_display_cfg_t disp_cfg = {
         .panel_handle = panel_handle,
         .buffer_size = LCD_H_RES * LCD_V_RES,
@@ -287,6 +318,7 @@ void app_main(void)
         .flags = { .avoid_tearing = true },
     };
     lv_display_t *lvgl_display = lvgl_port_add_disp_dsi(&disp_cfg, &dsi_cfg);
+#endif
 
     const lvgl_port_touch_cfg_t touch_cfg = {
         .disp = lvgl_display,
@@ -294,14 +326,37 @@ void app_main(void)
     };
     lvgl_port_add_touch(&touch_cfg);
 
+    // Room configuration + entity state shared by UI and HA client
+    rooms_init();
+    entity_model_init();
+
+    // Glyph cache before the theme picks its fonts
+    font_cache_init();
+
     // Build UI
     if (lvgl_port_lock(0)) {
         ui_init(lvgl_display);
+        sysmon_init(lvgl_display);
+        // Before render_slice_init(): the heat map must see areas before
+        // they are cut into bands
+        heatmap_init(lvgl_display);
+#ifdef CONFIG_PANEL_HEATMAP
+        heatmap_set_recording(true);
+#endif
+        render_slice_init(lvgl_display);
         lvgl_port_unlock();
     }
 
     // Start MQTT (connects to Home Assistant)
     mqtt_app_init();
 
+#ifdef CONFIG_PANEL_METRICS_HTTP
+    metrics_http_start();
+#endif
+
+#ifdef CONFIG_PANEL_CONSOLE
+    console_init();
+#endif
+
     ESP_LOGI(TAG, "Smart Home Panel ready");
 }
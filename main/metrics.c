@@ -0,0 +1,134 @@
+/*
+ * Metrics registry
+ *
+ * Fixed-size table of pointers to metrics owned by other modules.
+ * Nothing here allocates; dumps read the atomics without locking, so a
+ * histogram's buckets may be off by one in-flight observation.
+ */
+
+#include "metrics.h"
+#include "esp_log.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "metrics";
+
+#define MAX_COLLECTORS 4
+
+typedef struct {
+    metric_type_t  type;
+    void          *metric;
+} entry_t;
+
+static entry_t              s_entries[METRICS_MAX_ENTRIES];
+static int                  s_num_entries;
+static metrics_collector_fn s_collectors[MAX_COLLECTORS];
+static int                  s_num_collectors;
+
+static void add_entry(metric_type_t type, void *metric)
+{
+    if (s_num_entries >= METRICS_MAX_ENTRIES) {
+        ESP_LOGE(TAG, "Registry full, dropping metric");
+        return;
+    }
+    s_entries[s_num_entries].type   = type;
+    s_entries[s_num_entries].metric = metric;
+    s_num_entries++;
+}
+
+void metrics_register_counter(metrics_counter_t *c)
+{
+    add_entry(METRIC_COUNTER, c);
+}
+
+void metrics_register_gauge(metrics_gauge_t *g)
+{
+    add_entry(METRIC_GAUGE, g);
+}
+
+void metrics_register_histogram(metrics_histogram_t *h)
+{
+    if (h->n_bounds > METRICS_HIST_MAX_BUCKETS) {
+        ESP_LOGE(TAG, "%s: too many buckets", h->name);
+        return;
+    }
+    add_entry(METRIC_HISTOGRAM, h);
+}
+
+void metrics_add_collector(metrics_collector_fn fn)
+{
+    if (s_num_collectors < MAX_COLLECTORS)
+        s_collectors[s_num_collectors++] = fn;
+}
+
+void metrics_collect(void)
+{
+    for (int i = 0; i < s_num_collectors; i++)
+        s_collectors[i]();
+}
+
+const metrics_gauge_t *metrics_find_gauge(const char *name)
+{
+    for (int i = 0; i < s_num_entries; i++) {
+        if (s_entries[i].type != METRIC_GAUGE) continue;
+        const metrics_gauge_t *g = s_entries[i].metric;
+        if (strcmp(g->name, name) == 0) return g;
+    }
+    return NULL;
+}
+
+void metrics_foreach(metrics_visit_fn fn, void *ctx)
+{
+    for (int i = 0; i < s_num_entries; i++)
+        fn(s_entries[i].type, s_entries[i].metric, ctx);
+}
+
+// ---- Serial dump ----
+
+static void print_name(const char *name, const char *labels)
+{
+    char buf[64];
+    if (labels) snprintf(buf, sizeof(buf), "%s{%s}", name, labels);
+    else        snprintf(buf, sizeof(buf), "%s", name);
+    printf("%-34s", buf);
+}
+
+static void dump_one(metric_type_t type, const void *metric, void *ctx)
+{
+    (void)ctx;
+    switch (type) {
+    case METRIC_COUNTER: {
+        const metrics_counter_t *c = metric;
+        print_name(c->name, c->labels);
+        printf(" %lu\n", (unsigned long)atomic_load(&c->value));
+        break;
+    }
+    case METRIC_GAUGE: {
+        const metrics_gauge_t *g = metric;
+        print_name(g->name, g->labels);
+        printf(" %ld\n", (long)atomic_load(&g->value));
+        break;
+    }
+    case METRIC_HISTOGRAM: {
+        const metrics_histogram_t *h = metric;
+        uint32_t count = atomic_load(&h->count);
+        uint32_t sum   = atomic_load(&h->sum);
+        print_name(h->name, h->labels);
+        printf(" n=%lu avg=%lu |", (unsigned long)count,
+               (unsigned long)(count ? sum / count : 0));
+        for (int i = 0; i <= h->n_bounds; i++) {
+            uint32_t n = atomic_load(&h->buckets[i]);
+            if (i < h->n_bounds) printf(" <=%lu:%lu", (unsigned long)h->bounds[i], (unsigned long)n);
+            else                 printf(" inf:%lu", (unsigned long)n);
+        }
+        printf("\n");
+        break;
+    }
+    }
+}
+
+void metrics_dump(void)
+{
+    metrics_collect();
+    metrics_foreach(dump_one, NULL);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Lock-free metrics registry.
+ *
+ * Metrics are statically allocated by the module that owns them and
+ * registered once at init. Hot-path updates are a single relaxed atomic
+ * op (histograms: a short bucket scan plus three), so they can stay on
+ * in production builds.
+ */
+
+#define METRICS_MAX_ENTRIES      96
+#define METRICS_HIST_MAX_BUCKETS 12
+
+typedef enum {
+    METRIC_COUNTER,
+    METRIC_GAUGE,
+    METRIC_HISTOGRAM,
+} metric_type_t;
+
+// `labels` is an optional constant Prometheus label set, e.g. "endpoint=\"states\"".
+// Metrics sharing a name must be registered back to back.
+typedef struct {
+    const char       *name;
+    const char       *help;
+    const char       *labels;
+    _Atomic uint32_t  value;
+} metrics_counter_t;
+
+typedef struct {
+    const char       *name;
+    const char       *help;
+    const char       *labels;
+    _Atomic int32_t   value;
+} metrics_gauge_t;
+
+// Bucket i counts observations <= bounds[i]; the last bucket is +Inf.
+typedef struct {
+    const char       *name;
+    const char       *help;
+    const char       *labels;
+    const uint32_t   *bounds;
+    uint8_t           n_bounds;
+    _Atomic uint32_t  buckets[METRICS_HIST_MAX_BUCKETS + 1];
+    _Atomic uint32_t  count;
+    _Atomic uint32_t  sum;
+} metrics_histogram_t;
+
+#define METRICS_COUNTER_INIT(n, h)        { .name = (n), .help = (h) }
+#define METRICS_GAUGE_INIT(n, h)          { .name = (n), .help = (h) }
+#define METRICS_HISTOGRAM_INIT(n, h, b)   { .name = (n), .help = (h), .bounds = (b), \
+                                            .n_bounds = sizeof(b) / sizeof((b)[0]) }
+#define METRICS_COUNTER_INIT_L(n, h, l)   { .name = (n), .help = (h), .labels = (l) }
+#define METRICS_GAUGE_INIT_L(n, h, l)     { .name = (n), .help = (h), .labels = (l) }
+#define METRICS_HISTOGRAM_INIT_L(n, h, l, b) { .name = (n), .help = (h), .labels = (l), .bounds = (b), \
+                                            .n_bounds = sizeof(b) / sizeof((b)[0]) }
+
+// Registration is not thread-safe; call from init code only.
+void metrics_register_counter(metrics_counter_t *c);
+void metrics_register_gauge(metrics_gauge_t *g);
+void metrics_register_histogram(metrics_histogram_t *h);
+
+// Collectors refresh sampled gauges (heap, tasks) right before a dump.
+typedef void (*metrics_collector_fn)(void);
+void metrics_add_collector(metrics_collector_fn fn);
+void metrics_collect(void);
+
+const metrics_gauge_t *metrics_find_gauge(const char *name);
+
+// Walk every registered metric in registration order.
+typedef void (*metrics_visit_fn)(metric_type_t type, const void *metric, void *ctx);
+void metrics_foreach(metrics_visit_fn fn, void *ctx);
+
+// Human-readable dump to stdout (serial console).
+void metrics_dump(void);
+
+// ---- Hot-path updates ----
+
+static inline void metrics_counter_inc(metrics_counter_t *c)
+{
+    atomic_fetch_add_explicit(&c->value, 1, memory_order_relaxed);
+}
+
+static inline void metrics_counter_add(metrics_counter_t *c, uint32_t n)
+{
+    atomic_fetch_add_explicit(&c->value, n, memory_order_relaxed);
+}
+
+static inline void metrics_gauge_set(metrics_gauge_t *g, int32_t v)
+{
+    atomic_store_explicit(&g->value, v, memory_order_relaxed);
+}
+
+static inline void metrics_gauge_add(metrics_gauge_t *g, int32_t d)
+{
+    atomic_fetch_add_explicit(&g->value, d, memory_order_relaxed);
+}
+
+static inline void metrics_histogram_observe(metrics_histogram_t *h, uint32_t v)
+{
+    uint8_t i = 0;
+    while (i < h->n_bounds && v > h->bounds[i]) i++;
+    atomic_fetch_add_explicit(&h->buckets[i], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&h->sum, v, memory_order_relaxed);
+}
@@ -0,0 +1,167 @@
+/*
+ * Prometheus metrics endpoint
+ *
+ * GET /metrics renders the metrics registry in the Prometheus text
+ * exposition format (0.0.4). The response is streamed with chunked
+ * transfer encoding through one small buffer, so memory use does not
+ * grow with the number of metrics.
+ *
+ *   curl http://<panel-ip>/metrics
+ */
+
+#include "metrics_http.h"
+#include "metrics.h"
+#include "sysmon.h"
+#include "esp_log.h"
+#include "esp_http_server.h"
+#include "sdkconfig.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "metrics_http";
+
+#define CHUNK_SIZE 512
+
+typedef struct {
+    httpd_req_t *req;
+    const char  *last_name;
+    esp_err_t    err;
+    int          len;
+    char         buf[CHUNK_SIZE];
+} prom_writer_t;
+
+static void flush(prom_writer_t *w)
+{
+    if (w->len > 0 && w->err == ESP_OK)
+        w->err = httpd_resp_send_chunk(w->req, w->buf, w->len);
+    w->len = 0;
+}
+
+static void emit(prom_writer_t *w, const char *fmt, ...)
+{
+    char line[160];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+    if (n <= 0) return;
+    if (n >= (int)sizeof(line)) n = sizeof(line) - 1;
+
+    if (w->len + n > CHUNK_SIZE) flush(w);
+    memcpy(w->buf + w->len, line, n);
+    w->len += n;
+}
+
+static void emit_family(prom_writer_t *w, const char *name, const char *help, const char *type)
+{
+    // Same-name metrics are registered back to back; describe the family once
+    if (w->last_name && strcmp(w->last_name, name) == 0) return;
+    w->last_name = name;
+    emit(w, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// "name" or "name{labels}"
+static const char *series(char *out, size_t size, const char *name, const char *suffix, const char *labels)
+{
+    if (labels) snprintf(out, size, "%s%s{%s}", name, suffix, labels);
+    else        snprintf(out, size, "%s%s", name, suffix);
+    return out;
+}
+
+static void emit_metric(metric_type_t type, const void *metric, void *ctx)
+{
+    prom_writer_t *w = ctx;
+    char id[96];
+
+    switch (type) {
+    case METRIC_COUNTER: {
+        const metrics_counter_t *c = metric;
+        emit_family(w, c->name, c->help, "counter");
+        emit(w, "%s %lu\n", series(id, sizeof(id), c->name, "", c->labels),
+             (unsigned long)atomic_load(&c->value));
+        break;
+    }
+    case METRIC_GAUGE: {
+        const metrics_gauge_t *g = metric;
+        emit_family(w, g->name, g->help, "gauge");
+        emit(w, "%s %ld\n", series(id, sizeof(id), g->name, "", g->labels),
+             (long)atomic_load(&g->value));
+        break;
+    }
+    case METRIC_HISTOGRAM: {
+        const metrics_histogram_t *h = metric;
+        const char *labels = h->labels ? h->labels : "";
+        const char *sep    = h->labels ? "," : "";
+        emit_family(w, h->name, h->help, "histogram");
+
+        uint32_t cumulative = 0;
+        for (int i = 0; i < h->n_bounds; i++) {
+            cumulative += atomic_load(&h->buckets[i]);
+            emit(w, "%s_bucket{%s%sle=\"%lu\"} %lu\n", h->name, labels, sep,
+                 (unsigned long)h->bounds[i], (unsigned long)cumulative);
+        }
+        cumulative += atomic_load(&h->buckets[h->n_bounds]);
+        emit(w, "%s_bucket{%s%sle=\"+Inf\"} %lu\n", h->name, labels, sep, (unsigned long)cumulative);
+        emit(w, "%s %lu\n", series(id, sizeof(id), h->name, "_sum", h->labels),
+             (unsigned long)atomic_load(&h->sum));
+        emit(w, "%s %lu\n", series(id, sizeof(id), h->name, "_count", h->labels),
+             (unsigned long)cumulative);
+        break;
+    }
+    }
+}
+
+static void emit_tasks(prom_writer_t *w)
+{
+    static sysmon_task_stat_t tasks[SYSMON_MAX_TASKS];
+    int n = sysmon_get_tasks(tasks, SYSMON_MAX_TASKS);
+    if (n == 0) return;
+
+    emit_family(w, "task_cpu_percent", "CPU share since the previous sample", "gauge");
+    for (int i = 0; i < n; i++)
+        emit(w, "task_cpu_percent{task=\"%s\"} %u\n", tasks[i].name, tasks[i].cpu_pct);
+    emit_family(w, "task_stack_free_bytes", "Stack high-water mark", "gauge");
+    for (int i = 0; i < n; i++)
+        emit(w, "task_stack_free_bytes{task=\"%s\"} %lu\n", tasks[i].name,
+             (unsigned long)tasks[i].stack_free);
+}
+
+static esp_err_t metrics_get_handler(httpd_req_t *req)
+{
+    // Handlers run one at a time on the httpd task, so a static writer is safe
+    static prom_writer_t w;
+    memset(&w, 0, offsetof(prom_writer_t, buf));
+    w.req = req;
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    metrics_collect();
+    metrics_foreach(emit_metric, &w);
+    emit_tasks(&w);
+    flush(&w);
+
+    if (w.err != ESP_OK) return w.err;
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+void metrics_http_start(void)
+{
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = CONFIG_PANEL_METRICS_HTTP_PORT;
+    config.max_open_sockets = 2;
+
+    httpd_handle_t server = NULL;
+    if (httpd_start(&server, &config) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start HTTP server");
+        return;
+    }
+
+    const httpd_uri_t uri = {
+        .uri = "/metrics",
+        .method = HTTP_GET,
+        .handler = metrics_get_handler,
+    };
+    httpd_register_uri_handler(server, &uri);
+    ESP_LOGI(TAG, "Serving /metrics on port %d", CONFIG_PANEL_METRICS_HTTP_PORT);
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Start the HTTP server exposing GET /metrics in Prometheus text format
+void metrics_http_start(void);
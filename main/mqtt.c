@@ -4,90 +4,147 @@
  * Controls lights and covers via direct HTTP calls to the HA REST API.
  * - Commands: POST /api/services/light/turn_on|turn_off
  *             POST /api/services/cover/open_cover|close_cover|set_cover_position
- * - State sync: GET /api/states/<entity_id> polled every 10s
+ * - State sync: GET /api/states/<entity_id> per entity in entity_model, as
+ *               background work whenever that entity's deadline in
+ *               poll_sched.c passes; results older than a local command
+ *               are discarded by entity_model_apply_poll()
+ *             - or, with HA_SOURCE_TEMPLATE, one POST /api/template that
+ *               renders all entities as CSV lines
+ * - Commands are interactive requests: ha_engine.c runs them ahead of polls
+ *   on a reserved connection and returns the outcome via a callback. With
+ *   HA_WS_COMMANDS they are pipelined over the HA WebSocket instead
+ *   (ha_ws.c) while it is authenticated.
+ * - Timeouts adapt to measured RTT and a circuit breaker fails requests
+ *   fast while HA is down (ha_breaker.c)
+ * - With the MQTT source selected and its broker connected, state arrives
+ *   as statestream pushes and commands go out over MQTT (ha_mqtt.c);
+ *   polling pauses and REST takes over again whenever the broker is down.
+ *   Resyncs after a rollback always use REST.
+ * - With the gateway source, a panel gateway next to HA pushes compact
+ *   binary deltas (ha_gateway.c); commands stay on WebSocket/REST.
  */
 
 #include "mqtt_client_app.h"
 #include "ui.h"
+#include "entity_model.h"
+#include "ha_engine.h"
+#include "ha_mqtt.h"
+#include "ha_gateway.h"
+#include "entity_push.h"
+#include "ha_ws.h"
+#include "poll_sched.h"
+#include "metrics.h"
 #include "esp_log.h"
-#include "esp_http_client.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
 #include "esp_lvgl_port.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "sdkconfig.h"
+#include <stdatomic.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
 
 static const char *TAG = "ha_api";
 
-#define HA_BASE_URL  CONFIG_HA_BASE_URL
-#define HA_TOKEN     CONFIG_HA_TOKEN
+#define STARTUP_DELAY_MS 5000
+#define MAX_WAIT_MS      60000
 
-#define POLL_INTERVAL_MS 10000
-#define HTTP_BUF_SIZE    1024
+#if defined(CONFIG_HA_SOURCE_MQTT)
+static ha_source_t s_source = HA_SOURCE_MQTT;
+#elif defined(CONFIG_HA_SOURCE_GATEWAY)
+static ha_source_t s_source = HA_SOURCE_GATEWAY;
+#elif defined(CONFIG_HA_SOURCE_TEMPLATE)
+static ha_source_t s_source = HA_SOURCE_TEMPLATE;
+#else
+static ha_source_t s_source = HA_SOURCE_REST;
+#endif
+static bool        s_mqtt_ready;    // ha_mqtt_init() succeeded
+static bool        s_gateway_ready; // ha_gateway_init() succeeded
 
-static char s_response_buf[HTTP_BUF_SIZE];
-static int  s_response_len;
+static metrics_counter_t m_poll_ok        = METRICS_COUNTER_INIT("ha_polls_ok_total", "Entity state polls applied to the UI");
+static metrics_counter_t m_poll_changed   = METRICS_COUNTER_INIT("ha_polls_changed_total", "Entity state polls that found a change");
+static metrics_counter_t m_poll_failed    = METRICS_COUNTER_INIT("ha_polls_failed_total", "Entity state polls that failed");
+static metrics_counter_t m_poll_cancelled = METRICS_COUNTER_INIT("ha_polls_cancelled_total", "Entity state polls cancelled by a command");
 
-static esp_err_t http_event_handler(esp_http_client_event_t *evt)
+enum { FMT_JSON, FMT_CSV, FMT_COUNT };
+
+static const uint32_t s_parse_bounds[] = { 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000 };
+
+#define PARSE_HELP "CPU cycles to parse one poll response"
+
+static metrics_histogram_t m_parse[FMT_COUNT] = {
+    [FMT_JSON] = METRICS_HISTOGRAM_INIT_L("ha_poll_parse_cycles", PARSE_HELP, "format=\"json\"", s_parse_bounds),
+    [FMT_CSV]  = METRICS_HISTOGRAM_INIT_L("ha_poll_parse_cycles", PARSE_HELP, "format=\"csv\"",  s_parse_bounds),
+};
+
+// MQTT carries state and commands only while it is selected and connected
+static bool mqtt_active(void)
 {
-    if (evt->event_id == HTTP_EVENT_ON_DATA &&
-        !esp_http_client_is_chunked_response(evt->client)) {
-        int copy = evt->data_len;
-        if (s_response_len + copy >= HTTP_BUF_SIZE - 1)
-            copy = HTTP_BUF_SIZE - 1 - s_response_len;
-        memcpy(s_response_buf + s_response_len, evt->data, copy);
-        s_response_len += copy;
-    }
-    return ESP_OK;
+    return s_source == HA_SOURCE_MQTT && ha_mqtt_connected();
 }
 
-static esp_err_t ha_post(const char *path, const char *body)
+// State is pushed (MQTT or gateway) and polling can pause
+static bool push_active(void)
 {
-    char url[128];
-    snprintf(url, sizeof(url), "%s%s", HA_BASE_URL, path);
+    return mqtt_active() || (s_source == HA_SOURCE_GATEWAY && ha_gateway_connected());
+}
 
-    esp_http_client_config_t cfg = {
-        .url = url,
-        .method = HTTP_METHOD_POST,
-        .event_handler = http_event_handler,
-        .timeout_ms = 5000,
+// `service` must be a string literal, e.g. "light/turn_on"
+static esp_err_t ha_post(const char *entity_id, const char *service, const char *body,
+                         ha_done_fn done, void *ctx, uint32_t tag)
+{
+    if (mqtt_active()) {
+        esp_err_t err = ha_mqtt_command(entity_id, service, body, done, ctx, tag);
+        if (err == ESP_OK) return ESP_OK;
+        ESP_LOGW(TAG, "%s -> %s not published (%s), using REST", entity_id, service, esp_err_to_name(err));
+    }
+#ifdef CONFIG_HA_WS_COMMANDS
+    if (ha_ws_ready()) {
+        esp_err_t err = ha_ws_command(entity_id, service, body, done, ctx, tag);
+        if (err == ESP_OK) return ESP_OK;
+        ESP_LOGW(TAG, "%s -> %s not sent over WebSocket (%s), using REST", entity_id, service, esp_err_to_name(err));
+    }
+#endif
+
+    ha_request_t req = {
+        .ep        = strncmp(service, "cover/", 6) == 0 ? HA_EP_COVER : HA_EP_LIGHT,
+        .prio      = HA_PRIO_INTERACTIVE,
+        .entity_id = entity_id,     // lets the engine cancel queued polls of it
+        .service   = service,
+        .done      = done,
+        .ctx       = ctx,
+        .tag       = tag,
     };
-    esp_http_client_handle_t client = esp_http_client_init(&cfg);
-    esp_http_client_set_header(client, "Authorization", "Bearer " HA_TOKEN);
-    esp_http_client_set_header(client, "Content-Type", "application/json");
-    esp_http_client_set_post_field(client, body, strlen(body));
-
-    s_response_len = 0;
-    esp_err_t err = esp_http_client_perform(client);
-    int status = esp_http_client_get_status_code(client);
-    esp_http_client_cleanup(client);
+    strlcpy(req.body, body, sizeof(req.body));
 
-    return (err == ESP_OK && status == 200) ? ESP_OK : ESP_FAIL;
+    // Never block the caller (the LVGL task); a full queue fails the command
+    esp_err_t err = ha_engine_submit(&req, 0);
+    if (err == ESP_OK)
+        ESP_LOGD(TAG, "%s -> %s queued", entity_id, service);
+    else
+        ESP_LOGW(TAG, "%s -> %s not queued: %s", entity_id, service, esp_err_to_name(err));
+    return err;
 }
 
 // ---- Light commands ----
 
-void mqtt_publish_command(const char *entity_id, const char *payload)
+esp_err_t mqtt_publish_command(const char *entity_id, const char *payload,
+                               ha_done_fn done, void *ctx, uint32_t tag)
 {
-    const char *service = (strcmp(payload, "ON") == 0) ? "turn_on" : "turn_off";
-    char path[64], body[128];
-    snprintf(path, sizeof(path), "/api/services/light/%s", service);
+    const char *service = (strcmp(payload, "ON") == 0) ? "light/turn_on" : "light/turn_off";
+    char body[128];
     snprintf(body, sizeof(body), "{\"entity_id\":\"%s\"}", entity_id);
-
-    if (ha_post(path, body) == ESP_OK)
-        ESP_LOGI(TAG, "%s -> %s OK", entity_id, service);
-    else
-        ESP_LOGW(TAG, "%s -> %s failed", entity_id, service);
+    return ha_post(entity_id, service, body, done, ctx, tag);
 }
 
-void ha_set_light_with_params(const char *entity_id, bool on, int brightness, int color_temp_kelvin)
+esp_err_t ha_set_light_with_params(const char *entity_id, bool on, int brightness, int color_temp_kelvin,
+                                   ha_done_fn done, void *ctx, uint32_t tag)
 {
-    if (!on) {
-        mqtt_publish_command(entity_id, "OFF");
-        return;
-    }
+    if (!on)
+        return mqtt_publish_command(entity_id, "OFF", done, ctx, tag);
 
     char body[192];
     int len = snprintf(body, sizeof(body), "{\"entity_id\":\"%s\"", entity_id);
@@ -96,43 +153,31 @@ void ha_set_light_with_params(const char *entity_id, bool on, int brightness, in
     if (color_temp_kelvin > 0)
         len += snprintf(body + len, sizeof(body) - len, ",\"color_temp_kelvin\":%d", color_temp_kelvin);
     snprintf(body + len, sizeof(body) - len, "}");
-
-    if (ha_post("/api/services/light/turn_on", body) == ESP_OK)
-        ESP_LOGI(TAG, "%s brightness=%d ct=%d OK", entity_id, brightness, color_temp_kelvin);
-    else
-        ESP_LOGW(TAG, "%s params failed", entity_id);
+    return ha_post(entity_id, "light/turn_on", body, done, ctx, tag);
 }
 
 // ---- Cover commands ----
 
-void ha_cover_open(const char *entity_id)
+esp_err_t ha_cover_open(const char *entity_id, ha_done_fn done, void *ctx, uint32_t tag)
 {
     char body[128];
     snprintf(body, sizeof(body), "{\"entity_id\":\"%s\"}", entity_id);
-    if (ha_post("/api/services/cover/open_cover", body) == ESP_OK)
-        ESP_LOGI(TAG, "%s -> open OK", entity_id);
-    else
-        ESP_LOGW(TAG, "%s -> open failed", entity_id);
+    return ha_post(entity_id, "cover/open_cover", body, done, ctx, tag);
 }
 
-void ha_cover_close(const char *entity_id)
+esp_err_t ha_cover_close(const char *entity_id, ha_done_fn done, void *ctx, uint32_t tag)
 {
     char body[128];
     snprintf(body, sizeof(body), "{\"entity_id\":\"%s\"}", entity_id);
-    if (ha_post("/api/services/cover/close_cover", body) == ESP_OK)
-        ESP_LOGI(TAG, "%s -> close OK", entity_id);
-    else
-        ESP_LOGW(TAG, "%s -> close failed", entity_id);
+    return ha_post(entity_id, "cover/close_cover", body, done, ctx, tag);
 }
 
-void ha_cover_set_position(const char *entity_id, int position)
+esp_err_t ha_cover_set_position(const char *entity_id, int position,
+                                ha_done_fn done, void *ctx, uint32_t tag)
 {
     char body[128];
     snprintf(body, sizeof(body), "{\"entity_id\":\"%s\",\"position\":%d}", entity_id, position);
-    if (ha_post("/api/services/cover/set_cover_position", body) == ESP_OK)
-        ESP_LOGI(TAG, "%s -> position=%d OK", entity_id, position);
-    else
-        ESP_LOGW(TAG, "%s -> set_position failed", entity_id);
+    return ha_post(entity_id, "cover/set_cover_position", body, done, ctx, tag);
 }
 
 // ---- Polling ----
@@ -149,92 +194,409 @@ static int parse_json_int(const char *buf, const char *key)
     return atoi(p);
 }
 
-static void poll_light(const char *entity_id)
+// Parsed on the engine task, applied on the poll task (which may block on
+// the LVGL lock; the engine must not)
+typedef struct {
+    entity_state_t     *st;
+    entity_poll_token_t token;
+    int                 status;
+    bool                ok;
+    bool                background;     // scheduled by poll_sched
+    bool                moving;         // cover opening/closing
+    entity_values_t     vals;
+} poll_result_t;
+
+// Room for one background poll per entity plus this many resyncs
+#define RESYNC_RESULTS 8
+
+static QueueHandle_t s_results;
+static TaskHandle_t  s_poll_task;
+
+// Start of the "state" string value, just past its opening quote
+static const char *state_value(const char *body)
 {
-    char url[128];
-    snprintf(url, sizeof(url), "%s/api/states/%s", HA_BASE_URL, entity_id);
+    const char *state_key = strstr(body, "\"state\":");
+    if (!state_key) return NULL;
+    const char *val = strchr(state_key + 8, '"');
+    return val ? val + 1 : NULL;
+}
 
-    esp_http_client_config_t cfg = {
-        .url = url,
-        .method = HTTP_METHOD_GET,
-        .event_handler = http_event_handler,
-        .timeout_ms = 5000,
+static bool parse_light(const char *body, entity_values_t *v)
+{
+    const char *val = state_value(body);
+    if (!val) return false;
+
+    *v = (entity_values_t){
+        .on           = (strncmp(val, "on", 2) == 0 && val[2] == '"'),
+        .brightness   = parse_json_int(body, "brightness"),
+        .color_temp_k = parse_json_int(body, "color_temp_kelvin"),
+        .position     = -1,
     };
-    esp_http_client_handle_t client = esp_http_client_init(&cfg);
-    esp_http_client_set_header(client, "Authorization", "Bearer " HA_TOKEN);
+    return true;
+}
 
-    s_response_len = 0;
-    esp_err_t err = esp_http_client_perform(client);
-    int status = esp_http_client_get_status_code(client);
-    esp_http_client_cleanup(client);
+static bool parse_cover(const char *body, entity_values_t *v, bool *moving)
+{
+    int position = parse_json_int(body, "current_position");
+    if (position < 0) return false;
 
-    if (err != ESP_OK || status != 200) return;
-    s_response_buf[s_response_len] = '\0';
+    *v = (entity_values_t){
+        .brightness = -1,
+        .position   = position,
+    };
+    const char *val = state_value(body);
+    *moving = val && (strncmp(val, "opening\"", 8) == 0 || strncmp(val, "closing\"", 8) == 0);
+    return true;
+}
 
-    const char *state_key = strstr(s_response_buf, "\"state\":");
-    if (!state_key) return;
-    const char *val = strchr(state_key + 8, '"');
-    if (!val) return;
-    val++;
-    bool is_on = (strncmp(val, "on", 2) == 0 && val[2] == '"');
+static void poll_done(const ha_request_t *req, int status, const char *body, int body_len)
+{
+    poll_result_t r = {
+        .st         = req->ctx,
+        .token      = { .cmd_seq = req->tag, .started_us = req->queued_us },
+        .status     = status,
+        .background = req->prio == HA_PRIO_BACKGROUND,
+    };
+    if (status == 200) {
+        uint32_t t0 = esp_cpu_get_cycle_count();
+        r.ok = r.st->kind == ENTITY_COVER ? parse_cover(body, &r.vals, &r.moving)
+                                          : parse_light(body, &r.vals);
+        metrics_histogram_observe(&m_parse[FMT_JSON], esp_cpu_get_cycle_count() - t0);
+    }
+
+    // The engine task is the only producer. Keep ENTITY_MODEL_MAX slots for
+    // background results so every in-flight entity gets rescheduled; a
+    // resync result may be dropped, the next poll covers it.
+    if (!r.background && uxQueueSpacesAvailable(s_results) <= ENTITY_MODEL_MAX) {
+        metrics_counter_inc(&m_poll_failed);
+        return;
+    }
+    xQueueSend(s_results, &r, 0);
+    xTaskNotifyGive(s_poll_task);
+}
+
+// Apply polled values unless a local command overtook the request
+static poll_outcome_t apply_poll(const poll_result_t *r)
+{
+    if (!lvgl_port_lock(100)) return POLL_NO_DATA;
+    bool changed = false;
+    bool applied = entity_model_apply_poll(r->st, r->token, &r->vals, &changed);
+    if (applied && changed) ui_refresh_entity(r->st);
+    lvgl_port_unlock();
+
+    if (!applied) return POLL_NO_DATA;
+    metrics_counter_inc(&m_poll_ok);
+    if (changed) metrics_counter_inc(&m_poll_changed);
+    if (r->moving) return POLL_MOVING;
+    return changed ? POLL_CHANGED : POLL_UNCHANGED;
+}
+
+static void handle_result(const poll_result_t *r)
+{
+    poll_outcome_t outcome = POLL_NO_DATA;
+    if (r->ok)                                  outcome = apply_poll(r);
+    else if (r->status == HA_STATUS_CANCELLED)  metrics_counter_inc(&m_poll_cancelled);
+    else                                        metrics_counter_inc(&m_poll_failed);
+
+    // Resyncs run outside the schedule
+    if (r->background)
+        poll_sched_done(entity_model_index(r->st), outcome, esp_timer_get_time());
+}
 
-    int brightness        = parse_json_int(s_response_buf, "brightness");
-    int color_temp_kelvin = parse_json_int(s_response_buf, "color_temp_kelvin");
+// ---- Aggregated polling ----
+
+// HA_SOURCE_TEMPLATE: one POST /api/template renders a line per entity,
+// in entity_model order, instead of a GET per due entity:
+//
+//   <state>,<brightness>,<color_temp_kelvin>,<current_position>\n
+//
+// The template is built once from the entity list. Whenever entities are
+// due, all of them are fetched; the due ones are rescheduled as usual and
+// the rest get their values refreshed for free. One request at a time: the
+// engine task fills s_agg, the poll task applies it.
+
+enum { AGG_IDLE, AGG_IN_FLIGHT, AGG_DONE };
+
+static char       *s_template;
+static int         s_template_len;
+static atomic_int  s_agg_state;
+static struct {
+    uint64_t        due;                        // taken from poll_sched
+    uint64_t        parsed;                     // lines parsed
+    uint64_t        moving;
+    uint32_t        cmd_seq[ENTITY_MODEL_MAX];  // tokens at submit
+    int64_t         started_us;
+    int             status;
+    entity_values_t vals[ENTITY_MODEL_MAX];
+} s_agg;
+
+static esp_err_t build_template(void)
+{
+    static const char head[] = "{\"template\":\"{%for e in [";
+    static const char tail[] = "]%}{{states(e)}},{{state_attr(e,'brightness')|int(-1)}},"
+                               "{{state_attr(e,'color_temp_kelvin')|int(0)}},"
+                               "{{state_attr(e,'current_position')|int(-1)}}\\n{%endfor%}\"}";
+
+    int count = entity_model_count();
+    int len = sizeof(head) - 1 + sizeof(tail) - 1;
+    for (int i = 0; i < count; i++)
+        len += strlen(entity_model_get(i)->entity_id) + 3;     // 'id',
+
+    s_template = malloc(len + 1);
+    if (!s_template) return ESP_ERR_NO_MEM;
+    int n = snprintf(s_template, len + 1, "%s", head);
+    for (int i = 0; i < count; i++)
+        n += snprintf(s_template + n, len + 1 - n, "%s'%s'", i ? "," : "", entity_model_get(i)->entity_id);
+    n += snprintf(s_template + n, len + 1 - n, "%s", tail);
+    s_template_len = n;
+    ESP_LOGD(TAG, "Template for %d entities: %d B", count, n);
+    return ESP_OK;
+}
+
+// Parse an optionally negative decimal; NULL if there is none
+static const char *csv_int(const char *p, int *out)
+{
+    bool neg = *p == '-';
+    if (neg) p++;
+    if (*p < '0' || *p > '9') return NULL;
+    int v = 0;
+    while (*p >= '0' && *p <= '9') v = v * 10 + (*p++ - '0');
+    *out = neg ? -v : v;
+    return p;
+}
 
-    if (lvgl_port_lock(100)) {
-        ui_update_light_state(entity_id, is_on);
-        ui_update_light_params(entity_id, brightness, color_temp_kelvin);
-        lvgl_port_unlock();
+// One line: fill vals[idx] and return the start of the next line, or NULL
+static const char *parse_csv_line(const char *p, int idx)
+{
+    const char *state = p;
+    while (*p && *p != ',' && *p != '\n') p++;
+    int state_len = (int)(p - state);
+
+    int f[3];
+    for (int i = 0; i < 3; i++) {
+        if (*p != ',' || !(p = csv_int(p + 1, &f[i]))) return NULL;
+    }
+    if (*p == '\n') p++;
+
+    entity_values_t *v = &s_agg.vals[idx];
+    if (entity_model_get(idx)->kind == ENTITY_COVER) {
+        if (f[2] < 0) return p;     // no position: nothing usable
+        *v = (entity_values_t){ .brightness = -1, .position = f[2] };
+        bool moving = state_len == 7 && (memcmp(state, "opening", 7) == 0 || memcmp(state, "closing", 7) == 0);
+        if (moving) s_agg.moving |= 1ULL << idx;
+    } else {
+        *v = (entity_values_t){
+            .on           = state_len == 2 && memcmp(state, "on", 2) == 0,
+            .brightness   = f[0],
+            .color_temp_k = f[1] > 0 ? f[1] : 0,
+            .position     = -1,
+        };
     }
+    s_agg.parsed |= 1ULL << idx;
+    return p;
 }
 
-static void poll_cover(const char *entity_id)
+static void aggregate_done(const ha_request_t *req, int status, const char *body, int body_len)
 {
-    char url[128];
-    snprintf(url, sizeof(url), "%s/api/states/%s", HA_BASE_URL, entity_id);
+    s_agg.status     = status;
+    s_agg.started_us = req->queued_us;
+    if (status == 200) {
+        uint32_t t0 = esp_cpu_get_cycle_count();
+        const char *p = body;
+        for (int i = 0; i < entity_model_count() && p && *p; i++)
+            p = parse_csv_line(p, i);
+        metrics_histogram_observe(&m_parse[FMT_CSV], esp_cpu_get_cycle_count() - t0);
+    }
+    atomic_store(&s_agg_state, AGG_DONE);
+    xTaskNotifyGive(s_poll_task);
+}
 
-    esp_http_client_config_t cfg = {
-        .url = url,
-        .method = HTTP_METHOD_GET,
-        .event_handler = http_event_handler,
-        .timeout_ms = 5000,
+static esp_err_t submit_aggregate(const int *due, int n)
+{
+    s_agg.due = s_agg.parsed = s_agg.moving = 0;
+    for (int i = 0; i < n; i++)
+        s_agg.due |= 1ULL << due[i];
+    for (int i = 0; i < entity_model_count(); i++)
+        s_agg.cmd_seq[i] = entity_model_poll_begin(entity_model_get(i)).cmd_seq;
+
+    ha_request_t req = {
+        .ep          = HA_EP_TEMPLATE,
+        .prio        = HA_PRIO_BACKGROUND,
+        .payload     = s_template,
+        .payload_len = s_template_len,
+        .done        = aggregate_done,
     };
-    esp_http_client_handle_t client = esp_http_client_init(&cfg);
-    esp_http_client_set_header(client, "Authorization", "Bearer " HA_TOKEN);
+    atomic_store(&s_agg_state, AGG_IN_FLIGHT);
+    esp_err_t err = ha_engine_submit(&req, portMAX_DELAY);
+    if (err != ESP_OK) atomic_store(&s_agg_state, AGG_IDLE);
+    return err;
+}
 
-    s_response_len = 0;
-    esp_err_t err = esp_http_client_perform(client);
-    int status = esp_http_client_get_status_code(client);
-    esp_http_client_cleanup(client);
+// Poll task: apply a finished aggregate like per-entity results
+static void handle_aggregate(void)
+{
+    for (int i = 0; i < entity_model_count(); i++) {
+        uint64_t bit = 1ULL << i;
+        bool due = s_agg.due & bit;
+        if (!due && !(s_agg.parsed & bit)) continue;
+        poll_result_t r = {
+            .st         = entity_model_get(i),
+            .token      = { .cmd_seq = s_agg.cmd_seq[i], .started_us = s_agg.started_us },
+            .status     = s_agg.status,
+            .ok         = s_agg.parsed & bit,
+            .background = due,
+            .moving     = s_agg.moving & bit,
+            .vals       = s_agg.vals[i],
+        };
+        handle_result(&r);
+    }
+    atomic_store(&s_agg_state, AGG_IDLE);
+}
 
-    if (err != ESP_OK || status != 200) return;
-    s_response_buf[s_response_len] = '\0';
+// `cmd_seq` is a racy read when called off the LVGL task; it is re-checked
+// under the lock in entity_model_apply_poll()
+static esp_err_t submit_poll(entity_state_t *st, ha_priority_t prio, TickType_t wait)
+{
+    ha_request_t req = {
+        .ep        = HA_EP_STATES,
+        .prio      = prio,
+        .entity_id = st->entity_id,
+        .done      = poll_done,
+        .ctx       = st,
+        .tag       = entity_model_poll_begin(st).cmd_seq,
+    };
+    return ha_engine_submit(&req, wait);
+}
 
-    int position = parse_json_int(s_response_buf, "current_position");
+esp_err_t ha_resync_entity(entity_state_t *st)
+{
+    return submit_poll(st, HA_PRIO_RESYNC, 0);
+}
 
-    if (lvgl_port_lock(100)) {
-        ui_update_cover_state(entity_id, position);
-        lvgl_port_unlock();
-    }
+void ha_poll_after_command(const entity_state_t *st)
+{
+    if (!s_poll_task) return;
+    poll_sched_boost(entity_model_index(st), esp_timer_get_time());
+    xTaskNotifyGive(s_poll_task);   // its deadline may now be the earliest
+}
+
+// ---- State source ----
+
+static void on_mqtt_link(bool up)
+{
+    ESP_LOGI(TAG, "MQTT %s, state via %s", up ? "up" : "down", mqtt_active() ? "MQTT" : "REST polling");
+    if (s_poll_task) xTaskNotifyGive(s_poll_task);
+}
+
+static void on_gateway_link(bool up)
+{
+    ESP_LOGI(TAG, "Gateway %s, state via %s", up ? "up" : "down", push_active() ? "gateway" : "REST polling");
+    if (s_poll_task) xTaskNotifyGive(s_poll_task);
+}
+
+esp_err_t ha_set_source(ha_source_t source)
+{
+    if (source == HA_SOURCE_MQTT && !s_mqtt_ready) return ESP_ERR_NOT_SUPPORTED;
+    if (source == HA_SOURCE_GATEWAY && !s_gateway_ready) return ESP_ERR_NOT_SUPPORTED;
+    if (source == HA_SOURCE_TEMPLATE && !s_template) return ESP_ERR_NO_MEM;
+    s_source = source;
+    if (s_mqtt_ready && source != HA_SOURCE_MQTT) ha_mqtt_stop();
+    if (s_gateway_ready && source != HA_SOURCE_GATEWAY) ha_gateway_stop();
+    esp_err_t err = ESP_OK;
+    if (source == HA_SOURCE_MQTT) err = ha_mqtt_start();
+    if (source == HA_SOURCE_GATEWAY) err = ha_gateway_start();
+    if (s_poll_task) xTaskNotifyGive(s_poll_task);
+    return err;
+}
+
+ha_source_t ha_get_source(void)
+{
+    return s_source;
+}
+
+bool ha_source_push_active(void)
+{
+    return push_active();
 }
 
 static void ha_poll_task(void *arg)
 {
-    vTaskDelay(pdMS_TO_TICKS(5000));
+    poll_sched_init(entity_model_count(), esp_timer_get_time() + STARTUP_DELAY_MS * 1000LL);
+
     while (1) {
-        poll_light("light.guldlampan");
-        vTaskDelay(pdMS_TO_TICKS(200));
-        poll_light("light.videolampor");
-        vTaskDelay(pdMS_TO_TICKS(200));
-        poll_light("light.iris_golvlampa");
-        vTaskDelay(pdMS_TO_TICKS(200));
-        poll_cover("cover.persienn_arbetsrum");
-        vTaskDelay(pdMS_TO_TICKS(POLL_INTERVAL_MS));
+        // Queue every entity whose deadline passed as background work; the
+        // engine defers it while commands are pending. Entity ids and kinds
+        // are fixed after init, safe to read without the lock. Nothing is
+        // due while state is pushed or an aggregate is in flight;
+        // deadlines that pass in the meantime fire right after.
+        int64_t now = esp_timer_get_time();
+        bool hold = push_active() || atomic_load(&s_agg_state) != AGG_IDLE;
+        int due[ENTITY_MODEL_MAX];
+        int n = hold ? 0 : poll_sched_take_due(now, due, ENTITY_MODEL_MAX);
+        if (n > 0 && s_source == HA_SOURCE_TEMPLATE) {
+            if (submit_aggregate(due, n) != ESP_OK)
+                for (int i = 0; i < n; i++) poll_sched_done(due[i], POLL_NO_DATA, now);
+            hold = true;
+        } else {
+            for (int i = 0; i < n; i++) {
+                if (submit_poll(entity_model_get(due[i]), HA_PRIO_BACKGROUND, portMAX_DELAY) != ESP_OK)
+                    poll_sched_done(due[i], POLL_NO_DATA, now);
+            }
+        }
+
+        // Sleep until the next deadline, a result, a command or a change
+        // of a push link
+        int64_t next = hold ? INT64_MAX : poll_sched_next_us();
+        now = esp_timer_get_time();
+        int64_t wait_ms = next > now ? (next - now) / 1000 + 1 : 0;
+        if (wait_ms > MAX_WAIT_MS) wait_ms = MAX_WAIT_MS;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
+
+        if (atomic_load(&s_agg_state) == AGG_DONE)
+            handle_aggregate();
+        poll_result_t r;
+        while (xQueueReceive(s_results, &r, 0) == pdTRUE)
+            handle_result(&r);
     }
 }
 
 void mqtt_app_init(void)
 {
-    ESP_LOGI(TAG, "Starting HA REST API -> %s", HA_BASE_URL);
-    xTaskCreate(ha_poll_task, "ha_poll", 4096, NULL, 5, NULL);
+    ESP_LOGI(TAG, "Starting HA REST API -> %s", CONFIG_HA_BASE_URL);
+    if (ha_engine_start() != ESP_OK) {
+        ESP_LOGE(TAG, "HA engine failed to start");
+        return;
+    }
+    metrics_register_counter(&m_poll_ok);
+    metrics_register_counter(&m_poll_changed);
+    metrics_register_counter(&m_poll_failed);
+    metrics_register_counter(&m_poll_cancelled);
+    for (int i = 0; i < FMT_COUNT; i++)
+        metrics_register_histogram(&m_parse[i]);
+
+    if (build_template() != ESP_OK && s_source == HA_SOURCE_TEMPLATE)
+        s_source = HA_SOURCE_REST;
+
+    s_results = xQueueCreate(ENTITY_MODEL_MAX + RESYNC_RESULTS, sizeof(poll_result_t));
+    xTaskCreate(ha_poll_task, "ha_poll", 4096, NULL, 5, &s_poll_task);
+
+#ifdef CONFIG_HA_WS_COMMANDS
+    if (ha_ws_start() != ESP_OK)
+        ESP_LOGE(TAG, "WebSocket client failed to start, commands use REST");
+#endif
+
+    entity_push_init();
+    esp_err_t err = ha_mqtt_init(on_mqtt_link);
+    s_mqtt_ready = err == ESP_OK;
+    if (err != ESP_OK && err != ESP_ERR_NOT_SUPPORTED)
+        ESP_LOGE(TAG, "MQTT client init failed: %s", esp_err_to_name(err));
+    err = ha_gateway_init(on_gateway_link);
+    s_gateway_ready = err == ESP_OK;
+    if (err != ESP_OK && err != ESP_ERR_NOT_SUPPORTED)
+        ESP_LOGE(TAG, "Gateway client init failed: %s", esp_err_to_name(err));
+
+    if ((s_source == HA_SOURCE_MQTT || s_source == HA_SOURCE_GATEWAY) && ha_set_source(s_source) != ESP_OK) {
+        ESP_LOGW(TAG, "%s source unavailable, polling over REST", s_source == HA_SOURCE_MQTT ? "MQTT" : "Gateway");
+        s_source = HA_SOURCE_REST;
+    }
 }
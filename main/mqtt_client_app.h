@@ -1,16 +1,54 @@
 #pragma once
+#include "esp_err.h"
+#include "ha_engine.h"
+#include "entity_model.h"
 #include <stdbool.h>
 
 // Initialize HA REST API polling task
 void mqtt_app_init(void);
 
+// Commands are queued as interactive requests and return at once; `done`
+// runs on the engine task with the HTTP status (200 = OK) and gets `ctx`
+// and `tag` back in the request. An error return means nothing was queued
+// and `done` will not be called.
+
 // Simple on/off light
-void mqtt_publish_command(const char *entity_id, const char *payload);
+esp_err_t mqtt_publish_command(const char *entity_id, const char *payload,
+                               ha_done_fn done, void *ctx, uint32_t tag);
 
 // Dimmable + color-temp light (brightness 0-255, color_temp_kelvin 0=unchanged)
-void ha_set_light_with_params(const char *entity_id, bool on, int brightness, int color_temp_kelvin);
+esp_err_t ha_set_light_with_params(const char *entity_id, bool on, int brightness, int color_temp_kelvin,
+                                   ha_done_fn done, void *ctx, uint32_t tag);
 
 // Cover control (position 0=closed, 100=open)
-void ha_cover_open(const char *entity_id);
-void ha_cover_close(const char *entity_id);
-void ha_cover_set_position(const char *entity_id, int position);
+esp_err_t ha_cover_open(const char *entity_id, ha_done_fn done, void *ctx, uint32_t tag);
+esp_err_t ha_cover_close(const char *entity_id, ha_done_fn done, void *ctx, uint32_t tag);
+esp_err_t ha_cover_set_position(const char *entity_id, int position,
+                                ha_done_fn done, void *ctx, uint32_t tag);
+
+// Re-read one entity ahead of background polls, e.g. after a rollback.
+// The result is applied like a poll.
+esp_err_t ha_resync_entity(entity_state_t *st);
+
+// HA acknowledged a command for `st`: poll it fast for a while to catch
+// the state HA settles on
+void ha_poll_after_command(const entity_state_t *st);
+
+// Where entity state comes from. MQTT (HA's mqtt_statestream plus a
+// command topic) is used only while its broker is connected, the panel
+// gateway only while its link is up; REST polling and REST commands cover
+// for them otherwise.
+typedef enum {
+    HA_SOURCE_REST,         // GET /api/states/<entity_id> per due entity
+    HA_SOURCE_TEMPLATE,     // one POST /api/template for all entities
+    HA_SOURCE_MQTT,
+    HA_SOURCE_GATEWAY,      // CBOR deltas from tools/panel_gateway
+} ha_source_t;
+
+// ESP_ERR_NOT_SUPPORTED if MQTT or the gateway is selected but not
+// configured. While a push link is down, state falls back to per-entity GETs.
+esp_err_t   ha_set_source(ha_source_t source);
+ha_source_t ha_get_source(void);
+
+// A push source (MQTT or gateway) is selected and connected
+bool ha_source_push_active(void);
@@ -0,0 +1,50 @@
+/*
+ * Naming LVGL objects in logs
+ *
+ * Objects have no names in LVGL 9.2, so they are described by widget class,
+ * geometry and (for labels) text, which is enough to find them in ui.c.
+ */
+
+#include "obj_debug.h"
+#include "panel_slider.h"
+#include "panel_switch.h"
+#include "panel_icon.h"
+#include <stdio.h>
+
+static const char *kind(const lv_obj_t *obj)
+{
+    const lv_obj_class_t *c = lv_obj_get_class(obj);
+    if (c == &lv_label_class)         return "label";
+    if (c == &panel_slider_class)     return "slider";
+    if (c == &panel_switch_class)     return "switch";
+    if (c == &panel_icon_class)       return "icon";
+    if (c == &lv_image_class)         return "image";
+    if (c == &lv_tileview_class)      return "tileview";
+    if (c == &lv_tileview_tile_class) return "tile";
+    return "obj";
+}
+
+void obj_debug_describe(const lv_obj_t *obj, char *buf, size_t len)
+{
+    lv_area_t c;
+    lv_obj_get_coords(obj, &c);
+    const char *text = lv_obj_check_type(obj, &lv_label_class) ? lv_label_get_text(obj) : NULL;
+    snprintf(buf, len, "%s %ldx%ld at %ld,%ld%s%.24s%s", kind(obj),
+             (long)lv_area_get_width(&c), (long)lv_area_get_height(&c), (long)c.x1, (long)c.y1,
+             text ? " \"" : "", text ? text : "", text ? "\"" : "");
+}
+
+lv_obj_t *obj_debug_find_owner(lv_obj_t *root, const lv_area_t *a)
+{
+    if (!root || lv_obj_has_flag(root, LV_OBJ_FLAG_HIDDEN)) return NULL;
+    lv_area_t c;
+    lv_obj_get_coords(root, &c);
+    if (a->x1 < c.x1 || a->y1 < c.y1 || a->x2 > c.x2 || a->y2 > c.y2) return NULL;
+    uint32_t n = lv_obj_get_child_count(root);
+    // Last child is drawn on top
+    for (uint32_t i = n; i-- > 0;) {
+        lv_obj_t *owner = obj_debug_find_owner(lv_obj_get_child(root, i), a);
+        if (owner) return owner;
+    }
+    return root;
+}
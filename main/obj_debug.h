@@ -0,0 +1,16 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stddef.h>
+
+/*
+ * Naming LVGL objects in logs and dumps (slow-frame log, heat map).
+ * LVGL only, so it builds for the host simulator as well.
+ */
+
+// e.g. `label 120x24 at 32,410 "Ljusstyrka"`: kind, size, position and,
+// for labels, the start of the text
+void obj_debug_describe(const lv_obj_t *obj, char *buf, size_t len);
+
+// Innermost visible object under `root` whose area contains `a`, or NULL
+lv_obj_t *obj_debug_find_owner(lv_obj_t *root, const lv_area_t *a);
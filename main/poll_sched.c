@@ -0,0 +1,134 @@
+/*
+ * Adaptive per-entity poll scheduling
+ *
+ *   command acknowledged -> settle window, then every FAST_MS for WINDOW_MS
+ *   cover moving         -> every FAST_MS until it stops
+ *   poll found a change  -> interval = BASE_MS
+ *   poll found nothing   -> interval doubles, up to MAX_MS
+ *
+ * Every deadline is jittered by +-20 %, so a fleet of panels started
+ * together does not keep hitting HA in the same instant.
+ *
+ * Staleness: when a poll finds a change, the change happened at some
+ * point since the previous poll of that entity started. That interval is
+ * the upper bound on how long the UI showed the old state and is exported
+ * as ha_poll_staleness_ms; divide ha_requests_ok_total by uptime for the
+ * request rate it was bought with.
+ */
+
+#include "poll_sched.h"
+#include "entity_model.h"
+#include "metrics.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+
+#define BASE_MS   CONFIG_HA_POLL_BASE_MS
+#define MAX_MS    CONFIG_HA_POLL_MAX_MS
+#define FAST_MS   CONFIG_HA_POLL_FAST_MS
+#define WINDOW_MS CONFIG_HA_POLL_FAST_WINDOW_MS
+
+typedef struct {
+    int64_t  next_us;
+    int64_t  started_us;        // when the current/last poll was taken
+    int64_t  prev_started_us;   // the poll before that, 0 if none
+    int64_t  fast_until_us;
+    uint32_t interval_ms;
+    bool     in_flight;
+} sched_entry_t;
+
+static sched_entry_t s_entries[ENTITY_MODEL_MAX];
+static int           s_count;
+static portMUX_TYPE  s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static const uint32_t s_staleness_bounds[] = { 500, 1000, 2500, 5000, 10000, 30000, 60000, 120000, 300000 };
+
+static metrics_histogram_t m_staleness = METRICS_HISTOGRAM_INIT("ha_poll_staleness_ms", "Upper bound on how long a changed entity showed its old state (ms)", s_staleness_bounds);
+
+static uint32_t jitter(uint32_t ms)
+{
+    uint32_t spread = ms / 5;
+    return ms - spread + esp_random() % (2 * spread + 1);
+}
+
+void poll_sched_init(int count, int64_t now)
+{
+    s_count = count;
+    for (int i = 0; i < count; i++) {
+        s_entries[i] = (sched_entry_t){
+            .next_us     = now + (int64_t)(esp_random() % BASE_MS) * 1000,
+            .interval_ms = BASE_MS,
+        };
+    }
+    metrics_register_histogram(&m_staleness);
+}
+
+int poll_sched_take_due(int64_t now, int *out, int max)
+{
+    int n = 0;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < s_count && n < max; i++) {
+        sched_entry_t *e = &s_entries[i];
+        if (e->in_flight || e->next_us > now) continue;
+        e->in_flight       = true;
+        e->prev_started_us = e->started_us;
+        e->started_us      = now;
+        out[n++] = i;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+    return n;
+}
+
+int64_t poll_sched_next_us(void)
+{
+    int64_t next = INT64_MAX;
+    taskENTER_CRITICAL(&s_lock);
+    for (int i = 0; i < s_count; i++)
+        if (!s_entries[i].in_flight && s_entries[i].next_us < next) next = s_entries[i].next_us;
+    taskEXIT_CRITICAL(&s_lock);
+    return next;
+}
+
+void poll_sched_done(int index, poll_outcome_t outcome, int64_t now)
+{
+    if (index < 0 || index >= s_count) return;
+    sched_entry_t *e = &s_entries[index];
+
+    // A change found now happened after the previous poll was sent
+    if (outcome == POLL_CHANGED && e->prev_started_us)
+        metrics_histogram_observe(&m_staleness, (uint32_t)((now - e->prev_started_us) / 1000));
+
+    taskENTER_CRITICAL(&s_lock);
+    bool in_window = now < e->fast_until_us;
+    switch (outcome) {
+    case POLL_UNCHANGED:
+        // No back-off while the user is busy with the entity
+        if (!in_window)
+            e->interval_ms = e->interval_ms * 2 > MAX_MS ? MAX_MS : e->interval_ms * 2;
+        break;
+    case POLL_CHANGED:
+    case POLL_MOVING:
+        e->interval_ms = BASE_MS;
+        break;
+    case POLL_NO_DATA:
+        break;
+    }
+    bool fast = outcome == POLL_MOVING || in_window;
+    e->next_us   = now + (int64_t)jitter(fast ? FAST_MS : e->interval_ms) * 1000;
+    e->in_flight = false;
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+void poll_sched_boost(int index, int64_t now)
+{
+    if (index < 0 || index >= s_count) return;
+    sched_entry_t *e = &s_entries[index];
+
+    taskENTER_CRITICAL(&s_lock);
+    int64_t first = now + ENTITY_MODEL_SETTLE_MS * 1000LL;
+    e->fast_until_us = first + WINDOW_MS * 1000LL;
+    e->interval_ms   = BASE_MS;
+    if (!e->in_flight && e->next_us > first) e->next_us = first;
+    taskEXIT_CRITICAL(&s_lock);
+}
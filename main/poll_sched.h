@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Per-entity poll deadlines.
+ *
+ * Every entity (by entity_model index) has its own poll interval: fast for
+ * a short window after a local command and while a cover is moving,
+ * doubling while polls find nothing new, back to the base interval when
+ * one does. Deadlines are jittered so panels sharing one HA drift apart.
+ */
+
+typedef enum {
+    POLL_UNCHANGED,     // state as before: back off
+    POLL_CHANGED,       // state differs: base interval
+    POLL_MOVING,        // cover in motion: fast interval
+    POLL_NO_DATA,       // failed, cancelled or stale: keep the interval
+} poll_outcome_t;
+
+// First polls are spread over one base interval after `now`
+void poll_sched_init(int count, int64_t now);
+
+// Fill `out` with up to `max` entities whose deadline has passed and mark
+// them in flight. Returns the number written. Poll task only.
+int poll_sched_take_due(int64_t now, int *out, int max);
+
+// Earliest deadline of the entities not in flight (esp_timer time)
+int64_t poll_sched_next_us(void);
+
+// Schedule the next poll of an in-flight entity. Poll task only.
+void poll_sched_done(int index, poll_outcome_t outcome, int64_t now);
+
+// A local command for `index` was acknowledged: poll fast once its result
+// can no longer be discarded as stale. Any task.
+void poll_sched_boost(int index, int64_t now);
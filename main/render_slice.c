@@ -0,0 +1,251 @@
+/*
+ * Render time slicing and slow-frame log
+ *
+ * A full-screen redraw is a single dirty area, and LVGL renders each area in
+ * one go. The draw threads keep both cores busy until it is done, and
+ * nothing below their priority runs meanwhile, including the idle tasks the
+ * task watchdog checks.
+ *
+ * Slicing cuts tall areas into bands as they are invalidated
+ * (LV_EVENT_INVALIDATE_AREA). Band height comes from the measured cost per
+ * pixel, so one band renders in about half of PANEL_RENDER_SLICE_MS. Direct
+ * mode renders and flushes every band on its own. After a flush
+ * (LV_EVENT_FLUSH_FINISH), the rendering task sleeps for a tick if the next
+ * band would take the stretch past the budget. The draw threads have nothing
+ * queued during that tick, so every lower-priority task gets the CPU. The
+ * panel still shows whole frames, because it only flips on the last flush.
+ *
+ * Frames over PANEL_RENDER_SLOW_FRAME_MS are logged with the areas that were
+ * invalidated for them and the innermost visible objects under those areas,
+ * at most once per SLOW_LOG_INTERVAL_MS.
+ */
+
+#include "render_slice.h"
+#include "obj_debug.h"
+#include "metrics.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <stdatomic.h>
+
+static const char *TAG = "render_slice";
+
+#define SLICE_US             (CONFIG_PANEL_RENDER_SLICE_MS * 1000)
+#define SLOW_FRAME_US        (CONFIG_PANEL_RENDER_SLOW_FRAME_MS * 1000)
+#define MIN_BAND_ROWS        16
+#define MAX_BANDS            16     // per area; LVGL keeps 32 dirty areas
+#define MIN_SAMPLE_PX        4096   // smaller bands are mostly per-area overhead
+#define MAX_LOG_AREAS        4
+#define MAX_LOG_OBJECTS      12
+#define SLOW_LOG_INTERVAL_MS 5000
+
+// ---- Metrics ----
+
+static const uint32_t s_slice_bounds[] = { 5, 10, 20, 33, 50, 100, 250, 500, 1000, 5000 };
+
+static metrics_histogram_t m_slice_ms = METRICS_HISTOGRAM_INIT("ui_render_slice_ms",
+    "Longest stretch of rendering without a yield, per frame (ms)", s_slice_bounds);
+static metrics_counter_t   m_slow     = METRICS_COUNTER_INIT("ui_slow_frames_total",
+    "Frames over PANEL_RENDER_SLOW_FRAME_MS");
+
+// ---- State (LVGL task) ----
+
+typedef struct {
+    lv_area_t area[MAX_LOG_AREAS];
+    int       n;        // invalidations, may exceed MAX_LOG_AREAS
+} area_log_t;
+
+#ifdef CONFIG_PANEL_RENDER_SLICE
+static atomic_bool s_enabled = true;
+#else
+static atomic_bool s_enabled = false;
+#endif
+static bool       s_splitting;
+static uint32_t   s_ns_per_px = 200;    // until measured: ~75 ms per full screen
+static area_log_t s_pending;            // invalidated since the last frame
+static area_log_t s_frame;              // what the current frame renders
+
+static int64_t  s_frame_start_us;
+static int64_t  s_band_start_us;
+static int64_t  s_yield_us;             // last yield (or frame start)
+static uint32_t s_last_band_us;
+static uint32_t s_frame_max_us;         // longest stretch this frame
+static uint32_t s_max_us;               // since render_slice_take_max_us()
+static int64_t  s_last_log_us;
+static uint32_t s_suppressed;
+
+// ---- Splitting ----
+
+static int32_t band_rows(const lv_area_t *a)
+{
+    int32_t w = lv_area_get_width(a);
+    int32_t h = lv_area_get_height(a);
+    int32_t rows = (int32_t)((uint64_t)SLICE_US * 1000 / 2 / s_ns_per_px / w);
+    if (rows < MIN_BAND_ROWS) rows = MIN_BAND_ROWS;
+    if (rows * MAX_BANDS < h) rows = (h + MAX_BANDS - 1) / MAX_BANDS;
+    return rows;
+}
+
+static void invalidate_cb(lv_event_t *e)
+{
+    if (s_splitting) return;   // one of our own bands
+    lv_area_t *a = lv_event_get_param(e);
+    if (s_pending.n < MAX_LOG_AREAS) s_pending.area[s_pending.n] = *a;
+    s_pending.n++;
+    if (!s_enabled) return;
+
+    int32_t rows = band_rows(a);
+    if (lv_area_get_height(a) <= rows) return;
+
+    // Queue the lower bands, then let LVGL add the first one in place of `a`
+    lv_display_t *disp = lv_event_get_target(e);
+    s_splitting = true;
+    for (int32_t y = a->y1 + rows; y <= a->y2; y += rows) {
+        lv_area_t band = { a->x1, y, a->x2, y + rows - 1 < a->y2 ? y + rows - 1 : a->y2 };
+        lv_inv_area(disp, &band);
+    }
+    s_splitting = false;
+    a->y2 = a->y1 + rows - 1;
+}
+
+// ---- Frame timing ----
+
+static void note_stretch(int64_t now)
+{
+    uint32_t us = (uint32_t)(now - s_yield_us);
+    if (us > s_frame_max_us) s_frame_max_us = us;
+}
+
+static void flush_start_cb(lv_event_t *e)
+{
+    const lv_area_t *a = lv_event_get_param(e);
+    int64_t now = esp_timer_get_time();
+    s_last_band_us = (uint32_t)(now - s_band_start_us);
+    uint32_t px = a ? (uint32_t)lv_area_get_size(a) : 0;
+    if (px >= MIN_SAMPLE_PX) {
+        uint32_t ns = (uint32_t)((uint64_t)s_last_band_us * 1000 / px);
+        s_ns_per_px = (3 * s_ns_per_px + (ns ? ns : 1)) / 4;
+    }
+}
+
+static void flush_finish_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+    lv_display_t *disp = lv_event_get_target(e);
+    if (s_enabled && !lv_display_flush_is_last(disp) &&
+        now - s_yield_us + s_last_band_us > SLICE_US) {
+        note_stretch(now);
+        vTaskDelay(1);
+        now = esp_timer_get_time();
+        s_yield_us = now;
+    }
+    s_band_start_us = now;
+}
+
+static void render_start_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+    s_frame_start_us = s_band_start_us = s_yield_us = now;
+    s_frame_max_us = 0;
+    s_frame = s_pending;
+    s_pending.n = 0;
+}
+
+// ---- Slow-frame log ----
+
+static bool overlaps(const lv_area_t *a, const lv_area_t *b)
+{
+    return a->x1 <= b->x2 && b->x1 <= a->x2 && a->y1 <= b->y2 && b->y1 <= a->y2;
+}
+
+// Log the innermost visible objects over `a`; returns how many were logged
+static int log_objects(lv_obj_t *obj, const lv_area_t *a, int budget)
+{
+    if (budget <= 0 || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return 0;
+    lv_area_t c;
+    lv_obj_get_coords(obj, &c);
+    if (!overlaps(&c, a)) return 0;
+
+    int logged = 0;
+    uint32_t n = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < n && logged < budget; i++)
+        logged += log_objects(lv_obj_get_child(obj, i), a, budget - logged);
+    if (logged) return logged;
+
+    char desc[80];
+    obj_debug_describe(obj, desc, sizeof(desc));
+    ESP_LOGW(TAG, "    %s", desc);
+    return 1;
+}
+
+static void log_slow_frame(lv_display_t *disp, uint32_t frame_us)
+{
+    int64_t now = esp_timer_get_time();
+    if (s_last_log_us && now - s_last_log_us < SLOW_LOG_INTERVAL_MS * 1000LL) {
+        s_suppressed++;
+        return;
+    }
+    s_last_log_us = now;
+
+    ESP_LOGW(TAG, "Slow frame: %lu ms (budget %d), longest stretch %lu ms, %d dirty area(s), %lu not logged since last",
+             (unsigned long)(frame_us / 1000), CONFIG_PANEL_RENDER_SLOW_FRAME_MS,
+             (unsigned long)(s_frame_max_us / 1000), s_frame.n, (unsigned long)s_suppressed);
+    s_suppressed = 0;
+
+    lv_obj_t *layers[] = { lv_display_get_screen_active(disp), lv_display_get_layer_top(disp) };
+    int logged = 0;
+    for (int i = 0; i < s_frame.n && i < MAX_LOG_AREAS; i++) {
+        const lv_area_t *a = &s_frame.area[i];
+        ESP_LOGW(TAG, "  area %ldx%ld at %ld,%ld", (long)lv_area_get_width(a), (long)lv_area_get_height(a),
+                 (long)a->x1, (long)a->y1);
+        for (int l = 0; l < 2 && logged < MAX_LOG_OBJECTS; l++)
+            if (layers[l]) logged += log_objects(layers[l], a, MAX_LOG_OBJECTS - logged);
+    }
+}
+
+static void render_ready_cb(lv_event_t *e)
+{
+    int64_t now = esp_timer_get_time();
+    note_stretch(now);
+    if (s_frame_max_us > s_max_us) s_max_us = s_frame_max_us;
+    metrics_histogram_observe(&m_slice_ms, s_frame_max_us / 1000);
+
+    uint32_t frame_us = (uint32_t)(now - s_frame_start_us);
+    if (frame_us > SLOW_FRAME_US) {
+        metrics_counter_inc(&m_slow);
+        log_slow_frame(lv_event_get_target(e), frame_us);
+    }
+}
+
+// ---- Public API ----
+
+void render_slice_set_enabled(bool on)
+{
+    s_enabled = on;
+}
+
+bool render_slice_enabled(void)
+{
+    return s_enabled;
+}
+
+uint32_t render_slice_take_max_us(void)
+{
+    uint32_t us = s_max_us;
+    s_max_us = 0;
+    return us;
+}
+
+void render_slice_init(lv_display_t *display)
+{
+    metrics_register_histogram(&m_slice_ms);
+    metrics_register_counter(&m_slow);
+
+    lv_display_add_event_cb(display, invalidate_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(display, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_display_add_event_cb(display, flush_finish_cb, LV_EVENT_FLUSH_FINISH, NULL);
+    lv_display_add_event_cb(display, render_ready_cb, LV_EVENT_RENDER_READY, NULL);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Render time slicing and slow-frame log.
+ *
+ * Tall dirty areas are cut into bands that render in about half of
+ * PANEL_RENDER_SLICE_MS each, and the rendering task sleeps for a tick
+ * between bands once the budget is used up. Frames slower than
+ * PANEL_RENDER_SLOW_FRAME_MS are logged with their dirty areas and objects.
+ */
+
+// Hook the display's invalidate/render/flush events. Must be called with
+// the LVGL port lock held.
+void render_slice_init(lv_display_t *display);
+
+// Off: dirty areas are rendered whole, as LVGL does by default
+void render_slice_set_enabled(bool on);
+bool render_slice_enabled(void);
+
+// Longest stretch of rendering without a yield since the last call (us)
+uint32_t render_slice_take_max_us(void);
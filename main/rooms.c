@@ -0,0 +1,64 @@
+/*
+ * Room configuration
+ *
+ * One entry per room page. Entities may appear in several rooms; state is
+ * kept once per entity id in entity_model.c.
+ *
+ * The ICON_* names used here select what tools/icons/iconpack.py packs
+ * into the icon atlas at build time; each needs tools/icons/svg/<name>.svg.
+ */
+
+#include "rooms.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+
+#define ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+static const entity_cfg_t arbetsrum[] = {
+    { "light.guldlampan",         "Guldlampan",  ENTITY_LIGHT_ONOFF,    ICON_LIGHTBULB  },
+    { "light.videolampor",        "Videolampor", ENTITY_LIGHT_CT,       ICON_LIGHTBULB  },
+    { "light.iris_golvlampa",     "Iris",        ENTITY_LIGHT_DIMMABLE, ICON_FLOOR_LAMP },
+    { "cover.persienn_arbetsrum", "Solskydd",    ENTITY_COVER,          ICON_BLINDS     },
+};
+
+static const room_cfg_t s_rooms[] = {
+    { "Arbetsrum", arbetsrum, ARRAY_LEN(arbetsrum) },
+};
+
+#define DEMO_ROOMS CONFIG_PANEL_UI_DEMO_ROOMS
+#define MAX_ROOMS  (ARRAY_LEN(s_rooms) + DEMO_ROOMS)
+
+static const room_cfg_t *s_table[MAX_ROOMS];
+static int               s_count;
+
+#if DEMO_ROOMS > 0
+// Synthetic rooms reusing the first room's entities, for memory/build-time tests
+static room_cfg_t s_demo[DEMO_ROOMS];
+static char       s_demo_names[DEMO_ROOMS][12];
+#endif
+
+void rooms_init(void)
+{
+    s_count = 0;
+    for (int i = 0; i < (int)ARRAY_LEN(s_rooms); i++)
+        s_table[s_count++] = &s_rooms[i];
+
+#if DEMO_ROOMS > 0
+    for (int i = 0; i < DEMO_ROOMS; i++) {
+        snprintf(s_demo_names[i], sizeof(s_demo_names[i]), "Rum %d", i + 2);
+        s_demo[i] = s_rooms[0];
+        s_demo[i].name = s_demo_names[i];
+        s_table[s_count++] = &s_demo[i];
+    }
+#endif
+}
+
+int rooms_count(void)
+{
+    return s_count;
+}
+
+const room_cfg_t *rooms_get(int index)
+{
+    return (index >= 0 && index < s_count) ? s_table[index] : NULL;
+}
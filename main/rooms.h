@@ -0,0 +1,30 @@
+#pragma once
+
+#include "icons.h"     // generated from the ICON_* names used in rooms.c
+#include <stdint.h>
+
+typedef enum {
+    ENTITY_LIGHT_ONOFF,     // toggle
+    ENTITY_LIGHT_DIMMABLE,  // toggle + brightness
+    ENTITY_LIGHT_CT,        // toggle + brightness + color temperature
+    ENTITY_COVER,           // position slider 0-100
+} entity_kind_t;
+
+typedef struct {
+    const char   *entity_id;
+    const char   *name;
+    entity_kind_t kind;
+    icon_id_t     icon;     // ICON_NONE for no icon
+} entity_cfg_t;
+
+typedef struct {
+    const char         *name;
+    const entity_cfg_t *entities;
+    uint8_t             num_entities;
+} room_cfg_t;
+
+// Build the room table (adds synthetic demo rooms if configured)
+void rooms_init(void);
+
+int               rooms_count(void);
+const room_cfg_t *rooms_get(int index);
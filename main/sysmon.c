@@ -0,0 +1,470 @@
+/*
+ * System monitor
+ *
+ * Feeds the metrics registry with:
+ * - Heap split: internal RAM vs PSRAM (free, low-water, largest block)
+ * - LVGL: frames rendered, render time histogram, FPS, LVGL heap use
+ * - Per-task CPU share and stack high-water marks (task table)
+ *
+ * Frame timing hooks the display's RENDER_START/RENDER_READY events, so the
+ * cost per frame is two esp_timer reads. FLUSH_START adds up the pixels
+ * rendered per frame. Layout is timed by running LVGL's
+ * layout update at REFR_START ourselves; the update LVGL does right after
+ * then finds nothing left to do. Task sampling runs once per period
+ * from an esp_timer callback. The optional overlay is a single label on the
+ * top layer, refreshed from the same LVGL timer that computes FPS.
+ *
+ * sysmon_bench() drives frames from the console for comparing render
+ * configurations (e.g. LV_DRAW_SW_DRAW_UNIT_CNT 1 vs 2) on the device.
+ * The icon benchmarks put a 60-icon dashboard on the top layer for their
+ * duration, drawn either from the icon atlas or as one image per icon.
+ */
+
+#include "sysmon.h"
+#include "panel_slider.h"
+#include "panel_icon.h"
+#include "theme.h"
+#include "font_cache.h"
+#include "metrics.h"
+#include "fonts.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_lvgl_port.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "sysmon";
+
+#define SAMPLE_PERIOD_MS CONFIG_PANEL_SYSMON_PERIOD_MS
+
+// ---- Metrics ----
+
+static const uint32_t s_render_bounds[] = { 2, 5, 10, 16, 33, 50, 100, 250, 500, 1000, 5000 };
+static const uint32_t s_layout_bounds[] = { 10, 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+static metrics_counter_t   m_frames       = METRICS_COUNTER_INIT("ui_frames_total", "Frames rendered by LVGL");
+static metrics_histogram_t m_render_ms    = METRICS_HISTOGRAM_INIT("ui_render_ms", "LVGL render time per frame (ms)", s_render_bounds);
+static metrics_gauge_t     m_fps          = METRICS_GAUGE_INIT("ui_fps", "Frames rendered during the last second");
+static metrics_gauge_t     m_render_last  = METRICS_GAUGE_INIT("ui_render_last_us", "Render time of the last frame (us)");
+static metrics_histogram_t m_layout_us    = METRICS_HISTOGRAM_INIT("ui_layout_us", "Layout update before a rendered frame (us)", s_layout_bounds);
+static metrics_gauge_t     m_layout_last  = METRICS_GAUGE_INIT("ui_layout_last_us", "Layout update before the last frame (us)");
+static metrics_gauge_t     m_render_px    = METRICS_GAUGE_INIT("ui_render_last_px", "Pixels rendered in the last frame");
+static metrics_gauge_t     m_lv_mem_used  = METRICS_GAUGE_INIT("lvgl_mem_used_bytes", "LVGL heap in use");
+static metrics_gauge_t     m_lv_mem_peak  = METRICS_GAUGE_INIT("lvgl_mem_peak_bytes", "LVGL heap high-water mark");
+static metrics_gauge_t     m_lv_mem_frag  = METRICS_GAUGE_INIT("lvgl_mem_frag_pct", "LVGL heap fragmentation");
+static metrics_gauge_t     m_int_free     = METRICS_GAUGE_INIT("heap_internal_free_bytes", "Free internal RAM");
+static metrics_gauge_t     m_int_min      = METRICS_GAUGE_INIT("heap_internal_min_free_bytes", "Internal RAM low-water mark");
+static metrics_gauge_t     m_int_largest  = METRICS_GAUGE_INIT("heap_internal_largest_block_bytes", "Largest free internal block");
+static metrics_gauge_t     m_psram_free   = METRICS_GAUGE_INIT("heap_psram_free_bytes", "Free PSRAM");
+static metrics_gauge_t     m_psram_min    = METRICS_GAUGE_INIT("heap_psram_min_free_bytes", "PSRAM low-water mark");
+
+// ---- Task sampling ----
+
+static TaskStatus_t               s_status[SYSMON_MAX_TASKS];
+static TaskHandle_t               s_prev_handle[SYSMON_MAX_TASKS];
+static configRUN_TIME_COUNTER_TYPE s_prev_runtime[SYSMON_MAX_TASKS];
+static int                        s_prev_count;
+static configRUN_TIME_COUNTER_TYPE s_prev_total;
+
+static sysmon_task_stat_t s_tasks[SYSMON_MAX_TASKS];
+static int                s_task_count;
+static portMUX_TYPE       s_tasks_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static configRUN_TIME_COUNTER_TYPE prev_runtime_of(TaskHandle_t h)
+{
+    for (int i = 0; i < s_prev_count; i++)
+        if (s_prev_handle[i] == h) return s_prev_runtime[i];
+    return 0;
+}
+
+static void sample_tasks(void)
+{
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY && CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t n = uxTaskGetSystemState(s_status, SYSMON_MAX_TASKS, &total);
+    if (n == 0) {
+        // More tasks than slots: FreeRTOS fills in nothing
+        static bool warned;
+        if (!warned) {
+            ESP_LOGW(TAG, "%u tasks, task table holds %d; raise SYSMON_MAX_TASKS",
+                     (unsigned)uxTaskGetNumberOfTasks(), SYSMON_MAX_TASKS);
+            warned = true;
+        }
+        return;
+    }
+
+    configRUN_TIME_COUNTER_TYPE elapsed = (total - s_prev_total) * portNUM_PROCESSORS;
+    static sysmon_task_stat_t snap[SYSMON_MAX_TASKS];   // off the esp_timer task's stack
+    for (UBaseType_t i = 0; i < n; i++) {
+        const TaskStatus_t *t = &s_status[i];
+        configRUN_TIME_COUNTER_TYPE delta = t->ulRunTimeCounter - prev_runtime_of(t->xHandle);
+        strlcpy(snap[i].name, t->pcTaskName, sizeof(snap[i].name));
+        snap[i].cpu_pct    = elapsed ? (uint8_t)((delta * 100) / elapsed) : 0;
+        snap[i].stack_free = t->usStackHighWaterMark;
+        snap[i].prio       = (uint8_t)t->uxCurrentPriority;
+    }
+    for (UBaseType_t i = 0; i < n; i++) {
+        s_prev_handle[i]  = s_status[i].xHandle;
+        s_prev_runtime[i] = s_status[i].ulRunTimeCounter;
+    }
+    s_prev_count = n;
+    s_prev_total = total;
+
+    taskENTER_CRITICAL(&s_tasks_lock);
+    memcpy(s_tasks, snap, n * sizeof(snap[0]));
+    s_task_count = n;
+    taskEXIT_CRITICAL(&s_tasks_lock);
+#endif
+}
+
+static void sample_heap(void)
+{
+    metrics_gauge_set(&m_int_free,    heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    metrics_gauge_set(&m_int_min,     heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    metrics_gauge_set(&m_int_largest, heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    metrics_gauge_set(&m_psram_free,  heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    metrics_gauge_set(&m_psram_min,   heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+}
+
+static void sample_timer_cb(void *arg)
+{
+    sample_tasks();
+}
+
+int sysmon_get_tasks(sysmon_task_stat_t *out, int max)
+{
+    taskENTER_CRITICAL(&s_tasks_lock);
+    int n = s_task_count < max ? s_task_count : max;
+    memcpy(out, s_tasks, n * sizeof(out[0]));
+    taskEXIT_CRITICAL(&s_tasks_lock);
+    return n;
+}
+
+void sysmon_dump_tasks(void)
+{
+    static sysmon_task_stat_t tasks[SYSMON_MAX_TASKS];
+    int n = sysmon_get_tasks(tasks, SYSMON_MAX_TASKS);
+    if (n == 0) {
+        printf("No task stats (enable FREERTOS_GENERATE_RUN_TIME_STATS)\n");
+        return;
+    }
+    printf("%-16s %4s %5s %10s\n", "task", "prio", "cpu%", "stack_free");
+    for (int i = 0; i < n; i++)
+        printf("%-16s %4u %5u %10lu\n", tasks[i].name, tasks[i].prio,
+               tasks[i].cpu_pct, (unsigned long)tasks[i].stack_free);
+}
+
+// ---- LVGL frame hooks (LVGL task) ----
+
+static lv_display_t *s_display;
+static int64_t   s_render_start_us;
+static uint32_t  s_layout_us;       // measured at the last REFR_START
+static uint32_t  s_frame_px;
+static uint32_t  s_frames_at_last_tick;
+static lv_obj_t *s_overlay;
+static const metrics_gauge_t *s_rtt_gauge;
+
+static void refr_start_cb(lv_event_t *e)
+{
+    int64_t t0 = esp_timer_get_time();
+    lv_obj_t *screen = lv_display_get_screen_active(s_display);
+    if (screen) lv_obj_update_layout(screen);
+    lv_obj_update_layout(lv_display_get_layer_top(s_display));
+    s_layout_us = (uint32_t)(esp_timer_get_time() - t0);
+}
+
+static void render_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        // Refreshes that render nothing are not counted
+        metrics_histogram_observe(&m_layout_us, s_layout_us);
+        metrics_gauge_set(&m_layout_last, (int32_t)s_layout_us);
+        s_render_start_us = esp_timer_get_time();
+        s_frame_px = 0;
+        return;
+    }
+    int64_t dt = esp_timer_get_time() - s_render_start_us;
+    metrics_counter_inc(&m_frames);
+    metrics_gauge_set(&m_render_last, (int32_t)dt);
+    metrics_gauge_set(&m_render_px, (int32_t)s_frame_px);
+    metrics_histogram_observe(&m_render_ms, (uint32_t)(dt / 1000));
+}
+
+static void flush_start_cb(lv_event_t *e)
+{
+    const lv_area_t *a = lv_event_get_param(e);
+    if (a) s_frame_px += (uint32_t)lv_area_get_size(a);
+}
+
+static void update_overlay(void)
+{
+    if (!s_rtt_gauge) s_rtt_gauge = metrics_find_gauge("ha_http_rtt_ms");
+
+    lv_label_set_text_fmt(s_overlay,
+        "%d fps  %d.%d ms\nint %dK  psram %dK\nlvgl %dK  rtt %d ms",
+        (int)atomic_load(&m_fps.value),
+        (int)(atomic_load(&m_render_last.value) / 1000),
+        (int)(atomic_load(&m_render_last.value) / 100 % 10),
+        (int)(atomic_load(&m_int_free.value) / 1024),
+        (int)(atomic_load(&m_psram_free.value) / 1024),
+        (int)(atomic_load(&m_lv_mem_used.value) / 1024),
+        s_rtt_gauge ? (int)atomic_load(&s_rtt_gauge->value) : -1);
+}
+
+static void tick_timer_cb(lv_timer_t *t)
+{
+    uint32_t frames = atomic_load(&m_frames.value);
+    metrics_gauge_set(&m_fps, (int32_t)(frames - s_frames_at_last_tick));
+    s_frames_at_last_tick = frames;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    metrics_gauge_set(&m_lv_mem_used, (int32_t)(mon.total_size - mon.free_size));
+    metrics_gauge_set(&m_lv_mem_peak, (int32_t)mon.max_used);
+    metrics_gauge_set(&m_lv_mem_frag, mon.frag_pct);
+
+    sample_heap();
+
+    if (s_overlay && !lv_obj_has_flag(s_overlay, LV_OBJ_FLAG_HIDDEN))
+        update_overlay();
+}
+
+void sysmon_set_overlay(bool visible)
+{
+    if (!s_overlay) {
+        if (!visible) return;
+        s_overlay = lv_label_create(lv_layer_top());
+        lv_obj_set_style_text_font(s_overlay, font_cache_get(&font_sv_16), 0);
+        lv_obj_set_style_text_color(s_overlay, lv_color_hex(0xA6E3A1), 0);
+        lv_obj_set_style_bg_color(s_overlay, lv_color_hex(0x11111B), 0);
+        lv_obj_set_style_bg_opa(s_overlay, LV_OPA_70, 0);
+        lv_obj_set_style_pad_all(s_overlay, 4, 0);
+        lv_obj_align(s_overlay, LV_ALIGN_TOP_LEFT, 4, 4);
+        lv_obj_remove_flag(s_overlay, LV_OBJ_FLAG_CLICKABLE);
+    }
+    if (visible) {
+        lv_obj_remove_flag(s_overlay, LV_OBJ_FLAG_HIDDEN);
+        update_overlay();
+    } else {
+        lv_obj_add_flag(s_overlay, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// ---- Render benchmark (console task) ----
+
+static lv_obj_t *find_slider(lv_obj_t *obj)
+{
+    if (lv_obj_check_type(obj, &panel_slider_class) && lv_obj_is_visible(obj)) return obj;
+    uint32_t n = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < n; i++) {
+        lv_obj_t *s = find_slider(lv_obj_get_child(obj, i));
+        if (s) return s;
+    }
+    return NULL;
+}
+
+// First visible label showing a value such as "42%" or "4000K"
+static lv_obj_t *find_value_label(lv_obj_t *obj)
+{
+    if (lv_obj_check_type(obj, &lv_label_class) && lv_obj_is_visible(obj)) {
+        const char *t = lv_label_get_text(obj);
+        if (t && ((t[0] >= '0' && t[0] <= '9') || t[0] == '-')) return obj;
+    }
+    uint32_t n = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < n; i++) {
+        lv_obj_t *l = find_value_label(lv_obj_get_child(obj, i));
+        if (l) return l;
+    }
+    return NULL;
+}
+
+// Icon dashboard: BENCH_ICONS icons in rows of BENCH_ICON_COLS, cycling
+// through the configured icons
+#define BENCH_ICONS      60
+#define BENCH_ICON_COLS  10
+#define BENCH_ICON_PITCH 44
+
+static lv_obj_t       *s_icon_grid;
+static lv_image_dsc_t *s_icon_imgs;     // per-icon copies for SYSMON_BENCH_ICON_IMAGES
+
+static void icon_grid_delete(void)
+{
+    if (s_icon_grid) lv_obj_delete(s_icon_grid);
+    s_icon_grid = NULL;
+    if (!s_icon_imgs) return;
+    for (int i = 0; i < BENCH_ICONS; i++)
+        lv_free((void *)s_icon_imgs[i].data);
+    lv_free(s_icon_imgs);
+    s_icon_imgs = NULL;
+}
+
+static lv_obj_t *image_icon_create(lv_obj_t *parent, icon_id_t id, lv_image_dsc_t *img)
+{
+    if (!icon_atlas_to_image(id, img)) return NULL;
+    lv_obj_t *o = lv_image_create(parent);
+    lv_image_set_src(o, img);
+    // The colors theme_apply_icon() gives the atlas icons in the dark theme
+    lv_obj_set_style_image_recolor_opa(o, LV_OPA_COVER, 0);
+    lv_obj_set_style_image_recolor(o, lv_color_hex(0x6C7086), 0);
+    lv_obj_set_style_image_recolor(o, lv_color_hex(0xFABD2F), LV_STATE_CHECKED);
+    return o;
+}
+
+static bool icon_grid_create(bool atlas)
+{
+    if (ICON_COUNT <= 1) return false;
+    if (!atlas) {
+        s_icon_imgs = lv_malloc_zeroed(BENCH_ICONS * sizeof(*s_icon_imgs));
+        if (!s_icon_imgs) return false;
+    }
+    s_icon_grid = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(s_icon_grid);
+    lv_obj_set_size(s_icon_grid, BENCH_ICON_COLS * BENCH_ICON_PITCH,
+                    (BENCH_ICONS / BENCH_ICON_COLS) * BENCH_ICON_PITCH);
+    lv_obj_center(s_icon_grid);
+
+    for (int i = 0; i < BENCH_ICONS; i++) {
+        icon_id_t id = (icon_id_t)(1 + i % (ICON_COUNT - 1));
+        lv_obj_t *o;
+        if (atlas) {
+            o = panel_icon_create(s_icon_grid, id);
+            theme_apply_icon(o);
+        } else {
+            o = image_icon_create(s_icon_grid, id, &s_icon_imgs[i]);
+        }
+        if (!o) {
+            icon_grid_delete();
+            return false;
+        }
+        lv_obj_set_pos(o, (i % BENCH_ICON_COLS) * BENCH_ICON_PITCH,
+                       (i / BENCH_ICON_COLS) * BENCH_ICON_PITCH);
+    }
+    return true;
+}
+
+// One frame of `kind`; false if there is nothing to change
+static bool bench_step(sysmon_bench_t kind, int i)
+{
+    lv_obj_t *screen = lv_display_get_screen_active(s_display);
+    if (kind == SYSMON_BENCH_ICONS || kind == SYSMON_BENCH_ICON_IMAGES) {
+        // Every icon changes tint, as if all entities were switched at once
+        uint32_t n = lv_obj_get_child_count(s_icon_grid);
+        for (uint32_t c = 0; c < n; c++) {
+            lv_obj_t *o = lv_obj_get_child(s_icon_grid, c);
+            if (i % 2) lv_obj_add_state(o, LV_STATE_CHECKED);
+            else       lv_obj_remove_state(o, LV_STATE_CHECKED);
+        }
+        return true;
+    }
+    if (kind == SYSMON_BENCH_REDRAW) {
+        lv_obj_invalidate(screen);
+        return true;
+    }
+    if (kind == SYSMON_BENCH_LABEL) {
+        lv_obj_t *l = find_value_label(screen);
+        if (!l) return false;
+        lv_label_set_text_fmt(l, "%d%%", i % 2 ? 100 : 9);
+        return true;
+    }
+    // Pages are torn down when idle, so look the slider up every frame
+    lv_obj_t *s = find_slider(screen);
+    if (!s) return false;
+    int32_t min = panel_slider_get_min_value(s);
+    int32_t span = panel_slider_get_max_value(s) - min;
+    int32_t step = span / 16 > 0 ? span / 16 : 1;
+    int32_t p = (i * step) % (2 * span);
+    panel_slider_set_value(s, min + (p <= span ? p : 2 * span - p));
+    return true;
+}
+
+bool sysmon_bench(sysmon_bench_t kind, int frames, sysmon_bench_result_t *out)
+{
+    *out = (sysmon_bench_result_t){ .min_us = UINT32_MAX };
+    uint64_t total_us = 0, layout_us = 0, total_px = 0;
+
+    bool icons = kind == SYSMON_BENCH_ICONS || kind == SYSMON_BENCH_ICON_IMAGES;
+    if (icons) {
+        if (!s_display || !lvgl_port_lock(1000)) return false;
+        bool ok = icon_grid_create(kind == SYSMON_BENCH_ICONS);
+        if (ok) lv_refr_now(s_display);     // first draw of the grid is not counted
+        lvgl_port_unlock();
+        if (!ok) return false;
+    }
+
+    for (int i = 0; i < frames && s_display; i++) {
+        if (!lvgl_port_lock(1000)) break;
+        bool ok = bench_step(kind, i);
+        if (ok) lv_refr_now(s_display);
+        uint32_t us = (uint32_t)atomic_load(&m_render_last.value);
+        uint32_t lay = (uint32_t)atomic_load(&m_layout_last.value);
+        uint32_t px = (uint32_t)atomic_load(&m_render_px.value);
+        lvgl_port_unlock();
+        if (!ok) break;
+
+        out->frames++;
+        total_us += us;
+        layout_us += lay;
+        total_px += px;
+        if (lay > out->layout_max_us) out->layout_max_us = lay;
+        if (us < out->min_us) out->min_us = us;
+        if (us > out->max_us) out->max_us = us;
+        // Let the LVGL task and touch input run between frames
+        vTaskDelay(1);
+    }
+    if (icons && lvgl_port_lock(0)) {      // 0: wait as long as it takes
+        icon_grid_delete();
+        lvgl_port_unlock();
+    }
+    if (!out->frames) return false;
+    out->avg_us = (uint32_t)(total_us / out->frames);
+    out->layout_avg_us = (uint32_t)(layout_us / out->frames);
+    out->px_avg = (uint32_t)(total_px / out->frames);
+    return true;
+}
+
+// ---- Init ----
+
+void sysmon_init(lv_display_t *display)
+{
+    s_display = display;
+    metrics_register_counter(&m_frames);
+    metrics_register_histogram(&m_render_ms);
+    metrics_register_gauge(&m_fps);
+    metrics_register_gauge(&m_render_last);
+    metrics_register_histogram(&m_layout_us);
+    metrics_register_gauge(&m_layout_last);
+    metrics_register_gauge(&m_render_px);
+    metrics_register_gauge(&m_lv_mem_used);
+    metrics_register_gauge(&m_lv_mem_peak);
+    metrics_register_gauge(&m_lv_mem_frag);
+    metrics_register_gauge(&m_int_free);
+    metrics_register_gauge(&m_int_min);
+    metrics_register_gauge(&m_int_largest);
+    metrics_register_gauge(&m_psram_free);
+    metrics_register_gauge(&m_psram_min);
+    metrics_add_collector(sample_heap);
+
+    lv_display_add_event_cb(display, refr_start_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(display, render_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(display, render_event_cb, LV_EVENT_RENDER_READY, NULL);
+    lv_display_add_event_cb(display, flush_start_cb, LV_EVENT_FLUSH_START, NULL);
+    lv_timer_create(tick_timer_cb, 1000, NULL);
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = sample_timer_cb,
+        .name = "sysmon",
+    };
+    esp_timer_handle_t timer;
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(timer, SAMPLE_PERIOD_MS * 1000ULL));
+
+#ifdef CONFIG_PANEL_METRICS_OVERLAY
+    sysmon_set_overlay(true);
+#endif
+
+    ESP_LOGI(TAG, "Sampling every %d ms", SAMPLE_PERIOD_MS);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tasks the table can hold. IDF, LVGL, network and panel tasks together run
+// to about 30; a larger count stops sampling (logged once).
+#define SYSMON_MAX_TASKS 48
+
+typedef struct {
+    char     name[16];
+    uint8_t  cpu_pct;       // share of total CPU time (all cores) since last sample
+    uint32_t stack_free;    // stack high-water mark in bytes
+    uint8_t  prio;
+} sysmon_task_stat_t;
+
+// Start heap/task sampling and hook LVGL frame events.
+// Must be called with the LVGL port lock held.
+void sysmon_init(lv_display_t *display);
+
+// Snapshot of the last task sample. Returns number of entries written.
+int sysmon_get_tasks(sysmon_task_stat_t *out, int max);
+
+// Print task table to stdout (serial console).
+void sysmon_dump_tasks(void);
+
+// Show/hide the FPS/heap overlay. Must be called with the LVGL port lock held.
+void sysmon_set_overlay(bool visible);
+
+typedef enum {
+    SYSMON_BENCH_REDRAW,    // invalidate the whole screen every frame
+    SYSMON_BENCH_SLIDER,    // move the first visible slider 1/16 of its range per frame, like a drag
+    SYSMON_BENCH_LABEL,     // change the first visible value label ("9%" / "100%")
+    SYSMON_BENCH_ICONS,     // 60 atlas icons (panel_icon) on the top layer, all retinted per frame
+    SYSMON_BENCH_ICON_IMAGES, // the same 60 icons as lv_image, one A8 image per icon
+} sysmon_bench_t;
+
+typedef struct {
+    int      frames;
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t max_us;
+    uint32_t layout_avg_us;     // layout update before each frame
+    uint32_t layout_max_us;
+    uint32_t px_avg;            // pixels rendered per frame
+} sysmon_bench_result_t;
+
+// Render `frames` frames back to back and report their render time
+// (RENDER_START to RENDER_READY). Takes the LVGL port lock per frame; call
+// from any task but the LVGL task. False if no frame was rendered (e.g. no
+// slider or value label on screen, or no icons configured).
+bool sysmon_bench(sysmon_bench_t kind, int frames, sysmon_bench_result_t *out);
@@ -0,0 +1,340 @@
+/*
+ * Shared UI theme
+ *
+ * Every widget built by ui.c references a handful of shared styles
+ * instead of carrying its own local style list:
+ * - Geometry (padding, radius, sizes, opacity) never changes, so it lives
+ *   in const styles placed in flash (LV_STYLE_CONST_INIT).
+ * - Colors and fonts live in one mutable style per role, re-filled from a
+ *   palette when the theme is switched, followed by a single
+ *   lv_obj_report_style_change(NULL). Fonts are the glyph-cached variants
+ *   from font_cache.c.
+ * - Flex layout is in mutable styles too (flex props have no const form
+ *   we rely on), but they are still shared.
+ * - Value labels ("42%", "4000K") get a fixed box sized from their font for
+ *   the widest value, text right-aligned. A content-sized label would
+ *   make LVGL lay out its row and card again on every update.
+ *
+ * - Entity icons (widgets/panel_icon.c) are tinted with the text color:
+ *   caption color, or the warm accent while the entity is on or open
+ *   (LV_STATE_CHECKED). An entity name grows to fill its row, so the row
+ *   reads icon, name, control.
+ *
+ * - The slider and switch are the panel widgets (widgets/), which LVGL's
+ *   default theme does not style. Their part opacities and knob sizes are
+ *   the values the default theme gave lv_slider and lv_switch (at
+ *   LV_DPI_DEF 130), so the look is unchanged.
+ *
+ * Palettes: Catppuccin Mocha (dark, the original look) and Latte (light).
+ */
+
+#include "theme.h"
+#include "fonts.h"
+#include "font_cache.h"
+#include "esp_log.h"
+
+static const char *TAG = "theme";
+
+typedef struct {
+    uint32_t screen;
+    uint32_t card;
+    uint32_t title;
+    uint32_t name;
+    uint32_t caption;
+    uint32_t value;
+    uint32_t track;
+    uint32_t knob;
+    uint32_t accent[3];   // indexed by theme_accent_t
+} palette_t;
+
+static const palette_t s_palettes[] = {
+    [THEME_DARK] = {
+        .screen = 0x1E1E2E, .card = 0x1E1E2E,
+        .title = 0xCDD6F4, .name = 0xA6ADC8, .caption = 0x6C7086, .value = 0xCDD6F4,
+        .track = 0x45475A, .knob = 0xCDD6F4,
+        .accent = { 0x89B4FA, 0xFABD2F, 0xA6E3A1 },
+    },
+    [THEME_LIGHT] = {
+        .screen = 0xEFF1F5, .card = 0xEFF1F5,
+        .title = 0x4C4F69, .name = 0x5C5F77, .caption = 0x8C8FA1, .value = 0x4C4F69,
+        .track = 0xCCD0DA, .knob = 0x4C4F69,
+        .accent = { 0x1E66F5, 0xDF8E1D, 0x40A02B },
+    },
+};
+
+static theme_id_t s_theme;
+static const lv_font_t *s_font_16, *s_font_18;
+
+// ---- Const geometry styles ----
+
+static const lv_style_const_prop_t s_transparent_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_TRANSP),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_transparent, s_transparent_props);
+
+static const lv_style_const_prop_t s_column_props[] = {
+    LV_STYLE_CONST_WIDTH(480),
+    LV_STYLE_CONST_HEIGHT(800),
+    LV_STYLE_CONST_PAD_TOP(24),
+    LV_STYLE_CONST_PAD_BOTTOM(24),
+    LV_STYLE_CONST_PAD_ROW(16),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_column_geom, s_column_props);
+
+static const lv_style_const_prop_t s_card_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(90)),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PAD_TOP(16),
+    LV_STYLE_CONST_PAD_BOTTOM(16),
+    LV_STYLE_CONST_PAD_LEFT(16),
+    LV_STYLE_CONST_PAD_RIGHT(16),
+    LV_STYLE_CONST_PAD_ROW(10),
+    LV_STYLE_CONST_RADIUS(16),
+    LV_STYLE_CONST_BG_OPA(210),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_card_geom, s_card_props);
+
+static const lv_style_const_prop_t s_row_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_HEIGHT(LV_SIZE_CONTENT),
+    LV_STYLE_CONST_PAD_TOP(4),
+    LV_STYLE_CONST_PAD_BOTTOM(4),
+    LV_STYLE_CONST_PAD_LEFT(4),
+    LV_STYLE_CONST_PAD_RIGHT(4),
+    LV_STYLE_CONST_PAD_COLUMN(8),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_row_geom, s_row_props);
+
+static const lv_style_const_prop_t s_separator_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(100)),
+    LV_STYLE_CONST_HEIGHT(1),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PAD_TOP(0),
+    LV_STYLE_CONST_PAD_BOTTOM(0),
+    LV_STYLE_CONST_PAD_LEFT(0),
+    LV_STYLE_CONST_PAD_RIGHT(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_separator_geom, s_separator_props);
+
+static const lv_style_const_prop_t s_switch_props[] = {
+    LV_STYLE_CONST_WIDTH(50),
+    LV_STYLE_CONST_HEIGHT(26),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_switch_geom, s_switch_props);
+
+static const lv_style_const_prop_t s_switch_knob_props[] = {
+    LV_STYLE_CONST_PAD_TOP(-3),
+    LV_STYLE_CONST_PAD_BOTTOM(-3),
+    LV_STYLE_CONST_PAD_LEFT(-3),
+    LV_STYLE_CONST_PAD_RIGHT(-3),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xFF, 0xFF, 0xFF)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_switch_knob_geom, s_switch_knob_props);
+
+static const lv_style_const_prop_t s_slider_props[] = {
+    LV_STYLE_CONST_WIDTH(LV_PCT(95)),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_slider_geom, s_slider_props);
+
+static const lv_style_const_prop_t s_slider_knob_props[] = {
+    LV_STYLE_CONST_PAD_TOP(5),
+    LV_STYLE_CONST_PAD_BOTTOM(5),
+    LV_STYLE_CONST_PAD_LEFT(5),
+    LV_STYLE_CONST_PAD_RIGHT(5),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_slider_knob_geom, s_slider_knob_props);
+
+static const lv_style_const_prop_t s_opaque_props[] = {
+    LV_STYLE_CONST_BG_OPA(LV_OPA_COVER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(s_opaque, s_opaque_props);
+
+// ---- Shared mutable styles (layout, palette) ----
+
+static lv_style_t s_flex_column;    // bottom-aligned, centered column
+static lv_style_t s_flex_card;      // top-left aligned column
+static lv_style_t s_flex_row;       // space-between row
+static lv_style_t s_flex_grow;      // takes the free space of a row
+static lv_style_t s_value_geom;     // fixed value label box, from the font
+static lv_style_t s_screen_color;
+static lv_style_t s_card_color;
+static lv_style_t s_track_color;    // separator, switch and slider track
+static lv_style_t s_knob_color;
+static lv_style_t s_accent_color[3];
+static lv_style_t s_text[4];        // indexed by theme_text_t
+static lv_style_t s_icon_on;        // icon tint while checked
+
+static void init_flex(lv_style_t *s, lv_flex_flow_t flow, lv_flex_align_t main,
+                      lv_flex_align_t cross, lv_flex_align_t track)
+{
+    lv_style_init(s);
+    lv_style_set_layout(s, LV_LAYOUT_FLEX);
+    lv_style_set_flex_flow(s, flow);
+    lv_style_set_flex_main_place(s, main);
+    lv_style_set_flex_cross_place(s, cross);
+    lv_style_set_flex_track_place(s, track);
+}
+
+static void set_bg(lv_style_t *s, uint32_t color)
+{
+    lv_style_set_bg_color(s, lv_color_hex(color));
+}
+
+static void set_text(lv_style_t *s, const lv_font_t *font, uint32_t color)
+{
+    lv_style_set_text_font(s, font);
+    lv_style_set_text_color(s, lv_color_hex(color));
+}
+
+static void load_palette(const palette_t *p)
+{
+    set_bg(&s_screen_color, p->screen);
+    set_bg(&s_card_color,   p->card);
+    set_bg(&s_track_color,  p->track);
+    set_bg(&s_knob_color,   p->knob);
+    for (int i = 0; i < 3; i++)
+        set_bg(&s_accent_color[i], p->accent[i]);
+
+    set_text(&s_text[THEME_TEXT_TITLE],   s_font_18, p->title);
+    set_text(&s_text[THEME_TEXT_NAME],    s_font_16, p->name);
+    set_text(&s_text[THEME_TEXT_CAPTION], s_font_16, p->caption);
+    set_text(&s_text[THEME_TEXT_VALUE],   s_font_16, p->value);
+    lv_style_set_text_color(&s_icon_on, lv_color_hex(p->accent[THEME_ACCENT_WARM]));
+}
+
+void theme_init(theme_id_t id)
+{
+    s_font_16 = font_cache_get(&font_sv_16);
+    s_font_18 = font_cache_get(&font_sv_18);
+
+    init_flex(&s_flex_column, LV_FLEX_FLOW_COLUMN, LV_FLEX_ALIGN_END,
+              LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    init_flex(&s_flex_card, LV_FLEX_FLOW_COLUMN, LV_FLEX_ALIGN_START,
+              LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
+    init_flex(&s_flex_row, LV_FLEX_FLOW_ROW, LV_FLEX_ALIGN_SPACE_BETWEEN,
+              LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    lv_style_init(&s_flex_grow);
+    lv_style_set_flex_grow(&s_flex_grow, 1);
+
+    lv_style_init(&s_screen_color);
+    lv_style_set_bg_opa(&s_screen_color, LV_OPA_COVER);
+    lv_style_init(&s_card_color);
+    lv_style_init(&s_track_color);
+    lv_style_init(&s_knob_color);
+    for (int i = 0; i < 3; i++)
+        lv_style_init(&s_accent_color[i]);
+    for (int i = 0; i < 4; i++)
+        lv_style_init(&s_text[i]);
+    lv_style_init(&s_icon_on);
+
+    // Both palettes use the same fonts, so this is sized once
+    const lv_font_t *value_font = s_font_16;
+    lv_style_init(&s_value_geom);
+    lv_style_set_width(&s_value_geom, lv_text_get_width("0000K", 5, value_font, 0));
+    lv_style_set_height(&s_value_geom, lv_font_get_line_height(value_font));
+    lv_style_set_text_align(&s_value_geom, LV_TEXT_ALIGN_RIGHT);
+
+    s_theme = id;
+    load_palette(&s_palettes[id]);
+}
+
+void theme_set(theme_id_t id)
+{
+    if (id == s_theme) return;
+    s_theme = id;
+    load_palette(&s_palettes[id]);
+    lv_obj_report_style_change(NULL);
+    ESP_LOGI(TAG, "Switched to %s theme", id == THEME_DARK ? "dark" : "light");
+}
+
+theme_id_t theme_get(void)
+{
+    return s_theme;
+}
+
+// ---- Apply ----
+
+void theme_apply_screen(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_screen_color, 0);
+}
+
+void theme_apply_transparent(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_transparent, 0);
+}
+
+void theme_apply_column(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_transparent, 0);
+    lv_obj_add_style(obj, &s_column_geom, 0);
+    lv_obj_add_style(obj, &s_flex_column, 0);
+}
+
+void theme_apply_card(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_card_geom, 0);
+    lv_obj_add_style(obj, &s_card_color, 0);
+    lv_obj_add_style(obj, &s_flex_card, 0);
+}
+
+void theme_apply_row(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_transparent, 0);
+    lv_obj_add_style(obj, &s_row_geom, 0);
+    lv_obj_add_style(obj, &s_flex_row, 0);
+}
+
+void theme_apply_separator(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_separator_geom, 0);
+    lv_obj_add_style(obj, &s_track_color, 0);
+}
+
+void theme_apply_switch(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_switch_geom, 0);
+    lv_obj_add_style(obj, &s_track_color, LV_PART_MAIN);
+    lv_obj_add_style(obj, &s_opaque, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    lv_obj_add_style(obj, &s_accent_color[THEME_ACCENT_BLUE], LV_PART_INDICATOR | LV_STATE_CHECKED);
+    lv_obj_add_style(obj, &s_switch_knob_geom, LV_PART_KNOB);
+}
+
+void theme_apply_slider(lv_obj_t *obj, theme_accent_t accent)
+{
+    lv_obj_add_style(obj, &s_slider_geom, 0);
+    lv_obj_add_style(obj, &s_track_color, LV_PART_MAIN);
+    lv_obj_add_style(obj, &s_opaque, LV_PART_INDICATOR);
+    lv_obj_add_style(obj, &s_accent_color[accent], LV_PART_INDICATOR);
+    lv_obj_add_style(obj, &s_slider_knob_geom, LV_PART_KNOB);
+    lv_obj_add_style(obj, &s_knob_color, LV_PART_KNOB);
+}
+
+void theme_apply_label(lv_obj_t *obj, theme_text_t kind)
+{
+    lv_obj_add_style(obj, &s_text[kind], 0);
+    if (kind == THEME_TEXT_VALUE) lv_obj_add_style(obj, &s_value_geom, 0);
+    if (kind == THEME_TEXT_NAME)  lv_obj_add_style(obj, &s_flex_grow, 0);
+}
+
+void theme_apply_icon(lv_obj_t *obj)
+{
+    lv_obj_add_style(obj, &s_text[THEME_TEXT_CAPTION], 0);
+    lv_obj_add_style(obj, &s_icon_on, LV_STATE_CHECKED);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "lvgl.h"
+
+typedef enum {
+    THEME_DARK,
+    THEME_LIGHT,
+} theme_id_t;
+
+typedef enum {
+    THEME_TEXT_TITLE,      // card title (18 px)
+    THEME_TEXT_NAME,       // entity name
+    THEME_TEXT_CAPTION,    // "Ljusstyrka", "Färgtemp"
+    THEME_TEXT_VALUE,      // "42%", "4000K"
+} theme_text_t;
+
+typedef enum {
+    THEME_ACCENT_BLUE,
+    THEME_ACCENT_WARM,
+    THEME_ACCENT_GREEN,
+} theme_accent_t;
+
+// Initialize shared styles. Must be called with the LVGL port lock held.
+void theme_init(theme_id_t id);
+
+// Switch palette at runtime; every themed object restyles. LVGL lock required.
+void       theme_set(theme_id_t id);
+theme_id_t theme_get(void);
+
+// Attach shared styles by reference (no per-object local styles)
+void theme_apply_screen(lv_obj_t *obj);
+void theme_apply_transparent(lv_obj_t *obj);
+void theme_apply_column(lv_obj_t *obj);
+void theme_apply_card(lv_obj_t *obj);
+void theme_apply_row(lv_obj_t *obj);
+void theme_apply_separator(lv_obj_t *obj);
+void theme_apply_switch(lv_obj_t *obj);
+void theme_apply_slider(lv_obj_t *obj, theme_accent_t accent);
+void theme_apply_label(lv_obj_t *obj, theme_text_t kind);
+void theme_apply_icon(lv_obj_t *obj);      // panel_icon; accent tint while LV_STATE_CHECKED
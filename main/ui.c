@@ -3,106 +3,242 @@
  *
  * Layout (480x800 portrait, card bottom-aligned):
  * - Background image
- * - Arbetsrum card:
- *     Guldlampan  (on/off)
- *     Videolampor (on/off + brightness + color temp)
- *     Iris        (on/off + brightness)
- *     Solskydd    (position slider 0-100)
+ * - Horizontal tileview, one tile per room (swipe left/right)
+ *     Room card: one row group per entity, built from rooms.c
+ *       light on/off    -> switch
+ *       light dimmable  -> switch + brightness slider
+ *       light color temp-> switch + brightness + color temp sliders
+ *       cover           -> position slider 0-100
+ *   Sliders and switches are the panel widgets in widgets/
+ *   Each entity row starts with its icon from the icon atlas, in the
+ *   accent color while the light is on or the cover open
+ * - Page indicator ("2 / 15") on the top layer
+ *
+ * Room pages are built on first visit (or when a swipe towards them
+ * starts) and torn down after CONFIG_PANEL_UI_PAGE_IDLE_MS off-screen.
+ * At most CONFIG_PANEL_UI_MAX_BUILT_PAGES are alive at once, so LVGL heap
+ * and object count stay bounded regardless of the number of rooms.
+ * Entity state lives in entity_model.c and is re-applied on rebuild.
+ * A page's first build is laid out by LVGL's flex layout and its geometry
+ * recorded (layout_bake.c); rebuilds are pinned to that geometry instead
+ * of being laid out again.
+ * Widget changes are applied to the model optimistically and sent without
+ * blocking; see entity_model.c for how polls and failed commands are
+ * reconciled.
+ * All styling comes from shared styles in theme.c.
  */
 
 #include "ui.h"
-#include "fonts.h"
+#include "theme.h"
 #include "img_bg.h"
+#include "rooms.h"
+#include "entity_model.h"
+#include "layout_bake.h"
+#include "panel_slider.h"
+#include "panel_switch.h"
+#include "panel_icon.h"
+#include "metrics.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "mqtt_client_app.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "sdkconfig.h"
 #include <string.h>
 
 static const char *TAG = "ui";
 
-// ---- Guldlampan ----
-static lv_obj_t *sw_guld = NULL;
+#define PAGE_IDLE_MS    CONFIG_PANEL_UI_PAGE_IDLE_MS
+#define MAX_BUILT_PAGES CONFIG_PANEL_UI_MAX_BUILT_PAGES
+
+#define CT_MIN_K 2900
+#define CT_MAX_K 7000
+
+// Widgets of one entity on one built page (NULL where the kind has none)
+typedef struct {
+    entity_state_t *st;
+    lv_obj_t *icon;
+    lv_obj_t *sw;
+    lv_obj_t *slider_bright;
+    lv_obj_t *label_bright;
+    lv_obj_t *slider_ct;
+    lv_obj_t *label_ct;
+    lv_obj_t *slider_pos;
+    lv_obj_t *label_pos;
+} entity_widgets_t;
+
+typedef struct {
+    const room_cfg_t *cfg;
+    lv_obj_t         *tile;
+    entity_widgets_t *widgets;      // NULL while the page is not built
+    uint32_t          last_shown;   // lv_tick_get() when last on screen
+    uint16_t          num_objs;
+    layout_bake_t    *bake;         // geometry of the first build, kept across teardowns
+} room_page_t;
+
+static room_page_t *s_pages;
+static int          s_num_pages;
+static int          s_active;
+static lv_obj_t    *s_indicator;
+#ifdef CONFIG_PANEL_UI_BAKED_LAYOUT
+static bool         s_bake_layout = true;
+#else
+static bool         s_bake_layout = false;
+#endif
+
+// Guard against feedback loops when model updates move widgets
+static bool s_updating_from_poll = false;
 
-// ---- Videolampor ----
-static lv_obj_t *sw_video      = NULL;
-static lv_obj_t *slider_bright = NULL;
-static lv_obj_t *slider_ct     = NULL;
-static lv_obj_t *label_bright  = NULL;
-static lv_obj_t *label_ct      = NULL;
+static const uint32_t s_build_bounds[] = { 5, 10, 20, 50, 100, 200, 500 };
 
-// ---- Iris ----
-static lv_obj_t *sw_iris             = NULL;
-static lv_obj_t *slider_iris_bright  = NULL;
-static lv_obj_t *label_iris_bright   = NULL;
+static metrics_histogram_t m_page_build_ms = METRICS_HISTOGRAM_INIT("ui_page_build_ms", "Room page construction time (ms)", s_build_bounds);
+static metrics_gauge_t     m_pages_built   = METRICS_GAUGE_INIT("ui_pages_built", "Room pages currently built");
+static metrics_gauge_t     m_objects       = METRICS_GAUGE_INIT("ui_page_objects", "LVGL objects in built room pages");
+static metrics_gauge_t     m_init_us       = METRICS_GAUGE_INIT("ui_init_us", "ui_init() duration, including the first page (us)");
+static metrics_gauge_t     m_page_heap     = METRICS_GAUGE_INIT("ui_page_heap_bytes", "LVGL heap taken by the last page build (bytes)");
 
-// ---- Solskydd ----
-static lv_obj_t *slider_solskydd = NULL;
-static lv_obj_t *label_solskydd  = NULL;
+// Command outcomes from the HA engine task
+#define CMD_RESULTS_LEN 32
+#define CMD_POLL_MS     20
 
-// Guard against feedback loops when polling updates sliders
-static bool s_updating_from_poll = false;
+typedef struct {
+    entity_state_t *st;
+    uint32_t        seq;
+    int             status;     // HTTP status or HA_STATUS_*
+} command_result_t;
 
-// ---- Event callbacks ----
+static QueueHandle_t s_cmd_results;
+static int           s_cmd_outstanding;     // queued or in flight, LVGL task only
 
-static void guld_switch_cb(lv_event_t *e)
+static const uint32_t s_command_bounds[] = { 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+static metrics_histogram_t m_command_ms = METRICS_HISTOGRAM_INIT("ui_command_ms", "Widget change to HA answer, including queueing (ms)", s_command_bounds);
+
+static int ct_raw_to_kelvin(int raw)
 {
-    bool is_on = lv_obj_has_state(sw_guld, LV_STATE_CHECKED);
-    ESP_LOGI(TAG, "guldlampan -> %s", is_on ? "ON" : "OFF");
-    mqtt_publish_command("light.guldlampan", is_on ? "ON" : "OFF");
+    return CT_MIN_K + (raw * (CT_MAX_K - CT_MIN_K)) / 100;
 }
 
-static void video_switch_cb(lv_event_t *e)
+static int ct_kelvin_to_raw(int kelvin)
 {
-    bool is_on = lv_obj_has_state(sw_video, LV_STATE_CHECKED);
-    int bright = lv_slider_get_value(slider_bright);
-    int ct_raw = lv_slider_get_value(slider_ct);
-    int ct_k   = 2900 + (ct_raw * (7000 - 2900)) / 100;
-    ha_set_light_with_params("light.videolampor", is_on, bright, ct_k);
+    int raw = ((kelvin - CT_MIN_K) * 100) / (CT_MAX_K - CT_MIN_K);
+    if (raw < 0)   raw = 0;
+    if (raw > 100) raw = 100;
+    return raw;
 }
 
-static void bright_slider_cb(lv_event_t *e)
+// ---- Commands ----
+//
+// Commands are optimistic: the model's `v` takes the new value before the
+// request is queued, and only a failed request rolls the widgets back.
+// Requests complete on the HA engine task; outcomes are handed back here
+// through s_cmd_results and applied by a timer on the LVGL task.
+
+static void finish_command(entity_state_t *st, uint32_t seq, int status)
 {
-    if (s_updating_from_poll) return;
-    int val = lv_slider_get_value(slider_bright);
-    lv_label_set_text_fmt(label_bright, "%d%%", (val * 100) / 255);
-    bool is_on = lv_obj_has_state(sw_video, LV_STATE_CHECKED);
-    int ct_raw = lv_slider_get_value(slider_ct);
-    int ct_k   = 2900 + (ct_raw * (7000 - 2900)) / 100;
-    ha_set_light_with_params("light.videolampor", is_on, val, ct_k);
+    if (status == 200)
+        ha_poll_after_command(st);
+    else
+        ESP_LOGW(TAG, "%s: command %lu failed (%d)", st->entity_id, (unsigned long)seq, status);
+    if (entity_model_end_command(st, seq, status == 200)) {
+        ui_refresh_entity(st);
+        ha_resync_entity(st);   // confirmed state may be older than HA's
+    }
 }
 
-static void ct_slider_cb(lv_event_t *e)
+// Engine task, must not block
+static void command_done(const ha_request_t *req, int status, const char *body, int body_len)
+{
+    metrics_histogram_observe(&m_command_ms, (uint32_t)((esp_timer_get_time() - req->queued_us) / 1000));
+    command_result_t r = { .st = req->ctx, .seq = req->tag, .status = status };
+    xQueueSend(s_cmd_results, &r, 0);   // never full, see send_command()
+}
+
+static void command_timer_cb(lv_timer_t *t)
+{
+    command_result_t r;
+    while (xQueueReceive(s_cmd_results, &r, 0) == pdTRUE) {
+        s_cmd_outstanding--;
+        finish_command(r.st, r.seq, r.status);
+    }
+}
+
+static esp_err_t send_light(entity_state_t *st, uint32_t seq)
+{
+    if (st->kind == ENTITY_LIGHT_ONOFF)
+        return mqtt_publish_command(st->entity_id, st->v.on ? "ON" : "OFF", command_done, st, seq);
+    return ha_set_light_with_params(st->entity_id, st->v.on, st->v.brightness,
+                                    st->kind == ENTITY_LIGHT_CT ? st->v.color_temp_k : 0,
+                                    command_done, st, seq);
+}
+
+// Queue a command for the values already in st->v. At most
+// CMD_RESULTS_LEN are unacknowledged, so command_done() always has room.
+static void send_command(entity_state_t *st)
+{
+    uint32_t seq = entity_model_begin_command(st);
+    esp_err_t err = ESP_ERR_NO_MEM;
+    if (s_cmd_outstanding < CMD_RESULTS_LEN) {
+        err = st->kind == ENTITY_COVER
+            ? ha_cover_set_position(st->entity_id, st->v.position, command_done, st, seq)
+            : send_light(st, seq);
+    }
+    if (err == ESP_OK) s_cmd_outstanding++;
+    else               finish_command(st, seq, HA_STATUS_REJECTED);
+}
+
+// ---- Event callbacks ----
+
+static void set_checked(lv_obj_t *obj, bool on)
+{
+    if (!obj) return;
+    if (on) lv_obj_add_state(obj, LV_STATE_CHECKED);
+    else    lv_obj_remove_state(obj, LV_STATE_CHECKED);
+}
+
+static void switch_cb(lv_event_t *e)
 {
     if (s_updating_from_poll) return;
-    int ct_raw = lv_slider_get_value(slider_ct);
-    int ct_k   = 2900 + (ct_raw * (7000 - 2900)) / 100;
-    lv_label_set_text_fmt(label_ct, "%dK", ct_k);
-    bool is_on = lv_obj_has_state(sw_video, LV_STATE_CHECKED);
-    int bright = lv_slider_get_value(slider_bright);
-    ha_set_light_with_params("light.videolampor", is_on, bright, ct_k);
+    entity_widgets_t *w = lv_event_get_user_data(e);
+    entity_state_t *st = w->st;
+    st->v.on = lv_obj_has_state(w->sw, LV_STATE_CHECKED);
+    set_checked(w->icon, st->v.on);
+    ESP_LOGI(TAG, "%s -> %s", st->entity_id, st->v.on ? "ON" : "OFF");
+    send_command(st);
 }
 
-static void iris_switch_cb(lv_event_t *e)
+static void bright_slider_cb(lv_event_t *e)
 {
-    bool is_on = lv_obj_has_state(sw_iris, LV_STATE_CHECKED);
-    int bright = lv_slider_get_value(slider_iris_bright);
-    ha_set_light_with_params("light.iris_golvlampa", is_on, bright, 0);
+    if (s_updating_from_poll) return;
+    entity_widgets_t *w = lv_event_get_user_data(e);
+    entity_state_t *st = w->st;
+    int val = panel_slider_get_value(w->slider_bright);
+    st->v.brightness = val;
+    lv_label_set_text_fmt(w->label_bright, "%d%%", (val * 100) / 255);
+    send_command(st);
 }
 
-static void iris_bright_slider_cb(lv_event_t *e)
+static void ct_slider_cb(lv_event_t *e)
 {
     if (s_updating_from_poll) return;
-    int val = lv_slider_get_value(slider_iris_bright);
-    lv_label_set_text_fmt(label_iris_bright, "%d%%", (val * 100) / 255);
-    bool is_on = lv_obj_has_state(sw_iris, LV_STATE_CHECKED);
-    ha_set_light_with_params("light.iris_golvlampa", is_on, val, 0);
+    entity_widgets_t *w = lv_event_get_user_data(e);
+    entity_state_t *st = w->st;
+    int ct_k = ct_raw_to_kelvin(panel_slider_get_value(w->slider_ct));
+    st->v.color_temp_k = ct_k;
+    lv_label_set_text_fmt(w->label_ct, "%dK", ct_k);
+    send_command(st);
 }
 
-static void solskydd_slider_cb(lv_event_t *e)
+static void cover_slider_cb(lv_event_t *e)
 {
     if (s_updating_from_poll) return;
-    int pos = lv_slider_get_value(slider_solskydd);
-    lv_label_set_text_fmt(label_solskydd, "%d%%", pos);
-    ha_cover_set_position("cover.persienn_arbetsrum", pos);
+    entity_widgets_t *w = lv_event_get_user_data(e);
+    entity_state_t *st = w->st;
+    int pos = panel_slider_get_value(w->slider_pos);
+    st->v.position = pos;
+    lv_label_set_text_fmt(w->label_pos, "%d%%", pos);
+    set_checked(w->icon, pos > 0);
+    send_command(st);
 }
 
 // ---- Layout helpers ----
@@ -110,20 +246,11 @@ static void solskydd_slider_cb(lv_event_t *e)
 static lv_obj_t *make_card(lv_obj_t *parent, const char *title)
 {
     lv_obj_t *card = lv_obj_create(parent);
-    lv_obj_set_size(card, LV_PCT(90), LV_SIZE_CONTENT);
-    lv_obj_set_style_pad_all(card, 16, 0);
-    lv_obj_set_style_radius(card, 16, 0);
-    lv_obj_set_style_bg_color(card, lv_color_hex(0x1E1E2E), 0);
-    lv_obj_set_style_bg_opa(card, 210, 0);
-    lv_obj_set_style_border_width(card, 0, 0);
-    lv_obj_set_flex_flow(card, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_flex_align(card, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_START);
-    lv_obj_set_style_pad_row(card, 10, 0);
+    theme_apply_card(card);
 
     lv_obj_t *lbl = lv_label_create(card);
     lv_label_set_text(lbl, title);
-    lv_obj_set_style_text_font(lbl, &font_sv_18, 0);
-    lv_obj_set_style_text_color(lbl, lv_color_hex(0xCDD6F4), 0);
+    theme_apply_label(lbl, THEME_TEXT_TITLE);
 
     return card;
 }
@@ -131,214 +258,358 @@ static lv_obj_t *make_card(lv_obj_t *parent, const char *title)
 static lv_obj_t *make_row(lv_obj_t *parent)
 {
     lv_obj_t *row = lv_obj_create(parent);
-    lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
-    lv_obj_set_style_bg_opa(row, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(row, 0, 0);
-    lv_obj_set_style_pad_all(row, 4, 0);
-    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(row, LV_FLEX_ALIGN_SPACE_BETWEEN, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    theme_apply_row(row);
     return row;
 }
 
+// NULL for ICON_NONE
+static lv_obj_t *make_icon(lv_obj_t *parent, icon_id_t icon)
+{
+    if (icon == ICON_NONE) return NULL;
+    lv_obj_t *obj = panel_icon_create(parent, icon);
+    theme_apply_icon(obj);
+    return obj;
+}
+
 static lv_obj_t *make_switch(lv_obj_t *parent)
 {
-    lv_obj_t *sw = lv_switch_create(parent);
-    lv_obj_set_size(sw, 50, 26);
-    lv_obj_set_style_bg_color(sw, lv_color_hex(0x45475A), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(sw, lv_color_hex(0x89B4FA), LV_PART_INDICATOR | LV_STATE_CHECKED);
+    lv_obj_t *sw = panel_switch_create(parent);
+    theme_apply_switch(sw);
     return sw;
 }
 
-static lv_obj_t *make_slider(lv_obj_t *parent, lv_color_t indicator_color)
+static lv_obj_t *make_slider(lv_obj_t *parent, theme_accent_t accent)
 {
-    lv_obj_t *s = lv_slider_create(parent);
-    lv_obj_set_width(s, LV_PCT(95));
-    lv_obj_set_style_bg_color(s, lv_color_hex(0x45475A), LV_PART_MAIN);
-    lv_obj_set_style_bg_color(s, indicator_color, LV_PART_INDICATOR);
-    lv_obj_set_style_bg_color(s, lv_color_hex(0xCDD6F4), LV_PART_KNOB);
+    lv_obj_t *s = panel_slider_create(parent);
+    theme_apply_slider(s, accent);
     return s;
 }
 
 static void add_separator(lv_obj_t *parent)
 {
     lv_obj_t *sep = lv_obj_create(parent);
-    lv_obj_set_size(sep, LV_PCT(100), 1);
-    lv_obj_set_style_bg_color(sep, lv_color_hex(0x45475A), 0);
-    lv_obj_set_style_border_width(sep, 0, 0);
-    lv_obj_set_style_pad_all(sep, 0, 0);
+    theme_apply_separator(sep);
 }
 
-static lv_obj_t *make_label(lv_obj_t *parent, const char *text, const lv_font_t *font, lv_color_t color)
+static lv_obj_t *make_label(lv_obj_t *parent, const char *text, theme_text_t kind)
 {
     lv_obj_t *lbl = lv_label_create(parent);
     lv_label_set_text(lbl, text);
-    lv_obj_set_style_text_font(lbl, font, 0);
-    lv_obj_set_style_text_color(lbl, color, 0);
+    theme_apply_label(lbl, kind);
     return lbl;
 }
 
-// ---- Public API ----
-
-void ui_init(lv_display_t *display)
+// "Caption ........ value" row; returns the value label
+static lv_obj_t *make_value_row(lv_obj_t *parent, const char *caption, theme_text_t caption_kind,
+                                const char *placeholder)
 {
-    ESP_LOGI(TAG, "Building Smart Home UI");
+    lv_obj_t *row = make_row(parent);
+    make_label(row, caption, caption_kind);
+    return make_label(row, placeholder, THEME_TEXT_VALUE);
+}
 
-    lv_obj_t *screen = lv_display_get_screen_active(display);
-    lv_obj_set_style_bg_color(screen, lv_color_hex(0x1E1E2E), 0);
-    lv_obj_set_style_bg_opa(screen, LV_OPA_COVER, 0);
+// ---- Entity widgets ----
 
-    // Background image
-    lv_obj_t *bg = lv_image_create(screen);
-    lv_image_set_src(bg, &img_bg);
-    lv_obj_set_pos(bg, 0, 0);
-    lv_obj_set_size(bg, 480, 800);
+// Sliders only send on release, so while one is held nothing is pending
+// and the model accepts polls; the drag must not be pulled back by them.
+// The released value is sent and wins.
+static bool slider_free(lv_obj_t *slider)
+{
+    return slider && !lv_obj_has_state(slider, LV_STATE_PRESSED);
+}
 
-    // Scrollable column on top of background
-    lv_obj_t *col = lv_obj_create(screen);
-    lv_obj_set_size(col, 480, 800);
-    lv_obj_set_pos(col, 0, 0);
-    lv_obj_set_style_bg_opa(col, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(col, 0, 0);
-    lv_obj_set_style_pad_top(col, 24, 0);
-    lv_obj_set_style_pad_bottom(col, 24, 0);
-    lv_obj_set_flex_flow(col, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_flex_align(col, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_set_style_pad_row(col, 16, 0);
-    lv_obj_set_scrollbar_mode(col, LV_SCROLLBAR_MODE_OFF);
+static void sync_widgets(entity_widgets_t *w)
+{
+    const entity_state_t *st = w->st;
+    const entity_values_t *v = &st->v;
+    if (!st->known) return;
 
-    // ---- Arbetsrum card ----
-    lv_obj_t *card = make_card(col, "Arbetsrum");
+    s_updating_from_poll = true;
 
-    // -- Guldlampan --
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Guldlampan", &font_sv_16, lv_color_hex(0xA6ADC8));
-        sw_guld = make_switch(row);
-        lv_obj_add_event_cb(sw_guld, guld_switch_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    if (w->sw) {
+        set_checked(w->sw, v->on);
+        set_checked(w->icon, v->on);
+    }
+    if (slider_free(w->slider_bright) && v->brightness >= 0) {
+        panel_slider_set_value(w->slider_bright, v->brightness);
+        lv_label_set_text_fmt(w->label_bright, "%d%%", (v->brightness * 100) / 255);
+    }
+    if (slider_free(w->slider_ct) && v->color_temp_k > 0) {
+        panel_slider_set_value(w->slider_ct, ct_kelvin_to_raw(v->color_temp_k));
+        lv_label_set_text_fmt(w->label_ct, "%dK", v->color_temp_k);
+    }
+    if (slider_free(w->slider_pos) && v->position >= 0) {
+        panel_slider_set_value(w->slider_pos, v->position);
+        lv_label_set_text_fmt(w->label_pos, "%d%%", v->position);
+        set_checked(w->icon, v->position > 0);
     }
 
-    add_separator(card);
+    s_updating_from_poll = false;
+}
 
-    // -- Videolampor --
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Videolampor", &font_sv_16, lv_color_hex(0xA6ADC8));
-        sw_video = make_switch(row);
-        lv_obj_add_event_cb(sw_video, video_switch_cb, LV_EVENT_VALUE_CHANGED, NULL);
+static void build_entity(lv_obj_t *card, const entity_cfg_t *cfg, entity_widgets_t *w)
+{
+    w->st = entity_model_find(cfg->entity_id);
+
+    lv_obj_t *row = make_row(card);
+    w->icon = make_icon(row, cfg->icon);
+    make_label(row, cfg->name, THEME_TEXT_NAME);
+
+    if (cfg->kind == ENTITY_COVER) {
+        w->label_pos  = make_label(row, "--%", THEME_TEXT_VALUE);
+        w->slider_pos = make_slider(card, THEME_ACCENT_GREEN);
+        panel_slider_set_range(w->slider_pos, 0, 100);
+        panel_slider_set_value(w->slider_pos, 0);
+        lv_obj_add_event_cb(w->slider_pos, cover_slider_cb, LV_EVENT_RELEASED, w);
+        return;
     }
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Ljusstyrka", &font_sv_16, lv_color_hex(0x6C7086));
-        label_bright = lv_label_create(row);
-        lv_label_set_text(label_bright, "--%");
-        lv_obj_set_style_text_font(label_bright, &font_sv_16, 0);
-        lv_obj_set_style_text_color(label_bright, lv_color_hex(0xCDD6F4), 0);
+
+    w->sw = make_switch(row);
+    lv_obj_add_event_cb(w->sw, switch_cb, LV_EVENT_VALUE_CHANGED, w);
+
+    if (cfg->kind == ENTITY_LIGHT_ONOFF) return;
+
+    w->label_bright  = make_value_row(card, "Ljusstyrka", THEME_TEXT_CAPTION, "--%");
+    w->slider_bright = make_slider(card, THEME_ACCENT_BLUE);
+    panel_slider_set_range(w->slider_bright, 0, 255);
+    panel_slider_set_value(w->slider_bright, 128);
+    lv_obj_add_event_cb(w->slider_bright, bright_slider_cb, LV_EVENT_RELEASED, w);
+
+    if (cfg->kind != ENTITY_LIGHT_CT) return;
+
+    w->label_ct  = make_value_row(card, "Färgtemp", THEME_TEXT_CAPTION, "--K");
+    w->slider_ct = make_slider(card, THEME_ACCENT_WARM);
+    panel_slider_set_range(w->slider_ct, 0, 100);
+    panel_slider_set_value(w->slider_ct, 50);
+    lv_obj_add_event_cb(w->slider_ct, ct_slider_cb, LV_EVENT_RELEASED, w);
+}
+
+// ---- Room pages ----
+
+static uint16_t count_objs(const lv_obj_t *obj)
+{
+    uint16_t n = 1;
+    uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; i++)
+        n += count_objs(lv_obj_get_child(obj, i));
+    return n;
+}
+
+static void update_page_gauges(void)
+{
+    int built = 0, objs = 0;
+    for (int i = 0; i < s_num_pages; i++) {
+        if (!s_pages[i].widgets) continue;
+        built++;
+        objs += s_pages[i].num_objs;
     }
-    slider_bright = make_slider(card, lv_color_hex(0x89B4FA));
-    lv_slider_set_range(slider_bright, 0, 255);
-    lv_slider_set_value(slider_bright, 128, LV_ANIM_OFF);
-    lv_obj_add_event_cb(slider_bright, bright_slider_cb, LV_EVENT_RELEASED, NULL);
-
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Färgtemp", &font_sv_16, lv_color_hex(0x6C7086));
-        label_ct = lv_label_create(row);
-        lv_label_set_text(label_ct, "--K");
-        lv_obj_set_style_text_font(label_ct, &font_sv_16, 0);
-        lv_obj_set_style_text_color(label_ct, lv_color_hex(0xCDD6F4), 0);
+    metrics_gauge_set(&m_pages_built, built);
+    metrics_gauge_set(&m_objects, objs);
+}
+
+static void teardown_page(room_page_t *p)
+{
+    if (!p->widgets) return;
+    lv_obj_clean(p->tile);
+    lv_free(p->widgets);
+    p->widgets  = NULL;
+    p->num_objs = 0;
+    ESP_LOGI(TAG, "Tore down page %s", p->cfg->name);
+}
+
+// Keep the number of built pages under the cap by evicting the least recently shown
+static void evict_for(const room_page_t *keep)
+{
+    int built = 0;
+    room_page_t *lru = NULL;
+    for (int i = 0; i < s_num_pages; i++) {
+        room_page_t *p = &s_pages[i];
+        if (!p->widgets) continue;
+        built++;
+        if (p == keep || i == s_active) continue;
+        if (!lru || (int32_t)(p->last_shown - lru->last_shown) < 0) lru = p;
     }
-    slider_ct = make_slider(card, lv_color_hex(0xFABD2F));
-    lv_slider_set_range(slider_ct, 0, 100);
-    lv_slider_set_value(slider_ct, 50, LV_ANIM_OFF);
-    lv_obj_add_event_cb(slider_ct, ct_slider_cb, LV_EVENT_RELEASED, NULL);
-
-    add_separator(card);
-
-    // -- Iris --
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Iris", &font_sv_16, lv_color_hex(0xA6ADC8));
-        sw_iris = make_switch(row);
-        lv_obj_add_event_cb(sw_iris, iris_switch_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    if (built >= MAX_BUILT_PAGES && lru) teardown_page(lru);
+}
+
+static void build_page(room_page_t *p)
+{
+    if (p->widgets) return;
+    evict_for(p);
+
+    int64_t t0 = esp_timer_get_time();
+    const room_cfg_t *cfg = p->cfg;
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t heap_before = mon.total_size - mon.free_size;
+
+    // Scrollable column so tall rooms still fit
+    lv_obj_t *col = lv_obj_create(p->tile);
+    theme_apply_column(col);
+    lv_obj_set_scrollbar_mode(col, LV_SCROLLBAR_MODE_OFF);
+
+    lv_obj_t *card = make_card(col, cfg->name);
+
+    p->widgets = lv_malloc_zeroed(cfg->num_entities * sizeof(entity_widgets_t));
+    for (int i = 0; i < cfg->num_entities; i++) {
+        if (i > 0) add_separator(card);
+        build_entity(card, &cfg->entities[i], &p->widgets[i]);
+        sync_widgets(&p->widgets[i]);
     }
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Ljusstyrka", &font_sv_16, lv_color_hex(0x6C7086));
-        label_iris_bright = lv_label_create(row);
-        lv_label_set_text(label_iris_bright, "--%");
-        lv_obj_set_style_text_font(label_iris_bright, &font_sv_16, 0);
-        lv_obj_set_style_text_color(label_iris_bright, lv_color_hex(0xCDD6F4), 0);
+
+    // Lay the page out here rather than in the next refresh, so the layout
+    // pass counts towards the build time in both modes
+    bool baked = s_bake_layout && p->bake && layout_bake_apply(p->bake, col);
+    if (baked) {
+        lv_obj_update_layout(col);
+    } else if (s_bake_layout) {
+        layout_bake_free(p->bake);
+        p->bake = layout_bake_capture(col);
+    } else {
+        lv_obj_update_layout(col);
     }
-    slider_iris_bright = make_slider(card, lv_color_hex(0x89B4FA));
-    lv_slider_set_range(slider_iris_bright, 0, 255);
-    lv_slider_set_value(slider_iris_bright, 128, LV_ANIM_OFF);
-    lv_obj_add_event_cb(slider_iris_bright, iris_bright_slider_cb, LV_EVENT_RELEASED, NULL);
-
-    add_separator(card);
-
-    // -- Solskydd --
-    {
-        lv_obj_t *row = make_row(card);
-        make_label(row, "Solskydd", &font_sv_16, lv_color_hex(0xA6ADC8));
-        label_solskydd = lv_label_create(row);
-        lv_label_set_text(label_solskydd, "--%");
-        lv_obj_set_style_text_font(label_solskydd, &font_sv_16, 0);
-        lv_obj_set_style_text_color(label_solskydd, lv_color_hex(0xCDD6F4), 0);
+
+    p->num_objs = count_objs(col);
+    p->last_shown = lv_tick_get();
+
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    metrics_histogram_observe(&m_page_build_ms, us / 1000);
+    update_page_gauges();
+
+    // Includes a newly recorded bake; pinned objects carry local styles
+    lv_mem_monitor(&mon);
+    uint32_t heap = mon.total_size - mon.free_size;
+    metrics_gauge_set(&m_page_heap, (int32_t)(heap - heap_before));
+    ESP_LOGI(TAG, "Built page %s: %u objs in %lu us (%s layout), +%lu B, LVGL heap %u used / %u peak",
+             cfg->name, p->num_objs, (unsigned long)us, baked ? "baked" : "flex",
+             (unsigned long)(heap - heap_before), (unsigned)heap, (unsigned)mon.max_used);
+}
+
+static void update_indicator(void)
+{
+    if (s_indicator)
+        lv_label_set_text_fmt(s_indicator, "%d / %d", s_active + 1, s_num_pages);
+}
+
+static void tileview_event_cb(lv_event_t *e)
+{
+    lv_obj_t *tv = lv_event_get_target(e);
+
+    if (lv_event_get_code(e) == LV_EVENT_SCROLL_BEGIN) {
+        // A swipe is starting: make sure both neighbours have content to slide in
+        if (s_active > 0)               build_page(&s_pages[s_active - 1]);
+        if (s_active < s_num_pages - 1) build_page(&s_pages[s_active + 1]);
+        return;
     }
-    slider_solskydd = make_slider(card, lv_color_hex(0xA6E3A1));
-    lv_slider_set_range(slider_solskydd, 0, 100);
-    lv_slider_set_value(slider_solskydd, 0, LV_ANIM_OFF);
-    lv_obj_add_event_cb(slider_solskydd, solskydd_slider_cb, LV_EVENT_RELEASED, NULL);
 
-    ESP_LOGI(TAG, "UI created");
+    lv_obj_t *tile = lv_tileview_get_tile_active(tv);
+    s_active = (int)(intptr_t)lv_obj_get_user_data(tile);
+    build_page(&s_pages[s_active]);
+    s_pages[s_active].last_shown = lv_tick_get();
+    update_indicator();
 }
 
-void ui_update_light_state(const char *entity_id, bool state)
+static void idle_timer_cb(lv_timer_t *t)
 {
-    lv_obj_t *sw = NULL;
-    if      (strcmp(entity_id, "light.guldlampan")   == 0) sw = sw_guld;
-    else if (strcmp(entity_id, "light.videolampor")  == 0) sw = sw_video;
-    else if (strcmp(entity_id, "light.iris_golvlampa") == 0) sw = sw_iris;
-    if (!sw) return;
-    if (state) lv_obj_add_state(sw, LV_STATE_CHECKED);
-    else       lv_obj_remove_state(sw, LV_STATE_CHECKED);
+    s_pages[s_active].last_shown = lv_tick_get();
+
+    bool changed = false;
+    for (int i = 0; i < s_num_pages; i++) {
+        room_page_t *p = &s_pages[i];
+        if (i == s_active || !p->widgets) continue;
+        if (lv_tick_elaps(p->last_shown) < PAGE_IDLE_MS) continue;
+        teardown_page(p);
+        changed = true;
+    }
+    if (changed) update_page_gauges();
 }
 
-void ui_update_light_params(const char *entity_id, int brightness, int color_temp_kelvin)
+// ---- Public API ----
+
+void ui_init(lv_display_t *display)
 {
-    s_updating_from_poll = true;
+    ESP_LOGI(TAG, "Building Smart Home UI");
+    int64_t t0 = esp_timer_get_time();
+
+    metrics_register_histogram(&m_page_build_ms);
+    metrics_register_gauge(&m_pages_built);
+    metrics_register_gauge(&m_objects);
+    metrics_register_gauge(&m_init_us);
+    metrics_register_gauge(&m_page_heap);
+    metrics_register_histogram(&m_command_ms);
+
+#ifdef CONFIG_PANEL_UI_THEME_LIGHT
+    theme_init(THEME_LIGHT);
+#else
+    theme_init(THEME_DARK);
+#endif
+
+    lv_obj_t *screen = lv_display_get_screen_active(display);
+    theme_apply_screen(screen);
+
+    // Background image
+    lv_obj_t *bg = lv_image_create(screen);
+    lv_image_set_src(bg, &img_bg);
+    lv_obj_set_pos(bg, 0, 0);
+    lv_obj_set_size(bg, 480, 800);
 
-    if (strcmp(entity_id, "light.videolampor") == 0) {
-        if (brightness >= 0 && slider_bright && label_bright) {
-            lv_slider_set_value(slider_bright, brightness, LV_ANIM_OFF);
-            lv_label_set_text_fmt(label_bright, "%d%%", (brightness * 100) / 255);
-        }
-        if (color_temp_kelvin > 0 && slider_ct && label_ct) {
-            int ct_raw = ((color_temp_kelvin - 2900) * 100) / (7000 - 2900);
-            if (ct_raw < 0)   ct_raw = 0;
-            if (ct_raw > 100) ct_raw = 100;
-            lv_slider_set_value(slider_ct, ct_raw, LV_ANIM_OFF);
-            lv_label_set_text_fmt(label_ct, "%dK", color_temp_kelvin);
-        }
-    } else if (strcmp(entity_id, "light.iris_golvlampa") == 0) {
-        if (brightness >= 0 && slider_iris_bright && label_iris_bright) {
-            lv_slider_set_value(slider_iris_bright, brightness, LV_ANIM_OFF);
-            lv_label_set_text_fmt(label_iris_bright, "%d%%", (brightness * 100) / 255);
-        }
+    // One tile per room; content is built lazily
+    s_num_pages = rooms_count();
+    s_pages = lv_malloc_zeroed(s_num_pages * sizeof(room_page_t));
+
+    lv_obj_t *tv = lv_tileview_create(screen);
+    lv_obj_set_size(tv, 480, 800);
+    lv_obj_set_pos(tv, 0, 0);
+    theme_apply_transparent(tv);
+    lv_obj_set_scrollbar_mode(tv, LV_SCROLLBAR_MODE_OFF);
+
+    for (int i = 0; i < s_num_pages; i++) {
+        lv_dir_t dir = LV_DIR_NONE;
+        if (i > 0)               dir |= LV_DIR_LEFT;
+        if (i < s_num_pages - 1) dir |= LV_DIR_RIGHT;
+        s_pages[i].cfg  = rooms_get(i);
+        s_pages[i].tile = lv_tileview_add_tile(tv, i, 0, dir);
+        lv_obj_set_user_data(s_pages[i].tile, (void *)(intptr_t)i);
     }
+    lv_obj_add_event_cb(tv, tileview_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(tv, tileview_event_cb, LV_EVENT_SCROLL_BEGIN, NULL);
 
-    s_updating_from_poll = false;
+    if (s_num_pages > 1) {
+        s_indicator = make_label(lv_layer_top(), "", THEME_TEXT_NAME);
+        lv_obj_align(s_indicator, LV_ALIGN_TOP_MID, 0, 4);
+    }
+
+    s_active = 0;
+    build_page(&s_pages[0]);
+    update_indicator();
+    lv_timer_create(idle_timer_cb, 5000, NULL);
+
+    s_cmd_results = xQueueCreate(CMD_RESULTS_LEN, sizeof(command_result_t));
+    lv_timer_create(command_timer_cb, CMD_POLL_MS, NULL);
+
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    metrics_gauge_set(&m_init_us, (int32_t)us);
+    ESP_LOGI(TAG, "UI created: %d rooms in %lu us", s_num_pages, (unsigned long)us);
 }
 
-void ui_update_cover_state(const char *entity_id, int position)
+void ui_set_baked_layout(bool on)
 {
-    if (strcmp(entity_id, "cover.persienn_arbetsrum") != 0) return;
-    if (position < 0 || !slider_solskydd || !label_solskydd) return;
+    s_bake_layout = on;
+}
 
-    s_updating_from_poll = true;
-    lv_slider_set_value(slider_solskydd, position, LV_ANIM_OFF);
-    lv_label_set_text_fmt(label_solskydd, "%d%%", position);
-    s_updating_from_poll = false;
+bool ui_baked_layout(void)
+{
+    return s_bake_layout;
+}
+
+void ui_refresh_entity(const entity_state_t *st)
+{
+    for (int i = 0; i < s_num_pages; i++) {
+        room_page_t *p = &s_pages[i];
+        if (!p->widgets) continue;
+        for (int j = 0; j < p->cfg->num_entities; j++)
+            if (p->widgets[j].st == st) sync_widgets(&p->widgets[j]);
+    }
 }
 
 void ui_update_temperature(float temp)
@@ -1,13 +1,20 @@
 #pragma once
 
 #include "lvgl.h"
+#include "entity_model.h"
 #include <stdbool.h>
 
 void ui_init(lv_display_t *display);
 
-void ui_update_light_state(const char *entity_id, bool state);
-void ui_update_light_params(const char *entity_id, int brightness, int color_temp_kelvin);
-void ui_update_cover_state(const char *entity_id, int position);
+// Re-sync every built widget showing the entity with its model values.
+// Call with the LVGL port lock held.
+void ui_refresh_entity(const entity_state_t *st);
+
+// Rebuilt room pages reuse the geometry recorded at their first build
+// (baked) or are laid out by flex like the first build. Applies to pages
+// built from now on. Call with the LVGL port lock held.
+void ui_set_baked_layout(bool on);
+bool ui_baked_layout(void);
 
 // Kept for API compatibility
 void ui_update_temperature(float temp);
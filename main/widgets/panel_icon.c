@@ -0,0 +1,70 @@
+/*
+ * Panel icon
+ *
+ * A bare lv_obj that draws one atlas icon (icon_atlas.c) in its text
+ * color. lv_image would need one image source per icon and a recolor
+ * style per state; here the icon is an id and the tint is the style's
+ * text color, which the row's label styles already provide. LVGL
+ * invalidates the object when a state change alters its style, so
+ * checking the icon is enough to repaint it.
+ */
+
+#include "panel_icon.h"
+#include "lvgl_private.h"   // lv_obj_class_t layout
+
+#define MY_CLASS (&panel_icon_class)
+
+typedef struct {
+    lv_obj_t  obj;
+    icon_id_t icon;
+} panel_icon_t;
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t panel_icon_class = {
+    .base_class     = &lv_obj_class,
+    .constructor_cb = constructor,
+    .event_cb       = event_cb,
+    .width_def      = ICON_SIZE,
+    .height_def     = ICON_SIZE,
+    .instance_size  = sizeof(panel_icon_t),
+    .name           = "panel_icon",
+};
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+}
+
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_current_target(e);
+
+    if (code == LV_EVENT_DRAW_MAIN) {
+        lv_area_t c;
+        lv_obj_get_coords(obj, &c);
+        icon_atlas_draw(lv_event_get_layer(e), ((panel_icon_t *)obj)->icon, &c,
+                        lv_obj_get_style_text_color(obj, LV_PART_MAIN),
+                        lv_obj_get_style_text_opa(obj, LV_PART_MAIN));
+        return;
+    }
+    if (code == LV_EVENT_COVER_CHECK) {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
+        return;
+    }
+
+    lv_obj_event_base(MY_CLASS, e);
+}
+
+lv_obj_t *panel_icon_create(lv_obj_t *parent, icon_id_t icon)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    ((panel_icon_t *)obj)->icon = icon;
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
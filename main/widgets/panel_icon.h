@@ -0,0 +1,19 @@
+#pragma once
+
+#include "lvgl.h"
+#include "icon_atlas.h"
+
+/*
+ * Entity icon drawn from the icon atlas.
+ *
+ * Styles:
+ * - LV_PART_MAIN: text_color/text_opa tint the icon, so a style on
+ *   LV_STATE_CHECKED recolors it with the entity's state
+ *
+ * Default size ICON_SIZE x ICON_SIZE; a larger box centers the icon. Not
+ * clickable.
+ */
+
+extern const lv_obj_class_t panel_icon_class;
+
+lv_obj_t *panel_icon_create(lv_obj_t *parent, icon_id_t icon);
@@ -0,0 +1,222 @@
+/*
+ * Panel slider
+ *
+ * lv_slider invalidates the whole widget, knob overhang included, on every
+ * value change. A drag across a 380 px track therefore redraws the
+ * background image, the card and all three parts over the full width, every
+ * frame. Here a value change invalidates only the span from the old knob to
+ * the new one. The boundary between indicator and track sits under the
+ * knob, so nothing outside that span changes.
+ *
+ * Drawing (LV_EVENT_DRAW_MAIN, replacing the object's background):
+ * - track: from the knob to the right end, with a rounded right end
+ * - indicator: from the left end to the knob, with a rounded left end
+ * - knob: a disc centered on the value position
+ * Track and indicator do not overlap, so a translucent track is blended
+ * once per pixel. The rounded ends and the knob are precomputed masks
+ * (pill.c).
+ *
+ * The knob center travels the full width, from x1 at min to x2 at max, as
+ * lv_slider's does. Touch input maps the same way back to a value.
+ */
+
+#include "panel_slider.h"
+#include "pill.h"
+#include "lvgl_private.h"   // lv_obj_t layout, needed to extend it
+
+#define MY_CLASS (&panel_slider_class)
+
+typedef struct {
+    lv_obj_t obj;
+    int32_t  value;
+    int32_t  min;
+    int32_t  max;
+} panel_slider_t;
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t panel_slider_class = {
+    .base_class     = &lv_obj_class,
+    .constructor_cb = constructor,
+    .event_cb       = event_cb,
+    .width_def      = LV_DPI_DEF * 2,
+    .height_def     = LV_DPI_DEF / 10,
+    .instance_size  = sizeof(panel_slider_t),
+    .name           = "panel_slider",
+};
+
+// ---- Geometry ----
+
+static int32_t knob_pad(const lv_obj_t *obj)
+{
+    return lv_obj_get_style_pad_left(obj, LV_PART_KNOB);
+}
+
+static int32_t knob_center(const panel_slider_t *s, const lv_area_t *c, int32_t value)
+{
+    int32_t span = s->max - s->min;
+    if (span <= 0) return c->x1;
+    return c->x1 + (int32_t)((int64_t)(value - s->min) * (lv_area_get_width(c) - 1) / span);
+}
+
+static void knob_area(const panel_slider_t *s, const lv_area_t *c, int32_t value, lv_area_t *out)
+{
+    int32_t pad = knob_pad(&s->obj);
+    int32_t d = lv_area_get_height(c) + 2 * pad;
+    out->x1 = knob_center(s, c, value) - d / 2;
+    out->x2 = out->x1 + d - 1;
+    out->y1 = c->y1 - pad;
+    out->y2 = out->y1 + d - 1;
+}
+
+// ---- Drawing ----
+
+static void draw(lv_obj_t *obj, lv_layer_t *layer)
+{
+    panel_slider_t *s = (panel_slider_t *)obj;
+    lv_area_t c, knob;
+    lv_obj_get_coords(obj, &c);
+    knob_area(s, &c, s->value, &knob);
+    int32_t kx = knob_center(s, &c, s->value);
+    int32_t cap = lv_area_get_height(&c) / 2;
+
+    // Each part keeps at least its rounded end; overlap is under the knob
+    lv_area_t track = c;
+    track.x1 = LV_MIN(kx + 1, c.x2 - cap + 1);
+    pill_draw(layer, &track, lv_obj_get_style_bg_color(obj, LV_PART_MAIN),
+              lv_obj_get_style_bg_opa(obj, LV_PART_MAIN), PILL_CAP_RIGHT);
+
+    lv_area_t indic = c;
+    indic.x2 = LV_MAX(kx, c.x1 + cap - 1);
+    pill_draw(layer, &indic, lv_obj_get_style_bg_color(obj, LV_PART_INDICATOR),
+              lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR), PILL_CAP_LEFT);
+
+    pill_draw_disc(layer, knob.x1, knob.y1, lv_area_get_width(&knob),
+                   lv_obj_get_style_bg_color(obj, LV_PART_KNOB),
+                   lv_obj_get_style_bg_opa(obj, LV_PART_KNOB));
+}
+
+// ---- Input ----
+
+static void drag_to_pointer(lv_obj_t *obj)
+{
+    panel_slider_t *s = (panel_slider_t *)obj;
+    lv_indev_t *indev = lv_indev_active();
+    if (!indev) return;
+    lv_point_t p;
+    lv_indev_get_point(indev, &p);
+
+    lv_area_t c;
+    lv_obj_get_coords(obj, &c);
+    int32_t w = lv_area_get_width(&c);
+    int32_t x = LV_CLAMP(c.x1, p.x, c.x2);
+    int32_t value = s->min;
+    if (w > 1)
+        value += (int32_t)(((int64_t)(x - c.x1) * (s->max - s->min) + (w - 1) / 2) / (w - 1));
+    if (value == s->value) return;
+
+    panel_slider_set_value(obj, value);
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
+}
+
+// ---- Class ----
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    panel_slider_t *s = (panel_slider_t *)obj;
+    s->value = 0;
+    s->min = 0;
+    s->max = 100;
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+    lv_obj_set_ext_click_area(obj, LV_DPX(8));
+}
+
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_current_target(e);
+
+    // The parts replace the object's background, which is never drawn
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw(obj, lv_event_get_layer(e));
+        return;
+    }
+    if (code == LV_EVENT_COVER_CHECK) {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
+        return;
+    }
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RESULT_OK) return;
+
+    if (code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
+        drag_to_pointer(obj);
+    } else if (code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        // The knob center reaches both ends
+        int32_t *size = lv_event_get_param(e);
+        int32_t ext = (lv_obj_get_height(obj) + 2 * knob_pad(obj)) / 2 + 1;
+        if (*size < ext) *size = ext;
+    } else if (code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        lv_obj_refresh_ext_draw_size(obj);
+    }
+}
+
+// ---- Public API ----
+
+lv_obj_t *panel_slider_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void panel_slider_set_range(lv_obj_t *obj, int32_t min, int32_t max)
+{
+    panel_slider_t *s = (panel_slider_t *)obj;
+    if (max < min) max = min;
+    s->min = min;
+    s->max = max;
+    s->value = LV_CLAMP(min, s->value, max);
+    lv_obj_invalidate(obj);
+}
+
+void panel_slider_set_value(lv_obj_t *obj, int32_t value)
+{
+    panel_slider_t *s = (panel_slider_t *)obj;
+    value = LV_CLAMP(s->min, value, s->max);
+    if (value == s->value) return;
+
+    lv_area_t c, from, to;
+    lv_obj_get_coords(obj, &c);
+    knob_area(s, &c, s->value, &from);
+    knob_area(s, &c, value, &to);
+    s->value = value;
+
+    // Both knob positions and everything between them, track height included
+    lv_area_t strip = {
+        .x1 = LV_MIN(from.x1, to.x1) - 1,
+        .y1 = LV_MIN(from.y1, c.y1),
+        .x2 = LV_MAX(from.x2, to.x2) + 1,
+        .y2 = LV_MAX(from.y2, c.y2),
+    };
+    lv_obj_invalidate_area(obj, &strip);
+}
+
+int32_t panel_slider_get_value(const lv_obj_t *obj)
+{
+    return ((const panel_slider_t *)obj)->value;
+}
+
+int32_t panel_slider_get_min_value(const lv_obj_t *obj)
+{
+    return ((const panel_slider_t *)obj)->min;
+}
+
+int32_t panel_slider_get_max_value(const lv_obj_t *obj)
+{
+    return ((const panel_slider_t *)obj)->max;
+}
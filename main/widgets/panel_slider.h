@@ -0,0 +1,30 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdint.h>
+
+/*
+ * Horizontal slider that redraws only what a value change touches.
+ *
+ * Styles, as for lv_slider:
+ * - LV_PART_MAIN: bg color/opa of the track (the object's own box)
+ * - LV_PART_INDICATOR: bg color/opa of the filled part
+ * - LV_PART_KNOB: bg color/opa; pad_left is how far the knob reaches past
+ *   the track, so the knob diameter is height + 2 * pad
+ *
+ * Events, as for lv_slider: LV_EVENT_VALUE_CHANGED while dragging,
+ * LV_EVENT_RELEASED when let go. Drags do not scroll the parent.
+ */
+
+extern const lv_obj_class_t panel_slider_class;
+
+lv_obj_t *panel_slider_create(lv_obj_t *parent);
+
+// Range 0..100 by default. Clamps the value.
+void panel_slider_set_range(lv_obj_t *obj, int32_t min, int32_t max);
+
+// Immediate (no animation) and without LV_EVENT_VALUE_CHANGED
+void    panel_slider_set_value(lv_obj_t *obj, int32_t value);
+int32_t panel_slider_get_value(const lv_obj_t *obj);
+int32_t panel_slider_get_min_value(const lv_obj_t *obj);
+int32_t panel_slider_get_max_value(const lv_obj_t *obj);
@@ -0,0 +1,94 @@
+/*
+ * Panel switch
+ *
+ * lv_switch animates its knob across the track on every toggle. Each
+ * animation step invalidates the whole widget, so a tap costs a run of
+ * frames instead of one. Here the knob jumps: a toggle is one redraw of the
+ * switch's box. Toggling itself is lv_obj's LV_OBJ_FLAG_CHECKABLE handling,
+ * as in lv_switch.
+ *
+ * Drawing: the track is one pill in the indicator color when checked,
+ * otherwise in the main color. The knob is a disc at the left or right
+ * end. Both use the precomputed masks in pill.c.
+ */
+
+#include "panel_switch.h"
+#include "pill.h"
+#include "lvgl_private.h"   // lv_obj_class_t layout
+
+#define MY_CLASS (&panel_switch_class)
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj);
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e);
+
+const lv_obj_class_t panel_switch_class = {
+    .base_class     = &lv_obj_class,
+    .constructor_cb = constructor,
+    .event_cb       = event_cb,
+    .width_def      = (4 * LV_DPI_DEF) / 10,
+    .height_def     = (4 * LV_DPI_DEF) / 17,
+    .instance_size  = sizeof(lv_obj_t),
+    .name           = "panel_switch",
+};
+
+static void draw(lv_obj_t *obj, lv_layer_t *layer)
+{
+    lv_area_t c;
+    lv_obj_get_coords(obj, &c);
+    int32_t h = lv_area_get_height(&c);
+
+    bool on = lv_obj_has_state(obj, LV_STATE_CHECKED);
+    lv_opa_t indic_opa = on ? lv_obj_get_style_bg_opa(obj, LV_PART_INDICATOR) : LV_OPA_TRANSP;
+    if (indic_opa < LV_OPA_COVER)
+        pill_draw(layer, &c, lv_obj_get_style_bg_color(obj, LV_PART_MAIN),
+                  lv_obj_get_style_bg_opa(obj, LV_PART_MAIN), PILL_CAP_BOTH);
+    pill_draw(layer, &c, lv_obj_get_style_bg_color(obj, LV_PART_INDICATOR), indic_opa, PILL_CAP_BOTH);
+
+    int32_t pad = lv_obj_get_style_pad_left(obj, LV_PART_KNOB);
+    int32_t x = on ? c.x2 - h + 1 : c.x1;
+    pill_draw_disc(layer, x - pad, c.y1 - pad, h + 2 * pad,
+                   lv_obj_get_style_bg_color(obj, LV_PART_KNOB),
+                   lv_obj_get_style_bg_opa(obj, LV_PART_KNOB));
+}
+
+static void constructor(const lv_obj_class_t *class_p, lv_obj_t *obj)
+{
+    LV_UNUSED(class_p);
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_CHECKABLE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
+}
+
+static void event_cb(const lv_obj_class_t *class_p, lv_event_t *e)
+{
+    LV_UNUSED(class_p);
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t *obj = lv_event_get_current_target(e);
+
+    if (code == LV_EVENT_DRAW_MAIN) {
+        draw(obj, lv_event_get_layer(e));
+        return;
+    }
+    if (code == LV_EVENT_COVER_CHECK) {
+        lv_event_set_cover_res(e, LV_COVER_RES_NOT_COVER);
+        return;
+    }
+
+    if (lv_obj_event_base(MY_CLASS, e) != LV_RESULT_OK) return;
+
+    if (code == LV_EVENT_STATE_CHANGED) {
+        // The knob moves even if both states share a track color
+        lv_obj_invalidate(obj);
+    } else if (code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
+        int32_t *size = lv_event_get_param(e);
+        int32_t pad = lv_obj_get_style_pad_left(obj, LV_PART_KNOB);
+        if (*size < pad) *size = pad;
+    }
+}
+
+lv_obj_t *panel_switch_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
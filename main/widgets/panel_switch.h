@@ -0,0 +1,20 @@
+#pragma once
+
+#include "lvgl.h"
+
+/*
+ * On/off switch without the toggle animation.
+ *
+ * Styles, as for lv_switch:
+ * - LV_PART_MAIN: bg color/opa of the track when off
+ * - LV_PART_INDICATOR | LV_STATE_CHECKED: bg color/opa of the track when on
+ * - LV_PART_KNOB: bg color/opa; pad_left insets (negative) or grows the
+ *   knob relative to the track height
+ *
+ * Checkable: a click toggles LV_STATE_CHECKED and sends
+ * LV_EVENT_VALUE_CHANGED. Setting the state from code sends no event.
+ */
+
+extern const lv_obj_class_t panel_switch_class;
+
+lv_obj_t *panel_switch_create(lv_obj_t *parent);
@@ -0,0 +1,138 @@
+/*
+ * Pill and disc drawing for the panel widgets
+ *
+ * LVGL draws a rounded rectangle by building a radius mask for every row
+ * that touches a corner. A pill is all corner, so every row of a slider
+ * track goes through the masked blend over its full width. Here only the
+ * two ends are masked: each is a view of a precomputed A8 disc, which LVGL
+ * draws in the given color (the image recolor). The middle is an unmasked
+ * fill that lands in the RGB565 fill kernel. Discs are computed once per
+ * diameter. The panel uses four sizes: slider track and knob, switch track
+ * and knob.
+ *
+ * Coverage is 1 inside radius - 0.5, 0 outside radius + 0.5 and linear in
+ * between. For an odd diameter, the center column of the disc is fully
+ * covered in every row, so a cap of floor(d / 2) columns plus a plain fill
+ * joins without a seam.
+ */
+
+#include "pill.h"
+#include <math.h>
+
+#define MAX_DISCS 8
+
+typedef struct {
+    int32_t        d;
+    uint8_t       *buf;     // d * d coverage values
+    lv_image_dsc_t disc;
+    lv_image_dsc_t left;    // columns [0, d / 2), stride d
+    lv_image_dsc_t right;   // columns [d - d / 2, d)
+} disc_t;
+
+static disc_t s_discs[MAX_DISCS];
+
+// A w x d window of the disc starting at column `x`
+static void init_view(lv_image_dsc_t *img, const uint8_t *buf, int32_t x, int32_t w, int32_t d)
+{
+    img->header.magic  = LV_IMAGE_HEADER_MAGIC;
+    img->header.cf     = LV_COLOR_FORMAT_A8;
+    img->header.w      = w;
+    img->header.h      = d;
+    img->header.stride = d;
+    img->data          = buf + x;
+    img->data_size     = (uint32_t)(d * d - x);
+}
+
+// NULL if the cache is full or out of memory; callers fall back to LVGL
+static const disc_t *disc_get(int32_t d)
+{
+    if (d <= 0) return NULL;
+    disc_t *free_slot = NULL;
+    for (int i = 0; i < MAX_DISCS; i++) {
+        if (s_discs[i].d == d) return &s_discs[i];
+        if (!s_discs[i].d && !free_slot) free_slot = &s_discs[i];
+    }
+    if (!free_slot) return NULL;
+
+    uint8_t *buf = lv_malloc((size_t)d * d);
+    if (!buf) return NULL;
+    float r = d / 2.0f;
+    for (int32_t y = 0; y < d; y++) {
+        for (int32_t x = 0; x < d; x++) {
+            float dx = x + 0.5f - r, dy = y + 0.5f - r;
+            float cov = r + 0.5f - sqrtf(dx * dx + dy * dy);
+            buf[y * d + x] = cov >= 1.0f ? 255 : cov <= 0.0f ? 0 : (uint8_t)(cov * 255.0f + 0.5f);
+        }
+    }
+
+    disc_t *s = free_slot;
+    s->d = d;
+    s->buf = buf;
+    init_view(&s->disc, buf, 0, d, d);
+    init_view(&s->left, buf, 0, d / 2, d);
+    init_view(&s->right, buf, d - d / 2, d / 2, d);
+    return s;
+}
+
+static void draw_mask(lv_layer_t *layer, const lv_image_dsc_t *img, int32_t x, int32_t y,
+                      lv_color_t color, lv_opa_t opa)
+{
+    if (img->header.w == 0) return;
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = img;
+    dsc.recolor = color;
+    dsc.recolor_opa = LV_OPA_COVER;
+    dsc.opa = opa;
+    lv_area_t a = { x, y, x + (int32_t)img->header.w - 1, y + (int32_t)img->header.h - 1 };
+    lv_draw_image(layer, &dsc, &a);
+}
+
+static void fill(lv_layer_t *layer, const lv_area_t *a, lv_color_t color, lv_opa_t opa,
+                 int32_t radius)
+{
+    if (a->x1 > a->x2 || a->y1 > a->y2) return;
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = color;
+    dsc.bg_opa = opa;
+    dsc.radius = radius;
+    lv_draw_rect(layer, &dsc, a);
+}
+
+void pill_draw(lv_layer_t *layer, const lv_area_t *area, lv_color_t color, lv_opa_t opa,
+               pill_caps_t caps)
+{
+    if (opa <= LV_OPA_MIN || area->x1 > area->x2) return;
+    int32_t h = lv_area_get_height(area);
+    const disc_t *m = disc_get(h);
+    if (!m) {
+        fill(layer, area, color, opa, caps == PILL_CAP_NONE ? 0 : LV_RADIUS_CIRCLE);
+        return;
+    }
+
+    lv_area_t mid = *area;
+    int32_t cap = h / 2;
+    if (caps & PILL_CAP_LEFT) {
+        draw_mask(layer, &m->left, area->x1, area->y1, color, opa);
+        mid.x1 += cap;
+    }
+    if (caps & PILL_CAP_RIGHT) {
+        draw_mask(layer, &m->right, area->x2 - cap + 1, area->y1, color, opa);
+        mid.x2 -= cap;
+    }
+    fill(layer, &mid, color, opa, 0);
+}
+
+void pill_draw_disc(lv_layer_t *layer, int32_t x, int32_t y, int32_t d, lv_color_t color,
+                    lv_opa_t opa)
+{
+    if (opa <= LV_OPA_MIN || d <= 0) return;
+    const disc_t *m = disc_get(d);
+    if (m) {
+        draw_mask(layer, &m->disc, x, y, color, opa);
+    } else {
+        lv_area_t a = { x, y, x + d - 1, y + d - 1 };
+        fill(layer, &a, color, opa, LV_RADIUS_CIRCLE);
+    }
+}
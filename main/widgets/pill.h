@@ -0,0 +1,28 @@
+#pragma once
+
+#include "lvgl.h"
+
+/*
+ * Pill and disc drawing for the panel widgets.
+ *
+ * Rounded ends come from anti-aliased A8 disc masks, computed once per
+ * diameter and drawn in the part's color. The straight part in between is
+ * a plain rectangle fill. Call from a widget's LV_EVENT_DRAW_MAIN.
+ */
+
+typedef enum {
+    PILL_CAP_NONE  = 0,
+    PILL_CAP_LEFT  = 1,
+    PILL_CAP_RIGHT = 2,
+    PILL_CAP_BOTH  = 3,
+} pill_caps_t;
+
+// Horizontal pill segment over `area`; the cap radius is half its height.
+// A side without a cap is cut square (hidden under a knob). With both caps
+// the area must be at least as wide as it is tall.
+void pill_draw(lv_layer_t *layer, const lv_area_t *area, lv_color_t color, lv_opa_t opa,
+               pill_caps_t caps);
+
+// Filled circle of diameter `d` with its top-left corner at x, y
+void pill_draw_disc(lv_layer_t *layer, int32_t x, int32_t y, int32_t d, lv_color_t color,
+                    lv_opa_t opa);
@@ -15,6 +15,7 @@
  */
 
 #include "wifi.h"
+#include "metrics.h"
 #include "esp_log.h"
 #include "esp_wifi.h"
 #include "esp_event.h"
@@ -22,6 +23,17 @@
 
 static const char *TAG = "wifi";
 
+static metrics_counter_t m_reconnects = METRICS_COUNTER_INIT("wifi_reconnects_total", "WiFi disconnect/reconnect attempts");
+static metrics_gauge_t   m_connected  = METRICS_GAUGE_INIT("wifi_connected", "1 while the station has an IP");
+static metrics_gauge_t   m_rssi       = METRICS_GAUGE_INIT("wifi_rssi_dbm", "RSSI of the associated AP");
+
+static void sample_rssi(void)
+{
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) == ESP_OK)
+        metrics_gauge_set(&m_rssi, ap.rssi);
+}
+
 static void wifi_event_handler(void *arg, esp_event_base_t event_base,
                                int32_t event_id, void *event_data)
 {
@@ -29,10 +41,13 @@ static void wifi_event_handler(void *arg, esp_event_base_t event_base,
         esp_wifi_connect();
     } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
         ESP_LOGW(TAG, "WiFi disconnected, reconnecting...");
+        metrics_counter_inc(&m_reconnects);
+        metrics_gauge_set(&m_connected, 0);
         esp_wifi_connect();
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t *event = (ip_event_got_ip_t *)event_data;
         ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
+        metrics_gauge_set(&m_connected, 1);
     }
 }
 
@@ -46,6 +61,11 @@ void wifi_init(void)
     }
     ESP_ERROR_CHECK(ret);
 
+    metrics_register_counter(&m_reconnects);
+    metrics_register_gauge(&m_connected);
+    metrics_register_gauge(&m_rssi);
+    metrics_add_collector(sample_rssi);
+
     // Initialize TCP/IP and event loop
     ESP_ERROR_CHECK(esp_netif_init());
     ESP_ERROR_CHECK(esp_event_loop_create_default());
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in: the time-stamp counter where there is one, else ns
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    return (uint32_t)__rdtsc();
+}
+#else
+#include <time.h>
+
+static inline uint32_t esp_cpu_get_cycle_count(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in: the test drives the clock
+int64_t esp_timer_get_time(void);
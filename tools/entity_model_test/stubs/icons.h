@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for the header tools/icons/iconpack.py generates
+#define ICON_SIZE 24
+
+typedef enum {
+    ICON_NONE,
+    ICON_LIGHTBULB,
+    ICON_COUNT,
+} icon_id_t;
@@ -0,0 +1,239 @@
+/*
+ * Host test of the entity model's reconciliation (main/entity_model.c)
+ *
+ * Commands and polls are started and answered in interleaved and reordered
+ * sequences, as the HA engine's parallel connections and the push sources
+ * deliver them, on a clock the test advances by hand. Each case checks
+ * what the UI would show (`v`), the confirmed state and whether a rollback
+ * was reported.
+ *
+ *     make run
+ */
+
+#include "entity_model.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// ---- Stand-ins for the device ----
+
+static int64_t s_now_us;
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+static void advance_ms(int ms)
+{
+    s_now_us += ms * 1000LL;
+}
+
+static const entity_cfg_t s_entities[] = {
+    { "light.test", "Test", ENTITY_LIGHT_DIMMABLE, ICON_LIGHTBULB },
+};
+
+static const room_cfg_t s_room = { "Test", s_entities, 1 };
+
+int rooms_count(void)
+{
+    return 1;
+}
+
+const room_cfg_t *rooms_get(int index)
+{
+    return index == 0 ? &s_room : NULL;
+}
+
+// ---- Helpers ----
+
+static int s_failures;
+
+#define CHECK(cond)                                                           \
+    do {                                                                      \
+        if (!(cond)) {                                                        \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            s_failures++;                                                     \
+        }                                                                     \
+    } while (0)
+
+static entity_state_t *fresh(void)
+{
+    s_now_us = 100 * 1000000LL;
+    entity_model_init();
+    return entity_model_find("light.test");
+}
+
+static entity_values_t bright(int b)
+{
+    return (entity_values_t){ .on = b > 0, .brightness = b, .position = -1 };
+}
+
+static bool poll(entity_state_t *st, entity_poll_token_t t, int b)
+{
+    entity_values_t v = bright(b);
+    return entity_model_apply_poll(st, t, &v, NULL);
+}
+
+// The UI's part of a command: optimistic value, then begin
+static uint32_t command(entity_state_t *st, int b)
+{
+    st->v = bright(b);
+    return entity_model_begin_command(st);
+}
+
+// A poll answered now that was started before anything else happened
+static void known_at(entity_state_t *st, int b)
+{
+    CHECK(poll(st, entity_model_poll_begin(st), b));
+    CHECK(st->known && st->v.brightness == b && st->confirmed.brightness == b);
+}
+
+// ---- Cases ----
+
+// Poll sent before the command, answered after it was sent
+static void test_poll_overtaken_by_command(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    entity_poll_token_t t = entity_model_poll_begin(st);
+    uint32_t seq = command(st, 200);
+    advance_ms(40);
+    CHECK(!poll(st, t, 50));
+    CHECK(st->v.brightness == 200);
+
+    CHECK(!entity_model_end_command(st, seq, true));
+    CHECK(st->confirmed.brightness == 200);
+}
+
+// Poll sent before the command, answered after the command's answer
+static void test_poll_answered_after_command(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    entity_poll_token_t t = entity_model_poll_begin(st);
+    uint32_t seq = command(st, 200);
+    advance_ms(30);
+    CHECK(!entity_model_end_command(st, seq, true));
+    advance_ms(30);
+    CHECK(!poll(st, t, 50));
+    CHECK(st->v.brightness == 200 && st->confirmed.brightness == 200);
+}
+
+// HA may publish the new state late: polls within the settle window after
+// a successful command are dropped, later ones apply
+static void test_settle_window(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    uint32_t seq = command(st, 200);
+    CHECK(!entity_model_end_command(st, seq, true));
+
+    advance_ms(ENTITY_MODEL_SETTLE_MS - 100);
+    CHECK(!poll(st, entity_model_poll_begin(st), 50));
+    CHECK(st->v.brightness == 200);
+
+    advance_ms(200);
+    bool changed = false;
+    entity_values_t v = bright(180);
+    CHECK(entity_model_apply_poll(st, entity_model_poll_begin(st), &v, &changed));
+    CHECK(changed && st->v.brightness == 180 && st->confirmed.brightness == 180);
+}
+
+// Two commands in flight, answered in reverse order, the newer one failing:
+// nothing to roll back to but the state before both
+static void test_reordered_answers_newer_fails(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    uint32_t s1 = command(st, 100);
+    uint32_t s2 = command(st, 200);
+    CHECK(st->pending == 2);
+
+    CHECK(entity_model_end_command(st, s2, false));
+    CHECK(st->v.brightness == 50);
+    CHECK(!entity_model_end_command(st, s1, true));
+    CHECK(st->pending == 0 && st->v.brightness == 50);
+
+    // HA did take the older command, so the UI briefly shows 50 where HA
+    // has 100; the resync read after the settle window corrects it
+    advance_ms(ENTITY_MODEL_SETTLE_MS + 1);
+    CHECK(poll(st, entity_model_poll_begin(st), 100));
+    CHECK(st->v.brightness == 100);
+}
+
+// Two commands, answered in reverse order, the older one failing: the
+// newer value stays
+static void test_reordered_answers_older_fails(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    uint32_t s1 = command(st, 100);
+    uint32_t s2 = command(st, 200);
+    CHECK(!entity_model_end_command(st, s2, true));
+    CHECK(!entity_model_end_command(st, s1, false));
+    CHECK(st->v.brightness == 200 && st->confirmed.brightness == 200);
+}
+
+// A poll while another command is still pending is stale even if it was
+// started after the latest command
+static void test_poll_while_pending(void)
+{
+    entity_state_t *st = fresh();
+    known_at(st, 50);
+
+    uint32_t s1 = command(st, 100);
+    entity_poll_token_t t = entity_model_poll_begin(st);
+    advance_ms(20);
+    CHECK(!poll(st, t, 50));
+    CHECK(st->v.brightness == 100);
+    CHECK(!entity_model_end_command(st, s1, true));
+}
+
+// A failed command is only rolled back once HA's state is known
+static void test_failure_before_first_poll(void)
+{
+    entity_state_t *st = fresh();
+
+    uint32_t seq = command(st, 200);
+    CHECK(!entity_model_end_command(st, seq, false));
+    CHECK(st->v.brightness == 200);
+
+    CHECK(poll(st, entity_model_poll_begin(st), 60));
+    CHECK(st->known && st->v.brightness == 60);
+}
+
+// Polls with no command in between always apply, in whatever order
+static void test_polls_only(void)
+{
+    entity_state_t *st = fresh();
+    entity_poll_token_t a = entity_model_poll_begin(st);
+    advance_ms(10);
+    entity_poll_token_t b = entity_model_poll_begin(st);
+    CHECK(poll(st, b, 80));
+    CHECK(poll(st, a, 70));
+    CHECK(st->v.brightness == 70);
+}
+
+int main(void)
+{
+    test_poll_overtaken_by_command();
+    test_poll_answered_after_command();
+    test_settle_window();
+    test_reordered_answers_newer_fails();
+    test_reordered_answers_older_fails();
+    test_poll_while_pending();
+    test_failure_before_first_poll();
+    test_polls_only();
+
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return EXIT_FAILURE;
+    }
+    printf("entity_model: all cases passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""Compress the panel's LVGL fonts (main/fonts/font_sv_*.c) in place.
+
+lv_font_conv was run with --no-compress, and the TTF it read lives in a
+managed component. This re-encodes the generated C files into LVGL's
+compressed bitmap format (bitmap_format 1: each row XORed with the row
+above, then LVGL's RLE), so regenerating from the TTF is not needed.
+Every glyph is decoded again with a transcription of the decoder in
+lv_font_fmt_txt.c and compared before the file is written. The device
+needs CONFIG_LV_USE_FONT_COMPRESSED.
+
+    ./fontpack.py stats ../../main/fonts/font_sv_*.c
+    ./fontpack.py compress ../../main/fonts/font_sv_*.c
+
+`stats` prints glyph count, bitmap bytes as stored and the A8 bytes the
+glyph cache (main/font_cache.c) needs to hold every glyph of the font.
+"""
+
+import argparse
+import re
+import sys
+
+FMT_PLAIN = 0
+FMT_COMPRESSED = 1
+RLE_REPEAT_BITS = 11    # single '1' bits before the 6-bit counter
+RLE_COUNTER_MAX = 63
+
+BITMAP_RE = re.compile(r"(glyph_bitmap\[\] = \{\n)(.*?)(\n\};)", re.S)
+DSC_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = \d+, \.box_w = (\d+), \.box_h = (\d+),")
+COMMENT_RE = re.compile(r"^\s*/\* (U\+[0-9A-F]+ .*) \*/$")
+
+
+# ---- Bit streams ----
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        self.bits.extend((value >> (n - 1 - i)) & 1 for i in range(n))
+
+    def bytes(self):
+        bits = self.bits + [0] * (-len(self.bits) % 8)
+        return bytes(int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8))
+
+
+class BitReader:
+    def __init__(self, data, pos=0):
+        self.data, self.pos = data, pos * 8
+
+    def get(self, n):
+        v = 0
+        for _ in range(n):
+            byte = self.data[self.pos >> 3] if (self.pos >> 3) < len(self.data) else 0
+            v = (v << 1) | ((byte >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return v
+
+
+# ---- Plain 4 bpp ----
+
+def unpack_plain(data, index, w, h, bpp):
+    r = BitReader(data, index)
+    return [[r.get(bpp) for _ in range(w)] for _ in range(h)]
+
+
+# ---- LVGL compression ----
+
+def rle_encode(values, bpp):
+    """Inverse of rle_next() in lv_font_fmt_txt.c."""
+    out = BitWriter()
+    single, prev, i = True, 0, 0
+    n = len(values)
+    while i < n:
+        v = values[i]
+        if single:
+            # Only raw values read in the SINGLE state start a repeat run
+            out.put(v, bpp)
+            if i and v == prev:
+                single, count = False, 0
+            prev = v
+            i += 1
+        elif v == prev:
+            count += 1
+            out.put(1, 1)
+            if count < RLE_REPEAT_BITS:
+                i += 1
+                continue
+            run = 1
+            while i + run < n and values[i + run] == prev and run < RLE_COUNTER_MAX:
+                run += 1
+            out.put(run, 6)
+            i += run
+            single = True
+            if i < n:
+                prev = values[i]
+                out.put(prev, bpp)
+                i += 1
+        else:
+            out.put(0, 1)
+            out.put(v, bpp)
+            prev, i = v, i + 1
+            single = True
+    return out.bytes()
+
+
+def rle_decode(data, index, count, bpp):
+    """rle_next() from lv_font_fmt_txt.c, `count` times."""
+    r = BitReader(data, index)
+    state, prev, cnt, out = "single", 0, 0, []
+    for k in range(count):
+        if state == "single":
+            v = r.get(bpp)
+            if k and v == prev:
+                cnt, state = 0, "repeated"
+            prev = v
+        elif state == "repeated":
+            cnt += 1
+            if r.get(1):
+                v = prev
+                if cnt == RLE_REPEAT_BITS:
+                    cnt = r.get(6)
+                    if cnt:
+                        state = "counter"
+                    else:
+                        v = prev = r.get(bpp)
+                        state = "single"
+            else:
+                v = prev = r.get(bpp)
+                state = "single"
+        else:
+            v = prev
+            cnt -= 1
+            if cnt == 0:
+                v = prev = r.get(bpp)
+                state = "single"
+        out.append(v)
+    return out
+
+
+def compress(rows, bpp):
+    flat = []
+    for y, row in enumerate(rows):
+        flat.extend(v ^ rows[y - 1][x] if y else v for x, v in enumerate(row))
+    return rle_encode(flat, bpp)
+
+
+def decompress(data, index, w, h, bpp):
+    flat = rle_decode(data, index, w * h, bpp)
+    rows = [flat[y * w:(y + 1) * w] for y in range(h)]
+    for y in range(1, h):
+        rows[y] = [v ^ rows[y - 1][x] for x, v in enumerate(rows[y])]
+    return rows
+
+
+# ---- Generated C files ----
+
+def load(path):
+    src = open(path).read()
+    m = BITMAP_RE.search(src)
+    data = bytes(int(v, 16) for v in re.findall(r"0x([0-9a-f]+)", m[2]))
+    comments = [c for c in (COMMENT_RE.match(l) for l in m[2].splitlines()) if c]
+    glyphs = [tuple(int(g) for g in d) for d in DSC_RE.findall(src)][1:]   # id 0 is reserved
+    return {
+        "src": src,
+        "data": data,
+        "names": [c[1] for c in comments],
+        "glyphs": glyphs,
+        "bpp": int(re.search(r"\.bpp = (\d+)", src)[1]),
+        "format": int(re.search(r"\.bitmap_format = (\d+)", src)[1]),
+    }
+
+
+def glyph_rows(font, index, w, h):
+    if font["format"] == FMT_PLAIN:
+        return unpack_plain(font["data"], index, w, h, font["bpp"])
+    return decompress(font["data"], index, w, h, font["bpp"])
+
+
+def format_array(chunks, names):
+    lines = []
+    for name, chunk in zip(names, chunks):
+        lines.append(f"    /* {name} */")
+        for i in range(0, len(chunk), 8):
+            lines.append("    " + ", ".join(f"0x{b:x}" for b in chunk[i:i + 8]) + ",")
+        lines.append("")
+    # The decoder may read one byte past the last glyph's final bits
+    lines.append("    /* padding */")
+    lines.append("    0x0")
+    return "\n".join(lines)
+
+
+def compress_file(path):
+    font = load(path)
+    if font["format"] != FMT_PLAIN:
+        sys.exit(f"{path}: already compressed (bitmap_format {font['format']})")
+    if len(font["names"]) != len(font["glyphs"]):
+        sys.exit(f"{path}: {len(font['names'])} bitmap comments for {len(font['glyphs'])} glyphs")
+
+    chunks, index = [], []
+    pos = 0
+    for idx, w, h in font["glyphs"]:
+        rows = unpack_plain(font["data"], idx, w, h, font["bpp"])
+        chunk = compress(rows, font["bpp"]) if w and h else b""
+        if decompress(chunk + b"\0", 0, w, h, font["bpp"]) != rows:
+            sys.exit(f"{path}: glyph at {idx} does not round-trip")
+        index.append(pos)
+        chunks.append(chunk)
+        pos += len(chunk)
+
+    src = font["src"]
+    src = BITMAP_RE.sub(lambda m: m[1] + format_array(chunks, font["names"]) + m[3], src, count=1)
+    it = iter([0] + index)
+    src = re.sub(r"\.bitmap_index = \d+", lambda m: f".bitmap_index = {next(it)}", src)
+    src = src.replace(".bitmap_format = 0,", f".bitmap_format = {FMT_COMPRESSED},", 1)
+    src = src.replace(" * Opts: --no-compress --no-prefilter ",
+                      " * Compressed: tools/fonts/fontpack.py (prefilter + RLE)\n * Opts: ", 1)
+    open(path, "w").write(src)
+    print(f"{path}: {len(font['data'])} -> {pos + 1} bytes")
+
+
+def stats(path):
+    font = load(path)
+    a8 = 0
+    for idx, w, h in font["glyphs"]:
+        if w and h:
+            glyph_rows(font, idx, w, h)     # checks that the stream decodes
+            a8 += w * h
+    kind = "compressed" if font["format"] == FMT_COMPRESSED else "plain"
+    print(f"{path}: {len(font['glyphs'])} glyphs, {len(font['data'])} bitmap bytes ({kind}), "
+          f"{a8} bytes as A8")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("command", choices=["compress", "stats"])
+    ap.add_argument("files", nargs="+", help="generated font .c files")
+    args = ap.parse_args()
+    for path in args.files:
+        (compress_file if args.command == "compress" else stats)(path)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in: the test is single-threaded, critical sections are no-ops
+typedef int portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define taskENTER_CRITICAL(mux)      ((void)(mux))
+#define taskEXIT_CRITICAL(mux)       ((void)(mux))
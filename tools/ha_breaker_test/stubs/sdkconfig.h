@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in: the Kconfig defaults (main/Kconfig.projbuild)
+#define CONFIG_HA_TIMEOUT_MIN_MS       300
+#define CONFIG_HA_TIMEOUT_MAX_MS       5000
+#define CONFIG_HA_TIMEOUT_RTT_FACTOR   3
+#define CONFIG_HA_BREAKER_FAILURES     3
+#define CONFIG_HA_BREAKER_MAX_OPEN_MS  30000
@@ -0,0 +1,284 @@
+/*
+ * Host test of the HA circuit breaker and adaptive timeouts
+ * (main/ha_breaker.c)
+ *
+ * The breaker cases drive ha_breaker_allow()/ha_breaker_record() by hand
+ * on a clock the test advances. The last case plays a scripted HA that goes
+ * down and comes back while a client sends a request every 250 ms, as the
+ * poll loop does, and counts how many requests reach the network while HA
+ * is down and how long recovery takes. The defaults of main/Kconfig.projbuild
+ * are in stubs/sdkconfig.h.
+ *
+ *     make run
+ */
+
+#include "ha_breaker.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// ---- Stand-ins for the device ----
+
+static int64_t  s_now_us;
+static uint32_t s_rng = 0x9E3779B9;
+
+int64_t esp_timer_get_time(void)
+{
+    return s_now_us;
+}
+
+uint32_t esp_random(void)
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static void advance_ms(int64_t ms)
+{
+    s_now_us += ms * 1000;
+}
+
+// ---- Helpers ----
+
+static int s_failures;
+
+#define CHECK(cond)                                                           \
+    do {                                                                      \
+        if (!(cond)) {                                                        \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            s_failures++;                                                     \
+        }                                                                     \
+    } while (0)
+
+// A success resets the breaker completely: closed, first cool-down
+static void reset(void)
+{
+    s_now_us = 1000 * 1000000LL;
+    ha_breaker_record(true);
+}
+
+static void fail_times(int n)
+{
+    for (int i = 0; i < n; i++) {
+        CHECK(ha_breaker_allow());
+        ha_breaker_record(false);
+    }
+}
+
+// Milliseconds until the open breaker lets the next probe through
+static int64_t ms_until_probe(void)
+{
+    int64_t ms = 0;
+    while (!ha_breaker_allow()) {
+        advance_ms(10);
+        ms += 10;
+        if (ms > 10LL * CONFIG_HA_BREAKER_MAX_OPEN_MS) return -1;
+    }
+    return ms;
+}
+
+// ---- Circuit breaker ----
+
+static void test_trip_and_recover(void)
+{
+    reset();
+    fail_times(CONFIG_HA_BREAKER_FAILURES - 1);
+    CHECK(ha_breaker_state() == HA_BREAKER_CLOSED);
+
+    // A success in between starts the count again
+    CHECK(ha_breaker_allow());
+    ha_breaker_record(true);
+    fail_times(CONFIG_HA_BREAKER_FAILURES - 1);
+    CHECK(ha_breaker_state() == HA_BREAKER_CLOSED);
+
+    fail_times(1);
+    CHECK(ha_breaker_state() == HA_BREAKER_OPEN);
+    CHECK(!ha_breaker_allow());
+
+    CHECK(ms_until_probe() == 1000);
+    CHECK(ha_breaker_state() == HA_BREAKER_HALF_OPEN);
+    ha_breaker_record(true);
+    CHECK(ha_breaker_state() == HA_BREAKER_CLOSED);
+    CHECK(ha_breaker_allow());
+    ha_breaker_record(true);
+}
+
+// Only the first caller after the cool-down gets through; everyone else
+// fails fast until the probe is recorded
+static void test_single_probe(void)
+{
+    reset();
+    fail_times(CONFIG_HA_BREAKER_FAILURES);
+    advance_ms(1000);
+
+    CHECK(ha_breaker_allow());
+    int extra = 0;
+    for (int i = 0; i < 50; i++) {
+        advance_ms(100);
+        if (ha_breaker_allow()) extra++;
+    }
+    CHECK(extra == 0);
+    CHECK(ha_breaker_state() == HA_BREAKER_HALF_OPEN);
+
+    ha_breaker_record(false);
+    CHECK(ha_breaker_state() == HA_BREAKER_OPEN);
+    CHECK(!ha_breaker_allow());
+}
+
+// Each failed probe doubles the cool-down up to the maximum; a success
+// brings it back to the first one
+static void test_cool_down_doubling(void)
+{
+    reset();
+    fail_times(CONFIG_HA_BREAKER_FAILURES);
+
+    int64_t expect = 1000;
+    for (int probe = 0; probe < 8; probe++) {
+        int64_t ms = ms_until_probe();
+        CHECK(ms == expect);
+        ha_breaker_record(false);
+        expect = expect * 2 > CONFIG_HA_BREAKER_MAX_OPEN_MS ? CONFIG_HA_BREAKER_MAX_OPEN_MS : expect * 2;
+    }
+    CHECK(expect == CONFIG_HA_BREAKER_MAX_OPEN_MS);
+
+    CHECK(ms_until_probe() == CONFIG_HA_BREAKER_MAX_OPEN_MS);
+    ha_breaker_record(true);
+    fail_times(CONFIG_HA_BREAKER_FAILURES);
+    CHECK(ms_until_probe() == 1000);
+    ha_breaker_record(true);
+}
+
+// ---- Adaptive timeouts ----
+
+static void test_timeout_clamp(void)
+{
+    ha_rtt_t rtt = { 0 };
+
+    // Too few samples: the maximum
+    for (int i = 0; i < 7; i++) ha_rtt_observe(&rtt, 20);
+    CHECK(ha_rtt_timeout_ms(&rtt) == CONFIG_HA_TIMEOUT_MAX_MS);
+
+    // A fast HA: p99 times the factor is below the minimum
+    ha_rtt_observe(&rtt, 20);
+    CHECK(ha_rtt_timeout_ms(&rtt) == CONFIG_HA_TIMEOUT_MIN_MS);
+
+    // p99 of 32 is the slowest sample
+    for (int i = 0; i < HA_RTT_WINDOW - 1; i++) ha_rtt_observe(&rtt, 150);
+    ha_rtt_observe(&rtt, 400);
+    CHECK(rtt.count == HA_RTT_WINDOW);
+    CHECK(ha_rtt_timeout_ms(&rtt) == 400 * CONFIG_HA_TIMEOUT_RTT_FACTOR);
+
+    // The outlier leaves the window after 32 newer samples
+    for (int i = 0; i < HA_RTT_WINDOW; i++) ha_rtt_observe(&rtt, 150);
+    CHECK(ha_rtt_timeout_ms(&rtt) == 150 * CONFIG_HA_TIMEOUT_RTT_FACTOR);
+
+    // A slow HA (or observed timeouts) is capped at the maximum, even
+    // beyond what a sample can hold
+    ha_rtt_observe(&rtt, 2000);
+    CHECK(ha_rtt_timeout_ms(&rtt) == CONFIG_HA_TIMEOUT_MAX_MS);
+    ha_rtt_observe(&rtt, 100000);
+    CHECK(rtt.samples[(rtt.next + HA_RTT_WINDOW - 1) % HA_RTT_WINDOW] == UINT16_MAX);
+    CHECK(ha_rtt_timeout_ms(&rtt) == CONFIG_HA_TIMEOUT_MAX_MS);
+}
+
+// Full jitter: uniform in [0, min(200 << attempt, 3000)]
+static void test_backoff_bounds(void)
+{
+    static const uint32_t caps[] = { 200, 400, 800, 1600, 3000, 3000, 3000 };
+    for (int attempt = 0; attempt < 7; attempt++) {
+        uint32_t lo = UINT32_MAX, hi = 0;
+        for (int i = 0; i < 20000; i++) {
+            uint32_t ms = ha_backoff_ms(attempt);
+            if (ms < lo) lo = ms;
+            if (ms > hi) hi = ms;
+        }
+        CHECK(hi <= caps[attempt]);
+        CHECK(hi >= caps[attempt] * 95 / 100);
+        CHECK(lo <= caps[attempt] * 5 / 100);
+    }
+    CHECK(ha_backoff_ms(100) <= 3000);
+}
+
+// ---- Scripted HA ----
+
+typedef struct {
+    int64_t until_ms;   // end of this phase, from the start of the script
+    bool    up;
+} phase_t;
+
+// A short blip, then a restart long enough for several failed probes
+static const phase_t s_script[] = {
+    { 10000, true },
+    { 12000, false },
+    { 30000, true },
+    { 75000, false },
+    { 120000, true },
+};
+
+#define REQUEST_EVERY_MS 250
+
+static void test_scripted_outages(void)
+{
+    reset();
+    int64_t start_us = s_now_us;
+    size_t phase = 0;
+    int sent_down = 0, rejected = 0;
+    int64_t back_up_ms = -1;
+
+    printf("scripted HA, a request every %d ms:\n", REQUEST_EVERY_MS);
+    for (int64_t t = 0; phase < sizeof(s_script) / sizeof(s_script[0]); t += REQUEST_EVERY_MS) {
+        s_now_us = start_us + t * 1000;
+        if (t >= s_script[phase].until_ms) {
+            const phase_t *p = &s_script[phase];
+            if (!p->up) {
+                printf("  down %6.1f s: %3d requests reached the network, %3d failed fast\n",
+                       (p->until_ms - (phase ? s_script[phase - 1].until_ms : 0)) / 1000.0, sent_down, rejected);
+                // At least the trip; over a long outage only the probes
+                // reach the network, far fewer than the poll loop sends
+                CHECK(sent_down >= CONFIG_HA_BREAKER_FAILURES);
+                if (p->until_ms - s_script[phase - 1].until_ms >= 10000) CHECK(sent_down < rejected / 4);
+            }
+            sent_down = rejected = 0;
+            back_up_ms = p->up ? -1 : t;
+            if (++phase == sizeof(s_script) / sizeof(s_script[0])) break;
+        }
+
+        bool up = s_script[phase].up;
+        if (!ha_breaker_allow()) {
+            rejected++;
+            continue;
+        }
+        if (!up) sent_down++;
+        ha_breaker_record(up);
+
+        if (up && back_up_ms >= 0) {
+            int64_t ms = t - back_up_ms;
+            printf("  HA back: first answer after %.2f s\n", ms / 1000.0);
+            // Never longer than the longest cool-down plus one request
+            CHECK(ms <= CONFIG_HA_BREAKER_MAX_OPEN_MS + REQUEST_EVERY_MS);
+            back_up_ms = -1;
+        }
+        CHECK(!up || ha_breaker_state() == HA_BREAKER_CLOSED);
+    }
+}
+
+int main(void)
+{
+    ha_breaker_init();
+
+    test_trip_and_recover();
+    test_single_probe();
+    test_cool_down_doubling();
+    test_timeout_clamp();
+    test_backoff_bounds();
+    test_scripted_outages();
+
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return EXIT_FAILURE;
+    }
+    printf("ha_breaker: all cases passed\n");
+    return EXIT_SUCCESS;
+}
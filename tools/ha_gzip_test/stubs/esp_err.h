@@ -0,0 +1,7 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF error codes ha_gzip.c returns
+typedef int esp_err_t;
+
+#define ESP_OK         0
+#define ESP_ERR_NO_MEM 0x101
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdlib.h>
+
+// Host stand-in: one heap, capabilities ignored
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+#define heap_caps_malloc(size, caps)        malloc(size)
+#define heap_caps_calloc(n, size, caps)     calloc(n, size)
+#define heap_caps_free(ptr)                 free(ptr)
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in: the Kconfig default (main/Kconfig.projbuild)
+#define CONFIG_HA_HTTP_GZIP_BODY_MAX 16384
@@ -0,0 +1,204 @@
+/*
+ * Host test of the streaming gunzip (main/ha_gzip.c) against the system
+ * zlib
+ *
+ * Bodies shaped like HA's JSON are gzipped here and fed back in 1-byte
+ * chunks, odd-sized chunks, chunks of the engine's receive buffer and all
+ * at once. Each run checks the kept output, that the stream was followed
+ * to its end (also past CONFIG_HA_HTTP_GZIP_BODY_MAX, where output goes to
+ * the discard buffer), and reports compressed and plain size and decode
+ * time. Corrupt streams must leave `failed` set; ha_gzip_begin() must make
+ * the same state usable again.
+ *
+ *     make run
+ */
+
+#include "ha_gzip.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define OUT_CAP     CONFIG_HA_HTTP_GZIP_BODY_MAX
+#define RX_CHUNK    2815        // RX_BUF_SIZE - 1 in ha_engine.c
+
+// ---- Helpers ----
+
+static int s_failures;
+
+#define CHECK(cond)                                                           \
+    do {                                                                      \
+        if (!(cond)) {                                                        \
+            fprintf(stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, __func__, #cond); \
+            s_failures++;                                                     \
+        }                                                                     \
+    } while (0)
+
+typedef struct {
+    char  *p;
+    size_t len;
+} buf_t;
+
+// A /api/states dump: `n` entities with attributes, like HA sends
+static buf_t states_json(int n)
+{
+    size_t cap = (size_t)n * 512 + 16;
+    buf_t b = { malloc(cap), 0 };
+    b.len += sprintf(b.p, "[");
+    for (int i = 0; i < n; i++) {
+        b.len += sprintf(b.p + b.len,
+            "%s{\"entity_id\":\"light.room_%d\",\"state\":\"%s\",\"attributes\":{"
+            "\"supported_color_modes\":[\"color_temp\",\"xy\"],\"color_mode\":\"color_temp\","
+            "\"brightness\":%d,\"color_temp_kelvin\":%d,\"min_color_temp_kelvin\":2202,"
+            "\"max_color_temp_kelvin\":6535,\"friendly_name\":\"Room %d light\","
+            "\"supported_features\":40},\"last_changed\":\"2026-10-18T%02d:%02d:%02d.%06d+00:00\","
+            "\"context\":{\"id\":\"01J%08X%08X\",\"parent_id\":null,\"user_id\":null}}",
+            i ? "," : "", i, i % 3 ? "on" : "off", (i * 37) % 256, 2700 + (i * 53) % 3800, i,
+            i % 24, i % 60, (i * 7) % 60, (i * 7919) % 1000000, i * 2654435761u, i ^ 0x5bd1e995);
+    }
+    b.len += sprintf(b.p + b.len, "]");
+    return b;
+}
+
+static buf_t gzip(const buf_t *in)
+{
+    z_stream zs = { 0 };
+    deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    buf_t out = { malloc(deflateBound(&zs, in->len)), 0 };
+    zs.next_in   = (Bytef *)in->p;
+    zs.avail_in  = in->len;
+    zs.next_out  = (Bytef *)out.p;
+    zs.avail_out = deflateBound(&zs, in->len);
+    deflate(&zs, Z_FINISH);
+    out.len = zs.total_out;
+    deflateEnd(&zs);
+    return out;
+}
+
+// Feed `gz` in chunks of `chunk` bytes (0: all at once)
+static bool feed(ha_gzip_t *g, const buf_t *gz, int chunk)
+{
+    bool ok = true;
+    for (size_t at = 0; at < gz->len; ) {
+        size_t n = chunk && gz->len - at > (size_t)chunk ? (size_t)chunk : gz->len - at;
+        ok = ha_gzip_feed(g, gz->p + at, n) && ok;
+        at += n;
+    }
+    return ok;
+}
+
+// inflate() only reports Z_STREAM_END again once the trailer was read
+static bool at_stream_end(ha_gzip_t *g)
+{
+    char c;
+    g->zs.next_in   = NULL;
+    g->zs.avail_in  = 0;
+    g->zs.next_out  = (Bytef *)&c;
+    g->zs.avail_out = 1;
+    return inflate(&g->zs, Z_FINISH) == Z_STREAM_END;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+// ---- Cases ----
+
+static const int s_chunks[] = { 1, 7, 13, 509, RX_CHUNK, 0 };
+
+static void check_body(ha_gzip_t *g, const buf_t *plain, const char *what)
+{
+    buf_t gz = gzip(plain);
+    size_t keep = plain->len < OUT_CAP ? plain->len : OUT_CAP;
+    printf("%s: %zu B gzip -> %zu B plain, %zu kept\n", what, gz.len, plain->len, keep);
+
+    for (size_t c = 0; c < sizeof(s_chunks) / sizeof(s_chunks[0]); c++) {
+        CHECK(ha_gzip_begin(g) == ESP_OK);
+        double t0 = now_ms();
+        CHECK(feed(g, &gz, s_chunks[c]));
+        double ms = now_ms() - t0;
+
+        CHECK(!g->failed);
+        CHECK((size_t)g->out_len == keep);
+        CHECK(memcmp(g->out, plain->p, keep) == 0 && g->out[keep] == '\0');
+        CHECK(g->zs.total_in == gz.len && g->zs.total_out == plain->len);
+        CHECK(at_stream_end(g));
+        if (s_chunks[c])
+            printf("  %5d B chunks  %7.2f ms\n", s_chunks[c], ms);
+        else
+            printf("  whole body    %7.2f ms\n", ms);
+    }
+    free(gz.p);
+}
+
+// A flipped bit inside the deflate data, and a wrong CRC in the trailer
+static void test_corrupt(ha_gzip_t *g)
+{
+    buf_t plain = states_json(200);
+    buf_t gz = gzip(&plain);
+    size_t where[] = { gz.len / 2, gz.len - 8 };
+
+    for (int k = 0; k < 2; k++) {
+        gz.p[where[k]] ^= 0x10;
+        for (size_t c = 0; c < sizeof(s_chunks) / sizeof(s_chunks[0]); c++) {
+            CHECK(ha_gzip_begin(g) == ESP_OK);
+            CHECK(!feed(g, &gz, s_chunks[c]));
+            CHECK(g->failed);
+            // Stays failed; output so far is kept and terminated
+            int kept = g->out_len;
+            CHECK(!ha_gzip_feed(g, gz.p, 1));
+            CHECK(g->failed && g->out_len == kept && g->out[kept] == '\0');
+        }
+        gz.p[where[k]] ^= 0x10;
+    }
+    printf("corrupt streams: rejected\n");
+    free(gz.p);
+    free(plain.p);
+}
+
+// After a failed and an oversized body, the same state decodes a small one
+static void test_reuse(ha_gzip_t *g)
+{
+    char *out = g->out;
+    buf_t small = states_json(3);
+    buf_t gz = gzip(&small);
+
+    CHECK(ha_gzip_begin(g) == ESP_OK);
+    CHECK(!g->failed && g->out_len == 0 && g->out == out);
+    CHECK(feed(g, &gz, 5));
+    CHECK((size_t)g->out_len == small.len && strcmp(g->out, small.p) == 0);
+    CHECK(at_stream_end(g));
+    printf("reuse after inflateReset: ok\n");
+    free(gz.p);
+    free(small.p);
+}
+
+int main(void)
+{
+    static ha_gzip_t g;
+
+    buf_t one = states_json(1);
+    buf_t room = states_json(20);
+    buf_t dump = states_json(1250);     // about 500 KB, well past the cap
+    check_body(&g, &one, "one entity");
+    check_body(&g, &room, "one room");
+    check_body(&g, &dump, "full /api/states dump");
+    CHECK(dump.len > 400000);
+
+    test_corrupt(&g);
+    test_reuse(&g);
+
+    free(one.p);
+    free(room.p);
+    free(dump.p);
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return EXIT_FAILURE;
+    }
+    printf("ha_gzip: all cases passed\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Offline view of a `heatmap dump` (main/heatmap.c).
+
+Reads a serial log (file or stdin), takes the last complete "HM begin" ..
+"HM end" block, and prints:
+
+  - the redraw grid as shades, one character per cell, hottest cell = '@'
+  - the render time, dirty share and areas-per-frame histograms
+  - the most frequently invalidated rectangles and the object under each
+  - the recorded frames with the largest dirty share
+
+    idf.py monitor | tee panel.log       # then "heatmap dump" on the console
+    ./heatmap.py panel.log
+    ./heatmap.py panel.log --pgm heat.pgm   # grayscale image, one pixel per screen pixel
+"""
+
+import argparse
+import re
+import sys
+
+SHADES = " .:-=+*#%@"
+
+
+def parse(lines):
+    dump = None
+    for line in lines:
+        i = line.find("HM ")
+        if i < 0:
+            continue
+        words = line[i + 3:].strip().split(" ")
+        kind, rest = words[0], words[1:]
+        if kind == "begin":
+            dump = {"meta": dict(w.split("=", 1) for w in rest if "=" in w),
+                    "grid": [], "hist": {}, "rects": [], "frames": []}
+        elif dump is None:
+            continue
+        elif kind == "grid":
+            dump["grid"].append([int(v) for v in rest[1:]])
+        elif kind == "hist":
+            dump["hist"][rest[0]] = [tuple(b.split(":")) for b in rest[1:]]
+        elif kind == "rect":
+            m = re.match(r"(\S+) hits=(\d+) owner=(.*)", " ".join(rest))
+            dump["rects"].append((tuple(int(v) for v in m[1].split(",")), int(m[2]), m[3]))
+        elif kind == "frame":
+            us = int(rest[1].split("=")[1])
+            areas = [tuple(int(v) for v in a.split(",")) for a in rest[3:]]
+            dump["frames"].append((int(rest[0]), us, areas))
+        elif kind == "end":
+            last, dump = dump, None
+            yield last
+
+
+def area(r):
+    return (r[2] - r[0] + 1) * (r[3] - r[1] + 1)
+
+
+def report(d):
+    meta = d["meta"]
+    frames = int(meta["frames"])
+    w, h = int(meta["w"]), int(meta["h"])
+    print(f"{frames} frames recorded, {w}x{h}, {meta['cell']} px cells")
+    hottest = max((v for row in d["grid"] for v in row), default=0)
+    print("\nredraws per cell (share of frames):")
+    for row in d["grid"]:
+        line = "".join(SHADES[(v * (len(SHADES) - 1) + hottest - 1) // hottest] if hottest and v else " "
+                       for v in row)
+        print(f"  |{line}|  max {max(row) * 100 // max(frames, 1):3d}%")
+
+    for name, buckets in d["hist"].items():
+        total = sum(int(c) for _, c in buckets) or 1
+        cells = "  ".join(f"<={b}:{int(c) * 100 // total}%" for b, c in buckets if int(c))
+        print(f"\n{name}: {cells}")
+
+    print("\nmost invalidated rectangles:")
+    for r, hits, owner in d["rects"][:12]:
+        print(f"  {hits:6d}x  {r[2] - r[0] + 1:3d}x{r[3] - r[1] + 1:<3d} at {r[0]},{r[1]}  "
+              f"({area(r) * 100 // (w * h)}% of screen)  {owner}")
+
+    print("\nlargest recorded frames:")
+    big = sorted(d["frames"], key=lambda f: -sum(area(a) for a in f[2]))[:8]
+    for n, us, areas in big:
+        t = f"{us / 1000:.1f} ms" if us else "untimed"
+        rects = " ".join(f"{a[2] - a[0] + 1}x{a[3] - a[1] + 1}@{a[0]},{a[1]}" for a in areas)
+        print(f"  #{n}: {t}, {len(areas)} area(s): {rects}")
+
+
+def write_pgm(d, path):
+    meta = d["meta"]
+    w, h, cell = int(meta["w"]), int(meta["h"]), int(meta["cell"])
+    hottest = max((v for row in d["grid"] for v in row), default=0) or 1
+    with open(path, "wb") as f:
+        f.write(b"P5 %d %d 255\n" % (w, h))
+        for y in range(h):
+            row = d["grid"][y // cell]
+            f.write(bytes(row[x // cell] * 255 // hottest for x in range(w)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("log", nargs="?", help="serial log (default: stdin)")
+    ap.add_argument("--pgm", metavar="FILE", help="also write the grid as a grayscale image")
+    args = ap.parse_args()
+
+    with (open(args.log, errors="replace") if args.log else sys.stdin) as f:
+        dumps = list(parse(f))
+    if not dumps:
+        sys.exit("no complete heatmap dump (HM begin .. HM end) in the input")
+    report(dumps[-1])
+    if args.pgm:
+        write_pgm(dumps[-1], args.pgm)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,347 @@
+#!/usr/bin/env python3
+"""Pack the entity icons into one A8 atlas (run by main/CMakeLists.txt).
+
+Scans a source file (main/rooms.c) for ICON_<NAME> references and
+rasterizes svg/<name>.svg for each one it finds (name lower-cased, '_' ->
+'-'), so only icons that configured entities use end up in flash. Each
+icon is rendered at --size px with anti-aliasing, cropped to its ink, and
+shelf-packed into a single 8-bit alpha image. The output:
+
+  icons.h        icon_id_t (ICON_NONE, then one id per icon) and ICON_SIZE
+  icons_atlas.c  the atlas pixels and icon_rects[], each icon's rectangle in
+                 the atlas and its offset inside the ICON_SIZE square
+
+SVGs need a viewBox and one or more <path d=...> (M L H V C S Q T A Z,
+absolute and relative), filled with the nonzero rule. Single-colour 24x24
+icons such as Material Design Icons work as they are.
+
+    ./iconpack.py --svg svg --scan ../../main/rooms.c --size 24 --out /tmp/icons
+    ./iconpack.py --svg svg --preview lightbulb thermometer   # ASCII render
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+SUBSAMPLES = 8          # per axis, per pixel
+CURVE_STEPS = 16
+SHADES = " .:-=+*#%@"
+
+
+# ---- SVG paths ----
+
+def tokenize(d):
+    for m in re.finditer(r"([MmLlHhVvCcSsQqTtAaZz])|([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)", d):
+        yield m[1] or float(m[2])
+
+
+def arc_points(p0, rx, ry, phi, large, sweep, p1):
+    """Endpoint to center parameterization (SVG 1.1, F.6.5)."""
+    if p0 == p1:
+        return []
+    if rx == 0 or ry == 0:
+        return [p1]
+    rx, ry = abs(rx), abs(ry)
+    c, s = math.cos(math.radians(phi)), math.sin(math.radians(phi))
+    dx, dy = (p0[0] - p1[0]) / 2, (p0[1] - p1[1]) / 2
+    x1, y1 = c * dx + s * dy, -s * dx + c * dy
+    lam = x1 * x1 / (rx * rx) + y1 * y1 / (ry * ry)
+    if lam > 1:
+        rx, ry = rx * math.sqrt(lam), ry * math.sqrt(lam)
+    num = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1
+    den = rx * rx * y1 * y1 + ry * ry * x1 * x1
+    k = math.sqrt(max(0.0, num / den)) * (-1 if large == sweep else 1)
+    cx1, cy1 = k * rx * y1 / ry, -k * ry * x1 / rx
+    cx = c * cx1 - s * cy1 + (p0[0] + p1[0]) / 2
+    cy = s * cx1 + c * cy1 + (p0[1] + p1[1]) / 2
+    t0 = math.atan2((y1 - cy1) / ry, (x1 - cx1) / rx)
+    t1 = math.atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx)
+    dt = t1 - t0
+    if sweep and dt < 0:
+        dt += 2 * math.pi
+    elif not sweep and dt > 0:
+        dt -= 2 * math.pi
+    n = max(2, int(abs(dt) / (math.pi / 2) * CURVE_STEPS))
+    pts = []
+    for i in range(1, n + 1):
+        t = t0 + dt * i / n
+        ex, ey = rx * math.cos(t), ry * math.sin(t)
+        pts.append((c * ex - s * ey + cx, s * ex + c * ey + cy))
+    return pts
+
+
+def bezier(points, steps=CURVE_STEPS):
+    out = []
+    for i in range(1, steps + 1):
+        t = i / steps
+        pts = list(points)
+        while len(pts) > 1:
+            pts = [(a[0] + (b[0] - a[0]) * t, a[1] + (b[1] - a[1]) * t) for a, b in zip(pts, pts[1:])]
+        out.append(pts[0])
+    return out
+
+
+def flatten(d):
+    """Path data -> list of closed polygons."""
+    tokens = list(tokenize(d))
+    polys, poly = [], []
+    cur = start = (0.0, 0.0)
+    ctrl = None             # last control point, for S and T
+    cmd, i = None, 0
+
+    def num():
+        nonlocal i
+        v = tokens[i]
+        i += 1
+        return v
+
+    while i < len(tokens):
+        if isinstance(tokens[i], str):
+            cmd = num()
+        rel = cmd.islower()
+        op = cmd.upper()
+        base = cur if rel else (0.0, 0.0)
+        prev_ctrl, ctrl = ctrl, None
+        if op == "Z":
+            if poly:
+                polys.append(poly)
+            poly, cur = [], start
+            continue
+        if op == "M":
+            if poly:
+                polys.append(poly)
+            cur = start = (base[0] + num(), base[1] + num())
+            poly = [cur]
+            cmd = "l" if rel else "L"   # further pairs are line-tos
+            continue
+        if op == "L":
+            cur = (base[0] + num(), base[1] + num())
+            pts = [cur]
+        elif op == "H":
+            cur = ((cur[0] if rel else 0.0) + num(), cur[1])
+            pts = [cur]
+        elif op == "V":
+            cur = (cur[0], (cur[1] if rel else 0.0) + num())
+            pts = [cur]
+        elif op in "CS":
+            if op == "C":
+                c1 = (base[0] + num(), base[1] + num())
+            else:
+                c1 = (2 * cur[0] - prev_ctrl[0], 2 * cur[1] - prev_ctrl[1]) if prev_ctrl else cur
+            c2 = (base[0] + num(), base[1] + num())
+            end = (base[0] + num(), base[1] + num())
+            pts, ctrl, cur = bezier([cur, c1, c2, end]), c2, end
+        elif op in "QT":
+            if op == "Q":
+                c1 = (base[0] + num(), base[1] + num())
+            else:
+                c1 = (2 * cur[0] - prev_ctrl[0], 2 * cur[1] - prev_ctrl[1]) if prev_ctrl else cur
+            end = (base[0] + num(), base[1] + num())
+            pts, ctrl, cur = bezier([cur, c1, end]), c1, end
+        elif op == "A":
+            rx, ry, phi, large, sweep = num(), num(), num(), num(), num()
+            end = (base[0] + num(), base[1] + num())
+            pts, cur = arc_points(cur, rx, ry, phi, int(large), int(sweep), end), end
+        else:
+            sys.exit(f"unsupported path command {cmd}")
+        if not poly:
+            poly = [start]
+        poly.extend(pts)
+    if poly:
+        polys.append(poly)
+    return polys
+
+
+def load_svg(path):
+    text = open(path).read()
+    vb = re.search(r'viewBox="([^"]+)"', text)
+    if not vb:
+        sys.exit(f"{path}: no viewBox")
+    x0, y0, w, h = (float(v) for v in vb[1].replace(",", " ").split())
+    polys = []
+    for d in re.findall(r'<path[^>]*\sd="([^"]+)"', text):
+        polys += flatten(d)
+    return (x0, y0, w, h), polys
+
+
+# ---- Rasterizer ----
+
+def rasterize(viewbox, polys, size):
+    """Nonzero fill, SUBSAMPLES x SUBSAMPLES coverage per pixel -> rows of 0..255."""
+    x0, y0, w, h = viewbox
+    sx, sy = size / w, size / h
+    edges = []
+    for poly in polys:
+        pts = [((x - x0) * sx, (y - y0) * sy) for x, y in poly]
+        for a, b in zip(pts, pts[1:] + pts[:1]):
+            if a[1] != b[1]:
+                edges.append((a, b, 1 if b[1] > a[1] else -1))
+
+    n = SUBSAMPLES
+    cov = [[0] * size for _ in range(size)]
+    for sub_y in range(size * n):
+        y = (sub_y + 0.5) / n
+        xs = []
+        for a, b, wind in edges:
+            lo, hi = (a, b) if a[1] < b[1] else (b, a)
+            if lo[1] <= y < hi[1]:
+                xs.append((a[0] + (y - a[1]) * (b[0] - a[0]) / (b[1] - a[1]), wind))
+        xs.sort()
+        row = cov[sub_y // n]
+        winding = 0
+        for (xa, wa), (xb, _) in zip(xs, xs[1:]):
+            winding += wa
+            if not winding:
+                continue
+            # Sample points x = (k + 0.5) / n inside [xa, xb)
+            k0 = max(0, math.ceil(xa * n - 0.5))
+            k1 = min(size * n, math.ceil(xb * n - 0.5))
+            for k in range(k0, k1):
+                row[k // n] += 1
+    full = n * n
+    return [[(v * 255 + full // 2) // full for v in row] for row in cov]
+
+
+def crop(rows):
+    """Bounding box of the ink: (x, y, w, h), or None for an empty icon."""
+    ys = [y for y, row in enumerate(rows) if any(row)]
+    xs = [x for x in range(len(rows[0])) if any(row[x] for row in rows)]
+    if not ys:
+        return None
+    return xs[0], ys[0], xs[-1] - xs[0] + 1, ys[-1] - ys[0] + 1
+
+
+# ---- Atlas ----
+
+def pack(sizes):
+    """Shelf packing, tallest first. Returns atlas width, height and positions."""
+    area = sum(w * h for w, h in sizes)
+    width = max(max(w for w, _ in sizes), int(math.ceil(math.sqrt(area) * 1.2)))
+    width = (width + 3) & ~3
+    order = sorted(range(len(sizes)), key=lambda i: -sizes[i][1])
+    pos = [None] * len(sizes)
+    x = y = shelf_h = 0
+    for i in order:
+        w, h = sizes[i]
+        if x + w > width:
+            x, y, shelf_h = 0, y + shelf_h, 0
+        pos[i] = (x, y)
+        x += w
+        shelf_h = max(shelf_h, h)
+    return width, y + shelf_h, pos
+
+
+def used_icons(scan_path):
+    names = re.findall(r"\bICON_([A-Z0-9_]+)\b", open(scan_path).read())
+    return sorted(set(n for n in names if n not in ("NONE", "COUNT", "SIZE")))
+
+
+def write_outputs(out_dir, source, size, names, glyphs, atlas_w, atlas_h, pos):
+    atlas = bytearray(atlas_w * atlas_h)
+    for (rows, box), (ax, ay) in zip(glyphs, pos):
+        bx, by, bw, bh = box
+        for y in range(bh):
+            atlas[(ay + y) * atlas_w + ax:(ay + y) * atlas_w + ax + bw] = bytes(rows[by + y][bx:bx + bw])
+
+    ids = [f"ICON_{n}" for n in names]
+    banner = f"/* Generated by tools/icons/iconpack.py from the icons referenced in {source}. */"
+    header = [
+        "#pragma once",
+        "",
+        banner,
+        "",
+        f"#define ICON_SIZE {size}",
+        "",
+        "typedef enum {",
+        "    ICON_NONE,",
+        *[f"    {i}," for i in ids],
+        "    ICON_COUNT,",
+        "} icon_id_t;",
+        "",
+    ]
+    src = [
+        banner,
+        "",
+        '#include "icon_atlas.h"',
+        "",
+        f"#define ATLAS_W {atlas_w}",
+        f"#define ATLAS_H {atlas_h}",
+        "",
+        "static const uint8_t atlas_map[ATLAS_W * ATLAS_H] = {",
+    ]
+    for y in range(atlas_h):
+        row = atlas[y * atlas_w:(y + 1) * atlas_w]
+        src.append("    " + ",".join(f"0x{b:02x}" for b in row) + ",")
+    src += [
+        "};",
+        "",
+        "const lv_image_dsc_t icon_atlas = {",
+        "    .header = {",
+        "        .magic  = LV_IMAGE_HEADER_MAGIC,",
+        "        .cf     = LV_COLOR_FORMAT_A8,",
+        "        .w      = ATLAS_W,",
+        "        .h      = ATLAS_H,",
+        "        .stride = ATLAS_W,",
+        "    },",
+        "    .data_size = sizeof(atlas_map),",
+        "    .data      = atlas_map,",
+        "};",
+        "",
+        "const icon_rect_t icon_rects[ICON_COUNT] = {",
+    ]
+    for i, ((_, box), (ax, ay)) in zip(ids, zip(glyphs, pos)):
+        bx, by, bw, bh = box
+        src.append(f"    [{i}] = {{ .x = {ax}, .y = {ay}, .w = {bw}, .h = {bh}, "
+                   f".ofs_x = {bx}, .ofs_y = {by} }},")
+    src += ["};", ""]
+
+    os.makedirs(out_dir, exist_ok=True)
+    # Leave unchanged files alone so dependents are not rebuilt
+    for name, lines in (("icons.h", header), ("icons_atlas.c", src)):
+        path = os.path.join(out_dir, name)
+        text = "\n".join(lines)
+        if not os.path.exists(path) or open(path).read() != text:
+            open(path, "w").write(text)
+
+
+def render(svg_dir, name, size):
+    path = os.path.join(svg_dir, name.lower().replace("_", "-") + ".svg")
+    if not os.path.exists(path):
+        sys.exit(f"ICON_{name}: no {path}")
+    rows = rasterize(*load_svg(path), size)
+    return rows, crop(rows) or (0, 0, 0, 0)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--svg", required=True, help="directory of <name>.svg icons")
+    ap.add_argument("--scan", help="source file whose ICON_<NAME> references select the icons")
+    ap.add_argument("--size", type=int, default=24, help="icon size in px (default 24)")
+    ap.add_argument("--out", help="directory for icons.h and icons_atlas.c")
+    ap.add_argument("--preview", nargs="+", metavar="NAME", help="print icons as text instead")
+    args = ap.parse_args()
+
+    if args.preview:
+        for name in args.preview:
+            rows, _ = render(args.svg, name.upper().replace("-", "_"), args.size)
+            print(name)
+            for row in rows:
+                print("".join(SHADES[v * (len(SHADES) - 1) // 255] * 2 for v in row))
+        return
+    if not args.scan or not args.out:
+        ap.error("--scan and --out are required")
+
+    names = used_icons(args.scan)
+    glyphs = [render(args.svg, n, args.size) for n in names]
+    if glyphs:
+        width, height, pos = pack([(box[2] or 1, box[3] or 1) for _, box in glyphs])
+    else:
+        width, height, pos = 4, 1, []
+    write_outputs(args.out, os.path.basename(args.scan), args.size, names, glyphs, width, height, pos)
+    print(f"iconpack: {len(names)} icons, {width}x{height} A8 atlas ({width * height} bytes)")
+
+
+if __name__ == "__main__":
+    main()
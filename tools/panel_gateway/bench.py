@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Local benchmark: gateway + synthetic HA + N simulated panels, one process.
+
+Each simulated panel speaks the device protocol over real TCP sockets and
+records what it receives. Reported:
+
+  - bytes on the wire per entity update, against the HA state JSON a panel
+    would otherwise fetch (REST) or receive (WebSocket event) for it
+  - entity updates per second delivered across all panels
+  - fan-out latency: tuple change in the gateway to frame decoded by a panel
+  - host decode time per update, CBOR frame against json.loads of the state
+    (relative only; on the device see ha_gateway_decode_cycles against
+    ha_poll_parse_cycles)
+
+    ./bench.py --panels 20 --rate 50 --seconds 10
+"""
+
+import argparse
+import asyncio
+import json
+import random
+import statistics
+import time
+
+import cbor
+import gateway as gw
+
+
+class SimPanel:
+    def __init__(self, gateway, ids):
+        self.gateway = gateway
+        self.ids = ids
+        self.bytes = 0
+        self.updates = 0
+        self.frames = 0
+        self.decode_ns = 0
+        self.latency_us = []
+
+    async def run(self, port):
+        reader, writer = await asyncio.open_connection("127.0.0.1", port)
+        writer.write(cbor.frame(self.ids))
+        await writer.drain()
+        try:
+            while True:
+                head = await reader.readexactly(2)
+                body = await reader.readexactly(int.from_bytes(head, "big"))
+                now = time.monotonic_ns()
+                t0 = time.perf_counter_ns()
+                entries = cbor.decode(body)
+                self.decode_ns += time.perf_counter_ns() - t0
+                self.frames += 1
+                self.bytes += 2 + len(body)
+                self.updates += len(entries)
+                for e in entries:
+                    changed = self.gateway.changed_ns.get(self.ids[e[0]])
+                    if changed:
+                        self.latency_us.append((now - changed) / 1000)
+        except (asyncio.IncompleteReadError, asyncio.CancelledError):
+            pass
+        finally:
+            writer.close()
+
+
+def pct(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+async def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--panels", type=int, default=20)
+    ap.add_argument("--entities", type=int, default=48, help="entities known to the fake HA")
+    ap.add_argument("--per-panel", type=int, default=24, help="entities on each panel")
+    ap.add_argument("--rate", type=float, default=50, help="HA state changes per second")
+    ap.add_argument("--seconds", type=float, default=10)
+    ap.add_argument("--port", type=int, default=18765)
+    args = ap.parse_args()
+
+    gateway = gw.Gateway()
+    server = await gateway.serve("127.0.0.1", args.port)
+    entities = gw.fake_entities(args.entities)
+    json_sizes = []
+    json_ns = []
+
+    def on_state(state):
+        # What the JSON paths would carry for the same change
+        text = json.dumps(state, separators=(",", ":"))
+        event = json.dumps({"id": 2, "type": "event", "event": {
+            "event_type": "state_changed", "data": {
+                "entity_id": state["entity_id"], "old_state": state, "new_state": state}}},
+            separators=(",", ":"))
+        t0 = time.perf_counter_ns()
+        json.loads(text)
+        json_ns.append(time.perf_counter_ns() - t0)
+        json_sizes.append((len(text), len(event)))
+
+    ha = asyncio.ensure_future(gw.run_fake_ha(gateway, entities, args.rate, on_state=on_state))
+    rng = random.Random(2)
+    panels = [SimPanel(gateway, rng.sample(entities, min(args.per_panel, len(entities))))
+              for _ in range(args.panels)]
+    tasks = [asyncio.ensure_future(p.run(args.port)) for p in panels]
+
+    # Let every panel take its full first update before measuring
+    await asyncio.sleep(0.5)
+    initial = sum(p.bytes for p in panels)
+    for p in panels:
+        p.bytes = p.updates = p.frames = p.decode_ns = 0
+        p.latency_us.clear()
+    json_sizes.clear()
+    json_ns.clear()
+
+    t0 = time.monotonic()
+    await asyncio.sleep(args.seconds)
+    elapsed = time.monotonic() - t0
+
+    for t in tasks + [ha]:
+        t.cancel()
+    await asyncio.gather(*tasks, ha, return_exceptions=True)
+    server.close()
+    await server.wait_closed()
+
+    updates = sum(p.updates for p in panels)
+    wire = sum(p.bytes for p in panels)
+    frames = sum(p.frames for p in panels)
+    latency = [v for p in panels for v in p.latency_us]
+    rest_json = statistics.mean(s[0] for s in json_sizes) if json_sizes else 0
+    ws_json = statistics.mean(s[1] for s in json_sizes) if json_sizes else 0
+    per_update = wire / updates if updates else 0
+
+    print(f"{args.panels} panels x {args.per_panel} entities, {args.rate:g} HA changes/s, {elapsed:.1f} s")
+    print(f"  initial full sync       {initial} B total, {initial / max(1, args.panels):.0f} B per panel")
+    print(f"  entity updates          {updates} ({updates / elapsed:.0f}/s across panels) in {frames} frames")
+    print(f"  wire bytes per update   {per_update:.1f} B (CBOR, incl. frame header)")
+    print(f"  HA JSON per update      {rest_json:.0f} B state object, {ws_json:.0f} B state_changed event"
+          f"  ->  {rest_json / per_update if per_update else 0:.0f}x / {ws_json / per_update if per_update else 0:.0f}x")
+    print(f"  fan-out latency         p50 {pct(latency, 50) / 1000:.2f} ms, p99 {pct(latency, 99) / 1000:.2f} ms,"
+          f" max {max(latency, default=0) / 1000:.2f} ms")
+    if frames and json_ns:
+        print(f"  host decode per update  CBOR {sum(p.decode_ns for p in panels) / updates / 1000:.1f} us,"
+              f" json.loads {statistics.mean(json_ns) / 1000:.1f} us")
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
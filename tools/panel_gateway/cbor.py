@@ -0,0 +1,71 @@
+"""Minimal CBOR (RFC 8949) for the panel gateway protocol.
+
+Only what main/ha_gateway.c speaks: unsigned and negative integers, text
+strings and arrays, with lengths up to 32 bits.
+"""
+
+UINT, NEGINT, TEXT, ARRAY = 0, 1, 3, 4
+
+
+def _head(major, value):
+    if value < 24:
+        return bytes([major << 5 | value])
+    if value < 0x100:
+        return bytes([major << 5 | 24, value])
+    if value < 0x10000:
+        return bytes([major << 5 | 25]) + value.to_bytes(2, "big")
+    return bytes([major << 5 | 26]) + value.to_bytes(4, "big")
+
+
+def encode(obj):
+    if isinstance(obj, bool):
+        raise TypeError("bool is not part of the protocol")
+    if isinstance(obj, int):
+        return _head(UINT, obj) if obj >= 0 else _head(NEGINT, -1 - obj)
+    if isinstance(obj, str):
+        raw = obj.encode()
+        return _head(TEXT, len(raw)) + raw
+    if isinstance(obj, (list, tuple)):
+        return _head(ARRAY, len(obj)) + b"".join(encode(x) for x in obj)
+    raise TypeError(f"cannot encode {type(obj).__name__}")
+
+
+def decode(buf):
+    obj, end = _decode(memoryview(buf), 0)
+    if end != len(buf):
+        raise ValueError("trailing bytes")
+    return obj
+
+
+def _decode(buf, pos):
+    major, info = buf[pos] >> 5, buf[pos] & 0x1F
+    pos += 1
+    if info < 24:
+        value = info
+    elif info in (24, 25, 26):
+        n = 1 << (info - 24)
+        value = int.from_bytes(buf[pos:pos + n], "big")
+        pos += n
+    else:
+        raise ValueError(f"unsupported additional info {info}")
+    if major == UINT:
+        return value, pos
+    if major == NEGINT:
+        return -1 - value, pos
+    if major == TEXT:
+        return bytes(buf[pos:pos + value]).decode(), pos + value
+    if major == ARRAY:
+        items = []
+        for _ in range(value):
+            item, pos = _decode(buf, pos)
+            items.append(item)
+        return items, pos
+    raise ValueError(f"unsupported major type {major}")
+
+
+def frame(obj):
+    """One protocol message: 2-byte big-endian length, then the CBOR item."""
+    body = encode(obj)
+    if len(body) > 0xFFFF:
+        raise ValueError("frame too large")
+    return len(body).to_bytes(2, "big") + body
@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+"""Panel gateway: one HA subscription, compact state deltas for every panel.
+
+Runs next to Home Assistant. It holds a single WebSocket connection to HA
+(get_states, then subscribe_events state_changed) and reduces each light or
+cover state to the tuple the panels use:
+
+    (state, brightness, color_temp_kelvin, current_position)
+
+Panels connect over plain TCP and send a hello with their entity ids; from
+then on they receive only the entities whose tuple changed. Attribute churn
+that does not touch the tuple (friendly_name, last_updated, ...) never
+reaches a panel. The wire format is described in main/ha_gateway.h.
+
+    ./gateway.py --ha-url http://homeassistant.local:8123 --token $HA_TOKEN
+    ./gateway.py --fake-ha 50          # synthetic HA, 50 changes/s (no aiohttp needed)
+"""
+
+import argparse
+import asyncio
+import json
+import logging
+import os
+import random
+import time
+
+import cbor
+
+log = logging.getLogger("panel_gateway")
+
+HEARTBEAT_S = 15
+FRAME_BUDGET = 1000     # device frame buffer is 1024 bytes
+DOMAINS = ("light.", "cover.")
+
+STATE_CODES = {"on": 1, "open": 1, "opening": 2, "closing": 3}
+
+
+def encode_state(state):
+    """HA state object -> protocol tuple (entity_values_t conventions)."""
+    attrs = state.get("attributes") or {}
+
+    def num(key, unknown):
+        v = attrs.get(key)
+        return int(v) if isinstance(v, (int, float)) and not isinstance(v, bool) else unknown
+
+    return (STATE_CODES.get(state.get("state"), 0),
+            num("brightness", -1),
+            num("color_temp_kelvin", 0),
+            num("current_position", -1))
+
+
+class Panel:
+    """One connected panel: its entity list, what it has been sent, what is dirty."""
+
+    def __init__(self, gateway, ids, writer):
+        self.gateway = gateway
+        self.ids = ids
+        self.writer = writer
+        self.sent = [None] * len(ids)
+        self.dirty = set(range(len(ids)))   # first update is the full set
+        self.wake = asyncio.Event()
+        self.wake.set()
+        self.peer = writer.get_extra_info("peername")
+
+    def mark(self, index):
+        self.dirty.add(index)
+        self.wake.set()
+
+    def take_entries(self):
+        entries = []
+        for i in sorted(self.dirty):
+            t = self.gateway.states.get(self.ids[i])
+            if t is not None and t != self.sent[i]:
+                self.sent[i] = t
+                entries.append([i, *t])
+        self.dirty.clear()
+        return entries
+
+    def frames(self, entries):
+        """Split entries so no frame exceeds the device buffer."""
+        out, chunk, size = [], [], 3
+        for e in entries:
+            n = len(cbor.encode(e))
+            if chunk and size + n > FRAME_BUDGET:
+                out.append(cbor.frame(chunk))
+                chunk, size = [], 3
+            chunk.append(e)
+            size += n
+        if chunk:
+            out.append(cbor.frame(chunk))
+        return out
+
+    async def run(self):
+        while True:
+            try:
+                await asyncio.wait_for(self.wake.wait(), HEARTBEAT_S)
+            except asyncio.TimeoutError:
+                pass
+            heartbeat = not self.wake.is_set()
+            self.wake.clear()
+            frames = self.frames(self.take_entries())
+            if not frames and heartbeat:
+                frames = [cbor.frame([])]
+            if not frames:
+                continue
+            data = b"".join(frames)
+            self.writer.write(data)
+            await self.writer.drain()
+            self.gateway.stats["frames"] += len(frames)
+            self.gateway.stats["bytes"] += len(data)
+
+
+class Gateway:
+    def __init__(self):
+        self.states = {}            # entity_id -> tuple
+        self.changed_ns = {}        # entity_id -> time of the last tuple change
+        self.subscribers = {}       # entity_id -> [(panel, index)]
+        self.panels = set()
+        self.stats = {"ha_events": 0, "changes": 0, "frames": 0, "bytes": 0}
+
+    def update(self, entity_id, state):
+        if not entity_id.startswith(DOMAINS):
+            return
+        self.stats["ha_events"] += 1
+        t = encode_state(state)
+        if self.states.get(entity_id) == t:
+            return
+        self.states[entity_id] = t
+        self.changed_ns[entity_id] = time.monotonic_ns()
+        self.stats["changes"] += 1
+        for panel, index in self.subscribers.get(entity_id, ()):
+            panel.mark(index)
+
+    async def handle_panel(self, reader, writer):
+        peer = writer.get_extra_info("peername")
+        panel = None
+        try:
+            head = await reader.readexactly(2)
+            ids = cbor.decode(await reader.readexactly(int.from_bytes(head, "big")))
+            if not isinstance(ids, list) or not all(isinstance(i, str) for i in ids):
+                raise ValueError("hello is not a list of entity ids")
+            panel = Panel(self, ids, writer)
+            for index, entity_id in enumerate(ids):
+                self.subscribers.setdefault(entity_id, []).append((panel, index))
+            self.panels.add(panel)
+            log.info("panel %s: %d entities", peer, len(ids))
+            sender = asyncio.ensure_future(panel.run())
+            # Panels send nothing after the hello; EOF means they left
+            await reader.read()
+            sender.cancel()
+        except (asyncio.IncompleteReadError, ConnectionError, ValueError) as e:
+            log.info("panel %s: %s", peer, e)
+        finally:
+            if panel:
+                self.panels.discard(panel)
+                for entity_id in panel.ids:
+                    subs = self.subscribers.get(entity_id, [])
+                    subs[:] = [s for s in subs if s[0] is not panel]
+            writer.close()
+
+    async def serve(self, host, port):
+        return await asyncio.start_server(self.handle_panel, host, port)
+
+
+# ---- Home Assistant ----
+
+async def run_ha(gateway, base_url, token):
+    import aiohttp
+
+    ws_url = base_url.replace("http", "ws", 1).rstrip("/") + "/api/websocket"
+    while True:
+        try:
+            async with aiohttp.ClientSession() as session, \
+                       session.ws_connect(ws_url, heartbeat=30) as ws:
+                await ws.receive_json()                     # auth_required
+                await ws.send_json({"type": "auth", "access_token": token})
+                if (await ws.receive_json()).get("type") != "auth_ok":
+                    raise RuntimeError("HA rejected the access token")
+                await ws.send_json({"id": 1, "type": "get_states"})
+                await ws.send_json({"id": 2, "type": "subscribe_events", "event_type": "state_changed"})
+                log.info("subscribed to %s", ws_url)
+                async for msg in ws:
+                    if msg.type != aiohttp.WSMsgType.TEXT:
+                        break
+                    data = json.loads(msg.data)
+                    if data.get("type") == "result" and data.get("id") == 1:
+                        for s in data.get("result") or ():
+                            gateway.update(s["entity_id"], s)
+                    elif data.get("type") == "event":
+                        ev = data["event"]["data"]
+                        if ev.get("new_state"):
+                            gateway.update(ev["entity_id"], ev["new_state"])
+        except (aiohttp.ClientError, OSError, RuntimeError) as e:
+            log.warning("HA connection: %s", e)
+        await asyncio.sleep(5)
+
+
+# ---- Synthetic HA for local benchmarks ----
+
+def fake_entities(count):
+    return [f"light.fake_{i}" if i % 2 == 0 else f"cover.fake_{i}" for i in range(count)]
+
+
+def fake_state(entity_id, rng):
+    """A state object shaped like HA's, so JSON sizes are realistic."""
+    now = time.strftime("%Y-%m-%dT%H:%M:%S.000000+00:00", time.gmtime())
+    name = entity_id.split(".")[1].replace("_", " ").title()
+    if entity_id.startswith("light."):
+        on = rng.random() < 0.6
+        attrs = {
+            "min_color_temp_kelvin": 2000, "max_color_temp_kelvin": 6535,
+            "supported_color_modes": ["color_temp"], "color_mode": "color_temp" if on else None,
+            "brightness": rng.randrange(1, 256) if on else None,
+            "color_temp_kelvin": rng.randrange(2000, 6536, 50) if on else None,
+            "friendly_name": name, "supported_features": 40,
+        }
+        state = "on" if on else "off"
+    else:
+        pos = rng.randrange(0, 101)
+        attrs = {"current_position": pos, "device_class": "shade",
+                 "friendly_name": name, "supported_features": 15}
+        state = rng.choice(["open", "opening", "closing"]) if pos else "closed"
+    return {
+        "entity_id": entity_id, "state": state, "attributes": attrs,
+        "last_changed": now, "last_reported": now, "last_updated": now,
+        "context": {"id": "01J%023d" % rng.randrange(10**22), "parent_id": None, "user_id": None},
+    }
+
+
+async def run_fake_ha(gateway, entities, rate, seed=1, on_state=None):
+    rng = random.Random(seed)
+    for e in entities:
+        gateway.update(e, fake_state(e, rng))
+    while True:
+        await asyncio.sleep(1 / rate)
+        e = rng.choice(entities)
+        s = fake_state(e, rng)
+        if on_state:
+            on_state(s)
+        gateway.update(e, s)
+
+
+# ---- Main ----
+
+async def log_stats(gateway, period):
+    last = dict(gateway.stats)
+    while True:
+        await asyncio.sleep(period)
+        now = dict(gateway.stats)
+        d = {k: now[k] - last[k] for k in now}
+        last = now
+        log.info("%d panels, %d HA events, %d changes, %d frames, %d bytes in %ds",
+                 len(gateway.panels), d["ha_events"], d["changes"], d["frames"], d["bytes"], period)
+
+
+async def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--ha-url", default=os.environ.get("HA_URL", "http://homeassistant.local:8123"))
+    ap.add_argument("--token", default=os.environ.get("HA_TOKEN", ""))
+    ap.add_argument("--host", default="0.0.0.0")
+    ap.add_argument("--port", type=int, default=8765)
+    ap.add_argument("--fake-ha", type=float, metavar="RATE", help="synthetic HA with RATE changes/s")
+    ap.add_argument("--fake-entities", type=int, default=48)
+    ap.add_argument("--stats", type=int, default=60, metavar="S", help="log counters every S seconds")
+    args = ap.parse_args()
+
+    logging.basicConfig(level=logging.INFO, format="%(asctime)s %(levelname)s %(message)s")
+    gateway = Gateway()
+    server = await gateway.serve(args.host, args.port)
+    log.info("listening on %s:%d", args.host, args.port)
+
+    if args.fake_ha:
+        source = run_fake_ha(gateway, fake_entities(args.fake_entities), args.fake_ha)
+    elif args.token:
+        source = run_ha(gateway, args.ha_url, args.token)
+    else:
+        ap.error("--token (or HA_TOKEN) is required unless --fake-ha is given")
+
+    async with server:
+        await asyncio.gather(source, log_stats(gateway, args.stats), server.serve_forever())
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        pass
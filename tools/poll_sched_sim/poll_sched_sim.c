@@ -0,0 +1,208 @@
+/*
+ * A simulated day of polling with the adaptive scheduler (main/poll_sched.c)
+ *
+ * A house of lights, switches and covers is changed from outside the
+ * panel (wall switches, other apps) at hourly rates shaped like a day at
+ * home, and from the panel itself, which boosts the entity's polling. The
+ * poll loop of mqtt.c is played on a 20 ms clock with a fixed round trip:
+ * due entities are taken, answered, and rescheduled by what the answer
+ * showed. Per hour it prints the requests sent and how late changes made
+ * outside the panel were seen; at the end the ha_poll_staleness_ms
+ * histogram the device would export after such a day.
+ *
+ * The Kconfig defaults are in stubs/sdkconfig.h; try others with
+ *
+ *     make run BASE=5000 MAX=30000 FAST=500 WINDOW=5000
+ */
+
+#include "poll_sched.h"
+#include "entity_model.h"
+#include "metrics.h"
+#include "sdkconfig.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIGHTS    16
+#define SWITCHES  4
+#define COVERS    4
+#define ENTITIES  (LIGHTS + SWITCHES + COVERS)
+
+#define TICK_MS   20
+#define RTT_MS    40        // request to answer, typical on a LAN
+#define MOVE_MS   20000     // a cover from open to closed
+#define DAY_MS    (24 * 3600 * 1000LL)
+
+// Outside changes per entity and hour, and panel commands per hour (all
+// entities together), by hour of day
+static const float s_outside_per_h[24] = {
+    0.02, 0.01, 0.01, 0.01, 0.01, 0.02, 0.30, 0.60, 0.50, 0.15, 0.10, 0.10,
+    0.15, 0.10, 0.10, 0.10, 0.20, 0.50, 0.70, 0.60, 0.50, 0.40, 0.30, 0.10,
+};
+static const float s_panel_per_h[24] = {
+    0, 0, 0, 0, 0, 0, 2, 4, 3, 1, 1, 1,
+    2, 1, 1, 1, 2, 5, 6, 6, 5, 4, 2, 1,
+};
+
+// ---- Stand-ins for the device ----
+
+static uint32_t s_rng = 0x2545F491;
+
+uint32_t esp_random(void)
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static bool chance(float per_hour)
+{
+    return esp_random() < per_hour * (TICK_MS / 3600000.0) * 4294967296.0;
+}
+
+// ---- The house ----
+
+typedef struct {
+    uint32_t value;         // HA's state
+    uint32_t seen;          // what the panel last saw
+    int64_t  moving_until;  // covers only
+    int64_t  changed_at;    // first outside change not yet seen, 0 if none
+    int64_t  answer_at;     // poll in flight, 0 if none
+} entity_t;
+
+static entity_t s_house[ENTITIES];
+
+static bool is_cover(int i)
+{
+    return i >= LIGHTS + SWITCHES;
+}
+
+static void change(int i, int64_t now, bool outside)
+{
+    entity_t *e = &s_house[i];
+    e->value++;
+    if (is_cover(i)) e->moving_until = now + MOVE_MS;
+    if (outside) {
+        if (!e->changed_at) e->changed_at = now;
+    } else {
+        e->seen = e->value;         // the panel sent it, over any unseen change
+        e->changed_at = 0;
+    }
+}
+
+// ---- Statistics ----
+
+#define DELAY_MAX 4096
+
+typedef struct {
+    uint32_t requests;
+    uint32_t outside;
+    uint32_t delays_ms[DELAY_MAX];  // outside change to the poll that saw it
+    int      n_delays;
+} hour_t;
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static uint32_t pct(const uint32_t *sorted, int n, int p)
+{
+    return n ? sorted[(n * p + 99) / 100 - 1] : 0;
+}
+
+static void print_staleness(metric_type_t type, const void *metric, void *ctx)
+{
+    if (type != METRIC_HISTOGRAM) return;
+    const metrics_histogram_t *h = metric;
+    if (strcmp(h->name, "ha_poll_staleness_ms") != 0) return;
+
+    uint32_t count = atomic_load(&h->count);
+    printf("\n%s (%lu changes seen):\n", h->name, (unsigned long)count);
+    uint32_t cum = 0;
+    for (int i = 0; i <= h->n_bounds; i++) {
+        cum += atomic_load(&h->buckets[i]);
+        if (i < h->n_bounds)
+            printf("  <= %6lu ms  %5.1f %%\n", (unsigned long)h->bounds[i], count ? 100.0 * cum / count : 0);
+        else
+            printf("  <=   +Inf     %5.1f %%\n", count ? 100.0 * cum / count : 0);
+    }
+}
+
+int main(void)
+{
+    static hour_t hours[24];
+    static uint32_t all_delays[24 * DELAY_MAX];
+    int n_all = 0;
+
+    poll_sched_init(ENTITIES, 0);
+
+    for (int64_t now_ms = 0; now_ms < DAY_MS; now_ms += TICK_MS) {
+        int64_t now = now_ms * 1000;
+        int hour = (int)(now_ms / 3600000);
+        hour_t *h = &hours[hour];
+
+        for (int i = 0; i < ENTITIES; i++) {
+            if (chance(s_outside_per_h[hour])) {
+                change(i, now, true);
+                h->outside++;
+            }
+        }
+        if (chance(s_panel_per_h[hour])) {
+            int i = esp_random() % ENTITIES;
+            change(i, now, false);
+            // Acknowledged one round trip later
+            poll_sched_boost(i, now + RTT_MS * 1000);
+        }
+
+        // Answers: what the poll saw decides the next interval
+        for (int i = 0; i < ENTITIES; i++) {
+            entity_t *e = &s_house[i];
+            if (!e->answer_at || e->answer_at > now) continue;
+            e->answer_at = 0;
+            poll_outcome_t outcome = POLL_UNCHANGED;
+            if (now < e->moving_until) outcome = POLL_MOVING;
+            else if (e->seen != e->value) outcome = POLL_CHANGED;
+            if (outcome != POLL_UNCHANGED && e->changed_at) {
+                uint32_t ms = (uint32_t)((now - e->changed_at) / 1000);
+                if (h->n_delays < DELAY_MAX) h->delays_ms[h->n_delays++] = ms;
+                all_delays[n_all++] = ms;
+                e->changed_at = 0;
+            }
+            e->seen = e->value;
+            poll_sched_done(i, outcome, now);
+        }
+
+        if (poll_sched_next_us() > now) continue;
+        int due[ENTITIES];
+        int n = poll_sched_take_due(now, due, ENTITIES);
+        for (int k = 0; k < n; k++) s_house[due[k]].answer_at = now + RTT_MS * 1000;
+        h->requests += n;
+    }
+
+    printf("%d entities (%d covers), BASE %d ms, MAX %d ms, FAST %d ms, WINDOW %d ms\n\n",
+           ENTITIES, COVERS, CONFIG_HA_POLL_BASE_MS, CONFIG_HA_POLL_MAX_MS,
+           CONFIG_HA_POLL_FAST_MS, CONFIG_HA_POLL_FAST_WINDOW_MS);
+    printf("hour  requests  outside changes  seen after p50 / p99 (s)\n");
+    uint32_t total = 0;
+    for (int i = 0; i < 24; i++) {
+        hour_t *h = &hours[i];
+        qsort(h->delays_ms, h->n_delays, sizeof(uint32_t), cmp_u32);
+        printf("%4d  %8lu  %15lu  %11.1f / %.1f\n", i, (unsigned long)h->requests, (unsigned long)h->outside,
+               pct(h->delays_ms, h->n_delays, 50) / 1000.0, pct(h->delays_ms, h->n_delays, 99) / 1000.0);
+        total += h->requests;
+    }
+    qsort(all_delays, n_all, sizeof(uint32_t), cmp_u32);
+    printf("\n%.0f requests/hour (%.2f/s), fixed %d s polling would send %.0f\n",
+           total / 24.0, total / 86400.0, CONFIG_HA_POLL_BASE_MS / 1000,
+           ENTITIES * 3600000.0 / CONFIG_HA_POLL_BASE_MS);
+    printf("outside changes seen after p50 %.1f s, p90 %.1f s, p99 %.1f s\n",
+           pct(all_delays, n_all, 50) / 1000.0, pct(all_delays, n_all, 90) / 1000.0,
+           pct(all_delays, n_all, 99) / 1000.0);
+
+    metrics_foreach(print_staleness, NULL);
+    return EXIT_SUCCESS;
+}
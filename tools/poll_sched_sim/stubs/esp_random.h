@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+// Host stand-in: the test supplies a seeded generator
+uint32_t esp_random(void);
@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in: the Kconfig defaults (main/Kconfig.projbuild), which the
+// Makefile overrides with BASE=, MAX=, FAST= and WINDOW=
+#ifndef CONFIG_HA_POLL_BASE_MS
+#define CONFIG_HA_POLL_BASE_MS        10000
+#endif
+#ifndef CONFIG_HA_POLL_MAX_MS
+#define CONFIG_HA_POLL_MAX_MS         60000
+#endif
+#ifndef CONFIG_HA_POLL_FAST_MS
+#define CONFIG_HA_POLL_FAST_MS        500
+#endif
+#ifndef CONFIG_HA_POLL_FAST_WINDOW_MS
+#define CONFIG_HA_POLL_FAST_WINDOW_MS 5000
+#endif